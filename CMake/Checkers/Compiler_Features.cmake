@@ -40,6 +40,7 @@ check_c_compiler_flag("-msse3"           CONFIG_COMPILER_HAS_SSE3)
 check_c_compiler_flag("-mavx"            CONFIG_COMPILER_HAS_AVX)
 check_c_compiler_flag("-mavx2"           CONFIG_COMPILER_HAS_AVX2)
 check_c_compiler_flag("-mavx512f"        CONFIG_COMPILER_HAS_AVX512)
+check_c_compiler_flag("-mavx512bf16"     CONFIG_COMPILER_HAS_AVX512BF16)
 check_c_compiler_flag("-march=x86-64"    CONFIG_COMPILER_HAS_X86_64)
 check_c_compiler_flag("-march=znver1"    CONFIG_COMPILER_HAS_ZEN)
 check_c_compiler_flag("-march=znver2"    CONFIG_COMPILER_HAS_ZEN2)
@@ -164,6 +165,19 @@ macro(get_avx512_flag avx512flag)
   set(${avx512flag} -mavx512f -mavx512dq -mfma)
 endmacro()
 
+macro(get_f16c_flag f16cflag)
+  set(${f16cflag} -mf16c)
+endmacro()
+
+# Without it the BF16 kernels fall back to emulated conversions.
+macro(get_avx512bf16_flag bf16flag)
+  if(CONFIG_COMPILER_HAS_AVX512BF16)
+    set(${bf16flag} -mavx512bf16)
+  else()
+    set(${bf16flag})
+  endif()
+endmacro()
+
 macro(get_fastmath_flag fmflag)
   set(${fmflag} -Dlibalmfast_EXPORTS)
 endmacro()
@@ -56,6 +56,8 @@ function(cct_display_banner)
     message(" - Enabled? :              \"${${PROJECT_PREFIX}_LIBM_ENABLE_ASAN}\"")
     message("Code Coverage Settings:")
     message(" - Enabled? :              \"${${PROJECT_PREFIX}_LIBM_ENABLE_COVERAGE}\"")
+    message("Call Statistics Settings:")
+    message(" - Enabled? :              \"${${PROJECT_PREFIX}_LIBM_ENABLE_STATS}\"")
     message("Examples settings:")
     message(" - Enabled? :              \"${${PROJECT_PREFIX}_LIBM_BUILD_EXAMPLES}\"")
     message("Documentation settings:")
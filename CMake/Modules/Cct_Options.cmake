@@ -37,3 +37,4 @@ option(LIBM_BUILD_DOCS "LibM Doc build with DOXYGEN/Sphinx" OFF)
 option(LIBM_BUILD_TESTSUITE "Enable Building LibM-Testsuite." OFF)
 option(LIBM_ENABLE_ASAN "Enable AddressSanitizer." OFF)
 option(LIBM_ENABLE_COVERAGE "Enable code coverage." OFF)
+option(LIBM_ENABLE_STATS "Enable per-function call and slow-path counters." OFF)
@@ -61,6 +61,7 @@ set(${PROJECT_PREFIX}_LIBM_BUILD_DOCS ${LIBM_BUILD_DOCS})
 set(${PROJECT_PREFIX}_LIBM_BUILD_TESTSUITE ${LIBM_BUILD_TESTSUITE})
 set(${PROJECT_PREFIX}_LIBM_ENABLE_ASAN ${LIBM_ENABLE_ASAN})
 set(${PROJECT_PREFIX}_LIBM_ENABLE_COVERAGE ${LIBM_ENABLE_COVERAGE})
+set(${PROJECT_PREFIX}_LIBM_ENABLE_STATS ${LIBM_ENABLE_STATS})
 
 set(${PROJECT_PREFIX}_LIBM_ENABLE_ASSERTIONS ${LIBM_ENABLE_ASSERTIONS})
 #--------------------------
@@ -29,6 +29,7 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <type_traits>
 #include "dll_utils.h"
 #include <filesystem>
 #include "alm_test.h"
@@ -69,6 +70,14 @@ void check_outfile_dir(struct YamlOutputs<S> *yop) {
         outfile  = yop->vendor + "_accu_" + yop->api_name + "_" + yop->variant;
     } else if (yop->test_mode == TestMode::E_PERFORMANCE) {
         outfile  = yop->vendor + "_perf_" + yop->api_name + "_" + yop->variant;
+    } else if (yop->test_mode == TestMode::E_SCALING) {
+        outfile  = yop->vendor + "_scal_" + yop->api_name + "_" + yop->variant;
+    } else if (yop->test_mode == TestMode::E_REPLAY) {
+        outfile  = yop->vendor + "_repl_" + yop->api_name + "_" + yop->variant;
+    } else if (yop->test_mode == TestMode::E_MULTITHREAD) {
+        outfile  = yop->vendor + "_mt_" + yop->api_name + "_" + yop->variant;
+    } else if (yop->test_mode == TestMode::E_SWEEP) {
+        outfile  = yop->vendor + "_sweep_" + yop->api_name + "_" + yop->variant;
     } else {
         outfile  = yop->vendor + "_" + yop->api_name + "_" + yop->variant;
     }
@@ -488,6 +497,32 @@ int validate_api(struct AlmLibs *alibs,
     check_outfile_dir(yop);
     set_global_ulp_threshold(yop->ulp_threshold);
 
+    if (yop->test_mode == TestMode::E_SCALING) {
+        if constexpr (std::is_same_v<T, U>) {
+            return scaling_test<U>(alibs, ipp, shimapi, api_type, yop);
+        } else {
+            cout << "Scaling tests do not support " << yop->variant << endl;
+            return -1;
+        }
+    }
+
+    if (yop->test_mode == TestMode::E_REPLAY) {
+        return replay_test<T, U>(alibs, ipp, shimapi, api_type, yop);
+    }
+
+    if (yop->test_mode == TestMode::E_MULTITHREAD) {
+        return multithread_test<T, U>(alibs, ipp, shimapi, api_type, yop);
+    }
+
+    if (yop->test_mode == TestMode::E_SWEEP) {
+        return sweep_test<T, U>(alibs, ipp, shimapi, api_type, yop);
+    }
+
+    if (yop->test_mode == TestMode::E_PERFORMANCE &&
+        (!yop->perf_mode.empty() || !yop->counters.empty())) {
+        return cycle_perf_test<T, U>(alibs, ipp, shimapi, api_type, yop);
+    }
+
     switch (api_type) {
         case API_PROTOTYPE_01:
             api_prototype_01<T, U>(alibs, ipp, shimapi, refapi, yop);
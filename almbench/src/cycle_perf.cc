@@ -0,0 +1,377 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*
+ * Cycle-timed performance tests
+ *
+ * A performance test with "perf_mode:" is timed with the time stamp
+ * counter over whole blocks of calls, instead of one clock read pair per
+ * call, and reported in core clock cycles per element:
+ *
+ *   latency     each call takes the previous result as its first input,
+ *               so calls cannot overlap: the time of a dependent chain,
+ *               as in an iteration that feeds a result back in.
+ *   throughput  independent inputs, four calls per loop iteration, so
+ *               the core overlaps them: the cost in a loop over data.
+ *
+ * The result is fed back by OR-ing it, AND-ed with a zero the compiler
+ * cannot see, into the next input, which leaves the input values as
+ * generated. The same loop around an empty shim gives the cost of the
+ * harness itself (argument packing, the shim call and the chaining), which
+ * is subtracted. Array variants are timed as one call per block and only
+ * in throughput mode.
+ *
+ * Each test runs CP_WARMUP untimed blocks, then CP_SAMPLES timed blocks of
+ * the function and the empty shim in turn. Samples further than 3 scaled
+ * median absolute deviations from the median are dropped; the mean of the
+ * rest is reported with its 95% confidence interval. TSC ticks are
+ * converted to core cycles with the ratio measured at start-up (see
+ * tsc_calibration()), so a core running above or below its nominal clock
+ * still reports cycles.
+ *
+ * A "counters:" list adds perf_event counts (see perf_counters in
+ * hrt_utils.h) per element, read over another CP_SAMPLES blocks of each so
+ * that the counter reads do not disturb the timing. Like the cycles they
+ * are net of the empty shim, whose counts are reported alongside. Tests
+ * with counters and no perf_mode run in throughput mode.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <type_traits>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+#include "dll_utils.h"
+#include "alm_test.h"
+#include "api_template.h"
+#include "api_runner.h"
+#include "generator.h"
+
+/* Untimed blocks before the timed ones */
+#define CP_WARMUP  3
+
+/* Timed blocks of the function and of the empty shim */
+#define CP_SAMPLES 31
+
+/* Calls per loop iteration in throughput mode */
+#define CP_UNROLL  4
+
+/* Zero the compiler cannot fold, for feeding results back */
+static volatile uint64_t cp_zero = 0;
+
+/*
+ * null_shim:
+ * Stands in for a shim in the overhead runs: copies the input through
+ * as the output, or for arrays does nothing.
+ */
+template <typename T, typename U>
+static void null_shim(InParams<T, U> *ipp)
+{
+    ipp->op[0] = ipp->ip[0];
+}
+
+template <typename T, typename U>
+static void null_shim_vra(InParams<T, U> *)
+{
+}
+
+/*
+ * chain:
+ * next with the bits of out AND-ed with zero OR-ed in, lane by lane: the
+ * value of next, available only once out is.
+ */
+template <typename T, typename U>
+static inline T chain(const T &next, const T &out, uint64_t zero)
+{
+    using B = std::conditional_t<sizeof(U) == 4, uint32_t, uint64_t>;
+    constexpr size_t lanes = sizeof(T) / sizeof(U);
+    B a[lanes], b[lanes];
+    std::memcpy(a, &next, sizeof(T));
+    std::memcpy(b, &out, sizeof(T));
+    for (size_t l = 0; l < lanes; ++l) {
+        a[l] |= b[l] & static_cast<B>(zero);
+    }
+    T r;
+    std::memcpy(&r, a, sizeof(T));
+    return r;
+}
+
+/*
+ * time_block:
+ * TSC ticks of one block: every packed argument once, or one array call.
+ */
+template <typename T, typename U>
+static uint64_t time_block(void (*shim_func)(InParams<T, U> *),
+                           InParams<T, U> *local, bool is_vra, bool latency,
+                           const std::vector<T> &arg0, const std::vector<T> &arg1)
+{
+    const size_t n = arg0.size();
+    const uint64_t zero = cp_zero;
+
+    if (is_vra) {
+        uint64_t s = read_tsc();
+        shim_func(local);
+        return read_tsc() - s;
+    }
+
+    uint64_t s = read_tsc();
+    if (latency) {
+        local->ip[0] = arg0[0];
+        for (size_t c = 0; c < n; ++c) {
+            local->ip[1] = arg1[c];
+            shim_func(local);
+            local->ip[0] = chain<T, U>(arg0[(c + 1 < n) ? c + 1 : 0], local->op[0], zero);
+        }
+    } else {
+        size_t c = 0;
+        for (; c + CP_UNROLL <= n; c += CP_UNROLL) {
+            for (size_t u = 0; u < CP_UNROLL; ++u) {
+                local->ip[0] = arg0[c + u];
+                local->ip[1] = arg1[c + u];
+                shim_func(local);
+            }
+        }
+        for (; c < n; ++c) {
+            local->ip[0] = arg0[c];
+            local->ip[1] = arg1[c];
+            shim_func(local);
+        }
+    }
+    return read_tsc() - s;
+}
+
+/*
+ * cycle_perf_test:
+ * Times one variant in the mode of the test and appends the result to
+ * the performance output file of the test.
+ */
+template <typename T, typename U>
+int cycle_perf_test(struct AlmLibs *alibs,
+                    struct InParams<T, U> *ipp,
+                    const std::string &libapi,
+                    ApiTypes api_type,
+                    struct YamlOutputs<U> *yop)
+{
+    bool latency = (yop->perf_mode == "latency");
+    if (!latency && yop->perf_mode != "throughput" && !yop->perf_mode.empty()) {
+        std::cerr << "Unknown perf_mode '" << yop->perf_mode << "' in test "
+                  << yop->test_id << ", expected latency or throughput" << std::endl;
+        return -1;
+    }
+
+    if (api_type > API_PROTOTYPE_04 ||
+        (api_type == API_PROTOTYPE_03 && !yop->is_vra)) {
+        std::cout << "Cycle-timed tests support prototypes 01-04 only, "
+                  << "skipping: " << yop->api_name << " " << yop->variant
+                  << std::endl;
+        return -1;
+    }
+
+    if (ipp->range.empty()) {
+        std::cerr << "Cycle-timed test " << yop->test_id
+                  << " needs an input range" << std::endl;
+        return -1;
+    }
+
+    if (latency && yop->is_vra) {
+        std::cout << "Latency mode needs a scalar or vector variant, timing "
+                  << yop->variant << " in throughput mode" << std::endl;
+        latency = false;
+    }
+
+    using ShimFunc = void (*)(InParams<T, U> *);
+    ShimFunc shim_func = load_function<ShimFunc>(alibs->pshimlib, libapi);
+    ShimFunc empty     = yop->is_vra ? null_shim_vra<T, U> : null_shim<T, U>;
+
+    const uint64_t lanes = sizeof(T) / sizeof(U);
+    uint64_t count = ipp->range[0].count;
+    if (!yop->is_vra) {
+        count -= count % lanes;
+    }
+    if (count == 0) {
+        std::cerr << "Cycle-timed test " << yop->test_id
+                  << " needs at least " << lanes << " elements" << std::endl;
+        return -1;
+    }
+
+    /* Inputs as generated for the range tests */
+    const auto &r0 = ipp->range[0];
+    const auto &r1 = (ipp->range.size() > 1) ? ipp->range[1] : r0;
+    MultiStepGenerator<U> g0(r0.srt, r0.stp, count, r0.type, count);
+    MultiStepGenerator<U> g1(r1.srt, r1.stp, count, r1.type, count);
+    U *p0 = g0.wrap_next();
+    U *p1 = g1.wrap_next();
+    std::vector<U> in0(p0, p0 + count), in1(p1, p1 + count);
+    std::vector<U> out0(count), out1(count);
+
+    InParams<T, U> local{};
+    U powx_y = r1.srt;
+    local.count   = count;
+    local.iptr[0] = in0.data();
+    local.iptr[1] = (api_type == API_PROTOTYPE_03) ? &powx_y : in1.data();
+    local.optr[0] = out0.data();
+    local.optr[1] = out1.data();
+
+    std::vector<T> arg0, arg1;
+    if (!yop->is_vra) {
+        for (uint64_t i = 0; i < count; i += lanes) {
+            T a{}, b{};
+            std::memcpy(&a, &in0[i], sizeof(T));
+            std::memcpy(&b, &in1[i], sizeof(T));
+            arg0.push_back(a);
+            arg1.push_back(b);
+        }
+    }
+
+    for (int w = 0; w < CP_WARMUP; ++w) {
+        time_block<T, U>(shim_func, &local, yop->is_vra, latency, arg0, arg1);
+        time_block<T, U>(empty, &local, yop->is_vra, latency, arg0, arg1);
+    }
+
+    /* Function and empty shim in turn, so that both see the same clock */
+    const TscCalibration &cal = tsc_calibration();
+    const double per_elem = cal.core_cycles / static_cast<double>(count);
+    std::vector<double> fn, base;
+    for (int s = 0; s < CP_SAMPLES; ++s) {
+        uint64_t f = time_block<T, U>(shim_func, &local, yop->is_vra, latency, arg0, arg1);
+        uint64_t b = time_block<T, U>(empty, &local, yop->is_vra, latency, arg0, arg1);
+        fn.push_back(static_cast<double>(f) * per_elem);
+        base.push_back(static_cast<double>(b) * per_elem);
+    }
+
+    /* Counters over their own blocks, median per element */
+    perf_counters pc(yop->counters);
+    const size_t nc = pc.names().size();
+    std::vector<std::vector<double>> cf(nc), cb(nc);
+    for (int s = 0; s < CP_SAMPLES && nc > 0; ++s) {
+        pc.start();
+        time_block<T, U>(shim_func, &local, yop->is_vra, latency, arg0, arg1);
+        std::vector<double> f = pc.stop();
+        pc.start();
+        time_block<T, U>(empty, &local, yop->is_vra, latency, arg0, arg1);
+        std::vector<double> b = pc.stop();
+        for (size_t i = 0; i < nc; ++i) {
+            cf[i].push_back(f[i] / static_cast<double>(count));
+            cb[i].push_back(b[i] / static_cast<double>(count));
+        }
+    }
+
+    SampleStats sf = sample_stats(fn);
+    SampleStats sb = sample_stats(base);
+    double cycles = sf.mean - sb.mean;
+    double ci95   = std::sqrt(sf.ci95 * sf.ci95 + sb.ci95 * sb.ci95);
+    double ns     = cycles / cal.core_cycles * cal.ns;
+    const char *mode = latency ? "latency" : "throughput";
+
+    std::cout << "Cycle-timed " << mode << ": " << yop->api_name << " "
+              << yop->variant << ", " << count << " elements" << std::endl;
+    std::cout << std::fixed << std::setprecision(2)
+              << "  cycles/elem " << cycles << " +- " << ci95
+              << " (median " << sf.median - sb.median
+              << ", min " << sf.min - sb.min << ")"
+              << ", harness " << sb.mean
+              << ", ns/elem " << ns
+              << ", rejected " << sf.rejected + sb.rejected
+              << " of " << 2 * CP_SAMPLES
+              << std::defaultfloat << std::endl;
+    for (size_t i = 0; i < nc; ++i) {
+        std::cout << "  " << std::left << std::setw(18) << pc.names()[i] << std::right
+                  << std::fixed << std::setprecision(3)
+                  << sample_stats(cf[i]).median - sample_stats(cb[i]).median
+                  << " /elem, harness " << sample_stats(cb[i]).median
+                  << std::defaultfloat << std::endl;
+    }
+    if (!cal.measured) {
+        std::cout << "  core clock not measured, cycles are TSC ticks" << std::endl;
+    }
+
+    YAML::Node node;
+    node["test_id"]         = yop->test_id;
+    node["api_name"]        = yop->api_name;
+    node["variant"]         = yop->variant;
+    node["library"]         = yop->vendor;
+    node["perf_mode"]       = mode;
+    node["count"]           = count;
+    node["samples"]         = CP_SAMPLES;
+    node["rejected"]        = sf.rejected + sb.rejected;
+    node["cycles_per_elem"] = cycles;
+    node["ci95"]            = ci95;
+    node["median"]          = sf.median - sb.median;
+    node["min"]             = sf.min - sb.min;
+    node["harness"]         = sb.mean;
+    node["ns_per_elem"]     = ns;
+    node["core_per_tsc"]    = cal.core_cycles;
+    if (nc > 0) {
+        YAML::Node counts, harness;
+        for (size_t i = 0; i < nc; ++i) {
+            double b = sample_stats(cb[i]).median;
+            counts[pc.names()[i]]  = sample_stats(cf[i]).median - b;
+            harness[pc.names()[i]] = b;
+        }
+        node["counters"]         = counts;
+        node["counters_harness"] = harness;
+    }
+
+    std::ofstream fout(yop->outfile, std::ios::app);
+    if (!fout.is_open()) {
+        std::cerr << "Error: Could not open file " << yop->outfile
+                  << " for writing." << std::endl;
+        return -1;
+    }
+    fout << node << "\n";
+
+    return 0;
+}
+
+/* Explicit template instantiations */
+template int cycle_perf_test<float, float>(struct AlmLibs *, struct InParams<float, float> *,
+                                    const std::string &, ApiTypes,
+                                    struct YamlOutputs<float> *);
+template int cycle_perf_test<double, double>(struct AlmLibs *, struct InParams<double, double> *,
+                                    const std::string &, ApiTypes,
+                                    struct YamlOutputs<double> *);
+template int cycle_perf_test<libm::AlignedM128, float>(struct AlmLibs *, struct InParams<libm::AlignedM128, float> *,
+                                    const std::string &, ApiTypes,
+                                    struct YamlOutputs<float> *);
+template int cycle_perf_test<libm::AlignedM128d, double>(struct AlmLibs *, struct InParams<libm::AlignedM128d, double> *,
+                                    const std::string &, ApiTypes,
+                                    struct YamlOutputs<double> *);
+template int cycle_perf_test<libm::AlignedM256, float>(struct AlmLibs *, struct InParams<libm::AlignedM256, float> *,
+                                    const std::string &, ApiTypes,
+                                    struct YamlOutputs<float> *);
+template int cycle_perf_test<libm::AlignedM256d, double>(struct AlmLibs *, struct InParams<libm::AlignedM256d, double> *,
+                                    const std::string &, ApiTypes,
+                                    struct YamlOutputs<double> *);
+#ifdef __AVX512F__
+template int cycle_perf_test<libm::AlignedM512, float>(struct AlmLibs *, struct InParams<libm::AlignedM512, float> *,
+                                    const std::string &, ApiTypes,
+                                    struct YamlOutputs<float> *);
+template int cycle_perf_test<libm::AlignedM512d, double>(struct AlmLibs *, struct InParams<libm::AlignedM512d, double> *,
+                                    const std::string &, ApiTypes,
+                                    struct YamlOutputs<double> *);
+#endif
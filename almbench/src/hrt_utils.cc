@@ -29,9 +29,21 @@
 #include <algorithm>
 #include <cmath>
 #include <iomanip>
+#include <set>
 #include <fstream>
 #include <sstream>
 #include <yaml-cpp/yaml.h>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#if defined(__linux__)
+#include <cpuid.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 /*
  * start:
@@ -66,4 +78,321 @@ double timing_wrapper::stop()
     std::chrono::duration<double, std::nano> duration = end_time - start_time;
     return duration.count();
 #endif
-}
\ No newline at end of file
+}
+
+/*
+ * core_loop:
+ * Chain of dependent 64-bit multiplies, 3 core clock cycles each on the
+ * x86 cores of the last decade, used to measure the core clock against
+ * the TSC. Adds would be shorter but newer cores fold immediate adds.
+ */
+#if defined(__GNUC__)
+static uint64_t core_loop(uint64_t iterations)
+{
+    uint64_t acc = 1, one = 1;
+    __asm__ __volatile__(
+        "1:\n\t"
+        "imul %2, %0\n\t" "imul %2, %0\n\t" "imul %2, %0\n\t" "imul %2, %0\n\t"
+        "imul %2, %0\n\t" "imul %2, %0\n\t" "imul %2, %0\n\t" "imul %2, %0\n\t"
+        "dec %1\n\t"
+        "jnz 1b\n\t"
+        : "+r"(acc), "+r"(iterations)
+        : "r"(one)
+        : "cc");
+    return acc;
+}
+#endif
+
+/*
+ * tsc_calibration:
+ * Measures the TSC against the steady clock and, with GCC and Clang,
+ * the core clock against the TSC (best of a few runs of core_loop, after
+ * one run to bring the core out of its idle clock).
+ */
+const TscCalibration &tsc_calibration()
+{
+    static const TscCalibration cal = []() {
+        TscCalibration c{1.0, 1.0, false};
+
+        auto t0 = std::chrono::steady_clock::now();
+        uint64_t c0 = read_tsc();
+        while (std::chrono::steady_clock::now() - t0 < std::chrono::milliseconds(20)) {
+        }
+        auto t1 = std::chrono::steady_clock::now();
+        uint64_t c1 = read_tsc();
+        double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+        c.ns = ns / static_cast<double>(c1 - c0);
+
+#if defined(__GNUC__)
+        const uint64_t iterations = 1 << 18;
+        core_loop(iterations);
+        uint64_t best = UINT64_MAX;
+        for (int i = 0; i < 5; ++i) {
+            uint64_t s = read_tsc();
+            core_loop(iterations);
+            best = std::min(best, read_tsc() - s);
+        }
+        c.core_cycles = 24.0 * static_cast<double>(iterations) / static_cast<double>(best);
+        c.measured = true;
+#endif
+        return c;
+    }();
+
+    return cal;
+}
+
+/*
+ * t_95:
+ * Two sided 95% quantile of Student's t distribution.
+ */
+static double t_95(uint64_t dof)
+{
+    static const double table[] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+         2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+         2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042,
+    };
+    if (dof == 0) {
+        return 0.0;
+    }
+    return (dof <= 30) ? table[dof - 1] : 1.96;
+}
+
+/*
+ * sample_stats:
+ * Median, mean and confidence interval of the samples within 3 scaled
+ * median absolute deviations of the median.
+ */
+SampleStats sample_stats(std::vector<double> samples)
+{
+    SampleStats st{0.0, 0.0, 0.0, 0.0, 0, 0};
+    if (samples.empty()) {
+        return st;
+    }
+
+    auto median_of = [](std::vector<double> v) {
+        std::sort(v.begin(), v.end());
+        size_t n = v.size();
+        return (n % 2) ? v[n / 2] : 0.5 * (v[n / 2 - 1] + v[n / 2]);
+    };
+
+    st.median = median_of(samples);
+    std::vector<double> dev;
+    for (double x : samples) {
+        dev.push_back(std::fabs(x - st.median));
+    }
+    /* Not below 0.5% of the median, for runs of identical samples */
+    double limit = std::max(3.0 * 1.4826 * median_of(dev), 0.005 * std::fabs(st.median));
+
+    std::vector<double> kept;
+    for (double x : samples) {
+        if (std::fabs(x - st.median) <= limit) {
+            kept.push_back(x);
+        }
+    }
+    st.kept     = kept.size();
+    st.rejected = samples.size() - kept.size();
+    st.min      = *std::min_element(samples.begin(), samples.end());
+
+    double sum = 0.0;
+    for (double x : kept) {
+        sum += x;
+    }
+    st.mean = sum / static_cast<double>(kept.size());
+
+    if (kept.size() > 1) {
+        double var = 0.0;
+        for (double x : kept) {
+            var += (x - st.mean) * (x - st.mean);
+        }
+        var /= static_cast<double>(kept.size() - 1);
+        st.ci95 = t_95(kept.size() - 1) * std::sqrt(var / static_cast<double>(kept.size()));
+    }
+
+    return st;
+}
+
+#if defined(__linux__)
+/*
+ * perf_event_code:
+ * perf_event type and config of a counter name, false if unknown here.
+ */
+static bool perf_event_code(const std::string &name, uint32_t &type, uint64_t &config)
+{
+    auto cache = [](uint64_t id, uint64_t op, uint64_t result) {
+        return id | (op << 8) | (result << 16);
+    };
+
+    static const struct {
+        const char *name;
+        uint32_t    type;
+        uint64_t    config;
+    } generic[] = {
+        {"cycles",           PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {"instructions",     PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {"branches",         PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_INSTRUCTIONS},
+        {"branch_misses",    PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+        {"cache_misses",     PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        {"task_clock",       PERF_TYPE_SOFTWARE, PERF_COUNT_SW_TASK_CLOCK},
+        {"page_faults",      PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS},
+        {"context_switches", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES},
+    };
+
+    for (const auto &g : generic) {
+        if (name == g.name) {
+            type   = g.type;
+            config = g.config;
+            return true;
+        }
+    }
+
+    type = PERF_TYPE_HW_CACHE;
+    if (name == "l1d_loads") {
+        config = cache(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ,
+                       PERF_COUNT_HW_CACHE_RESULT_ACCESS);
+        return true;
+    }
+    if (name == "l1d_miss") {
+        config = cache(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ,
+                       PERF_COUNT_HW_CACHE_RESULT_MISS);
+        return true;
+    }
+    if (name == "dtlb_miss") {
+        config = cache(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ,
+                       PERF_COUNT_HW_CACHE_RESULT_MISS);
+        return true;
+    }
+
+    type = PERF_TYPE_RAW;
+    if (name.size() > 1 && name[0] == 'r') {
+        char *end = nullptr;
+        config = std::strtoull(name.c_str() + 1, &end, 16);
+        return end && *end == '\0';
+    }
+
+    /* Core events of AMD family 17h and later, umask << 8 | event */
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0, &eax, &ebx, &ecx, &edx) || ebx != 0x68747541) {   /* "Auth" */
+        return false;
+    }
+    __get_cpuid(1, &eax, &ebx, &ecx, &edx);
+    unsigned int family = ((eax >> 8) & 0xf) + ((eax >> 20) & 0xff);
+    unsigned int model  = ((eax >> 4) & 0xf) | ((eax >> 12) & 0xf0);
+    if (family < 0x17) {
+        return false;
+    }
+    bool zen3_or_older = family == 0x17 ||
+                         (family == 0x19 && (model < 0x10 || (model >= 0x20 && model < 0x60)));
+
+    if (name == "uops") {
+        config = 0x00c1;                              /* ex_ret_ops */
+        return true;
+    }
+    if (name == "fp_ops") {
+        config = zen3_or_older ? 0xff03 : 0x1f03;     /* fp_ret_sse_avx_ops.all */
+        return true;
+    }
+    if (name == "l2_miss") {
+        config = 0x0964;                              /* l2_cache_req_stat.ic_dc_miss_in_l2 */
+        return true;
+    }
+
+    return false;
+}
+#endif
+
+/*
+ * perf_counters:
+ * Opens the events that are known and available, the first as the group
+ * leader.
+ */
+perf_counters::perf_counters(const std::vector<std::string> &events)
+    : leader(-1)
+{
+#if defined(__linux__)
+    static std::set<std::string> reported;
+
+    for (const auto &name : events) {
+        uint32_t type;
+        uint64_t config;
+        if (!perf_event_code(name, type, config)) {
+            if (reported.insert(name).second) {
+                std::cerr << "Counter '" << name << "' is not known on this CPU, "
+                          << "use a raw event code (r<hex>)" << std::endl;
+            }
+            continue;
+        }
+
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size           = sizeof(attr);
+        attr.type           = type;
+        attr.config         = config;
+        attr.disabled       = (leader < 0) ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                              PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0));
+        if (fd < 0) {
+            if (reported.insert(name).second) {
+                std::cerr << "Counter '" << name << "' could not be opened: "
+                          << std::strerror(errno) << std::endl;
+            }
+            continue;
+        }
+        if (leader < 0) {
+            leader = fd;
+        }
+        fds.push_back(fd);
+        opened.push_back(name);
+    }
+#else
+    if (!events.empty()) {
+        std::cerr << "Counters are only supported on Linux" << std::endl;
+    }
+#endif
+}
+
+perf_counters::~perf_counters()
+{
+#if defined(__linux__)
+    for (int fd : fds) {
+        close(fd);
+    }
+#endif
+}
+
+void perf_counters::start()
+{
+#if defined(__linux__)
+    if (leader >= 0) {
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+std::vector<double> perf_counters::stop()
+{
+    std::vector<double> counts(opened.size(), 0.0);
+#if defined(__linux__)
+    if (leader < 0) {
+        return counts;
+    }
+    ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    /* nr, time_enabled, time_running, one value per event */
+    std::vector<uint64_t> buf(3 + fds.size());
+    ssize_t n = read(leader, buf.data(), buf.size() * sizeof(uint64_t));
+    if (n < static_cast<ssize_t>(3 * sizeof(uint64_t)) || buf[2] == 0) {
+        return counts;
+    }
+    double scale = static_cast<double>(buf[1]) / static_cast<double>(buf[2]);
+    for (size_t i = 0; i < counts.size() && i < buf[0]; ++i) {
+        counts[i] = static_cast<double>(buf[3 + i]) * scale;
+    }
+#endif
+    return counts;
+}
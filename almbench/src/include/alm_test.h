@@ -52,7 +52,11 @@ enum class TestMode{
     E_UNITTEST,
     E_ACCURACY,
     E_PERFORMANCE,
-    E_KNOWNTEST
+    E_KNOWNTEST,
+    E_SCALING,
+    E_REPLAY,
+    E_MULTITHREAD,
+    E_SWEEP
 };
 
 extern bool verbose;
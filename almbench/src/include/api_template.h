@@ -101,4 +101,57 @@ int api_prototype_06(struct AlmLibs *alibs,
                      struct InParams<T, U> *ipp,
                      const std::string &libapi,
                      const std::string &refapi,
-                     struct YamlOutputs<U> *yop);
\ No newline at end of file
+                     struct YamlOutputs<U> *yop);
+
+/*
+ * Strong scaling test of an array variant (see scaling.cc).
+ */
+template <typename U>
+int scaling_test(struct AlmLibs *alibs,
+                 struct InParams<U, U> *ipp,
+                 const std::string &libapi,
+                 ApiTypes api_type,
+                 struct YamlOutputs<U> *yop);
+
+/* Thread counts of a "threads:" list, shared with the multi-threaded tests */
+std::vector<int> scaling_threads(const std::vector<std::string> &list);
+
+/*
+ * Replay of the calls recorded in a capture trace (see replay.cc).
+ */
+template <typename T, typename U>
+int replay_test(struct AlmLibs *alibs,
+                struct InParams<T, U> *ipp,
+                const std::string &libapi,
+                ApiTypes api_type,
+                struct YamlOutputs<U> *yop);
+
+/*
+ * Multi-threaded (weak scaling) throughput test (see multithread.cc).
+ */
+template <typename T, typename U>
+int multithread_test(struct AlmLibs *alibs,
+                     struct InParams<T, U> *ipp,
+                     const std::string &libapi,
+                     ApiTypes api_type,
+                     struct YamlOutputs<U> *yop);
+
+/*
+ * Cycle-timed latency or throughput test (see cycle_perf.cc).
+ */
+template <typename T, typename U>
+int cycle_perf_test(struct AlmLibs *alibs,
+                    struct InParams<T, U> *ipp,
+                    const std::string &libapi,
+                    ApiTypes api_type,
+                    struct YamlOutputs<U> *yop);
+
+/*
+ * Array length sweep (see sweep.cc).
+ */
+template <typename T, typename U>
+int sweep_test(struct AlmLibs *alibs,
+               struct InParams<T, U> *ipp,
+               const std::string &libapi,
+               ApiTypes api_type,
+               struct YamlOutputs<U> *yop);
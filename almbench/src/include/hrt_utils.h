@@ -28,13 +28,16 @@
 #pragma once
 
 #include <vector>
+#include <string>
 #include <cstddef>
 #include "alm_test.h"
 
 #ifdef _WIN32
 #include <windows.h>
+#include <intrin.h>
 #else
 #include <chrono>
+#include <x86intrin.h>
 #endif
 
 /*
@@ -63,3 +66,86 @@ public:
     /* Reset internal state */
     void reset();
 };
+
+/*
+ * read_tsc:
+ * Time stamp counter, read with rdtscp so that the instructions before
+ * it have completed, and fenced so that later ones do not start early.
+ */
+static inline uint64_t read_tsc()
+{
+    unsigned int aux;
+    uint64_t tsc = __rdtscp(&aux);
+    _mm_lfence();
+    return tsc;
+}
+
+/*
+ * TscCalibration:
+ * Rate of the time stamp counter, measured once per process. The TSC
+ * ticks at a constant rate; core_cycles is the core clock cycles per
+ * tick at the time of calibration (1.0 where it cannot be measured).
+ */
+struct TscCalibration {
+    double core_cycles;                  /* Core clock cycles per TSC tick */
+    double ns;                           /* Nanoseconds per TSC tick */
+    bool   measured;                     /* core_cycles was measured */
+};
+
+const TscCalibration &tsc_calibration();
+
+/*
+ * SampleStats:
+ * Summary of repeated measurements after outlier rejection: samples
+ * further than 3 scaled median absolute deviations from the median are
+ * dropped, ci95 is the half width of the 95% confidence interval of the
+ * mean of the rest.
+ */
+struct SampleStats {
+    double   mean;
+    double   median;
+    double   min;
+    double   ci95;
+    uint64_t kept;
+    uint64_t rejected;
+};
+
+SampleStats sample_stats(std::vector<double> samples);
+
+/*
+ * perf_counters:
+ * Hardware and software event counters of the calling thread, opened as
+ * one perf_event group so that they count over the same instructions.
+ * Events are named as in a test's "counters:" list:
+ *
+ *   cycles, instructions, branches, branch_misses, cache_misses,
+ *   l1d_loads, l1d_miss, dtlb_miss          generic kernel events
+ *   task_clock, page_faults, context_switches   software events
+ *   uops, fp_ops, l2_miss                   AMD Zen core events
+ *   r<hex>                                  raw event code, as in perf
+ *
+ * Events that cannot be opened are reported once and left out. Linux
+ * only; elsewhere no event opens.
+ */
+class perf_counters {
+public:
+    explicit perf_counters(const std::vector<std::string> &events);
+    ~perf_counters();
+
+    perf_counters(const perf_counters &) = delete;
+    perf_counters &operator=(const perf_counters &) = delete;
+
+    /* Events that were opened, in the order of the values of stop() */
+    const std::vector<std::string> &names() const { return opened; }
+
+    /* Reset and enable the group */
+    void start();
+
+    /* Disable the group and return the counts, scaled if multiplexed */
+    std::vector<double> stop();
+
+private:
+    int                      leader;
+    std::vector<int>         fds;
+    std::vector<std::string> opened;
+};
@@ -56,6 +56,11 @@ struct YamlInputs {
     std::string xxv;                     /* Expected floating-point exception */
     std::string ulp_threshold;           /* ULP threshold for accuracy tests */
     std::vector<InputRange> range;       /* Input ranges for range tests */
+    std::vector<std::string> threads;    /* Thread counts for scaling tests */
+    std::string trace;                   /* Capture trace of replay tests */
+    bool numa = false;                   /* Spread threads over NUMA nodes */
+    std::string perf_mode;               /* latency or throughput, cycle-timed */
+    std::vector<std::string> counters;   /* perf_event counters of cycle-timed tests */
 };
 
 /*
@@ -80,6 +85,11 @@ struct YamlOutputs {
     TestMode    test_mode;                   /* Test mode (accuracy or performance) */
     std::string vendor;                      /* Vendor name */
     std::string outfile;                     /* Output yaml file name */
+    std::vector<std::string> threads;        /* Thread counts for scaling tests */
+    std::string trace;                       /* Capture trace of replay tests */
+    bool        numa;                        /* Spread threads over NUMA nodes */
+    std::string perf_mode;                   /* latency or throughput, cycle-timed */
+    std::vector<std::string> counters;       /* perf_event counters of cycle-timed tests */
 
 
     /* Constructor */
@@ -87,7 +97,7 @@ struct YamlOutputs {
         : variant(var), ulp(nullptr), status(nullptr),
           utflag(false), exception_raised(0),
           duration(0.0), is_vra(false), test_mode(TestMode::E_ACCURACY),
-          vendor("amd"), outfile("amd_api_ut_ss.yaml")
+          vendor("amd"), outfile("amd_api_ut_ss.yaml"), numa(false)
     {
         std::fill(std::begin(n), std::end(n), 0);
         std::fill(std::begin(iptr), std::end(iptr), nullptr);
@@ -152,6 +162,9 @@ void set_type_filter(const std::string& type);
 
 int read_yaml_file(const std::string &filename, std::vector<struct YamlInputs> &params);
 
+// Replay tests of every function recorded in a capture trace (replay.cc)
+int read_trace_params(const std::string &path, std::vector<struct YamlInputs> &params);
+
 template <typename S>
 void write_yaml_output(const struct YamlOutputs<S> *yop);
 
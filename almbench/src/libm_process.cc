@@ -211,11 +211,16 @@ void libm_api_variant(struct AlmLibs *alibs, const struct YamlInputs &param,
 
     yop->variant = variant;
     yop->api_name = param.api_name;
-    yop->utflag = param.range.empty();
+    yop->utflag = param.range.empty() && test_mode != TestMode::E_REPLAY;
     yop->test_mode = test_mode;
     yop->vendor = vendor;
     yop->ulp_threshold = std::stod(ulp_threshold);
     yop->test_id = param.test_id;
+    yop->threads = param.threads;
+    yop->trace = param.trace;
+    yop->numa = param.numa;
+    yop->perf_mode = param.perf_mode;
+    yop->counters = param.counters;
 
     if (!param.range.empty()) {
         struct InpRng<U> iprng;
@@ -279,7 +284,17 @@ void process_libm(struct AlmLibs *alibs, const std::vector<struct YamlInputs> &p
         std::string uth;
 
         // Derive test_mode from test_type
-        test_mode = (param.test_type.find("perf") != std::string::npos) ? TestMode::E_PERFORMANCE : TestMode::E_ACCURACY;
+        if (param.test_type.find("scaling") != std::string::npos) {
+            test_mode = TestMode::E_SCALING;
+        } else if (param.test_type.find("replay") != std::string::npos) {
+            test_mode = TestMode::E_REPLAY;
+        } else if (param.test_type.find("multithread") != std::string::npos) {
+            test_mode = TestMode::E_MULTITHREAD;
+        } else if (param.test_type.find("sweep") != std::string::npos) {
+            test_mode = TestMode::E_SWEEP;
+        } else {
+            test_mode = (param.test_type.find("perf") != std::string::npos) ? TestMode::E_PERFORMANCE : TestMode::E_ACCURACY;
+        }
 
         while (std::getline(ss, variant, ';')) {
             std::getline(ulp, uth, ';');
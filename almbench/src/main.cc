@@ -59,12 +59,23 @@ void print_usage(const char *program_name)
               << "    <shim_shared_library>    Path to the shim "
               << "shared library.\n"
               << "    <yaml_file>              Path to the YAML "
-              << "configuration file.\n"
+              << "configuration file,\n"
+              << "                             or a trace captured "
+              << "with AOCL_LIBM_CAPTURE\n"
+              << "                             (.almtrace) to replay.\n"
               << "    [--type|-t <test_type>]  Optional test type:\n"
               << "                             'accu' for accuracy "
               << "(default),\n"
               << "                             'perf' for "
-              << "performance.\n"
+              << "performance,\n"
+              << "                             'scal' for "
+              << "strong scaling,\n"
+              << "                             'repl' for "
+              << "replay of a capture trace,\n"
+              << "                             'mt' for "
+              << "multi-threaded throughput,\n"
+              << "                             'sweep' for "
+              << "array length sweeps.\n"
               << "  Note:\n"
               << "    The reference library is automatically loaded "
               << "at build time." << std::endl;
@@ -105,6 +116,27 @@ int main(int argc, char *argv[])
         std::fprintf(stderr,
             "[%s] Auto-detected ACCURACY mode "
             "from filename\n", argv[0]);
+    } else if (yaml_file.find("_scal.yml") != std::string::npos) {
+        test_mode = TestMode::E_SCALING;
+        std::fprintf(stderr,
+            "[%s] Auto-detected SCALING mode "
+            "from filename\n", argv[0]);
+    } else if (yaml_file.find("_mt.yml") != std::string::npos) {
+        test_mode = TestMode::E_MULTITHREAD;
+        std::fprintf(stderr,
+            "[%s] Auto-detected MULTITHREAD mode "
+            "from filename\n", argv[0]);
+    } else if (yaml_file.find("_sweep.yml") != std::string::npos) {
+        test_mode = TestMode::E_SWEEP;
+        std::fprintf(stderr,
+            "[%s] Auto-detected SWEEP mode "
+            "from filename\n", argv[0]);
+    } else if (yaml_file.find("_repl.yml") != std::string::npos ||
+               yaml_file.find(".almtrace") != std::string::npos) {
+        test_mode = TestMode::E_REPLAY;
+        std::fprintf(stderr,
+            "[%s] Auto-detected REPLAY mode "
+            "from filename\n", argv[0]);
     } else if (yaml_file.find("_conf.yml") != std::string::npos) {
         test_mode = TestMode::E_ACCURACY;
         std::fprintf(stderr,
@@ -115,7 +147,8 @@ int main(int argc, char *argv[])
  // Arg3 may be API or TYPE (case-insensitive for type)
     if (argc >= 4 && std::strlen(argv[3]) > 0 && argv[3][0] != '-') {
         std::string t3 = to_upper(argv[3]);
-        if (t3 == "CONF" || t3 == "ACCU" || t3 == "PERF") {
+        if (t3 == "CONF" || t3 == "ACCU" || t3 == "PERF" || t3 == "SCAL" ||
+            t3 == "REPL" || t3 == "MT" || t3 == "SWEEP") {
             set_type_filter(t3);
             set_api_filter("");  // no API filter when type only
             std::fprintf(stderr,
@@ -123,6 +156,14 @@ int main(int argc, char *argv[])
             // Set test_mode based on type filter
             if (t3 == "PERF")
                 test_mode = TestMode::E_PERFORMANCE;
+            else if (t3 == "SCAL")
+                test_mode = TestMode::E_SCALING;
+            else if (t3 == "REPL")
+                test_mode = TestMode::E_REPLAY;
+            else if (t3 == "MT")
+                test_mode = TestMode::E_MULTITHREAD;
+            else if (t3 == "SWEEP")
+                test_mode = TestMode::E_SWEEP;
             else if (t3 == "ACCU")
                 test_mode = TestMode::E_ACCURACY;
         } else {
@@ -135,13 +176,22 @@ int main(int argc, char *argv[])
     // Arg4 is TYPE when both API and TYPE are provided
     if (argc >= 5 && std::strlen(argv[4]) > 0 && argv[4][0] != '-') {
         std::string t4 = to_upper(argv[4]);
-        if (t4 == "CONF" || t4 == "ACCU" || t4 == "PERF") {
+        if (t4 == "CONF" || t4 == "ACCU" || t4 == "PERF" || t4 == "SCAL" ||
+            t4 == "REPL" || t4 == "MT" || t4 == "SWEEP") {
             set_type_filter(t4);
             std::fprintf(stderr,
                 "[%s] TYPE filter: %s\n", argv[0], t4.c_str());
             // Set test_mode based on type filter
             if (t4 == "PERF")
                 test_mode = TestMode::E_PERFORMANCE;
+            else if (t4 == "SCAL")
+                test_mode = TestMode::E_SCALING;
+            else if (t4 == "REPL")
+                test_mode = TestMode::E_REPLAY;
+            else if (t4 == "MT")
+                test_mode = TestMode::E_MULTITHREAD;
+            else if (t4 == "SWEEP")
+                test_mode = TestMode::E_SWEEP;
             else if (t4 == "ACCU")
                 test_mode = TestMode::E_ACCURACY;
         } else {
@@ -164,6 +214,14 @@ int main(int argc, char *argv[])
                     test_mode = TestMode::E_ACCURACY;
                 } else if (test_type == "perf") {
                     test_mode = TestMode::E_PERFORMANCE;
+                } else if (test_type == "scal") {
+                    test_mode = TestMode::E_SCALING;
+                } else if (test_type == "repl" || test_type == "replay") {
+                    test_mode = TestMode::E_REPLAY;
+                } else if (test_type == "mt") {
+                    test_mode = TestMode::E_MULTITHREAD;
+                } else if (test_type == "sweep") {
+                    test_mode = TestMode::E_SWEEP;
                 } else {
                     test_mode = TestMode::E_ACCURACY;
                 }
@@ -214,8 +272,12 @@ int main(int argc, char *argv[])
     // ...existing code...
     std::fprintf(stderr, "[%s] reading YAML: %s\n", argv[0], yaml_file.c_str());
 
-    /* Read YAML file and populate test parameters */
-    read_yaml_file(yaml_file, params);
+    /* Read YAML file, or the trace to replay, and populate test parameters */
+    if (yaml_file.find(".almtrace") != std::string::npos) {
+        read_trace_params(yaml_file, params);
+    } else {
+        read_yaml_file(yaml_file, params);
+    }
 
     /* Execute tests using loaded libraries */
     process_libm(&almlibs, params, test_mode);
@@ -0,0 +1,492 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*
+ * Multi-threaded throughput tests
+ *
+ * A multi-threaded test runs the same variant on N threads at once, each
+ * pinned to its own CPU and calling the shim over a private input of
+ * "steps" elements, so the work grows with the thread count (weak
+ * scaling). This is how a library is used by a parallel application, and
+ * shows what one thread alone does not: vector units slowing down as more
+ * cores are busy, shared caches and memory bandwidth.
+ *
+ * For each thread count the threads start every pass together and the
+ * best of the passes is kept. Reported are the aggregate throughput (all
+ * elements over the time from the first thread starting to the last one
+ * finishing), the throughput of each thread and the efficiency: aggregate
+ * throughput per thread relative to the first (normally single thread) run.
+ *
+ * Threads take the CPUs the process may run on in order. With "numa: true"
+ * they are spread over the NUMA nodes round robin instead, so that a
+ * count below the core count uses every node's memory. Buffers are
+ * allocated and written by the thread using them, after pinning, so their
+ * pages start out on its node. Pinning is supported on Linux; elsewhere
+ * the threads are left to the scheduler.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+#include "dll_utils.h"
+#include "alm_test.h"
+#include "api_template.h"
+#include "api_runner.h"
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <filesystem>
+#endif
+
+/* Timed passes per thread count, after one untimed pass */
+#define MT_PASSES 10
+
+/*
+ * parse_cpulist:
+ * CPUs of a sysfs cpulist, e.g. "0-7,16-23".
+ */
+[[maybe_unused]] static std::vector<int> parse_cpulist(const std::string &list)
+{
+    std::vector<int> cpus;
+    std::stringstream ss(list);
+    std::string item;
+
+    while (std::getline(ss, item, ',')) {
+        if (item.empty()) {
+            continue;
+        }
+        size_t dash = item.find('-');
+        int lo = std::stoi(item.substr(0, dash));
+        int hi = (dash == std::string::npos) ? lo : std::stoi(item.substr(dash + 1));
+        for (int c = lo; c <= hi; ++c) {
+            cpus.push_back(c);
+        }
+    }
+
+    return cpus;
+}
+
+/*
+ * mt_cpus:
+ * CPUs the threads are pinned to, in the order threads take them: the
+ * CPUs of the process, or with numa those of each node in turn. Empty
+ * when threads cannot be pinned.
+ */
+static std::vector<int> mt_cpus(bool numa, int &nodes)
+{
+    std::vector<int> cpus;
+    nodes = 1;
+
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) != 0) {
+        return cpus;
+    }
+
+    for (int c = 0; c < CPU_SETSIZE; ++c) {
+        if (CPU_ISSET(c, &set)) {
+            cpus.push_back(c);
+        }
+    }
+
+    if (!numa) {
+        return cpus;
+    }
+
+    /* CPUs of each node the process may use */
+    namespace fs = std::filesystem;
+    std::vector<std::vector<int>> per_node;
+    std::error_code ec;
+    for (int n = 0;; ++n) {
+        fs::path p = "/sys/devices/system/node/node" + std::to_string(n) + "/cpulist";
+        if (!fs::exists(p, ec)) {
+            break;
+        }
+        std::ifstream fin(p);
+        std::string list;
+        std::getline(fin, list);
+
+        std::vector<int> mine;
+        for (int c : parse_cpulist(list)) {
+            if (c < CPU_SETSIZE && CPU_ISSET(c, &set)) {
+                mine.push_back(c);
+            }
+        }
+        if (!mine.empty()) {
+            per_node.push_back(mine);
+        }
+    }
+
+    if (per_node.size() < 2) {
+        return cpus;
+    }
+
+    /* Round robin over the nodes */
+    cpus.clear();
+    nodes = static_cast<int>(per_node.size());
+    for (size_t i = 0;; ++i) {
+        bool any = false;
+        for (const auto &node : per_node) {
+            if (i < node.size()) {
+                cpus.push_back(node[i]);
+                any = true;
+            }
+        }
+        if (!any) {
+            break;
+        }
+    }
+#else
+    (void)numa;
+#endif
+
+    return cpus;
+}
+
+/*
+ * pin_thread:
+ * Binds the calling thread to one CPU.
+ */
+static bool pin_thread(int cpu)
+{
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/*
+ * SpinBarrier:
+ * Releases the threads of a pass together; they spin rather than sleep
+ * so that all of them start within a few hundred cycles.
+ */
+class SpinBarrier {
+public:
+    explicit SpinBarrier(int n) : count(n), waiting(0), phase(0) {}
+
+    void wait()
+    {
+        int ph = phase.load(std::memory_order_acquire);
+        if (waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == count) {
+            waiting.store(0, std::memory_order_relaxed);
+            phase.store(ph + 1, std::memory_order_release);
+            return;
+        }
+        while (phase.load(std::memory_order_acquire) == ph) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    const int        count;
+    std::atomic<int> waiting;
+    std::atomic<int> phase;
+};
+
+/*
+ * mt_worker:
+ * Body of one thread: pins itself, builds its private input from the test
+ * ranges and times MT_PASSES passes over it, each started with the other
+ * threads. t0 and t1 receive the start and end of every pass, on a clock
+ * common to the threads.
+ */
+template <typename T, typename U>
+static void mt_worker(void (*shim_func)(InParams<T, U> *),
+                      const struct InParams<T, U> *ipp, ApiTypes api_type,
+                      bool is_vra, uint64_t count, int cpu,
+                      SpinBarrier *barrier, std::vector<double> *t0,
+                      std::vector<double> *t1, bool *pinned)
+{
+    const uint64_t lanes = sizeof(T) / sizeof(U);
+
+    *pinned = (cpu >= 0) && pin_thread(cpu);
+
+    const auto &r0 = ipp->range[0];
+    const auto &r1 = (ipp->range.size() > 1) ? ipp->range[1] : r0;
+    U step0 = (count > 1) ? (r0.stp - r0.srt) / static_cast<U>(count - 1) : U(0);
+    U step1 = (count > 1) ? (r1.stp - r1.srt) / static_cast<U>(count - 1) : U(0);
+
+    /* Written here, after pinning, so that the pages are local */
+    std::vector<U> in0(count), in1(count), out0(count), out1(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        in0[i] = r0.srt + step0 * static_cast<U>(i);
+        in1[i] = r1.srt + step1 * static_cast<U>(i);
+    }
+
+    InParams<T, U> local{};
+    U powx_y = r1.srt;
+    local.count   = count;
+    local.iptr[0] = in0.data();
+    local.iptr[1] = (api_type == API_PROTOTYPE_03) ? &powx_y : in1.data();
+    local.optr[0] = out0.data();
+    local.optr[1] = out1.data();
+
+    /* Scalar and vector variants: one packed argument per call */
+    std::vector<T> arg0, arg1;
+    if (!is_vra) {
+        for (uint64_t i = 0; i + lanes <= count; i += lanes) {
+            T a{}, b{};
+            std::memcpy(&a, &in0[i], sizeof(T));
+            std::memcpy(&b, &in1[i], sizeof(T));
+            arg0.push_back(a);
+            arg1.push_back(b);
+        }
+    }
+
+    auto pass = [&]() {
+        if (is_vra) {
+            shim_func(&local);
+            return;
+        }
+        for (size_t c = 0; c < arg0.size(); ++c) {
+            local.ip[0] = arg0[c];
+            local.ip[1] = arg1[c];
+            shim_func(&local);
+        }
+    };
+
+    pass();
+
+    using clock = std::chrono::steady_clock;
+    auto since = [](clock::time_point tp) {
+        return std::chrono::duration<double, std::nano>(tp.time_since_epoch()).count();
+    };
+
+    for (int p = 0; p < MT_PASSES; ++p) {
+        barrier->wait();
+        clock::time_point start = clock::now();
+        pass();
+        clock::time_point end = clock::now();
+        (*t0)[p] = since(start);
+        (*t1)[p] = since(end);
+    }
+}
+
+/*
+ * multithread_test:
+ * Runs one variant on each thread count of the test and appends the
+ * results to the output file of the test.
+ */
+template <typename T, typename U>
+int multithread_test(struct AlmLibs *alibs,
+                     struct InParams<T, U> *ipp,
+                     const std::string &libapi,
+                     ApiTypes api_type,
+                     struct YamlOutputs<U> *yop)
+{
+    if (api_type > API_PROTOTYPE_04 ||
+        (api_type == API_PROTOTYPE_03 && !yop->is_vra)) {
+        std::cout << "Multi-threaded tests support prototypes 01-04 only, "
+                  << "skipping: " << yop->api_name << " " << yop->variant
+                  << std::endl;
+        return -1;
+    }
+
+    if (ipp->range.empty()) {
+        std::cerr << "Multi-threaded test " << yop->test_id
+                  << " needs an input range" << std::endl;
+        return -1;
+    }
+
+    using ShimFunc = void (*)(InParams<T, U> *);
+    ShimFunc shim_func = load_function<ShimFunc>(alibs->pshimlib, libapi);
+
+    const uint64_t lanes = sizeof(T) / sizeof(U);
+    uint64_t count = ipp->range[0].count;
+    if (!yop->is_vra) {
+        count -= count % lanes;
+    }
+    if (count == 0) {
+        std::cerr << "Multi-threaded test " << yop->test_id
+                  << " needs at least " << lanes << " elements" << std::endl;
+        return -1;
+    }
+
+    int nodes = 1;
+    std::vector<int> cpus = mt_cpus(yop->numa, nodes);
+    std::vector<int> threads = scaling_threads(yop->threads);
+    if (threads.empty()) {
+        threads = {1};
+    }
+
+    std::cout << "Multi-threaded throughput: " << yop->api_name << " "
+              << yop->variant << ", " << count << " elements per thread";
+    if (yop->numa) {
+        std::cout << ", " << nodes << " NUMA node(s)";
+    }
+    std::cout << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "Melem/s"
+              << std::setw(14) << "thread min" << std::setw(14) << "thread max"
+              << std::setw(12) << "efficiency" << std::endl;
+
+    YAML::Node results;
+    double base = 0.0;
+    bool all_pinned = !cpus.empty();
+
+    for (int t : threads) {
+        SpinBarrier barrier(t);
+        std::vector<std::vector<double>> t0(t, std::vector<double>(MT_PASSES));
+        std::vector<std::vector<double>> t1(t, std::vector<double>(MT_PASSES));
+        std::vector<char> pinned(t, 0);
+        std::vector<std::thread> workers;
+
+        for (int i = 0; i < t; ++i) {
+            int cpu = cpus.empty() ? -1 : cpus[i % cpus.size()];
+            workers.emplace_back([&, i, cpu]() {
+                bool ok = false;
+                mt_worker<T, U>(shim_func, ipp, api_type, yop->is_vra, count,
+                                cpu, &barrier, &t0[i], &t1[i], &ok);
+                pinned[i] = ok;
+            });
+        }
+        for (auto &w : workers) {
+            w.join();
+        }
+
+        /* Best pass: first start to last end over all threads */
+        double wall = 0.0;
+        for (int p = 0; p < MT_PASSES; ++p) {
+            double first = t0[0][p], last = t1[0][p];
+            for (int i = 1; i < t; ++i) {
+                first = std::min(first, t0[i][p]);
+                last  = std::max(last, t1[i][p]);
+            }
+            wall = (p == 0) ? last - first : std::min(wall, last - first);
+        }
+
+        std::vector<double> per_thread(t);
+        for (int i = 0; i < t; ++i) {
+            double best = 0.0;
+            for (int p = 0; p < MT_PASSES; ++p) {
+                double ns = t1[i][p] - t0[i][p];
+                best = (p == 0) ? ns : std::min(best, ns);
+            }
+            per_thread[i] = static_cast<double>(count) / best * 1e3;
+            all_pinned = all_pinned && pinned[i];
+        }
+
+        double melems = static_cast<double>(count) * t / wall * 1e3;
+        if (base == 0.0) {
+            base = melems / threads.front();
+        }
+        double efficiency = melems / t / base;
+        auto mm = std::minmax_element(per_thread.begin(), per_thread.end());
+
+        std::cout << std::fixed
+                  << std::setw(8)  << t
+                  << std::setw(14) << std::setprecision(1) << melems
+                  << std::setw(14) << std::setprecision(1) << *mm.first
+                  << std::setw(14) << std::setprecision(1) << *mm.second
+                  << std::setw(12) << std::setprecision(2) << efficiency
+                  << std::defaultfloat << std::endl;
+
+        YAML::Node entry;
+        entry["threads"]    = t;
+        entry["time_ns"]    = wall;
+        entry["melem_s"]    = melems;
+        entry["efficiency"] = efficiency;
+        YAML::Node tn;
+        for (double m : per_thread) {
+            tn.push_back(m);
+        }
+        tn.SetStyle(YAML::EmitterStyle::Flow);
+        entry["melem_s_thread"] = tn;
+        results.push_back(entry);
+    }
+
+    if (!all_pinned) {
+        std::cout << "Threads could not be pinned, results include migrations"
+                  << std::endl;
+    }
+    if (!cpus.empty() &&
+        *std::max_element(threads.begin(), threads.end()) > static_cast<int>(cpus.size())) {
+        std::cout << "More threads than the " << cpus.size() << " CPUs available, "
+                  << "threads share CPUs" << std::endl;
+    }
+
+    YAML::Node node;
+    node["test_id"]  = yop->test_id;
+    node["api_name"] = yop->api_name;
+    node["variant"]  = yop->variant;
+    node["library"]  = yop->vendor;
+    node["count"]    = count;
+    node["pinned"]   = all_pinned;
+    node["numa"]     = yop->numa;
+    node["nodes"]    = nodes;
+    node["multithread"] = results;
+
+    std::ofstream fout(yop->outfile, std::ios::app);
+    if (!fout.is_open()) {
+        std::cerr << "Error: Could not open file " << yop->outfile
+                  << " for writing." << std::endl;
+        return -1;
+    }
+    fout << node << "\n";
+
+    return 0;
+}
+
+/* Explicit template instantiations */
+template int multithread_test<float, float>(struct AlmLibs *, struct InParams<float, float> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<float> *);
+template int multithread_test<double, double>(struct AlmLibs *, struct InParams<double, double> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<double> *);
+template int multithread_test<libm::AlignedM128, float>(struct AlmLibs *, struct InParams<libm::AlignedM128, float> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<float> *);
+template int multithread_test<libm::AlignedM128d, double>(struct AlmLibs *, struct InParams<libm::AlignedM128d, double> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<double> *);
+template int multithread_test<libm::AlignedM256, float>(struct AlmLibs *, struct InParams<libm::AlignedM256, float> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<float> *);
+template int multithread_test<libm::AlignedM256d, double>(struct AlmLibs *, struct InParams<libm::AlignedM256d, double> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<double> *);
+#ifdef __AVX512F__
+template int multithread_test<libm::AlignedM512, float>(struct AlmLibs *, struct InParams<libm::AlignedM512, float> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<float> *);
+template int multithread_test<libm::AlignedM512d, double>(struct AlmLibs *, struct InParams<libm::AlignedM512d, double> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<double> *);
+#endif
@@ -0,0 +1,439 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Replay tests
+ *
+ * A replay test times the calls recorded by the capture mode of the
+ * library (AOCL_LIBM_CAPTURE, see src/alm_capture.c): arguments sampled
+ * from a real run, with their clustering, special values and array length
+ * mix, are fed to the shim in the order they were recorded. Calls of a
+ * function variant go through shim_<function>_<variant>, so the same trace
+ * can be replayed against any shim; variants a shim lacks are skipped.
+ *
+ * Trace format, host byte order:
+ *
+ *   header   char magic[8] "ALMTRACE", uint32 version, uint32 rate
+ *   record   uint16 tag, uint16 id, uint32 len, uint32 nval, payload
+ *
+ *   tag 1    names id: len bytes of payload, uint8 nargs, uint8 esize,
+ *            then "<function>\0<variant>\0" as in the YAML files
+ *   tag 2    one call of id over len elements: nargs arguments of nval
+ *            values each. Arrays longer than nval were recorded up to
+ *            nval and are tiled to len here.
+ *
+ * Passing the trace file instead of a YAML file replays every function in
+ * it; a *_repl.yml test names the trace with "trace:".
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+#include "dll_utils.h"
+#include "alm_test.h"
+#include "api_template.h"
+#include "api_runner.h"
+
+#define TRACE_MAGIC     "ALMTRACE"
+#define TRACE_VERSION   1
+#define TRACE_TAG_NAME  1
+#define TRACE_TAG_CALL  2
+
+/* Elements per argument replayed at most, later calls are dropped */
+#define REPLAY_MAX_ELEMS (1ULL << 22)
+
+struct TraceHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t rate;
+};
+
+struct TraceRecord {
+    uint16_t tag;
+    uint16_t id;
+    uint32_t len;
+    uint32_t nval;
+};
+
+/*
+ * TraceFunc:
+ * Calls recorded for one function variant; values holds the arguments of
+ * each call one after the other.
+ */
+struct TraceFunc {
+    std::string func;
+    std::string variant;
+    uint8_t     nargs = 0;
+    uint8_t     esize = 0;
+    std::vector<uint32_t> len;
+    std::vector<uint32_t> nval;
+    std::vector<uint8_t>  values;
+};
+
+struct Trace {
+    std::string path;
+    uint32_t    rate = 0;
+    std::map<uint16_t, TraceFunc> funcs;
+};
+
+/*
+ * load_trace:
+ * Reads a capture trace, false if it cannot be read or is not one.
+ */
+static bool load_trace(const std::string &path, Trace &trace)
+{
+    std::ifstream fin(path, std::ios::binary);
+    TraceHeader hdr;
+
+    trace = Trace();
+    trace.path = path;
+
+    if (!fin.read(reinterpret_cast<char *>(&hdr), sizeof(hdr)) ||
+        std::memcmp(hdr.magic, TRACE_MAGIC, sizeof(hdr.magic)) != 0 ||
+        hdr.version != TRACE_VERSION) {
+        std::cerr << "Not a capture trace: " << path << std::endl;
+        return false;
+    }
+    trace.rate = hdr.rate;
+
+    TraceRecord rec;
+    while (fin.read(reinterpret_cast<char *>(&rec), sizeof(rec))) {
+        if (rec.tag == TRACE_TAG_NAME) {
+            std::vector<char> buf(rec.len + 1, '\0');
+            if (rec.len < 4 || !fin.read(buf.data(), rec.len)) {
+                break;
+            }
+            TraceFunc &tf = trace.funcs[rec.id];
+            tf.nargs   = static_cast<uint8_t>(buf[0]);
+            tf.esize   = static_cast<uint8_t>(buf[1]);
+            tf.func    = std::string(&buf[2]);
+            tf.variant = std::string(&buf[2] + tf.func.size() + 1);
+            continue;
+        }
+
+        auto it = trace.funcs.find(rec.id);
+        if (rec.tag != TRACE_TAG_CALL || it == trace.funcs.end()) {
+            break;
+        }
+
+        TraceFunc &tf = it->second;
+        size_t bytes = static_cast<size_t>(rec.nval) * tf.nargs * tf.esize;
+        size_t off = tf.values.size();
+        tf.values.resize(off + bytes);
+        if (!fin.read(reinterpret_cast<char *>(&tf.values[off]), bytes)) {
+            tf.values.resize(off);
+            break;
+        }
+        tf.len.push_back(rec.len);
+        tf.nval.push_back(rec.nval);
+    }
+
+    if (!fin.eof()) {
+        std::cerr << "Trace " << path << " is truncated or corrupt, "
+                  << "replaying the calls read so far" << std::endl;
+    }
+
+    return true;
+}
+
+/*
+ * get_trace:
+ * The trace at path, loaded on first use; tests of one trace share it.
+ */
+static const Trace *get_trace(const std::string &path)
+{
+    static Trace trace;
+    static bool ok = false;
+
+    if (trace.path != path) {
+        ok = load_trace(path, trace);
+    }
+
+    return ok ? &trace : nullptr;
+}
+
+/*
+ * read_trace_params:
+ * Makes one replay test per function of a trace, for the variants it
+ * recorded, so that a trace can be passed in place of a YAML file.
+ */
+int read_trace_params(const std::string &path, std::vector<struct YamlInputs> &params)
+{
+    const Trace *trace = get_trace(path);
+    if (!trace) {
+        return -1;
+    }
+
+    std::map<std::string, std::vector<std::string>> variants;
+    for (const auto &entry : trace->funcs) {
+        variants[entry.second.func].push_back(entry.second.variant);
+    }
+
+    for (const auto &entry : variants) {
+        YamlInputs param;
+        param.test_type = "replay_tests";
+        param.api_name  = entry.first;
+        param.test_id   = "replay_" + entry.first;
+        param.trace     = path;
+
+        for (const auto &v : entry.second) {
+            param.variants      += (param.variants.empty() ? "" : ";") + v;
+            param.ulp_threshold += (param.ulp_threshold.empty() ? "" : ";") +
+                                   std::string((v == "sd" || v == "ss") ? "0.5" : "4.0");
+        }
+        params.push_back(param);
+    }
+
+    return 0;
+}
+
+/*
+ * replay_calls:
+ * Times the recorded calls of one variant through the shim: the best of
+ * the timed passes over all calls, after an untimed one.
+ */
+template <typename T, typename U>
+static double replay_calls(void (*shim_func)(InParams<T, U> *),
+                           struct InParams<T, U> *ipp,
+                           const TraceFunc &tf, bool is_vra,
+                           uint64_t &calls, uint64_t &elems)
+{
+    const uint64_t lanes = sizeof(T) / sizeof(U);
+    const size_t   ncall = tf.len.size();
+    const uint8_t *src   = tf.values.data();
+
+    /* Scalar and vector variants: one packed argument per call */
+    std::vector<T> arg0, arg1;
+
+    /* Array variants: the calls back to back, each at its offset */
+    std::vector<U> in0, in1, out0, out1;
+    std::vector<uint64_t> offset;
+    uint64_t maxlen = 0;
+
+    calls = elems = 0;
+    for (size_t c = 0; c < ncall; ++c) {
+        uint64_t len  = tf.len[c];
+        uint64_t nval = tf.nval[c];
+        const U *x = reinterpret_cast<const U *>(src);
+        const U *y = x + nval;
+        src += nval * tf.nargs * sizeof(U);
+
+        if (!is_vra) {
+            if (nval != lanes) {
+                continue;
+            }
+            T a{}, b{};
+            std::memcpy(&a, x, sizeof(T));
+            std::memcpy(&b, (tf.nargs > 1) ? y : x, sizeof(T));
+            arg0.push_back(a);
+            arg1.push_back(b);
+        } else {
+            if (nval == 0 || len == 0 || elems + len > REPLAY_MAX_ELEMS) {
+                continue;
+            }
+            offset.push_back(elems);
+            for (uint64_t i = 0; i < len; ++i) {
+                in0.push_back(x[i % nval]);
+                in1.push_back((tf.nargs > 1) ? y[i % nval] : x[i % nval]);
+            }
+            maxlen = std::max(maxlen, len);
+        }
+        calls++;
+        elems += is_vra ? len : lanes;
+    }
+
+    if (calls == 0) {
+        return 0.0;
+    }
+
+    out0.resize(maxlen);
+    out1.resize(maxlen);
+
+    auto pass = [&]() {
+        if (!is_vra) {
+            for (size_t c = 0; c < arg0.size(); ++c) {
+                ipp->ip[0] = arg0[c];
+                ipp->ip[1] = arg1[c];
+                shim_func(ipp);
+            }
+            return;
+        }
+        ipp->optr[0] = out0.data();
+        ipp->optr[1] = out1.data();
+        for (size_t c = 0; c < offset.size(); ++c) {
+            uint64_t end = (c + 1 < offset.size()) ? offset[c + 1] : elems;
+            ipp->count   = end - offset[c];
+            ipp->iptr[0] = &in0[offset[c]];
+            ipp->iptr[1] = &in1[offset[c]];
+            shim_func(ipp);
+        }
+    };
+
+    pass();
+
+    double best = 0.0;
+    for (int it = 0; it < 10; ++it) {
+        timing_wrapper perf;
+        perf.start();
+        pass();
+        double ns = perf.stop();
+        best = (it == 0) ? ns : std::min(best, ns);
+    }
+
+    ipp->iptr[0] = ipp->iptr[1] = nullptr;
+    ipp->optr[0] = ipp->optr[1] = nullptr;
+
+    return best;
+}
+
+/*
+ * replay_test:
+ * Replays the calls of one function variant recorded in the trace of the
+ * test and appends the timings to the output file of the test.
+ */
+template <typename T, typename U>
+int replay_test(struct AlmLibs *alibs,
+                struct InParams<T, U> *ipp,
+                const std::string &libapi,
+                ApiTypes api_type,
+                struct YamlOutputs<U> *yop)
+{
+    if (api_type != API_PROTOTYPE_01 && api_type != API_PROTOTYPE_02) {
+        std::cout << "Replay tests support prototypes 01-02 only, skipping: "
+                  << yop->api_name << std::endl;
+        return -1;
+    }
+
+    const Trace *trace = get_trace(yop->trace);
+    if (!trace) {
+        std::cerr << "Replay test " << yop->test_id << " has no readable trace"
+                  << std::endl;
+        return -1;
+    }
+
+    const TraceFunc *tf = nullptr;
+    for (const auto &entry : trace->funcs) {
+        if (entry.second.func == yop->api_name &&
+            entry.second.variant == yop->variant) {
+            tf = &entry.second;
+        }
+    }
+    if (!tf || tf->esize != sizeof(U)) {
+        std::cout << "No " << yop->api_name << " " << yop->variant
+                  << " calls in " << yop->trace << std::endl;
+        return -1;
+    }
+
+    using ShimFunc = void (*)(InParams<T, U> *);
+    ShimFunc shim_func = reinterpret_cast<ShimFunc>(
+        DL_SYM(alibs->pshimlib, libapi.c_str()));
+    if (!shim_func) {
+        std::cout << "Shim has no " << libapi << ", skipping" << std::endl;
+        return -1;
+    }
+
+    uint64_t calls = 0, elems = 0;
+    double ns = replay_calls<T, U>(shim_func, ipp, *tf, yop->is_vra, calls, elems);
+    if (calls == 0) {
+        std::cout << "No replayable calls of " << libapi << std::endl;
+        return -1;
+    }
+
+    std::vector<uint32_t> lens(tf->len);
+    std::sort(lens.begin(), lens.end());
+    double melems = static_cast<double>(elems) / ns * 1e3;
+
+    std::cout << "Replay: " << yop->api_name << " " << yop->variant << ", "
+              << calls << " of " << tf->len.size() << " calls, " << elems
+              << " elements, sampled 1/" << trace->rate << std::endl;
+    std::cout << std::fixed
+              << "  time(ms) " << std::setprecision(3) << ns / 1e6
+              << "  ns/call " << std::setprecision(1) << ns / calls
+              << "  Melem/s " << std::setprecision(1) << melems
+              << std::defaultfloat << std::endl;
+
+    YAML::Node node;
+    node["test_id"]     = yop->test_id;
+    node["api_name"]    = yop->api_name;
+    node["variant"]     = yop->variant;
+    node["library"]     = yop->vendor;
+    node["trace"]       = yop->trace;
+    node["sample_rate"] = trace->rate;
+    node["calls"]       = calls;
+    node["elements"]    = elems;
+    if (yop->is_vra) {
+        node["len_min"]    = lens.front();
+        node["len_median"] = lens[lens.size() / 2];
+        node["len_max"]    = lens.back();
+    }
+    node["time_ns"]     = ns;
+    node["ns_per_call"] = ns / static_cast<double>(calls);
+    node["ns_per_elem"] = ns / static_cast<double>(elems);
+    node["melem_s"]     = melems;
+
+    std::ofstream fout(yop->outfile, std::ios::app);
+    if (!fout.is_open()) {
+        std::cerr << "Error: Could not open file " << yop->outfile
+                  << " for writing." << std::endl;
+        return -1;
+    }
+    fout << node << "\n";
+
+    return 0;
+}
+
+/* Explicit template instantiations */
+template int replay_test<float, float>(struct AlmLibs *, struct InParams<float, float> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<float> *);
+template int replay_test<double, double>(struct AlmLibs *, struct InParams<double, double> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<double> *);
+template int replay_test<libm::AlignedM128, float>(struct AlmLibs *, struct InParams<libm::AlignedM128, float> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<float> *);
+template int replay_test<libm::AlignedM128d, double>(struct AlmLibs *, struct InParams<libm::AlignedM128d, double> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<double> *);
+template int replay_test<libm::AlignedM256, float>(struct AlmLibs *, struct InParams<libm::AlignedM256, float> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<float> *);
+template int replay_test<libm::AlignedM256d, double>(struct AlmLibs *, struct InParams<libm::AlignedM256d, double> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<double> *);
+#ifdef __AVX512F__
+template int replay_test<libm::AlignedM512, float>(struct AlmLibs *, struct InParams<libm::AlignedM512, float> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<float> *);
+template int replay_test<libm::AlignedM512d, double>(struct AlmLibs *, struct InParams<libm::AlignedM512d, double> *,
+                                     const std::string &, ApiTypes,
+                                     struct YamlOutputs<double> *);
+#endif
@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Strong scaling tests
+ *
+ * A scaling test runs one array variant (vrsa/vrda) over a fixed, large
+ * input for an increasing number of threads and reports the time, the
+ * throughput and the speedup over the first (normally single thread) run.
+ *
+ * The thread count is set through the optional shim_set_num_threads()
+ * export of the shim. When the shim also exports a parallel entry point
+ * shim_<api>_<variant>_mt it is used (AMD: the 64-bit length array
+ * functions), otherwise the plain array shim is timed (MKL threads its VM
+ * functions itself). Shims without thread control run the single thread
+ * case only.
+ *
+ * Input and output arrays are initialized by as many threads as the widest
+ * run, each writing one contiguous static partition, so that on NUMA
+ * systems the pages start out on the node of the thread using them.
+ */
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+#include "dll_utils.h"
+#include "alm_test.h"
+#include "api_template.h"
+#include "api_runner.h"
+
+typedef int (*shim_set_num_threads_t)(int);
+
+/*
+ * scaling_threads:
+ * Thread counts of a scaling test. Entries are numbers or "max" for all
+ * hardware threads; without a list the counts double from 1 up to "max".
+ */
+std::vector<int> scaling_threads(const std::vector<std::string> &list)
+{
+    unsigned hw = std::thread::hardware_concurrency();
+    std::vector<int> counts;
+
+    if (hw == 0) {
+        hw = 1;
+    }
+
+    if (list.empty()) {
+        for (unsigned t = 1; t < hw; t *= 2) {
+            counts.push_back(static_cast<int>(t));
+        }
+        counts.push_back(static_cast<int>(hw));
+        return counts;
+    }
+
+    for (const auto &entry : list) {
+        int t = (entry == "max") ? static_cast<int>(hw) : std::stoi(entry);
+        if (t > 0) {
+            counts.push_back(t);
+        }
+    }
+
+    return counts;
+}
+
+/*
+ * first_touch_fill:
+ * Fills buf[0, n) with a linear ramp from srt to stp, nthreads threads
+ * each writing one contiguous partition.
+ */
+template <typename U>
+static void first_touch_fill(U *buf, uint64_t n, U srt, U stp, int nthreads)
+{
+    std::vector<std::thread> workers;
+    uint64_t parts = static_cast<uint64_t>(nthreads);
+    uint64_t chunk = (n + parts - 1) / parts;
+    U step = (n > 1) ? (stp - srt) / static_cast<U>(n - 1) : U(0);
+
+    for (uint64_t t = 0; t < parts; ++t) {
+        uint64_t lo = std::min(n, t * chunk);
+        uint64_t hi = std::min(n, lo + chunk);
+
+        workers.emplace_back([=]() {
+            for (uint64_t i = lo; i < hi; ++i) {
+                buf[i] = srt + step * static_cast<U>(i);
+            }
+        });
+    }
+
+    for (auto &w : workers) {
+        w.join();
+    }
+}
+
+/*
+ * scaling_test:
+ * Runs the strong scaling sweep of one array variant and appends the
+ * results to the output file of the test.
+ */
+template <typename U>
+int scaling_test(struct AlmLibs *alibs,
+                 struct InParams<U, U> *ipp,
+                 const std::string &libapi,
+                 ApiTypes api_type,
+                 struct YamlOutputs<U> *yop)
+{
+    if (!yop->is_vra || api_type > API_PROTOTYPE_04) {
+        std::cout << "Scaling tests support array variants of prototypes "
+                  << "01-04 only, skipping: " << yop->api_name << " "
+                  << yop->variant << std::endl;
+        return -1;
+    }
+
+    if (ipp->range.empty()) {
+        std::cerr << "Scaling test " << yop->test_id
+                  << " needs an input range" << std::endl;
+        return -1;
+    }
+
+    using ShimFunc = void (*)(InParams<U, U> *);
+    ShimFunc shim_func = reinterpret_cast<ShimFunc>(
+        DL_SYM(alibs->pshimlib, (libapi + "_mt").c_str()));
+    if (!shim_func) {
+        shim_func = load_function<ShimFunc>(alibs->pshimlib, libapi);
+    }
+
+    auto set_threads = reinterpret_cast<shim_set_num_threads_t>(
+        DL_SYM(alibs->pshimlib, "shim_set_num_threads"));
+
+    std::vector<int> threads = scaling_threads(yop->threads);
+    if (!set_threads || threads.empty()) {
+        std::cout << "Shim has no thread control, running single thread only"
+                  << std::endl;
+        threads = {1};
+    }
+    int widest = *std::max_element(threads.begin(), threads.end());
+
+    /* One array per range input; powx takes its scalar from the second */
+    const auto &r0 = ipp->range[0];
+    const auto &r1 = (ipp->range.size() > 1) ? ipp->range[1] : r0;
+    uint64_t count = r0.count;
+
+    std::vector<U> in0(count), in1(count), out0(count), out1(count);
+    first_touch_fill<U>(in0.data(), count, r0.srt, r0.stp, widest);
+    first_touch_fill<U>(in1.data(), count, r1.srt, r1.stp, widest);
+    first_touch_fill<U>(out0.data(), count, U(0), U(0), widest);
+    first_touch_fill<U>(out1.data(), count, U(0), U(0), widest);
+
+    U powx_y = r1.srt;
+    ipp->count   = count;
+    ipp->iptr[0] = in0.data();
+    ipp->iptr[1] = (api_type == API_PROTOTYPE_03) ? &powx_y : in1.data();
+    ipp->optr[0] = out0.data();
+    ipp->optr[1] = out1.data();
+
+    std::cout << "Strong scaling: " << yop->api_name << " " << yop->variant
+              << ", " << count << " elements" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "time(ms)"
+              << std::setw(14) << "Melem/s" << std::setw(10) << "speedup"
+              << std::setw(12) << "efficiency" << std::endl;
+
+    Runner<U, U> runner(shim_func, TestMode::E_PERFORMANCE);
+    YAML::Node results;
+    double base = 0.0;
+
+    for (int t : threads) {
+        if (set_threads) {
+            set_threads(t);
+        }
+
+        /* Untimed call: starts pool threads and warms caches and TLBs */
+        shim_func(ipp);
+        double ns = runner.run(ipp);
+
+        if (base == 0.0) {
+            base = ns;
+        }
+        double speedup    = base / ns;
+        double efficiency = speedup * threads.front() / t;
+        double melems     = static_cast<double>(count) / ns * 1e3;
+
+        std::cout << std::fixed
+                  << std::setw(8)  << t
+                  << std::setw(14) << std::setprecision(3) << ns / 1e6
+                  << std::setw(14) << std::setprecision(1) << melems
+                  << std::setw(10) << std::setprecision(2) << speedup
+                  << std::setw(12) << std::setprecision(2) << efficiency
+                  << std::defaultfloat << std::endl;
+
+        YAML::Node entry;
+        entry["threads"]    = t;
+        entry["time_ns"]    = ns;
+        entry["melem_s"]    = melems;
+        entry["speedup"]    = speedup;
+        entry["efficiency"] = efficiency;
+        results.push_back(entry);
+    }
+
+    if (set_threads) {
+        set_threads(1);
+    }
+
+    /* ipp does not own the arrays, don't leave it pointing at them */
+    ipp->iptr[0] = ipp->iptr[1] = nullptr;
+    ipp->optr[0] = ipp->optr[1] = nullptr;
+
+    YAML::Node node;
+    node["test_id"]  = yop->test_id;
+    node["api_name"] = yop->api_name;
+    node["variant"]  = yop->variant;
+    node["library"]  = yop->vendor;
+    node["count"]    = count;
+    node["scaling"]  = results;
+
+    std::ofstream fout(yop->outfile, std::ios::app);
+    if (!fout.is_open()) {
+        std::cerr << "Error: Could not open file " << yop->outfile
+                  << " for writing." << std::endl;
+        return -1;
+    }
+    fout << node << "\n";
+
+    return 0;
+}
+
+/* Explicit template instantiations */
+template int scaling_test<float>(struct AlmLibs *, struct InParams<float, float> *,
+                                 const std::string &, ApiTypes,
+                                 struct YamlOutputs<float> *);
+template int scaling_test<double>(struct AlmLibs *, struct InParams<double, double> *,
+                                  const std::string &, ApiTypes,
+                                  struct YamlOutputs<double> *);
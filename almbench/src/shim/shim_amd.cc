@@ -416,6 +416,72 @@ typedef void (*amd_sub_vrda_func_t)(int, const double*, const double*, double*);
 typedef void (*amd_subi_vrda_func_t)(int, const double*, double, double*);
 typedef void (*amd_tan_vrda_func_t)(int, const double*, double*);
 
+// --- Parallel Single Precision Array (vrsa_mt) Functions, 64-bit length ---
+typedef void (*amd_acos_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_add_vrsa_mt_func_t)(size_t, const float*, size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_asin_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_atan_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_cbrt_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_cos_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_cosh_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_div_vrsa_mt_func_t)(size_t, const float*, size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_erf_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_erfc_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_exp_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_exp10_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_exp2_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_expm1_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_fabs_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_fmax_vrsa_mt_func_t)(size_t, const float*, size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_fmin_vrsa_mt_func_t)(size_t, const float*, size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_log_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_log10_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_log1p_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_log2_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_mul_vrsa_mt_func_t)(size_t, const float*, size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_pow_vrsa_mt_func_t)(size_t, const float*, size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_powx_vrsa_mt_func_t)(size_t, const float*, size_t, float, float*, size_t);
+typedef void (*amd_sin_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_sincos_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t, float*, size_t);
+typedef void (*amd_sqrt_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_sub_vrsa_mt_func_t)(size_t, const float*, size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_tan_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+typedef void (*amd_tanh_vrsa_mt_func_t)(size_t, const float*, size_t, float*, size_t);
+
+// --- Parallel Double Precision Array (vrda_mt) Functions, 64-bit length ---
+typedef void (*amd_acos_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_add_vrda_mt_func_t)(size_t, const double*, size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_asin_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_atan_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_cbrt_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_cos_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_cosh_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_div_vrda_mt_func_t)(size_t, const double*, size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_erf_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_erfc_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_exp_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_exp10_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_exp2_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_expm1_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_fabs_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_fmax_vrda_mt_func_t)(size_t, const double*, size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_fmin_vrda_mt_func_t)(size_t, const double*, size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_log_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_log10_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_log1p_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_log2_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_mul_vrda_mt_func_t)(size_t, const double*, size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_pow_vrda_mt_func_t)(size_t, const double*, size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_powx_vrda_mt_func_t)(size_t, const double*, size_t, double, double*, size_t);
+typedef void (*amd_sin_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_sincos_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t, double*, size_t);
+typedef void (*amd_sqrt_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_sub_vrda_mt_func_t)(size_t, const double*, size_t, const double*, size_t, double*, size_t);
+typedef void (*amd_tan_vrda_mt_func_t)(size_t, const double*, size_t, double*, size_t);
+
+// --- Parallel runtime control ---
+typedef int (*amd_set_num_threads_func_t)(int);
+
 #ifdef __AVX512F__
 // --- Double Precision 512-bit Vector (vrd8) Functions ---
 typedef __m512d (*amd_asin_vrd8_func_t)(__m512d);
@@ -771,6 +837,72 @@ static struct {
     amd_subi_vrda_func_t subi_vrda;
     amd_tan_vrda_func_t tan_vrda;
 
+    // ============================================================================
+    // PARALLEL ARRAY (vrsa_mt, vrda_mt) VARIANTS
+    // ============================================================================
+    amd_acos_vrsa_mt_func_t acos_vrsa_mt;
+    amd_add_vrsa_mt_func_t add_vrsa_mt;
+    amd_asin_vrsa_mt_func_t asin_vrsa_mt;
+    amd_atan_vrsa_mt_func_t atan_vrsa_mt;
+    amd_cbrt_vrsa_mt_func_t cbrt_vrsa_mt;
+    amd_cos_vrsa_mt_func_t cos_vrsa_mt;
+    amd_cosh_vrsa_mt_func_t cosh_vrsa_mt;
+    amd_div_vrsa_mt_func_t div_vrsa_mt;
+    amd_erf_vrsa_mt_func_t erf_vrsa_mt;
+    amd_erfc_vrsa_mt_func_t erfc_vrsa_mt;
+    amd_exp_vrsa_mt_func_t exp_vrsa_mt;
+    amd_exp10_vrsa_mt_func_t exp10_vrsa_mt;
+    amd_exp2_vrsa_mt_func_t exp2_vrsa_mt;
+    amd_expm1_vrsa_mt_func_t expm1_vrsa_mt;
+    amd_fabs_vrsa_mt_func_t fabs_vrsa_mt;
+    amd_fmax_vrsa_mt_func_t fmax_vrsa_mt;
+    amd_fmin_vrsa_mt_func_t fmin_vrsa_mt;
+    amd_log_vrsa_mt_func_t log_vrsa_mt;
+    amd_log10_vrsa_mt_func_t log10_vrsa_mt;
+    amd_log1p_vrsa_mt_func_t log1p_vrsa_mt;
+    amd_log2_vrsa_mt_func_t log2_vrsa_mt;
+    amd_mul_vrsa_mt_func_t mul_vrsa_mt;
+    amd_pow_vrsa_mt_func_t pow_vrsa_mt;
+    amd_powx_vrsa_mt_func_t powx_vrsa_mt;
+    amd_sin_vrsa_mt_func_t sin_vrsa_mt;
+    amd_sincos_vrsa_mt_func_t sincos_vrsa_mt;
+    amd_sqrt_vrsa_mt_func_t sqrt_vrsa_mt;
+    amd_sub_vrsa_mt_func_t sub_vrsa_mt;
+    amd_tan_vrsa_mt_func_t tan_vrsa_mt;
+    amd_tanh_vrsa_mt_func_t tanh_vrsa_mt;
+
+    amd_acos_vrda_mt_func_t acos_vrda_mt;
+    amd_add_vrda_mt_func_t add_vrda_mt;
+    amd_asin_vrda_mt_func_t asin_vrda_mt;
+    amd_atan_vrda_mt_func_t atan_vrda_mt;
+    amd_cbrt_vrda_mt_func_t cbrt_vrda_mt;
+    amd_cos_vrda_mt_func_t cos_vrda_mt;
+    amd_cosh_vrda_mt_func_t cosh_vrda_mt;
+    amd_div_vrda_mt_func_t div_vrda_mt;
+    amd_erf_vrda_mt_func_t erf_vrda_mt;
+    amd_erfc_vrda_mt_func_t erfc_vrda_mt;
+    amd_exp_vrda_mt_func_t exp_vrda_mt;
+    amd_exp10_vrda_mt_func_t exp10_vrda_mt;
+    amd_exp2_vrda_mt_func_t exp2_vrda_mt;
+    amd_expm1_vrda_mt_func_t expm1_vrda_mt;
+    amd_fabs_vrda_mt_func_t fabs_vrda_mt;
+    amd_fmax_vrda_mt_func_t fmax_vrda_mt;
+    amd_fmin_vrda_mt_func_t fmin_vrda_mt;
+    amd_log_vrda_mt_func_t log_vrda_mt;
+    amd_log10_vrda_mt_func_t log10_vrda_mt;
+    amd_log1p_vrda_mt_func_t log1p_vrda_mt;
+    amd_log2_vrda_mt_func_t log2_vrda_mt;
+    amd_mul_vrda_mt_func_t mul_vrda_mt;
+    amd_pow_vrda_mt_func_t pow_vrda_mt;
+    amd_powx_vrda_mt_func_t powx_vrda_mt;
+    amd_sin_vrda_mt_func_t sin_vrda_mt;
+    amd_sincos_vrda_mt_func_t sincos_vrda_mt;
+    amd_sqrt_vrda_mt_func_t sqrt_vrda_mt;
+    amd_sub_vrda_mt_func_t sub_vrda_mt;
+    amd_tan_vrda_mt_func_t tan_vrda_mt;
+
+    amd_set_num_threads_func_t set_num_threads;
+
 #ifdef __AVX512F__
     // ============================================================================
     // DOUBLE PRECISION 512-BIT VECTOR (vrd8) VARIANTS
@@ -1182,6 +1314,72 @@ static void init_amd_symbols(void) {
     amd_funcs.subi_vrda = load_amd_symbol<amd_subi_vrda_func_t>(amd_core, "amd_vrda_subi");
     amd_funcs.tan_vrda = load_amd_symbol<amd_tan_vrda_func_t>(amd_core, "amd_vrda_tan");
 
+    // ============================================================================
+    // PARALLEL ARRAY (vrsa_mt, vrda_mt) VARIANTS
+    // ============================================================================
+    amd_funcs.acos_vrsa_mt = load_amd_symbol<amd_acos_vrsa_mt_func_t>(amd_core, "amd_vrsa_acosfi_64");
+    amd_funcs.add_vrsa_mt = load_amd_symbol<amd_add_vrsa_mt_func_t>(amd_core, "amd_vrsa_addfi_64");
+    amd_funcs.asin_vrsa_mt = load_amd_symbol<amd_asin_vrsa_mt_func_t>(amd_core, "amd_vrsa_asinfi_64");
+    amd_funcs.atan_vrsa_mt = load_amd_symbol<amd_atan_vrsa_mt_func_t>(amd_core, "amd_vrsa_atanfi_64");
+    amd_funcs.cbrt_vrsa_mt = load_amd_symbol<amd_cbrt_vrsa_mt_func_t>(amd_core, "amd_vrsa_cbrtfi_64");
+    amd_funcs.cos_vrsa_mt = load_amd_symbol<amd_cos_vrsa_mt_func_t>(amd_core, "amd_vrsa_cosfi_64");
+    amd_funcs.cosh_vrsa_mt = load_amd_symbol<amd_cosh_vrsa_mt_func_t>(amd_core, "amd_vrsa_coshfi_64");
+    amd_funcs.div_vrsa_mt = load_amd_symbol<amd_div_vrsa_mt_func_t>(amd_core, "amd_vrsa_divfi_64");
+    amd_funcs.erf_vrsa_mt = load_amd_symbol<amd_erf_vrsa_mt_func_t>(amd_core, "amd_vrsa_erffi_64");
+    amd_funcs.erfc_vrsa_mt = load_amd_symbol<amd_erfc_vrsa_mt_func_t>(amd_core, "amd_vrsa_erfcfi_64");
+    amd_funcs.exp_vrsa_mt = load_amd_symbol<amd_exp_vrsa_mt_func_t>(amd_core, "amd_vrsa_expfi_64");
+    amd_funcs.exp10_vrsa_mt = load_amd_symbol<amd_exp10_vrsa_mt_func_t>(amd_core, "amd_vrsa_exp10fi_64");
+    amd_funcs.exp2_vrsa_mt = load_amd_symbol<amd_exp2_vrsa_mt_func_t>(amd_core, "amd_vrsa_exp2fi_64");
+    amd_funcs.expm1_vrsa_mt = load_amd_symbol<amd_expm1_vrsa_mt_func_t>(amd_core, "amd_vrsa_expm1fi_64");
+    amd_funcs.fabs_vrsa_mt = load_amd_symbol<amd_fabs_vrsa_mt_func_t>(amd_core, "amd_vrsa_fabsfi_64");
+    amd_funcs.fmax_vrsa_mt = load_amd_symbol<amd_fmax_vrsa_mt_func_t>(amd_core, "amd_vrsa_fmaxfi_64");
+    amd_funcs.fmin_vrsa_mt = load_amd_symbol<amd_fmin_vrsa_mt_func_t>(amd_core, "amd_vrsa_fminfi_64");
+    amd_funcs.log_vrsa_mt = load_amd_symbol<amd_log_vrsa_mt_func_t>(amd_core, "amd_vrsa_logfi_64");
+    amd_funcs.log10_vrsa_mt = load_amd_symbol<amd_log10_vrsa_mt_func_t>(amd_core, "amd_vrsa_log10fi_64");
+    amd_funcs.log1p_vrsa_mt = load_amd_symbol<amd_log1p_vrsa_mt_func_t>(amd_core, "amd_vrsa_log1pfi_64");
+    amd_funcs.log2_vrsa_mt = load_amd_symbol<amd_log2_vrsa_mt_func_t>(amd_core, "amd_vrsa_log2fi_64");
+    amd_funcs.mul_vrsa_mt = load_amd_symbol<amd_mul_vrsa_mt_func_t>(amd_core, "amd_vrsa_mulfi_64");
+    amd_funcs.pow_vrsa_mt = load_amd_symbol<amd_pow_vrsa_mt_func_t>(amd_core, "amd_vrsa_powfi_64");
+    amd_funcs.powx_vrsa_mt = load_amd_symbol<amd_powx_vrsa_mt_func_t>(amd_core, "amd_vrsa_powxfi_64");
+    amd_funcs.sin_vrsa_mt = load_amd_symbol<amd_sin_vrsa_mt_func_t>(amd_core, "amd_vrsa_sinfi_64");
+    amd_funcs.sincos_vrsa_mt = load_amd_symbol<amd_sincos_vrsa_mt_func_t>(amd_core, "amd_vrsa_sincosfi_64");
+    amd_funcs.sqrt_vrsa_mt = load_amd_symbol<amd_sqrt_vrsa_mt_func_t>(amd_core, "amd_vrsa_sqrtfi_64");
+    amd_funcs.sub_vrsa_mt = load_amd_symbol<amd_sub_vrsa_mt_func_t>(amd_core, "amd_vrsa_subfi_64");
+    amd_funcs.tan_vrsa_mt = load_amd_symbol<amd_tan_vrsa_mt_func_t>(amd_core, "amd_vrsa_tanfi_64");
+    amd_funcs.tanh_vrsa_mt = load_amd_symbol<amd_tanh_vrsa_mt_func_t>(amd_core, "amd_vrsa_tanhfi_64");
+
+    amd_funcs.acos_vrda_mt = load_amd_symbol<amd_acos_vrda_mt_func_t>(amd_core, "amd_vrda_acosi_64");
+    amd_funcs.add_vrda_mt = load_amd_symbol<amd_add_vrda_mt_func_t>(amd_core, "amd_vrda_addi_64");
+    amd_funcs.asin_vrda_mt = load_amd_symbol<amd_asin_vrda_mt_func_t>(amd_core, "amd_vrda_asini_64");
+    amd_funcs.atan_vrda_mt = load_amd_symbol<amd_atan_vrda_mt_func_t>(amd_core, "amd_vrda_atani_64");
+    amd_funcs.cbrt_vrda_mt = load_amd_symbol<amd_cbrt_vrda_mt_func_t>(amd_core, "amd_vrda_cbrti_64");
+    amd_funcs.cos_vrda_mt = load_amd_symbol<amd_cos_vrda_mt_func_t>(amd_core, "amd_vrda_cosi_64");
+    amd_funcs.cosh_vrda_mt = load_amd_symbol<amd_cosh_vrda_mt_func_t>(amd_core, "amd_vrda_coshi_64");
+    amd_funcs.div_vrda_mt = load_amd_symbol<amd_div_vrda_mt_func_t>(amd_core, "amd_vrda_divi_64");
+    amd_funcs.erf_vrda_mt = load_amd_symbol<amd_erf_vrda_mt_func_t>(amd_core, "amd_vrda_erfi_64");
+    amd_funcs.erfc_vrda_mt = load_amd_symbol<amd_erfc_vrda_mt_func_t>(amd_core, "amd_vrda_erfci_64");
+    amd_funcs.exp_vrda_mt = load_amd_symbol<amd_exp_vrda_mt_func_t>(amd_core, "amd_vrda_expi_64");
+    amd_funcs.exp10_vrda_mt = load_amd_symbol<amd_exp10_vrda_mt_func_t>(amd_core, "amd_vrda_exp10i_64");
+    amd_funcs.exp2_vrda_mt = load_amd_symbol<amd_exp2_vrda_mt_func_t>(amd_core, "amd_vrda_exp2i_64");
+    amd_funcs.expm1_vrda_mt = load_amd_symbol<amd_expm1_vrda_mt_func_t>(amd_core, "amd_vrda_expm1i_64");
+    amd_funcs.fabs_vrda_mt = load_amd_symbol<amd_fabs_vrda_mt_func_t>(amd_core, "amd_vrda_fabsi_64");
+    amd_funcs.fmax_vrda_mt = load_amd_symbol<amd_fmax_vrda_mt_func_t>(amd_core, "amd_vrda_fmaxi_64");
+    amd_funcs.fmin_vrda_mt = load_amd_symbol<amd_fmin_vrda_mt_func_t>(amd_core, "amd_vrda_fmini_64");
+    amd_funcs.log_vrda_mt = load_amd_symbol<amd_log_vrda_mt_func_t>(amd_core, "amd_vrda_logi_64");
+    amd_funcs.log10_vrda_mt = load_amd_symbol<amd_log10_vrda_mt_func_t>(amd_core, "amd_vrda_log10i_64");
+    amd_funcs.log1p_vrda_mt = load_amd_symbol<amd_log1p_vrda_mt_func_t>(amd_core, "amd_vrda_log1pi_64");
+    amd_funcs.log2_vrda_mt = load_amd_symbol<amd_log2_vrda_mt_func_t>(amd_core, "amd_vrda_log2i_64");
+    amd_funcs.mul_vrda_mt = load_amd_symbol<amd_mul_vrda_mt_func_t>(amd_core, "amd_vrda_muli_64");
+    amd_funcs.pow_vrda_mt = load_amd_symbol<amd_pow_vrda_mt_func_t>(amd_core, "amd_vrda_powi_64");
+    amd_funcs.powx_vrda_mt = load_amd_symbol<amd_powx_vrda_mt_func_t>(amd_core, "amd_vrda_powxi_64");
+    amd_funcs.sin_vrda_mt = load_amd_symbol<amd_sin_vrda_mt_func_t>(amd_core, "amd_vrda_sini_64");
+    amd_funcs.sincos_vrda_mt = load_amd_symbol<amd_sincos_vrda_mt_func_t>(amd_core, "amd_vrda_sincosi_64");
+    amd_funcs.sqrt_vrda_mt = load_amd_symbol<amd_sqrt_vrda_mt_func_t>(amd_core, "amd_vrda_sqrti_64");
+    amd_funcs.sub_vrda_mt = load_amd_symbol<amd_sub_vrda_mt_func_t>(amd_core, "amd_vrda_subi_64");
+    amd_funcs.tan_vrda_mt = load_amd_symbol<amd_tan_vrda_mt_func_t>(amd_core, "amd_vrda_tani_64");
+
+    amd_funcs.set_num_threads = load_amd_symbol<amd_set_num_threads_func_t>(amd_core, "alm_set_num_threads");
+
 #ifdef __AVX512F__
     // ============================================================================
     // DOUBLE PRECISION 512-BIT VECTOR (vrd8) VARIANTS
@@ -2457,6 +2655,254 @@ SHIM_EXPORT void shim_tan_vrda(InParams<double, double> *ipp) {
     amd_funcs.tan_vrda(ipp->count, ipp->iptr[0], ipp->optr[0]);
 }
 
+// ============================================================================
+// PARALLEL ARRAY (vrsa_mt, vrda_mt) VARIANTS
+// The 64-bit length entry points split the work across the threads set with
+// shim_set_num_threads().
+// ============================================================================
+SHIM_EXPORT int shim_set_num_threads(int nthreads) {
+    if (!amd_funcs.set_num_threads) {
+        return -1;
+    }
+    return amd_funcs.set_num_threads(nthreads);
+}
+
+SHIM_EXPORT void shim_acos_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.acos_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_add_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.add_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_asin_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.asin_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_atan_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.atan_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_cbrt_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.cbrt_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_cos_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.cos_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_cosh_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.cosh_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_div_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.div_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_erf_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.erf_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_erfc_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.erfc_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_exp_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.exp_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_exp10_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.exp10_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_exp2_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.exp2_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_expm1_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.expm1_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_fabs_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.fabs_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_fmax_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.fmax_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_fmin_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.fmin_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_log_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.log_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_log10_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.log10_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_log1p_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.log1p_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_log2_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.log2_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_mul_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.mul_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_pow_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.pow_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_powx_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.powx_vrsa_mt(ipp->count, ipp->iptr[0], 1, *ipp->iptr[1], ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_sin_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.sin_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_sincos_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.sincos_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1, ipp->optr[1], 1);
+}
+
+SHIM_EXPORT void shim_sqrt_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.sqrt_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_sub_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.sub_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_tan_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.tan_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_tanh_vrsa_mt(InParams<float, float> *ipp) {
+    amd_funcs.tanh_vrsa_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_acos_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.acos_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_add_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.add_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_asin_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.asin_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_atan_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.atan_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_cbrt_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.cbrt_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_cos_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.cos_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_cosh_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.cosh_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_div_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.div_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_erf_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.erf_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_erfc_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.erfc_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_exp_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.exp_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_exp10_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.exp10_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_exp2_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.exp2_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_expm1_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.expm1_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_fabs_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.fabs_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_fmax_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.fmax_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_fmin_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.fmin_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_log_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.log_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_log10_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.log10_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_log1p_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.log1p_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_log2_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.log2_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_mul_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.mul_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_pow_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.pow_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_powx_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.powx_vrda_mt(ipp->count, ipp->iptr[0], 1, *ipp->iptr[1], ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_sin_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.sin_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_sincos_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.sincos_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1, ipp->optr[1], 1);
+}
+
+SHIM_EXPORT void shim_sqrt_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.sqrt_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_sub_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.sub_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->iptr[1], 1, ipp->optr[0], 1);
+}
+
+SHIM_EXPORT void shim_tan_vrda_mt(InParams<double, double> *ipp) {
+    amd_funcs.tan_vrda_mt(ipp->count, ipp->iptr[0], 1, ipp->optr[0], 1);
+}
+
 #ifdef __AVX512F__
 // ============================================================================
 // DOUBLE PRECISION 512-BIT VECTOR (vrd8) VARIANTS
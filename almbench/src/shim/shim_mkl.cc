@@ -352,6 +352,9 @@ typedef void (*mkl_sub_vrda_func_t)(int, const double*, const double*, double*);
 typedef void (*mkl_subi_vrda_func_t)(int, const double*, double, double*);
 typedef void (*mkl_tan_vrda_func_t)(int, const double*, double*);
 
+// --- Threading control (VM array functions are threaded by MKL) ---
+typedef void (*mkl_set_num_threads_func_t)(int);
+
 #ifdef __AVX512F__
 // --- Double Precision 512-bit Vector (vrd8) Functions ---
 typedef __m512d (*mkl_asin_vrd8_func_t)(__m512d);
@@ -709,6 +712,8 @@ static struct {
     mkl_subi_vrda_func_t subi_vrda;
     mkl_tan_vrda_func_t tan_vrda;
 
+    mkl_set_num_threads_func_t set_num_threads;
+
 #ifdef __AVX512F__
     // ============================================================================
     // DOUBLE PRECISION 512-BIT VECTOR (vrd8) VARIANTS
@@ -1158,6 +1163,8 @@ static void init_mkl_symbols(void) {
     mkl_funcs.subi_vrda = load_mkl_symbol<mkl_subi_vrda_func_t>(mkl_vma, "vdSub"); // No separate _i function in VML
     mkl_funcs.tan_vrda = load_mkl_symbol<mkl_tan_vrda_func_t>(mkl_vma, "vdTan");
 
+    mkl_funcs.set_num_threads = load_mkl_symbol<mkl_set_num_threads_func_t>(mkl_vma, "MKL_Set_Num_Threads");
+
 #ifdef __AVX512F__
     // ============================================================================
     // DOUBLE PRECISION 512-BIT VECTOR (vrd8) VARIANTS
@@ -2446,6 +2453,19 @@ SHIM_EXPORT void shim_tan_vrda(InParams<double, double> *ipp) {
     mkl_funcs.tan_vrda(ipp->count, ipp->iptr[0], ipp->optr[0]);
 }
 
+// ============================================================================
+// THREADING CONTROL
+// The VM array functions above run on the MKL threads, strong scaling tests
+// use them directly with the thread count set here.
+// ============================================================================
+SHIM_EXPORT int shim_set_num_threads(int nthreads) {
+    if (!mkl_funcs.set_num_threads) {
+        return -1;
+    }
+    mkl_funcs.set_num_threads(nthreads);
+    return 0;
+}
+
 #ifdef __AVX512F__
 // ============================================================================
 // DOUBLE PRECISION 512-BIT VECTOR (vrd8) VARIANTS
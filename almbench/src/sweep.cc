@@ -0,0 +1,461 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*
+ * Array length sweeps
+ *
+ * A sweep test runs a variant over geometric lengths, two per octave from
+ * 1 up to the "steps" of the test (at most 2^28), so the working set moves
+ * from the L1 cache through L2 and L3 to DRAM. Short lengths show the cost
+ * of the call and of the tail handling, long ones the memory bandwidth.
+ *
+ * Every length is timed out of place (separate input and output arrays)
+ * and in place (output over the input, which is restored before each
+ * call). Array variants get the length in one call; scalar and vector
+ * variants are called over it in a loop, with the tail in a padded
+ * argument, the way a caller without the array API would do it.
+ *
+ * Each call is timed with the TSC and the best of the repetitions of a
+ * length is kept. Reported per length and layout are elements/s and GB/s,
+ * counting every input array read and every output array written once.
+ * The fastest variant and layout per length, over all variants of the
+ * same test that have run so far, is written to
+ * <vendor>_sweep_<api>_crossover.yaml together with the crossovers: the
+ * lengths where another configuration gets ahead of the one leading so
+ * far by more than 5%, so that noise between close ones is not listed.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <new>
+#include <vector>
+#include <yaml-cpp/yaml.h>
+#include "dll_utils.h"
+#include "alm_test.h"
+#include "api_template.h"
+#include "api_runner.h"
+
+/* Lengths per octave */
+#define SWEEP_PER_OCTAVE 2
+
+/* Longest length of a sweep */
+#define SWEEP_MAX_LENGTH (1ull << 28)
+
+/* Time spent on each length and layout, and repetitions */
+#define SWEEP_TARGET_NS  20e6
+#define SWEEP_MIN_REPS   3
+#define SWEEP_MAX_REPS   100000
+
+/* Lead a configuration needs over the current one to count as a crossover */
+#define SWEEP_MARGIN     1.05
+
+/*
+ * sweep_lengths:
+ * Geometric lengths from 1 to max, rounded and without duplicates, and
+ * max itself.
+ */
+static std::vector<uint64_t> sweep_lengths(uint64_t max)
+{
+    std::vector<uint64_t> lengths;
+    for (int k = 0;; ++k) {
+        double x = std::pow(2.0, static_cast<double>(k) / SWEEP_PER_OCTAVE);
+        uint64_t n = static_cast<uint64_t>(std::llround(x));
+        if (n > max) {
+            break;
+        }
+        if (lengths.empty() || n != lengths.back()) {
+            lengths.push_back(n);
+        }
+    }
+    if (lengths.back() != max) {
+        lengths.push_back(max);
+    }
+    return lengths;
+}
+
+/* Arrays aligned to a cache line, like the generator's */
+template <typename U>
+struct AlignedArrayDeleter {
+    void operator()(U *ptr) const
+    {
+        operator delete[](ptr, std::align_val_t(64));
+    }
+};
+
+template <typename U>
+using AlignedArray = std::unique_ptr<U[], AlignedArrayDeleter<U>>;
+
+template <typename U>
+static AlignedArray<U> aligned_array(uint64_t n)
+{
+    return AlignedArray<U>(new (std::align_val_t(64)) U[n]);
+}
+
+/*
+ * SweepRun:
+ * Elements/s per length of one variant and layout, e.g. "vrda/out".
+ */
+struct SweepRun {
+    std::string                  config;
+    std::map<uint64_t, double>   melems;
+};
+
+/* Runs of each test, by test id, function and precision */
+static std::map<std::string, std::vector<SweepRun>> sweep_runs;
+
+/*
+ * write_crossover:
+ * Fastest configuration per length of every test of the function so far,
+ * and the lengths where it changes, written over the previous file.
+ */
+static void write_crossover(const std::string &path, const std::string &prefix)
+{
+    YAML::Node doc;
+
+    for (const auto &group : sweep_runs) {
+        if (group.first.compare(0, prefix.size(), prefix) != 0) {
+            continue;
+        }
+
+        std::map<uint64_t, std::pair<std::string, double>> best;
+        YAML::Node configs;
+        for (const auto &run : group.second) {
+            configs.push_back(run.config);
+            for (const auto &m : run.melems) {
+                auto it = best.find(m.first);
+                if (it == best.end() || m.second > it->second.second) {
+                    best[m.first] = {run.config, m.second};
+                }
+            }
+        }
+        configs.SetStyle(YAML::EmitterStyle::Flow);
+
+        auto melem_of = [&](const std::string &config, uint64_t n) {
+            for (const auto &run : group.second) {
+                if (run.config == config) {
+                    auto it = run.melems.find(n);
+                    return (it == run.melems.end()) ? 0.0 : it->second;
+                }
+            }
+            return 0.0;
+        };
+
+        YAML::Node fastest, crossover;
+        std::string lead;
+        for (const auto &b : best) {
+            YAML::Node f;
+            f["length"]  = b.first;
+            f["config"]  = b.second.first;
+            f["melem_s"] = b.second.second;
+            f.SetStyle(YAML::EmitterStyle::Flow);
+            fastest.push_back(f);
+
+            if (lead.empty()) {
+                lead = b.second.first;
+            } else if (b.second.first != lead &&
+                       b.second.second > melem_of(lead, b.first) * SWEEP_MARGIN) {
+                YAML::Node c;
+                c["length"] = b.first;
+                c["from"]   = lead;
+                c["to"]     = b.second.first;
+                c.SetStyle(YAML::EmitterStyle::Flow);
+                crossover.push_back(c);
+                lead = b.second.first;
+            }
+        }
+
+        YAML::Node node;
+        node["test"]      = group.first.substr(prefix.size());
+        node["configs"]   = configs;
+        node["fastest"]   = fastest;
+        node["crossover"] = crossover;
+        doc.push_back(node);
+    }
+
+    std::ofstream fout(path, std::ios::trunc);
+    if (!fout.is_open()) {
+        std::cerr << "Error: Could not open file " << path
+                  << " for writing." << std::endl;
+        return;
+    }
+    fout << doc << "\n";
+}
+
+/*
+ * sweep_test:
+ * Runs one variant over the lengths of the test in both layouts, appends
+ * the results to the output file of the test and updates the crossover
+ * file of the function.
+ */
+template <typename T, typename U>
+int sweep_test(struct AlmLibs *alibs,
+               struct InParams<T, U> *ipp,
+               const std::string &libapi,
+               ApiTypes api_type,
+               struct YamlOutputs<U> *yop)
+{
+    if (api_type > API_PROTOTYPE_04 ||
+        (api_type == API_PROTOTYPE_03 && !yop->is_vra)) {
+        std::cout << "Sweep tests support prototypes 01-04 only, "
+                  << "skipping: " << yop->api_name << " " << yop->variant
+                  << std::endl;
+        return -1;
+    }
+
+    if (ipp->range.empty()) {
+        std::cerr << "Sweep test " << yop->test_id
+                  << " needs an input range" << std::endl;
+        return -1;
+    }
+
+    using ShimFunc = void (*)(InParams<T, U> *);
+    ShimFunc shim_func = load_function<ShimFunc>(alibs->pshimlib, libapi);
+
+    const uint64_t lanes   = sizeof(T) / sizeof(U);
+    const int      inputs  = (api_type == API_PROTOTYPE_02) ? 2 : 1;
+    const int      outputs = (api_type == API_PROTOTYPE_04) ? 2 : 1;
+    uint64_t max = std::min<uint64_t>(std::max<uint64_t>(ipp->range[0].count, 1),
+                                      SWEEP_MAX_LENGTH);
+
+    /* Shorten the sweep until its arrays fit */
+    AlignedArray<U> in0, in1, out0, out1;
+    for (;; max /= 2) {
+        try {
+            in0  = aligned_array<U>(max);
+            in1  = aligned_array<U>(inputs > 1 ? max : 1);
+            out0 = aligned_array<U>(max);
+            out1 = aligned_array<U>(outputs > 1 ? max : 1);
+            break;
+        } catch (const std::bad_alloc &) {
+            in0.reset();
+            in1.reset();
+            out0.reset();
+            out1.reset();
+            if (max == 1) {
+                std::cerr << "Sweep test " << yop->test_id
+                          << " could not allocate its arrays" << std::endl;
+                return -1;
+            }
+            std::cout << "Arrays of " << max << " elements do not fit, "
+                      << "sweeping to " << max / 2 << std::endl;
+        }
+    }
+
+    const auto &r0 = ipp->range[0];
+    const auto &r1 = (ipp->range.size() > 1) ? ipp->range[1] : r0;
+    U powx_y = r1.srt;
+
+    /* TSC read overhead, subtracted from every call */
+    uint64_t tsc_cost = UINT64_MAX;
+    for (int i = 0; i < 1000; ++i) {
+        uint64_t s = read_tsc();
+        tsc_cost = std::min(tsc_cost, read_tsc() - s);
+    }
+    const TscCalibration &cal = tsc_calibration();
+
+    InParams<T, U> local{};
+
+    /* One call over n elements: the array API, or a loop over the argument */
+    auto call = [&](uint64_t n, U *src, U *dst) {
+        if (yop->is_vra) {
+            local.count   = n;
+            local.iptr[0] = src;
+            local.iptr[1] = (api_type == API_PROTOTYPE_03) ? &powx_y : in1.get();
+            local.optr[0] = dst;
+            local.optr[1] = out1.get();
+            shim_func(&local);
+            return;
+        }
+        for (uint64_t c = 0; c < n; c += lanes) {
+            uint64_t m = std::min(lanes, n - c);
+            U a[sizeof(T) / sizeof(U)], b[sizeof(T) / sizeof(U)];
+            for (uint64_t l = 0; l < lanes; ++l) {
+                a[l] = src[c + (l < m ? l : 0)];
+                b[l] = (inputs > 1) ? in1[c + (l < m ? l : 0)] : U(0);
+            }
+            std::memcpy(&local.ip[0], a, sizeof(T));
+            std::memcpy(&local.ip[1], b, sizeof(T));
+            shim_func(&local);
+            std::memcpy(dst + c, &local.op[0], m * sizeof(U));
+            if (outputs > 1) {
+                std::memcpy(out1.get() + c, &local.op[1], m * sizeof(U));
+            }
+        }
+    };
+
+    /* Best time of a length in ns, in place when inplace */
+    auto time_length = [&](uint64_t n, bool inplace) {
+        U *src = inplace ? out0.get() : in0.get();
+        uint64_t best = UINT64_MAX, spent = 0;
+
+        for (int rep = -1; rep < SWEEP_MAX_REPS; ++rep) {
+            if (inplace) {
+                std::memcpy(out0.get(), in0.get(), n * sizeof(U));
+            }
+            uint64_t s = read_tsc();
+            call(n, src, out0.get());
+            uint64_t t = read_tsc() - s;
+            if (rep < 0) {
+                continue;       /* warm-up, first touch of the outputs */
+            }
+            best   = std::min(best, t);
+            spent += t;
+            if (rep + 1 >= SWEEP_MIN_REPS &&
+                static_cast<double>(spent) * cal.ns >= SWEEP_TARGET_NS) {
+                break;
+            }
+        }
+        uint64_t net = (best > tsc_cost) ? best - tsc_cost : 1;
+        return static_cast<double>(net) * cal.ns;
+    };
+
+    std::cout << "Length sweep: " << yop->api_name << " " << yop->variant
+              << ", 1 to " << max << " elements" << std::endl;
+    std::cout << std::setw(12) << "length"
+              << std::setw(14) << "out Melem/s" << std::setw(10) << "GB/s"
+              << std::setw(14) << "in Melem/s"  << std::setw(10) << "GB/s"
+              << std::endl;
+
+    const double bytes_per_elem = static_cast<double>(sizeof(U) * (inputs + outputs));
+    SweepRun run_out{yop->variant + "/out", {}};
+    SweepRun run_in{yop->variant + "/in", {}};
+    YAML::Node results;
+
+    for (uint64_t n : sweep_lengths(max)) {
+        /* Inputs spread over the range for each length */
+        U step0 = (n > 1) ? (r0.stp - r0.srt) / static_cast<U>(n - 1) : U(0);
+        U step1 = (n > 1) ? (r1.stp - r1.srt) / static_cast<U>(n - 1) : U(0);
+        for (uint64_t i = 0; i < n; ++i) {
+            in0[i] = r0.srt + step0 * static_cast<U>(i);
+            if (inputs > 1) {
+                in1[i] = r1.srt + step1 * static_cast<U>(i);
+            }
+        }
+
+        double ns_out = time_length(n, false);
+        double ns_in  = time_length(n, true);
+        double me_out = static_cast<double>(n) / ns_out * 1e3;
+        double me_in  = static_cast<double>(n) / ns_in * 1e3;
+        double gb_out = static_cast<double>(n) * bytes_per_elem / ns_out;
+        double gb_in  = static_cast<double>(n) * bytes_per_elem / ns_in;
+        run_out.melems[n] = me_out;
+        run_in.melems[n]  = me_in;
+
+        std::cout << std::fixed
+                  << std::setw(12) << n
+                  << std::setw(14) << std::setprecision(1) << me_out
+                  << std::setw(10) << std::setprecision(2) << gb_out
+                  << std::setw(14) << std::setprecision(1) << me_in
+                  << std::setw(10) << std::setprecision(2) << gb_in
+                  << std::defaultfloat << std::endl;
+
+        YAML::Node out, in;
+        out["time_ns"] = ns_out;
+        out["melem_s"] = me_out;
+        out["gb_s"]    = gb_out;
+        in["time_ns"]  = ns_in;
+        in["melem_s"]  = me_in;
+        in["gb_s"]     = gb_in;
+        out.SetStyle(YAML::EmitterStyle::Flow);
+        in.SetStyle(YAML::EmitterStyle::Flow);
+
+        YAML::Node entry;
+        entry["length"]       = n;
+        entry["out_of_place"] = out;
+        entry["in_place"]     = in;
+        results.push_back(entry);
+    }
+
+    YAML::Node node;
+    node["test_id"]  = yop->test_id;
+    node["api_name"] = yop->api_name;
+    node["variant"]  = yop->variant;
+    node["library"]  = yop->vendor;
+    node["max"]      = max;
+    node["sweep"]    = results;
+
+    std::ofstream fout(yop->outfile, std::ios::app);
+    if (!fout.is_open()) {
+        std::cerr << "Error: Could not open file " << yop->outfile
+                  << " for writing." << std::endl;
+        return -1;
+    }
+    fout << node << "\n";
+
+    /* Crossover over the variants of this test that have run */
+    std::string prefix = yop->vendor + " " + yop->api_name + " ";
+    std::string key = prefix + yop->test_id + (sizeof(U) == 4 ? " single" : " double");
+    auto &runs = sweep_runs[key];
+    for (auto *run : {&run_out, &run_in}) {
+        auto same = std::find_if(runs.begin(), runs.end(),
+                                 [&](const SweepRun &r) { return r.config == run->config; });
+        if (same != runs.end()) {
+            *same = *run;
+        } else {
+            runs.push_back(*run);
+        }
+    }
+
+    std::filesystem::path cross = std::filesystem::path(yop->outfile).parent_path() /
+        (yop->vendor + "_sweep_" + yop->api_name + "_crossover.yaml");
+    write_crossover(cross.string(), prefix);
+
+    return 0;
+}
+
+/* Explicit template instantiations */
+template int sweep_test<float, float>(struct AlmLibs *, struct InParams<float, float> *,
+                               const std::string &, ApiTypes,
+                               struct YamlOutputs<float> *);
+template int sweep_test<double, double>(struct AlmLibs *, struct InParams<double, double> *,
+                               const std::string &, ApiTypes,
+                               struct YamlOutputs<double> *);
+template int sweep_test<libm::AlignedM128, float>(struct AlmLibs *, struct InParams<libm::AlignedM128, float> *,
+                               const std::string &, ApiTypes,
+                               struct YamlOutputs<float> *);
+template int sweep_test<libm::AlignedM128d, double>(struct AlmLibs *, struct InParams<libm::AlignedM128d, double> *,
+                               const std::string &, ApiTypes,
+                               struct YamlOutputs<double> *);
+template int sweep_test<libm::AlignedM256, float>(struct AlmLibs *, struct InParams<libm::AlignedM256, float> *,
+                               const std::string &, ApiTypes,
+                               struct YamlOutputs<float> *);
+template int sweep_test<libm::AlignedM256d, double>(struct AlmLibs *, struct InParams<libm::AlignedM256d, double> *,
+                               const std::string &, ApiTypes,
+                               struct YamlOutputs<double> *);
+#ifdef __AVX512F__
+template int sweep_test<libm::AlignedM512, float>(struct AlmLibs *, struct InParams<libm::AlignedM512, float> *,
+                               const std::string &, ApiTypes,
+                               struct YamlOutputs<float> *);
+template int sweep_test<libm::AlignedM512d, double>(struct AlmLibs *, struct InParams<libm::AlignedM512d, double> *,
+                               const std::string &, ApiTypes,
+                               struct YamlOutputs<double> *);
+#endif
@@ -35,7 +35,10 @@
 
 // Global filters (empty = no filter)
 static std::string g_api_filter;
-static std::string g_type_filter; // "UT", "VT", "PERF" or empty
+static std::string g_type_filter; // "UT", "VT", "PERF", "SCAL", "REPL", "MT", "SWEEP" or empty
+
+// Directory of the test file being parsed, for relative trace paths
+static std::string g_test_dir;
 
 // Setters used by main.cc
 void set_api_filter(const std::string& api)
@@ -45,8 +48,10 @@ void set_api_filter(const std::string& api)
 
 void set_type_filter(const std::string& type)
 {
-    if (type == "CONF" || type == "ACCU" || type == "PERF" ||
-        type == "conf" || type == "accu" || type == "perf")
+    if (type == "CONF" || type == "ACCU" || type == "PERF" || type == "SCAL" ||
+        type == "REPL" || type == "MT" || type == "SWEEP" || type == "conf" ||
+        type == "accu" || type == "perf" || type == "scal" || type == "repl" ||
+        type == "mt" || type == "sweep")
         g_type_filter = type;
     else
         g_type_filter.clear();
@@ -83,6 +88,11 @@ static int read_test(const YAML::Node &test, struct YamlInputs &param)
     const YAML::Node variants = test["variants"];
     const YAML::Node exp_excep = test["expect_exception"];
     const YAML::Node uth = test["uth"];
+    const YAML::Node threads = test["threads"];
+    const YAML::Node trace = test["trace"];
+    const YAML::Node numa = test["numa"];
+    const YAML::Node perf_mode = test["perf_mode"];
+    const YAML::Node counters = test["counters"];
 
     uint32_t n = 0;
     param.test_id = test_id;
@@ -119,6 +129,39 @@ static int read_test(const YAML::Node &test, struct YamlInputs &param)
         }
     }
 
+    /* Read thread counts of scaling tests if present */
+    if (threads) {
+        for (std::size_t i = 0; i < threads.size(); i++) {
+            param.threads.push_back(threads[i].as<std::string>());
+        }
+    }
+
+    /* Read the capture trace of replay tests, relative to the test file */
+    if (trace) {
+        std::filesystem::path p(trace.as<std::string>());
+        if (p.is_relative() && !g_test_dir.empty()) {
+            p = std::filesystem::path(g_test_dir) / p;
+        }
+        param.trace = p.string();
+    }
+
+    /* Spread the threads of multi-threaded tests over NUMA nodes */
+    if (numa) {
+        param.numa = numa.as<bool>();
+    }
+
+    /* Cycle-timed latency or throughput mode of performance tests */
+    if (perf_mode) {
+        param.perf_mode = perf_mode.as<std::string>();
+    }
+
+    /* Hardware counters read around the cycle-timed blocks */
+    if (counters) {
+        for (std::size_t i = 0; i < counters.size(); i++) {
+            param.counters.push_back(counters[i].as<std::string>());
+        }
+    }
+
     /* Read expected output value if present */
     if (expect) {
         param.xv = expect[0].as<std::string>();
@@ -350,6 +393,10 @@ static const char* classify_test_file(const std::string& path) {
     if (path.size() >= 9 && path.rfind("_conf.yml")   == path.size() - 9) return "CONF";
     if (path.size() >= 9 && path.rfind("_accu.yml")   == path.size() - 9) return "ACCU";
     if (path.size() >= 9 && path.rfind("_perf.yml") == path.size() - 9) return "PERF";
+    if (path.size() >= 9 && path.rfind("_scal.yml") == path.size() - 9) return "SCAL";
+    if (path.size() >= 9 && path.rfind("_repl.yml") == path.size() - 9) return "REPL";
+    if (path.size() >= 7 && path.rfind("_mt.yml")   == path.size() - 7) return "MT";
+    if (path.size() >= 10 && path.rfind("_sweep.yml") == path.size() - 10) return "SWEEP";
     return "TEST";
 }
 
@@ -445,6 +492,22 @@ static int handle_includes(const std::string &filename, std::vector<struct YamlI
                     for (const auto& name : { api + "_conf.yml", api + "_accu.yml", api + "_perf.yml" }) {
                         filesToLoad.push_back(apiDir / name);
                     }
+                    // Scaling tests are long running, only load them on request
+                    if (g_type_filter == "SCAL" || g_type_filter == "scal") {
+                        filesToLoad.push_back(apiDir / (api + "_scal.yml"));
+                    }
+                    // Replay tests need a trace captured by the user
+                    if (g_type_filter == "REPL" || g_type_filter == "repl") {
+                        filesToLoad.push_back(apiDir / (api + "_repl.yml"));
+                    }
+                    // Multi-threaded tests occupy every core, only on request
+                    if (g_type_filter == "MT" || g_type_filter == "mt") {
+                        filesToLoad.push_back(apiDir / (api + "_mt.yml"));
+                    }
+                    // Sweeps run up to 2^28 elements, only on request
+                    if (g_type_filter == "SWEEP" || g_type_filter == "sweep") {
+                        filesToLoad.push_back(apiDir / (api + "_sweep.yml"));
+                    }
                 }
 
                 int loadedCount = 0;
@@ -484,6 +547,7 @@ static int handle_includes(const std::string &filename, std::vector<struct YamlI
         // Case 3: test file
         const char* kind = classify_test_file(filename);
         std::fprintf(stderr, "[yaml_read] Processing test file (%s): %s\n", kind, filename.c_str());
+        g_test_dir = base_dir;
         int rc = parse_yaml_content(config, params);
         std::fprintf(stderr, "[yaml_read] Done test file (%s): %s rc=%d\n", kind, filename.c_str(), rc);
         return rc;
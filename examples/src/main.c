@@ -43,6 +43,8 @@ extern int use_copysign();
 extern int use_nearbyint();
 extern int use_remainder();
 extern int use_pow();
+extern int use_powi();
+extern int use_rsqrt();
 extern int use_fdim();
 
 /* exponential */
@@ -73,10 +75,55 @@ extern int use_sincos();
 /* erf */
 extern int use_erf();
 
+/* cdfnorm */
+extern int use_cdfnorm();
+
+/* normal random variates */
+extern int use_randn();
+
 /* complex number variants */
 extern int use_cexp();
 extern int use_clog();
 extern int use_cpow();
+extern int use_csqrt();
+extern int use_cabs();
+extern int use_ctrig();
+
+/* strided array variants */
+extern int use_strided();
+
+/* indexed and masked array variants */
+extern int use_masked();
+
+/* fused expressions */
+extern int use_expr();
+
+/* parallel execution */
+extern int use_parallel();
+
+/* accuracy tiers */
+extern int use_accuracy();
+
+/* header-only inline kernels */
+extern int use_inline();
+
+/* compiler auto-vectorization */
+extern int use_simd();
+
+/* call statistics */
+extern int use_stats();
+
+/* reductions */
+extern int use_reduce();
+
+/* half precision */
+extern int use_f16();
+
+/* bfloat16 */
+extern int use_bf16();
+
+/* activation functions */
+extern int use_activation();
 
 /* avx512 */
 #if defined (__AVX512__)
@@ -109,6 +156,8 @@ int main()  {
     use_nearbyint();
     use_remainder();
     use_pow();
+    use_powi();
+    use_rsqrt();
     use_fdim();
 
     /* exponential */
@@ -139,10 +188,55 @@ int main()  {
     /* erf */
     use_erf();
 
+    /* cdfnorm */
+    use_cdfnorm();
+
+    /* normal random variates */
+    use_randn();
+
     /* complex number variants */
     use_cexp();
     use_clog();
     use_cpow();
+    use_csqrt();
+    use_cabs();
+    use_ctrig();
+
+    /* strided array variants */
+    use_strided();
+
+    /* indexed and masked array variants */
+    use_masked();
+
+    /* fused expressions */
+    use_expr();
+
+    /* parallel execution */
+    use_parallel();
+
+    /* accuracy tiers */
+    use_accuracy();
+
+    /* header-only inline kernels */
+    use_inline();
+
+    /* compiler auto-vectorization */
+    use_simd();
+
+    /* call statistics */
+    use_stats();
+
+    /* reductions */
+    use_reduce();
+
+    /* half precision */
+    use_f16();
+
+    /* bfloat16 */
+    use_bf16();
+
+    /* activation functions */
+    use_activation();
 
     /* avx512 */
     #if defined (__AVX512__)
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Accuracy Tiers
+ * *******************************************/
+#define LEN 4096
+
+void accuracy_tiers()
+{
+    printf("Using Run-time Accuracy Tiers: alm_set_accuracy, alm_set_func_accuracy\n");
+    double *input = malloc(LEN * sizeof(double));
+    double *output = malloc(LEN * sizeof(double));
+    if (input == NULL || output == NULL)
+    {
+        free(input);
+        free(output);
+        return;
+    }
+    for(int i=0; i<LEN; ++i)
+    {
+        input[i] = -8.0 + 16.0 * (double)i / LEN;
+    }
+
+    /* bulk work in the fast tier, scalar exp kept within 1 ULP */
+    alm_set_accuracy(ALM_ACC_FAST);
+    alm_set_func_accuracy("exp", ALM_ACC_1ULP);
+    amd_vrda_exp(LEN, input, output);
+    printf("Tier: vrda_exp %d, vrs8_expf %d, exp %d\n",
+           alm_get_func_accuracy("vrda_exp"), alm_get_func_accuracy("vrs8_expf"),
+           alm_get_func_accuracy("exp"));
+    printf("amd_vrda_exp Output[0]: %f, amd_exp(1.0): %f, amd_log(2.0): %f\n",
+           output[0], amd_exp(1.0), amd_log(2.0));
+
+    /* back to the default for every function */
+    alm_set_func_accuracy("exp", -1);
+    alm_set_accuracy(ALM_ACC_1ULP);
+    free(input);
+    free(output);
+    printf("----------\n");
+}
+
+int use_accuracy()
+{
+    printf("\n\n***** accuracy tiers *****\n");
+    accuracy_tiers();
+    return 0;
+}
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Activation functions
+ * *******************************************/
+#define LEN 11
+
+void activation_vector_single_precision_8()
+{
+    printf("Using Vector single precision - 8 floats (vrs8) gelu_tanhf()\n");
+    __m256 input, result;
+    float input_array_vrs8[8] = {-4.0, -2.0, -1.0, -0.5, 0.0, 0.5, 1.0, 2.0};
+    float output_array_vrs8[8];
+
+    input = _mm256_loadu_ps(input_array_vrs8);
+    result = amd_vrs8_gelu_tanhf(input);
+    _mm256_storeu_ps(output_array_vrs8, result);
+
+    printf("Input: {%f, %f, %f, %f, %f, %f, %f, %f}, Output: {%f, %f, %f, %f, %f, %f, %f, %f}\n",
+            input_array_vrs8[0], input_array_vrs8[1], input_array_vrs8[2], input_array_vrs8[3],
+            input_array_vrs8[4], input_array_vrs8[5], input_array_vrs8[6], input_array_vrs8[7],
+            output_array_vrs8[0], output_array_vrs8[1], output_array_vrs8[2], output_array_vrs8[3],
+            output_array_vrs8[4], output_array_vrs8[5], output_array_vrs8[6], output_array_vrs8[7]);
+    printf("----------\n");
+}
+
+void activation_array_single_precision()
+{
+    printf("Using Array single precision: amd_vrsa_sigmoidf, amd_vrsa_siluf, amd_vrsa_mishf\n");
+    float in[LEN], sig[LEN], silu[LEN], mish[LEN];
+    for(int i=0; i<LEN; ++i)
+        in[i] = -5.0f + (float)i;
+
+    amd_vrsa_sigmoidf(LEN, in, sig);
+    amd_vrsa_siluf(LEN, in, silu);
+    amd_vrsa_mishf(LEN, in, mish);
+
+    for(int i=0; i<LEN; i+=2)
+        printf("x: %f sigmoid: %f silu: %f mish: %f\n", in[i], sig[i], silu[i], mish[i]);
+    printf("----------\n");
+}
+
+void activation_array_double_precision()
+{
+    printf("Using Array double precision: amd_vrda_gelu, amd_vrda_softplus\n");
+    double in[LEN], gelu[LEN], sp[LEN];
+    for(int i=0; i<LEN; ++i)
+        in[i] = -5.0 + (double)i;
+
+    amd_vrda_gelu(LEN, in, gelu);
+    amd_vrda_softplus(LEN, in, sp);
+
+    for(int i=0; i<LEN; i+=2)
+        printf("x: %lf gelu: %lf softplus: %lf\n", in[i], gelu[i], sp[i]);
+    printf("----------\n");
+}
+
+void softmax_batch_single_precision()
+{
+    printf("Using Batched Array single precision: amd_vrsa_softmax_batchf, amd_vrsa_log_softmax_batchf\n");
+    float in[2][6] = {{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f},
+                      {-1.0f, 0.0f, 1.0f, -1.0f, 0.0f, 1.0f}};
+    float sm[2][6], lsm[2][6];
+
+    amd_vrsa_softmax_batchf(2, 6, &in[0][0], 6, &sm[0][0], 6);
+    amd_vrsa_log_softmax_batchf(2, 6, &in[0][0], 6, &lsm[0][0], 6);
+
+    for(int r=0; r<2; ++r)
+        for(int i=0; i<6; i+=2)
+            printf("row %d x: %f softmax: %f log_softmax: %f\n", r, in[r][i], sm[r][i], lsm[r][i]);
+    printf("----------\n");
+}
+
+int use_activation()
+{
+    printf("\n\n***** Activation functions *****\n");
+    activation_vector_single_precision_8();
+    activation_array_single_precision();
+    activation_array_double_precision();
+    softmax_batch_single_precision();
+    return 0;
+}
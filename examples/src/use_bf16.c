@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     bfloat16 (BF16)
+ * *******************************************/
+#define LEN 12
+
+/* float <-> bf16, rounding to nearest even (finite values only) */
+static alm_bf16_t to_bf16(float f)
+{
+    unsigned int u;
+    memcpy(&u, &f, sizeof(u));
+    u += 0x7fff + ((u >> 16) & 1);
+    return (alm_bf16_t)(u >> 16);
+}
+
+static float from_bf16(alm_bf16_t h)
+{
+    unsigned int u = (unsigned int)h << 16;
+    float f;
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+void bf16_activations()
+{
+    printf("Using bfloat16 Arrays: amd_vrba_sigmoidbf16, amd_vrba_gelubf16, amd_vrba_tanhbf16\n");
+    alm_bf16_t in[LEN], sig[LEN], gelu[LEN], th[LEN];
+    for(int i=0; i<LEN; ++i)
+        in[i] = to_bf16(-3.0f + 0.5f * (float)i);
+
+    amd_vrba_sigmoidbf16(LEN, in, sig);
+    amd_vrba_gelubf16(LEN, in, gelu);
+    amd_vrba_tanhbf16(LEN, in, th);
+
+    for(int i=0; i<LEN; i+=3)
+        printf("x: %f sigmoid: %f gelu: %f tanh: %f\n", from_bf16(in[i]),
+               from_bf16(sig[i]), from_bf16(gelu[i]), from_bf16(th[i]));
+    printf("----------\n");
+}
+
+int use_bf16()
+{
+    printf("\n\n***** bfloat16 *****\n");
+    bf16_activations();
+    return 0;
+}
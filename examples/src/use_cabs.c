@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#define AMD_LIBM_VEC_EXPERIMENTAL
+
+#include <stdio.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+#include <complex.h>
+
+#define CN 5
+
+/**********************************************
+ *     Complex Scalar Variants
+ * *******************************************/
+void cabs_carg_single_precision()
+{
+    printf ("Using Complex Scalar single precision cabsf() and cargf()\n");
+    #if (defined (_WIN64) || defined (_WIN32))
+        fc32_t input = {-1.0, 1.0};
+    #else
+        fc32_t input = -1.0 + 1.0*I;
+    #endif
+
+    printf("Input: (%f +i %f)\tOutput: |x| %f arg %f\n",
+            crealf(input), cimagf(input),
+            amd_cabsf (input), amd_cargf (input));
+    printf("----------\n");
+}
+
+void cabs_carg_double_precision()
+{
+    printf ("Using Complex Scalar double precision cabs() and carg()\n");
+    #if (defined (_WIN64) || defined (_WIN32))
+        fc64_t input = {3.0, -4.0};
+    #else
+        fc64_t input = 3.0 - 4.0*I;
+    #endif
+
+    printf("Input: (%f +i %f)\tOutput: |x| %f arg %f\n",
+            creal(input), cimag(input),
+            amd_cabs (input), amd_carg (input));
+    printf("----------\n");
+}
+
+/**********************************************
+ *     Complex Vector Array Variants
+ * *******************************************/
+void cabs_carg_double_precision_array()
+{
+    printf("Using Complex Double Precision Vector Array (vrza) cabs() and carg()\n");
+    /* (real, imaginary) pairs in, one real result per element out */
+    double input[2 * CN] = {3.0, -4.0, -1.0, 0.0, -1.0, -0.0, 0.0, 2.0, 1e300, 1e300};
+    double mag[CN] = {0}, arg[CN] = {0};
+
+    amd_vrza_cabs(CN, input, mag);
+    amd_vrza_carg(CN, input, arg);
+
+    for (int i = 0; i < CN; ++i)
+        printf("Input: (%g +i %g)\tOutput: |x| %g arg %f\n",
+               input[2 * i], input[2 * i + 1], mag[i], arg[i]);
+    printf("----------\n");
+}
+
+void cabs_carg_single_precision_split_array()
+{
+    printf("Using Complex Single Precision Vector Array (vrca) cabsf_split() and cargf_split()\n");
+    float input_re[CN] = {-1.0, 0.0, 2.0, 1.0, 3.0};
+    float input_im[CN] = {1.0, 1.0, 0.25, -1.0, 4.0};
+    float mag[CN] = {0}, arg[CN] = {0};
+
+    amd_vrca_cabsf_split(CN, input_re, input_im, mag);
+    amd_vrca_cargf_split(CN, input_re, input_im, arg);
+
+    for (int i = 0; i < CN; ++i)
+        printf("Input: (%f +i %f)\tOutput: |x| %f arg %f\n",
+               input_re[i], input_im[i], mag[i], arg[i]);
+    printf("----------\n");
+}
+
+int use_cabs()
+{
+    printf("\n\n***** cabs() and carg() *****\n");
+    cabs_carg_single_precision();
+    cabs_carg_double_precision();
+    cabs_carg_double_precision_array();
+    cabs_carg_single_precision_split_array();
+    return 0;
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#define AMD_LIBM_VEC_EXPERIMENTAL
+
+#include <stdio.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Scalar Variants
+ * *******************************************/
+void cdfnorm_single_precision()
+{
+    printf ("Using Scalar single precision cdfnormf(), cdfnorminvf()\n");
+    float x = 1.5f;
+    float p = amd_cdfnormf(x);
+    printf("Input: %f\tcdfnormf: %f\tcdfnorminvf: %f\n", x, p, amd_cdfnorminvf(p));
+    printf("Input: %f\terfinvf: %f\terfcinvf: %f\n", 0.5f, amd_erfinvf(0.5f), amd_erfcinvf(0.5f));
+    printf("----------\n");
+}
+
+/**********************************************
+ *     Vector Variants
+ * *******************************************/
+void cdfnorminv_vector_single_precision_8()
+{
+    printf("Using Vector single precision - 8 floats (vrs8) cdfnorminvf()\n");
+    __m256 input, result;
+    float input_array_vrs8[8] = {1e-30f, 1e-6f, 0.025f, 0.25f, 0.5f, 0.75f, 0.975f, 0.999999f};
+    float output_array_vrs8[8];
+
+    input = _mm256_loadu_ps(input_array_vrs8);
+    result = amd_vrs8_cdfnorminvf(input);
+    _mm256_storeu_ps(output_array_vrs8, result);
+
+    for (int i = 0; i < 8; i++)
+        printf("p: %g\tx: %f\n", input_array_vrs8[i], output_array_vrs8[i]);
+    printf("----------\n");
+}
+
+/**********************************************
+ *     Vector Array Variants
+ * *******************************************/
+#define N 10
+/* Normal variates by inverse transform of uniform samples */
+void cdfnorminv_single_precision_array()
+{
+    printf("Using Single Precision Vector Array (vrsa) cdfnorminvf(), cdfnormf()\n");
+    float u[N], z[N], back[N];
+
+    for (int i = 0; i < N; i++)
+        u[i] = ((float)i + 0.5f) / N;
+
+    amd_vrsa_cdfnorminvf(N, u, z);
+    amd_vrsa_cdfnormf(N, z, back);
+
+    for (int i = 0; i < N; i++)
+        printf("u: %f\tz: %f\tcdfnormf(z): %f\n", u[i], z[i], back[i]);
+    printf("----------\n");
+}
+
+int use_cdfnorm()
+{
+    printf("\n\n***** cdfnorm() *****\n");
+    cdfnorm_single_precision();
+    cdfnorminv_vector_single_precision_8();
+    cdfnorminv_single_precision_array();
+    return 0;
+}
@@ -32,6 +32,8 @@
 #include "amdlibm_vec.h"
 #include <complex.h>
 
+#define CN 5
+
 /**********************************************
  *     Complex Scalar Variants
  * *******************************************/
@@ -69,10 +71,45 @@ void cexp_double_precision()
     printf("----------\n");
 }
 
+/**********************************************
+ *     Complex Vector Array Variants
+ * *******************************************/
+void cexp_double_precision_array()
+{
+    printf("Using Complex Double Precision Vector Array (vrza) cexp()\n");
+    /* (real, imaginary) pairs, the layout of a double complex array */
+    double input[2 * CN] = {1.9, 0.08, 0.0, 3.14159, -1.0, 0.5, 2.5, -1.2, 0.3, 0.0};
+    double output[2 * CN] = {0};
+
+    amd_vrza_cexp(CN, input, output);
+
+    for (int i = 0; i < CN; ++i)
+        printf("Input: (%f +i %f)\tOutput: (%f +i %f)\n",
+               input[2 * i], input[2 * i + 1], output[2 * i], output[2 * i + 1]);
+    printf("----------\n");
+}
+
+void cexp_single_precision_split_array()
+{
+    printf("Using Complex Single Precision Vector Array (vrca) cexpf_split()\n");
+    float input_re[CN] = {0.5, 0.0, -2.0, 1.0, 3.0};
+    float input_im[CN] = {2.1, 1.5708, 0.25, -1.0, 0.0};
+    float output_re[CN] = {0}, output_im[CN] = {0};
+
+    amd_vrca_cexpf_split(CN, input_re, input_im, output_re, output_im);
+
+    for (int i = 0; i < CN; ++i)
+        printf("Input: (%f +i %f)\tOutput: (%f +i %f)\n",
+               input_re[i], input_im[i], output_re[i], output_im[i]);
+    printf("----------\n");
+}
+
 int use_cexp()
 {
     printf("\n\n***** cexp() *****\n");
     cexp_single_precision();
     cexp_double_precision();
+    cexp_double_precision_array();
+    cexp_single_precision_split_array();
     return 0;
 }
@@ -32,6 +32,8 @@
 #include "amdlibm_vec.h"
 #include <complex.h>
 
+#define CN 5
+
 /**********************************************
  *     Complex Scalar Variants
  * *******************************************/
@@ -71,10 +73,48 @@ void cpow_double_precision()
     printf("----------\n");
 }
 
+/**********************************************
+ *     Complex Vector Array Variants
+ * *******************************************/
+void cpow_double_precision_array()
+{
+    printf("Using Complex Double Precision Vector Array (vrza) cpow()\n");
+    /* (real, imaginary) pairs, the layout of a double complex array */
+    double x[2 * CN] = {1.9, 0.08, 0.0, 1.0, -1.0, 0.0, 2.5, -1.2, 2.0, 0.0};
+    double y[2 * CN] = {2.0, 0.0, 0.0, 1.0, 0.5, 0.0, 1.5, 0.5, 0.5, 0.0};
+    double z[2 * CN] = {0};
+
+    amd_vrza_cpow(CN, x, y, z);
+
+    for (int i = 0; i < CN; ++i)
+        printf("Input: (%f +i %f) ^ (%f +i %f)\tOutput: (%f +i %f)\n",
+               x[2 * i], x[2 * i + 1], y[2 * i], y[2 * i + 1], z[2 * i], z[2 * i + 1]);
+    printf("----------\n");
+}
+
+void cpow_single_precision_split_array()
+{
+    printf("Using Complex Single Precision Vector Array (vrca) cpowf_split()\n");
+    float x_re[CN] = {0.5, 0.0, -2.0, 1.0, 3.0};
+    float x_im[CN] = {2.1, 1.0, 0.25, -1.0, 0.0};
+    float y_re[CN] = {2.0, 0.0, 0.5, 1.5, -1.0};
+    float y_im[CN] = {0.0, 1.0, 0.0, 0.5, 0.0};
+    float z_re[CN] = {0}, z_im[CN] = {0};
+
+    amd_vrca_cpowf_split(CN, x_re, x_im, y_re, y_im, z_re, z_im);
+
+    for (int i = 0; i < CN; ++i)
+        printf("Input: (%f +i %f) ^ (%f +i %f)\tOutput: (%f +i %f)\n",
+               x_re[i], x_im[i], y_re[i], y_im[i], z_re[i], z_im[i]);
+    printf("----------\n");
+}
+
 int use_cpow()
 {
     printf("\n\n***** cpow() *****\n");
     cpow_single_precision();
     cpow_double_precision();
+    cpow_double_precision_array();
+    cpow_single_precision_split_array();
     return 0;
 }
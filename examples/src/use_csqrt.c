@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#define AMD_LIBM_VEC_EXPERIMENTAL
+
+#include <stdio.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+#include <complex.h>
+
+#define CN 5
+
+/**********************************************
+ *     Complex Scalar Variants
+ * *******************************************/
+void csqrt_single_precision()
+{
+    printf ("Using Complex Scalar single precision csqrtf()\n");
+    #if (defined (_WIN64) || defined (_WIN32))
+        fc32_t input = {-4.0, 0.5}, output;
+    #else
+        fc32_t input = -4.0 + 0.5*I, output;
+    #endif
+
+    output = amd_csqrtf (input);
+
+    printf("Input: (%f +i %f)\tOutput: (%f +i %f)\n",
+            crealf(input), cimagf(input),
+            crealf(output), cimagf(output));
+    printf("----------\n");
+}
+
+void csqrt_double_precision()
+{
+    printf ("Using Complex Scalar double precision csqrt()\n");
+    #if (defined (_WIN64) || defined (_WIN32))
+        fc64_t input = {3.0, 4.0}, output;
+    #else
+        fc64_t input = 3.0 + 4.0*I, output;
+    #endif
+
+    output = amd_csqrt (input);
+
+    printf("Input: (%f +i %f)\tOutput: (%f +i %f)\n",
+            creal(input), cimag(input),
+            creal(output), cimag(output));
+    printf("----------\n");
+}
+
+/**********************************************
+ *     Complex Vector Array Variants
+ * *******************************************/
+void csqrt_double_precision_array()
+{
+    printf("Using Complex Double Precision Vector Array (vrza) csqrt()\n");
+    /* (real, imaginary) pairs, the layout of a double complex array */
+    double input[2 * CN] = {3.0, 4.0, -4.0, 0.0, -4.0, -0.0, 0.0, 2.0, 1e-3, 1e3};
+    double output[2 * CN] = {0};
+
+    amd_vrza_csqrt(CN, input, output);
+
+    for (int i = 0; i < CN; ++i)
+        printf("Input: (%f +i %f)\tOutput: (%f +i %f)\n",
+               input[2 * i], input[2 * i + 1], output[2 * i], output[2 * i + 1]);
+    printf("----------\n");
+}
+
+void csqrt_single_precision_split_array()
+{
+    printf("Using Complex Single Precision Vector Array (vrca) csqrtf_split()\n");
+    float input_re[CN] = {-4.0, 0.0, 2.0, 1.0, 9.0};
+    float input_im[CN] = {0.5, 1.0, 0.25, -1.0, 0.0};
+    float output_re[CN] = {0}, output_im[CN] = {0};
+
+    amd_vrca_csqrtf_split(CN, input_re, input_im, output_re, output_im);
+
+    for (int i = 0; i < CN; ++i)
+        printf("Input: (%f +i %f)\tOutput: (%f +i %f)\n",
+               input_re[i], input_im[i], output_re[i], output_im[i]);
+    printf("----------\n");
+}
+
+int use_csqrt()
+{
+    printf("\n\n***** csqrt() *****\n");
+    csqrt_single_precision();
+    csqrt_double_precision();
+    csqrt_double_precision_array();
+    csqrt_single_precision_split_array();
+    return 0;
+}
@@ -0,0 +1,135 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#define AMD_LIBM_VEC_EXPERIMENTAL
+
+#include <stdio.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+#include <complex.h>
+
+#define CN 5
+
+typedef fc64_t (*cfunc_t)(fc64_t);
+typedef fc32_t (*cfuncf_t)(fc32_t);
+typedef void (*cfunc_array_t)(int, const double *, double *);
+typedef void (*cfuncf_split_t)(int, const float *, const float *, float *, float *);
+
+static const char *names[] = {"csin", "ccos", "ctan", "csinh", "ccosh", "ctanh"};
+
+/**********************************************
+ *     Complex Scalar Variants
+ * *******************************************/
+void ctrig_single_precision()
+{
+    cfuncf_t funcs[] = {amd_csinf, amd_ccosf, amd_ctanf,
+                        amd_csinhf, amd_ccoshf, amd_ctanhf};
+    #if (defined (_WIN64) || defined (_WIN32))
+        fc32_t input = {0.5, 1.5}, output;
+    #else
+        fc32_t input = 0.5 + 1.5*I, output;
+    #endif
+
+    for (int f = 0; f < 6; ++f) {
+        printf ("Using Complex Scalar single precision %sf()\n", names[f]);
+        output = funcs[f] (input);
+        printf("Input: (%f +i %f)\tOutput: (%f +i %f)\n",
+                crealf(input), cimagf(input),
+                crealf(output), cimagf(output));
+    }
+    printf("----------\n");
+}
+
+void ctrig_double_precision()
+{
+    cfunc_t funcs[] = {amd_csin, amd_ccos, amd_ctan,
+                       amd_csinh, amd_ccosh, amd_ctanh};
+    #if (defined (_WIN64) || defined (_WIN32))
+        fc64_t input = {-1.2, 0.3}, output;
+    #else
+        fc64_t input = -1.2 + 0.3*I, output;
+    #endif
+
+    for (int f = 0; f < 6; ++f) {
+        printf ("Using Complex Scalar double precision %s()\n", names[f]);
+        output = funcs[f] (input);
+        printf("Input: (%f +i %f)\tOutput: (%f +i %f)\n",
+                creal(input), cimag(input),
+                creal(output), cimag(output));
+    }
+    printf("----------\n");
+}
+
+/**********************************************
+ *     Complex Vector Array Variants
+ * *******************************************/
+void ctrig_double_precision_array()
+{
+    cfunc_array_t funcs[] = {amd_vrza_csin, amd_vrza_ccos, amd_vrza_ctan,
+                             amd_vrza_csinh, amd_vrza_ccosh, amd_vrza_ctanh};
+    /* (real, imaginary) pairs, the layout of a double complex array */
+    double input[2 * CN] = {-1.2, 0.3, 0.0, 1.0, 2.5, -0.5, 0.0, 0.0, 30.0, 2.0};
+    double output[2 * CN] = {0};
+
+    for (int f = 0; f < 6; ++f) {
+        printf("Using Complex Double Precision Vector Array (vrza) %s()\n", names[f]);
+        funcs[f](CN, input, output);
+        for (int i = 0; i < CN; ++i)
+            printf("Input: (%f +i %f)\tOutput: (%g +i %g)\n",
+                   input[2 * i], input[2 * i + 1], output[2 * i], output[2 * i + 1]);
+    }
+    printf("----------\n");
+}
+
+void ctrig_single_precision_split_array()
+{
+    cfuncf_split_t funcs[] = {amd_vrca_csinf_split, amd_vrca_ccosf_split,
+                              amd_vrca_ctanf_split, amd_vrca_csinhf_split,
+                              amd_vrca_ccoshf_split, amd_vrca_ctanhf_split};
+    float input_re[CN] = {0.5, 0.0, -2.0, 1.0, 3.0};
+    float input_im[CN] = {1.5, 1.0, 0.25, -1.0, 0.0};
+    float output_re[CN] = {0}, output_im[CN] = {0};
+
+    for (int f = 0; f < 6; ++f) {
+        printf("Using Complex Single Precision Vector Array (vrca) %sf_split()\n", names[f]);
+        funcs[f](CN, input_re, input_im, output_re, output_im);
+        for (int i = 0; i < CN; ++i)
+            printf("Input: (%f +i %f)\tOutput: (%f +i %f)\n",
+                   input_re[i], input_im[i], output_re[i], output_im[i]);
+    }
+    printf("----------\n");
+}
+
+int use_ctrig()
+{
+    printf("\n\n***** csin(), ccos(), ctan(), csinh(), ccosh(), ctanh() *****\n");
+    ctrig_single_precision();
+    ctrig_double_precision();
+    ctrig_double_precision_array();
+    ctrig_single_precision_split_array();
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Fused Expressions
+ * *******************************************/
+#define N 6
+void expr_double_precision_array()
+{
+    printf("Using Double Precision Fused Expression: 3 * exp(0.5 * x + 1)\n");
+    double input[N] = {-2.0, -1.0, 0.0, 0.5, 1.0, 2.0};
+    double output[N] = {0};
+    const double *args[1] = {input};
+    alm_expr_t expr;
+
+    alm_expr_init(&expr);
+    alm_expr_arg(&expr, 0);
+    alm_expr_affine(&expr, 0.5, 1.0);
+    alm_expr_op(&expr, ALM_EXPR_EXP);
+    alm_expr_affine(&expr, 3.0, 0.0);
+    if (alm_expr_compile(&expr) != 0)
+    {
+        printf("Invalid expression\n");
+        return;
+    }
+
+    alm_expr_execute(&expr, N, args, output);
+
+    printf("Input: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", input[i]);
+    }
+    printf("}, Output: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", output[i]);
+    }
+    printf("}\n");
+    printf("----------\n");
+}
+
+void expr_single_precision_array()
+{
+    printf("Using Single Precision Fused Expression: sin(x) * cos(y)\n");
+    float x[N] = {0.0f, 0.5f, 1.0f, 1.5f, 2.0f, 2.5f};
+    float y[N] = {0.0f, -0.5f, 1.0f, -1.5f, 2.0f, -2.5f};
+    float output[N] = {0};
+    const float *args[2] = {x, y};
+    alm_expr_t expr;
+
+    alm_expr_init(&expr);
+    alm_expr_arg(&expr, 0);
+    alm_expr_op(&expr, ALM_EXPR_SIN);
+    alm_expr_arg(&expr, 1);
+    alm_expr_op(&expr, ALM_EXPR_COS);
+    alm_expr_op(&expr, ALM_EXPR_MUL);
+    if (alm_expr_compile(&expr) != 0)
+    {
+        printf("Invalid expression\n");
+        return;
+    }
+
+    alm_expr_executef(&expr, N, args, output);
+
+    printf("Input x: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", x[i]);
+    }
+    printf("}, Input y: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", y[i]);
+    }
+    printf("}, Output: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", output[i]);
+    }
+    printf("}\n");
+    printf("----------\n");
+}
+
+int use_expr()
+{
+    printf("\n\n***** fused expressions *****\n");
+    expr_double_precision_array();
+    expr_single_precision_array();
+    return 0;
+}
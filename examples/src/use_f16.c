@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <immintrin.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Half precision (FP16)
+ * *******************************************/
+#define LEN 16
+
+void half_precision_scalar()
+{
+    printf("Using Half Precision Scalar: amd_expf16, amd_sinf16\n");
+    float input = 0.75f;
+    alm_f16_t x = _cvtss_sh(input, 0);
+
+    printf("Input: %f\n", input);
+    printf("expf16: %f, sinf16: %f\n",
+           _cvtsh_ss(amd_expf16(x)), _cvtsh_ss(amd_sinf16(x)));
+    printf("----------\n");
+}
+
+void half_precision_vector()
+{
+    printf("Using Half Precision Vector: amd_vrh8_tanhf16\n");
+    alm_f16_t in[8], out[8];
+    for(int i=0; i<8; ++i)
+        in[i] = _cvtss_sh(-2.0f + 0.5f * (float)i, 0);
+
+    __m128i result = amd_vrh8_tanhf16(_mm_loadu_si128((const __m128i *)in));
+    _mm_storeu_si128((__m128i *)out, result);
+
+    for(int i=0; i<8; ++i)
+        printf("tanhf16(%f) = %f\n", _cvtsh_ss(in[i]), _cvtsh_ss(out[i]));
+    printf("----------\n");
+}
+
+void half_precision_array()
+{
+    printf("Using Half Precision Array: amd_vrha_logf16, amd_vrha_erff16\n");
+    alm_f16_t in[LEN], logs[LEN], erfs[LEN];
+    for(int i=0; i<LEN; ++i)
+        in[i] = _cvtss_sh(0.25f * (float)(i + 1), 0);
+
+    amd_vrha_logf16(LEN, in, logs);
+    amd_vrha_erff16(LEN, in, erfs);
+
+    for(int i=0; i<LEN; i+=5)
+        printf("x: %f log: %f erf: %f\n",
+               _cvtsh_ss(in[i]), _cvtsh_ss(logs[i]), _cvtsh_ss(erfs[i]));
+    printf("----------\n");
+}
+
+int use_f16()
+{
+    printf("\n\n***** half precision *****\n");
+    half_precision_scalar();
+    half_precision_vector();
+    half_precision_array();
+    return 0;
+}
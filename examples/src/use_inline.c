@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+
+#include <stdio.h>
+#include <math.h>
+#include "amdlibm_inline.h"
+
+/**********************************************
+ *     Header-only Inline Kernels
+ * *******************************************/
+#define LEN 1000
+
+#if defined(__AVX2__) && defined(__FMA__)
+/* y = a * exp(-x*x) + log(x), the kernels inlined into the loop */
+void inline_kernels()
+{
+    printf("Using Header-only Kernels: amd_inl_vrd4_exp, amd_inl_vrd4_log\n");
+    double x[LEN], y[LEN];
+    const __m256d a = _mm256_set1_pd(0.5);
+    int i;
+    for(i=0; i<LEN; ++i)
+    {
+        x[i] = 0.01 + 4.0 * (double)i / LEN;
+    }
+    for(i=0; i+4<=LEN; i+=4)
+    {
+        __m256d v = _mm256_loadu_pd(x + i);
+        __m256d e = amd_inl_vrd4_exp(_mm256_mul_pd(v, _mm256_sub_pd(_mm256_setzero_pd(), v)));
+        _mm256_storeu_pd(y + i, _mm256_fmadd_pd(a, e, amd_inl_vrd4_log(v)));
+    }
+    for(; i<LEN; ++i)
+    {
+        y[i] = 0.5 * exp(-x[i] * x[i]) + log(x[i]);
+    }
+    printf("Input: %f, Output: %f, libm: %f\n", x[100], y[100],
+           0.5 * exp(-x[100] * x[100]) + log(x[100]));
+    printf("----------\n");
+}
+#endif
+
+int use_inline()
+{
+    printf("\n\n***** header-only inline kernels *****\n");
+#if defined(__AVX2__) && defined(__FMA__)
+    inline_kernels();
+#else
+    printf("needs AVX2 and FMA\n");
+#endif
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Indexed and Masked Array Variants
+ * *******************************************/
+#define N 8
+void exp_double_precision_array_indexed()
+{
+    printf("Using Double Precision Indexed Array (vrda) exp_idx()\n");
+    double input[N] = {0.0, 1.0, -1.0, 2.0, 0.5, -0.5, 3.0, -3.0};
+    double output[N] = {0};
+    size_t idx[3] = {1, 4, 6};
+
+    amd_vrda_exp_idx(3, idx, input, output);
+
+    printf("Indices: {%zu, %zu, %zu}\n", idx[0], idx[1], idx[2]);
+    printf("Input: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", input[i]);
+    }
+    printf("}, Output: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", output[i]);
+    }
+    printf("}\n");
+    printf("----------\n");
+}
+
+void log_single_precision_array_masked()
+{
+    printf("Using Single Precision Masked Array (vrsa) logf_mask()\n");
+    /* Only the valid (positive) entries are selected */
+    float input[N] = {1.0f, -1.0f, 2.0f, 0.0f, 10.0f, -5.0f, 0.5f, 100.0f};
+    unsigned char mask[N];
+    float output[N] = {0};
+
+    for(int i=0; i<N; ++i)
+    {
+        mask[i] = input[i] > 0.0f;
+    }
+
+    amd_vrsa_logf_mask(N, mask, input, output);
+
+    printf("Input: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", input[i]);
+    }
+    printf("}, Mask: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%d, ", mask[i]);
+    }
+    printf("}, Output: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", output[i]);
+    }
+    printf("}\n");
+    printf("----------\n");
+}
+
+int use_masked()
+{
+    printf("\n\n***** indexed and masked array variants *****\n");
+    exp_double_precision_array_indexed();
+    log_single_precision_array_masked();
+    return 0;
+}
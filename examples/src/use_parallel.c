@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Parallel Execution
+ * *******************************************/
+#define LEN (1 << 20)
+
+/* A caller supplied executor: runs every task in order and counts them */
+static void counting_executor(void *ctx, size_t ntasks, alm_task_t task, void *arg)
+{
+    size_t *count = ctx;
+    for(size_t i=0; i<ntasks; ++i)
+    {
+        task(arg, i);
+    }
+    *count += ntasks;
+}
+
+void parallel_double_precision_array()
+{
+    printf("Using Double Precision Parallel Array Function: amd_vrda_expi_64\n");
+    double *input = malloc(LEN * sizeof(double));
+    double *output = malloc(LEN * sizeof(double));
+    if (input == NULL || output == NULL)
+    {
+        free(input);
+        free(output);
+        return;
+    }
+    for(size_t i=0; i<LEN; ++i)
+    {
+        input[i] = -8.0 + 16.0 * (double)i / LEN;
+    }
+
+    alm_set_num_threads(0);
+    alm_set_grain_size(1 << 16);
+    amd_vrda_expi_64(LEN, input, 1, output, 1);
+    printf("Threads: %d, Grain: %zu, Output[0]: %f, Output[LEN-1]: %f\n",
+           alm_get_num_threads(), alm_get_grain_size(), output[0], output[LEN-1]);
+
+    size_t ntasks = 0;
+    alm_set_num_threads(4);
+    alm_set_executor(counting_executor, &ntasks);
+    amd_vrda_expi_64(LEN, input, 1, output, 1);
+    printf("Caller executor ran %zu tasks, Output[LEN/2]: %f\n", ntasks, output[LEN/2]);
+
+    /* back to the defaults: built-in pool, single thread */
+    alm_set_executor(NULL, NULL);
+    alm_set_num_threads(1);
+    free(input);
+    free(output);
+    printf("----------\n");
+}
+
+int use_parallel()
+{
+    printf("\n\n***** parallel execution *****\n");
+    parallel_double_precision_array();
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#define AMD_LIBM_VEC_EXPERIMENTAL
+
+#include <stdio.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Vector Array Variants
+ * *******************************************/
+#define N 8
+void powi_single_precision_array()
+{
+    printf("Using Single Precision Vector Array (vrsa) powif()\n");
+    float input[N] = {-2.0f, -1.5f, -0.5f, 0.0f, 0.5f, 1.5f, 2.0f, 10.0f};
+    float output[N];
+
+    amd_vrsa_powif(N, input, 3, output);
+
+    for (int i = 0; i < N; i++)
+        printf("x: %f\tx^3: %f\n", input[i], output[i]);
+    printf("----------\n");
+}
+
+/* Integral and half-integral exponents take the same path in powx() */
+void powi_double_precision_array()
+{
+    printf("Using Double Precision Vector Array (vrda) powi(), powx()\n");
+    double input[N] = {0.25, 0.5, 1.0, 2.0, 3.0, 4.0, 9.0, 16.0};
+    double inv[N], cube[N], root[N];
+
+    amd_vrda_powi(N, input, -1, inv);
+    amd_vrda_powi(N, input, 3, cube);
+    amd_vrda_powx(N, input, 0.5, root);
+
+    for (int i = 0; i < N; i++)
+        printf("x: %f\tx^-1: %f\tx^3: %f\tx^0.5: %f\n", input[i], inv[i], cube[i], root[i]);
+    printf("----------\n");
+}
+
+int use_powi()
+{
+    printf("\n\n***** powi() *****\n");
+    powi_single_precision_array();
+    powi_double_precision_array();
+    return 0;
+}
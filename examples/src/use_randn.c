@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include "amdlibm_vec.h"
+
+#define N 8
+#define LEN 100000
+
+/* The same 8 variates, in one call and in two parts with matching offsets */
+void randn_double_precision_parts()
+{
+    printf("Using alm_randn() with stream offsets\n");
+    double whole[N], parts[N];
+
+    alm_randn(ALM_RANDN_BOX_MULLER, 2026, 0, N, whole);
+    alm_randn(ALM_RANDN_BOX_MULLER, 2026, 0, 3, parts);
+    alm_randn(ALM_RANDN_BOX_MULLER, 2026, 3, N - 3, parts + 3);
+
+    for (int i = 0; i < N; i++)
+        printf("z[%d]: %f\t%f\n", i, whole[i], parts[i]);
+    printf("----------\n");
+}
+
+void randn_single_precision_moments()
+{
+    printf("Using alm_randnf() inverse CDF\n");
+    static float z[LEN];
+    double sum = 0, sumsq = 0;
+
+    alm_randnf(ALM_RANDN_ICDF, 42, 0, LEN, z);
+
+    for (int i = 0; i < LEN; i++) {
+        sum += z[i];
+        sumsq += (double)z[i] * z[i];
+    }
+    printf("mean: %f\tvariance: %f\n", sum / LEN, sumsq / LEN - (sum / LEN) * (sum / LEN));
+    printf("----------\n");
+}
+
+int use_randn()
+{
+    printf("\n\n***** randn() *****\n");
+    randn_double_precision_parts();
+    randn_single_precision_moments();
+    return 0;
+}
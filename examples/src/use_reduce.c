@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Reductions
+ * *******************************************/
+#define LEN 1000
+
+void reduce_single_precision_array()
+{
+    printf("Using Single Precision Reductions: amd_vrsa_logsumexpf, amd_vrsa_sumlogf\n");
+    float logits[LEN], prob[LEN];
+    for(int i=0; i<LEN; ++i)
+    {
+        logits[i] = 50.0f * sinf((float)i);
+        prob[i] = 0.25f + 0.5f * (float)i / LEN;
+    }
+
+    /* softmax normaliser, shifted by the largest logit so it cannot overflow */
+    float lse = amd_vrsa_logsumexpf(LEN, logits);
+    printf("logsumexp: %f, softmax[0]: %e\n", lse, expf(logits[0] - lse));
+    printf("sum of logs: %f\n", amd_vrsa_sumlogf(LEN, prob));
+    printf("----------\n");
+}
+
+void reduce_double_precision_array()
+{
+    printf("Using Double Precision Reductions: amd_vrda_sumexp, amd_vrda_sumlog\n");
+    double input[LEN];
+    for(int i=0; i<LEN; ++i)
+    {
+        input[i] = 1.0 + (double)i / LEN;
+    }
+
+    printf("sum of exps: %lf\n", amd_vrda_sumexp(LEN, input));
+    printf("sum of logs: %lf\n", amd_vrda_sumlog(LEN, input));
+    printf("----------\n");
+}
+
+int use_reduce()
+{
+    printf("\n\n***** reductions *****\n");
+    reduce_single_precision_array();
+    reduce_double_precision_array();
+    return 0;
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#define AMD_LIBM_VEC_EXPERIMENTAL
+
+#include <stdio.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Vector Array Variants
+ * *******************************************/
+#define N 4
+/* Normalise N 3-vectors using their squared lengths */
+void rsqrt_single_precision_array()
+{
+    printf("Using Single Precision Vector Array (vrsa) rsqrtf(), rsqrt_fastf()\n");
+    float v[3 * N] = {3.0f, 4.0f, 0.0f,  1.0f, 1.0f, 1.0f,
+                      0.0f, 0.0f, 2.0f,  1.0f, 2.0f, 2.0f};
+    float len2[N], inv[N], inv_fast[N];
+
+    for (int i = 0; i < N; i++)
+        len2[i] = v[3*i] * v[3*i] + v[3*i + 1] * v[3*i + 1] + v[3*i + 2] * v[3*i + 2];
+
+    amd_vrsa_rsqrtf(N, len2, inv);
+    amd_vrsa_rsqrt_fastf(N, len2, inv_fast);
+
+    for (int i = 0; i < N; i++)
+        printf("|v|^2: %f\t1/|v|: %.9g\tfast: %.9g\tunit: (%f, %f, %f)\n", len2[i],
+               inv[i], inv_fast[i], v[3*i] * inv_fast[i], v[3*i + 1] * inv_fast[i],
+               v[3*i + 2] * inv_fast[i]);
+    printf("----------\n");
+}
+
+void rsqrt_double_precision_array()
+{
+    printf("Using Double Precision Vector Array (vrda) rsqrt(), rsqrt_fast(), rsqrt_cr()\n");
+    double input[N] = {0.5, 2.0, 3.0, 1e-300};
+    double def[N], fast[N], cr[N];
+
+    amd_vrda_rsqrt(N, input, def);
+    amd_vrda_rsqrt_fast(N, input, fast);
+    amd_vrda_rsqrt_cr(N, input, cr);
+
+    for (int i = 0; i < N; i++)
+        printf("x: %g\trsqrt: %.17g\tfast: %.17g\tcr: %.17g\n", input[i], def[i], fast[i], cr[i]);
+    printf("----------\n");
+}
+
+void recip_array()
+{
+    printf("Using Vector Array (vrsa, vrda) recipf(), recip_fast()\n");
+    float  inputf[N] = {3.0f, -0.5f, 7.0f, 0.0f};
+    double input[N]  = {3.0, -0.5, 7.0, 1e300};
+    float  outputf[N];
+    double output[N];
+
+    amd_vrsa_recipf(N, inputf, outputf);
+    amd_vrda_recip_fast(N, input, output);
+
+    for (int i = 0; i < N; i++)
+        printf("x: %g\t1/x: %.9g\tx: %g\t1/x: %.17g\n", inputf[i], outputf[i], input[i], output[i]);
+    printf("----------\n");
+}
+
+int use_rsqrt()
+{
+    printf("\n\n***** rsqrt(), recip() *****\n");
+    rsqrt_single_precision_array();
+    rsqrt_double_precision_array();
+    recip_array();
+    return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "amdlibm_simd.h"
+
+/**********************************************
+ *     Compiler Auto-vectorization
+ * *******************************************/
+#define LEN 1000
+
+/*
+ * y = exp(x) * pow(x, 1.5); with -O3 -fno-math-errno the compiler calls
+ * the _ZGV vector variants of amd_exp and amd_pow instead
+ */
+void simd_loop()
+{
+    printf("Using amdlibm_simd.h: amd_exp, amd_pow in a vectorizable loop\n");
+    double x[LEN], y[LEN];
+    int i;
+    for(i=0; i<LEN; ++i)
+    {
+        x[i] = 0.01 + 4.0 * (double)i / LEN;
+    }
+    for(i=0; i<LEN; ++i)
+    {
+        y[i] = amd_exp(x[i]) * amd_pow(x[i], 1.5);
+    }
+    printf("Input: %f, Output: %f, libm: %f\n", x[100], y[100],
+           exp(x[100]) * pow(x[100], 1.5));
+    printf("----------\n");
+}
+
+int use_simd()
+{
+    printf("\n\n***** compiler auto-vectorization *****\n");
+    simd_loop();
+    return 0;
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Call Statistics
+ * *******************************************/
+#define LEN 1024
+#define ROWS 16
+
+void stats_counters()
+{
+    printf("Using Call Statistics: alm_stats_get, alm_stats_reset\n");
+    double x[LEN], y[LEN];
+    alm_stats_t st[ROWS];
+    int i, n;
+    for(i=0; i<LEN; ++i)
+    {
+        x[i] = (i % 128 == 0) ? 1.0e300 : (double)i / LEN;
+    }
+    alm_stats_reset();
+    amd_vrda_exp(LEN, x, y);
+    for(i=0; i<LEN; ++i)
+    {
+        y[i] = amd_sin(x[i]);
+    }
+    n = alm_stats_get(st, ROWS);
+    if(n < 0)
+    {
+        printf("libalm built without call statistics (LIBM_ENABLE_STATS)\n");
+    }
+    for(i=0; i<n && i<ROWS; ++i)
+    {
+        printf("%s: calls %llu, elements %llu, special %llu, reductions %llu, errors %llu\n",
+               st[i].name, (unsigned long long)st[i].calls,
+               (unsigned long long)st[i].elements,
+               (unsigned long long)st[i].special,
+               (unsigned long long)st[i].reductions,
+               (unsigned long long)st[i].errors);
+    }
+    printf("----------\n");
+}
+
+int use_stats()
+{
+    printf("\n\n***** call statistics *****\n");
+    stats_counters();
+    return 0;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include "amdlibm.h"
+#include "amdlibm_vec.h"
+
+/**********************************************
+ *     Strided Array Variants (64-bit length)
+ * *******************************************/
+#define N 5
+void exp_double_precision_array_strided()
+{
+    printf("Using Double Precision Strided Array (vrda) expi_64()\n");
+    /* Interleaved {re, im} pairs, only the real parts are transformed */
+    double data[2 * N] = {0.0, 1.0, 0.5, 2.0, -1.0, 3.0, 2.0, 4.0, -3.5, 5.0};
+    size_t n = N, inc = 2;
+
+    printf("Number of elements: %zu, stride: %zu\n", n, inc);
+    printf("Input: {");
+    for(size_t i=0; i<n; ++i)
+    {
+        printf("%f, ", data[i*inc]);
+    }
+
+    /* in-place: source and destination share the stride */
+    amd_vrda_expi_64(n, data, inc, data, inc);
+
+    printf("}, Output: {");
+    for(size_t i=0; i<n; ++i)
+    {
+        printf("%f, ", data[i*inc]);
+    }
+    printf("}\n");
+    printf("----------\n");
+}
+
+void add_single_precision_array_strided()
+{
+    printf("Using Single Precision Strided Array (vrsa) addfi_64()\n");
+    /* Sums the first channel of an RGB array with a unit stride array */
+    float rgb[3 * N] = {1.0f, 0.1f, 0.2f, 2.0f, 0.3f, 0.4f, 3.0f, 0.5f, 0.6f,
+                        4.0f, 0.7f, 0.8f, 5.0f, 0.9f, 1.0f};
+    float bias[N] = {0.5f, 0.5f, -0.5f, -0.5f, 1.0f};
+    float output[N] = {0};
+
+    amd_vrsa_addfi_64(N, rgb, 3, bias, 1, output, 1);
+
+    printf("Input: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", rgb[i*3]);
+    }
+    printf("}, Input2: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", bias[i]);
+    }
+    printf("}, Output: {");
+    for(int i=0; i<N; ++i)
+    {
+        printf("%f, ", output[i]);
+    }
+    printf("}\n");
+    printf("----------\n");
+}
+
+int use_strided()
+{
+    printf("\n\n***** strided array variants *****\n");
+    exp_double_precision_array_strided();
+    add_single_precision_array_strided();
+    return 0;
+}
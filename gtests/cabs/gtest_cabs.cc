@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "almcomplex.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+
+/*
+ * The vrz4/vrz8 and vrc8/vrc16 vectors and the vrza/vrca arrays of cabs
+ * against the scalar amd_cabs()/amd_cabsf(): random operands over every
+ * binade, with magnitudes far apart and near the real axis, the special
+ * grid, which must match the scalar results bit for bit, and the agreement
+ * of the variants with each other over tails and offsets.
+ *
+ * The bounds are the documented vector error, 1 ulp in both precisions,
+ * plus 1 ulp for the scalar function itself.
+ */
+
+#define CABS_ULP_BOUND   2.0
+#define CABSF_ULP_BOUND  2.0
+#define CABS_NPOINTS     4000
+
+extern "C" {
+CPX_DECLARE_R(double, vrza, cabs);
+CPX_DECLARE_R(float, vrca, cabsf);
+}
+
+static const CpxKernel<double> cabs_kernel = {
+  "cabs", CPX_REAL, CpxScalarR<double>(amd_cabs),
+  {
+    CPX_VARIANTS_256(double, R, vrza, vrz4, cabs),
+#if defined(__AVX512__)
+    CPX_VARIANTS_512(double, R, vrza, vrz8, cabs),
+#endif
+  },
+  CABS_ULP_BOUND, nullptr,
+};
+
+static const CpxKernel<float> cabsf_kernel = {
+  "cabsf", CPX_REAL, CpxScalarR<float>(amd_cabsf),
+  {
+    CPX_VARIANTS_256(float, R, vrca, vrc8, cabsf),
+#if defined(__AVX512__)
+    CPX_VARIANTS_512(float, R, vrca, vrc16, cabsf),
+#endif
+  },
+  CABSF_ULP_BOUND, nullptr,
+};
+
+static const CpxRegion cabs_regions[] = {
+  { CPX_BOX,  -10.0, 10.0, -10.0, 10.0 },
+  { CPX_LOG,  -1074.0, 1023.0, -1074.0, 1023.0 },   /* every binade */
+  { CPX_LOG,  -60.0, 0.0, -60.0, 0.0 },
+  { CPX_LOG,  -60.0, 0.0, -1074.0, 1023.0 },   /* far apart magnitudes */
+  { CPX_BOX,  -1.0e3, 1.0e3, -1.0e-3, 1.0e-3 },   /* near the real axis */
+};
+
+static const CpxRegion cabsf_regions[] = {
+  { CPX_BOX,  -10.0, 10.0, -10.0, 10.0 },
+  { CPX_LOG,  -149.0, 127.0, -149.0, 127.0 },   /* every binade */
+  { CPX_LOG,  -30.0, 0.0, -30.0, 0.0 },
+  { CPX_LOG,  -30.0, 0.0, -149.0, 127.0 },   /* far apart magnitudes */
+  { CPX_BOX,  -1.0e3, 1.0e3, -1.0e-3, 1.0e-3 },   /* near the real axis */
+};
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_SCALAR) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<double> x = CpxInputs<double>(cabs_regions, ARRAY_SIZE(cabs_regions), CABS_NPOINTS, 1);
+
+  CpxAgainstScalar(cabs_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT_ULP("Scalar", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<double> x;
+
+  CpxSpecialGrid(x);
+  CpxAgainstScalar(cabs_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT("Specials", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_VARIANTS) {
+  int ntests = 0, nfail = 0;
+  std::vector<double> x = CpxInputs<double>(cabs_regions, ARRAY_SIZE(cabs_regions), CABS_NPOINTS, 1);
+
+  CpxSpecialGrid(x);
+  CpxVariants(cabs_kernel, x, x, vflag, &ntests, &nfail);
+  CPX_REPORT("Variants", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_SCALAR) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<float> x = CpxInputs<float>(cabsf_regions, ARRAY_SIZE(cabsf_regions), CABS_NPOINTS, 1);
+
+  CpxAgainstScalar(cabsf_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT_ULP("Scalar", "vrca/vrc");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<float> x;
+
+  CpxSpecialGrid(x);
+  CpxAgainstScalar(cabsf_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT("Specials", "vrca/vrc");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_VARIANTS) {
+  int ntests = 0, nfail = 0;
+  std::vector<float> x = CpxInputs<float>(cabsf_regions, ARRAY_SIZE(cabsf_regions), CABS_NPOINTS, 1);
+
+  CpxSpecialGrid(x);
+  CpxVariants(cabsf_kernel, x, x, vflag, &ntests, &nfail);
+  CPX_REPORT("Variants", "vrca/vrc");
+}
@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __TEST_CCOS_DATA_H__
+#define __TEST_CCOS_DATA_H__
+
+extern "C"
+{
+    #if defined(_WIN64) || defined(_WIN32)
+        #include "complex.h"
+    #else
+        #include "/usr/include/complex.h"
+    #endif
+}
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <external/amdlibm.h>
+
+//Helper functions to convert hex bit patterns to float/double values at compile time
+//These changes ensure that test data containing special values (infinity, NaN, π)
+//works correctly in complex arithmetic expressions by converting hex bit patterns
+//to actual floating/double-point values before they're used in calculations.
+
+static inline float bits_to_float(uint32_t bits) {
+    union { uint32_t u; float f; } conv;
+    conv.u = bits;
+    return conv.f;
+}
+
+static inline double bits_to_double(uint64_t bits) {
+    union { uint64_t u; double d; } conv;
+    conv.u = bits;
+    return conv.d;
+}
+
+// Redefine special constants as actual float/double values for use in complex expressions
+#undef POS_INF_F32
+#undef NEG_INF_F32
+#undef POS_QNAN_F32
+#undef NEG_QNAN_F32
+#undef POS_PI_F32
+#undef NEG_PI_F32
+
+#define POS_INF_F32    (bits_to_float(0x7F800000))
+#define NEG_INF_F32    (bits_to_float(0xFF800000))
+#define POS_QNAN_F32   (bits_to_float(0x7fc00000 ))
+#define NEG_QNAN_F32   (bits_to_float(0xffc00000))
+#define POS_PI_F32     (bits_to_float(0x40490fd8))
+#define NEG_PI_F32     (bits_to_float(0xc0490fd8))
+
+#undef POS_INF_F64
+#undef NEG_INF_F64
+#undef POS_QNAN_F64
+#undef NEG_QNAN_F64
+#undef POS_PI_F64
+#undef NEG_PI_F64
+
+#define POS_INF_F64    (bits_to_double(0x7ff0000000000000ULL))
+#define NEG_INF_F64    (bits_to_double(0xfff0000000000000ULL))
+#define POS_QNAN_F64   (bits_to_double(0x7ff87ff7fdedffffULL))
+#define NEG_QNAN_F64   (bits_to_double(0xfff8000000000000ULL))
+#define POS_PI_F64     (bits_to_double(0x400921FB54442D18ULL))
+#define NEG_PI_F64     (bits_to_double(0xc00921fb54442d18ULL))
+/* Subnormal constants for F32 */
+#define POS_SUBNORM_MIN_F32  (bits_to_float(0x00000001))   /* ~1.4e-45, smallest positive subnormal */
+#define POS_SUBNORM_MAX_F32  (bits_to_float(0x007FFFFF))   /* ~1.17e-38, largest positive subnormal */
+#define NEG_SUBNORM_MIN_F32  (bits_to_float(0x80000001))   /* ~-1.4e-45, smallest negative subnormal */
+#define NEG_SUBNORM_MAX_F32  (bits_to_float(0x807FFFFF))   /* ~-1.17e-38, largest negative subnormal */
+
+/* Subnormal constants for F64 */
+#define POS_SUBNORM_MIN_F64  (bits_to_double(0x0000000000000001ULL))  /* ~4.9e-324, smallest positive subnormal */
+#define POS_SUBNORM_MAX_F64  (bits_to_double(0x000FFFFFFFFFFFFFULL))  /* ~2.2e-308, largest positive subnormal */
+#define NEG_SUBNORM_MIN_F64  (bits_to_double(0x8000000000000001ULL))  /* ~-4.9e-324, smallest negative subnormal */
+#define NEG_SUBNORM_MAX_F64  (bits_to_double(0x800FFFFFFFFFFFFFULL))  /* ~-2.2e-308, largest negative subnormal */
+
+
+
+/*
+ * Test cases to check the conformance for the ccosf() routine.
+ * These test cases are not exhaustive.
+ * The special values follow from ccosh(), C99 Annex G.6.2.4,
+ * as ccos(z) = ccosh(iz).
+ */
+
+static libm_test_complex_data_f32
+test_ccosf_conformance_data[] = {
+        /* Test inputs of -/+0 */
+        {{0.0, -0.0},                   {1.0f, 0.0},                   0},
+        {{0.0, 0.0},                    {1.0f, -0.0},                  0},
+        {{-0.0, -0.0},                  {1.0f, -0.0},                  0},
+        {{-0.0, 0.0},                   {1.0f, 0.0},                   0},
+
+        /* Test inputs of -/+inf and Quiet NAN */
+        {{POS_INF_F32, -0.0},           {POS_QNAN_F32, 0.0},           FE_INVALID},
+        {{NEG_INF_F32, 0.0},            {POS_QNAN_F32, 0.0},           FE_INVALID},
+        {{POS_INF_F32, -1.0f},          {POS_QNAN_F32, POS_QNAN_F32},  FE_INVALID},
+        {{NEG_INF_F32, 2.0f},           {POS_QNAN_F32, POS_QNAN_F32},  FE_INVALID},
+        {{POS_QNAN_F32, -0.0},          {POS_QNAN_F32, 0.0},           0},
+        {{POS_QNAN_F32, 0.0},           {POS_QNAN_F32, 0.0},           0},
+        {{POS_QNAN_F32, -1.0f},         {POS_QNAN_F32, POS_QNAN_F32},  0},
+        {{0.0, NEG_INF_F32},            {POS_INF_F32, 0.0},            0},
+        {{-0.0, POS_INF_F32},           {POS_INF_F32, 0.0},            0},
+        {{1.0f, NEG_INF_F32},           {POS_INF_F32, POS_INF_F32},    0},
+        {{2.0f, POS_INF_F32},           {NEG_INF_F32, NEG_INF_F32},    0},
+        {{-3.0f, NEG_INF_F32},          {NEG_INF_F32, NEG_INF_F32},    0},
+        {{-4.0f, POS_INF_F32},          {NEG_INF_F32, NEG_INF_F32},    0},
+        {{POS_INF_F32, NEG_INF_F32},    {POS_INF_F32, POS_QNAN_F32},   FE_INVALID},
+        {{POS_INF_F32, POS_INF_F32},    {POS_INF_F32, POS_QNAN_F32},   FE_INVALID},
+        {{POS_QNAN_F32, NEG_INF_F32},   {POS_INF_F32, POS_QNAN_F32},   0},
+        {{POS_QNAN_F32, POS_INF_F32},   {POS_INF_F32, POS_QNAN_F32},   0},
+        {{0.0, POS_QNAN_F32},           {POS_QNAN_F32, 0.0},           0},
+        {{-0.0, POS_QNAN_F32},          {POS_QNAN_F32, -0.0},          0},
+        {{1.0f, POS_QNAN_F32},          {POS_QNAN_F32, POS_QNAN_F32},  0},
+        {{POS_INF_F32, POS_QNAN_F32},   {POS_QNAN_F32, POS_QNAN_F32},  0},
+        {{POS_QNAN_F32, POS_QNAN_F32},  {POS_QNAN_F32, POS_QNAN_F32},  0},
+
+        /* Test inputs of some random values */
+        {{1.0f, -1.0f},                 {0.83373004f, 0.9888977f},     FE_INEXACT},
+        {{3.0f, 2.0f},                  {-3.7245455f, -0.5118226f},    FE_INEXACT},
+        {{-0.25f, -0.5f},               {1.0925708f, -0.12892105f},    FE_INEXACT},
+        {{0.0, -3.0f},                  {10.067662f, 0.0},             FE_INEXACT},
+        {{1.5f, -0.0},                  {0.0707372f, 0.0},             FE_INEXACT},
+        {{1e-5f, 1e-5f},                {1.0f, -9.9999994e-11f},       FE_INEXACT},
+        {{1e22f, -1.0f},                {1.0478464f, -0.8626935f},     FE_INEXACT},
+
+        /* Subnormal inputs */
+        {{POS_SUBNORM_MIN_F32, NEG_SUBNORM_MIN_F32}, {1.0f, 0.0},                   FE_INEXACT},
+        {{POS_SUBNORM_MAX_F32, -0.0},   {1.0f, 0.0},                   0},
+        {{0.0, POS_SUBNORM_MAX_F32},    {1.0f, -0.0},                  0},
+
+        /* Results near overflow and underflow */
+        {{0.5f, -89.2f},                {2.4061597e38f, 1.314491e38f}, FE_INEXACT},
+        {{-0.5f, 89.2f},                {2.4061597e38f, 1.314491e38f}, FE_INEXACT},
+        {{1.5f, -89.2f},                {1.9394756e37f, 2.734936e38f}, FE_INEXACT},
+        {{1.0f, -90.0f},                {3.2969337e38f, POS_INF_F32},  FE_OVERFLOW},
+        {{2.0f, 90.0f},                 {-2.5393348e38f, NEG_INF_F32}, FE_OVERFLOW},
+        {{1.0f, -60.0f},                {3.0851462e25f, 4.8048303e25f}, FE_INEXACT},
+        {{-2.0f, 60.0f},                {-2.3762139e25f, 5.192122e25f}, FE_INEXACT},
+        {{0.5f, -44.0f},                {5.6391703e18f, 3.0806928e18f}, FE_INEXACT},
+        {{1.0f, -0x1.fffffep+127f},     {POS_INF_F32, POS_INF_F32},    FE_OVERFLOW},
+};
+
+/*
+ * Test cases to check the conformance for the ccos() routine.
+ * These test cases are not exhaustive.
+ */
+
+static libm_test_complex_data_f64
+test_ccos_conformance_data[] = {
+        /* Test inputs of -/+0 */
+        {{0.0, -0.0},                   {1.0, 0.0},                    0},
+        {{0.0, 0.0},                    {1.0, -0.0},                   0},
+        {{-0.0, -0.0},                  {1.0, -0.0},                   0},
+        {{-0.0, 0.0},                   {1.0, 0.0},                    0},
+
+        /* Test inputs of -/+inf and Quiet NAN */
+        {{POS_INF_F64, -0.0},           {POS_QNAN_F64, 0.0},           FE_INVALID},
+        {{NEG_INF_F64, 0.0},            {POS_QNAN_F64, 0.0},           FE_INVALID},
+        {{POS_INF_F64, -1.0},           {POS_QNAN_F64, POS_QNAN_F64},  FE_INVALID},
+        {{NEG_INF_F64, 2.0},            {POS_QNAN_F64, POS_QNAN_F64},  FE_INVALID},
+        {{POS_QNAN_F64, -0.0},          {POS_QNAN_F64, 0.0},           0},
+        {{POS_QNAN_F64, 0.0},           {POS_QNAN_F64, 0.0},           0},
+        {{POS_QNAN_F64, -1.0},          {POS_QNAN_F64, POS_QNAN_F64},  0},
+        {{0.0, NEG_INF_F64},            {POS_INF_F64, 0.0},            0},
+        {{-0.0, POS_INF_F64},           {POS_INF_F64, 0.0},            0},
+        {{1.0, NEG_INF_F64},            {POS_INF_F64, POS_INF_F64},    0},
+        {{2.0, POS_INF_F64},            {NEG_INF_F64, NEG_INF_F64},    0},
+        {{-3.0, NEG_INF_F64},           {NEG_INF_F64, NEG_INF_F64},    0},
+        {{-4.0, POS_INF_F64},           {NEG_INF_F64, NEG_INF_F64},    0},
+        {{POS_INF_F64, NEG_INF_F64},    {POS_INF_F64, POS_QNAN_F64},   FE_INVALID},
+        {{POS_INF_F64, POS_INF_F64},    {POS_INF_F64, POS_QNAN_F64},   FE_INVALID},
+        {{POS_QNAN_F64, NEG_INF_F64},   {POS_INF_F64, POS_QNAN_F64},   0},
+        {{POS_QNAN_F64, POS_INF_F64},   {POS_INF_F64, POS_QNAN_F64},   0},
+        {{0.0, POS_QNAN_F64},           {POS_QNAN_F64, 0.0},           0},
+        {{-0.0, POS_QNAN_F64},          {POS_QNAN_F64, -0.0},          0},
+        {{1.0, POS_QNAN_F64},           {POS_QNAN_F64, POS_QNAN_F64},  0},
+        {{POS_INF_F64, POS_QNAN_F64},   {POS_QNAN_F64, POS_QNAN_F64},  0},
+        {{POS_QNAN_F64, POS_QNAN_F64},  {POS_QNAN_F64, POS_QNAN_F64},  0},
+
+        /* Test inputs of some random values */
+        {{1.0, -1.0},                   {0.833730025131149, 0.9888977057628651}, FE_INEXACT},
+        {{3.0, 2.0},                    {-3.7245455049153224, -0.5118225699873846}, FE_INEXACT},
+        {{-0.25, -0.5},                 {1.0925708047319176, -0.12892104172809826}, FE_INEXACT},
+        {{0.0, -3.0},                   {10.067661995777765, 0.0},     FE_INEXACT},
+        {{1.5, -0.0},                   {0.0707372016677029, 0.0},     FE_INEXACT},
+        {{1e-5, 1e-5},                  {1.0, -1.0000000000000002e-10}, FE_INEXACT},
+        {{1e22, -1.0},                  {0.8073626031922525, -1.0015074558706623}, FE_INEXACT},
+
+        /* Subnormal inputs */
+        {{POS_SUBNORM_MIN_F64, NEG_SUBNORM_MIN_F64}, {1.0, 0.0},                    FE_INEXACT},
+        {{POS_SUBNORM_MAX_F64, -0.0},   {1.0, 0.0},                    0},
+        {{0.0, POS_SUBNORM_MAX_F64},    {1.0, -0.0},                   0},
+
+        /* Results near overflow and underflow */
+        {{0.5, -710.5},                 {1.6161712674728972e308, 8.829183874344385e307}, FE_INEXACT},
+        {{-0.5, 710.5},                 {1.6161712674728972e308, 8.829183874344385e307}, FE_INEXACT},
+        {{1.5, -710.5},                 {1.3027085751398349e307, POS_INF_F64}, FE_OVERFLOW},
+        {{1.0, -711.0},                 {1.640527287432755e308, POS_INF_F64}, FE_OVERFLOW},
+        {{2.0, 711.0},                  {-1.2635523363859527e308, NEG_INF_F64}, FE_OVERFLOW},
+        {{1.0, -400.0},                 {1.4105860567000836e173, 2.196857620995208e173}, FE_INEXACT},
+        {{-2.0, 400.0},                 {-1.0864490467610687e173, 2.3739344765754134e173}, FE_INEXACT},
+        {{0.5, -355.0},                 {6.558417577449837e153, 3.5828798519961265e153}, FE_INEXACT},
+        {{1.0, -0x1.fffffffffffffp+1023}, {POS_INF_F64, POS_INF_F64},    FE_OVERFLOW},
+};
+
+#endif	/*__TEST_CCOS_DATA_H__*/
@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "almcomplex.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+
+/*
+ * The vrz4/vrz8 and vrc8/vrc16 vectors and the vrza/vrca arrays of ccosh
+ * against the scalar amd_ccosh()/amd_ccoshf(): random operands, small ones
+ * where the sum cancels, results that overflow and large imaginary parts,
+ * the special grid, which must match the scalar results bit for bit, and
+ * the agreement of the variants with each other over tails and offsets.
+ *
+ * The bounds are the documented vector errors, 10 ulp per component in
+ * double and 1 ulp in single precision, plus 1 ulp for the scalar function
+ * itself.
+ */
+
+#define CCOSH_ULP_BOUND   11.0
+#define CCOSHF_ULP_BOUND  2.0
+#define CCOSH_NPOINTS     4000
+
+extern "C" {
+CPX_DECLARE_1(double, vrza, ccosh);
+CPX_DECLARE_1(float, vrca, ccoshf);
+}
+
+static const CpxKernel<double> ccosh_kernel = {
+  "ccosh", CPX_UNARY, CpxScalar1<double>(amd_ccosh),
+  {
+    CPX_VARIANTS_256(double, 1, vrza, vrz4, ccosh),
+#if defined(__AVX512__)
+    CPX_VARIANTS_512(double, 1, vrza, vrz8, ccosh),
+#endif
+  },
+  CCOSH_ULP_BOUND, nullptr,
+};
+
+static const CpxKernel<float> ccoshf_kernel = {
+  "ccoshf", CPX_UNARY, CpxScalar1<float>(amd_ccoshf),
+  {
+    CPX_VARIANTS_256(float, 1, vrca, vrc8, ccoshf),
+#if defined(__AVX512__)
+    CPX_VARIANTS_512(float, 1, vrca, vrc16, ccoshf),
+#endif
+  },
+  CCOSHF_ULP_BOUND, nullptr,
+};
+
+static const CpxRegion ccosh_regions[] = {
+  { CPX_BOX,  -10.0, 10.0, -10.0, 10.0 },
+  { CPX_LOG,  -60.0, 0.0, -60.0, 0.0 },   /* cancellation near 0 */
+  { CPX_BOX,  700.0, 720.0, -4.0, 4.0 },   /* overflow */
+  { CPX_BOX,  -720.0, -700.0, -4.0, 4.0 },   /* overflow */
+  { CPX_BOX,  -1.0, 1.0, -1.0e5, 1.0e5 },   /* large arguments of sin and cos */
+};
+
+static const CpxRegion ccoshf_regions[] = {
+  { CPX_BOX,  -10.0, 10.0, -10.0, 10.0 },
+  { CPX_LOG,  -30.0, 0.0, -30.0, 0.0 },   /* cancellation near 0 */
+  { CPX_BOX,  85.0, 92.0, -4.0, 4.0 },   /* overflow */
+  { CPX_BOX,  -92.0, -85.0, -4.0, 4.0 },   /* overflow */
+  { CPX_BOX,  -1.0, 1.0, -1.0e4, 1.0e4 },   /* large arguments of sin and cos */
+};
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_SCALAR) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<double> x = CpxInputs<double>(ccosh_regions, ARRAY_SIZE(ccosh_regions), CCOSH_NPOINTS, 1);
+
+  CpxAgainstScalar(ccosh_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT_ULP("Scalar", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<double> x;
+
+  CpxSpecialGrid(x);
+  CpxAgainstScalar(ccosh_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT("Specials", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_VARIANTS) {
+  int ntests = 0, nfail = 0;
+  std::vector<double> x = CpxInputs<double>(ccosh_regions, ARRAY_SIZE(ccosh_regions), CCOSH_NPOINTS, 1);
+
+  CpxSpecialGrid(x);
+  CpxVariants(ccosh_kernel, x, x, vflag, &ntests, &nfail);
+  CPX_REPORT("Variants", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_SCALAR) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<float> x = CpxInputs<float>(ccoshf_regions, ARRAY_SIZE(ccoshf_regions), CCOSH_NPOINTS, 1);
+
+  CpxAgainstScalar(ccoshf_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT_ULP("Scalar", "vrca/vrc");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<float> x;
+
+  CpxSpecialGrid(x);
+  CpxAgainstScalar(ccoshf_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT("Specials", "vrca/vrc");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_VARIANTS) {
+  int ntests = 0, nfail = 0;
+  std::vector<float> x = CpxInputs<float>(ccoshf_regions, ARRAY_SIZE(ccoshf_regions), CCOSH_NPOINTS, 1);
+
+  CpxSpecialGrid(x);
+  CpxVariants(ccoshf_kernel, x, x, vflag, &ntests, &nfail);
+  CPX_REPORT("Variants", "vrca/vrc");
+}
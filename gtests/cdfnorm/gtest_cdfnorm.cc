@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "almnormal.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * cdfnormf(x), the standard normal distribution function. The array results must stay within the bound quoted
+ * in src/optimized/stat/cdfnormf.c over the whole domain and its tails, and
+ * the scalar, vrs4, vrs8, vrs16 and per-architecture array variants must
+ * agree with the dispatched array variant bit for bit.
+ */
+
+#define CDFNORMF_ULP_BOUND 0.51
+
+extern "C" {
+void amd_vrsa_cdfnormf_avx2(int len, const float *src, float *dst);
+#if defined(__AVX512__)
+void amd_vrsa_cdfnormf_zn4(int len, const float *src, float *dst);
+#endif
+}
+
+static const NrmKernel cdfnormf_kernel = {
+  "cdfnormf",
+  amd_cdfnormf,
+  amd_vrs4_cdfnormf,
+  amd_vrs8_cdfnormf,
+#if defined(__AVX512__)
+  amd_vrs16_cdfnormf,
+#endif
+  amd_vrsa_cdfnormf,
+  amd_vrsa_cdfnormf_avx2,
+#if defined(__AVX512__)
+  amd_vrsa_cdfnormf_zn4,
+#endif
+  alm_mp_cdfnormf,
+  CDFNORMF_ULP_BOUND,
+};
+
+static const NrmRange cdfnorm_ranges[] = {
+  {    -16.0f,     10.0f },   /* core */
+  {    -40.0f,    -12.0f },   /* lower tail, to underflow */
+  {    -1e-3f,     1e-3f },   /* near zero */
+  {    -1e30f,     1e30f },   /* wide */
+};
+
+#define CDFNORM_NPOINTS 40000
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_BOUND) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+
+  NrmAccuracy(cdfnormf_kernel, cdfnorm_ranges, ARRAY_SIZE(cdfnorm_ranges),
+              CDFNORM_NPOINTS, vflag, &ntests, &nfail, &max_ulp);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
+          "Bound", "Accuracy", "vrsa", ntests, (ntests - nfail), nfail,
+          max_ulp);
+  ptr->tstcnt++;
+  EXPECT_EQ(nfail, 0);
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_VARIANTS) {
+  int ntests = 0, nfail = 0;
+
+  NrmVariants(cdfnormf_kernel, cdfnorm_ranges, ARRAY_SIZE(cdfnorm_ranges), vflag,
+              &ntests, &nfail);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",
+          "Variants", "Accuracy", "s1f/vrs4-16", ntests, (ntests - nfail),
+          nfail);
+  ptr->tstcnt++;
+  EXPECT_EQ(nfail, 0);
+}
@@ -38,8 +38,31 @@
  */
  static libm_test_special_data_f32
  test_cdfnorminvf_conformance_data[] = {
- 
- };
+    /*
+     * The float kernels handle special inputs with selects on the vector
+     * path and make no promise about the status flags, so none are
+     * expected.
+     */
+    { POS_ZERO_F32,    NEG_INF_F32,     AMD_F_NONE },  /* cdfnorminvf(0) = -Inf */
+    { NEG_ZERO_F32,    NEG_INF_F32,     AMD_F_NONE },  /* cdfnorminvf(-0) = -Inf */
+    { POS_ONE_F32,     POS_INF_F32,     AMD_F_NONE },  /* cdfnorminvf(1) = +Inf */
+    { NEG_ONE_F32,     NEG_QNAN_F32,    AMD_F_NONE },  /* cdfnorminvf(-1) = NaN */
+    { POS_INF_F32,     NEG_QNAN_F32,    AMD_F_NONE },  /* cdfnorminvf(+Inf) = NaN */
+    { NEG_INF_F32,     NEG_QNAN_F32,    AMD_F_NONE },  /* cdfnorminvf(-Inf) = NaN */
+    { POS_QNAN_F32,    POS_QNAN_F32,    AMD_F_NONE },  /* cdfnorminvf(NaN) = NaN */
+    { NEG_QNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE },  /* cdfnorminvf(NaN) = NaN */
+    { POS_SNAN_F32,    POS_QNAN_F32,    AMD_F_NONE },  /* cdfnorminvf(NaN) = NaN */
+    { NEG_SNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE },  /* cdfnorminvf(NaN) = NaN */
+    { POS_LDENORM_F32, 0xC161F15D,      AMD_F_NONE },  /* cdfnorminvf(1.40129846e-45) = -14.1214266, smallest denormal */
+    { POS_LNORMAL_F32, 0xC14F3302,      AMD_F_NONE },  /* cdfnorminvf(1.17549435e-38) = -12.9499531, FLT_MIN */
+    { 0x3F000000,      POS_ZERO_F32,    AMD_F_NONE },  /* cdfnorminvf(0.5) = 0, median */
+    { 0x3F7FFFFF,      0x40A96E37,      AMD_F_NONE },  /* cdfnorminvf(0.99999994) = 5.29470396, largest below 1 */
+    { 0x3F7FF000,      0x405F2CB7,      AMD_F_NONE },  /* cdfnorminvf(0.999755859) = 3.48710418, near 1 */
+    { 0x3DCCCCCD,      0xBFA409E2,      AMD_F_NONE },  /* cdfnorminvf(0.100000001) = -1.2815516 */
+    { 0x3F666666,      0x3FA409E1,      AMD_F_NONE },  /* cdfnorminvf(0.899999976) = 1.28155148 */
+    { 0x3A83126F,      0xC045C65E,      AMD_F_NONE },  /* cdfnorminvf(0.00100000005) = -3.09023237 */
+    { 0x40000000,      NEG_QNAN_F32,    AMD_F_NONE },  /* cdfnorminvf(2) = NaN, out of domain */
+};
 
 static libm_test_special_data_f64
 test_cdfnorminv_conformance_data[] = {
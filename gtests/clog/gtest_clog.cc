@@ -0,0 +1,149 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "almcomplex.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+
+/*
+ * The vrz4/vrz8 and vrc8/vrc16 vectors and the vrza/vrca arrays of clog
+ * against the scalar amd_clog()/amd_clogf(): random operands over every
+ * binade, near |z| = 1 where log|z| cancels and along the branch cut, the
+ * special grid, which must match the scalar results bit for bit, and the
+ * agreement of the variants with each other over tails and offsets.
+ *
+ * The bounds are the documented vector errors, 3 ulp in double and 1 ulp
+ * in single precision, plus 1 ulp for the scalar function itself.
+ */
+
+#define CLOG_ULP_BOUND   4.0
+#define CLOGF_ULP_BOUND  2.0
+#define CLOG_NPOINTS     4000
+
+extern "C" {
+CPX_DECLARE_1(double, vrza, clog);
+CPX_DECLARE_1(float, vrca, clogf);
+}
+
+static const CpxKernel<double> clog_kernel = {
+  "clog", CPX_UNARY, CpxScalar1<double>(amd_clog),
+  {
+    CPX_VARIANTS_256(double, 1, vrza, vrz4, clog),
+#if defined(__AVX512__)
+    CPX_VARIANTS_512(double, 1, vrza, vrz8, clog),
+#endif
+  },
+  CLOG_ULP_BOUND, nullptr,
+};
+
+static const CpxKernel<float> clogf_kernel = {
+  "clogf", CPX_UNARY, CpxScalar1<float>(amd_clogf),
+  {
+    CPX_VARIANTS_256(float, 1, vrca, vrc8, clogf),
+#if defined(__AVX512__)
+    CPX_VARIANTS_512(float, 1, vrca, vrc16, clogf),
+#endif
+  },
+  CLOGF_ULP_BOUND, nullptr,
+};
+
+static const CpxRegion clog_regions[] = {
+  { CPX_BOX,  -10.0, 10.0, -10.0, 10.0 },
+  { CPX_LOG,  -1074.0, 1023.0, -1074.0, 1023.0 },   /* every binade */
+  { CPX_RING, 0.999, 1.001, 0.0, 0.0 },   /* |z| near 1 */
+  { CPX_LOG,  -60.0, 0.0, -60.0, 0.0 },
+  { CPX_BOX,  -1.0e3, 1.0e3, -1.0e-3, 1.0e-3 },   /* branch cut */
+};
+
+static const CpxRegion clogf_regions[] = {
+  { CPX_BOX,  -10.0, 10.0, -10.0, 10.0 },
+  { CPX_LOG,  -149.0, 127.0, -149.0, 127.0 },   /* every binade */
+  { CPX_RING, 0.999, 1.001, 0.0, 0.0 },   /* |z| near 1 */
+  { CPX_LOG,  -30.0, 0.0, -30.0, 0.0 },
+  { CPX_BOX,  -1.0e3, 1.0e3, -1.0e-3, 1.0e-3 },   /* branch cut */
+};
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_SCALAR) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<double> x = CpxInputs<double>(clog_regions, ARRAY_SIZE(clog_regions), CLOG_NPOINTS, 1);
+
+  CpxAgainstScalar(clog_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT_ULP("Scalar", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<double> x;
+
+  CpxSpecialGrid(x);
+  CpxAgainstScalar(clog_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT("Specials", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_VARIANTS) {
+  int ntests = 0, nfail = 0;
+  std::vector<double> x = CpxInputs<double>(clog_regions, ARRAY_SIZE(clog_regions), CLOG_NPOINTS, 1);
+
+  CpxSpecialGrid(x);
+  CpxVariants(clog_kernel, x, x, vflag, &ntests, &nfail);
+  CPX_REPORT("Variants", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_SCALAR) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<float> x = CpxInputs<float>(clogf_regions, ARRAY_SIZE(clogf_regions), CLOG_NPOINTS, 1);
+
+  CpxAgainstScalar(clogf_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT_ULP("Scalar", "vrca/vrc");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<float> x;
+
+  CpxSpecialGrid(x);
+  CpxAgainstScalar(clogf_kernel, x, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT("Specials", "vrca/vrc");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_VARIANTS) {
+  int ntests = 0, nfail = 0;
+  std::vector<float> x = CpxInputs<float>(clogf_regions, ARRAY_SIZE(clogf_regions), CLOG_NPOINTS, 1);
+
+  CpxSpecialGrid(x);
+  CpxVariants(clogf_kernel, x, x, vflag, &ntests, &nfail);
+  CPX_REPORT("Variants", "vrca/vrc");
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __TEST_CLOG_DATA_H__
+#define __TEST_CLOG_DATA_H__
+
+extern "C"
+{
+    #if defined(_WIN64) || defined(_WIN32)
+        #include "complex.h"
+    #else
+        #include "/usr/include/complex.h"
+    #endif
+}
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <external/amdlibm.h>
+
+//Helper functions to convert hex bit patterns to float/double values at compile time
+//These changes ensure that test data containing special values (infinity, NaN, π)
+//works correctly in complex arithmetic expressions by converting hex bit patterns
+//to actual floating/double-point values before they're used in calculations.
+
+static inline float bits_to_float(uint32_t bits) {
+    union { uint32_t u; float f; } conv;
+    conv.u = bits;
+    return conv.f;
+}
+
+static inline double bits_to_double(uint64_t bits) {
+    union { uint64_t u; double d; } conv;
+    conv.u = bits;
+    return conv.d;
+}
+
+// Redefine special constants as actual float/double values for use in complex expressions
+#undef POS_INF_F32
+#undef NEG_INF_F32
+#undef POS_QNAN_F32
+#undef NEG_QNAN_F32
+#undef POS_PI_F32
+#undef NEG_PI_F32
+
+#define POS_INF_F32    (bits_to_float(0x7F800000))
+#define NEG_INF_F32    (bits_to_float(0xFF800000))
+#define POS_QNAN_F32   (bits_to_float(0x7fc00000 ))
+#define NEG_QNAN_F32   (bits_to_float(0xffc00000))
+#define POS_PI_F32     (bits_to_float(0x40490fd8))
+#define NEG_PI_F32     (bits_to_float(0xc0490fd8))
+
+#undef POS_INF_F64
+#undef NEG_INF_F64
+#undef POS_QNAN_F64
+#undef NEG_QNAN_F64
+#undef POS_PI_F64
+#undef NEG_PI_F64
+
+#define POS_INF_F64    (bits_to_double(0x7ff0000000000000ULL))
+#define NEG_INF_F64    (bits_to_double(0xfff0000000000000ULL))
+#define POS_QNAN_F64   (bits_to_double(0x7ff87ff7fdedffffULL))
+#define NEG_QNAN_F64   (bits_to_double(0xfff8000000000000ULL))
+#define POS_PI_F64     (bits_to_double(0x400921FB54442D18ULL))
+#define NEG_PI_F64     (bits_to_double(0xc00921fb54442d18ULL))
+/* Subnormal constants for F32 */
+#define POS_SUBNORM_MIN_F32  (bits_to_float(0x00000001))   /* ~1.4e-45, smallest positive subnormal */
+#define POS_SUBNORM_MAX_F32  (bits_to_float(0x007FFFFF))   /* ~1.17e-38, largest positive subnormal */
+#define NEG_SUBNORM_MIN_F32  (bits_to_float(0x80000001))   /* ~-1.4e-45, smallest negative subnormal */
+#define NEG_SUBNORM_MAX_F32  (bits_to_float(0x807FFFFF))   /* ~-1.17e-38, largest negative subnormal */
+
+/* Subnormal constants for F64 */
+#define POS_SUBNORM_MIN_F64  (bits_to_double(0x0000000000000001ULL))  /* ~4.9e-324, smallest positive subnormal */
+#define POS_SUBNORM_MAX_F64  (bits_to_double(0x000FFFFFFFFFFFFFULL))  /* ~2.2e-308, largest positive subnormal */
+#define NEG_SUBNORM_MIN_F64  (bits_to_double(0x8000000000000001ULL))  /* ~-4.9e-324, smallest negative subnormal */
+#define NEG_SUBNORM_MAX_F64  (bits_to_double(0x800FFFFFFFFFFFFFULL))  /* ~-2.2e-308, largest negative subnormal */
+
+
+
+/*
+ * Test cases to check the conformance for the clogf() routine.
+ * These test cases are not exhaustive.
+ * The special values are those of C99 Annex G.6.3.2.
+ */
+
+static libm_test_complex_data_f32
+test_clogf_conformance_data[] = {
+        /* Test inputs of -/+0 */
+        {{-0.0, 0.0},                  {NEG_INF_F32, POS_PI_F32},    FE_DIVBYZERO},
+        {{0.0, 0.0},                   {NEG_INF_F32, 0.0},           FE_DIVBYZERO},
+        {{0.0, -0.0},                  {NEG_INF_F32, -0.0},          FE_DIVBYZERO},
+        {{-0.0, -0.0},                 {NEG_INF_F32, NEG_PI_F32},    FE_DIVBYZERO},
+
+        /* Test inputs of -/+inf and Quiet NAN */
+        {{1.0, POS_INF_F32},           {POS_INF_F32, 1.5707964f},    0},
+        {{-1.0, NEG_INF_F32},          {POS_INF_F32, -1.5707964f},   0},
+        {{1.0, POS_QNAN_F32},          {POS_QNAN_F32, POS_QNAN_F32}, 0},
+        {{NEG_INF_F32, 1.0},           {POS_INF_F32, POS_PI_F32},    0},
+        {{NEG_INF_F32, -1.0},          {POS_INF_F32, NEG_PI_F32},    0},
+        {{POS_INF_F32, 1.0},           {POS_INF_F32, 0.0},           0},
+        {{POS_INF_F32, -1.0},          {POS_INF_F32, -0.0},          0},
+        {{NEG_INF_F32, POS_INF_F32},   {POS_INF_F32, 2.3561945f},    0},
+        {{POS_INF_F32, POS_INF_F32},   {POS_INF_F32, 0.7853982f},    0},
+        {{POS_INF_F32, POS_QNAN_F32},  {POS_INF_F32, POS_QNAN_F32},  0},
+        {{NEG_INF_F32, POS_QNAN_F32},  {POS_INF_F32, POS_QNAN_F32},  0},
+        {{POS_QNAN_F32, 1.0},          {POS_QNAN_F32, POS_QNAN_F32}, 0},
+        {{POS_QNAN_F32, POS_INF_F32},  {POS_INF_F32, POS_QNAN_F32},  0},
+        {{POS_QNAN_F32, POS_QNAN_F32}, {POS_QNAN_F32, POS_QNAN_F32}, 0},
+
+        /* Test inputs of some random values */
+        {{1.0, 0.0},                   {0.0, 0.0},                   0},
+        {{-1.0, 0.0},                  {0.0, POS_PI_F32},            0},
+        {{0.0, 1.0},                   {0.0, 1.5707964f},            0},
+        {{1.0, 1.0},                   {0.34657359f, 0.78539819f},   FE_INEXACT},
+        {{-2.0, 3.0},                  {1.2824747f, 2.1587989f},     FE_INEXACT},
+        {{3.0, -4.0},                  {1.6094379f, -0.92729521f},   FE_INEXACT},
+
+        /* |z| close to 1 */
+        {{0.6f, 0.8f},                 {2.3841858e-8f, 0.92729521f},          FE_INEXACT},
+        {{1.0f, 1e-4f},                {5e-9f, 9.9999997e-5f},               FE_INEXACT},
+
+        /* Subnormal and huge inputs */
+        {{POS_SUBNORM_MIN_F32, 0.0},   {-103.27893f, 0.0f},          FE_INEXACT},
+        {{0.0, POS_SUBNORM_MAX_F32},   {-87.336545f, 1.5707964f},    FE_INEXACT},
+        {{3e38f, 3e38f},               {88.943419f, 0.78539819f},    FE_INEXACT},
+};
+
+/*
+ * Test cases to check the conformance for the clog() routine.
+ * These test cases are not exhaustive.
+ */
+
+static libm_test_complex_data_f64
+test_clog_conformance_data[] = {
+        /* Test inputs of -/+0 */
+        {{-0.0, 0.0},                  {NEG_INF_F64, POS_PI_F64},    FE_DIVBYZERO},
+        {{0.0, 0.0},                   {NEG_INF_F64, 0.0},           FE_DIVBYZERO},
+        {{0.0, -0.0},                  {NEG_INF_F64, -0.0},          FE_DIVBYZERO},
+        {{-0.0, -0.0},                 {NEG_INF_F64, NEG_PI_F64},    FE_DIVBYZERO},
+
+        /* Test inputs of -/+inf and Quiet NAN */
+        {{1.0, POS_INF_F64},           {POS_INF_F64, 1.5707963267948966}, 0},
+        {{-1.0, NEG_INF_F64},          {POS_INF_F64, -1.5707963267948966}, 0},
+        {{1.0, POS_QNAN_F64},          {POS_QNAN_F64, POS_QNAN_F64}, 0},
+        {{NEG_INF_F64, 1.0},           {POS_INF_F64, POS_PI_F64},    0},
+        {{NEG_INF_F64, -1.0},          {POS_INF_F64, NEG_PI_F64},    0},
+        {{POS_INF_F64, 1.0},           {POS_INF_F64, 0.0},           0},
+        {{POS_INF_F64, -1.0},          {POS_INF_F64, -0.0},          0},
+        {{NEG_INF_F64, POS_INF_F64},   {POS_INF_F64, 2.356194490192345}, 0},
+        {{POS_INF_F64, POS_INF_F64},   {POS_INF_F64, 0.7853981633974483}, 0},
+        {{POS_INF_F64, POS_QNAN_F64},  {POS_INF_F64, POS_QNAN_F64},  0},
+        {{NEG_INF_F64, POS_QNAN_F64},  {POS_INF_F64, POS_QNAN_F64},  0},
+        {{POS_QNAN_F64, 1.0},          {POS_QNAN_F64, POS_QNAN_F64}, 0},
+        {{POS_QNAN_F64, POS_INF_F64},  {POS_INF_F64, POS_QNAN_F64},  0},
+        {{POS_QNAN_F64, POS_QNAN_F64}, {POS_QNAN_F64, POS_QNAN_F64}, 0},
+
+        /* Test inputs of some random values */
+        {{1.0, 0.0},                   {0.0, 0.0},                   0},
+        {{-1.0, 0.0},                  {0.0, POS_PI_F64},            0},
+        {{0.0, 1.0},                   {0.0, 1.5707963267948966},    0},
+        {{1.0, 1.0},                   {0.34657359027997264, 0.7853981633974483}, FE_INEXACT},
+        {{-2.0, 3.0},                  {1.2824746787307684, 2.158798930342464}, FE_INEXACT},
+        {{3.0, -4.0},                  {1.6094379124341003, -0.9272952180016122}, FE_INEXACT},
+
+        /* |z| close to 1 */
+        {{0.6, 0.8},                   {2.220446049250313e-17, 0.9272952180016123}, FE_INEXACT},
+        {{1.0, 1e-8},                  {5e-17, 1e-8},                FE_INEXACT},
+
+        /* Subnormal and huge inputs */
+        {{POS_SUBNORM_MIN_F64, 0.0},   {-744.4400719213812, 0.0},    FE_INEXACT},
+        {{0.0, POS_SUBNORM_MAX_F64},   {-708.3964185322641, 1.5707963267948966}, FE_INEXACT},
+        {{1e308, 1e308},               {709.542782232446, 0.7853981633974483}, FE_INEXACT},
+};
+
+#endif	/*__TEST_CLOG_DATA_H__*/
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_COSF16_DATA_H__
+#define __TEST_COSF16_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for cosf16(), as the float values of FP16 inputs
+ * and correctly rounded FP16 results: zeros, infinities, NaNs, subnormals,
+ * the largest finite value, and inputs near multiples of pi/2 and large arguments.
+ *
+ * The FP16 kernels keep special inputs on the vector path (see
+ * include/libm/alm_half.h) and make no promise about the status flags, so
+ * none are expected.
+ */
+
+static libm_test_special_data_f32
+test_cosf16_conformance_data[] = {
+    { 0x00000000, 0x3F800000, AMD_F_NONE },  /* +0: cos(0) = 1 */
+    { 0x80000000, 0x3F800000, AMD_F_NONE },  /* -0: cos(-0) = 1 */
+    { 0x7F800000, 0x7FC00000, AMD_F_NONE },  /* +Inf: cos(inf) = nan */
+    { 0xFF800000, 0x7FC00000, AMD_F_NONE },  /* -Inf: cos(-inf) = nan */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: cos(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: cos(-nan) = -nan */
+    { 0x33800000, 0x3F800000, AMD_F_NONE },  /* min subnormal: cos(5.96046448e-08) = 1 */
+    { 0xB3800000, 0x3F800000, AMD_F_NONE },  /* -min subnormal: cos(-5.96046448e-08) = 1 */
+    { 0x387FC000, 0x3F800000, AMD_F_NONE },  /* max subnormal: cos(6.09755516e-05) = 1 */
+    { 0x38800000, 0x3F800000, AMD_F_NONE },  /* min normal: cos(6.10351562e-05) = 1 */
+    { 0x3F800000, 0x3F0A6000, AMD_F_NONE },  /* 1: cos(1) = 0.540527344 */
+    { 0xBF800000, 0x3F0A6000, AMD_F_NONE },  /* -1: cos(-1) = 0.540527344 */
+    { 0x477FE000, 0xBE61E000, AMD_F_NONE },  /* max: cos(65504) = -0.220581055 */
+    { 0xC77FE000, 0xBE61E000, AMD_F_NONE },  /* -max: cos(-65504) = -0.220581055 */
+    { 0x40490000, 0xBF800000, AMD_F_NONE },  /* pi: cos(3.140625) = -1 */
+    { 0x3FC90000, 0x39FDA000, AMD_F_NONE },  /* pi/2: cos(1.5703125) = 0.000483751297 */
+    { 0x3A000000, 0x3F800000, AMD_F_NONE },  /* small: cos(0.00048828125) = 1 */
+    { 0x447A0000, 0x3F100000, AMD_F_NONE },  /* 1000: cos(1000) = 0.5625 */
+    { 0x47000000, 0x3EBF0000, AMD_F_NONE },  /* 32768: cos(32768) = 0.373046875 */
+    { 0x40000000, 0xBED52000, AMD_F_NONE },  /* 2: cos(2) = -0.416259766 */
+};
+
+#endif /*__TEST_COSF16_DATA_H__*/
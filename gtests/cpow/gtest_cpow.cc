@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "almcomplex.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+
+/*
+ * The vrz4/vrz8 and vrc8/vrc16 vectors and the vrza/vrca arrays of cpow
+ * against the scalar amd_cpow()/amd_cpowf(): random bases and exponents,
+ * bases near |x| = 1, powers that overflow and underflow, the special grid
+ * against itself and against the exponent 2, which must match the scalar
+ * results bit for bit, and the agreement of the variants with each other
+ * over tails and offsets.
+ *
+ * An error of an ulp in w = y * log(x) is an error of |w| ulp in x^y, the
+ * vectors take it through cexp(w) and the scalar function through the
+ * angle of its polar form, so on top of the bounds each input is allowed
+ * 4 |w| ulp, 2 |w| for each side.
+ */
+
+#define CPOW_ULP_BOUND   8.0
+#define CPOWF_ULP_BOUND  2.0
+#define CPOW_NPOINTS     4000
+
+extern "C" {
+CPX_DECLARE_2(double, vrza, cpow);
+CPX_DECLARE_2(float, vrca, cpowf);
+}
+
+template <typename T>
+static double cpow_slack(T xre, T xim, T yre, T yim)
+{
+  double l = std::log(std::hypot((double)xre, (double)xim));
+  double t = std::atan2((double)xim, (double)xre);
+
+  return 4.0 * std::hypot(yre * l - yim * t, yre * t + yim * l);
+}
+
+static const CpxKernel<double> cpow_kernel = {
+  "cpow", CPX_BINARY, CpxScalar2<double>(amd_cpow),
+  {
+    CPX_VARIANTS_256(double, 2, vrza, vrz4, cpow),
+#if defined(__AVX512__)
+    CPX_VARIANTS_512(double, 2, vrza, vrz8, cpow),
+#endif
+  },
+  CPOW_ULP_BOUND, cpow_slack<double>,
+};
+
+static const CpxKernel<float> cpowf_kernel = {
+  "cpowf", CPX_BINARY, CpxScalar2<float>(amd_cpowf),
+  {
+    CPX_VARIANTS_256(float, 2, vrca, vrc8, cpowf),
+#if defined(__AVX512__)
+    CPX_VARIANTS_512(float, 2, vrca, vrc16, cpowf),
+#endif
+  },
+  CPOWF_ULP_BOUND, cpow_slack<float>,
+};
+
+static const CpxRegion cpow_regions[] = {
+  { CPX_BOX,  -4.0, 4.0, -4.0, 4.0 },
+  { CPX_LOG,  -20.0, 20.0, -20.0, 20.0 },
+  { CPX_RING, 0.99, 1.01, 0.0, 0.0 },   /* |x| near 1 */
+  { CPX_BOX,  1.0, 4.0, -1.0, 1.0 },
+  { CPX_BOX,  1.0, 4.0, -1.0, 1.0 },
+};
+
+static const CpxRegion cpow_y_regions[] = {
+  { CPX_BOX,  -4.0, 4.0, -4.0, 4.0 },
+  { CPX_BOX,  -2.0, 2.0, -2.0, 2.0 },
+  { CPX_LOG,  -10.0, 5.0, -10.0, 5.0 },
+  { CPX_BOX,  200.0, 600.0, -1.0, 1.0 },   /* overflow */
+  { CPX_BOX,  -600.0, -200.0, -1.0, 1.0 },   /* underflow */
+};
+
+static const CpxRegion cpowf_regions[] = {
+  { CPX_BOX,  -4.0, 4.0, -4.0, 4.0 },
+  { CPX_LOG,  -20.0, 20.0, -20.0, 20.0 },
+  { CPX_RING, 0.99, 1.01, 0.0, 0.0 },   /* |x| near 1 */
+  { CPX_BOX,  1.0, 4.0, -1.0, 1.0 },
+  { CPX_BOX,  1.0, 4.0, -1.0, 1.0 },
+};
+
+static const CpxRegion cpowf_y_regions[] = {
+  { CPX_BOX,  -4.0, 4.0, -4.0, 4.0 },
+  { CPX_BOX,  -2.0, 2.0, -2.0, 2.0 },
+  { CPX_LOG,  -10.0, 5.0, -10.0, 5.0 },
+  { CPX_BOX,  30.0, 90.0, -1.0, 1.0 },   /* overflow */
+  { CPX_BOX,  -90.0, -30.0, -1.0, 1.0 },   /* underflow */
+};
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_SCALAR) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<double> x = CpxInputs<double>(cpow_regions, ARRAY_SIZE(cpow_regions), CPOW_NPOINTS, 1);
+  std::vector<double> y = CpxInputs<double>(cpow_y_regions, ARRAY_SIZE(cpow_y_regions), CPOW_NPOINTS, 101);
+
+  CpxAgainstScalar(cpow_kernel, x, y, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT_ULP("Scalar", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<double> x;
+
+  CpxSpecialGrid(x);
+  /* every special against the grid read backwards and with (2, 0), the
+     y values of the integer and real powers */
+  std::vector<double> y(x.rbegin(), x.rend());
+  CpxAgainstScalar(cpow_kernel, x, y, vflag, &ntests, &nfail, &max_ulp);
+  for (size_t i = 0; i < y.size(); i += 2) {
+    y[i] = (double)2.0;
+    y[i + 1] = 0;
+  }
+  CpxAgainstScalar(cpow_kernel, x, y, vflag, &ntests, &nfail, &max_ulp);
+  CpxAgainstScalar(cpow_kernel, y, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT("Specials", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexDouble, ACCURACY_VECTOR_ARRAY_COMPLEX_DOUBLES_VARIANTS) {
+  int ntests = 0, nfail = 0;
+  std::vector<double> x = CpxInputs<double>(cpow_regions, ARRAY_SIZE(cpow_regions), CPOW_NPOINTS, 1);
+  std::vector<double> y = CpxInputs<double>(cpow_y_regions, ARRAY_SIZE(cpow_y_regions), CPOW_NPOINTS, 101);
+
+  CpxSpecialGrid(x);
+  CpxSpecialGrid(y);
+  CpxVariants(cpow_kernel, x, y, vflag, &ntests, &nfail);
+  CPX_REPORT("Variants", "vrza/vrz");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_SCALAR) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<float> x = CpxInputs<float>(cpowf_regions, ARRAY_SIZE(cpowf_regions), CPOW_NPOINTS, 1);
+  std::vector<float> y = CpxInputs<float>(cpowf_y_regions, ARRAY_SIZE(cpowf_y_regions), CPOW_NPOINTS, 101);
+
+  CpxAgainstScalar(cpowf_kernel, x, y, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT_ULP("Scalar", "vrca/vrc");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  std::vector<float> x;
+
+  CpxSpecialGrid(x);
+  /* every special against the grid read backwards and with (2, 0), the
+     y values of the integer and real powers */
+  std::vector<float> y(x.rbegin(), x.rend());
+  CpxAgainstScalar(cpowf_kernel, x, y, vflag, &ntests, &nfail, &max_ulp);
+  for (size_t i = 0; i < y.size(); i += 2) {
+    y[i] = (float)2.0;
+    y[i + 1] = 0;
+  }
+  CpxAgainstScalar(cpowf_kernel, x, y, vflag, &ntests, &nfail, &max_ulp);
+  CpxAgainstScalar(cpowf_kernel, y, x, vflag, &ntests, &nfail, &max_ulp);
+  CPX_REPORT("Specials", "vrca/vrc");
+}
+
+TEST_P(AccuTestFixtureComplexFloat, ACCURACY_VECTOR_ARRAY_COMPLEX_FLOATS_VARIANTS) {
+  int ntests = 0, nfail = 0;
+  std::vector<float> x = CpxInputs<float>(cpowf_regions, ARRAY_SIZE(cpowf_regions), CPOW_NPOINTS, 1);
+  std::vector<float> y = CpxInputs<float>(cpowf_y_regions, ARRAY_SIZE(cpowf_y_regions), CPOW_NPOINTS, 101);
+
+  CpxSpecialGrid(x);
+  CpxSpecialGrid(y);
+  CpxVariants(cpowf_kernel, x, y, vflag, &ntests, &nfail);
+  CPX_REPORT("Variants", "vrca/vrc");
+}
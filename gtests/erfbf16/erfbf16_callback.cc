@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <cmath>
+#include <vector>
+#include "libm_tests.h"
+#include <libm_macros.h>
+
+#include <libm_amd.h>
+#include <libm/amd_funcs_internal.h>
+#include <fmaintrin.h>
+#include <immintrin.h>
+#include "callback.h"
+#include "almhalf.h"
+#include "test_erfbf16_data.h"
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * Only the array variant exists. The generic tests round each float input
+ * to BF16, run the BF16 array through erfbf16 and widen it back; the
+ * expected value is the correctly rounded BF16 result, flushed to zero when
+ * subnormal. gtest_erfbf16.cc measures the error in BF16 ULPs over all
+ * inputs.
+ */
+
+static uint32_t ipargs = 1;
+bool special_case = false;
+
+uint32_t GetnIpArgs( void )
+{
+  return ipargs;
+}
+
+bool getSpecialCase(void)
+{
+  return special_case;
+}
+
+void ConfSetupf32(SpecParams *specp) {
+  specp->data32 = test_erfbf16_conformance_data;
+  specp->countf = ARRAY_SIZE(test_erfbf16_conformance_data);
+}
+
+void ConfSetupf64(SpecParams *specp) {
+  specp->data64 = NULL;
+  specp->countd = 0;
+}
+
+float getFuncOp(float *data) {
+  uint16_t h = FloatToBF16(data[0]);
+  amd_vrba_erfbf16(1, &h, &h);
+  return BF16ToFloat(h);
+}
+
+double getFuncOp(double *data) {
+  return 0.0;
+}
+
+double getExpected(float *data) {
+  float x = BF16ToFloat(FloatToBF16(data[0]));
+  auto val = BF16ToFloat(DoubleToBF16Ftz(alm_mp_erff(x)));
+  return val;
+}
+
+long double getExpected(double *data) {
+  return 0.0;
+}
+
+// Used by the Complex Number Functions only!
+double _Complex getExpected(float _Complex *data) {
+  return 0.0;
+}
+
+long double _Complex getExpected(double _Complex *data) {
+  return 0.0;
+}
+
+float getGlibcOp(float *data) {
+  return 0.0; /* no BF16 erf in glibc */
+}
+
+double getGlibcOp(double *data) {
+  return 0.0;
+}
+
+/**********************
+*FUNCTIONS*
+**********************/
+int test_s1s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_s1d(test_data *data, int idx)  {
+  return 0;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int test_v2d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v8s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v8d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v16s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_vas(test_data *data, int count)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    std::vector<uint16_t> h(count);
+
+    for (int i = 0; i < count; i++)
+      h[i] = FloatToBF16(ip[i]);
+    amd_vrba_erfbf16(count, h.data(), h.data());
+    for (int i = 0; i < count; i++)
+      op[i] = BF16ToFloat(h[i]);
+  #endif
+  return 0;
+}
+
+int test_vad(test_data *data, int count)  {
+  return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -42,6 +42,7 @@
 
 #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
 double LIBM_FUNC(erfcinv)(double);
+float LIBM_FUNC(erfcinvf)(float);
 #endif
 
 static uint32_t ipargs = 1;
@@ -68,7 +69,7 @@ void ConfSetupf64(SpecParams *specp) {
 }
 
 float getFuncOp(float *data) {
-  return 0.0; //LIBM_FUNC(erfcinvf)(data[0]);
+  return LIBM_FUNC(erfcinvf)(data[0]);
 }
 
 double getFuncOp(double *data) {
@@ -114,6 +115,11 @@ double getGlibcOp(double *data) {
 *FUNCTIONS*
 **********************/
 int test_s1s(test_data *data, int idx)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    op[0] = LIBM_FUNC(erfcinvf)(ip[idx]);
+  #endif
   return 0;
 }
 
@@ -135,8 +141,11 @@ extern "C" {
 #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL || LIBM_PROTOTYPE == PROTOTYPE_SVML)
   __m128d LIBM_FUNC_VEC(d, 2, erfcinv)(__m128d);
   __m256d LIBM_FUNC_VEC(d, 4, erfcinv)(__m256d);
+  __m128 LIBM_FUNC_VEC(s, 4, erfcinvf)(__m128);
+  __m256 LIBM_FUNC_VEC(s, 8, erfcinvf)(__m256);
   #if defined(__AVX512__)
   __m512d LIBM_FUNC_VEC(d, 8, erfcinv)(__m512d);
+  __m512 LIBM_FUNC_VEC(s, 16, erfcinvf)(__m512);
   #endif
   void LIBM_FUNC_VEC(d, a, erfcinv)(int, const double *, double *);
 #endif
@@ -157,7 +166,13 @@ int test_v2d(test_data *data, int idx)  {
 }
 
 int test_v4s(test_data *data, int idx)  {
-
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    __m128 ip4 = _mm_set_ps(ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
+    __m128 op4 = LIBM_FUNC_VEC(s, 4, erfcinvf)(ip4);
+    _mm_store_ps(&op[0], op4);
+  #endif
   return 0;
 }
 
@@ -177,7 +192,14 @@ int test_v4d(test_data *data, int idx)  {
 }
 
 int test_v8s(test_data *data, int idx)  {
-
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    __m256 ip8 = _mm256_set_ps(ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
+                               ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
+    __m256 op8 = LIBM_FUNC_VEC(s, 8, erfcinvf)(ip8);
+    _mm256_store_ps(&op[0], op8);
+  #endif
   return 0;
 }
 
@@ -200,12 +222,27 @@ int test_v8d(test_data *data, int idx)  {
 }
 
 int test_v16s(test_data *data, int idx)  {
-
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    #if defined(__AVX512__)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    __m512 ip16 = _mm512_set_ps(ip[idx+15], ip[idx+14], ip[idx+13], ip[idx+12],
+                                ip[idx+11], ip[idx+10], ip[idx+9], ip[idx+8],
+                                ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
+                                ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
+    __m512 op16 = LIBM_FUNC_VEC(s, 16, erfcinvf)(ip16);
+    _mm512_store_ps(&op[0], op16);
+    #endif /* __AVX512__ */
+  #endif
   return 0;
 }
 
 int test_vas(test_data *data, int count)  {
-
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    amd_vrsa_erfcinvf(count, ip, op);
+  #endif
   return 0;
 }
 
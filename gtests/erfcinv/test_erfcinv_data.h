@@ -38,7 +38,31 @@
  */
 static libm_test_special_data_f32
 test_erfcinvf_conformance_data[] = {
-
+    /*
+     * The float kernels handle special inputs with selects on the vector
+     * path and make no promise about the status flags, so none are
+     * expected.
+     */
+    { POS_ZERO_F32,    POS_INF_F32,     AMD_F_NONE },  /* erfcinvf(0) = +Inf */
+    { NEG_ZERO_F32,    POS_INF_F32,     AMD_F_NONE },  /* erfcinvf(-0) = +Inf */
+    { POS_ONE_F32,     POS_ZERO_F32,    AMD_F_NONE },  /* erfcinvf(1) = 0 */
+    { NEG_ONE_F32,     NEG_QNAN_F32,    AMD_F_NONE },  /* erfcinvf(-1) = NaN */
+    { POS_INF_F32,     NEG_QNAN_F32,    AMD_F_NONE },  /* erfcinvf(+Inf) = NaN */
+    { NEG_INF_F32,     NEG_QNAN_F32,    AMD_F_NONE },  /* erfcinvf(-Inf) = NaN */
+    { POS_QNAN_F32,    POS_QNAN_F32,    AMD_F_NONE },  /* erfcinvf(NaN) = NaN */
+    { NEG_QNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE },  /* erfcinvf(NaN) = NaN */
+    { POS_SNAN_F32,    POS_QNAN_F32,    AMD_F_NONE },  /* erfcinvf(NaN) = NaN */
+    { NEG_SNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE },  /* erfcinvf(NaN) = NaN */
+    { POS_LDENORM_F32, 0x4120513E,      AMD_F_NONE },  /* erfcinvf(1.40129846e-45) = 10.0198345, smallest denormal */
+    { POS_LNORMAL_F32, 0x41131CE0,      AMD_F_NONE },  /* erfcinvf(1.17549435e-38) = 9.19454956, FLT_MIN */
+    { 0x40000000,      NEG_INF_F32,     AMD_F_NONE },  /* erfcinvf(2) = -Inf, pole at 2 */
+    { 0x3FFFFFFF,      0xC06F9C68,      AMD_F_NONE },  /* erfcinvf(1.99999988) = -3.74392128, largest below 2 */
+    { 0x3F7FFFFF,      0x3362DFC5,      AMD_F_NONE },  /* erfcinvf(0.99999994) = 5.28232427e-08, largest below 1 */
+    { 0x3F800001,      0xB3E2DFC5,      AMD_F_NONE },  /* erfcinvf(1.00000012) = -1.05646485e-07, smallest above 1 */
+    { 0x3F000000,      0x3EF430FE,      AMD_F_NONE },  /* erfcinvf(0.5) = 0.476936281 */
+    { 0x3FC00000,      0xBEF430FE,      AMD_F_NONE },  /* erfcinvf(1.5) = -0.476936281 */
+    { 0x3A83126F,      0x4014E989,      AMD_F_NONE },  /* erfcinvf(0.00100000005) = 2.32675385 */
+    { 0x40400000,      NEG_QNAN_F32,    AMD_F_NONE },  /* erfcinvf(3) = NaN, out of domain */
 };
 
 static libm_test_special_data_f64
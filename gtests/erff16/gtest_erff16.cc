@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "almhalf.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * erff16 over all 65536 FP16 inputs: the error against the correctly
+ * rounded reference must stay within the bound quoted in
+ * src/optimized/half/erff16.c, and every variant must agree with the
+ * array variant bit for bit.
+ */
+
+#define ERFF16_ULP_BOUND 0.501
+
+static const HalfKernel erff16_kernel = {
+  "erff16",
+  amd_erff16,
+  amd_vrh8_erff16,
+  amd_vrh16_erff16,
+#if defined(__AVX512__)
+  amd_vrh32_erff16,
+#endif
+  amd_vrha_erff16,
+  alm_mp_erff,
+};
+
+#define HALF_REPORT(name, var)                                                \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail);            \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_EXHAUSTIVE) {
+  int ntests = HALF_NUM_VALUES, nfail;
+  double max_ulp;
+
+  nfail = HalfExhaustive(&erff16_kernel, ERFF16_ULP_BOUND, &max_ulp, vflag);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
+          "Exhaustive", "Accuracy", "vrha", ntests, (ntests - nfail), nfail,
+          max_ulp);
+  ptr->tstcnt++;
+  EXPECT_EQ(nfail, 0);
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_VARIANTS) {
+  int ntests = 0, nfail;
+
+  nfail = HalfVariants(&erff16_kernel, &ntests, vflag);
+  HALF_REPORT("Variants", "s1h/vrh");
+}
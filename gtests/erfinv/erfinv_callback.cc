@@ -41,6 +41,7 @@
 
 #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
 double LIBM_FUNC(erfinv)(double);
+float LIBM_FUNC(erfinvf)(float);
 #endif
 
 static uint32_t ipargs = 1;
@@ -67,7 +68,7 @@ void ConfSetupf64(SpecParams *specp) {
 }
 
 float getFuncOp(float *data) {
-  return 0.0;
+  return LIBM_FUNC(erfinvf)(data[0]);
 }
 
 double getFuncOp(double *data) {
@@ -83,9 +84,7 @@ double getFuncOp(double *data) {
 }
 
 double getExpected(float *data) {
-  /* Not implemented now */
-  /* auto val = alm_mp_erfinvf(data[0]); */
-  double val=0;
+  auto val = alm_mp_erfinvf(data[0]);
   return val;
 }
 
@@ -115,6 +114,11 @@ double getGlibcOp(double *data) {
 *FUNCTIONS*
 **********************/
 int test_s1s(test_data *data, int idx)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    op[0] = LIBM_FUNC(erfinvf)(ip[idx]);
+  #endif
   return 0;
 }
 
@@ -139,9 +143,12 @@ extern "C" {
 #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL || LIBM_PROTOTYPE == PROTOTYPE_SVML)
   __m128d LIBM_FUNC_VEC(d, 2, erfinv)(__m128d);
   __m256d LIBM_FUNC_VEC(d, 4, erfinv)(__m256d);
+  __m128 LIBM_FUNC_VEC(s, 4, erfinvf)(__m128);
+  __m256 LIBM_FUNC_VEC(s, 8, erfinvf)(__m256);
 
   #if defined(__AVX512__)
   __m512d LIBM_FUNC_VEC(d, 8, erfinv)(__m512d);
+  __m512 LIBM_FUNC_VEC(s, 16, erfinvf)(__m512);
   #endif
 #endif
 
@@ -162,6 +169,13 @@ int test_v2d(test_data *data, int idx)  {
 }
 
 int test_v4s(test_data *data, int idx)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    __m128 ip4 = _mm_set_ps(ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
+    __m128 op4 = LIBM_FUNC_VEC(s, 4, erfinvf)(ip4);
+    _mm_store_ps(&op[0], op4);
+  #endif
   return 0;
 }
 
@@ -182,6 +196,14 @@ int test_v4d(test_data *data, int idx)  {
 }
 
 int test_v8s(test_data *data, int idx)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    __m256 ip8 = _mm256_set_ps(ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
+                               ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
+    __m256 op8 = LIBM_FUNC_VEC(s, 8, erfinvf)(ip8);
+    _mm256_store_ps(&op[0], op8);
+  #endif
   return 0;
 }
 
@@ -205,10 +227,27 @@ int test_v8d(test_data *data, int idx)  {
 }
 
 int test_v16s(test_data *data, int idx)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    #if defined(__AVX512__)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    __m512 ip16 = _mm512_set_ps(ip[idx+15], ip[idx+14], ip[idx+13], ip[idx+12],
+                                ip[idx+11], ip[idx+10], ip[idx+9], ip[idx+8],
+                                ip[idx+7], ip[idx+6], ip[idx+5], ip[idx+4],
+                                ip[idx+3], ip[idx+2], ip[idx+1], ip[idx]);
+    __m512 op16 = LIBM_FUNC_VEC(s, 16, erfinvf)(ip16);
+    _mm512_store_ps(&op[0], op16);
+    #endif /* __AVX512__ */
+  #endif
   return 0;
 }
 
 int test_vas(test_data *data, int count)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    amd_vrsa_erfinvf(count, ip, op);
+  #endif
   return 0;
 }
 
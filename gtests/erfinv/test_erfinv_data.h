@@ -33,7 +33,7 @@
 #include <libm_util_amd.h>
 
 /*
- * Conformance test cases for erfinv() - double precision
+ * Conformance test cases for erfinvf() and erfinv()
  *
  * Test Strategy:
  * 1. Special IEEE 754 values (±0, ±1, ±Inf, NaN)
@@ -47,8 +47,30 @@
 
 static libm_test_special_data_f32
 test_erfinvf_conformance_data[] = {
-    /* TODO: Add float conformance data */
-    /* For now, focusing on double precision tests */
+    /*
+     * The float kernels handle special inputs with selects on the vector
+     * path and make no promise about the status flags, so none are
+     * expected.
+     */
+    { POS_ZERO_F32,    POS_ZERO_F32,    AMD_F_NONE },  /* erfinvf(0) = 0 */
+    { NEG_ZERO_F32,    NEG_ZERO_F32,    AMD_F_NONE },  /* erfinvf(-0) = -0 */
+    { POS_ONE_F32,     POS_INF_F32,     AMD_F_NONE },  /* erfinvf(1) = +Inf */
+    { NEG_ONE_F32,     NEG_INF_F32,     AMD_F_NONE },  /* erfinvf(-1) = -Inf */
+    { POS_INF_F32,     NEG_QNAN_F32,    AMD_F_NONE },  /* erfinvf(+Inf) = NaN */
+    { NEG_INF_F32,     NEG_QNAN_F32,    AMD_F_NONE },  /* erfinvf(-Inf) = NaN */
+    { POS_QNAN_F32,    POS_QNAN_F32,    AMD_F_NONE },  /* erfinvf(NaN) = NaN */
+    { NEG_QNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE },  /* erfinvf(NaN) = NaN */
+    { POS_SNAN_F32,    POS_QNAN_F32,    AMD_F_NONE },  /* erfinvf(NaN) = NaN */
+    { NEG_SNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE },  /* erfinvf(NaN) = NaN */
+    { POS_LDENORM_F32, 0x00000001,      AMD_F_NONE },  /* erfinvf(1.40129846e-45) = 1.40129846e-45, smallest denormal */
+    { POS_LNORMAL_F32, 0x00716FE2,      AMD_F_NONE },  /* erfinvf(1.17549435e-38) = 1.04175471e-38, FLT_MIN */
+    { 0x3F7FFFFF,      0x407547CB,      AMD_F_NONE },  /* erfinvf(0.99999994) = 3.8325069, largest below 1 */
+    { 0xBF7FFFFF,      0xC07547CB,      AMD_F_NONE },  /* erfinvf(-0.99999994) = -3.8325069, largest above -1 */
+    { 0x3F000000,      0x3EF430FE,      AMD_F_NONE },  /* erfinvf(0.5) = 0.476936281 */
+    { 0xBF000000,      0xBEF430FE,      AMD_F_NONE },  /* erfinvf(-0.5) = -0.476936281 */
+    { 0x3F7FF000,      0x40260277,      AMD_F_NONE },  /* erfinvf(0.999755859) = 2.59390044, near 1 */
+    { 0x3A83126F,      0x3A6851B3,      AMD_F_NONE },  /* erfinvf(0.00100000005) = 0.000886227179 */
+    { 0x40000000,      NEG_QNAN_F32,    AMD_F_NONE },  /* erfinvf(2) = NaN, out of domain */
 };
 
 static libm_test_special_data_f64
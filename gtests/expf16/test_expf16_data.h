@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_EXPF16_DATA_H__
+#define __TEST_EXPF16_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for expf16(), as the float values of FP16 inputs
+ * and correctly rounded FP16 results: zeros, infinities, NaNs, subnormals,
+ * the largest finite value, and the overflow and underflow thresholds.
+ *
+ * The FP16 kernels keep special inputs on the vector path (see
+ * include/libm/alm_half.h) and make no promise about the status flags, so
+ * none are expected.
+ */
+
+static libm_test_special_data_f32
+test_expf16_conformance_data[] = {
+    { 0x00000000, 0x3F800000, AMD_F_NONE },  /* +0: exp(0) = 1 */
+    { 0x80000000, 0x3F800000, AMD_F_NONE },  /* -0: exp(-0) = 1 */
+    { 0x7F800000, 0x7F800000, AMD_F_NONE },  /* +Inf: exp(inf) = inf */
+    { 0xFF800000, 0x00000000, AMD_F_NONE },  /* -Inf: exp(-inf) = 0 */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: exp(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: exp(-nan) = -nan */
+    { 0x33800000, 0x3F800000, AMD_F_NONE },  /* min subnormal: exp(5.96046448e-08) = 1 */
+    { 0xB3800000, 0x3F800000, AMD_F_NONE },  /* -min subnormal: exp(-5.96046448e-08) = 1 */
+    { 0x387FC000, 0x3F800000, AMD_F_NONE },  /* max subnormal: exp(6.09755516e-05) = 1 */
+    { 0x38800000, 0x3F800000, AMD_F_NONE },  /* min normal: exp(6.10351562e-05) = 1 */
+    { 0x3F800000, 0x402E0000, AMD_F_NONE },  /* 1: exp(1) = 2.71875 */
+    { 0xBF800000, 0x3EBC6000, AMD_F_NONE },  /* -1: exp(-1) = 0.367919922 */
+    { 0x477FE000, 0x7F800000, AMD_F_NONE },  /* max: exp(65504) = inf */
+    { 0xC77FE000, 0x00000000, AMD_F_NONE },  /* -max: exp(-65504) = 0 */
+    { 0x41316000, 0x477EE000, AMD_F_NONE },  /* last finite: exp(11.0859375) = 65248 */
+    { 0x41318000, 0x7F800000, AMD_F_NONE },  /* overflow: exp(11.09375) = inf */
+    { 0x41400000, 0x7F800000, AMD_F_NONE },  /* overflow: exp(12) = inf */
+    { 0xC11B4000, 0x38802000, AMD_F_NONE },  /* min normal result: exp(-9.703125) = 6.10947609e-05 */
+    { 0xC18AA000, 0x33800000, AMD_F_NONE },  /* last nonzero: exp(-17.328125) = 5.96046448e-08 */
+    { 0xC18AC000, 0x00000000, AMD_F_NONE },  /* underflow: exp(-17.34375) = 0 */
+    { 0xC1A00000, 0x00000000, AMD_F_NONE },  /* underflow: exp(-20) = 0 */
+    { 0x3F000000, 0x3FD30000, AMD_F_NONE },  /* 0.5: exp(0.5) = 1.6484375 */
+};
+
+#endif /*__TEST_EXPF16_DATA_H__*/
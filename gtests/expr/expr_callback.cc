@@ -0,0 +1,184 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <cmath>
+#include "libm_tests.h"
+#include <libm_macros.h>
+
+#include <libm_amd.h>
+#include <libm/amd_funcs_internal.h>
+#include <fmaintrin.h>
+#include <immintrin.h>
+#include "callback.h"
+#include "test_expr_data.h"
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * The generic tests run the fused program exp(2x - 1) * 0.5. Both constant
+ * steps are exact, so the reference is the correctly rounded exp of the
+ * affine result, halved. gtest_expr.cc covers the other operations.
+ */
+
+static uint32_t ipargs = 1;
+bool special_case = false;
+
+static const alm_expr_t *GetExpr(void)
+{
+  static alm_expr_t expr;
+  static int done = 0;
+
+  if (!done) {
+    alm_expr_init(&expr);
+    alm_expr_arg(&expr, 0);
+    alm_expr_affine(&expr, 2.0, -1.0);
+    alm_expr_op(&expr, ALM_EXPR_EXP);
+    alm_expr_const(&expr, 0.5);
+    alm_expr_op(&expr, ALM_EXPR_MUL);
+    alm_expr_compile(&expr);
+    done = 1;
+  }
+  return &expr;
+}
+
+uint32_t GetnIpArgs( void )
+{
+  return ipargs;
+}
+
+bool getSpecialCase(void)
+{
+  return special_case;
+}
+
+void ConfSetupf32(SpecParams *specp) {
+  specp->data32 = test_exprf_conformance_data;
+  specp->countf = ARRAY_SIZE(test_exprf_conformance_data);
+}
+
+void ConfSetupf64(SpecParams *specp) {
+  specp->data64 = test_expr_conformance_data;
+  specp->countd = ARRAY_SIZE(test_expr_conformance_data);
+}
+
+float getFuncOp(float *data) {
+  return LIBM_FUNC(expf)(2.0f * data[0] - 1.0f) * 0.5f;
+}
+
+double getFuncOp(double *data) {
+  return LIBM_FUNC(exp)(2.0 * data[0] - 1.0) * 0.5;
+}
+
+double getExpected(float *data) {
+  float t = 2.0f * data[0] - 1.0f;
+  auto val = alm_mp_expf(t) * 0.5;
+  return val;
+}
+
+long double getExpected(double *data) {
+  double t = 2.0 * data[0] - 1.0;
+  auto val = alm_mp_exp(t) * 0.5L;
+  return val;
+}
+
+// Used by the Complex Number Functions only!
+double _Complex getExpected(float _Complex *data) {
+  return 0.0;
+}
+
+long double _Complex getExpected(double _Complex *data) {
+  return 0.0;
+}
+
+float getGlibcOp(float *data) {
+  return expf(2.0f * data[0] - 1.0f) * 0.5f;
+}
+
+double getGlibcOp(double *data) {
+  return exp(2.0 * data[0] - 1.0) * 0.5;
+}
+
+/**********************
+*FUNCTIONS*
+**********************/
+int test_s1s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_s1d(test_data *data, int idx)  {
+  return 0;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int test_v2d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v8s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v8d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v16s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_vas(test_data *data, int count)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    const float *args[1] = { (const float*)data->ip };
+    float *op  = (float*)data->op;
+    alm_expr_executef(GetExpr(), count, args, op);
+  #endif
+  return 0;
+}
+
+int test_vad(test_data *data, int count)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    const double *args[1] = { (const double*)data->ip };
+    double *op  = (double*)data->op;
+    alm_expr_execute(GetExpr(), count, args, op);
+  #endif
+  return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include <string>
+#include <cstring>
+#include <vector>
+#include <chrono>
+#include "benchmark.h"
+#include "almtestperf.h"
+#include "callback.h"
+
+using namespace std;
+using namespace ALM;
+
+/*
+ * The same program as the generic benchmark, run as separate passes over the
+ * whole array, for comparison with the fused version.
+ */
+static void LibmPerfTestUnfusedd(benchmark::State& st, InputParams* param) {
+  AoclLibmTest<double> objtest(param, GetnIpArgs());
+  unsigned int n = param->count;
+  double szn = param->niter * param->count;
+
+  for (auto _ : st) {
+    for (unsigned int i = 0; i < n; i++)
+      objtest.outbuff[i] = 2.0 * objtest.inpbuff[i] - 1.0;
+    amd_vrda_exp(n, objtest.outbuff, objtest.outbuff);
+    for (unsigned int i = 0; i < n; i++)
+      objtest.outbuff[i] *= 0.5;
+  }
+
+  namespace bm = benchmark;
+  st.counters["MOPS"] = bm::Counter{szn, bm::Counter::kIsRate};
+}
+
+static void LibmPerfTestUnfusedf(benchmark::State& st, InputParams* param) {
+  AoclLibmTest<float> objtest(param, GetnIpArgs());
+  unsigned int n = param->count;
+  double szn = param->niter * param->count;
+
+  for (auto _ : st) {
+    for (unsigned int i = 0; i < n; i++)
+      objtest.outbuff[i] = 2.0f * objtest.inpbuff[i] - 1.0f;
+    amd_vrsa_expf(n, objtest.outbuff, objtest.outbuff);
+    for (unsigned int i = 0; i < n; i++)
+      objtest.outbuff[i] *= 0.5f;
+  }
+
+  namespace bm = benchmark;
+  st.counters["MOPS"] = bm::Counter{szn, bm::Counter::kIsRate};
+}
+
+int AlmTestPerfFramework::AlmTestPerformance(InputParams *params) {
+  string funcnam = "AoclLibm";
+  string libm;
+
+  if((params->fqty != ALM::FloatQuantity::E_All) &&
+     (params->fqty != ALM::FloatQuantity::E_Vector_Array)) {
+    cout << "Only the array variants (-e 32) are available for expr" << endl;
+    return 0;
+  }
+
+  if((params->fwidth == ALM::FloatWidth::E_ALL) ||
+    (params->fwidth == ALM::FloatWidth::E_F64)) {
+    string varnam = "_vad(expr_execute)";
+    libm = funcnam + varnam;
+    benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestad, params)
+               ->Args({(int)params->count})->Iterations(params->niter);
+
+    varnam = "_vad(unfused)";
+    libm = funcnam + varnam;
+    benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestUnfusedd, params)
+               ->Args({(int)params->count})->Iterations(params->niter);
+  }
+
+  if((params->fwidth == ALM::FloatWidth::E_ALL) ||
+    (params->fwidth == ALM::FloatWidth::E_F32)) {
+    string varnam = "_vas(expr_executef)";
+    libm = funcnam + varnam;
+    benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestaf, params)
+               ->Args({(int)params->count})->Iterations(params->niter);
+
+    varnam = "_vas(unfused)";
+    libm = funcnam + varnam;
+    benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestUnfusedf, params)
+               ->Args({(int)params->count})->Iterations(params->niter);
+  }
+
+  size_t retval = benchmark::RunSpecifiedBenchmarks();
+
+  return (int)retval;
+}
+
+
+AlmTestPerfFramework::~AlmTestPerfFramework() {
+#if defined(DEBUG_PRINTS)
+  cout << "AlmTestPerfFramework destructor completed" << endl;
+#endif
+}
@@ -0,0 +1,718 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <cfenv>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+
+/*
+ * Fused expression pipeline (alm_expr_*) against the unfused chain.
+ *
+ * Each program below is a list of build steps. The same list builds the
+ * alm_expr, drives a naive evaluation that runs every step as a separate
+ * pass over the whole array with the amd_vrda_* / amd_vrsa_* kernels, and
+ * drives a long double reference in which every intermediate step is
+ * rounded to the working precision.
+ *
+ * The fused pipeline calls the same kernels on 512 element blocks, so its
+ * results must be bit-identical to the naive chain (any NaN matching any
+ * NaN). The scales in the programs are powers of two and the merged affine
+ * steps only add a shift to a scaled value, so folding a constant into an
+ * affine step, and merging two affine steps, is exact. A constant exponent
+ * is documented to run through powx, which the naive chain does as well.
+ */
+
+enum {
+  EXPR_STEP_ARG = 100,
+  EXPR_STEP_CONST,
+  EXPR_STEP_AFFINE,
+  EXPR_STEP_POWX,
+};
+
+typedef struct {
+  int    op;
+  int    arg;
+  double a;
+  double b;
+} ExprStep;
+
+typedef struct {
+  const char     *name;
+  int             nargs;
+  int             nsteps;
+  const ExprStep *steps;
+} ExprProgram;
+
+#define ARG(i)         { EXPR_STEP_ARG, i, 0.0, 0.0 }
+#define CONST(v)       { EXPR_STEP_CONST, 0, v, 0.0 }
+#define AFFINE(s, c)   { EXPR_STEP_AFFINE, 0, s, c }
+#define POWX(y)        { EXPR_STEP_POWX, 0, y, 0.0 }
+#define OP(o)          { ALM_EXPR_##o, 0, 0.0, 0.0 }
+
+/* exp(2x - 1) * 0.5, the program of the generic tests */
+static const ExprStep expr_p0[] = {
+  ARG(0), AFFINE(2.0, -1.0), OP(EXP), CONST(0.5), OP(MUL),
+};
+/* sin(x) * cos(y) */
+static const ExprStep expr_p1[] = {
+  ARG(0), OP(SIN), ARG(1), OP(COS), OP(MUL),
+};
+/* log1p(|x|) + sqrt(|y|) */
+static const ExprStep expr_p2[] = {
+  ARG(0), OP(FABS), OP(LOG1P), ARG(1), OP(FABS), OP(SQRT), OP(ADD),
+};
+/* fmax(x, y) - fmin(x, y) */
+static const ExprStep expr_p3[] = {
+  ARG(0), ARG(1), OP(FMAX), ARG(0), ARG(1), OP(FMIN), OP(SUB),
+};
+/* x / (1 + exp(-x)), the constant folded into an affine step */
+static const ExprStep expr_p4[] = {
+  ARG(0), ARG(0), AFFINE(-1.0, 0.0), OP(EXP), CONST(1.0), OP(ADD), OP(DIV),
+};
+/* cbrt(cosh(atan(x))) */
+static const ExprStep expr_p5[] = {
+  ARG(0), OP(ATAN), OP(COSH), OP(CBRT),
+};
+/* log2(|x| + 1) + log10(|y| + 1), one shift through an explicit subtract */
+static const ExprStep expr_p6[] = {
+  ARG(0), OP(FABS), CONST(1.0), OP(ADD), OP(LOG2),
+  ARG(1), OP(FABS), CONST(-1.0), OP(SUB), OP(LOG10), OP(ADD),
+};
+/* expm1(erf(x)) * exp2(y / 64) */
+static const ExprStep expr_p7[] = {
+  ARG(0), OP(ERF), OP(EXPM1), ARG(1), CONST(0.015625), OP(MUL), OP(EXP2),
+  OP(MUL),
+};
+/* sqrt(pow(2|x| + 2, y / 1024)), two affine steps merged and a folded pow */
+static const ExprStep expr_p8[] = {
+  ARG(0), OP(FABS), AFFINE(2.0, 0.0), AFFINE(1.0, 2.0),
+  ARG(1), AFFINE(0x1p-10, 0.0), OP(POW), CONST(0.5), OP(POW),
+};
+/* tan(x / 4) / (1 - y), the constant left on the stack */
+static const ExprStep expr_p9[] = {
+  ARG(0), CONST(0.25), OP(MUL), OP(TAN), CONST(1.0), ARG(1), OP(SUB), OP(DIV),
+};
+/* 1 / log(|x|) through an explicit powx step */
+static const ExprStep expr_p10[] = {
+  ARG(0), OP(FABS), OP(LOG), POWX(-1.0),
+};
+/* x / (y * (z + w)), the full stack depth */
+static const ExprStep expr_p11[] = {
+  ARG(0), ARG(1), ARG(2), ARG(3), OP(ADD), OP(MUL), OP(DIV),
+};
+/* A lone argument and a lone constant */
+static const ExprStep expr_p12[] = { ARG(1) };
+static const ExprStep expr_p13[] = { CONST(-3.0) };
+
+#define EXPR_PROGRAM(name, nargs, steps) { name, nargs, ARRAY_SIZE(steps), steps }
+
+static const ExprProgram expr_programs[] = {
+  EXPR_PROGRAM("exp(2x-1)/2",     1, expr_p0),
+  EXPR_PROGRAM("sin*cos",         2, expr_p1),
+  EXPR_PROGRAM("log1p+sqrt",      2, expr_p2),
+  EXPR_PROGRAM("fmax-fmin",       2, expr_p3),
+  EXPR_PROGRAM("x/(1+exp(-x))",   1, expr_p4),
+  EXPR_PROGRAM("cbrt(cosh(atan))", 1, expr_p5),
+  EXPR_PROGRAM("log2+log10",      2, expr_p6),
+  EXPR_PROGRAM("expm1(erf)*exp2", 2, expr_p7),
+  EXPR_PROGRAM("sqrt(pow)",       2, expr_p8),
+  EXPR_PROGRAM("tan/(1-y)",       2, expr_p9),
+  EXPR_PROGRAM("1/log",           1, expr_p10),
+  EXPR_PROGRAM("x/(y*(z+w))",     4, expr_p11),
+  EXPR_PROGRAM("arg",             2, expr_p12),
+  EXPR_PROGRAM("const",           1, expr_p13),
+};
+
+static int BuildProgram(const ExprProgram *p, alm_expr_t *expr)
+{
+  alm_expr_init(expr);
+  for (int k = 0; k < p->nsteps; k++) {
+    const ExprStep *s = &p->steps[k];
+    int rc;
+
+    switch (s->op) {
+    case EXPR_STEP_ARG:    rc = alm_expr_arg(expr, s->arg); break;
+    case EXPR_STEP_CONST:  rc = alm_expr_const(expr, s->a); break;
+    case EXPR_STEP_AFFINE: rc = alm_expr_affine(expr, s->a, s->b); break;
+    case EXPR_STEP_POWX:   rc = alm_expr_powx(expr, s->a); break;
+    default:               rc = alm_expr_op(expr, (alm_expr_op_t)s->op); break;
+    }
+    if (rc != 0)
+      return rc;
+  }
+  return alm_expr_compile(expr);
+}
+
+static bool ExprIsBinary(int op)
+{
+  return op == ALM_EXPR_ADD || op == ALM_EXPR_SUB || op == ALM_EXPR_MUL ||
+         op == ALM_EXPR_DIV || op == ALM_EXPR_POW || op == ALM_EXPR_FMAX ||
+         op == ALM_EXPR_FMIN;
+}
+
+template <typename T> struct ExprOps;
+
+template <> struct ExprOps<double> {
+  typedef uint64_t bits;
+  typedef long double ref;
+  static constexpr bits canary = 0x7ff4deadbeef5a5aULL;
+
+  static int execute(const alm_expr_t *e, size_t n, const double *const *a,
+                     double *r) {
+    return alm_expr_execute(e, n, a, r);
+  }
+  static void powx(int n, const double *x, double y, double *r) {
+    amd_vrda_powx(n, x, y, r);
+  }
+  static void binary(int op, int n, const double *x, const double *y, double *r) {
+    switch (op) {
+    case ALM_EXPR_ADD:  amd_vrda_add(n, x, y, r); break;
+    case ALM_EXPR_SUB:  amd_vrda_sub(n, x, y, r); break;
+    case ALM_EXPR_MUL:  amd_vrda_mul(n, x, y, r); break;
+    case ALM_EXPR_DIV:  amd_vrda_div(n, x, y, r); break;
+    case ALM_EXPR_POW:  amd_vrda_pow(n, x, y, r); break;
+    case ALM_EXPR_FMAX: amd_vrda_fmax(n, x, y, r); break;
+    case ALM_EXPR_FMIN: amd_vrda_fmin(n, x, y, r); break;
+    default: break;
+    }
+  }
+  static void unary(int op, int n, const double *x, double *r) {
+    switch (op) {
+    case ALM_EXPR_EXP:   amd_vrda_exp(n, x, r); break;
+    case ALM_EXPR_EXP2:  amd_vrda_exp2(n, x, r); break;
+    case ALM_EXPR_EXPM1: amd_vrda_expm1(n, x, r); break;
+    case ALM_EXPR_LOG:   amd_vrda_log(n, x, r); break;
+    case ALM_EXPR_LOG2:  amd_vrda_log2(n, x, r); break;
+    case ALM_EXPR_LOG10: amd_vrda_log10(n, x, r); break;
+    case ALM_EXPR_LOG1P: amd_vrda_log1p(n, x, r); break;
+    case ALM_EXPR_SIN:   amd_vrda_sin(n, x, r); break;
+    case ALM_EXPR_COS:   amd_vrda_cos(n, x, r); break;
+    case ALM_EXPR_TAN:   amd_vrda_tan(n, x, r); break;
+    case ALM_EXPR_ATAN:  amd_vrda_atan(n, x, r); break;
+    case ALM_EXPR_COSH:  amd_vrda_cosh(n, x, r); break;
+    case ALM_EXPR_SQRT:  amd_vrda_sqrt(n, x, r); break;
+    case ALM_EXPR_CBRT:  amd_vrda_cbrt(n, x, r); break;
+    case ALM_EXPR_ERF:   amd_vrda_erf(n, x, r); break;
+    case ALM_EXPR_FABS:  amd_vrda_fabs(n, x, r); break;
+    default: break;
+    }
+  }
+};
+
+template <> struct ExprOps<float> {
+  typedef uint32_t bits;
+  typedef double ref;
+  static constexpr bits canary = 0x7fa5a5a5U;
+
+  static int execute(const alm_expr_t *e, size_t n, const float *const *a,
+                     float *r) {
+    return alm_expr_executef(e, n, a, r);
+  }
+  static void powx(int n, const float *x, float y, float *r) {
+    amd_vrsa_powxf(n, x, y, r);
+  }
+  static void binary(int op, int n, const float *x, const float *y, float *r) {
+    switch (op) {
+    case ALM_EXPR_ADD:  amd_vrsa_addf(n, x, y, r); break;
+    case ALM_EXPR_SUB:  amd_vrsa_subf(n, x, y, r); break;
+    case ALM_EXPR_MUL:  amd_vrsa_mulf(n, x, y, r); break;
+    case ALM_EXPR_DIV:  amd_vrsa_divf(n, x, y, r); break;
+    case ALM_EXPR_POW:  amd_vrsa_powf(n, x, y, r); break;
+    case ALM_EXPR_FMAX: amd_vrsa_fmaxf(n, x, y, r); break;
+    case ALM_EXPR_FMIN: amd_vrsa_fminf(n, x, y, r); break;
+    default: break;
+    }
+  }
+  static void unary(int op, int n, const float *x, float *r) {
+    switch (op) {
+    case ALM_EXPR_EXP:   amd_vrsa_expf(n, x, r); break;
+    case ALM_EXPR_EXP2:  amd_vrsa_exp2f(n, x, r); break;
+    case ALM_EXPR_EXPM1: amd_vrsa_expm1f(n, x, r); break;
+    case ALM_EXPR_LOG:   amd_vrsa_logf(n, x, r); break;
+    case ALM_EXPR_LOG2:  amd_vrsa_log2f(n, x, r); break;
+    case ALM_EXPR_LOG10: amd_vrsa_log10f(n, x, r); break;
+    case ALM_EXPR_LOG1P: amd_vrsa_log1pf(n, x, r); break;
+    case ALM_EXPR_SIN:   amd_vrsa_sinf(n, x, r); break;
+    case ALM_EXPR_COS:   amd_vrsa_cosf(n, x, r); break;
+    case ALM_EXPR_TAN:   amd_vrsa_tanf(n, x, r); break;
+    case ALM_EXPR_ATAN:  amd_vrsa_atanf(n, x, r); break;
+    case ALM_EXPR_COSH:  amd_vrsa_coshf(n, x, r); break;
+    case ALM_EXPR_SQRT:  amd_vrsa_sqrtf(n, x, r); break;
+    case ALM_EXPR_CBRT:  amd_vrsa_cbrtf(n, x, r); break;
+    case ALM_EXPR_ERF:   amd_vrsa_erff(n, x, r); break;
+    case ALM_EXPR_FABS:  amd_vrsa_fabsf(n, x, r); break;
+    default: break;
+    }
+  }
+};
+
+/* Every step as its own pass over the n elements */
+template <typename T>
+static void NaiveChain(const ExprProgram *p, size_t n, const T *const *args,
+                       T *dst)
+{
+  std::vector<std::vector<T> > stack;
+  int len = (int)n;
+
+  if (n == 0)
+    return;
+
+  for (int k = 0; k < p->nsteps; k++) {
+    const ExprStep *s = &p->steps[k];
+    T a = (T)s->a, b = (T)s->b;
+
+    if (s->op == EXPR_STEP_ARG) {
+      stack.push_back(std::vector<T>(args[s->arg], args[s->arg] + n));
+      continue;
+    }
+    if (s->op == EXPR_STEP_CONST && k + 1 < p->nsteps &&
+        p->steps[k + 1].op == ALM_EXPR_POW) {
+      ExprOps<T>::powx(len, stack.back().data(), a, stack.back().data());
+      k++;
+      continue;
+    }
+    if (s->op == EXPR_STEP_CONST) {
+      stack.push_back(std::vector<T>(n, a));
+      continue;
+    }
+
+    std::vector<T> r(n);
+    if (ExprIsBinary(s->op)) {
+      std::vector<T> y = stack.back();
+      stack.pop_back();
+      ExprOps<T>::binary(s->op, len, stack.back().data(), y.data(), r.data());
+    } else if (s->op == EXPR_STEP_AFFINE) {
+      for (size_t j = 0; j < n; j++)
+        r[j] = a * stack.back()[j] + b;
+    } else if (s->op == EXPR_STEP_POWX) {
+      ExprOps<T>::powx(len, stack.back().data(), a, r.data());
+    } else {
+      ExprOps<T>::unary(s->op, len, stack.back().data(), r.data());
+    }
+    stack.back() = r;
+  }
+  memcpy(dst, stack.back().data(), n * sizeof(T));
+}
+
+static long double RefUnary(int op, long double x)
+{
+  switch (op) {
+  case ALM_EXPR_EXP:   return expl(x);
+  case ALM_EXPR_EXP2:  return exp2l(x);
+  case ALM_EXPR_EXPM1: return expm1l(x);
+  case ALM_EXPR_LOG:   return logl(x);
+  case ALM_EXPR_LOG2:  return log2l(x);
+  case ALM_EXPR_LOG10: return log10l(x);
+  case ALM_EXPR_LOG1P: return log1pl(x);
+  case ALM_EXPR_SIN:   return sinl(x);
+  case ALM_EXPR_COS:   return cosl(x);
+  case ALM_EXPR_TAN:   return tanl(x);
+  case ALM_EXPR_ATAN:  return atanl(x);
+  case ALM_EXPR_COSH:  return coshl(x);
+  case ALM_EXPR_SQRT:  return sqrtl(x);
+  case ALM_EXPR_CBRT:  return cbrtl(x);
+  case ALM_EXPR_ERF:   return erfl(x);
+  case ALM_EXPR_FABS:  return fabsl(x);
+  default:             return NAN;
+  }
+}
+
+static long double RefBinary(int op, long double x, long double y)
+{
+  switch (op) {
+  case ALM_EXPR_ADD:  return x + y;
+  case ALM_EXPR_SUB:  return x - y;
+  case ALM_EXPR_MUL:  return x * y;
+  case ALM_EXPR_DIV:  return x / y;
+  case ALM_EXPR_POW:  return powl(x, y);
+  case ALM_EXPR_FMAX: return fmaxl(x, y);
+  case ALM_EXPR_FMIN: return fminl(x, y);
+  default:            return NAN;
+  }
+}
+
+/*
+ * One element in long double, each intermediate result rounded to T so the
+ * final ULP error is that of the last kernel plus what the earlier kernels
+ * lost beyond their own rounding.
+ */
+template <typename T>
+static typename ExprOps<T>::ref Reference(const ExprProgram *p, const T *x)
+{
+  long double stack[ALM_EXPR_MAX_DEPTH];
+  int sp = 0;
+
+  for (int k = 0; k < p->nsteps; k++) {
+    const ExprStep *s = &p->steps[k];
+    long double a = (T)s->a, b = (T)s->b, r;
+
+    if (s->op == EXPR_STEP_ARG) {
+      stack[sp++] = x[s->arg];
+      continue;
+    }
+    if (s->op == EXPR_STEP_CONST) {
+      stack[sp++] = a;
+      continue;
+    }
+    if (ExprIsBinary(s->op)) {
+      sp--;
+      r = RefBinary(s->op, stack[sp - 1], stack[sp]);
+    } else if (s->op == EXPR_STEP_AFFINE) {
+      r = a * stack[sp - 1] + b;
+    } else if (s->op == EXPR_STEP_POWX) {
+      r = powl(stack[sp - 1], a);
+    } else {
+      r = RefUnary(s->op, stack[sp - 1]);
+    }
+    stack[sp - 1] = k == p->nsteps - 1 ? r : (long double)(T)r;
+  }
+  return (typename ExprOps<T>::ref)stack[0];
+}
+
+template <typename T>
+static bool SameResult(T a, T b) {
+  if (std::isnan(a) && std::isnan(b))
+    return true;
+  return memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+/* The argument arrays: x from the fixture, the others permutations of it */
+template <typename T>
+static void MakeArgs(const T *in, uint32_t count, size_t n,
+                     std::vector<std::vector<T> > &args)
+{
+  args.assign(ALM_EXPR_MAX_ARGS, std::vector<T>(n));
+  for (size_t i = 0; i < n; i++) {
+    args[0][i] = in[i % count];
+    args[1][i] = in[(7 * i + 3) % count];
+    args[2][i] = in[count - 1 - i % count];
+    args[3][i] = in[(5 * i + 1) % count];
+  }
+}
+
+/*
+ * Run program p over n elements, dst guarded by canaries (or aliasing the
+ * first argument), against the naive chain.
+ */
+template <typename T>
+static int CheckFused(const ExprProgram *p, std::vector<std::vector<T> > args,
+                      size_t n, bool alias, int vflag)
+{
+  typedef typename ExprOps<T>::bits bits;
+  const size_t guard = 16;
+  std::vector<T> ref(n);
+  std::vector<bits> out(n + 2 * guard, ExprOps<T>::canary);
+  const T *argp[ALM_EXPR_MAX_ARGS];
+  T *dst = alias ? args[0].data() : (T *)out.data() + guard;
+  alm_expr_t expr;
+  int nfail = 0;
+
+  for (int j = 0; j < ALM_EXPR_MAX_ARGS; j++)
+    argp[j] = args[j].data();
+
+  NaiveChain(p, n, argp, ref.data());
+
+  if (BuildProgram(p, &expr) != 0)
+    return 1;
+  if (ExprOps<T>::execute(&expr, n, argp, dst) != 0)
+    return 1;
+
+  for (size_t i = 0; i < n; i++) {
+    if (!SameResult(dst[i], ref[i])) {
+      nfail++;
+      if (vflag)
+        printf("%s n=%zu i=%zu: got %a expected %a\n", p->name, n, i,
+               (double)dst[i], (double)ref[i]);
+    }
+  }
+  if (!alias) {
+    for (size_t j = 0; j < guard; j++) {
+      nfail += out[j] != ExprOps<T>::canary;
+      nfail += out[guard + n + j] != ExprOps<T>::canary;
+    }
+  }
+  return nfail;
+}
+
+/* Lengths around the vector widths and the 512 element blocks */
+static const size_t expr_tails[] = { 0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 33,
+                                     511, 512, 513, 1024, 1025, 1539 };
+
+template <typename T>
+static void RunFused(const T *in, uint32_t count, int vflag, int *ntests,
+                     int *nfail)
+{
+  std::vector<std::vector<T> > args;
+
+  MakeArgs(in, count, count, args);
+  for (const ExprProgram &p : expr_programs) {
+    *nfail += CheckFused(&p, args, count, false, vflag);
+    *ntests += count;
+  }
+}
+
+/*
+ * Special values in every argument position, then the tail lengths on the
+ * calling thread and over four threads with a small grain, and dst aliasing
+ * the first argument.
+ */
+template <typename T>
+static void RunSpecials(int vflag, int *ntests, int *nfail)
+{
+  const T sv[] = {
+    (T)NAN, -(T)NAN, (T)INFINITY, -(T)INFINITY, (T)0.0, -(T)0.0, (T)1.0,
+    (T)-1.0, (T)0.5, (T)-2.0, std::numeric_limits<T>::max(),
+    -std::numeric_limits<T>::max(), std::numeric_limits<T>::min(),
+    std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min(),
+    (T)3.0, (T)-0.75, (T)100.0,
+  };
+  const size_t ns = ARRAY_SIZE(sv);
+  std::vector<std::vector<T> > args(ALM_EXPR_MAX_ARGS, std::vector<T>(ns * ns));
+  int nthreads = alm_get_num_threads();
+  size_t grain = alm_get_grain_size();
+
+  for (size_t i = 0; i < ns * ns; i++) {
+    args[0][i] = sv[i % ns];
+    args[1][i] = sv[i / ns];
+    args[2][i] = sv[(5 * i + 2) % ns];
+    args[3][i] = sv[(3 * i + 1) % ns];
+  }
+  for (const ExprProgram &p : expr_programs) {
+    *nfail += CheckFused(&p, args, ns * ns, false, vflag);
+    *ntests += (int)(ns * ns);
+  }
+
+  for (int pass = 0; pass < 2; pass++) {
+    if (pass == 1) {
+      alm_set_num_threads(4);
+      alm_set_grain_size(64);
+    }
+    for (size_t n : expr_tails) {
+      std::vector<T> seed(n + 1);
+      for (size_t i = 0; i <= n; i++)
+        seed[i] = sv[i % ns] + (T)(i % 97) * (T)0.125;
+      MakeArgs(seed.data(), (uint32_t)(n + 1), n, args);
+      for (const ExprProgram &p : expr_programs) {
+        *nfail += CheckFused(&p, args, n, false, vflag);
+        *ntests += (int)n + 1;
+        if (n == 0)
+          continue;
+        *nfail += CheckFused(&p, args, n, true, vflag);
+        *ntests += (int)n;
+      }
+    }
+  }
+
+  alm_set_num_threads(nthreads);
+  alm_set_grain_size(grain);
+}
+
+/*
+ * ULP error of the fused result against the long double reference. A non
+ * finite reference has to be matched in class. Every step of a program
+ * rounds, so the bound is looser than for a single kernel.
+ */
+#define EXPR_ULP_THRESHOLD 2.0
+
+template <typename T>
+static void RunAccuracy(const T *in, uint32_t count, InputData *inData,
+                        int vflag, int *ntests, int *nfail, double *max_ulp)
+{
+  std::vector<std::vector<T> > args;
+  std::vector<T> out(count);
+  const T *argp[ALM_EXPR_MAX_ARGS];
+  double max_ulp_err = inData->max_ulp_err;
+  alm_expr_t expr;
+
+  MakeArgs(in, count, count, args);
+  for (int j = 0; j < ALM_EXPR_MAX_ARGS; j++)
+    argp[j] = args[j].data();
+
+  for (const ExprProgram &p : expr_programs) {
+    if (BuildProgram(&p, &expr) != 0 ||
+        ExprOps<T>::execute(&expr, count, argp, out.data()) != 0) {
+      *nfail += count;
+      *ntests += count;
+      continue;
+    }
+    for (uint32_t i = 0; i < count; i++) {
+      T x[ALM_EXPR_MAX_ARGS] = { args[0][i], args[1][i], args[2][i], args[3][i] };
+      auto exptd = Reference(&p, x);
+      double ulp;
+
+      if (!std::isfinite(exptd)) {
+        bool same = std::isnan(exptd) ? (bool)std::isnan(out[i])
+                                      : (T)exptd == out[i];
+        ulp = same ? 0.0 : INFINITY;
+      } else {
+        ulp = getUlp(out[i], exptd);
+      }
+      if (!update_ulp(ulp, max_ulp_err, EXPR_ULP_THRESHOLD))
+        (*nfail)++;
+      if (vflag && ulp > EXPR_ULP_THRESHOLD)
+        printf("%s x=%a y=%a: got %a expected %La ulp %g\n", p.name,
+               (double)x[0], (double)x[1], (double)out[i],
+               (long double)exptd, ulp);
+    }
+    *ntests += count;
+  }
+  *max_ulp = max_ulp_err;
+}
+
+/* Programs alm_expr_compile() must reject, and execute before compile */
+static void RunBuild(int *ntests, int *nfail)
+{
+  const double x[1] = { 1.0 };
+  const double *argp[1] = { x };
+  double r[1];
+  alm_expr_t e;
+  int i;
+
+  /* Operator with nothing to pop */
+  alm_expr_init(&e);
+  *nfail += alm_expr_op(&e, ALM_EXPR_EXP) != -1;
+  *nfail += alm_expr_compile(&e) != -1;
+
+  /* Binary operator with one value on the stack */
+  alm_expr_init(&e);
+  alm_expr_arg(&e, 0);
+  *nfail += alm_expr_op(&e, ALM_EXPR_ADD) != -1;
+  *nfail += alm_expr_compile(&e) != -1;
+
+  /* A fifth value on the stack */
+  alm_expr_init(&e);
+  for (i = 0; i < ALM_EXPR_MAX_DEPTH; i++)
+    alm_expr_arg(&e, i);
+  *nfail += alm_expr_const(&e, 1.0) != -1;
+  *nfail += alm_expr_compile(&e) != -1;
+
+  /* Argument indices out of range */
+  alm_expr_init(&e);
+  *nfail += alm_expr_arg(&e, ALM_EXPR_MAX_ARGS) != -1;
+  *nfail += alm_expr_compile(&e) != -1;
+  alm_expr_init(&e);
+  *nfail += alm_expr_arg(&e, -1) != -1;
+  *nfail += alm_expr_compile(&e) != -1;
+
+  /* Unknown operator */
+  alm_expr_init(&e);
+  alm_expr_arg(&e, 0);
+  *nfail += alm_expr_op(&e, ALM_EXPR_OP_MAX) != -1;
+  *nfail += alm_expr_compile(&e) != -1;
+
+  /* One step more than ALM_EXPR_MAX_OPS */
+  alm_expr_init(&e);
+  alm_expr_arg(&e, 0);
+  for (i = 1; i < ALM_EXPR_MAX_OPS; i++)
+    *nfail += alm_expr_op(&e, ALM_EXPR_FABS) != 0;
+  *nfail += alm_expr_op(&e, ALM_EXPR_FABS) != -1;
+  *nfail += alm_expr_compile(&e) != -1;
+
+  /* Empty, and two values left on the stack */
+  alm_expr_init(&e);
+  *nfail += alm_expr_compile(&e) != -1;
+  alm_expr_init(&e);
+  alm_expr_arg(&e, 0);
+  alm_expr_arg(&e, 0);
+  *nfail += alm_expr_compile(&e) != -1;
+
+  /* Execute before compile, and a NULL destination */
+  alm_expr_init(&e);
+  alm_expr_arg(&e, 0);
+  *nfail += alm_expr_execute(&e, 1, argp, r) != -1;
+  *nfail += alm_expr_compile(&e) != 0;
+  *nfail += alm_expr_compile(&e) != 0;
+  *nfail += alm_expr_execute(&e, 1, argp, NULL) != -1;
+  *nfail += alm_expr_execute(&e, 0, argp, r) != 0;
+
+  *ntests += 21 + ALM_EXPR_MAX_OPS - 1;
+}
+
+#define EXPR_REPORT(name, var)                                                \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          "Expr", name, var, ntests, (ntests - nfail), nfail);                \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+#define EXPR_REPORT_ULP(var)                                                  \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",\
+          "Expr", "Accuracy", var, ntests, (ntests - nfail), nfail, max_ulp); \
+  ptr->tstcnt++
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_FUSED) {
+  int ntests = 0, nfail = 0;
+  RunFused(inpbuff, count, vflag, &ntests, &nfail);
+  EXPR_REPORT("Fused", "execute");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  RunSpecials<double>(vflag, &ntests, &nfail);
+  EXPR_REPORT("Specials", "execute");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_PROGRAMS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunAccuracy(inpbuff, count, inData, vflag, &ntests, &nfail, &max_ulp);
+  EXPR_REPORT_ULP("execute");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_BUILD) {
+  int ntests = 0, nfail = 0;
+  RunBuild(&ntests, &nfail);
+  EXPR_REPORT("Build", "compile");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_FUSED) {
+  int ntests = 0, nfail = 0;
+  RunFused(inpbuff, count, vflag, &ntests, &nfail);
+  EXPR_REPORT("Fused", "executef");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  RunSpecials<float>(vflag, &ntests, &nfail);
+  EXPR_REPORT("Specials", "executef");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_PROGRAMS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunAccuracy(inpbuff, count, inData, vflag, &ntests, &nfail, &max_ulp);
+  EXPR_REPORT_ULP("executef");
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __TEST_EXPR_DATA_H__
+#define __TEST_EXPR_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for the fused expression pipeline, run through
+ * the program exp(2x - 1) * 0.5 (arg, affine, exp, const, mul) with
+ * alm_expr_executef() and alm_expr_execute().
+ *
+ * The affine and scaling steps are exact for these inputs, so the expected
+ * value is exp(2x - 1) / 2 rounded once.
+ */
+
+static libm_test_special_data_f32
+test_exprf_conformance_data[] = {
+    { POS_ZERO_F32,    0x3e3c5ab2,      AMD_F_INEXACT   },  /* e^-1 / 2 */
+    { NEG_ZERO_F32,    0x3e3c5ab2,      AMD_F_INEXACT   },  /* e^-1 / 2 */
+    { 0x3f000000,      0x3f000000,      AMD_F_NONE      },  /* x = 0.5: 1/2 */
+    { POS_INF_F32,     POS_INF_F32,     AMD_F_NONE      },  /* +Inf */
+    { NEG_INF_F32,     POS_ZERO_F32,    AMD_F_NONE      },  /* -Inf: +0 */
+    { POS_QNAN_F32,    POS_QNAN_F32,    AMD_F_NONE      },  /* QNaN propagates */
+    { NEG_QNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE      },  /* -QNaN propagates */
+    { 0x42b17218,      POS_INF_F32,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* 2x - 1 overflows exp */
+    { POS_HNORMAL_F32, POS_INF_F32,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* 2x overflows */
+    { NEG_HNORMAL_F32, POS_ZERO_F32,    AMD_F_OVERFLOW | AMD_F_INEXACT },  /* 2x overflows to -Inf */
+    { 0xc2e00000,      POS_ZERO_F32,    AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* -112 */
+};
+
+static libm_test_special_data_f64
+test_expr_conformance_data[] = {
+    { POS_ZERO_F64,    0x3fc78b56362cef38, AMD_F_INEXACT },  /* e^-1 / 2 */
+    { NEG_ZERO_F64,    0x3fc78b56362cef38, AMD_F_INEXACT },  /* e^-1 / 2 */
+    { 0x3fe0000000000000, 0x3fe0000000000000, AMD_F_NONE },  /* x = 0.5: 1/2 */
+    { POS_INF_F64,     POS_INF_F64,     AMD_F_NONE      },  /* +Inf */
+    { NEG_INF_F64,     POS_ZERO_F64,    AMD_F_NONE      },  /* -Inf: +0 */
+    { POS_QNAN_F64,    POS_QNAN_F64,    AMD_F_NONE      },  /* QNaN propagates */
+    { NEG_QNAN_F64,    NEG_QNAN_F64,    AMD_F_NONE      },  /* -QNaN propagates */
+    { 0x40862e42fefa39f0, POS_INF_F64,  AMD_F_OVERFLOW | AMD_F_INEXACT },  /* 2x - 1 overflows exp */
+    { POS_HNORMAL_F64, POS_INF_F64,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* 2x overflows */
+    { NEG_HNORMAL_F64, POS_ZERO_F64,    AMD_F_OVERFLOW | AMD_F_INEXACT },  /* 2x overflows to -Inf */
+    { 0xc08f400000000000, POS_ZERO_F64, AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* -1000 */
+};
+
+#endif /*__TEST_EXPR_DATA_H__*/
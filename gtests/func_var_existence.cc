@@ -113,6 +113,16 @@ string validateFilterData(string func, string filter_data)
             if(find(supported_vars.begin(), supported_vars.end(), "vrsa") != supported_vars.end())
                 new_filter_data.append(temp + ":");
         }
+        else if(temp.find("VECTOR_ARRAY_COMPLEX_DOUBLE") != string::npos)
+        {
+            if(find(supported_vars.begin(), supported_vars.end(), "vrza") != supported_vars.end())
+                new_filter_data.append(temp + ":");
+        }
+        else if(temp.find("VECTOR_ARRAY_COMPLEX_FLOAT") != string::npos)
+        {
+            if(find(supported_vars.begin(), supported_vars.end(), "vrca") != supported_vars.end())
+                new_filter_data.append(temp + ":");
+        }
     }
     return new_filter_data;
 }
@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "almact.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * gelu_tanh(x) = x * sigmoid(2*sqrt(2/pi)*(x + 0.044715 x^3)). The array results must stay within the bound quoted in
+ * src/optimized/act/gelu_tanhf.c and gelu_tanh.c over the core range, both tails
+ * and the special values, and the 256-bit and 512-bit variants must agree
+ * with the array variant bit for bit.
+ */
+
+#define GELU_TANHF_ULP_BOUND 4.5
+#define GELU_TANH_ULP_BOUND  4.5
+
+static const ActKernel<float> gelu_tanhf_kernel = {
+  "gelu_tanhf",
+  amd_vrs8_gelu_tanhf,
+#if defined(__AVX512__)
+  amd_vrs16_gelu_tanhf,
+#endif
+  amd_vrsa_gelu_tanhf,
+  alm_mp_gelu_tanhf,
+  GELU_TANHF_ULP_BOUND,
+};
+
+static const ActKernel<double> gelu_tanh_kernel = {
+  "gelu_tanh",
+  amd_vrd4_gelu_tanh,
+#if defined(__AVX512__)
+  amd_vrd8_gelu_tanh,
+#endif
+  amd_vrda_gelu_tanh,
+  alm_mp_gelu_tanh,
+  GELU_TANH_ULP_BOUND,
+};
+
+static const ActRange gelu_tanh_ranges[] = {
+  {    -10.0,    10.0,   -10.0,   10.0 },   /* core */
+  {   -800.0,   -10.0,  -120.0,  -10.0 },   /* negative tail, to underflow */
+  {     10.0,  1000.0,    10.0,  200.0 },   /* positive tail */
+  {    -1e-6,    1e-6,   -1e-6,   1e-6 },   /* near zero */
+  {  -1e300,   1e300,   -1e37,   1e37 },    /* wide */
+};
+
+#define GELU_TANH_NPOINTS 20000
+
+#define ACT_REPORT(name, var)                                                 \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail);            \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_BOUND) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+
+  ActAccuracy(gelu_tanhf_kernel, inpbuff, (int)count, gelu_tanh_ranges,
+              ARRAY_SIZE(gelu_tanh_ranges), GELU_TANH_NPOINTS, vflag, &ntests,
+              &nfail, &max_ulp);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
+          "Bound", "Accuracy", "vrsa", ntests, (ntests - nfail), nfail,
+          max_ulp);
+  ptr->tstcnt++;
+  EXPECT_EQ(nfail, 0);
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_SPECIALS) {
+  int ntests = 0, nfail = 0;
+
+  ActSpecials(gelu_tanhf_kernel, vflag, &ntests, &nfail);
+  ACT_REPORT("Specials", "vrsa");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_VARIANTS) {
+  int ntests = 0, nfail = 0;
+
+  ActVariants(gelu_tanhf_kernel, gelu_tanh_ranges, ARRAY_SIZE(gelu_tanh_ranges), vflag,
+              &ntests, &nfail);
+  ACT_REPORT("Variants", "vrs8/vrs16");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_BOUND) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+
+  ActAccuracy(gelu_tanh_kernel, inpbuff, (int)count, gelu_tanh_ranges,
+              ARRAY_SIZE(gelu_tanh_ranges), GELU_TANH_NPOINTS, vflag, &ntests,
+              &nfail, &max_ulp);
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",
+          "Bound", "Accuracy", "vrda", ntests, (ntests - nfail), nfail,
+          max_ulp);
+  ptr->tstcnt++;
+  EXPECT_EQ(nfail, 0);
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_SPECIALS) {
+  int ntests = 0, nfail = 0;
+
+  ActSpecials(gelu_tanh_kernel, vflag, &ntests, &nfail);
+  ACT_REPORT("Specials", "vrda");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_VARIANTS) {
+  int ntests = 0, nfail = 0;
+
+  ActVariants(gelu_tanh_kernel, gelu_tanh_ranges, ARRAY_SIZE(gelu_tanh_ranges), vflag,
+              &ntests, &nfail);
+  ACT_REPORT("Variants", "vrd4/vrd8");
+}
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef __TEST_GELU_TANH_DATA_H__
+#define __TEST_GELU_TANH_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for gelu_tanh(): zeros, infinities, NaNs, subnormals,
+ * the extremes, and the tails where exp() underflows.
+ *
+ * The activation kernels keep special inputs on the vector path (see
+ * include/libm/alm_activation.h) and make no promise about the status
+ * flags, so none are expected.
+ */
+
+static libm_test_special_data_f32
+test_gelu_tanhf_conformance_data[] = {
+    { 0x00000000, 0x00000000, AMD_F_NONE },  /* +0: gelu_tanh(0) = 0 */
+    { 0x80000000, 0x80000000, AMD_F_NONE },  /* -0: gelu_tanh(-0) = -0 */
+    { 0x7F800000, 0x7F800000, AMD_F_NONE },  /* +Inf: gelu_tanh(inf) = inf */
+    { 0xFF800000, 0x80000000, AMD_F_NONE },  /* -Inf: gelu_tanh(-inf) = -0 */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: gelu_tanh(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: gelu_tanh(-nan) = -nan */
+    { 0x00000001, 0x00000000, AMD_F_NONE },  /* min subnormal: gelu_tanh(1.40129846e-45) = 0 */
+    { 0x80000001, 0x80000000, AMD_F_NONE },  /* -min subnormal: gelu_tanh(-1.40129846e-45) = -0 */
+    { 0x00800000, 0x00400000, AMD_F_NONE },  /* min normal: gelu_tanh(1.17549435e-38) = 5.87747175e-39 */
+    { 0x80800000, 0x80400000, AMD_F_NONE },  /* -min normal: gelu_tanh(-1.17549435e-38) = -5.87747175e-39 */
+    { 0x3F800000, 0x3F57585C, AMD_F_NONE },  /* 1: gelu_tanh(1) = 0.841192007 */
+    { 0xBF800000, 0xBE229E91, AMD_F_NONE },  /* -1: gelu_tanh(-1) = -0.158808008 */
+    { 0x3F000000, 0x3EB1016D, AMD_F_NONE },  /* 0.5: gelu_tanh(0.5) = 0.345714003 */
+    { 0xBF000000, 0xBE1DFD26, AMD_F_NONE },  /* -0.5: gelu_tanh(-0.5) = -0.154285997 */
+    { 0x41200000, 0x41200000, AMD_F_NONE },  /* 10: gelu_tanh(10) = 10 */
+    { 0xC1200000, 0x8223E47F, AMD_F_NONE },  /* -10: gelu_tanh(-10) = -1.20409239e-37 */
+    { 0x41A00000, 0x41A00000, AMD_F_NONE },  /* 20: gelu_tanh(20) = 20 */
+    { 0xC1A00000, 0x80000000, AMD_F_NONE },  /* -20: gelu_tanh(-20) = -0 */
+    { 0xC2B40000, 0x80000000, AMD_F_NONE },  /* exp underflow: gelu_tanh(-90) = -0 */
+    { 0xC2C80000, 0x80000000, AMD_F_NONE },  /* subnormal result: gelu_tanh(-100) = -0 */
+    { 0xC2DC0000, 0x80000000, AMD_F_NONE },  /* -110: gelu_tanh(-110) = -0 */
+    { 0x7F7FFFFF, 0x7F7FFFFF, AMD_F_NONE },  /* max: gelu_tanh(3.40282347e+38) = 3.40282347e+38 */
+    { 0xFF7FFFFF, 0x80000000, AMD_F_NONE },  /* -max: gelu_tanh(-3.40282347e+38) = -0 */
+};
+
+static libm_test_special_data_f64
+test_gelu_tanh_conformance_data[] = {
+    { 0x0000000000000000, 0x0000000000000000, AMD_F_NONE },  /* +0: gelu_tanh(0) = 0 */
+    { 0x8000000000000000, 0x8000000000000000, AMD_F_NONE },  /* -0: gelu_tanh(-0) = -0 */
+    { 0x7FF0000000000000, 0x7FF0000000000000, AMD_F_NONE },  /* +Inf: gelu_tanh(inf) = inf */
+    { 0xFFF0000000000000, 0x8000000000000000, AMD_F_NONE },  /* -Inf: gelu_tanh(-inf) = -0 */
+    { 0x7FF8000000000000, 0x7FF8000000000000, AMD_F_NONE },  /* +QNaN: gelu_tanh(nan) = nan */
+    { 0xFFF8000000000000, 0xFFF8000000000000, AMD_F_NONE },  /* -QNaN: gelu_tanh(-nan) = -nan */
+    { 0x0000000000000001, 0x0000000000000000, AMD_F_NONE },  /* min subnormal: gelu_tanh(4.9406564584124654e-324) = 0 */
+    { 0x8000000000000001, 0x8000000000000000, AMD_F_NONE },  /* -min subnormal: gelu_tanh(-4.9406564584124654e-324) = -0 */
+    { 0x0010000000000000, 0x0008000000000000, AMD_F_NONE },  /* min normal: gelu_tanh(2.2250738585072014e-308) = 1.1125369292536007e-308 */
+    { 0x8010000000000000, 0x8008000000000000, AMD_F_NONE },  /* -min normal: gelu_tanh(-2.2250738585072014e-308) = -1.1125369292536007e-308 */
+    { 0x3FF0000000000000, 0x3FEAEB0B772A3AE1, AMD_F_NONE },  /* 1: gelu_tanh(1) = 0.84119199060827665 */
+    { 0xBFF0000000000000, 0xBFC453D22357147A, AMD_F_NONE },  /* -1: gelu_tanh(-1) = -0.15880800939172329 */
+    { 0x3FE0000000000000, 0x3FD6202DA77DF3F9, AMD_F_NONE },  /* 0.5: gelu_tanh(0.5) = 0.34571400982514394 */
+    { 0xBFE0000000000000, 0xBFC3BFA4B104180F, AMD_F_NONE },  /* -0.5: gelu_tanh(-0.5) = -0.15428599017485609 */
+    { 0x4024000000000000, 0x4024000000000000, AMD_F_NONE },  /* 10: gelu_tanh(10) = 10 */
+    { 0xC024000000000000, 0xB8447C8FD5284FEA, AMD_F_NONE },  /* -10: gelu_tanh(-10) = -1.2040923482098061e-37 */
+    { 0x4044000000000000, 0x4044000000000000, AMD_F_NONE },  /* 40: gelu_tanh(40) = 40 */
+    { 0xC044000000000000, 0x8000000000000000, AMD_F_NONE },  /* -40: gelu_tanh(-40) = -0 */
+    { 0xC086300000000000, 0x8000000000000000, AMD_F_NONE },  /* exp underflow: gelu_tanh(-710) = -0 */
+    { 0xC086800000000000, 0x8000000000000000, AMD_F_NONE },  /* subnormal result: gelu_tanh(-720) = -0 */
+    { 0xC087C00000000000, 0x8000000000000000, AMD_F_NONE },  /* -760: gelu_tanh(-760) = -0 */
+    { 0x7FEFFFFFFFFFFFFF, 0x7FEFFFFFFFFFFFFF, AMD_F_NONE },  /* max: gelu_tanh(1.7976931348623157e+308) = 1.7976931348623157e+308 */
+    { 0xFFEFFFFFFFFFFFFF, 0x8000000000000000, AMD_F_NONE },  /* -max: gelu_tanh(-1.7976931348623157e+308) = -0 */
+};
+
+#endif /*__TEST_GELU_TANH_DATA_H__*/
@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_GELUBF16_DATA_H__
+#define __TEST_GELUBF16_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for vrba_gelubf16(), as the float values of BF16
+ * inputs and correctly rounded BF16 results, subnormal results flushed to
+ * zero: zeros, infinities, NaNs, subnormals, the largest finite value, and
+ * the negative tail down to the flush to zero.
+ *
+ * The BF16 kernels make no promise about the status flags, so none are
+ * expected.
+ */
+
+static libm_test_special_data_f32
+test_gelubf16_conformance_data[] = {
+    { 0x00000000, 0x00000000, AMD_F_NONE },  /* +0: gelu(0) = 0 */
+    { 0x80000000, 0x80000000, AMD_F_NONE },  /* -0: gelu(-0) = -0 */
+    { 0x7F800000, 0x7F800000, AMD_F_NONE },  /* +Inf: gelu(inf) = inf */
+    { 0xFF800000, 0x80000000, AMD_F_NONE },  /* -Inf: gelu(-inf) = -0 */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: gelu(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: gelu(-nan) = -nan */
+    { 0x00010000, 0x00000000, AMD_F_NONE },  /* min subnormal: gelu(9.18355e-41) = 0 */
+    { 0x007F0000, 0x00000000, AMD_F_NONE },  /* max subnormal: gelu(1.16631e-38) = 0 */
+    { 0x00800000, 0x00000000, AMD_F_NONE },  /* min normal: gelu(1.17549e-38) = 0 */
+    { 0x3F800000, 0x3F570000, AMD_F_NONE },  /* 1: gelu(1) = 0.839844 */
+    { 0xBF800000, 0xBE220000, AMD_F_NONE },  /* -1: gelu(-1) = -0.158203 */
+    { 0x7F7F0000, 0x7F7F0000, AMD_F_NONE },  /* max: gelu(3.38953e+38) = 3.38953e+38 */
+    { 0xFF7F0000, 0x80000000, AMD_F_NONE },  /* -max: gelu(-3.38953e+38) = -0 */
+    { 0x3F000000, 0x3EB10000, AMD_F_NONE },  /* 0.5: gelu(0.5) = 0.345703 */
+    { 0xBF000000, 0xBE1E0000, AMD_F_NONE },  /* -0.5: gelu(-0.5) = -0.154297 */
+    { 0x40400000, 0x40400000, AMD_F_NONE },  /* 3: gelu(3) = 3 */
+    { 0xC0400000, 0xBB850000, AMD_F_NONE },  /* -3: gelu(-3) = -0.00405884 */
+    { 0xC1200000, 0x9AB80000, AMD_F_NONE },  /* -10: gelu(-10) = -7.61006e-23 */
+    { 0xC1600000, 0x80000000, AMD_F_NONE },  /* flushed: gelu(-14) = -0 */
+    { 0x41200000, 0x41200000, AMD_F_NONE },  /* 10: gelu(10) = 10 */
+};
+
+#endif /*__TEST_GELUBF16_DATA_H__*/
@@ -0,0 +1,323 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __ALMACT_H__
+#define __ALMACT_H__
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <immintrin.h>
+#include "almstruct.h"
+
+/*
+ * Helpers for the activation function tests (sigmoid, softplus, gelu,
+ * gelu_tanh, silu, mish). Each function has 256-bit (vrs8/vrd4), 512-bit
+ * (vrs16/vrd8) and array variants, which must give identical results, and
+ * a documented ULP bound.
+ */
+
+double getUlp(float aop, double exptd);
+double getUlp(double aop, long double exptd);
+
+template <typename T> struct ActTraits;
+
+template <> struct ActTraits<float> {
+  typedef double ref;
+  typedef __m256 v256;
+#if defined(__AVX512__)
+  typedef __m512 v512;
+#endif
+  enum { N256 = 8, N512 = 16 };
+  static v256 load(const float *p) { return _mm256_loadu_ps(p); }
+  static void store(float *p, v256 v) { _mm256_storeu_ps(p, v); }
+#if defined(__AVX512__)
+  static v512 load512(const float *p) { return _mm512_loadu_ps(p); }
+  static void store512(float *p, v512 v) { _mm512_storeu_ps(p, v); }
+#endif
+};
+
+template <> struct ActTraits<double> {
+  typedef long double ref;
+  typedef __m256d v256;
+#if defined(__AVX512__)
+  typedef __m512d v512;
+#endif
+  enum { N256 = 4, N512 = 8 };
+  static v256 load(const double *p) { return _mm256_loadu_pd(p); }
+  static void store(double *p, v256 v) { _mm256_storeu_pd(p, v); }
+#if defined(__AVX512__)
+  static v512 load512(const double *p) { return _mm512_loadu_pd(p); }
+  static void store512(double *p, v512 v) { _mm512_storeu_pd(p, v); }
+#endif
+};
+
+/* One activation function in one precision */
+template <typename T>
+struct ActKernel {
+  const char *name;
+  typename ActTraits<T>::v256 (*v256)(typename ActTraits<T>::v256);
+#if defined(__AVX512__)
+  typename ActTraits<T>::v512 (*v512)(typename ActTraits<T>::v512);
+#endif
+  void (*array)(int, const T *, T *);
+  typename ActTraits<T>::ref (*ref)(T);
+  double bound;                 /* Max ULP quoted in the source */
+};
+
+typedef struct {
+  double lo, hi;       /* double range */
+  double lof, hif;     /* float range */
+} ActRange;
+
+/* Deterministic uniform values in [lo, hi] */
+template <typename T>
+static inline void ActFill(std::vector<T> &x, double lo, double hi,
+                           uint64_t seed)
+{
+  for (size_t i = 0; i < x.size(); i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    x[i] = (T)(lo + (hi - lo) * ((double)(seed >> 11) * 0x1p-53));
+  }
+}
+
+/*
+ * ULP error against the reference. Infinite, NaN and zero references need
+ * the same result, down to the sign of a zero.
+ */
+template <typename T>
+static inline double ActUlp(T got, typename ActTraits<T>::ref exptd)
+{
+  if (std::isnan(exptd))
+    return std::isnan(got) ? 0.0 : INFINITY;
+  if (std::isinf(exptd) || exptd == 0)
+    return (T)exptd == got && std::signbit(got) == std::signbit(exptd) ?
+           0.0 : INFINITY;
+  if (!std::isfinite(got))
+    return INFINITY;
+  return getUlp(got, exptd);
+}
+
+/* Array results against the reference, counting those above the bound */
+template <typename T>
+static inline void ActCheck(const ActKernel<T> &k, const std::vector<T> &x,
+                            int vflag, int *ntests, int *nfail,
+                            double *max_ulp)
+{
+  std::vector<T> y(x.size());
+
+  k.array((int)x.size(), x.data(), y.data());
+  for (size_t i = 0; i < x.size(); i++) {
+    double ulp = ActUlp(y[i], k.ref(x[i]));
+
+    if (ulp > *max_ulp)
+      *max_ulp = ulp;
+    if (ulp > k.bound) {
+      (*nfail)++;
+      if (vflag)
+        printf("%s(%a) = %a, %g ulp\n", k.name, (double)x[i], (double)y[i],
+               ulp);
+    }
+  }
+  *ntests += (int)x.size();
+}
+
+/* The fixture inputs and every range, against the quoted bound */
+template <typename T>
+static inline void ActAccuracy(const ActKernel<T> &k, const T *inp, int count,
+                               const ActRange *ranges, size_t nranges,
+                               int npoints, int vflag, int *ntests,
+                               int *nfail, double *max_ulp)
+{
+  bool dbl = sizeof(T) == sizeof(double);
+
+  ActCheck(k, std::vector<T>(inp, inp + count), vflag, ntests, nfail,
+           max_ulp);
+  for (size_t r = 0; r < nranges; r++) {
+    std::vector<T> x(npoints);
+
+    ActFill(x, dbl ? ranges[r].lo : ranges[r].lof,
+            dbl ? ranges[r].hi : ranges[r].hif, r + 1);
+    ActCheck(k, x, vflag, ntests, nfail, max_ulp);
+  }
+}
+
+/* Zeros, infinities, NaN, subnormals and the extremes, both signs */
+template <typename T>
+static inline std::vector<T> ActSpecialInputs(void)
+{
+  typedef std::numeric_limits<T> lim;
+  std::vector<T> v = { (T)0.0, lim::infinity(), lim::quiet_NaN(),
+                       lim::denorm_min(), lim::min() * (T)0.75, lim::min(),
+                       lim::max(), (T)1.0, lim::epsilon() };
+
+  for (size_t i = 0, n = v.size(); i < n; i++)
+    v.push_back(-v[i]);
+  return v;
+}
+
+template <typename T>
+static inline void ActSpecials(const ActKernel<T> &k, int vflag, int *ntests,
+                               int *nfail)
+{
+  std::vector<T> x = ActSpecialInputs<T>(), y(x.size());
+
+  k.array((int)x.size(), x.data(), y.data());
+  for (size_t i = 0; i < x.size(); i++) {
+    double ulp = ActUlp(y[i], k.ref(x[i]));
+
+    if (ulp > k.bound) {
+      (*nfail)++;
+      if (vflag)
+        printf("%s(%a) = %a, expected %La\n", k.name, (double)x[i],
+               (double)y[i], (long double)k.ref(x[i]));
+    }
+  }
+  *ntests += (int)x.size();
+}
+
+static inline bool ActSame(float a, float b)
+{
+  return std::isnan(a) ? (bool)std::isnan(b) : !memcmp(&a, &b, sizeof(a));
+}
+
+static inline bool ActSame(double a, double b)
+{
+  return std::isnan(a) ? (bool)std::isnan(b) : !memcmp(&a, &b, sizeof(a));
+}
+
+/* The special values and 256 values from each range, whole 512-bit vectors */
+template <typename T>
+static inline std::vector<T> ActVariantInputs(const ActRange *ranges,
+                                              size_t nranges)
+{
+  bool dbl = sizeof(T) == sizeof(double);
+  std::vector<T> x = ActSpecialInputs<T>();
+
+  for (size_t r = 0; r < nranges; r++) {
+    std::vector<T> v(256);
+    ActFill(v, dbl ? ranges[r].lo : ranges[r].lof,
+            dbl ? ranges[r].hi : ranges[r].hif, 100 + r);
+    x.insert(x.end(), v.begin(), v.end());
+  }
+  while (x.size() % ActTraits<T>::N512)
+    x.push_back((T)0.5);
+  return x;
+}
+
+/*
+ * The array variant must give the results in ref for every length and
+ * offset, in place or not, without writing past the end.
+ */
+template <typename T>
+static inline void ActArrayLengths(const ActKernel<T> &k,
+                                   const std::vector<T> &x,
+                                   const std::vector<T> &ref, int *ntests,
+                                   int *nfail)
+{
+  typedef ActTraits<T> tr;
+  const T canary = (T)-1234.5;
+  size_t j;
+
+  /* Every tail length of both vector widths, then a long one */
+  std::vector<size_t> lens;
+  for (size_t n = 0; n <= 2 * tr::N512 + 1; n++)
+    lens.push_back(n);
+  lens.push_back(1000);
+
+  for (size_t n : lens) {
+    for (size_t off : { (size_t)0, (size_t)3, x.size() - n }) {
+      if (off + n > x.size())
+        continue;
+
+      std::vector<T> out(n + 16, canary);
+      std::vector<T> buf(x.begin() + off, x.begin() + off + n);
+
+      k.array((int)n, &x[off], &out[8]);
+      k.array((int)n, buf.data(), buf.data());
+      for (j = 0; j < n; j++) {
+        *nfail += !ActSame(out[8 + j], ref[off + j]);
+        *nfail += !ActSame(buf[j], ref[off + j]);
+      }
+      for (j = 0; j < 8; j++)
+        *nfail += (out[j] != canary) + (out[8 + n + j] != canary);
+      *ntests += (int)(2 * n + 1);
+    }
+  }
+}
+
+/*
+ * The 256-bit and 512-bit variants must agree with the array variant bit
+ * for bit, and the array variant must give the same results for every
+ * length and offset, in place or not, without writing past the end.
+ */
+template <typename T>
+static inline void ActVariants(const ActKernel<T> &k, const ActRange *ranges,
+                               size_t nranges, int vflag, int *ntests,
+                               int *nfail)
+{
+  typedef ActTraits<T> tr;
+  std::vector<T> x = ActVariantInputs<T>(ranges, nranges);
+  size_t i;
+
+  std::vector<T> ref(x.size()), y(x.size());
+  k.array((int)x.size(), x.data(), ref.data());
+
+  for (i = 0; i < x.size(); i += tr::N256)
+    tr::store(&y[i], k.v256(tr::load(&x[i])));
+  for (i = 0; i < x.size(); i++) {
+    if (!ActSame(y[i], ref[i])) {
+      (*nfail)++;
+      if (vflag)
+        printf("%s 256-bit(%a) = %a, array %a\n", k.name, (double)x[i],
+               (double)y[i], (double)ref[i]);
+    }
+  }
+  *ntests += (int)x.size();
+
+#if defined(__AVX512__)
+  for (i = 0; i < x.size(); i += tr::N512)
+    tr::store512(&y[i], k.v512(tr::load512(&x[i])));
+  for (i = 0; i < x.size(); i++) {
+    if (!ActSame(y[i], ref[i])) {
+      (*nfail)++;
+      if (vflag)
+        printf("%s 512-bit(%a) = %a, array %a\n", k.name, (double)x[i],
+               (double)y[i], (double)ref[i]);
+    }
+  }
+  *ntests += (int)x.size();
+#endif
+
+  ActArrayLengths(k, x, ref, ntests, nfail);
+}
+
+#endif /* __ALMACT_H__ */
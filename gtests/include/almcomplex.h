@@ -0,0 +1,625 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef __ALMCOMPLEX_H__
+#define __ALMCOMPLEX_H__
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <immintrin.h>
+
+/*
+ * Helpers for the complex vector and array tests: vrz4/vrz8 and vrc8/vrc16
+ * vectors, vrza/vrca arrays, interleaved and split, dispatched and per
+ * architecture, all checked against the scalar function of the same name.
+ *
+ * Every variant is wrapped into one form on interleaved (re, im) arrays,
+ * run(len, x, y, z): y is only read by binary functions (cpow), and z
+ * holds len reals for the functions with real results (cabs, carg).
+ *
+ * The vector lanes fall back to the scalar function for infinite and NaN
+ * operands and for results that overflow or underflow, so whenever an
+ * operand is not finite the result must be the scalar one bit for bit,
+ * and so must every zero or non-finite scalar result component (NaNs only
+ * need to be NaNs). Elsewhere each component may differ from the scalar
+ * one by a bound in ulp of the larger scalar component, which keeps the
+ * bound meaningful when one component cancels.
+ */
+
+enum { CPX_UNARY, CPX_BINARY, CPX_REAL };
+
+template <typename T> struct CpxTraits;
+
+template <> struct CpxTraits<double> {
+  typedef double _Complex C;
+  typedef long double R;
+};
+
+template <> struct CpxTraits<float> {
+  typedef float _Complex C;
+  typedef double R;
+};
+
+template <typename T>
+using CpxRun = std::function<void(int, const T *, const T *, T *)>;
+
+typedef struct {
+  const char *name;
+  int group;                    /* variants of a group agree bit for bit */
+  bool array;                   /* tails and canaries apply */
+} CpxVariantInfo;
+
+template <typename T>
+struct CpxVariant {
+  CpxVariantInfo info;
+  CpxRun<T> run;
+};
+
+template <typename T>
+struct CpxKernel {
+  const char *name;
+  int kind;
+  CpxRun<T> scalar;
+  std::vector<CpxVariant<T>> variants;   /* the dispatched array first */
+  double bound;
+  /* extra allowance for an input, cpow's |y log x|; may be null */
+  double (*slack)(T xre, T xim, T yre, T yim);
+};
+
+/* Scalar functions, element by element */
+template <typename T>
+static inline CpxRun<T> CpxScalar1(typename CpxTraits<T>::C (*f)(typename CpxTraits<T>::C))
+{
+  return [f](int n, const T *x, const T *, T *z) {
+    for (int i = 0; i < n; i++) {
+      typename CpxTraits<T>::C a, r;
+      __real__ a = x[2 * i];
+      __imag__ a = x[2 * i + 1];
+      r = f(a);
+      z[2 * i] = __real__ r;
+      z[2 * i + 1] = __imag__ r;
+    }
+  };
+}
+
+template <typename T>
+static inline CpxRun<T> CpxScalar2(typename CpxTraits<T>::C (*f)(typename CpxTraits<T>::C,
+                                                                  typename CpxTraits<T>::C))
+{
+  return [f](int n, const T *x, const T *y, T *z) {
+    for (int i = 0; i < n; i++) {
+      typename CpxTraits<T>::C a, b, r;
+      __real__ a = x[2 * i];
+      __imag__ a = x[2 * i + 1];
+      __real__ b = y[2 * i];
+      __imag__ b = y[2 * i + 1];
+      r = f(a, b);
+      z[2 * i] = __real__ r;
+      z[2 * i + 1] = __imag__ r;
+    }
+  };
+}
+
+template <typename T>
+static inline CpxRun<T> CpxScalarR(T (*f)(typename CpxTraits<T>::C))
+{
+  return [f](int n, const T *x, const T *, T *z) {
+    for (int i = 0; i < n; i++) {
+      typename CpxTraits<T>::C a;
+      __real__ a = x[2 * i];
+      __imag__ a = x[2 * i + 1];
+      z[i] = f(a);
+    }
+  };
+}
+
+/* Interleaved arrays; cabs and carg have the same signature */
+template <typename T>
+static inline CpxRun<T> CpxArray1(void (*f)(int, const T *, T *))
+{
+  return [f](int n, const T *x, const T *, T *z) { f(n, x, z); };
+}
+
+template <typename T>
+static inline CpxRun<T> CpxArray2(void (*f)(int, const T *, const T *, T *))
+{
+  return [f](int n, const T *x, const T *y, T *z) { f(n, x, y, z); };
+}
+
+/* Split arrays */
+template <typename T>
+static inline void CpxDeinterleave(int n, const T *x, std::vector<T> &re,
+                                   std::vector<T> &im)
+{
+  re.resize(n);
+  im.resize(n);
+  for (int i = 0; i < n; i++) {
+    re[i] = x[2 * i];
+    im[i] = x[2 * i + 1];
+  }
+}
+
+template <typename T>
+static inline CpxRun<T> CpxSplit1(void (*f)(int, const T *, const T *, T *, T *))
+{
+  return [f](int n, const T *x, const T *, T *z) {
+    std::vector<T> xr, xi, zr(n), zi(n);
+    CpxDeinterleave(n, x, xr, xi);
+    f(n, xr.data(), xi.data(), zr.data(), zi.data());
+    for (int i = 0; i < n; i++) {
+      z[2 * i] = zr[i];
+      z[2 * i + 1] = zi[i];
+    }
+  };
+}
+
+template <typename T>
+static inline CpxRun<T> CpxSplit2(void (*f)(int, const T *, const T *, const T *,
+                                            const T *, T *, T *))
+{
+  return [f](int n, const T *x, const T *y, T *z) {
+    std::vector<T> xr, xi, yr, yi, zr(n), zi(n);
+    CpxDeinterleave(n, x, xr, xi);
+    CpxDeinterleave(n, y, yr, yi);
+    f(n, xr.data(), xi.data(), yr.data(), yi.data(), zr.data(), zi.data());
+    for (int i = 0; i < n; i++) {
+      z[2 * i] = zr[i];
+      z[2 * i + 1] = zi[i];
+    }
+  };
+}
+
+template <typename T>
+static inline CpxRun<T> CpxSplitR(void (*f)(int, const T *, const T *, T *))
+{
+  return [f](int n, const T *x, const T *, T *z) {
+    std::vector<T> xr, xi;
+    CpxDeinterleave(n, x, xr, xi);
+    f(n, xr.data(), xi.data(), z);
+  };
+}
+
+/*
+ * Vectors, sizeof(V) / sizeof(T) complex values per call. The last
+ * partial vector is padded with 0.5 + 0.5i.
+ */
+template <typename T, typename V>
+static inline void CpxLoad(int n, int i, const T *x, V *re, V *im)
+{
+  const int w = sizeof(V) / sizeof(T);
+  T r[w], m[w];
+
+  for (int j = 0; j < w; j++) {
+    r[j] = i + j < n ? x[2 * (i + j)] : (T)0.5;
+    m[j] = i + j < n ? x[2 * (i + j) + 1] : (T)0.5;
+  }
+  memcpy(re, r, sizeof(V));
+  memcpy(im, m, sizeof(V));
+}
+
+template <typename T, typename V>
+static inline void CpxStore(int n, int i, V re, V im, T *z)
+{
+  const int w = sizeof(V) / sizeof(T);
+  T r[w], m[w];
+
+  memcpy(r, &re, sizeof(V));
+  memcpy(m, &im, sizeof(V));
+  for (int j = 0; j < w && i + j < n; j++) {
+    z[2 * (i + j)] = r[j];
+    z[2 * (i + j) + 1] = m[j];
+  }
+}
+
+template <typename T, typename V>
+static inline CpxRun<T> CpxVector1(void (*f)(V, V, V *, V *))
+{
+  return [f](int n, const T *x, const T *, T *z) {
+    const int w = sizeof(V) / sizeof(T);
+    for (int i = 0; i < n; i += w) {
+      V a, b, c, d;
+      CpxLoad(n, i, x, &a, &b);
+      f(a, b, &c, &d);
+      CpxStore(n, i, c, d, z);
+    }
+  };
+}
+
+template <typename T, typename V>
+static inline CpxRun<T> CpxVector2(void (*f)(V, V, V, V, V *, V *))
+{
+  return [f](int n, const T *x, const T *y, T *z) {
+    const int w = sizeof(V) / sizeof(T);
+    for (int i = 0; i < n; i += w) {
+      V a, b, c, d, e, g;
+      CpxLoad(n, i, x, &a, &b);
+      CpxLoad(n, i, y, &c, &d);
+      f(a, b, c, d, &e, &g);
+      CpxStore(n, i, e, g, z);
+    }
+  };
+}
+
+template <typename T, typename V>
+static inline CpxRun<T> CpxVectorR(V (*f)(V, V))
+{
+  return [f](int n, const T *x, const T *, T *z) {
+    const int w = sizeof(V) / sizeof(T);
+    for (int i = 0; i < n; i += w) {
+      V a, b, c;
+      T r[w];
+      CpxLoad(n, i, x, &a, &b);
+      c = f(a, b);
+      memcpy(r, &c, sizeof(V));
+      for (int j = 0; j < w && i + j < n; j++)
+        z[i + j] = r[j];
+    }
+  };
+}
+
+template <typename T>
+static inline CpxRun<T> CpxArrayR(void (*f)(int, const T *, T *))
+{
+  return CpxArray1<T>(f);
+}
+
+/*
+ * The variants of one function: K is 1, 2 or R for the unary, binary and
+ * real valued wrappers, arr/v256/v512 the array and vector prefixes and fn
+ * the function name, e.g. CPX_VARIANTS_256(double, 1, vrza, vrz4, cexp).
+ * The dispatched arrays form group 0, the AVX2 ones and the 256-bit
+ * vectors group 1, the Zen4 ones and the 512-bit vectors group 2.
+ */
+#define CPX_VARIANTS_256(T, K, arr, v256, fn)                                 \
+  { { #arr, 0, true }, CpxArray##K<T>(amd_##arr##_##fn) },                    \
+  { { #arr "_split", 0, true }, CpxSplit##K<T>(amd_##arr##_##fn##_split) },   \
+  { { #v256, 1, false }, CpxVector##K<T>(amd_##v256##_##fn) },                \
+  { { #arr " avx2", 1, true }, CpxArray##K<T>(amd_##arr##_##fn##_avx2) },     \
+  { { #arr "_split avx2", 1, true },                                          \
+    CpxSplit##K<T>(amd_##arr##_##fn##_split_avx2) }
+
+#define CPX_VARIANTS_512(T, K, arr, v512, fn)                                 \
+  { { #v512, 2, false }, CpxVector##K<T>(amd_##v512##_##fn) },                \
+  { { #arr " zn4", 2, true }, CpxArray##K<T>(amd_##arr##_##fn##_zn4) },       \
+  { { #arr "_split zn4", 2, true },                                           \
+    CpxSplit##K<T>(amd_##arr##_##fn##_split_zn4) }
+
+/* Per architecture array entry points, not in amdlibm_vec.h */
+#define CPX_DECLARE_1(T, arr, fn)                                             \
+  void amd_##arr##_##fn##_avx2(int, const T *, T *);                          \
+  void amd_##arr##_##fn##_zn4(int, const T *, T *);                           \
+  void amd_##arr##_##fn##_split_avx2(int, const T *, const T *, T *, T *);    \
+  void amd_##arr##_##fn##_split_zn4(int, const T *, const T *, T *, T *)
+
+#define CPX_DECLARE_2(T, arr, fn)                                             \
+  void amd_##arr##_##fn##_avx2(int, const T *, const T *, T *);               \
+  void amd_##arr##_##fn##_zn4(int, const T *, const T *, T *);                \
+  void amd_##arr##_##fn##_split_avx2(int, const T *, const T *, const T *,    \
+                                     const T *, T *, T *);                    \
+  void amd_##arr##_##fn##_split_zn4(int, const T *, const T *, const T *,     \
+                                    const T *, T *, T *)
+
+#define CPX_DECLARE_R(T, arr, fn)                                             \
+  void amd_##arr##_##fn##_avx2(int, const T *, T *);                          \
+  void amd_##arr##_##fn##_zn4(int, const T *, T *);                           \
+  void amd_##arr##_##fn##_split_avx2(int, const T *, const T *, T *);         \
+  void amd_##arr##_##fn##_split_zn4(int, const T *, const T *, T *)
+
+/*
+ * Input regions. CPX_BOX is uniform in [re_lo, re_hi] x [im_lo, im_hi].
+ * CPX_LOG takes log2 of the magnitudes uniform in the same intervals and
+ * random signs. CPX_RING is uniform in angle with |z| in [re_lo, re_hi].
+ */
+enum { CPX_BOX, CPX_LOG, CPX_RING };
+
+typedef struct {
+  int type;
+  double re_lo, re_hi, im_lo, im_hi;
+} CpxRegion;
+
+static inline double CpxNext(uint64_t *seed)
+{
+  *seed = *seed * 6364136223846793005ULL + 1442695040888963407ULL;
+  return (double)(*seed >> 11) * 0x1p-53;
+}
+
+template <typename T>
+static inline void CpxSample(const CpxRegion &r, int n, uint64_t seed,
+                             std::vector<T> &x)
+{
+  for (int i = 0; i < n; i++) {
+    double a, b, u = CpxNext(&seed), v = CpxNext(&seed);
+
+    switch (r.type) {
+    case CPX_LOG:
+      a = exp2(r.re_lo + (r.re_hi - r.re_lo) * u);
+      b = exp2(r.im_lo + (r.im_hi - r.im_lo) * v);
+      a = CpxNext(&seed) < 0.5 ? -a : a;
+      b = CpxNext(&seed) < 0.5 ? -b : b;
+      break;
+    case CPX_RING: {
+      double m = r.re_lo + (r.re_hi - r.re_lo) * u, t = 2 * M_PI * v;
+      a = m * cos(t);
+      b = m * sin(t);
+      break;
+    }
+    default:
+      a = r.re_lo + (r.re_hi - r.re_lo) * u;
+      b = r.im_lo + (r.im_hi - r.im_lo) * v;
+      break;
+    }
+    x.push_back((T)a);
+    x.push_back((T)b);
+  }
+}
+
+/* Values for the special grid: every pair is one input */
+template <typename T>
+static inline std::vector<T> CpxSpecialValues(void)
+{
+  typedef std::numeric_limits<T> L;
+  std::vector<T> v = { (T)0.0, (T)-0.0, L::infinity(), -L::infinity(),
+                       L::quiet_NaN(), -L::quiet_NaN(), (T)1.0, (T)-1.0,
+                       (T)0.5, (T)-2.0, (T)M_PI_2, (T)-M_PI, (T)3.0,
+                       L::denorm_min(), -L::denorm_min(), L::min(),
+                       -L::min(), L::max(), -L::max(), (T)1e-5, (T)-30.0,
+                       (T)100.0 };
+
+  /* around the overflow and underflow of exp */
+  if (sizeof(T) == sizeof(double)) {
+    v.push_back((T)709.5);
+    v.push_back((T)-745.0);
+    v.push_back((T)710.0);
+  } else {
+    v.push_back((T)88.5);
+    v.push_back((T)-104.0);
+    v.push_back((T)89.0);
+  }
+  return v;
+}
+
+template <typename T>
+static inline void CpxSpecialGrid(std::vector<T> &x)
+{
+  std::vector<T> v = CpxSpecialValues<T>();
+
+  for (T a : v) {
+    for (T b : v) {
+      x.push_back(a);
+      x.push_back(b);
+    }
+  }
+}
+
+/*
+ * n points from each region, region i seeded by seed + i; the two operands
+ * of a binary function take different seeds so they are not correlated.
+ */
+template <typename T>
+static inline std::vector<T> CpxInputs(const CpxRegion *r, size_t nr, int n,
+                                       uint64_t seed)
+{
+  std::vector<T> x;
+
+  for (size_t i = 0; i < nr; i++)
+    CpxSample(r[i], n, seed + i, x);
+  return x;
+}
+
+template <typename T>
+static inline bool CpxSpecial(T v)
+{
+  return !std::isfinite(v);
+}
+
+template <typename T>
+static inline bool CpxSameBits(T a, T b)
+{
+  return std::isnan(a) ? (bool)std::isnan(b) : memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+/*
+ * Error of element i of z against the scalar results s, in ulp of the
+ * larger scalar component. Lanes with an infinite or NaN operand go
+ * through the scalar function and must match it bit for bit, as must
+ * every zero, infinite or NaN scalar component; infinity is returned if
+ * they do not.
+ */
+template <typename T>
+static inline double CpxErr(int kind, const T *x, const T *y, const T *z,
+                            const T *s, int i)
+{
+  int nc = kind == CPX_REAL ? 1 : 2;
+  const T *zi = z + nc * i, *si = s + nc * i;
+  bool exact = CpxSpecial(x[2 * i]) || CpxSpecial(x[2 * i + 1]);
+
+  if (kind == CPX_BINARY)
+    exact = exact || CpxSpecial(y[2 * i]) || CpxSpecial(y[2 * i + 1]);
+
+  typename CpxTraits<T>::R m = 0, err = 0;
+  for (int c = 0; c < nc; c++) {
+    if (exact || si[c] == 0 || CpxSpecial(si[c])) {
+      if (!CpxSameBits(zi[c], si[c]))
+        return INFINITY;
+    } else if (fabs(si[c]) > m) {
+      m = fabs(si[c]);
+    }
+  }
+  if (m == 0)
+    return 0.0;
+
+  int e = ilogb((double)m) - (std::numeric_limits<T>::digits - 1);
+  if (e < std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits)
+    e = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits;
+
+  for (int c = 0; c < nc; c++) {
+    if (si[c] == 0 || CpxSpecial(si[c]))
+      continue;
+    if (!std::isfinite(zi[c]))
+      return INFINITY;
+    typename CpxTraits<T>::R d = fabs((typename CpxTraits<T>::R)zi[c] - si[c]);
+    if (d > err)
+      err = d;
+  }
+  return (double)ldexp((double)err, -e);
+}
+
+/*
+ * Every variant over x (and y) against the scalar function. Returns the
+ * largest error seen in *max_ulp.
+ */
+template <typename T>
+static inline void CpxAgainstScalar(const CpxKernel<T> &k,
+                                    const std::vector<T> &x,
+                                    const std::vector<T> &y, int vflag,
+                                    int *ntests, int *nfail, double *max_ulp)
+{
+  int n = (int)(x.size() / 2), nc = k.kind == CPX_REAL ? 1 : 2;
+  std::vector<T> s(nc * n), z(nc * n);
+  const T *yp = k.kind == CPX_BINARY ? y.data() : nullptr;
+
+  k.scalar(n, x.data(), yp, s.data());
+  for (const CpxVariant<T> &v : k.variants) {
+    v.run(n, x.data(), yp, z.data());
+    for (int i = 0; i < n; i++) {
+      double err = CpxErr(k.kind, x.data(), yp, z.data(), s.data(), i);
+      double lim = k.bound;
+
+      if (k.slack && std::isfinite(err))
+        lim += k.slack(x[2 * i], x[2 * i + 1], yp ? yp[2 * i] : 0,
+                       yp ? yp[2 * i + 1] : 0);
+      if (std::isfinite(err) && err > *max_ulp)
+        *max_ulp = err;
+      if (err > lim) {
+        (*nfail)++;
+        if (vflag) {
+          printf("%s %s(%a, %a", k.name, v.info.name, (double)x[2 * i],
+                 (double)x[2 * i + 1]);
+          if (yp)
+            printf("; %a, %a", (double)yp[2 * i], (double)yp[2 * i + 1]);
+          printf(") = %a, %a, scalar %a, %a, %g ulp\n", (double)z[nc * i],
+                 (double)z[nc * i + nc - 1], (double)s[nc * i],
+                 (double)s[nc * i + nc - 1], err);
+        }
+      }
+    }
+    *ntests += n;
+  }
+}
+
+/*
+ * Variants of one group agree bit for bit, and the array variants give
+ * the results of a whole call for every length and offset, in place for
+ * the interleaved unary arrays, without writing outside z.
+ */
+template <typename T>
+static inline void CpxVariants(const CpxKernel<T> &k, const std::vector<T> &x,
+                               const std::vector<T> &y, int vflag,
+                               int *ntests, int *nfail)
+{
+  int n = (int)(x.size() / 2), nc = k.kind == CPX_REAL ? 1 : 2;
+  const T *yp = k.kind == CPX_BINARY ? y.data() : nullptr;
+  const T canary = (T)-1234.5;
+  std::vector<std::vector<T>> out;
+
+  for (const CpxVariant<T> &v : k.variants) {
+    std::vector<T> z(nc * n);
+    v.run(n, x.data(), yp, z.data());
+    out.push_back(z);
+  }
+
+  for (size_t a = 0; a < k.variants.size(); a++) {
+    for (size_t b = 0; b < a; b++) {
+      if (k.variants[a].info.group != k.variants[b].info.group)
+        continue;
+      for (int i = 0; i < nc * n; i++) {
+        if (!CpxSameBits(out[a][i], out[b][i])) {
+          (*nfail)++;
+          if (vflag)
+            printf("%s: %s and %s differ at %d: %a, %a\n", k.name,
+                   k.variants[a].info.name, k.variants[b].info.name, i / nc,
+                   (double)out[a][i], (double)out[b][i]);
+        }
+      }
+      *ntests += n;
+    }
+  }
+
+  for (size_t a = 0; a < k.variants.size(); a++) {
+    const CpxVariant<T> &v = k.variants[a];
+    if (!v.info.array)
+      continue;
+    for (int len = 0; len <= 35; len++) {
+      for (int off : { 0, 3, n - len }) {
+        if (off < 0 || off + len > n)
+          continue;
+        std::vector<T> z(nc * len + 32, canary);
+        int bad = 0;
+
+        v.run(len, &x[2 * off], yp ? &y[2 * off] : nullptr, &z[16]);
+        for (int i = 0; i < nc * len; i++)
+          bad += !CpxSameBits(z[16 + i], out[a][nc * off + i]);
+        for (int i = 0; i < 16; i++)
+          bad += (z[i] != canary) + (z[16 + nc * len + i] != canary);
+
+        if (k.kind == CPX_UNARY) {
+          std::vector<T> w(x.begin() + 2 * off, x.begin() + 2 * (off + len));
+          v.run(len, w.data(), nullptr, w.data());
+          for (int i = 0; i < 2 * len; i++)
+            bad += !CpxSameBits(w[i], out[a][2 * off + i]);
+        }
+        if (bad) {
+          (*nfail)++;
+          if (vflag)
+            printf("%s %s: len %d offset %d differs from the whole call\n",
+                   k.name, v.info.name, len, off);
+        }
+        (*ntests)++;
+      }
+    }
+  }
+}
+
+/* One row of the result table, ntests and nfail (and max_ulp) in scope */
+#define CPX_REPORT(name, var)                                                 \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail);            \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+#define CPX_REPORT_ULP(name, var)                                             \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",\
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail, max_ulp);   \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+#endif /* __ALMCOMPLEX_H__ */
@@ -0,0 +1,431 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __ALMHALF_H__
+#define __ALMHALF_H__
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <immintrin.h>
+
+/*
+ * Helpers for the FP16 (IEEE binary16) and BF16 (bfloat16) tests.
+ *
+ * The conversions are done in software so that rounding a double reference
+ * to 16 bits is a single correctly rounded step (going through float would
+ * round twice). Errors are measured in ULPs of the 16-bit format: 2^(e - 10)
+ * for an FP16 result with exponent e, 2^(e - 7) for BF16.
+ */
+
+#define HALF_NUM_VALUES 65536
+
+static inline float HalfToFloat(uint16_t h)
+{
+  int e = (h >> 10) & 0x1f, m = h & 0x3ff;
+  float r;
+
+  if (e == 0)
+    r = ldexpf((float)m, -24);
+  else if (e == 0x1f)
+    r = m ? NAN : INFINITY;
+  else
+    r = ldexpf((float)(m | 0x400), e - 25);
+  return (h & 0x8000) ? -r : r;
+}
+
+/* Round to nearest even */
+static inline uint16_t DoubleToHalf(double d)
+{
+  uint16_t s = std::signbit(d) ? 0x8000 : 0;
+  double a = fabs(d), m;
+  int e;
+
+  if (std::isnan(d))
+    return s | 0x7e00;
+  if (a >= 65520.0)               /* 65504 + half an ulp rounds up */
+    return s | 0x7c00;
+  if (a < 0x1p-14)
+    return s | (uint16_t)nearbyint(a * 0x1p24);
+
+  e = ilogb(a);
+  m = nearbyint(ldexp(a, 10 - e));
+  if (m == 2048.0) {
+    m = 1024.0;
+    e++;
+  }
+  return s | (uint16_t)(((e + 15) << 10) | ((int)m - 1024));
+}
+
+static inline uint16_t FloatToHalf(float f)
+{
+  return DoubleToHalf((double)f);
+}
+
+static inline bool HalfIsNan(uint16_t h)
+{
+  return (h & 0x7fff) > 0x7c00;
+}
+
+/*
+ * Error of an FP16 result against the exact value, in FP16 ULPs. A result
+ * that is Inf or NaN only matches the same class, and Inf is accepted for
+ * a finite value that rounds to it.
+ */
+static inline double HalfUlpError(uint16_t got, double exact)
+{
+  double g = HalfToFloat(got), a = fabs(exact);
+  int e;
+
+  if (std::isnan(exact))
+    return HalfIsNan(got) ? 0.0 : INFINITY;
+  if (std::isnan(g))
+    return INFINITY;
+  if (std::isinf(g) || std::isinf(exact))
+    return DoubleToHalf(exact) == got ? 0.0 : INFINITY;
+
+  e = a < 0x1p-14 ? -14 : ilogb(a);
+  if (e > 15)
+    e = 15;
+  return fabs(g - exact) / ldexp(1.0, e - 10);
+}
+
+/* One FP16 function in all its variants, and its reference */
+typedef struct {
+  const char *name;
+  uint16_t (*scalar)(uint16_t);
+  __m128i  (*v8)(__m128i);
+  __m256i  (*v16)(__m256i);
+#if defined(__AVX512__)
+  __m512i  (*v32)(__m512i);
+#endif
+  void     (*array)(int, const uint16_t *, uint16_t *);
+  double   (*ref)(float);
+} HalfKernel;
+
+/*
+ * Every FP16 input through the array variant, against the reference.
+ * Returns the number of results above bound and the largest error.
+ */
+static inline int HalfExhaustive(const HalfKernel *k, double bound,
+                                 double *max_ulp, int vflag)
+{
+  std::vector<uint16_t> in(HALF_NUM_VALUES), out(HALF_NUM_VALUES);
+  int nfail = 0;
+
+  for (int i = 0; i < HALF_NUM_VALUES; i++)
+    in[i] = (uint16_t)i;
+  k->array(HALF_NUM_VALUES, in.data(), out.data());
+
+  *max_ulp = 0.0;
+  for (int i = 0; i < HALF_NUM_VALUES; i++) {
+    float x = HalfToFloat(in[i]);
+    double exact = std::isnan(x) ? (double)NAN : k->ref(x);
+    double ulp = HalfUlpError(out[i], exact);
+
+    if (ulp > *max_ulp)
+      *max_ulp = ulp;
+    if (ulp > bound) {
+      nfail++;
+      if (vflag)
+        printf("%s(0x%04x = %a): got 0x%04x (%a) expected %a, %g ulp\n",
+               k->name, in[i], (double)x, out[i],
+               (double)HalfToFloat(out[i]), exact, ulp);
+    }
+  }
+  return nfail;
+}
+
+static inline bool HalfSame(uint16_t a, uint16_t b)
+{
+  return a == b || (HalfIsNan(a) && HalfIsNan(b));
+}
+
+/*
+ * The scalar, 8, 16 (and 32) element variants over every input must agree
+ * with the array variant, and the array variant must give the same results
+ * for every length, in place or not, without writing past the end.
+ */
+static inline int HalfVariants(const HalfKernel *k, int *ntests, int vflag)
+{
+  static const int tails[] = { 0, 1, 2, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63,
+                               64, 65, 100, 1000 };
+  const uint16_t canary = 0x7e5a;
+  std::vector<uint16_t> in(HALF_NUM_VALUES), ref(HALF_NUM_VALUES);
+  int nfail = 0, i, j;
+
+  for (i = 0; i < HALF_NUM_VALUES; i++)
+    in[i] = (uint16_t)i;
+  k->array(HALF_NUM_VALUES, in.data(), ref.data());
+
+  for (i = 0; i < HALF_NUM_VALUES; i++) {
+    uint16_t r = k->scalar(in[i]);
+    if (!HalfSame(r, ref[i])) {
+      nfail++;
+      if (vflag)
+        printf("%s scalar(0x%04x) = 0x%04x, array 0x%04x\n", k->name, in[i],
+               r, ref[i]);
+    }
+  }
+  *ntests += HALF_NUM_VALUES;
+
+  for (i = 0; i < HALF_NUM_VALUES; i += 8) {
+    uint16_t r[8];
+    __m128i v = k->v8(_mm_loadu_si128((const __m128i *)&in[i]));
+    _mm_storeu_si128((__m128i *)r, v);
+    for (j = 0; j < 8; j++)
+      nfail += !HalfSame(r[j], ref[i + j]);
+  }
+  *ntests += HALF_NUM_VALUES;
+
+  for (i = 0; i < HALF_NUM_VALUES; i += 16) {
+    uint16_t r[16];
+    __m256i v = k->v16(_mm256_loadu_si256((const __m256i *)&in[i]));
+    _mm256_storeu_si256((__m256i *)r, v);
+    for (j = 0; j < 16; j++)
+      nfail += !HalfSame(r[j], ref[i + j]);
+  }
+  *ntests += HALF_NUM_VALUES;
+
+#if defined(__AVX512__)
+  for (i = 0; i < HALF_NUM_VALUES; i += 32) {
+    uint16_t r[32];
+    __m512i v = k->v32(_mm512_loadu_si512((const void *)&in[i]));
+    _mm512_storeu_si512((void *)r, v);
+    for (j = 0; j < 32; j++)
+      nfail += !HalfSame(r[j], ref[i + j]);
+  }
+  *ntests += HALF_NUM_VALUES;
+#endif
+
+  /* Tails starting at several offsets, then in place */
+  for (int n : tails) {
+    for (int off : { 0, 3, 0x3c00, HALF_NUM_VALUES - 1000 }) {
+      std::vector<uint16_t> out(n + 16, canary);
+      std::vector<uint16_t> buf(in.begin() + off, in.begin() + off + n);
+
+      k->array(n, &in[off], &out[8]);
+      k->array(n, buf.data(), buf.data());
+      for (j = 0; j < n; j++) {
+        nfail += !HalfSame(out[8 + j], ref[off + j]);
+        nfail += !HalfSame(buf[j], ref[off + j]);
+      }
+      for (j = 0; j < 8; j++)
+        nfail += (out[j] != canary) + (out[8 + n + j] != canary);
+      *ntests += 2 * n + 1;
+    }
+  }
+  return nfail;
+}
+
+/*
+ * BF16 is the upper half of binary32. The BF16 functions flush subnormal
+ * results to signed zero, like VCVTNEPS2BF16, and are measured on normal
+ * results only.
+ */
+static inline float BF16ToFloat(uint16_t h)
+{
+  uint32_t u = (uint32_t)h << 16;
+  float f;
+
+  memcpy(&f, &u, sizeof(f));
+  return f;
+}
+
+/* Round to nearest even, subnormals kept */
+static inline uint16_t DoubleToBF16(double d)
+{
+  uint16_t s = std::signbit(d) ? 0x8000 : 0;
+  double a = fabs(d), m;
+  int e;
+
+  if (std::isnan(d))
+    return s | 0x7fc0;
+  if (a >= 0x1.ffp127)            /* largest BF16 + half an ulp */
+    return s | 0x7f80;
+  if (a < 0x1p-126)
+    return s | (uint16_t)nearbyint(a * 0x1p133);
+
+  e = ilogb(a);
+  m = nearbyint(ldexp(a, 7 - e));
+  if (m == 256.0) {
+    m = 128.0;
+    e++;
+  }
+  return s | (uint16_t)(((e + 127) << 7) | ((int)m - 128));
+}
+
+static inline uint16_t FloatToBF16(float f)
+{
+  return DoubleToBF16((double)f);
+}
+
+/* The expected BF16 result: correctly rounded, then flushed */
+static inline uint16_t DoubleToBF16Ftz(double d)
+{
+  uint16_t r = DoubleToBF16(d);
+
+  return (r & 0x7f80) == 0 ? (r & 0x8000) : r;
+}
+
+static inline bool BF16IsNan(uint16_t h)
+{
+  return (h & 0x7fff) > 0x7f80;
+}
+
+/*
+ * Error of a BF16 result in BF16 ULPs, as HalfUlpError. A signed zero is
+ * accepted for an exact value below the normal range.
+ */
+static inline double BF16UlpError(uint16_t got, double exact)
+{
+  double g = BF16ToFloat(got), a = fabs(exact);
+  int e;
+
+  if (std::isnan(exact))
+    return BF16IsNan(got) ? 0.0 : INFINITY;
+  if (std::isnan(g))
+    return INFINITY;
+  if (std::isinf(g) || std::isinf(exact))
+    return DoubleToBF16(exact) == got ? 0.0 : INFINITY;
+  if (a < 0x1p-126 && g == 0.0 && std::signbit(g) == std::signbit(exact))
+    return 0.0;
+
+  e = a < 0x1p-126 ? -126 : ilogb(a);
+  if (e > 127)
+    e = 127;
+  return fabs(g - exact) / ldexp(1.0, e - 7);
+}
+
+typedef void (*BF16ArrayFunc)(int, const uint16_t *, uint16_t *);
+
+/*
+ * One BF16 function: the dispatched array variant, the AVX2 one (integer
+ * emulation of VCVTNEPS2BF16, used without AVX512_BF16) and the Zen4 one,
+ * and the reference.
+ */
+typedef struct {
+  const char    *name;
+  BF16ArrayFunc array;
+  BF16ArrayFunc avx2;
+  BF16ArrayFunc zn4;
+  double        (*ref)(float);
+} BF16Kernel;
+
+/* Every BF16 input through fn, as HalfExhaustive */
+static inline int BF16Exhaustive(const BF16Kernel *k, BF16ArrayFunc fn,
+                                 double bound, double *max_ulp, int vflag)
+{
+  std::vector<uint16_t> in(HALF_NUM_VALUES), out(HALF_NUM_VALUES);
+  int nfail = 0;
+
+  for (int i = 0; i < HALF_NUM_VALUES; i++)
+    in[i] = (uint16_t)i;
+  fn(HALF_NUM_VALUES, in.data(), out.data());
+
+  *max_ulp = 0.0;
+  for (int i = 0; i < HALF_NUM_VALUES; i++) {
+    float x = BF16ToFloat(in[i]);
+    double exact = std::isnan(x) ? (double)NAN : k->ref(x);
+    double ulp = BF16UlpError(out[i], exact);
+
+    if (ulp > *max_ulp)
+      *max_ulp = ulp;
+    if (ulp > bound) {
+      nfail++;
+      if (vflag)
+        printf("%s(0x%04x = %a): got 0x%04x (%a) expected %a, %g ulp\n",
+               k->name, in[i], (double)x, out[i],
+               (double)BF16ToFloat(out[i]), exact, ulp);
+    }
+  }
+  return nfail;
+}
+
+static inline bool BF16Same(uint16_t a, uint16_t b)
+{
+  return a == b || (BF16IsNan(a) && BF16IsNan(b));
+}
+
+/*
+ * The AVX2 and Zen4 variants must agree with the dispatched one over every
+ * input, and each must give the same results for every length, in place or
+ * not, without writing past the end.
+ */
+static inline int BF16Variants(const BF16Kernel *k, int *ntests, int vflag)
+{
+  static const int tails[] = { 0, 1, 2, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63,
+                               64, 65, 100, 1000 };
+  const BF16ArrayFunc fns[] = { k->array, k->avx2, k->zn4 };
+  const uint16_t canary = 0x7fa5;
+  std::vector<uint16_t> in(HALF_NUM_VALUES), ref(HALF_NUM_VALUES);
+  std::vector<uint16_t> r(HALF_NUM_VALUES);
+  int nfail = 0, j;
+
+  for (j = 0; j < HALF_NUM_VALUES; j++)
+    in[j] = (uint16_t)j;
+  k->array(HALF_NUM_VALUES, in.data(), ref.data());
+
+  for (BF16ArrayFunc fn : fns) {
+    if (fn == NULL)
+      continue;
+
+    fn(HALF_NUM_VALUES, in.data(), r.data());
+    for (j = 0; j < HALF_NUM_VALUES; j++) {
+      if (!BF16Same(r[j], ref[j])) {
+        nfail++;
+        if (vflag)
+          printf("%s(0x%04x) = 0x%04x, dispatched 0x%04x\n", k->name, in[j],
+                 r[j], ref[j]);
+      }
+    }
+    *ntests += HALF_NUM_VALUES;
+
+    for (int n : tails) {
+      for (int off : { 0, 3, 0x3f80, HALF_NUM_VALUES - 1000 }) {
+        std::vector<uint16_t> out(n + 16, canary);
+        std::vector<uint16_t> buf(in.begin() + off, in.begin() + off + n);
+
+        fn(n, &in[off], &out[8]);
+        fn(n, buf.data(), buf.data());
+        for (j = 0; j < n; j++) {
+          nfail += !BF16Same(out[8 + j], ref[off + j]);
+          nfail += !BF16Same(buf[j], ref[off + j]);
+        }
+        for (j = 0; j < 8; j++)
+          nfail += (out[j] != canary) + (out[8 + n + j] != canary);
+        *ntests += 2 * n + 1;
+      }
+    }
+  }
+  return nfail;
+}
+
+#endif /* __ALMHALF_H__ */
@@ -0,0 +1,272 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef __ALMNORMAL_H__
+#define __ALMNORMAL_H__
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include <immintrin.h>
+#include "almstruct.h"
+
+/*
+ * Helpers for the single precision erfinvf, erfcinvf, cdfnormf and
+ * cdfnorminvf tests. The kernels widen to double and round once, so the
+ * bound quoted in src/optimized/stat/ is close to 0.5 ulp, and the scalar,
+ * vrs4, vrs8, vrs16 and array variants, dispatched or not, must give
+ * identical results.
+ */
+
+double getUlp(float aop, double exptd);
+
+typedef void (*NrmArrayFunc)(int, const float *, float *);
+
+typedef struct {
+  const char *name;
+  float (*scalar)(float);
+  __m128 (*v4)(__m128);
+  __m256 (*v8)(__m256);
+#if defined(__AVX512__)
+  __m512 (*v16)(__m512);
+#endif
+  NrmArrayFunc array;
+  NrmArrayFunc avx2;            /* AVX2 array variant */
+#if defined(__AVX512__)
+  NrmArrayFunc zn4;             /* Zen4 array variant */
+#endif
+  double (*ref)(float);
+  double bound;                 /* Max ULP quoted in the source */
+} NrmKernel;
+
+/* Interval of the domain to sample, ends included */
+typedef struct {
+  float lo, hi;
+} NrmRange;
+
+static inline uint32_t NrmBits(float x)
+{
+  uint32_t u;
+  memcpy(&u, &x, sizeof(u));
+  return u;
+}
+
+static inline float NrmFloat(uint32_t u)
+{
+  float x;
+  memcpy(&x, &u, sizeof(x));
+  return x;
+}
+
+/*
+ * About npoints inputs from [lo, hi]: half of them evenly spaced in the
+ * float encoding, which gives every binade, down to the subnormals, the
+ * same share, and half uniform in value.
+ */
+static inline std::vector<float> NrmSample(const NrmRange &r, int npoints,
+                                           uint64_t seed)
+{
+  std::vector<float> x;
+  float lo = r.lo, hi = r.hi;
+
+  /* The encoding is monotonic on each side of zero */
+  if (lo < 0 && hi > 0) {
+    std::vector<float> a = NrmSample({ lo, -0.0f }, npoints / 2, seed);
+    std::vector<float> b = NrmSample({ 0.0f, hi }, npoints / 2, seed + 1);
+    a.insert(a.end(), b.begin(), b.end());
+    return a;
+  }
+
+  uint32_t a = NrmBits(fabsf(lo) < fabsf(hi) ? lo : hi);
+  uint32_t b = NrmBits(fabsf(lo) < fabsf(hi) ? hi : lo);
+  uint64_t n = (uint64_t)(b - a) + 1, step = n / (npoints / 2) + 1;
+
+  for (uint64_t i = 0; i < n; i += step)
+    x.push_back(NrmFloat(a + (uint32_t)i));
+  x.push_back(NrmFloat(b));
+
+  for (int i = 0; i < npoints / 2; i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    float v = (float)(lo + ((double)hi - lo) * ((double)(seed >> 11) * 0x1p-53));
+    x.push_back(v < lo ? lo : v > hi ? hi : v);
+  }
+  return x;
+}
+
+/* ULP error; infinite and NaN references need the same result */
+static inline double NrmUlp(float got, double exptd)
+{
+  if (std::isnan(exptd))
+    return std::isnan(got) ? 0.0 : INFINITY;
+  if (std::isinf(exptd) || (float)exptd == 0)
+    return (float)exptd == got ? 0.0 : INFINITY;
+  if (!std::isfinite(got))
+    return INFINITY;
+  return getUlp(got, exptd);
+}
+
+/* Array results over each range against the quoted bound */
+static inline void NrmAccuracy(const NrmKernel &k, const NrmRange *ranges,
+                               size_t nranges, int npoints, int vflag,
+                               int *ntests, int *nfail, double *max_ulp)
+{
+  for (size_t r = 0; r < nranges; r++) {
+    std::vector<float> x = NrmSample(ranges[r], npoints, r + 1);
+    std::vector<float> y(x.size());
+
+    k.array((int)x.size(), x.data(), y.data());
+    for (size_t i = 0; i < x.size(); i++) {
+      double ulp = NrmUlp(y[i], k.ref(x[i]));
+
+      if (ulp > *max_ulp)
+        *max_ulp = ulp;
+      if (ulp > k.bound) {
+        (*nfail)++;
+        if (vflag)
+          printf("%s(%a) = %a, expected %a, %g ulp\n", k.name, (double)x[i],
+                 (double)y[i], k.ref(x[i]), ulp);
+      }
+    }
+    *ntests += (int)x.size();
+  }
+}
+
+static inline bool NrmSame(float a, float b)
+{
+  return std::isnan(a) ? (bool)std::isnan(b) : NrmBits(a) == NrmBits(b);
+}
+
+/*
+ * Every variant against the dispatched array variant, over the ranges and
+ * the special inputs, then the array tails at several offsets, in place
+ * or not, without writing past the end.
+ */
+static inline void NrmVariants(const NrmKernel &k, const NrmRange *ranges,
+                               size_t nranges, int vflag, int *ntests,
+                               int *nfail)
+{
+  const float canary = -1234.5f;
+  std::vector<float> x = { 0.0f, -0.0f, 1.0f, -1.0f, 2.0f, -2.0f, 0.5f,
+                           INFINITY, -INFINITY, NAN, -NAN,
+                           std::numeric_limits<float>::denorm_min(),
+                           std::numeric_limits<float>::min(),
+                           std::numeric_limits<float>::max(),
+                           -std::numeric_limits<float>::max(),
+                           NrmFloat(0x3f7fffff), NrmFloat(0x3fffffff) };
+  size_t i, j;
+
+  for (size_t r = 0; r < nranges; r++) {
+    std::vector<float> v = NrmSample(ranges[r], 512, 100 + r);
+    x.insert(x.end(), v.begin(), v.end());
+  }
+  while (x.size() % 16)
+    x.push_back(0.25f);
+
+  size_t n = x.size();
+  std::vector<float> ref(n), y(n);
+  k.array((int)n, x.data(), ref.data());
+
+  struct { const char *name; std::vector<float> out; } runs[6];
+  int nruns = 0;
+
+  runs[nruns].name = "s1f";
+  for (i = 0; i < n; i++)
+    runs[nruns].out.push_back(k.scalar(x[i]));
+  nruns++;
+
+  runs[nruns].name = "vrs4";
+  runs[nruns].out.resize(n);
+  for (i = 0; i < n; i += 4)
+    _mm_storeu_ps(&runs[nruns].out[i], k.v4(_mm_loadu_ps(&x[i])));
+  nruns++;
+
+  runs[nruns].name = "vrs8";
+  runs[nruns].out.resize(n);
+  for (i = 0; i < n; i += 8)
+    _mm256_storeu_ps(&runs[nruns].out[i], k.v8(_mm256_loadu_ps(&x[i])));
+  nruns++;
+
+  runs[nruns].name = "vrsa avx2";
+  runs[nruns].out.resize(n);
+  k.avx2((int)n, x.data(), runs[nruns].out.data());
+  nruns++;
+
+#if defined(__AVX512__)
+  runs[nruns].name = "vrs16";
+  runs[nruns].out.resize(n);
+  for (i = 0; i < n; i += 16)
+    _mm512_storeu_ps(&runs[nruns].out[i], k.v16(_mm512_loadu_ps(&x[i])));
+  nruns++;
+
+  runs[nruns].name = "vrsa zn4";
+  runs[nruns].out.resize(n);
+  k.zn4((int)n, x.data(), runs[nruns].out.data());
+  nruns++;
+#endif
+
+  for (int r = 0; r < nruns; r++) {
+    for (i = 0; i < n; i++) {
+      if (!NrmSame(runs[r].out[i], ref[i])) {
+        (*nfail)++;
+        if (vflag)
+          printf("%s %s(%a) = %a, vrsa %a\n", k.name, runs[r].name,
+                 (double)x[i], (double)runs[r].out[i], (double)ref[i]);
+      }
+    }
+    *ntests += (int)n;
+  }
+
+  /* Every tail length of the widest vector, then a long one */
+  std::vector<size_t> lens;
+  for (size_t len = 0; len <= 33; len++)
+    lens.push_back(len);
+  lens.push_back(n - 3);
+
+  for (size_t len : lens) {
+    for (size_t off : { (size_t)0, (size_t)3, n - len }) {
+      if (off + len > n)
+        continue;
+
+      std::vector<float> out(len + 16, canary);
+      std::vector<float> buf(x.begin() + off, x.begin() + off + len);
+
+      k.array((int)len, &x[off], &out[8]);
+      k.array((int)len, buf.data(), buf.data());
+      for (j = 0; j < len; j++) {
+        *nfail += !NrmSame(out[8 + j], ref[off + j]);
+        *nfail += !NrmSame(buf[j], ref[off + j]);
+      }
+      for (j = 0; j < 8; j++)
+        *nfail += (out[j] != canary) + (out[8 + len + j] != canary);
+      *ntests += (int)(2 * len + 1);
+    }
+  }
+}
+
+#endif /* __ALMNORMAL_H__ */
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef __ALMRANDN_H__
+#define __ALMRANDN_H__
+
+#include <cmath>
+#include <cstdint>
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * Scalar reference of the alm_randn()/alm_randnf() streams, written from
+ * the description in include/libm/alm_randn.h rather than from the
+ * kernels: Philox4x32-10 as published with Random123, the uniforms built
+ * from its words, and the transforms evaluated with MPFR or in long
+ * double.
+ */
+
+#define RND_ICDF_METHOD        0   /* ALM_RANDN_ICDF */
+#define RND_BOX_MULLER_METHOD  1   /* ALM_RANDN_BOX_MULLER */
+
+static inline void RndPhilox(const uint32_t ctr[4], const uint32_t key[2],
+                             uint32_t out[4])
+{
+  uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+  uint32_t k0 = key[0], k1 = key[1];
+
+  for (int r = 0; r < 10; r++) {
+    uint64_t p0 = (uint64_t)0xD2511F53u * c0;
+    uint64_t p1 = (uint64_t)0xCD9E8D57u * c2;
+
+    c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+    c1 = (uint32_t)p1;
+    c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+    c3 = (uint32_t)p0;
+    k0 += 0x9E3779B9u;
+    k1 += 0xBB67AE85u;
+  }
+  out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+}
+
+/* Words of block blk of the stream of seed */
+static inline void RndBlock(uint64_t seed, uint64_t blk, uint32_t w[4])
+{
+  const uint32_t ctr[4] = { (uint32_t)blk, (uint32_t)(blk >> 32), 0, 0 };
+  const uint32_t key[2] = { (uint32_t)seed, (uint32_t)(seed >> 32) };
+
+  RndPhilox(ctr, key, w);
+}
+
+/* Double stream: the uniform of element k, (m + 0.5) * 2^-52 */
+static inline double RndUniform(uint64_t seed, uint64_t k)
+{
+  uint32_t w[4];
+
+  RndBlock(seed, k / 2, w);
+  uint64_t m = ((((uint64_t)w[2 * (k % 2) + 1]) << 32) | w[2 * (k % 2)]) >> 12;
+  return ((double)m + 0.5) * 0x1p-52;
+}
+
+/* Float stream: the uniform of element k, (m + 0.5) * 2^-24 */
+static inline double RndUniformf(uint64_t seed, uint64_t k)
+{
+  uint32_t w[4];
+
+  RndBlock(seed, k / 4, w);
+  return ((double)(w[k % 4] >> 8) + 0.5) * 0x1p-24;
+}
+
+/*
+ * Box-Muller of the pair (u0, u1) for the even (cos) or odd (sin)
+ * element. The angle is rounded to double as in the kernels, so that the
+ * reference does not charge them for the rounding of 2*pi*u1.
+ */
+static inline long double RndBoxMuller(double u0, double u1, bool odd)
+{
+  double t = u1 * 0x1.921fb54442d18p+2;
+  long double r = sqrtl(-2.0L * logl((long double)u0));
+
+  return r * (odd ? sinl((long double)t) : cosl((long double)t));
+}
+
+/* Element k of the double stream */
+static inline long double RndRef(int method, uint64_t seed, uint64_t k)
+{
+  if (method == RND_ICDF_METHOD)
+    return alm_mp_cdfnorminv(RndUniform(seed, k));
+  return RndBoxMuller(RndUniform(seed, k & ~(uint64_t)1),
+                      RndUniform(seed, k | 1), k & 1);
+}
+
+/* Element k of the float stream, in double */
+static inline double RndReff(int method, uint64_t seed, uint64_t k)
+{
+  if (method == RND_ICDF_METHOD)
+    return (double)alm_mp_cdfnorminv(RndUniformf(seed, k));
+  return (double)RndBoxMuller(RndUniformf(seed, k & ~(uint64_t)1),
+                              RndUniformf(seed, k | 1), k & 1);
+}
+
+#endif /* __ALMRANDN_H__ */
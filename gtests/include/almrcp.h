@@ -0,0 +1,321 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __ALMRCP_H__
+#define __ALMRCP_H__
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "almact.h"
+
+/*
+ * Helpers for the rsqrt and recip tests, on top of almact.h.
+ *
+ * The correctly rounded tiers are checked exactly. With r the result for
+ * y = x^(-1/pw) (pw = 2 for rsqrt, 1 for recip), r is the rounded y when
+ * y lies between the midpoints below and above r, ties going to an even
+ * r. For a midpoint m, y < m exactly when x*m^pw > 1, and x*m^pw is an
+ * integer times a power of two, so the comparison is done in integer
+ * arithmetic. Just below a power of two the midpoint spacing halves, a
+ * subnormal r has no implicit bit, an infinite r only has the midpoint
+ * below it and a zero r only the one above.
+ */
+
+/* Sign of X*M^pw*2^e - 1, pw = 1 or 2, X and M below 2^56 */
+static inline int RcpCmpOne(uint64_t X, uint64_t M, int e, int pw)
+{
+  __uint128_t p = (__uint128_t)X * M, lo, hi;
+  uint64_t w[3] = { (uint64_t)p, (uint64_t)(p >> 64), 0 };
+  int bits = 0, ones = 0;
+
+  if (pw == 2) {
+    lo = (__uint128_t)w[0] * M;
+    hi = (__uint128_t)w[1] * M + (uint64_t)(lo >> 64);
+    w[0] = (uint64_t)lo;
+    w[1] = (uint64_t)hi;
+    w[2] = (uint64_t)(hi >> 64);
+  }
+
+  for (int i = 0; i < 3; i++) {
+    ones += __builtin_popcountll(w[i]);
+    if (w[i])
+      bits = 64 * i + 64 - __builtin_clzll(w[i]);
+  }
+
+  /* X*M^pw = 2^(bits-1) exactly when it has a single bit set */
+  if (bits - 1 + e != 0)
+    return bits - 1 + e > 0 ? 1 : -1;
+  return ones > 1;
+}
+
+template <typename T> struct RcpBits;
+
+template <> struct RcpBits<float> {
+  typedef uint32_t bits;
+  enum { MANT = 23, BIAS = 127, EMAX = 254 };
+};
+
+template <> struct RcpBits<double> {
+  typedef uint64_t bits;
+  enum { MANT = 52, BIAS = 1023, EMAX = 2046 };
+};
+
+/*
+ * Positive finite v as m*2^e, with m its significand, implicit bit
+ * included. A subnormal has the exponent of the smallest normal, so e is
+ * also the exponent of the ULP of v. Returns the biased exponent.
+ */
+template <typename T>
+static inline int RcpSplit(T v, uint64_t *m, int *e)
+{
+  typedef RcpBits<T> tr;
+  typename tr::bits b;
+  int E;
+
+  memcpy(&b, &v, sizeof(b));
+  E = (int)(b >> tr::MANT);
+  *m = b & (((typename tr::bits)1 << tr::MANT) - 1);
+  if (E)
+    *m |= (uint64_t)1 << tr::MANT;
+  *e = (E ? E : 1) - tr::BIAS - tr::MANT;
+  return E;
+}
+
+/* Sign of x*(m*2^e)^pw - 1 */
+template <typename T>
+static inline int RcpCmp(T x, uint64_t m, int e, int pw)
+{
+  uint64_t X;
+  int ex;
+
+  RcpSplit(x, &X, &ex);
+  return RcpCmpOne(X, m, ex + pw * e, pw);
+}
+
+/* Whether r is x^(-1/pw) correctly rounded, for positive finite x */
+template <typename T>
+static inline bool RcpExact(T x, T r, int pw)
+{
+  typedef RcpBits<T> tr;
+  const uint64_t one = (uint64_t)1 << tr::MANT;
+
+  if (std::isnan(r) || std::signbit(r))
+    return false;
+
+  /*
+   * e, rounded twice in long double, is within 2^(2-digits) of y relative,
+   * well inside e*(1 +- g). When both ends of that interval round to r,
+   * so does y; otherwise a midpoint may lie in between and the exact
+   * comparison decides.
+   */
+  const long double g = ldexpl(1.0L, 3 - std::numeric_limits<long double>::digits);
+  long double e = pw == 2 ? 1.0L / sqrtl((long double)x) : 1.0L / (long double)x;
+  if ((T)(e * (1 - g)) == r && (T)(e * (1 + g)) == r)
+    return true;
+
+  if (std::isinf(r))
+    /* y at or above the midpoint between the largest T and infinity */
+    return RcpCmp(x, 4 * one - 1, tr::EMAX - tr::BIAS - tr::MANT - 1, pw) <= 0;
+  if (r == 0)
+    /* y at or below half of the smallest subnormal */
+    return RcpCmp(x, 1, 1 - tr::BIAS - tr::MANT - 1, pw) >= 0;
+
+  uint64_t R;
+  int eu, E = RcpSplit(r, &R, &eu);
+  bool even = !(R & 1);
+  int up = RcpCmp(x, 2 * R + 1, eu - 1, pw);
+  int dn;
+
+  /* Below a power of two the spacing halves, except at the smallest normal */
+  if (R == one && E > 1)
+    dn = RcpCmp(x, 4 * R - 1, eu - 2, pw);
+  else
+    dn = RcpCmp(x, 2 * R - 1, eu - 1, pw);
+
+  return (up > 0 || (up == 0 && even)) && (dn < 0 || (dn == 0 && even));
+}
+
+/*
+ * The fast tiers take the 256-bit or 512-bit estimate depending on the
+ * variant and, for the array variant, on the machine, so their variants
+ * agree only to within the bound. Each vector variant is held to it on
+ * the inputs of ActVariants(), whose length and offset checks of the
+ * array variant still apply.
+ */
+template <typename T>
+static inline void RcpFastVariants(const ActKernel<T> &k, const ActRange *ranges,
+                                   size_t nranges, int vflag, int *ntests,
+                                   int *nfail, double *max_ulp)
+{
+  typedef ActTraits<T> tr;
+  std::vector<T> x = ActVariantInputs<T>(ranges, nranges);
+  std::vector<T> ref(x.size()), y(x.size());
+  size_t i;
+
+  for (int w = 0; w < 2; w++) {
+    if (w == 0) {
+      for (i = 0; i < x.size(); i += tr::N256)
+        tr::store(&y[i], k.v256(tr::load(&x[i])));
+    } else {
+#if defined(__AVX512__)
+      for (i = 0; i < x.size(); i += tr::N512)
+        tr::store512(&y[i], k.v512(tr::load512(&x[i])));
+#else
+      break;
+#endif
+    }
+    for (i = 0; i < x.size(); i++) {
+      double ulp = ActUlp(y[i], k.ref(x[i]));
+
+      if (std::isfinite(ulp) && ulp > *max_ulp)
+        *max_ulp = ulp;
+      if (ulp > k.bound) {
+        (*nfail)++;
+        if (vflag)
+          printf("%s %d-bit(%a) = %a, %g ulp\n", k.name, w ? 512 : 256,
+                 (double)x[i], (double)y[i], ulp);
+      }
+    }
+    *ntests += (int)x.size();
+  }
+
+  k.array((int)x.size(), x.data(), ref.data());
+  ActArrayLengths(k, x, ref, ntests, nfail);
+}
+
+/* Results of a correctly rounded array variant, checked exactly */
+template <typename T>
+static inline void RcpCheckExact(const char *name, void (*array)(int, const T *,
+                                 T *), const std::vector<T> &x, int pw,
+                                 int vflag, int *ntests, int *nfail)
+{
+  std::vector<T> y(x.size());
+
+  array((int)x.size(), x.data(), y.data());
+  for (size_t i = 0; i < x.size(); i++) {
+    if (!RcpExact(x[i], y[i], pw)) {
+      (*nfail)++;
+      if (vflag)
+        printf("%s(%a) = %a, not correctly rounded\n", name, (double)x[i],
+               (double)y[i]);
+    }
+  }
+  *ntests += (int)x.size();
+}
+
+#define RCP_EXHAUSTIVE_BLOCK (1 << 16)
+
+/*
+ * Every positive finite float through the array variant. With cr set each
+ * result must be correctly rounded, otherwise within bound ULP of the
+ * binary64 x^(-1/pw), whose own error is far below a float ULP.
+ *
+ * That binary64 e is within 2^-52 of y relative, so when both ends of
+ * e*(1 +- 2^-50) round to the same float, that is y correctly rounded.
+ * Only the few results this leaves open take the exact comparison. Lanes
+ * of the fast tiers that lie outside their range give the correctly
+ * rounded default result, the others a normal one.
+ */
+static inline void RcpExhaustive(const char *name, void (*array)(int,
+                                 const float *, float *), int pw, bool cr,
+                                 double bound, int vflag, int *ntests,
+                                 int *nfail, double *max_ulp)
+{
+  std::vector<uint32_t> b(RCP_EXHAUSTIVE_BLOCK);
+  std::vector<float> x(RCP_EXHAUSTIVE_BLOCK), y(RCP_EXHAUSTIVE_BLOCK);
+  const uint32_t end = 0x7f800000;
+  const float *px = x.data(), *py = y.data();
+
+  for (uint32_t base = 1; base < end; base += RCP_EXHAUSTIVE_BLOCK) {
+    int n = (int)(end - base < RCP_EXHAUSTIVE_BLOCK ? end - base :
+                  RCP_EXHAUSTIVE_BLOCK);
+
+    for (int i = 0; i < n; i++)
+      b[i] = base + i;
+    memcpy(x.data(), b.data(), n * sizeof(float));
+    array(n, x.data(), y.data());
+
+    for (int i = 0; i < n; i++) {
+      double e = pw == 2 ? 1.0 / sqrt((double)px[i]) : 1.0 / (double)px[i];
+      double ulp = 0.0;
+      float r = py[i];
+
+      if ((float)(e * (1 - 0x1p-50)) == r && (float)(e * (1 + 0x1p-50)) == r)
+        continue;
+
+      if (cr) {
+        if (RcpExact(px[i], r, pw))
+          continue;
+      } else {
+        uint64_t eb;
+        double p2;
+        memcpy(&eb, &e, sizeof(eb));
+        eb &= 0x7ff0000000000000ULL;
+        memcpy(&p2, &eb, sizeof(p2));
+
+        ulp = std::isfinite(r) ? fabs(r - e) / (p2 * 0x1p-23) : INFINITY;
+        if (ulp > *max_ulp)
+          *max_ulp = ulp;
+        if (ulp <= bound)
+          continue;
+      }
+
+      (*nfail)++;
+      if (vflag)
+        printf("%s(%a) = %a, %g ulp\n", name, (double)px[i], (double)r, ulp);
+    }
+    *ntests += n;
+  }
+}
+
+/* Deterministic positive finite T with uniformly random bit patterns */
+template <typename T>
+static inline std::vector<T> RcpRandomBits(size_t n, uint64_t seed)
+{
+  const uint64_t top = sizeof(T) == sizeof(double) ? 0x7fefffffffffffffULL :
+                       0x7f7fffffULL;
+  std::vector<T> x(n);
+
+  for (size_t i = 0; i < n; i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    uint64_t b = 1 + (seed >> 1) % top;
+    if (sizeof(T) == sizeof(double)) {
+      memcpy(&x[i], &b, sizeof(T));
+    } else {
+      uint32_t b32 = (uint32_t)b;
+      memcpy(&x[i], &b32, sizeof(T));
+    }
+  }
+  return x;
+}
+
+#endif /* __ALMRCP_H__ */
@@ -50,14 +50,25 @@ static map<string, vector<string>> libm_funcs = {
     {"atan",      {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrsa", "vrda"}},
     {"atan2",     {"s1d", "s1f"}},
     {"atanh",     {"s1d", "s1f"}},
+    {"cabs",      {"s1d", "s1f", "vrza", "vrca"}},
+    {"carg",      {"s1d", "s1f", "vrza", "vrca"}},
     {"cbrt",      {"s1d", "s1f", "vrd2", "vrs4", "vrda", "vrsa"}},
+    {"ccos",      {"s1d", "s1f", "vrza", "vrca"}},
+    {"ccosh",     {"s1d", "s1f", "vrza", "vrca"}},
     {"ceil",      {"s1d", "s1f"}},
-    {"cexp",      {"s1d", "s1f"}},
+    {"cexp",      {"s1d", "s1f", "vrza", "vrca"}},
+    {"clog",      {"s1d", "s1f", "vrza", "vrca"}},
     {"copysign",  {"s1d", "s1f"}},
     {"cos",       {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"cosh",      {"s1d", "s1f", "vrd2", "vrs4", "vrs8", "vrsa", "vrda"}},
+    {"cpow",      {"s1d", "s1f", "vrza", "vrca"}},
+    {"csin",      {"s1d", "s1f", "vrza", "vrca"}},
+    {"csinh",     {"s1d", "s1f", "vrza", "vrca"}},
+    {"csqrt",     {"s1d", "s1f", "vrza", "vrca"}},
+    {"ctan",      {"s1d", "s1f", "vrza", "vrca"}},
+    {"ctanh",     {"s1d", "s1f", "vrza", "vrca"}},
     {"erf",       {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrsa", "vrda"}},
-    {"erfinv",    {"s1d", "vrd2", "vrd4", "vrd8", "vrda", /*"s1f", "vrs4", "vrs8", "vrs16", "vrsa"*/}},
+    {"erfinv",    {"s1d", "vrd2", "vrd4", "vrd8", "vrda", "s1f", "vrs4", "vrs8", "vrs16", "vrsa"}},
     {"exp",       {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"exp2",      {"s1d", "s1f", "vrd2", "vrd4", "vrd8", "vrs4", "vrs8", "vrs16", "vrda", "vrsa"}},
     {"exp10",     {"s1d", "s1f", "vrd2", "vrs4", "vrda", "vrsa"}},
@@ -94,9 +105,37 @@ static map<string, vector<string>> libm_funcs = {
     {"nextafter", {"s1d", "s1f"}},
     {"ldexp",     {"s1d", "s1f"}},
     {"erfc",      {"s1d", "vrd2", "vrd4", "vrd8", "vrda", "s1f", "vrs4", "vrs8", "vrs16", "vrsa"}},
-    {"cdfnorm",   {"s1d", "vrd2", "vrd4", "vrd8", "vrda"}},
-    {"cdfnorminv",{"s1d", "vrd2", "vrd4", "vrd8", "vrda"}},
-    {"erfcinv",   {"s1d", "vrd2", "vrd4", "vrd8", "vrda"}},
+    {"cdfnorm",   {"s1d", "vrd2", "vrd4", "vrd8", "vrda", "s1f", "vrs4", "vrs8", "vrs16", "vrsa"}},
+    {"cdfnorminv",{"s1d", "vrd2", "vrd4", "vrd8", "vrda", "s1f", "vrs4", "vrs8", "vrs16", "vrsa"}},
+    {"erfcinv",   {"s1d", "vrd2", "vrd4", "vrd8", "vrda", "s1f", "vrs4", "vrs8", "vrs16", "vrsa"}},
+    {"strided",   {"vrda", "vrsa"}},
+    {"powi",      {"vrda", "vrsa"}},
+    {"masked",    {"vrda", "vrsa"}},
+    {"expr",      {"vrda", "vrsa"}},
+    {"reduce",    {"vrda", "vrsa"}},
+    {"softmax",   {"vrda", "vrsa"}},
+    {"randn",     {"vrda", "vrsa"}},
+    {"expf16",    {"s1f", "vrs8", "vrs16", "vrsa"}},
+    {"logf16",    {"s1f", "vrs8", "vrs16", "vrsa"}},
+    {"sqrtf16",   {"s1f", "vrs8", "vrs16", "vrsa"}},
+    {"tanhf16",   {"s1f", "vrs8", "vrs16", "vrsa"}},
+    {"erff16",    {"s1f", "vrs8", "vrs16", "vrsa"}},
+    {"sinf16",    {"s1f", "vrs8", "vrs16", "vrsa"}},
+    {"cosf16",    {"s1f", "vrs8", "vrs16", "vrsa"}},
+    {"expbf16",   {"vrsa"}},
+    {"logbf16",   {"vrsa"}},
+    {"tanhbf16",  {"vrsa"}},
+    {"erfbf16",   {"vrsa"}},
+    {"sigmoidbf16",{"vrsa"}},
+    {"gelubf16",  {"vrsa"}},
+    {"sigmoid",   {"vrs8", "vrs16", "vrsa", "vrd4", "vrd8", "vrda"}},
+    {"softplus",  {"vrs8", "vrs16", "vrsa", "vrd4", "vrd8", "vrda"}},
+    {"gelu",      {"vrs8", "vrs16", "vrsa", "vrd4", "vrd8", "vrda"}},
+    {"gelu_tanh", {"vrs8", "vrs16", "vrsa", "vrd4", "vrd8", "vrda"}},
+    {"silu",      {"vrs8", "vrs16", "vrsa", "vrd4", "vrd8", "vrda"}},
+    {"mish",      {"vrs8", "vrs16", "vrsa", "vrd4", "vrd8", "vrda"}},
+    {"rsqrt",     {"vrs8", "vrs16", "vrsa", "vrd4", "vrd8", "vrda"}},
+    {"recip",     {"vrs8", "vrs16", "vrsa", "vrd4", "vrd8", "vrda"}},
 };
 
 /* vector<string> getSupportedVariants(string func)
@@ -69,10 +69,12 @@ double   alm_mp_logbf       (float x);
 double   alm_mp_logf        (float x);
 double   alm_mp_modff       (float x, float *ptr);
 double   alm_mp_powf        (float x, float y);
+double   alm_mp_recipf      (float x);
 double   alm_mp_remainderf  (float x, float y);
 double   alm_mp_remquof     (float x, float y, int* quotient);
 double   alm_mp_rintf       (float x);
 double   alm_mp_roundf      (float x);
+double   alm_mp_rsqrtf      (float x);
 double   alm_mp_sinf        (float x);
 double   alm_mp_sinhf       (float x);
 double   alm_mp_sinpif      (float x);
@@ -94,6 +96,12 @@ void     alm_mp_sincosf     (float x, double* y1, double* y2);
 double   alm_mp_nearbyintf  (float x);
 double   alm_mp_cdfnormf    (float x);
 double   alm_mp_cdfnorminvf (float x);
+double   alm_mp_sigmoidf    (float x);
+double   alm_mp_geluf       (float x);
+double   alm_mp_gelu_tanhf  (float x);
+double   alm_mp_softplusf   (float x);
+double   alm_mp_siluf       (float x);
+double   alm_mp_mishf       (float x);
 
 /* Single precision ULP functions */
 float   alm_mp_acoshf_ULP    (float x,float z, double *, double *);
@@ -189,10 +197,12 @@ long double  alm_mp_logb      (double x);
 long double  alm_mp_log       (double x);
 long double  alm_mp_modf      (double x, double *ptr);
 long double  alm_mp_pow       (double x, double y);
+long double  alm_mp_recip     (double x);
 long double  alm_mp_remainder (double x, double y);
 long double  alm_mp_remquo    (double x, double y, int* quotient);
 long double  alm_mp_rint      (double x);
 long double  alm_mp_round     (double x);
+long double  alm_mp_rsqrt     (double x);
 long double  alm_mp_sin       (double x);
 long double  alm_mp_sinh      (double x);
 long double  alm_mp_sinpi     (double x);
@@ -214,6 +224,12 @@ void         alm_mp_sincos    (double x, long double* y1, long double* y2);
 long double  alm_mp_nearbyint (double x);
 long double  alm_mp_cdfnorm   (double x);
 long double  alm_mp_cdfnorminv(double x);
+long double  alm_mp_sigmoid  (double x);
+long double  alm_mp_gelu     (double x);
+long double  alm_mp_gelu_tanh(double x);
+long double  alm_mp_softplus (double x);
+long double  alm_mp_silu     (double x);
+long double  alm_mp_mish     (double x);
 
 double  alm_mp_acosh_ULP     (double x,double z, double *, double *);
 double  alm_mp_acos_ULP      (double x,double z, double *, double *);
@@ -276,6 +292,28 @@ double  alm_mp_cdfnorminv_ULP  (double x,double z,double *, double *);
 // Complex Variants
 double _Complex    alm_mpc_cexpf      (float _Complex x);
 long double _Complex   alm_mpc_cexp       (double _Complex x);
+double _Complex    alm_mpc_clogf      (float _Complex x);
+long double _Complex   alm_mpc_clog       (double _Complex x);
+double _Complex    alm_mpc_cpowf      (float _Complex x, float _Complex y);
+long double _Complex   alm_mpc_cpow       (double _Complex x, double _Complex y);
+double _Complex    alm_mpc_csqrtf     (float _Complex x);
+long double _Complex   alm_mpc_csqrt      (double _Complex x);
+double _Complex    alm_mpc_csinf      (float _Complex x);
+long double _Complex   alm_mpc_csin       (double _Complex x);
+double _Complex    alm_mpc_ccosf      (float _Complex x);
+long double _Complex   alm_mpc_ccos       (double _Complex x);
+double _Complex    alm_mpc_ctanf      (float _Complex x);
+long double _Complex   alm_mpc_ctan       (double _Complex x);
+double _Complex    alm_mpc_csinhf     (float _Complex x);
+long double _Complex   alm_mpc_csinh      (double _Complex x);
+double _Complex    alm_mpc_ccoshf     (float _Complex x);
+long double _Complex   alm_mpc_ccosh      (double _Complex x);
+double _Complex    alm_mpc_ctanhf     (float _Complex x);
+long double _Complex   alm_mpc_ctanh      (double _Complex x);
+double _Complex    alm_mpc_cabsf      (float _Complex x);
+long double _Complex   alm_mpc_cabs       (double _Complex x);
+double _Complex    alm_mpc_cargf      (float _Complex x);
+long double _Complex   alm_mpc_carg       (double _Complex x);
 
 #ifdef __cplusplus
 }
@@ -66,10 +66,10 @@ static int mpfr_erfinv(mpfr_ptr y, mpfr_srcptr x, mpfr_rnd_t rnd)
   mpfr_set_d(zero, 0.0, MPFR_RNDN);
 
   /* Check domain: x must be in (-1, 1)
-   * erfinv(0) = 0
+   * erfinv(+-0) = +-0
    */
   if (mpfr_zero_p(x)) {
-    mpfr_set_d(y, 0.0, MPFR_RNDN);
+    mpfr_set(y, x, MPFR_RNDN);
     mpfr_clear(one); mpfr_clear(neg_one); mpfr_clear(zero);
     return 0;
   }
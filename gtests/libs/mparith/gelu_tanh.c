@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include "precision.h"
+
+
+#if defined(FLOAT)
+#define FUNC_GELU_TANH alm_mp_gelu_tanhf
+
+#elif defined(DOUBLE)
+#define FUNC_GELU_TANH alm_mp_gelu_tanh
+
+#else
+#error
+#endif
+
+#include <mpfr.h>
+
+/*
+ * x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 x^3))), evaluated as
+ * x / (1 + exp(-w)), w = 2*sqrt(2/pi) * (x + 0.044715 x^3), which does not
+ * cancel for x < 0.
+ */
+REAL_L FUNC_GELU_TANH(REAL x)
+{
+    REAL_L y;
+
+    mpfr_rnd_t rnd = MPFR_RNDN;
+    mpfr_t mpx, mp_rop, mp_k;
+
+    mpfr_inits2(ALM_MP_PRECI_BITS, mpx, mp_rop, mp_k, (mpfr_ptr) 0);
+
+#if defined(FLOAT)
+    mpfr_set_d(mpx, x, rnd);
+#elif defined(DOUBLE)
+    mpfr_set_ld(mpx, x, rnd);
+#endif
+
+    /* w */
+    mpfr_set_str(mp_k, "0.044715", 10, rnd);
+    mpfr_sqr(mp_rop, mpx, rnd);
+    mpfr_mul(mp_rop, mp_rop, mp_k, rnd);
+    mpfr_add_ui(mp_rop, mp_rop, 1, rnd);
+    mpfr_mul(mp_rop, mp_rop, mpx, rnd);
+    mpfr_const_pi(mp_k, rnd);
+    mpfr_ui_div(mp_k, 8, mp_k, rnd);
+    mpfr_sqrt(mp_k, mp_k, rnd);
+    mpfr_mul(mp_rop, mp_rop, mp_k, rnd);
+
+    mpfr_neg(mp_rop, mp_rop, rnd);
+    mpfr_exp(mp_rop, mp_rop, rnd);
+    mpfr_add_ui(mp_rop, mp_rop, 1, rnd);
+    mpfr_div(mp_rop, mpx, mp_rop, rnd);
+
+    /* -Inf / Inf above: take the limit, -0 */
+    if (mpfr_inf_p(mpx) && mpfr_sgn(mpx) < 0)
+        mpfr_set_d(mp_rop, -0.0, rnd);
+
+#if defined(FLOAT)
+    y = mpfr_get_d(mp_rop, rnd);
+#elif defined(DOUBLE)
+    y = mpfr_get_ld(mp_rop, rnd);
+#endif
+
+    mpfr_clears (mpx, mp_rop, mp_k, (mpfr_ptr) 0);
+    return y;
+}
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_LOGBF16_DATA_H__
+#define __TEST_LOGBF16_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for vrba_logbf16(), as the float values of BF16
+ * inputs and correctly rounded BF16 results, subnormal results flushed to
+ * zero: zeros, infinities, NaNs, subnormals, the largest finite value, and
+ * negative inputs and the neighbours of 1.
+ *
+ * The BF16 kernels make no promise about the status flags, so none are
+ * expected.
+ */
+
+static libm_test_special_data_f32
+test_logbf16_conformance_data[] = {
+    { 0x00000000, 0xFF800000, AMD_F_NONE },  /* +0: log(0) = -inf */
+    { 0x80000000, 0xFF800000, AMD_F_NONE },  /* -0: log(-0) = -inf */
+    { 0x7F800000, 0x7F800000, AMD_F_NONE },  /* +Inf: log(inf) = inf */
+    { 0xFF800000, 0x7FC00000, AMD_F_NONE },  /* -Inf: log(-inf) = nan */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: log(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: log(-nan) = -nan */
+    { 0x00010000, 0xC2B80000, AMD_F_NONE },  /* min subnormal: log(9.18355e-41) = -92 */
+    { 0x007F0000, 0xC2AF0000, AMD_F_NONE },  /* max subnormal: log(1.16631e-38) = -87.5 */
+    { 0x00800000, 0xC2AF0000, AMD_F_NONE },  /* min normal: log(1.17549e-38) = -87.5 */
+    { 0x3F800000, 0x00000000, AMD_F_NONE },  /* 1: log(1) = 0 */
+    { 0xBF800000, 0x7FC00000, AMD_F_NONE },  /* -1: log(-1) = nan */
+    { 0x7F7F0000, 0x42B10000, AMD_F_NONE },  /* max: log(3.38953e+38) = 88.5 */
+    { 0xFF7F0000, 0x7FC00000, AMD_F_NONE },  /* -max: log(-3.38953e+38) = nan */
+    { 0x3F7F0000, 0xBB800000, AMD_F_NONE },  /* 1-ulp: log(0.996094) = -0.00390625 */
+    { 0x3F810000, 0x3BFF0000, AMD_F_NONE },  /* 1+ulp: log(1.00781) = 0.00778198 */
+    { 0x402E0000, 0x3F800000, AMD_F_NONE },  /* e: log(2.71875) = 1 */
+    { 0x80010000, 0x7FC00000, AMD_F_NONE },  /* negative subnormal: log(-9.18355e-41) = nan */
+    { 0xC0000000, 0x7FC00000, AMD_F_NONE },  /* negative: log(-2) = nan */
+};
+
+#endif /*__TEST_LOGBF16_DATA_H__*/
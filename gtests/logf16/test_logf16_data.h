@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_LOGF16_DATA_H__
+#define __TEST_LOGF16_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for logf16(), as the float values of FP16 inputs
+ * and correctly rounded FP16 results: zeros, infinities, NaNs, subnormals,
+ * the largest finite value, and negative inputs and the neighbours of 1.
+ *
+ * The FP16 kernels keep special inputs on the vector path (see
+ * include/libm/alm_half.h) and make no promise about the status flags, so
+ * none are expected.
+ */
+
+static libm_test_special_data_f32
+test_logf16_conformance_data[] = {
+    { 0x00000000, 0xFF800000, AMD_F_NONE },  /* +0: log(0) = -inf */
+    { 0x80000000, 0xFF800000, AMD_F_NONE },  /* -0: log(-0) = -inf */
+    { 0x7F800000, 0x7F800000, AMD_F_NONE },  /* +Inf: log(inf) = inf */
+    { 0xFF800000, 0x7FC00000, AMD_F_NONE },  /* -Inf: log(-inf) = nan */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: log(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: log(-nan) = -nan */
+    { 0x33800000, 0xC1852000, AMD_F_NONE },  /* min subnormal: log(5.96046448e-08) = -16.640625 */
+    { 0xB3800000, 0x7FC00000, AMD_F_NONE },  /* -min subnormal: log(-5.96046448e-08) = nan */
+    { 0x387FC000, 0xC11B4000, AMD_F_NONE },  /* max subnormal: log(6.09755516e-05) = -9.703125 */
+    { 0x38800000, 0xC11B4000, AMD_F_NONE },  /* min normal: log(6.10351562e-05) = -9.703125 */
+    { 0x3F800000, 0x00000000, AMD_F_NONE },  /* 1: log(1) = 0 */
+    { 0xBF800000, 0x7FC00000, AMD_F_NONE },  /* -1: log(-1) = nan */
+    { 0x477FE000, 0x41318000, AMD_F_NONE },  /* max: log(65504) = 11.09375 */
+    { 0xC77FE000, 0x7FC00000, AMD_F_NONE },  /* -max: log(-65504) = nan */
+    { 0x3F7FE000, 0xBA000000, AMD_F_NONE },  /* 1-ulp: log(0.999511719) = -0.00048828125 */
+    { 0x3F802000, 0x3A7FE000, AMD_F_NONE },  /* 1+ulp: log(1.00097656) = 0.000976085663 */
+    { 0x402E0000, 0x3F800000, AMD_F_NONE },  /* e: log(2.71875) = 1 */
+    { 0x47000000, 0x41266000, AMD_F_NONE },  /* 32768: log(32768) = 10.3984375 */
+    { 0xC0000000, 0x7FC00000, AMD_F_NONE },  /* negative: log(-2) = nan */
+};
+
+#endif /*__TEST_LOGF16_DATA_H__*/
@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <fenv.h>
+#include <random>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+
+/*
+ * Indexed (_idx), byte masked (_mask) and bit masked (_bmask) variants
+ * against the contiguous array kernel.
+ *
+ * Selected elements must come out bit-identical to amd_vrda_log() on the
+ * same input, and every other dst element must keep its previous contents.
+ * The unselected src elements hold NaN, zero and negative values: if one of
+ * them reached the kernel it would raise invalid or divide-by-zero, which is
+ * checked as well. Bits of the last _bmask byte beyond len are set and must
+ * be ignored.
+ */
+
+#define MASKED_GUARD 16
+
+template <typename T> struct MaskedOps;
+
+template <> struct MaskedOps<double> {
+  typedef uint64_t bits;
+  static constexpr bits canary = 0x7ff4deadbeef5a5aULL;
+  static void array(int n, const double *x, double *r) {
+    amd_vrda_log(n, x, r);
+  }
+  static void idx(size_t n, const size_t *ix, const double *x, double *r) {
+    amd_vrda_log_idx(n, ix, x, r);
+  }
+  static void mask(size_t n, const unsigned char *m, const double *x, double *r) {
+    amd_vrda_log_mask(n, m, x, r);
+  }
+  static void bmask(size_t n, const unsigned char *b, const double *x, double *r) {
+    amd_vrda_log_bmask(n, b, x, r);
+  }
+};
+
+template <> struct MaskedOps<float> {
+  typedef uint32_t bits;
+  static constexpr bits canary = 0x7fa5a5a5U;
+  static void array(int n, const float *x, float *r) {
+    amd_vrsa_logf(n, x, r);
+  }
+  static void idx(size_t n, const size_t *ix, const float *x, float *r) {
+    amd_vrsa_logf_idx(n, ix, x, r);
+  }
+  static void mask(size_t n, const unsigned char *m, const float *x, float *r) {
+    amd_vrsa_logf_mask(n, m, x, r);
+  }
+  static void bmask(size_t n, const unsigned char *b, const float *x, float *r) {
+    amd_vrsa_logf_bmask(n, b, x, r);
+  }
+};
+
+enum MaskedMode { MASKED_BYTES, MASKED_BITS, MASKED_INDEX };
+
+/* Values that log() rejects, placed in every lane the call must skip */
+template <typename T>
+static T MaskedGarbage(size_t i) {
+  static const T g[] = { -1.0, NAN, -INFINITY, 0.0, -0.0, -3.5e30 };
+  return g[i % ARRAY_SIZE(g)];
+}
+
+template <typename T>
+static bool MaskedSameBits(T a, T b) {
+  return memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+/*
+ * Run one selection. For MASKED_INDEX, ix lists the selected positions
+ * (possibly repeated); for the mask modes sel[] flags them.
+ */
+template <typename T>
+static int CheckSelection(const T *in, size_t cnt, size_t n, MaskedMode mode,
+                          const std::vector<char> &sel,
+                          const std::vector<size_t> &ix, int vflag) {
+  typedef typename MaskedOps<T>::bits bits;
+  std::vector<T> x(n + 1), src(n + 1), ref(n + 1);
+  std::vector<bits> dbuf(n + 2 * MASKED_GUARD, MaskedOps<T>::canary);
+  T *dst = (T *)dbuf.data() + MASKED_GUARD;
+  std::vector<char> on(n, 0);
+  bool clean = true;
+  int nfail = 0;
+
+  if (mode == MASKED_INDEX) {
+    for (size_t j : ix)
+      on[j] = 1;
+  } else {
+    on = sel;
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    x[i] = in[i % cnt];
+    src[i] = on[i] ? x[i] : MaskedGarbage<T>(i);
+    if (on[i] && !(x[i] > 0 && x[i] < INFINITY))
+      clean = false;
+  }
+  if (n)
+    MaskedOps<T>::array((int)n, x.data(), ref.data());
+
+  /* Any non-zero byte selects; bits past len in the last byte are junk */
+  std::vector<unsigned char> m(n + 1, 0), b(n / 8 + 2, 0);
+  for (size_t i = 0; i < n; i++) {
+    if (on[i]) {
+      m[i] = (unsigned char)(1u << (i % 8));
+      b[i / 8] |= (unsigned char)(1u << (i % 8));
+    }
+  }
+  if (n % 8)
+    b[n / 8] |= (unsigned char)(0xffu << (n % 8));
+  b[n / 8 + 1] = 0xff;
+
+  feclearexcept(FE_ALL_EXCEPT);
+  switch (mode) {
+    case MASKED_BYTES: MaskedOps<T>::mask(n, m.data(), src.data(), dst); break;
+    case MASKED_BITS:  MaskedOps<T>::bmask(n, b.data(), src.data(), dst); break;
+    case MASKED_INDEX: MaskedOps<T>::idx(ix.size(), ix.data(), src.data(), dst); break;
+  }
+  if (clean && fetestexcept(FE_INVALID | FE_DIVBYZERO)) {
+    nfail++;
+    if (vflag)
+      printf("n=%zu mode=%d: an unselected element reached the kernel\n",
+             n, (int)mode);
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    bool ok = on[i] ? MaskedSameBits(dst[i], ref[i])
+                    : ((bits *)dst)[i] == MaskedOps<T>::canary;
+    if (!ok) {
+      nfail++;
+      if (vflag)
+        printf("n=%zu mode=%d i=%zu selected=%d: got %a expected %a\n",
+               n, (int)mode, i, (int)on[i], (double)dst[i], (double)ref[i]);
+    }
+  }
+  for (size_t j = 0; j < MASKED_GUARD; j++) {
+    if (dbuf[j] != MaskedOps<T>::canary ||
+        dbuf[MASKED_GUARD + n + j] != MaskedOps<T>::canary)
+      nfail++;
+  }
+  return nfail;
+}
+
+/* Selection patterns, including the all-zero and all-one masks */
+static std::vector<char> MaskedPattern(int p, size_t n) {
+  std::mt19937 rng(42 + p);
+  std::vector<char> sel(n);
+
+  for (size_t i = 0; i < n; i++) {
+    switch (p) {
+      case 0: sel[i] = 0; break;
+      case 1: sel[i] = 1; break;
+      case 2: sel[i] = i & 1; break;
+      case 3: sel[i] = (i % 3) == 0; break;
+      case 4: sel[i] = i == 0; break;
+      case 5: sel[i] = i + 1 == n; break;
+      case 6: sel[i] = (rng() & 1) != 0; break;
+      case 7: sel[i] = (rng() & 63) == 0; break;
+      default: sel[i] = ((i / 37) & 1) != 0; break;
+    }
+  }
+  return sel;
+}
+#define MASKED_NPATTERNS 9
+
+/* Lengths around the byte boundary of the bitmask and the 512 blocks */
+static const size_t masked_tails[] = { 0, 1, 3, 7, 8, 9, 13, 15, 17, 63, 64, 65,
+                                       511, 512, 513, 1029 };
+
+template <typename T>
+static void RunMasks(const T *in, uint32_t count, MaskedMode mode, int vflag,
+                     int *ntests, int *nfail) {
+  std::vector<size_t> none;
+
+  for (int p = 0; p < MASKED_NPATTERNS; p++) {
+    *nfail += CheckSelection(in, count, count, mode, MaskedPattern(p, count),
+                             none, vflag);
+    *ntests += count;
+    for (size_t n : masked_tails) {
+      *nfail += CheckSelection(in, count, n, mode, MaskedPattern(p, n), none,
+                               vflag);
+      *ntests += (int)n;
+    }
+  }
+}
+
+template <typename T>
+static void RunIndex(const T *in, uint32_t count, int vflag, int *ntests,
+                     int *nfail) {
+  std::mt19937 rng(7);
+  std::vector<char> unused;
+
+  for (int p = 0; p < 7; p++) {
+    std::vector<size_t> ix;
+    switch (p) {
+      case 0: break;                                        /* empty list */
+      case 1: for (size_t i = 0; i < count; i++) ix.push_back(i); break;
+      case 2: for (size_t i = count; i-- > 0;) ix.push_back(i); break;
+      case 3: for (size_t i = 0; i < count; i += 3) ix.push_back(i); break;
+      case 4: ix.push_back(count - 1); break;
+      case 5:                                             /* repeated entries */
+        for (size_t i = 0; i < count; i++) ix.push_back(i / 2);
+        break;
+      default:                                 /* random subset, random order */
+        for (size_t i = 0; i < count; i++)
+          if (rng() & 1)
+            ix.push_back(i);
+        std::shuffle(ix.begin(), ix.end(), rng);
+        break;
+    }
+    *nfail += CheckSelection(in, count, count, MASKED_INDEX, unused, ix, vflag);
+    *ntests += count;
+  }
+}
+
+#define MASKED_REPORT(name, var)                                              \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          "Masked", name, var, ntests, (ntests - nfail), nfail);              \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_MASK) {
+  int ntests = 0, nfail = 0;
+  RunMasks(inpbuff, count, MASKED_BYTES, vflag, &ntests, &nfail);
+  MASKED_REPORT("Mask", "vrda_mask");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_BMASK) {
+  int ntests = 0, nfail = 0;
+  RunMasks(inpbuff, count, MASKED_BITS, vflag, &ntests, &nfail);
+  MASKED_REPORT("Bmask", "vrda_bmask");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_IDX) {
+  int ntests = 0, nfail = 0;
+  RunIndex(inpbuff, count, vflag, &ntests, &nfail);
+  MASKED_REPORT("Index", "vrda_idx");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_MASK) {
+  int ntests = 0, nfail = 0;
+  RunMasks(inpbuff, count, MASKED_BYTES, vflag, &ntests, &nfail);
+  MASKED_REPORT("Mask", "vrsa_mask");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_BMASK) {
+  int ntests = 0, nfail = 0;
+  RunMasks(inpbuff, count, MASKED_BITS, vflag, &ntests, &nfail);
+  MASKED_REPORT("Bmask", "vrsa_bmask");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_IDX) {
+  int ntests = 0, nfail = 0;
+  RunIndex(inpbuff, count, vflag, &ntests, &nfail);
+  MASKED_REPORT("Index", "vrsa_idx");
+}
+
+/* The conformance table under a bitmask that skips every third entry */
+TEST_P(SpecTestFixtureDoubleArray, CONFORMANCE_VECTOR_ARRAY_DOUBLES_BMASK) {
+  int ntests = 0, nfail = 0;
+  std::vector<size_t> none;
+  nfail += CheckSelection(data, count, count, MASKED_BITS,
+                          MaskedPattern(3, count), none, vflag);
+  nfail += CheckSelection(data, count, count, MASKED_BYTES,
+                          MaskedPattern(1, count), none, vflag);
+  ntests += 2 * count;
+  MASKED_REPORT("Conformance", "vrda_bmask");
+}
+
+TEST_P(SpecTestFixtureFloatArray, CONFORMANCE_VECTOR_ARRAY_FLOATS_BMASK) {
+  int ntests = 0, nfail = 0;
+  std::vector<size_t> none;
+  nfail += CheckSelection(data, count, count, MASKED_BITS,
+                          MaskedPattern(3, count), none, vflag);
+  nfail += CheckSelection(data, count, count, MASKED_BYTES,
+                          MaskedPattern(1, count), none, vflag);
+  ntests += 2 * count;
+  MASKED_REPORT("Conformance", "vrsa_bmask");
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include <string>
+#include <cstring>
+#include <vector>
+#include <chrono>
+#include "benchmark.h"
+#include "almtestperf.h"
+#include "callback.h"
+
+using namespace std;
+using namespace ALM;
+
+/*
+ * Every other bit set in the bitmask, so half of the elements go through
+ * the compaction and expansion.
+ */
+static void LibmPerfTestBmaskd(benchmark::State& st, InputParams* param) {
+  AoclLibmTest<double> objtest(param, GetnIpArgs());
+  vector<unsigned char> bits(param->count / 8 + 1, 0x55);
+  double szn = param->niter * param->count;
+
+  for (auto _ : st) {
+    amd_vrda_log_bmask(param->count, bits.data(), objtest.inpbuff, objtest.outbuff);
+  }
+
+  namespace bm = benchmark;
+  st.counters["MOPS"] = bm::Counter{szn, bm::Counter::kIsRate};
+}
+
+static void LibmPerfTestBmaskf(benchmark::State& st, InputParams* param) {
+  AoclLibmTest<float> objtest(param, GetnIpArgs());
+  vector<unsigned char> bits(param->count / 8 + 1, 0x55);
+  double szn = param->niter * param->count;
+
+  for (auto _ : st) {
+    amd_vrsa_logf_bmask(param->count, bits.data(), objtest.inpbuff, objtest.outbuff);
+  }
+
+  namespace bm = benchmark;
+  st.counters["MOPS"] = bm::Counter{szn, bm::Counter::kIsRate};
+}
+
+int AlmTestPerfFramework::AlmTestPerformance(InputParams *params) {
+  string funcnam = "AoclLibm";
+  string libm;
+
+  if((params->fqty != ALM::FloatQuantity::E_All) &&
+     (params->fqty != ALM::FloatQuantity::E_Vector_Array)) {
+    cout << "Only the array variants (-e 32) are available for masked" << endl;
+    return 0;
+  }
+
+  if((params->fwidth == ALM::FloatWidth::E_ALL) ||
+    (params->fwidth == ALM::FloatWidth::E_F64)) {
+    string varnam = "_vad(log_mask)";
+    libm = funcnam + varnam;
+    benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestad, params)
+               ->Args({(int)params->count})->Iterations(params->niter);
+
+    varnam = "_vad(log_bmask,0x55)";
+    libm = funcnam + varnam;
+    benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestBmaskd, params)
+               ->Args({(int)params->count})->Iterations(params->niter);
+  }
+
+  if((params->fwidth == ALM::FloatWidth::E_ALL) ||
+    (params->fwidth == ALM::FloatWidth::E_F32)) {
+    string varnam = "_vas(logf_mask)";
+    libm = funcnam + varnam;
+    benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestaf, params)
+               ->Args({(int)params->count})->Iterations(params->niter);
+
+    varnam = "_vas(logf_bmask,0x55)";
+    libm = funcnam + varnam;
+    benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestBmaskf, params)
+               ->Args({(int)params->count})->Iterations(params->niter);
+  }
+
+  size_t retval = benchmark::RunSpecifiedBenchmarks();
+
+  return (int)retval;
+}
+
+
+AlmTestPerfFramework::~AlmTestPerfFramework() {
+#if defined(DEBUG_PRINTS)
+  cout << "AlmTestPerfFramework destructor completed" << endl;
+#endif
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <cmath>
+#include "libm_tests.h"
+#include <libm_macros.h>
+
+#include <libm_amd.h>
+#include <libm/amd_funcs_internal.h>
+#include <fmaintrin.h>
+#include <immintrin.h>
+#include "callback.h"
+#include "test_mish_data.h"
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * mish has vector and array variants only. The generic rows report the
+ * error against the MPFR reference; gtest_mish.cc checks it against the
+ * bound quoted in src/optimized/act/mish.c and mishf.c.
+ */
+
+static uint32_t ipargs = 1;
+bool special_case = false;
+
+uint32_t GetnIpArgs( void )
+{
+  return ipargs;
+}
+
+bool getSpecialCase(void)
+{
+  return special_case;
+}
+
+void ConfSetupf32(SpecParams *specp) {
+  specp->data32 = test_mishf_conformance_data;
+  specp->countf = ARRAY_SIZE(test_mishf_conformance_data);
+}
+
+void ConfSetupf64(SpecParams *specp) {
+  specp->data64 = test_mish_conformance_data;
+  specp->countd = ARRAY_SIZE(test_mish_conformance_data);
+}
+
+float getFuncOp(float *data) {
+  float op;
+  amd_vrsa_mishf(1, data, &op);
+  return op;
+}
+
+double getFuncOp(double *data) {
+  double op;
+  amd_vrda_mish(1, data, &op);
+  return op;
+}
+
+double getExpected(float *data) {
+  auto val = alm_mp_mishf(data[0]);
+  return val;
+}
+
+long double getExpected(double *data) {
+  auto val = alm_mp_mish(data[0]);
+  return val;
+}
+
+// Used by the Complex Number Functions only!
+double _Complex getExpected(float _Complex *data) {
+  return 0.0;
+}
+
+long double _Complex getExpected(double _Complex *data) {
+  return 0.0;
+}
+
+float getGlibcOp(float *data) {
+  return 0.0; /* no mish in glibc */
+}
+
+double getGlibcOp(double *data) {
+  return 0.0;
+}
+
+/**********************
+*FUNCTIONS*
+**********************/
+int test_s1s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_s1d(test_data *data, int idx)  {
+  return 0;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int test_v2d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4d(test_data *data, int idx)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    double *ip  = (double*)data->ip;
+    double *op  = (double*)data->op;
+    __m256d ip4 = _mm256_loadu_pd(&ip[idx]);
+    __m256d op4 = amd_vrd4_mish(ip4);
+    _mm256_storeu_pd(&op[0], op4);
+  #endif
+  return 0;
+}
+
+int test_v8s(test_data *data, int idx)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    __m256 ip8 = _mm256_loadu_ps(&ip[idx]);
+    __m256 op8 = amd_vrs8_mishf(ip8);
+    _mm256_storeu_ps(&op[0], op8);
+  #endif
+  return 0;
+}
+
+int test_v8d(test_data *data, int idx)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    #if defined(__AVX512__)
+    double *ip  = (double*)data->ip;
+    double *op  = (double*)data->op;
+    __m512d ip8 = _mm512_loadu_pd(&ip[idx]);
+    __m512d op8 = amd_vrd8_mish(ip8);
+    _mm512_storeu_pd(&op[0], op8);
+    #endif /* __AVX512__ */
+  #endif
+  return 0;
+}
+
+int test_v16s(test_data *data, int idx)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    #if defined(__AVX512__)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    __m512 ip16 = _mm512_loadu_ps(&ip[idx]);
+    __m512 op16 = amd_vrs16_mishf(ip16);
+    _mm512_storeu_ps(&op[0], op16);
+    #endif /* __AVX512__ */
+  #endif
+  return 0;
+}
+
+int test_vas(test_data *data, int count)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    amd_vrsa_mishf(count, ip, op);
+  #endif
+  return 0;
+}
+
+int test_vad(test_data *data, int count)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    double *ip  = (double*)data->ip;
+    double *op  = (double*)data->op;
+    amd_vrda_mish(count, ip, op);
+  #endif
+  return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
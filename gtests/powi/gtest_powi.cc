@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <climits>
+#include <limits>
+#include <vector>
+#include <math.h>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * Integer exponents through amd_vrda_powi()/amd_vrsa_powif(), and the
+ * integer and half-integer shortcut of amd_vrda_powx()/amd_vrsa_powxf().
+ *
+ * Every result is checked against the MP pow. Both precisions round once,
+ * denormal and overflowing results included, so every lane is held to
+ * POWI_ULP. Zero, infinite and NaN results must match the MP result, and
+ * a power of a negative x is negative exactly when the exponent is an odd
+ * integer.
+ */
+
+/* as in include/libm/alm_powi.h, the largest |n| taken by the chains */
+#define POWI_MAX        1024
+
+#define POWI_ULP        0.501
+
+template <typename T> struct PowiOps;
+
+template <> struct PowiOps<double> {
+  typedef long double wide;
+  /* log2 of the largest scaled input result, inside [2^-960, 2^1000] */
+  static constexpr double span = 950.0;
+  static constexpr int emax = 1024, emin = -1022, etiny = -1074;
+  static void powi(int n, const double *x, int k, double *r) {
+    amd_vrda_powi(n, x, k, r);
+  }
+  static void powx(int n, const double *x, double y, double *r) {
+    amd_vrda_powx(n, x, y, r);
+  }
+  static wide expected(double x, double y) {
+    return alm_mp_pow(x, y);
+  }
+};
+
+template <> struct PowiOps<float> {
+  typedef double wide;
+  static constexpr double span = 120.0;
+  static constexpr int emax = 128, emin = -126, etiny = -149;
+  static void powi(int n, const float *x, int k, float *r) {
+    amd_vrsa_powif(n, x, k, r);
+  }
+  static void powx(int n, const float *x, double y, float *r) {
+    amd_vrsa_powxf(n, x, (float)y, r);
+  }
+  static wide expected(float x, double y) {
+    return alm_mp_powf(x, (float)y);
+  }
+};
+
+static const int powi_exps[] = {
+  0, 1, -1, 2, -2, 3, -3, 4, 5, -7, 8, 16, 17, -31, 32, 100, -255,
+  511, -512, 1000, -1001, 1023, -1023, POWI_MAX, -POWI_MAX,
+};
+
+static const double powi_halves[] = {
+  0.5, -0.5, 1.5, -2.5, 7.5, -100.5, 511.5, 1023.5, -1023.5,
+};
+
+/* Past POWI_MAX powi hands the whole array to powx */
+static const int powi_beyond[] = {
+  POWI_MAX + 1, -POWI_MAX - 1, 2000, -4097, INT_MAX, INT_MIN,
+};
+
+template <typename T>
+static bool SameBits(T a, T b) {
+  return memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+/* r = x^y against the MP pow; returns 1 on a failure */
+template <typename T>
+static int CheckPow(T x, double y, T r, double *max_ulp, int vflag) {
+  typename PowiOps<T>::wide e = PowiOps<T>::expected(x, y);
+  double ulp = 0.0;
+  bool ok;
+
+  if (isnan(e)) {
+    ok = isnan(r);
+  } else {
+    ulp = getUlp(r, e);
+    ok = ulp <= POWI_ULP;
+    if (ulp > *max_ulp)
+      *max_ulp = ulp;
+  }
+
+  if (ok && !isnan(r))
+    ok = !signbit(r) == !(signbit(x) && fmod(fabs(y), 2.0) == 1.0);
+
+  if (!ok && vflag)
+    printf("x=%a y=%.17g: got %a expected %La (%g ulp)\n", (double)x, y,
+           (double)r, (long double)e, ulp);
+  return !ok;
+}
+
+/*
+ * count inputs spread over the range where x^k stays inside the double
+ * chain, alternating in sign so odd and even k see negative x.
+ */
+template <typename T>
+static std::vector<T> ScaledInputs(uint32_t count, int k) {
+  std::vector<T> x(count);
+  double span = PowiOps<T>::span / (k ? fabs((double)k) : 1.0);
+
+  for (uint32_t i = 0; i < count; i++) {
+    double u = 2.0 * (i + 0.37) / count - 1.0;
+    T v = (T)exp2(u * span);
+    x[i] = (i & 1) ? -v : v;
+  }
+  return x;
+}
+
+/* The zeros, infinities, NaNs and extremes of T, both signs */
+template <typename T>
+static std::vector<T> SpecialInputs(void) {
+  typedef std::numeric_limits<T> lim;
+  static const T mag[] = {
+    (T)0.0, lim::infinity(), lim::quiet_NaN(), (T)1.0, (T)2.0, (T)0.5,
+    (T)3.0, lim::max(), lim::min(), lim::denorm_min(),
+  };
+  std::vector<T> x;
+
+  for (T m : mag) {
+    x.push_back(m);
+    x.push_back(-m);
+  }
+  return x;
+}
+
+template <typename T>
+static void RunPowi(const std::vector<T> &x, int k, int vflag, int *ntests,
+                    int *nfail, double *max_ulp) {
+  std::vector<T> r(x.size());
+
+  PowiOps<T>::powi((int)x.size(), x.data(), k, r.data());
+  for (size_t i = 0; i < x.size(); i++)
+    *nfail += CheckPow(x[i], (double)k, r[i], max_ulp, vflag);
+  *ntests += (int)x.size();
+}
+
+template <typename T>
+static void RunPowx(const std::vector<T> &x, double y, int vflag, int *ntests,
+                    int *nfail, double *max_ulp) {
+  std::vector<T> r(x.size());
+
+  PowiOps<T>::powx((int)x.size(), x.data(), y, r.data());
+  for (size_t i = 0; i < x.size(); i++)
+    *nfail += CheckPow(x[i], y, r[i], max_ulp, vflag);
+  *ntests += (int)x.size();
+}
+
+/* powx with y = k must give the same bits as powi with k */
+template <typename T>
+static int SamePowiPowx(const std::vector<T> &x, int k, int vflag) {
+  std::vector<T> ri(x.size()), rx(x.size());
+  int nfail = 0;
+
+  PowiOps<T>::powi((int)x.size(), x.data(), k, ri.data());
+  PowiOps<T>::powx((int)x.size(), x.data(), (double)k, rx.data());
+  for (size_t i = 0; i < x.size(); i++) {
+    if (!SameBits(ri[i], rx[i])) {
+      nfail++;
+      if (vflag)
+        printf("x=%a k=%d: powi %a powx %a\n", (double)x[i], k,
+               (double)ri[i], (double)rx[i]);
+    }
+  }
+  return nfail;
+}
+
+/* Negative, zero and up to POWI_MAX exponents, on raw and scaled inputs */
+template <typename T>
+static void RunExponents(const T *in, uint32_t count, int vflag, int *ntests,
+                         int *nfail, double *max_ulp) {
+  std::vector<T> raw(in, in + count);
+
+  for (int k : powi_exps) {
+    RunPowi(raw, k, vflag, ntests, nfail, max_ulp);
+    RunPowi(ScaledInputs<T>(count, k), k, vflag, ntests, nfail, max_ulp);
+  }
+}
+
+/* Zero, infinite and NaN operands and the extremes, for powi and powx */
+template <typename T>
+static void RunSpecials(int vflag, int *ntests, int *nfail, double *max_ulp) {
+  std::vector<T> x = SpecialInputs<T>();
+  static const int ks[] = { 0, 1, -1, 2, -2, 3, -3, 1023, -1023,
+                            POWI_MAX, -POWI_MAX };
+
+  for (int k : ks) {
+    RunPowi(x, k, vflag, ntests, nfail, max_ulp);
+    RunPowx(x, (double)k, vflag, ntests, nfail, max_ulp);
+  }
+  for (double y : powi_halves)
+    RunPowx(x, y, vflag, ntests, nfail, max_ulp);
+}
+
+/*
+ * x around the k-th roots of the overflow threshold, the smallest normal
+ * and the smallest denormal, and of half of the latter, so x^k lands on
+ * either side of each of them.
+ */
+template <typename T>
+static void RunRange(int vflag, int *ntests, int *nfail, double *max_ulp) {
+  static const int ks[] = { 2, -2, 3, -3, 7, -7, 64, -65, 1023, -POWI_MAX };
+  const double edges[] = { (double)PowiOps<T>::emax, (double)PowiOps<T>::emin,
+                           (double)PowiOps<T>::etiny, PowiOps<T>::etiny - 1.0 };
+
+  for (int k : ks) {
+    std::vector<T> x;
+
+    for (double e : edges) {
+      T v = (T)exp2(e / k);
+      for (int s = 0; s < 4; s++) {
+        x.push_back(v);
+        x.push_back(-v);
+        x.push_back(nextafter(v, (T)0.0));
+        x.push_back(-nextafter(v, (T)0.0));
+        v = nextafter(v, std::numeric_limits<T>::infinity());
+      }
+    }
+    RunPowi(x, k, vflag, ntests, nfail, max_ulp);
+  }
+}
+
+/*
+ * Half-integer exponents against the MP pow, and integral ones, including
+ * those past POWI_MAX, against powi.
+ */
+template <typename T>
+static void RunPowxShortcut(const T *in, uint32_t count, int vflag,
+                            int *ntests, int *nfail, double *max_ulp) {
+  std::vector<T> raw(in, in + count);
+
+  for (double y : powi_halves) {
+    std::vector<T> x = ScaledInputs<T>(count, (int)fabs(y) + 1);
+    for (T &v : x)
+      v = fabs(v);
+    RunPowx(x, y, vflag, ntests, nfail, max_ulp);
+  }
+
+  for (int k : powi_exps) {
+    *nfail += SamePowiPowx(raw, k, vflag);
+    *nfail += SamePowiPowx(ScaledInputs<T>(count, k), k, vflag);
+    *ntests += 2 * count;
+  }
+  for (int k : powi_beyond) {
+    *nfail += SamePowiPowx(raw, k, vflag);
+    *ntests += count;
+  }
+}
+
+#define POWI_REPORT(name, var)                                                \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",\
+          "Powi", name, var, ntests, (ntests - nfail), nfail, max_ulp);       \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_EXPONENTS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunExponents(inpbuff, count, vflag, &ntests, &nfail, &max_ulp);
+  POWI_REPORT("Exponents", "vrda_powi");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunSpecials<double>(vflag, &ntests, &nfail, &max_ulp);
+  POWI_REPORT("Specials", "vrda_powi");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_RANGE) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunRange<double>(vflag, &ntests, &nfail, &max_ulp);
+  POWI_REPORT("Range", "vrda_powi");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_POWX) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunPowxShortcut(inpbuff, count, vflag, &ntests, &nfail, &max_ulp);
+  POWI_REPORT("Powx", "vrda_powx");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_EXPONENTS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunExponents(inpbuff, count, vflag, &ntests, &nfail, &max_ulp);
+  POWI_REPORT("Exponents", "vrsa_powif");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunSpecials<float>(vflag, &ntests, &nfail, &max_ulp);
+  POWI_REPORT("Specials", "vrsa_powif");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_RANGE) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunRange<float>(vflag, &ntests, &nfail, &max_ulp);
+  POWI_REPORT("Range", "vrsa_powif");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_POWX) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunPowxShortcut(inpbuff, count, vflag, &ntests, &nfail, &max_ulp);
+  POWI_REPORT("Powx", "vrsa_powxf");
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __TEST_POWI_DATA_H__
+#define __TEST_POWI_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for amd_vrsa_powif() and amd_vrda_powi(), run
+ * with n = 3.
+ *
+ * An odd power keeps the sign of x, so the table pairs the signed zeros,
+ * infinities and NaNs with the finite edges where x^3 overflows, lands
+ * exactly on a denormal or underflows to zero. In double precision only the
+ * zero, infinite and NaN rows take the scalar pow() fallback.
+ */
+
+static libm_test_special_data_f32
+test_powif_conformance_data[] = {
+    { POS_ZERO_F32,    POS_ZERO_F32,    AMD_F_NONE      },  /* (+0)^3 = +0 */
+    { NEG_ZERO_F32,    NEG_ZERO_F32,    AMD_F_NONE      },  /* (-0)^3 = -0 */
+    { POS_INF_F32,     POS_INF_F32,     AMD_F_NONE      },  /* (+Inf)^3 = +Inf */
+    { NEG_INF_F32,     NEG_INF_F32,     AMD_F_NONE      },  /* (-Inf)^3 = -Inf */
+    { POS_QNAN_F32,    POS_QNAN_F32,    AMD_F_NONE      },  /* (+QNaN)^3 = +QNaN */
+    { NEG_QNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE      },  /* (-QNaN)^3 = -QNaN */
+    { POS_ONE_F32,     POS_ONE_F32,     AMD_F_NONE      },  /* 1^3 = 1 */
+    { NEG_ONE_F32,     NEG_ONE_F32,     AMD_F_NONE      },  /* (-1)^3 = -1 */
+    { 0xc0000000,      0xc1000000,      AMD_F_NONE      },  /* (-2)^3 = -8 */
+    { 0x3fc00000,      0x40580000,      AMD_F_NONE      },  /* 1.5^3 = 3.375 */
+    { 0x55000000,      POS_INF_F32,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* 2^43, overflow */
+    { 0xd5000000,      NEG_INF_F32,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* -2^43, overflow */
+    { 0x54800000,      0x7e800000,      AMD_F_NONE      },  /* 2^42, exact 2^126 */
+    { 0x27000000,      0x00000004,      AMD_F_NONE      },  /* 2^-49, exact denormal 2^-147 */
+    { 0xa6000000,      NEG_ZERO_F32,    AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* -2^-51, underflow */
+    { POS_LDENORM_F32, POS_ZERO_F32,    AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* denormal^3 = +0 */
+    { POS_HNORMAL_F32, POS_INF_F32,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* FLT_MAX^3 = +Inf */
+    { NEG_HNORMAL_F32, NEG_INF_F32,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* (-FLT_MAX)^3 = -Inf */
+};
+
+static libm_test_special_data_f64
+test_powi_conformance_data[] = {
+    { POS_ZERO_F64,    POS_ZERO_F64,    AMD_F_NONE      },  /* (+0)^3 = +0 */
+    { NEG_ZERO_F64,    NEG_ZERO_F64,    AMD_F_NONE      },  /* (-0)^3 = -0 */
+    { POS_INF_F64,     POS_INF_F64,     AMD_F_NONE      },  /* (+Inf)^3 = +Inf */
+    { NEG_INF_F64,     NEG_INF_F64,     AMD_F_NONE      },  /* (-Inf)^3 = -Inf */
+    { POS_QNAN_F64,    POS_QNAN_F64,    AMD_F_NONE      },  /* (+QNaN)^3 = +QNaN */
+    { NEG_QNAN_F64,    NEG_QNAN_F64,    AMD_F_NONE      },  /* (-QNaN)^3 = -QNaN */
+    { POS_ONE_F64,     POS_ONE_F64,     AMD_F_NONE      },  /* 1^3 = 1 */
+    { NEG_ONE_F64,     NEG_ONE_F64,     AMD_F_NONE      },  /* (-1)^3 = -1 */
+    { 0xc000000000000000, 0xc020000000000000, AMD_F_NONE },  /* (-2)^3 = -8 */
+    { 0x3ff8000000000000, 0x400b000000000000, AMD_F_NONE },  /* 1.5^3 = 3.375 */
+    { 0x5550000000000000, POS_INF_F64,  AMD_F_OVERFLOW | AMD_F_INEXACT },  /* 2^342, overflow */
+    { 0xd550000000000000, NEG_INF_F64,  AMD_F_OVERFLOW | AMD_F_INEXACT },  /* -2^342, overflow */
+    { 0x5540000000000000, 0x7fe0000000000000, AMD_F_NONE },  /* 2^341, exact 2^1023 */
+    { 0x2990000000000000, 0x0000000000000001, AMD_F_NONE },  /* 2^-358, exact 2^-1074 */
+    { 0xa970000000000000, NEG_ZERO_F64, AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* -2^-360, underflow */
+    { POS_LDENORM_F64, POS_ZERO_F64,    AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* denormal^3 = +0 */
+    { POS_HNORMAL_F64, POS_INF_F64,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* DBL_MAX^3 = +Inf */
+    { NEG_HNORMAL_F64, NEG_INF_F64,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* (-DBL_MAX)^3 = -Inf */
+};
+
+#endif /*__TEST_POWI_DATA_H__*/
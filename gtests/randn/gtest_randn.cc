@@ -0,0 +1,453 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "almrandn.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+
+/*
+ * alm_randn()/alm_randnf() and their kernels:
+ *
+ *  - Stream: elements at several seeds and offsets, up to the end of the
+ *    counter range, against the scalar reference of almrandn.h, for the
+ *    dispatched, AVX2 and Zen4 kernels and both methods.
+ *  - Moments: mean, variance, skewness, kurtosis, the tail mass, the
+ *    Kolmogorov-Smirnov distance to the normal distribution and the
+ *    correlation between neighbours, Box-Muller pairs and seeds, over
+ *    2^20 variates. The thresholds are 5 standard deviations of each
+ *    statistic; the seeds are fixed, so the results are too.
+ *  - Reproduce: repeated calls, every split of a range in two, random
+ *    splits, multithreaded calls, the float stream across ISA widths, the
+ *    argument checks and the ends of the output array.
+ */
+
+extern "C" {
+void amd_vrda_randn_avx2(int method, uint64_t seed, uint64_t offset, int len,
+                         double *dst);
+void amd_vrsa_randnf_avx2(int method, uint64_t seed, uint64_t offset, int len,
+                          float *dst);
+#if defined(__AVX512__)
+void amd_vrda_randn_zn4(int method, uint64_t seed, uint64_t offset, int len,
+                        double *dst);
+void amd_vrsa_randnf_zn4(int method, uint64_t seed, uint64_t offset, int len,
+                         float *dst);
+#endif
+}
+
+template <typename T> struct RandnOps;
+
+template <> struct RandnOps<double> {
+  typedef long double ref;
+  typedef void (*kern)(int, uint64_t, uint64_t, int, double *);
+  static int api(int m, uint64_t seed, uint64_t off, size_t n, double *z) {
+    return alm_randn((alm_randn_method_t)m, seed, off, n, z);
+  }
+  static long double reference(int m, uint64_t seed, uint64_t k) {
+    return RndRef(m, seed, k);
+  }
+  /* vrd4/vrd8 cdfnorminv, log and sincos are not correctly rounded */
+  static double bound(int m) { return 4.0; }
+};
+
+template <> struct RandnOps<float> {
+  typedef double ref;
+  typedef void (*kern)(int, uint64_t, uint64_t, int, float *);
+  static int api(int m, uint64_t seed, uint64_t off, size_t n, float *z) {
+    return alm_randnf((alm_randn_method_t)m, seed, off, n, z);
+  }
+  static double reference(int m, uint64_t seed, uint64_t k) {
+    return RndReff(m, seed, k);
+  }
+  /* binary64 all the way, one rounding to float at the end */
+  static double bound(int m) { return 1.0; }
+};
+
+template <typename T>
+static const std::vector<std::pair<const char *, typename RandnOps<T>::kern>>
+Kernels();
+
+template <>
+const std::vector<std::pair<const char *, RandnOps<double>::kern>>
+Kernels<double>()
+{
+  return { { "vrda", amd_vrda_randn }, { "avx2", amd_vrda_randn_avx2 },
+#if defined(__AVX512__)
+           { "zn4", amd_vrda_randn_zn4 },
+#endif
+  };
+}
+
+template <>
+const std::vector<std::pair<const char *, RandnOps<float>::kern>>
+Kernels<float>()
+{
+  return { { "vrsa", amd_vrsa_randnf }, { "avx2", amd_vrsa_randnf_avx2 },
+#if defined(__AVX512__)
+           { "zn4", amd_vrsa_randnf_zn4 },
+#endif
+  };
+}
+
+static const char *rnd_names[] = { "icdf", "box_muller" };
+
+/*
+ * Inverse CDF variates are the cdfnorminv kernel on an exact input and get
+ * a plain ULP error. A Box-Muller variate is a product whose cosine or
+ * sine factor can cancel, so its error is taken in ulp of max(|z|, 1).
+ */
+template <typename T, typename R>
+static double RandnErr(int method, T got, R exptd)
+{
+  if (!std::isfinite(got))
+    return INFINITY;
+  if (method == RND_ICDF_METHOD)
+    return getUlp(got, exptd);
+
+  R scale = fabsl(exptd) > 1 ? fabsl(exptd) : (R)1;
+  int e = ilogbl(scale) - (std::numeric_limits<T>::digits - 1);
+  return (double)(fabsl((R)got - exptd) / ldexpl(1.0L, e));
+}
+
+static const uint64_t rnd_seeds[] = { 0, 1, 2026, 0xdeadbeefcafef00dULL };
+
+/* Block boundaries, the carry into the high counter word and the end */
+static const uint64_t rnd_offsets[] = { 0, 13, ((uint64_t)1 << 33) - 37,
+                                        ((uint64_t)1 << 40) + 7,
+                                        UINT64_MAX - 1100 };
+
+#define RANDN_STREAM_LEN 1000
+
+template <typename T>
+static void RunStream(int vflag, int *ntests, int *nfail, double *max_ulp)
+{
+  for (int m = 0; m < 2; m++) {
+    for (uint64_t seed : rnd_seeds) {
+      for (uint64_t off : rnd_offsets) {
+        std::vector<typename RandnOps<T>::ref> ref(RANDN_STREAM_LEN);
+
+        for (size_t i = 0; i < ref.size(); i++)
+          ref[i] = RandnOps<T>::reference(m, seed, off + i);
+
+        for (const auto &k : Kernels<T>()) {
+          std::vector<T> z(RANDN_STREAM_LEN);
+
+          k.second(m, seed, off, (int)z.size(), z.data());
+          for (size_t i = 0; i < z.size(); i++) {
+            double err = RandnErr(m, z[i], ref[i]);
+
+            if (err > *max_ulp)
+              *max_ulp = err;
+            if (err > RandnOps<T>::bound(m)) {
+              (*nfail)++;
+              if (vflag)
+                printf("%s %s seed %#llx element %llu: %a, expected %La\n",
+                       k.first, rnd_names[m], (unsigned long long)seed,
+                       (unsigned long long)(off + i), (double)z[i],
+                       (long double)ref[i]);
+            }
+          }
+          *ntests += (int)z.size();
+        }
+      }
+    }
+  }
+}
+
+#define RANDN_MOMENTS_LEN (1 << 20)
+
+/* Correlation of a[i] and b[i] */
+static long double Corr(const std::vector<long double> &a,
+                        const std::vector<long double> &b)
+{
+  long double ma = 0, mb = 0, sab = 0, saa = 0, sbb = 0;
+  size_t n = a.size();
+
+  for (size_t i = 0; i < n; i++) {
+    ma += a[i];
+    mb += b[i];
+  }
+  ma /= n;
+  mb /= n;
+  for (size_t i = 0; i < n; i++) {
+    sab += (a[i] - ma) * (b[i] - mb);
+    saa += (a[i] - ma) * (a[i] - ma);
+    sbb += (b[i] - mb) * (b[i] - mb);
+  }
+  return sab / sqrtl(saa * sbb);
+}
+
+template <typename T>
+static void RunMoments(int vflag, int *ntests, int *nfail)
+{
+  const size_t n = RANDN_MOMENTS_LEN;
+  const long double sd = 1.0L / sqrtl((long double)n);
+
+  for (int m = 0; m < 2; m++) {
+    for (uint64_t seed : { (uint64_t)1, (uint64_t)2026 }) {
+      std::vector<T> z(n), w(n);
+      long double s1 = 0, s2 = 0, s3 = 0, s4 = 0, tail = 0, ks = 0;
+      size_t nonfinite = 0;
+
+      RandnOps<T>::api(m, seed, 0, n, z.data());
+      RandnOps<T>::api(m, seed + 1, 0, n, w.data());
+
+      for (size_t i = 0; i < n; i++) {
+        long double x = z[i];
+        nonfinite += !std::isfinite(z[i]) || fabsl(x) > 9;
+        s1 += x;
+        s2 += x * x;
+        s3 += x * x * x;
+        s4 += x * x * x * x;
+        tail += fabsl(x) > 3;
+      }
+      long double mean = s1 / n, var = s2 / n - mean * mean;
+      long double skew = (s3 / n - 3 * mean * var - mean * mean * mean) /
+                         powl(var, 1.5L);
+      long double kurt = (s4 / n - 4 * mean * (s3 / n) +
+                          6 * mean * mean * (s2 / n) -
+                          3 * mean * mean * mean * mean) / (var * var) - 3;
+      /* P(|z| > 3) */
+      const long double p3 = erfcl(3.0L / sqrtl(2.0L));
+
+      std::vector<T> sorted(z);
+      std::sort(sorted.begin(), sorted.end());
+      for (size_t i = 0; i < n; i++) {
+        long double f = 0.5L * erfcl(-(long double)sorted[i] / sqrtl(2.0L));
+        ks = std::max(ks, std::max(fabsl(f - (long double)i / n),
+                                   fabsl((long double)(i + 1) / n - f)));
+      }
+
+      std::vector<long double> a(n - 1), b(n - 1), c(n), d(n), pe(n / 2),
+                               po(n / 2);
+      for (size_t i = 0; i + 1 < n; i++) {
+        a[i] = z[i];
+        b[i] = z[i + 1];
+      }
+      for (size_t i = 0; i < n; i++) {
+        c[i] = z[i];
+        d[i] = w[i];
+      }
+      /* squares of the two halves of each Box-Muller pair */
+      for (size_t i = 0; i < n / 2; i++) {
+        pe[i] = (long double)z[2 * i] * z[2 * i];
+        po[i] = (long double)z[2 * i + 1] * z[2 * i + 1];
+      }
+
+      struct { const char *name; long double val, lim; } stats[] = {
+        { "mean",       mean,              5 * sd },
+        { "variance",   var - 1,           5 * sd * sqrtl(2.0L) },
+        { "skewness",   skew,              5 * sd * sqrtl(6.0L) },
+        { "kurtosis",   kurt,              5 * sd * sqrtl(24.0L) },
+        { "tail",       tail / n - p3,     5 * sd * sqrtl(p3 * (1 - p3)) },
+        { "ks",         ks,                1.95L * sd },
+        { "lag1",       Corr(a, b),        5 * sd },
+        { "pairs",      Corr(pe, po),      5 * sd * sqrtl(2.0L) },
+        { "seeds",      Corr(c, d),        5 * sd },
+        { "nonfinite",  (long double)nonfinite, 0 },
+      };
+
+      for (const auto &s : stats) {
+        if (fabsl(s.val) > s.lim) {
+          (*nfail)++;
+          if (vflag)
+            printf("%s seed %llu: %s %Lg, limit %Lg\n", rnd_names[m],
+                   (unsigned long long)seed, s.name, s.val, s.lim);
+        }
+        (*ntests)++;
+      }
+    }
+  }
+}
+
+template <typename T>
+static bool Same(const std::vector<T> &a, const std::vector<T> &b)
+{
+  return memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+}
+
+template <typename T>
+static void RunReproduce(int vflag, int *ntests, int *nfail)
+{
+  auto kern = Kernels<T>()[0].second;
+  const T canary = (T)-1234.5;
+  uint64_t lcg = 7;
+
+#define RANDN_CHECK(cond, ...)                                                \
+  do {                                                                        \
+    (*ntests)++;                                                              \
+    if (!(cond)) {                                                            \
+      (*nfail)++;                                                             \
+      if (vflag)                                                              \
+        printf(__VA_ARGS__);                                                  \
+    }                                                                         \
+  } while (0)
+
+  for (int m = 0; m < 2; m++) {
+    /* Same arguments, same values; another seed, other values */
+    std::vector<T> a(4099), b(4099), c(4099);
+    kern(m, 2026, 5, (int)a.size(), a.data());
+    kern(m, 2026, 5, (int)b.size(), b.data());
+    kern(m, 2027, 5, (int)c.size(), c.data());
+    RANDN_CHECK(Same(a, b), "%s: repeated call differs\n", rnd_names[m]);
+    size_t same = 0;
+    for (size_t i = 0; i < a.size(); i++)
+      same += a[i] == c[i];
+    RANDN_CHECK(same == 0, "%s: %zu elements shared by seeds 2026 and 2027\n",
+                rnd_names[m], same);
+
+    /* Every split of a range in two, at two alignments */
+    for (uint64_t off : { (uint64_t)0, (uint64_t)5 }) {
+      std::vector<T> whole(70), parts(70);
+      kern(m, 99, off, (int)whole.size(), whole.data());
+      for (int p = 0; p <= 70; p++) {
+        kern(m, 99, off, p, parts.data());
+        kern(m, 99, off + p, 70 - p, parts.data() + p);
+        RANDN_CHECK(Same(whole, parts), "%s: split at %llu + %d differs\n",
+                    rnd_names[m], (unsigned long long)off, p);
+      }
+    }
+
+    /* Random splits of a long range */
+    std::vector<T> whole(100003), parts(100003);
+    kern(m, 3, 11, (int)whole.size(), whole.data());
+    for (size_t i = 0, n; i < parts.size(); i += n) {
+      lcg = lcg * 6364136223846793005ULL + 1442695040888963407ULL;
+      n = std::min<size_t>((lcg >> 33) % 300, parts.size() - i);
+      kern(m, 3, 11 + i, (int)n, parts.data() + i);
+    }
+    RANDN_CHECK(Same(whole, parts), "%s: random splits differ\n", rnd_names[m]);
+
+    /* The API, on one thread and on several */
+    std::vector<T> api(whole.size());
+    RANDN_CHECK(RandnOps<T>::api(m, 3, 11, api.size(), api.data()) == 0 &&
+                Same(whole, api), "%s: API differs from the kernel\n",
+                rnd_names[m]);
+    alm_set_num_threads(4);
+    alm_set_grain_size(1000);
+    std::fill(api.begin(), api.end(), (T)0);
+    RANDN_CHECK(RandnOps<T>::api(m, 3, 11, api.size(), api.data()) == 0 &&
+                Same(whole, api), "%s: threaded API differs\n", rnd_names[m]);
+    alm_set_num_threads(1);
+    alm_set_grain_size(0);
+
+    /* The float stream is rounded from binary64, the same for all widths */
+    if (sizeof(T) == sizeof(float)) {
+      for (const auto &k : Kernels<T>()) {
+        std::vector<T> v(whole.size());
+        k.second(m, 3, 11, (int)v.size(), v.data());
+        RANDN_CHECK(Same(whole, v), "%s: %s differs\n", rnd_names[m],
+                    k.first);
+      }
+    }
+
+    /* Nothing is written outside dst[0 .. len - 1] */
+    for (int len = 0; len <= 40; len++) {
+      std::vector<T> buf(len + 32, canary);
+      bool ok = true;
+      kern(m, 8, 3, len, buf.data() + 16);
+      for (int i = 0; i < 16; i++)
+        ok = ok && buf[i] == canary && buf[16 + len + i] == canary;
+      for (int i = 0; i < len; i++)
+        ok = ok && buf[16 + i] != canary;
+      RANDN_CHECK(ok, "%s: len %d writes outside dst\n", rnd_names[m], len);
+    }
+  }
+
+  /* Invalid arguments */
+  std::vector<T> buf(64, canary), keep(buf);
+  RANDN_CHECK(RandnOps<T>::api(2, 1, 0, buf.size(), buf.data()) == -1 &&
+              RandnOps<T>::api(-1, 1, 0, buf.size(), buf.data()) == -1 &&
+              Same(buf, keep), "invalid method accepted\n");
+  kern(2, 1, 0, (int)buf.size(), buf.data());
+  RANDN_CHECK(Same(buf, keep), "kernel writes for an invalid method\n");
+  RANDN_CHECK(RandnOps<T>::api(0, 1, 0, 8, nullptr) == -1,
+              "NULL dst accepted\n");
+  RANDN_CHECK(RandnOps<T>::api(0, 1, 0, 0, nullptr) == 0,
+              "empty NULL dst rejected\n");
+
+#undef RANDN_CHECK
+}
+
+#define RANDN_REPORT(name, var)                                               \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail);            \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+#define RANDN_REPORT_ULP(var)                                                 \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",\
+          "Stream", "Accuracy", var, ntests, (ntests - nfail), nfail,        \
+          max_ulp);                                                           \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_STREAM) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunStream<double>(vflag, &ntests, &nfail, &max_ulp);
+  RANDN_REPORT_ULP("vrda");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_MOMENTS) {
+  int ntests = 0, nfail = 0;
+  RunMoments<double>(vflag, &ntests, &nfail);
+  RANDN_REPORT("Moments", "vrda");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_REPRODUCE) {
+  int ntests = 0, nfail = 0;
+  RunReproduce<double>(vflag, &ntests, &nfail);
+  RANDN_REPORT("Reproduce", "vrda");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_STREAM) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunStream<float>(vflag, &ntests, &nfail, &max_ulp);
+  RANDN_REPORT_ULP("vrsa");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_MOMENTS) {
+  int ntests = 0, nfail = 0;
+  RunMoments<float>(vflag, &ntests, &nfail);
+  RANDN_REPORT("Moments", "vrsa");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_REPRODUCE) {
+  int ntests = 0, nfail = 0;
+  RunReproduce<float>(vflag, &ntests, &nfail);
+  RANDN_REPORT("Reproduce", "vrsa");
+}
@@ -0,0 +1,188 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <cmath>
+#include <cstring>
+#include "libm_tests.h"
+#include <libm_macros.h>
+
+#include <libm_amd.h>
+#include <libm/amd_funcs_internal.h>
+#include <fmaintrin.h>
+#include <immintrin.h>
+#include "callback.h"
+#include "almrandn.h"
+#include "test_randn_data.h"
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * alm_randn takes no input array, so the generic array tests read the bits
+ * of each input as a seed and check element 0 of the inverse CDF stream
+ * of that seed against the scalar reference of almrandn.h.
+ * gtest_randn.cc covers whole streams, both methods, the moments and the
+ * reproducibility over seeds, offsets and threads.
+ */
+
+static uint32_t ipargs = 1;
+bool special_case = false;
+
+uint32_t GetnIpArgs( void )
+{
+  return ipargs;
+}
+
+bool getSpecialCase(void)
+{
+  return special_case;
+}
+
+static uint64_t SeedOf(float x)
+{
+  uint32_t u;
+  memcpy(&u, &x, sizeof(u));
+  return u;
+}
+
+static uint64_t SeedOf(double x)
+{
+  uint64_t u;
+  memcpy(&u, &x, sizeof(u));
+  return u;
+}
+
+void ConfSetupf32(SpecParams *specp) {
+  specp->data32 = test_randnf_conformance_data;
+  specp->countf = ARRAY_SIZE(test_randnf_conformance_data);
+}
+
+void ConfSetupf64(SpecParams *specp) {
+  specp->data64 = test_randn_conformance_data;
+  specp->countd = ARRAY_SIZE(test_randn_conformance_data);
+}
+
+float getFuncOp(float *data) {
+  float z;
+  amd_vrsa_randnf(RND_ICDF_METHOD, SeedOf(data[0]), 0, 1, &z);
+  return z;
+}
+
+double getFuncOp(double *data) {
+  double z;
+  amd_vrda_randn(RND_ICDF_METHOD, SeedOf(data[0]), 0, 1, &z);
+  return z;
+}
+
+double getExpected(float *data) {
+  auto val = RndReff(RND_ICDF_METHOD, SeedOf(data[0]), 0);
+  return val;
+}
+
+long double getExpected(double *data) {
+  auto val = RndRef(RND_ICDF_METHOD, SeedOf(data[0]), 0);
+  return val;
+}
+
+// Used by the Complex Number Functions only!
+double _Complex getExpected(float _Complex *data) {
+  return 0.0;
+}
+
+long double _Complex getExpected(double _Complex *data) {
+  return 0.0;
+}
+
+float getGlibcOp(float *data) {
+  return (float)RndReff(RND_ICDF_METHOD, SeedOf(data[0]), 0);
+}
+
+double getGlibcOp(double *data) {
+  return (double)RndRef(RND_ICDF_METHOD, SeedOf(data[0]), 0);
+}
+
+/**********************
+*FUNCTIONS*
+**********************/
+int test_s1s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_s1d(test_data *data, int idx)  {
+  return 0;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int test_v2d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v4d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v8s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v8d(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_v16s(test_data *data, int idx)  {
+  return 0;
+}
+
+int test_vas(test_data *data, int count)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    float *ip  = (float*)data->ip;
+    float *op  = (float*)data->op;
+    for (int i = 0; i < count; i++)
+      amd_vrsa_randnf(RND_ICDF_METHOD, SeedOf(ip[i]), 0, 1, &op[i]);
+  #endif
+  return 0;
+}
+
+int test_vad(test_data *data, int count)  {
+  #if (LIBM_PROTOTYPE == PROTOTYPE_AOCL)
+    double *ip  = (double*)data->ip;
+    double *op  = (double*)data->op;
+    for (int i = 0; i < count; i++)
+      amd_vrda_randn(RND_ICDF_METHOD, SeedOf(ip[i]), 0, 1, &op[i]);
+  #endif
+  return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
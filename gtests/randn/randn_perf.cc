@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include <string>
+#include <cstring>
+#include <chrono>
+#include "benchmark.h"
+#include "almtestperf.h"
+#include "callback.h"
+
+using namespace std;
+using namespace ALM;
+
+/*
+ * alm_randn has no input, so the output array of the fixture is filled
+ * once per iteration, for each method, by the single threaded kernel.
+ */
+static void Randn(int method, int n, double *z) {
+  amd_vrda_randn(method, 2026, 0, n, z);
+}
+
+static void Randn(int method, int n, float *z) {
+  amd_vrsa_randnf(method, 2026, 0, n, z);
+}
+
+template <typename T>
+static void LibmPerfTestRandn(benchmark::State& st, InputParams* param,
+                              int method) {
+  AoclLibmTest<T> objtest(param, GetnIpArgs());
+  double szn = param->niter * param->count;
+
+  for (auto _ : st) {
+    Randn(method, param->count, objtest.outbuff);
+    benchmark::ClobberMemory();
+  }
+
+  namespace bm = benchmark;
+  st.counters["MOPS"] = bm::Counter{szn, bm::Counter::kIsRate};
+}
+
+int AlmTestPerfFramework::AlmTestPerformance(InputParams *params) {
+  static const char *names[] = { "icdf", "box_muller" };
+  string funcnam = "AoclLibm";
+  string libm;
+
+  if((params->fqty != ALM::FloatQuantity::E_All) &&
+     (params->fqty != ALM::FloatQuantity::E_Vector_Array)) {
+    cout << "Only the array variants (-e 32) are available for randn" << endl;
+    return 0;
+  }
+
+  for (int method = 0; method < 2; method++) {
+    if((params->fwidth == ALM::FloatWidth::E_ALL) ||
+      (params->fwidth == ALM::FloatWidth::E_F64)) {
+      string varnam = string("_vad(") + names[method] + ")";
+      libm = funcnam + varnam;
+      benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestRandn<double>,
+                                   params, method)
+                 ->Args({(int)params->count})->Iterations(params->niter);
+    }
+
+    if((params->fwidth == ALM::FloatWidth::E_ALL) ||
+      (params->fwidth == ALM::FloatWidth::E_F32)) {
+      string varnam = string("_vas(") + names[method] + ")";
+      libm = funcnam + varnam;
+      benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestRandn<float>,
+                                   params, method)
+                 ->Args({(int)params->count})->Iterations(params->niter);
+    }
+  }
+
+  size_t retval = benchmark::RunSpecifiedBenchmarks();
+
+  return (int)retval;
+}
+
+
+AlmTestPerfFramework::~AlmTestPerfFramework() {
+#if defined(DEBUG_PRINTS)
+  cout << "AlmTestPerfFramework destructor completed" << endl;
+#endif
+}
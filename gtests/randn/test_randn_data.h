@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef __TEST_RANDN_DATA_H__
+#define __TEST_RANDN_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for amd_vrsa_randnf() and amd_vrda_randn(). The
+ * input is read bit for bit as the seed and the output is element 0 of the
+ * inverse CDF stream of that seed, so zeros, infinities and NaNs are plain
+ * seeds here and must give finite variates. No flags are raised on
+ * purpose.
+ */
+
+static libm_test_special_data_f32
+test_randnf_conformance_data[] = {
+    { POS_ZERO_F32,    0xbe82fa51,      AMD_F_NONE },  /* seed 0 */
+    { NEG_ZERO_F32,    0xbf77b2d3,      AMD_F_NONE },  /* seed 0x80000000 */
+    { POS_ONE_F32,     0xbe07b1b2,      AMD_F_NONE },
+    { NEG_ONE_F32,     0xbe834aa2,      AMD_F_NONE },
+    { POS_INF_F32,     0x3f4ca978,      AMD_F_NONE },
+    { NEG_INF_F32,     0x3f44a01b,      AMD_F_NONE },
+    { POS_QNAN_F32,    0x3f3333a6,      AMD_F_NONE },
+    { NEG_QNAN_F32,    0xbef7c51a,      AMD_F_NONE },
+    { POS_LDENORM_F32, 0x3f9d2c14,      AMD_F_NONE },  /* seed 1 */
+    { POS_HNORMAL_F32, 0xbfc20d7d,      AMD_F_NONE },
+    { 0x40490fdb,      0x3eb39592,      AMD_F_NONE },  /* pi */
+};
+
+static libm_test_special_data_f64
+test_randn_conformance_data[] = {
+    { POS_ZERO_F64,       0x3ff2d769e93cb520, AMD_F_NONE },  /* seed 0 */
+    { NEG_ZERO_F64,       0x3f8db918238b2007, AMD_F_NONE },  /* seed 2^63 */
+    { POS_ONE_F64,        0xbff490687b0b62a9, AMD_F_NONE },
+    { NEG_ONE_F64,        0x3fdfffab3dc720da, AMD_F_NONE },
+    { POS_INF_F64,        0xbfe7d137ae95dac4, AMD_F_NONE },
+    { NEG_INF_F64,        0x3fec29d40c5b4dcc, AMD_F_NONE },
+    { POS_QNAN_F64,       0x3fe055030d4ff1ad, AMD_F_NONE },
+    { NEG_QNAN_F64,       0x3fdc76bad76399e9, AMD_F_NONE },
+    { POS_LDENORM_F64,    0x3ff407827c9b8c2d, AMD_F_NONE },  /* seed 1 */
+    { POS_HNORMAL_F64,    0x3fef9fa367e7b800, AMD_F_NONE },
+    { 0x400921fb54442d18, 0x3f984238a4524804, AMD_F_NONE },  /* pi */
+};
+
+#endif /*__TEST_RANDN_DATA_H__*/
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __TEST_RECIP_DATA_H__
+#define __TEST_RECIP_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for recip(): zeros, infinities, NaNs, exact powers
+ * of two, subnormals and the extremes, where 1/x overflows or is subnormal.
+ *
+ * The default tier is the IEEE divide, so the status flags are those of
+ * 1/x.
+ */
+
+static libm_test_special_data_f32
+test_recipf_conformance_data[] = {
+    { 0x00000000, 0x7F800000, AMD_F_DIVBYZERO },  /* recipf(0) = inf */
+    { 0x80000000, 0xFF800000, AMD_F_DIVBYZERO },  /* recipf(-0) = -inf */
+    { 0x7F800000, 0x00000000, AMD_F_NONE },  /* recipf(inf) = 0 */
+    { 0xFF800000, 0x80000000, AMD_F_NONE },  /* recipf(-inf) = -0 */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* recipf(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* recipf(-nan) = -nan */
+    { 0x3F800000, 0x3F800000, AMD_F_NONE },  /* recipf(1) = 1 */
+    { 0xBF800000, 0xBF800000, AMD_F_NONE },  /* recipf(-1) = -1 */
+    { 0x40800000, 0x3E800000, AMD_F_NONE },  /* recipf(4) = 0.25 */
+    { 0x3E800000, 0x40800000, AMD_F_NONE },  /* recipf(0.25) = 4 */
+    { 0x40000000, 0x3F000000, AMD_F_NONE },  /* recipf(2) = 0.5 */
+    { 0x40400000, 0x3EAAAAAB, AMD_F_INEXACT },  /* recipf(3) = 0.333333343 */
+    { 0x00000001, 0x7F800000, AMD_F_OVERFLOW | AMD_F_INEXACT },  /* recipf(1.40129846e-45) = inf */
+    { 0x007FFFFF, 0x7E800001, AMD_F_INEXACT },  /* recipf(1.17549421e-38) = 8.50706019e+37 */
+    { 0x00800000, 0x7E800000, AMD_F_NONE },  /* recipf(1.17549435e-38) = 8.50705917e+37 */
+    { 0x7F7FFFFF, 0x00200000, AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* recipf(3.40282347e+38) = 2.93873588e-39 */
+    { 0xFF7FFFFF, 0x80200000, AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* recipf(-3.40282347e+38) = -2.93873588e-39 */
+    { 0x80000001, 0xFF800000, AMD_F_OVERFLOW | AMD_F_INEXACT },  /* recipf(-1.40129846e-45) = -inf */
+};
+
+static libm_test_special_data_f64
+test_recip_conformance_data[] = {
+    { 0x0000000000000000, 0x7FF0000000000000, AMD_F_DIVBYZERO },  /* recip(0) = inf */
+    { 0x8000000000000000, 0xFFF0000000000000, AMD_F_DIVBYZERO },  /* recip(-0) = -inf */
+    { 0x7FF0000000000000, 0x0000000000000000, AMD_F_NONE },  /* recip(inf) = 0 */
+    { 0xFFF0000000000000, 0x8000000000000000, AMD_F_NONE },  /* recip(-inf) = -0 */
+    { 0x7FF8000000000000, 0x7FF8000000000000, AMD_F_NONE },  /* recip(nan) = nan */
+    { 0xFFF8000000000000, 0xFFF8000000000000, AMD_F_NONE },  /* recip(-nan) = -nan */
+    { 0x3FF0000000000000, 0x3FF0000000000000, AMD_F_NONE },  /* recip(1) = 1 */
+    { 0xBFF0000000000000, 0xBFF0000000000000, AMD_F_NONE },  /* recip(-1) = -1 */
+    { 0x4010000000000000, 0x3FD0000000000000, AMD_F_NONE },  /* recip(4) = 0.25 */
+    { 0x3FD0000000000000, 0x4010000000000000, AMD_F_NONE },  /* recip(0.25) = 4 */
+    { 0x4000000000000000, 0x3FE0000000000000, AMD_F_NONE },  /* recip(2) = 0.5 */
+    { 0x4008000000000000, 0x3FD5555555555555, AMD_F_INEXACT },  /* recip(3) = 0.33333333333333331 */
+    { 0x0000000000000001, 0x7FF0000000000000, AMD_F_OVERFLOW | AMD_F_INEXACT },  /* recip(4.9406564584124654e-324) = inf */
+    { 0x000FFFFFFFFFFFFF, 0x7FD0000000000001, AMD_F_INEXACT },  /* recip(2.2250738585072009e-308) = 4.4942328371557908e+307 */
+    { 0x0010000000000000, 0x7FD0000000000000, AMD_F_NONE },  /* recip(2.2250738585072014e-308) = 4.4942328371557898e+307 */
+    { 0x7FEFFFFFFFFFFFFF, 0x0004000000000000, AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* recip(1.7976931348623157e+308) = 5.5626846462680035e-309 */
+    { 0xFFEFFFFFFFFFFFFF, 0x8004000000000000, AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* recip(-1.7976931348623157e+308) = -5.5626846462680035e-309 */
+    { 0x8000000000000001, 0xFFF0000000000000, AMD_F_OVERFLOW | AMD_F_INEXACT },  /* recip(-4.9406564584124654e-324) = -inf */
+};
+
+#endif /*__TEST_RECIP_DATA_H__*/
@@ -0,0 +1,346 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+
+/*
+ * Array reductions (sumexp, logsumexp, sumlog) against a compensated long
+ * double reference, plus the propagation of NaN and Inf and the n = 0 and
+ * n = 1 results.
+ *
+ * The inputs are generated here rather than taken from the fixture, since
+ * each reduction needs its own range to stay meaningful: sumlog over inputs
+ * on one side of 1 (no cancellation), logsumexp over large magnitudes that
+ * overflow a plain sum of exponentials.
+ */
+
+enum { RED_SUMEXP, RED_LOGSUMEXP, RED_SUMLOG, RED_NFUNCS };
+
+static const char *red_names[RED_NFUNCS] = { "sumexp", "logsumexp", "sumlog" };
+
+template <typename T> struct ReduceOps;
+
+template <> struct ReduceOps<double> {
+  typedef long double ref;
+  static double run(int f, int n, const double *x) {
+    return f == RED_SUMEXP    ? amd_vrda_sumexp(n, x) :
+           f == RED_LOGSUMEXP ? amd_vrda_logsumexp(n, x) :
+                                amd_vrda_sumlog(n, x);
+  }
+  static void exp(int n, const double *x, double *r) { amd_vrda_exp(n, x, r); }
+};
+
+template <> struct ReduceOps<float> {
+  typedef double ref;
+  static float run(int f, int n, const float *x) {
+    return f == RED_SUMEXP    ? amd_vrsa_sumexpf(n, x) :
+           f == RED_LOGSUMEXP ? amd_vrsa_logsumexpf(n, x) :
+                                amd_vrsa_sumlogf(n, x);
+  }
+  static void exp(int n, const float *x, float *r) { amd_vrsa_expf(n, x, r); }
+};
+
+/* Kahan-Babuska sum in long double */
+static long double RefSum(const std::vector<long double> &v)
+{
+  long double s = 0.0L, c = 0.0L;
+
+  for (long double x : v) {
+    long double t = s + x;
+    if (fabsl(s) >= fabsl(x))
+      c += (s - t) + x;
+    else
+      c += (x - t) + s;
+    s = t;
+  }
+  return s + c;
+}
+
+template <typename T>
+static long double Reference(int f, size_t n, const T *x)
+{
+  std::vector<long double> v(n);
+  long double m = -INFINITY;
+
+  if (f == RED_LOGSUMEXP) {
+    if (n == 0)
+      return -INFINITY;
+    for (size_t i = 0; i < n; i++)
+      m = fmaxl(m, x[i]);
+    for (size_t i = 0; i < n; i++)
+      v[i] = expl((long double)x[i] - m);
+    return m + logl(RefSum(v));
+  }
+  for (size_t i = 0; i < n; i++)
+    v[i] = f == RED_SUMEXP ? expl(x[i]) : logl(x[i]);
+  return RefSum(v);
+}
+
+/* Deterministic uniform values in [lo, hi] */
+template <typename T>
+static void Fill(std::vector<T> &x, double lo, double hi, uint64_t seed)
+{
+  for (size_t i = 0; i < x.size(); i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    x[i] = (T)(lo + (hi - lo) * ((double)(seed >> 11) * 0x1p-53));
+  }
+}
+
+typedef struct {
+  int    func;
+  double lo, hi;       /* double range */
+  double lof, hif;     /* float range */
+} ReduceRange;
+
+static const ReduceRange red_ranges[] = {
+  { RED_SUMEXP,    -20.0,    20.0,    -20.0,   20.0 },
+  { RED_SUMEXP,    -700.0,   -600.0,  -80.0,   -60.0 },
+  { RED_SUMEXP,    690.0,    709.0,   80.0,    88.0 },   /* overflows for long arrays */
+  { RED_LOGSUMEXP, -20.0,    20.0,    -20.0,   20.0 },
+  { RED_LOGSUMEXP, 700.0,    760.0,   85.0,    100.0 },  /* exp() alone overflows */
+  { RED_LOGSUMEXP, -1.0e5,   -0.99e5, -1.0e4,  -0.99e4 },  /* and underflows */
+  { RED_LOGSUMEXP, -1.0e300, 1.0e300, -1.0e30, 1.0e30 },
+  { RED_SUMLOG,    1.0,      1.0e6,   1.0,     1.0e6 },
+  { RED_SUMLOG,    1.0e-300, 1.0,     1.0e-30, 1.0 },
+  { RED_SUMLOG,    1.0e290,  1.0e300, 1.0e30,  1.0e35 },
+};
+
+/* Around the accumulators and the 256 element blocks */
+static const size_t red_lengths[] = { 1, 2, 7, 8, 9, 17, 255, 256, 257, 1000,
+                                      4097, 65537 };
+
+template <typename T>
+static double Ulp(T got, typename ReduceOps<T>::ref exptd)
+{
+  if (!std::isfinite(exptd)) {
+    bool same = std::isnan(exptd) ? (bool)std::isnan(got) : (T)exptd == got;
+    return same ? 0.0 : INFINITY;
+  }
+  return getUlp(got, exptd);
+}
+
+/*
+ * ULP error of every reduction, range and length against the reference.
+ * The sums are compensated, so the error should not grow with the length;
+ * what is left is the error of the exp and log kernels themselves.
+ */
+#define RED_ULP_THRESHOLD 4.0
+
+template <typename T>
+static void RunAccuracy(InputData *inData, int vflag, int *ntests, int *nfail,
+                        double *max_ulp)
+{
+  double max_ulp_err = inData->max_ulp_err;
+  uint64_t seed = 1;
+
+  for (const ReduceRange &r : red_ranges) {
+    for (size_t n : red_lengths) {
+      std::vector<T> x(n);
+      bool dbl = sizeof(T) == sizeof(double);
+
+      Fill(x, dbl ? r.lo : r.lof, dbl ? r.hi : r.hif, seed++);
+      T got = ReduceOps<T>::run(r.func, (int)n, x.data());
+      auto exptd = (typename ReduceOps<T>::ref)Reference(r.func, n, x.data());
+      double ulp = Ulp(got, exptd);
+
+      if (!update_ulp(ulp, max_ulp_err, RED_ULP_THRESHOLD))
+        (*nfail)++;
+      if (vflag && ulp > RED_ULP_THRESHOLD)
+        printf("%s [%g, %g] n=%zu: got %a expected %La ulp %g\n",
+               red_names[r.func], dbl ? r.lo : r.lof, dbl ? r.hi : r.hif, n,
+               (double)got, (long double)exptd, ulp);
+      (*ntests)++;
+    }
+  }
+  *max_ulp = max_ulp_err;
+}
+
+/* Result classes for the special value checks */
+enum { RES_NAN, RES_PINF, RES_NINF, RES_FINITE, RES_PZERO };
+
+static bool HasClass(double v, int cls)
+{
+  switch (cls) {
+  case RES_NAN:    return std::isnan(v);
+  case RES_PINF:   return std::isinf(v) && v > 0;
+  case RES_NINF:   return std::isinf(v) && v < 0;
+  case RES_FINITE: return std::isfinite(v);
+  case RES_PZERO:  return v == 0 && !std::signbit(v);
+  default:         return false;
+  }
+}
+
+typedef struct {
+  int func;
+  int nspecial;
+  double special[2];   /* placed into a finite array */
+  int cls;
+} ReduceSpecial;
+
+static const ReduceSpecial red_specials[] = {
+  { RED_SUMEXP,    1, { NAN },                RES_NAN },
+  { RED_SUMEXP,    1, { INFINITY },           RES_PINF },
+  { RED_SUMEXP,    1, { -INFINITY },          RES_FINITE },
+  { RED_SUMEXP,    2, { INFINITY, NAN },      RES_NAN },
+  { RED_SUMEXP,    2, { INFINITY, -INFINITY }, RES_PINF },
+  { RED_SUMEXP,    2, { 1.0e300, 1.0e300 },   RES_PINF },
+  { RED_LOGSUMEXP, 1, { NAN },                RES_NAN },
+  { RED_LOGSUMEXP, 1, { INFINITY },           RES_PINF },
+  { RED_LOGSUMEXP, 1, { -INFINITY },          RES_FINITE },
+  { RED_LOGSUMEXP, 2, { INFINITY, NAN },      RES_NAN },
+  { RED_LOGSUMEXP, 2, { -INFINITY, NAN },     RES_NAN },
+  { RED_LOGSUMEXP, 2, { INFINITY, -INFINITY }, RES_PINF },
+  { RED_LOGSUMEXP, 2, { 1.0e30, 1.0e30 },     RES_FINITE },
+  { RED_SUMLOG,    1, { NAN },                RES_NAN },
+  { RED_SUMLOG,    1, { INFINITY },           RES_PINF },
+  { RED_SUMLOG,    1, { -INFINITY },          RES_NAN },
+  { RED_SUMLOG,    1, { 0.0 },                RES_NINF },
+  { RED_SUMLOG,    1, { -0.0 },               RES_NINF },
+  { RED_SUMLOG,    1, { -1.0 },               RES_NAN },
+  { RED_SUMLOG,    1, { 0x1p-149 },           RES_FINITE },
+  { RED_SUMLOG,    2, { 0.0, INFINITY },      RES_NAN },
+  { RED_SUMLOG,    2, { 0.0, 0x1p-149 },      RES_NINF },
+  { RED_SUMLOG,    2, { INFINITY, NAN },      RES_NAN },
+};
+
+static const size_t red_special_lengths[] = { 1, 2, 9, 300, 1030 };
+
+/*
+ * Each special case placed at the start, the middle and the end of finite
+ * arrays of several lengths, then the empty and one element reductions.
+ */
+template <typename T>
+static void RunSpecials(const T *in, uint32_t count, int vflag, int *ntests,
+                        int *nfail)
+{
+  for (const ReduceSpecial &s : red_specials) {
+    for (size_t n : red_special_lengths) {
+      if (n < (size_t)s.nspecial)
+        continue;
+      for (size_t pos : { (size_t)0, n / 2, n - s.nspecial }) {
+        std::vector<T> x(n, s.func == RED_SUMLOG ? (T)2.0 : (T)0.5);
+        for (int k = 0; k < s.nspecial; k++)
+          x[(pos + k * (n / 3 + 1)) % n] = (T)s.special[k];
+        /* two specials must not land on the same element */
+        if (s.nspecial == 2 && (n / 3 + 1) % n == 0)
+          continue;
+
+        T got = ReduceOps<T>::run(s.func, (int)n, x.data());
+        int cls = s.cls;
+
+        /* A lone -Inf is the whole array */
+        if (s.special[0] == -INFINITY && s.nspecial == 1 && n == 1 &&
+            s.func != RED_SUMLOG)
+          cls = s.func == RED_SUMEXP ? RES_PZERO : RES_NINF;
+
+        if (!HasClass((double)got, cls)) {
+          (*nfail)++;
+          if (vflag)
+            printf("%s n=%zu pos=%zu special=%g,%g: got %a\n",
+                   red_names[s.func], n, pos, s.special[0], s.special[1],
+                   (double)got);
+        }
+        (*ntests)++;
+      }
+    }
+  }
+
+  /* n = 0 */
+  *nfail += !HasClass((double)ReduceOps<T>::run(RED_SUMEXP, 0, in), RES_PZERO);
+  *nfail += !HasClass((double)ReduceOps<T>::run(RED_LOGSUMEXP, 0, in), RES_NINF);
+  *nfail += !HasClass((double)ReduceOps<T>::run(RED_SUMLOG, 0, in), RES_PZERO);
+  *ntests += 3;
+
+  /*
+   * n = 1: sumexp is the array exp of the element and logsumexp the
+   * element itself. sumlog is checked by the generic tests.
+   */
+  for (uint32_t i = 0; i < count; i++) {
+    T e, x = in[i];
+    ReduceOps<T>::exp(1, &x, &e);
+    T se = ReduceOps<T>::run(RED_SUMEXP, 1, &x);
+    T lse = ReduceOps<T>::run(RED_LOGSUMEXP, 1, &x);
+    bool ok = (std::isnan(e) ? std::isnan(se) : se == e) &&
+              (std::isnan(x) ? std::isnan(lse) : lse == x);
+    if (!ok) {
+      (*nfail)++;
+      if (vflag)
+        printf("n=1 x=%a: sumexp %a exp %a logsumexp %a\n", (double)x,
+               (double)se, (double)e, (double)lse);
+    }
+    *ntests += 2;
+  }
+}
+
+#define REDUCE_REPORT(name, var)                                              \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          "Reduce", name, var, ntests, (ntests - nfail), nfail);              \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+#define REDUCE_REPORT_ULP(var)                                                \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",\
+          "Reduce", "Accuracy", var, ntests, (ntests - nfail), nfail,        \
+          max_ulp);                                                           \
+  ptr->tstcnt++
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_REDUCE) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunAccuracy<double>(inData, vflag, &ntests, &nfail, &max_ulp);
+  REDUCE_REPORT_ULP("vrda");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  RunSpecials(inpbuff, count, vflag, &ntests, &nfail);
+  REDUCE_REPORT("Specials", "vrda");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_REDUCE) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+  RunAccuracy<float>(inData, vflag, &ntests, &nfail, &max_ulp);
+  REDUCE_REPORT_ULP("vrsa");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_SPECIALS) {
+  int ntests = 0, nfail = 0;
+  RunSpecials(inpbuff, count, vflag, &ntests, &nfail);
+  REDUCE_REPORT("Specials", "vrsa");
+}
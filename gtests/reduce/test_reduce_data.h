@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __TEST_REDUCE_DATA_H__
+#define __TEST_REDUCE_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for the array reductions, run element by element
+ * through amd_vrsa_sumlogf() and amd_vrda_sumlog() with len = 1, so each
+ * result is the log of one input.
+ *
+ * The array log kernels leave zero, subnormal and +Inf inputs to the
+ * caller, which makes these the interesting single element sums.
+ */
+
+static libm_test_special_data_f32
+test_reducef_conformance_data[] = {
+    { POS_ZERO_F32,    NEG_INF_F32,     AMD_F_DIVBYZERO },  /* log(+0) = -Inf */
+    { NEG_ZERO_F32,    NEG_INF_F32,     AMD_F_DIVBYZERO },  /* log(-0) = -Inf */
+    { POS_INF_F32,     POS_INF_F32,     AMD_F_NONE      },  /* log(+Inf) = +Inf */
+    { NEG_INF_F32,     POS_QNAN_F32,    AMD_F_INVALID   },  /* log(-Inf) = QNaN */
+    { POS_QNAN_F32,    POS_QNAN_F32,    AMD_F_NONE      },  /* log(+QNaN) = +QNaN */
+    { NEG_QNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE      },  /* log(-QNaN) = -QNaN */
+    { NEG_ONE_F32,     POS_QNAN_F32,    AMD_F_INVALID   },  /* log(-1) = QNaN */
+    { POS_ONE_F32,     POS_ZERO_F32,    AMD_F_NONE      },  /* log(1) = +0 */
+    { POS_LDENORM_F32, 0xc2ce8ed0,      AMD_F_INEXACT   },  /* smallest denormal */
+    { POS_HDENORM_F32, 0xc2aeac50,      AMD_F_INEXACT   },  /* largest denormal */
+    { POS_LNORMAL_F32, 0xc2aeac50,      AMD_F_INEXACT   },  /* FLT_MIN */
+    { POS_HNORMAL_F32, 0x42b17218,      AMD_F_INEXACT   },  /* FLT_MAX */
+    { 0x40000000,      0x3f317218,      AMD_F_INEXACT   },  /* log(2) */
+};
+
+static libm_test_special_data_f64
+test_reduce_conformance_data[] = {
+    { POS_ZERO_F64,    NEG_INF_F64,     AMD_F_DIVBYZERO },  /* log(+0) = -Inf */
+    { NEG_ZERO_F64,    NEG_INF_F64,     AMD_F_DIVBYZERO },  /* log(-0) = -Inf */
+    { POS_INF_F64,     POS_INF_F64,     AMD_F_NONE      },  /* log(+Inf) = +Inf */
+    { NEG_INF_F64,     POS_QNAN_F64,    AMD_F_INVALID   },  /* log(-Inf) = QNaN */
+    { POS_QNAN_F64,    POS_QNAN_F64,    AMD_F_NONE      },  /* log(+QNaN) = +QNaN */
+    { NEG_QNAN_F64,    NEG_QNAN_F64,    AMD_F_NONE      },  /* log(-QNaN) = -QNaN */
+    { NEG_ONE_F64,     POS_QNAN_F64,    AMD_F_INVALID   },  /* log(-1) = QNaN */
+    { POS_ONE_F64,     POS_ZERO_F64,    AMD_F_NONE      },  /* log(1) = +0 */
+    { POS_LDENORM_F64, 0xc0874385446d71c3, AMD_F_INEXACT },  /* smallest denormal */
+    { POS_HDENORM_F64, 0xc086232bdd7abcd2, AMD_F_INEXACT },  /* largest denormal */
+    { 0x0010000000000000, 0xc086232bdd7abcd2, AMD_F_INEXACT },  /* DBL_MIN */
+    { POS_HNORMAL_F64, 0x40862e42fefa39ef, AMD_F_INEXACT },  /* DBL_MAX */
+    { 0x4000000000000000, 0x3fe62e42fefa39ef, AMD_F_INEXACT },  /* log(2) */
+};
+
+#endif /*__TEST_REDUCE_DATA_H__*/
@@ -0,0 +1,246 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "almact.h"
+#include "almrcp.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * rsqrt(x) = 1/sqrt(x) in the three tiers of include/libm/alm_recip.h.
+ *
+ * Every positive float goes through the default tier, which must be
+ * correctly rounded, and the fast one, which must stay within
+ * RSQRTF_FAST_ULP. The binary64 correctly rounded tier is checked exactly on
+ * random operands and on operands just below a power of four, whose
+ * 1/sqrt lies just above a midpoint; the default binary64 tier, which
+ * rounds twice, is held to RSQRT_ULP and the fast one to RSQRT_FAST_ULP.
+ * The 256-bit and 512-bit variants of the default and correctly rounded
+ * tiers must agree with the array variant bit for bit, those of the fast
+ * tiers only to within its bound.
+ */
+
+#define RSQRTF_FAST_ULP  4.0
+#define RSQRT_ULP        1.5
+#define RSQRT_FAST_ULP   1.0
+
+static const ActKernel<float> rsqrtf_kernel = {
+  "rsqrtf",
+  amd_vrs8_rsqrtf,
+#if defined(__AVX512__)
+  amd_vrs16_rsqrtf,
+#endif
+  amd_vrsa_rsqrtf,
+  alm_mp_rsqrtf,
+  0.5,
+};
+
+static const ActKernel<float> rsqrtf_fast_kernel = {
+  "rsqrt_fastf",
+  amd_vrs8_rsqrt_fastf,
+#if defined(__AVX512__)
+  amd_vrs16_rsqrt_fastf,
+#endif
+  amd_vrsa_rsqrt_fastf,
+  alm_mp_rsqrtf,
+  RSQRTF_FAST_ULP,
+};
+
+static const ActKernel<double> rsqrt_kernel = {
+  "rsqrt",
+  amd_vrd4_rsqrt,
+#if defined(__AVX512__)
+  amd_vrd8_rsqrt,
+#endif
+  amd_vrda_rsqrt,
+  alm_mp_rsqrt,
+  RSQRT_ULP,
+};
+
+static const ActKernel<double> rsqrt_fast_kernel = {
+  "rsqrt_fast",
+  amd_vrd4_rsqrt_fast,
+#if defined(__AVX512__)
+  amd_vrd8_rsqrt_fast,
+#endif
+  amd_vrda_rsqrt_fast,
+  alm_mp_rsqrt,
+  RSQRT_FAST_ULP,
+};
+
+static const ActKernel<double> rsqrt_cr_kernel = {
+  "rsqrt_cr",
+  amd_vrd4_rsqrt_cr,
+#if defined(__AVX512__)
+  amd_vrd8_rsqrt_cr,
+#endif
+  amd_vrda_rsqrt_cr,
+  alm_mp_rsqrt,
+  0.5,
+};
+
+/* The fast tiers hand lanes outside roughly [2^-120, 2^120] to the default */
+static const ActRange rsqrt_ranges[] = {
+  {     0.25,      4.0,    0.25,     4.0 },   /* one period of the mantissa */
+  {   0x1p-100,  0x1p100, 0x1p-100, 0x1p100 },  /* fast range */
+  {   0x1p-1022, 0x1p-900, 0x1p-126, 0x1p-110 }, /* small, default tier */
+  {   0x1p900,   0x1p1023, 0x1p110,  0x1p127 },  /* large, default tier */
+  {   0.0,       0x1p-1022, 0.0,     0x1p-126 }, /* subnormal */
+};
+
+#define RSQRT_NPOINTS   20000
+#define RSQRT_NRANDOM   (1 << 20)
+#define RSQRT_HARD_J    32
+
+/*
+ * x = 4^n (1 - j 2^-52) for odd j has 1/sqrt(x) = 2^-n (1 + j 2^-53 +
+ * 3/8 j^2 2^-104 + ...), just above the midpoint 2^-n (1 + j 2^-53), and
+ * x = 4^n (1 + j 2^-52) lands just above a double. n runs over the whole
+ * exponent range, so the scaled operands are covered as well.
+ */
+static std::vector<double> RsqrtHardInputs(void)
+{
+  std::vector<double> x;
+
+  for (int n = -511; n <= 511; n++) {
+    for (int j = 1; j < RSQRT_HARD_J; j += 2) {
+      x.push_back(ldexp(1.0 - ldexp((double)j, -52), 2 * n));
+      x.push_back(ldexp(1.0 + ldexp((double)j, -52), 2 * n));
+    }
+  }
+  return x;
+}
+
+#define RSQRT_REPORT(name, var)                                               \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail);            \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+#define RSQRT_REPORT_ULP(name, var)                                           \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",\
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail, max_ulp);   \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_EXHAUSTIVE) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+
+  RcpExhaustive("rsqrtf", amd_vrsa_rsqrtf, 2, true, 0.5, vflag, &ntests,
+                &nfail, &max_ulp);
+  RSQRT_REPORT("Exhaustive", "vrsa");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_FAST_EXHAUSTIVE) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+
+  RcpExhaustive("rsqrt_fastf", amd_vrsa_rsqrt_fastf, 2, false,
+                RSQRTF_FAST_ULP, vflag, &ntests, &nfail, &max_ulp);
+  RSQRT_REPORT_ULP("Exhaustive", "vrsa_fast");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_SPECIALS) {
+  int ntests = 0, nfail = 0;
+
+  ActSpecials(rsqrtf_kernel, vflag, &ntests, &nfail);
+  ActSpecials(rsqrtf_fast_kernel, vflag, &ntests, &nfail);
+  RSQRT_REPORT("Specials", "vrsa");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_VARIANTS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+
+  ActVariants(rsqrtf_kernel, rsqrt_ranges, ARRAY_SIZE(rsqrt_ranges), vflag,
+              &ntests, &nfail);
+  RcpFastVariants(rsqrtf_fast_kernel, rsqrt_ranges, ARRAY_SIZE(rsqrt_ranges),
+                  vflag, &ntests, &nfail, &max_ulp);
+  RSQRT_REPORT_ULP("Variants", "vrs8/vrs16");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_CR) {
+  int ntests = 0, nfail = 0;
+  std::vector<double> x(inpbuff, inpbuff + count);
+
+  for (double &v : x)
+    v = fabs(v);
+  for (size_t i = x.size(); i-- > 0; )
+    if (!std::isfinite(x[i]) || x[i] == 0)
+      x.erase(x.begin() + i);
+
+  RcpCheckExact("rsqrt_cr", amd_vrda_rsqrt_cr, x, 2, vflag, &ntests, &nfail);
+  RcpCheckExact("rsqrt_cr", amd_vrda_rsqrt_cr,
+                RcpRandomBits<double>(RSQRT_NRANDOM, 1), 2, vflag, &ntests,
+                &nfail);
+  RcpCheckExact("rsqrt_cr", amd_vrda_rsqrt_cr, RsqrtHardInputs(), 2, vflag,
+                &ntests, &nfail);
+  RSQRT_REPORT("CR", "vrda_cr");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_BOUND) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+
+  ActAccuracy(rsqrt_kernel, inpbuff, (int)count, rsqrt_ranges,
+              ARRAY_SIZE(rsqrt_ranges), RSQRT_NPOINTS, vflag, &ntests,
+              &nfail, &max_ulp);
+  ActAccuracy(rsqrt_fast_kernel, inpbuff, (int)count, rsqrt_ranges,
+              ARRAY_SIZE(rsqrt_ranges), RSQRT_NPOINTS, vflag, &ntests,
+              &nfail, &max_ulp);
+  RSQRT_REPORT_ULP("Bound", "vrda");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_SPECIALS) {
+  int ntests = 0, nfail = 0;
+
+  ActSpecials(rsqrt_kernel, vflag, &ntests, &nfail);
+  ActSpecials(rsqrt_fast_kernel, vflag, &ntests, &nfail);
+  ActSpecials(rsqrt_cr_kernel, vflag, &ntests, &nfail);
+  RSQRT_REPORT("Specials", "vrda");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_VARIANTS) {
+  int ntests = 0, nfail = 0;
+  double max_ulp = 0.0;
+
+  ActVariants(rsqrt_kernel, rsqrt_ranges, ARRAY_SIZE(rsqrt_ranges), vflag,
+              &ntests, &nfail);
+  ActVariants(rsqrt_cr_kernel, rsqrt_ranges, ARRAY_SIZE(rsqrt_ranges), vflag,
+              &ntests, &nfail);
+  RcpFastVariants(rsqrt_fast_kernel, rsqrt_ranges, ARRAY_SIZE(rsqrt_ranges),
+                  vflag, &ntests, &nfail, &max_ulp);
+  RSQRT_REPORT_ULP("Variants", "vrd4/vrd8");
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __TEST_RSQRT_DATA_H__
+#define __TEST_RSQRT_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for rsqrt(): zeros, infinities, NaNs, negative
+ * operands, exact powers of four, subnormals and the extremes.
+ *
+ * The default tier is the IEEE square root and divide, so the status flags
+ * are those of 1/sqrt(x): a zero divides by zero and a negative operand is
+ * invalid. The float rows are rounded once from binary64.
+ */
+
+static libm_test_special_data_f32
+test_rsqrtf_conformance_data[] = {
+    { 0x00000000, 0x7F800000, AMD_F_DIVBYZERO },  /* rsqrtf(0) = inf */
+    { 0x80000000, 0xFF800000, AMD_F_DIVBYZERO },  /* rsqrtf(-0) = -inf */
+    { 0x7F800000, 0x00000000, AMD_F_NONE },  /* rsqrtf(inf) = 0 */
+    { 0xFF800000, 0xFFC00000, AMD_F_INVALID },  /* rsqrtf(-inf) = -nan */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* rsqrtf(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* rsqrtf(-nan) = -nan */
+    { 0x3F800000, 0x3F800000, AMD_F_NONE },  /* rsqrtf(1) = 1 */
+    { 0xBF800000, 0xFFC00000, AMD_F_INVALID },  /* rsqrtf(-1) = -nan */
+    { 0x40800000, 0x3F000000, AMD_F_NONE },  /* rsqrtf(4) = 0.5 */
+    { 0x3E800000, 0x40000000, AMD_F_NONE },  /* rsqrtf(0.25) = 2 */
+    { 0x40000000, 0x3F3504F3, AMD_F_INEXACT },  /* rsqrtf(2) = 0.707106769 */
+    { 0x40400000, 0x3F13CD3A, AMD_F_INEXACT },  /* rsqrtf(3) = 0.577350259 */
+    { 0x00000001, 0x64B504F3, AMD_F_INEXACT },  /* rsqrtf(1.40129846e-45) = 2.67137384e+22 */
+    { 0x007FFFFF, 0x5F000001, AMD_F_INEXACT },  /* rsqrtf(1.17549421e-38) = 9.22337314e+18 */
+    { 0x00800000, 0x5F000000, AMD_F_NONE },  /* rsqrtf(1.17549435e-38) = 9.22337204e+18 */
+    { 0x7F7FFFFF, 0x1F800000, AMD_F_INEXACT },  /* rsqrtf(3.40282347e+38) = 5.42101086e-20 */
+    { 0xFF7FFFFF, 0xFFC00000, AMD_F_INVALID },  /* rsqrtf(-3.40282347e+38) = -nan */
+    { 0x80000001, 0xFFC00000, AMD_F_INVALID },  /* rsqrtf(-1.40129846e-45) = -nan */
+};
+
+static libm_test_special_data_f64
+test_rsqrt_conformance_data[] = {
+    { 0x0000000000000000, 0x7FF0000000000000, AMD_F_DIVBYZERO },  /* rsqrt(0) = inf */
+    { 0x8000000000000000, 0xFFF0000000000000, AMD_F_DIVBYZERO },  /* rsqrt(-0) = -inf */
+    { 0x7FF0000000000000, 0x0000000000000000, AMD_F_NONE },  /* rsqrt(inf) = 0 */
+    { 0xFFF0000000000000, 0xFFF8000000000000, AMD_F_INVALID },  /* rsqrt(-inf) = -nan */
+    { 0x7FF8000000000000, 0x7FF8000000000000, AMD_F_NONE },  /* rsqrt(nan) = nan */
+    { 0xFFF8000000000000, 0xFFF8000000000000, AMD_F_NONE },  /* rsqrt(-nan) = -nan */
+    { 0x3FF0000000000000, 0x3FF0000000000000, AMD_F_NONE },  /* rsqrt(1) = 1 */
+    { 0xBFF0000000000000, 0xFFF8000000000000, AMD_F_INVALID },  /* rsqrt(-1) = -nan */
+    { 0x4010000000000000, 0x3FE0000000000000, AMD_F_NONE },  /* rsqrt(4) = 0.5 */
+    { 0x3FD0000000000000, 0x4000000000000000, AMD_F_NONE },  /* rsqrt(0.25) = 2 */
+    { 0x4000000000000000, 0x3FE6A09E667F3BCC, AMD_F_INEXACT },  /* rsqrt(2) = 0.70710678118654746 */
+    { 0x4008000000000000, 0x3FE279A74590331D, AMD_F_INEXACT },  /* rsqrt(3) = 0.57735026918962584 */
+    { 0x0000000000000001, 0x6180000000000000, AMD_F_NONE },  /* rsqrt(4.9406564584124654e-324) = 4.4989137945431964e+161 */
+    { 0x000FFFFFFFFFFFFF, 0x5FE0000000000001, AMD_F_INEXACT },  /* rsqrt(2.2250738585072009e-308) = 6.7039039649713e+153 */
+    { 0x0010000000000000, 0x5FE0000000000000, AMD_F_NONE },  /* rsqrt(2.2250738585072014e-308) = 6.7039039649712985e+153 */
+    { 0x7FEFFFFFFFFFFFFF, 0x1FF0000000000001, AMD_F_INEXACT },  /* rsqrt(1.7976931348623157e+308) = 7.4583407312002084e-155 */
+    { 0xFFEFFFFFFFFFFFFF, 0xFFF8000000000000, AMD_F_INVALID },  /* rsqrt(-1.7976931348623157e+308) = -nan */
+    { 0x8000000000000001, 0xFFF8000000000000, AMD_F_INVALID },  /* rsqrt(-4.9406564584124654e-324) = -nan */
+};
+
+#endif /*__TEST_RSQRT_DATA_H__*/
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef __TEST_SIGMOID_DATA_H__
+#define __TEST_SIGMOID_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for sigmoid(): zeros, infinities, NaNs, subnormals,
+ * the extremes, and the tails where exp() underflows.
+ *
+ * The activation kernels keep special inputs on the vector path (see
+ * include/libm/alm_activation.h) and make no promise about the status
+ * flags, so none are expected.
+ */
+
+static libm_test_special_data_f32
+test_sigmoidf_conformance_data[] = {
+    { 0x00000000, 0x3F000000, AMD_F_NONE },  /* +0: sigmoid(0) = 0.5 */
+    { 0x80000000, 0x3F000000, AMD_F_NONE },  /* -0: sigmoid(-0) = 0.5 */
+    { 0x7F800000, 0x3F800000, AMD_F_NONE },  /* +Inf: sigmoid(inf) = 1 */
+    { 0xFF800000, 0x00000000, AMD_F_NONE },  /* -Inf: sigmoid(-inf) = 0 */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: sigmoid(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: sigmoid(-nan) = -nan */
+    { 0x00000001, 0x3F000000, AMD_F_NONE },  /* min subnormal: sigmoid(1.40129846e-45) = 0.5 */
+    { 0x80000001, 0x3F000000, AMD_F_NONE },  /* -min subnormal: sigmoid(-1.40129846e-45) = 0.5 */
+    { 0x00800000, 0x3F000000, AMD_F_NONE },  /* min normal: sigmoid(1.17549435e-38) = 0.5 */
+    { 0x80800000, 0x3F000000, AMD_F_NONE },  /* -min normal: sigmoid(-1.17549435e-38) = 0.5 */
+    { 0x3F800000, 0x3F3B26A8, AMD_F_NONE },  /* 1: sigmoid(1) = 0.731058598 */
+    { 0xBF800000, 0x3E89B2B1, AMD_F_NONE },  /* -1: sigmoid(-1) = 0.268941432 */
+    { 0x3F000000, 0x3F1F597F, AMD_F_NONE },  /* 0.5: sigmoid(0.5) = 0.622459352 */
+    { 0xBF000000, 0x3EC14D03, AMD_F_NONE },  /* -0.5: sigmoid(-0.5) = 0.377540678 */
+    { 0x41200000, 0x3F7FFD06, AMD_F_NONE },  /* 10: sigmoid(10) = 0.999954581 */
+    { 0xC1200000, 0x383E6997, AMD_F_NONE },  /* -10: sigmoid(-10) = 4.53978682e-05 */
+    { 0x41A00000, 0x3F800000, AMD_F_NONE },  /* 20: sigmoid(20) = 1 */
+    { 0xC1A00000, 0x310DA433, AMD_F_NONE },  /* -20: sigmoid(-20) = 2.06115369e-09 */
+    { 0xC2B40000, 0x0008EC28, AMD_F_NONE },  /* exp underflow: sigmoid(-90) = 8.19400869e-40 */
+    { 0xC2C80000, 0x0000001B, AMD_F_NONE },  /* subnormal result: sigmoid(-100) = 3.78350585e-44 */
+    { 0xC2DC0000, 0x00000000, AMD_F_NONE },  /* -110: sigmoid(-110) = 0 */
+    { 0x7F7FFFFF, 0x3F800000, AMD_F_NONE },  /* max: sigmoid(3.40282347e+38) = 1 */
+    { 0xFF7FFFFF, 0x00000000, AMD_F_NONE },  /* -max: sigmoid(-3.40282347e+38) = 0 */
+};
+
+static libm_test_special_data_f64
+test_sigmoid_conformance_data[] = {
+    { 0x0000000000000000, 0x3FE0000000000000, AMD_F_NONE },  /* +0: sigmoid(0) = 0.5 */
+    { 0x8000000000000000, 0x3FE0000000000000, AMD_F_NONE },  /* -0: sigmoid(-0) = 0.5 */
+    { 0x7FF0000000000000, 0x3FF0000000000000, AMD_F_NONE },  /* +Inf: sigmoid(inf) = 1 */
+    { 0xFFF0000000000000, 0x0000000000000000, AMD_F_NONE },  /* -Inf: sigmoid(-inf) = 0 */
+    { 0x7FF8000000000000, 0x7FF8000000000000, AMD_F_NONE },  /* +QNaN: sigmoid(nan) = nan */
+    { 0xFFF8000000000000, 0xFFF8000000000000, AMD_F_NONE },  /* -QNaN: sigmoid(-nan) = -nan */
+    { 0x0000000000000001, 0x3FE0000000000000, AMD_F_NONE },  /* min subnormal: sigmoid(4.9406564584124654e-324) = 0.5 */
+    { 0x8000000000000001, 0x3FE0000000000000, AMD_F_NONE },  /* -min subnormal: sigmoid(-4.9406564584124654e-324) = 0.5 */
+    { 0x0010000000000000, 0x3FE0000000000000, AMD_F_NONE },  /* min normal: sigmoid(2.2250738585072014e-308) = 0.5 */
+    { 0x8010000000000000, 0x3FE0000000000000, AMD_F_NONE },  /* -min normal: sigmoid(-2.2250738585072014e-308) = 0.5 */
+    { 0x3FF0000000000000, 0x3FE764D4F5D5A2BD, AMD_F_NONE },  /* 1: sigmoid(1) = 0.7310585786300049 */
+    { 0xBFF0000000000000, 0x3FD136561454BA86, AMD_F_NONE },  /* -1: sigmoid(-1) = 0.2689414213699951 */
+    { 0x3FE0000000000000, 0x3FE3EB2FD4D34391, AMD_F_NONE },  /* 0.5: sigmoid(0.5) = 0.62245933120185459 */
+    { 0xBFE0000000000000, 0x3FD829A0565978DF, AMD_F_NONE },  /* -0.5: sigmoid(-0.5) = 0.37754066879814546 */
+    { 0x4024000000000000, 0x3FEFFFA0CB346F89, AMD_F_NONE },  /* 10: sigmoid(10) = 0.99995460213129761 */
+    { 0xC024000000000000, 0x3F07CD32E41DD960, AMD_F_NONE },  /* -10: sigmoid(-10) = 4.5397868702434395e-05 */
+    { 0x4044000000000000, 0x3FF0000000000000, AMD_F_NONE },  /* 40: sigmoid(40) = 1 */
+    { 0xC044000000000000, 0x3C539792499B1A24, AMD_F_NONE },  /* -40: sigmoid(-40) = 4.2483542552915889e-18 */
+    { 0xC086300000000000, 0x00033802FD28B3C3, AMD_F_NONE },  /* exp underflow: sigmoid(-710) = 4.4762862256751298e-309 */
+    { 0xC086800000000000, 0x0000000993B4DC95, AMD_F_NONE },  /* subnormal result: sigmoid(-720) = 2.0322308024183599e-313 */
+    { 0xC087C00000000000, 0x0000000000000000, AMD_F_NONE },  /* -760: sigmoid(-760) = 0 */
+    { 0x7FEFFFFFFFFFFFFF, 0x3FF0000000000000, AMD_F_NONE },  /* max: sigmoid(1.7976931348623157e+308) = 1 */
+    { 0xFFEFFFFFFFFFFFFF, 0x0000000000000000, AMD_F_NONE },  /* -max: sigmoid(-1.7976931348623157e+308) = 0 */
+};
+
+#endif /*__TEST_SIGMOID_DATA_H__*/
@@ -0,0 +1,104 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "almhalf.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+#include "../libs/mparith/alm_mp_funcs.h"
+
+/*
+ * sigmoidbf16 over all 65536 BF16 inputs: the error against the correctly
+ * rounded reference must stay within the bound quoted in
+ * src/optimized/half/sigmoidbf16.c, for the dispatched variant and for the
+ * AVX2 fallback used without AVX512_BF16, and the AVX2 and Zen4 variants
+ * must agree with the dispatched one bit for bit.
+ */
+
+#define SIGMOIDBF16_ULP_BOUND 0.500
+
+extern "C" {
+void amd_vrba_sigmoidbf16_avx2(int len, const uint16_t *src, uint16_t *dst);
+#if defined(__AVX512__)
+void amd_vrba_sigmoidbf16_zn4(int len, const uint16_t *src, uint16_t *dst);
+#endif
+}
+
+static const BF16Kernel sigmoidbf16_kernel = {
+  "sigmoidbf16",
+  amd_vrba_sigmoidbf16,
+  amd_vrba_sigmoidbf16_avx2,
+#if defined(__AVX512__)
+  amd_vrba_sigmoidbf16_zn4,
+#else
+  NULL,
+#endif
+  alm_mp_sigmoidf,
+};
+
+#define BF16_REPORT(name, var)                                                \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail);            \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+#define BF16_REPORT_ULP(name, var)                                            \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",\
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail, max_ulp);   \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_EXHAUSTIVE) {
+  int ntests = HALF_NUM_VALUES, nfail;
+  double max_ulp;
+
+  nfail = BF16Exhaustive(&sigmoidbf16_kernel, sigmoidbf16_kernel.array,
+                         SIGMOIDBF16_ULP_BOUND, &max_ulp, vflag);
+  BF16_REPORT_ULP("Exhaustive", "vrba");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_FALLBACK) {
+  int ntests = HALF_NUM_VALUES, nfail;
+  double max_ulp;
+
+  nfail = BF16Exhaustive(&sigmoidbf16_kernel, sigmoidbf16_kernel.avx2,
+                         SIGMOIDBF16_ULP_BOUND, &max_ulp, vflag);
+  BF16_REPORT_ULP("Fallback", "vrba_avx2");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_VARIANTS) {
+  int ntests = 0, nfail;
+
+  nfail = BF16Variants(&sigmoidbf16_kernel, &ntests, vflag);
+  BF16_REPORT("Variants", "vrba");
+}
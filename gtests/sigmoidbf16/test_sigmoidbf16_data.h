@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_SIGMOIDBF16_DATA_H__
+#define __TEST_SIGMOIDBF16_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for vrba_sigmoidbf16(), as the float values of BF16
+ * inputs and correctly rounded BF16 results, subnormal results flushed to
+ * zero: zeros, infinities, NaNs, subnormals, the largest finite value, and
+ * the saturation and flush-to-zero thresholds.
+ *
+ * The BF16 kernels make no promise about the status flags, so none are
+ * expected.
+ */
+
+static libm_test_special_data_f32
+test_sigmoidbf16_conformance_data[] = {
+    { 0x00000000, 0x3F000000, AMD_F_NONE },  /* +0: sigmoid(0) = 0.5 */
+    { 0x80000000, 0x3F000000, AMD_F_NONE },  /* -0: sigmoid(-0) = 0.5 */
+    { 0x7F800000, 0x3F800000, AMD_F_NONE },  /* +Inf: sigmoid(inf) = 1 */
+    { 0xFF800000, 0x00000000, AMD_F_NONE },  /* -Inf: sigmoid(-inf) = 0 */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: sigmoid(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: sigmoid(-nan) = -nan */
+    { 0x00010000, 0x3F000000, AMD_F_NONE },  /* min subnormal: sigmoid(9.18355e-41) = 0.5 */
+    { 0x007F0000, 0x3F000000, AMD_F_NONE },  /* max subnormal: sigmoid(1.16631e-38) = 0.5 */
+    { 0x00800000, 0x3F000000, AMD_F_NONE },  /* min normal: sigmoid(1.17549e-38) = 0.5 */
+    { 0x3F800000, 0x3F3B0000, AMD_F_NONE },  /* 1: sigmoid(1) = 0.730469 */
+    { 0xBF800000, 0x3E8A0000, AMD_F_NONE },  /* -1: sigmoid(-1) = 0.269531 */
+    { 0x7F7F0000, 0x3F800000, AMD_F_NONE },  /* max: sigmoid(3.38953e+38) = 1 */
+    { 0xFF7F0000, 0x00000000, AMD_F_NONE },  /* -max: sigmoid(-3.38953e+38) = 0 */
+    { 0x3F000000, 0x3F1F0000, AMD_F_NONE },  /* 0.5: sigmoid(0.5) = 0.621094 */
+    { 0x41200000, 0x3F800000, AMD_F_NONE },  /* 10: sigmoid(10) = 1 */
+    { 0x41A00000, 0x3F800000, AMD_F_NONE },  /* saturated: sigmoid(20) = 1 */
+    { 0xC1200000, 0x383E0000, AMD_F_NONE },  /* -10: sigmoid(-10) = 4.52995e-05 */
+    { 0xC2AE0000, 0x00B30000, AMD_F_NONE },  /* min normal result: sigmoid(-87) = 1.64386e-38 */
+    { 0xC2B00000, 0x00000000, AMD_F_NONE },  /* flushed: sigmoid(-88) = 0 */
+};
+
+#endif /*__TEST_SIGMOIDBF16_DATA_H__*/
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef __TEST_SILU_DATA_H__
+#define __TEST_SILU_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for silu(): zeros, infinities, NaNs, subnormals,
+ * the extremes, and the tails where exp() underflows.
+ *
+ * The activation kernels keep special inputs on the vector path (see
+ * include/libm/alm_activation.h) and make no promise about the status
+ * flags, so none are expected.
+ */
+
+static libm_test_special_data_f32
+test_siluf_conformance_data[] = {
+    { 0x00000000, 0x00000000, AMD_F_NONE },  /* +0: silu(0) = 0 */
+    { 0x80000000, 0x80000000, AMD_F_NONE },  /* -0: silu(-0) = -0 */
+    { 0x7F800000, 0x7F800000, AMD_F_NONE },  /* +Inf: silu(inf) = inf */
+    { 0xFF800000, 0x80000000, AMD_F_NONE },  /* -Inf: silu(-inf) = -0 */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: silu(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: silu(-nan) = -nan */
+    { 0x00000001, 0x00000000, AMD_F_NONE },  /* min subnormal: silu(1.40129846e-45) = 0 */
+    { 0x80000001, 0x80000000, AMD_F_NONE },  /* -min subnormal: silu(-1.40129846e-45) = -0 */
+    { 0x00800000, 0x00400000, AMD_F_NONE },  /* min normal: silu(1.17549435e-38) = 5.87747175e-39 */
+    { 0x80800000, 0x80400000, AMD_F_NONE },  /* -min normal: silu(-1.17549435e-38) = -5.87747175e-39 */
+    { 0x3F800000, 0x3F3B26A8, AMD_F_NONE },  /* 1: silu(1) = 0.731058598 */
+    { 0xBF800000, 0xBE89B2B1, AMD_F_NONE },  /* -1: silu(-1) = -0.268941432 */
+    { 0x3F000000, 0x3E9F597F, AMD_F_NONE },  /* 0.5: silu(0.5) = 0.311229676 */
+    { 0xBF000000, 0xBE414D03, AMD_F_NONE },  /* -0.5: silu(-0.5) = -0.188770339 */
+    { 0x41200000, 0x411FFE24, AMD_F_NONE },  /* 10: silu(10) = 9.99954605 */
+    { 0xC1200000, 0xB9EE03FD, AMD_F_NONE },  /* -10: silu(-10) = -0.00045397869 */
+    { 0x41A00000, 0x41A00000, AMD_F_NONE },  /* 20: silu(20) = 20 */
+    { 0xC1A00000, 0xB3310D3F, AMD_F_NONE },  /* -20: silu(-20) = -4.12230712e-08 */
+    { 0xC2B40000, 0x81C8C18A, AMD_F_NONE },  /* exp underflow: silu(-90) = -7.37461119e-38 */
+    { 0xC2C80000, 0x80000A5F, AMD_F_NONE },  /* subnormal result: silu(-100) = -3.72044742e-42 */
+    { 0xC2DC0000, 0x80000000, AMD_F_NONE },  /* -110: silu(-110) = -0 */
+    { 0x7F7FFFFF, 0x7F7FFFFF, AMD_F_NONE },  /* max: silu(3.40282347e+38) = 3.40282347e+38 */
+    { 0xFF7FFFFF, 0x80000000, AMD_F_NONE },  /* -max: silu(-3.40282347e+38) = -0 */
+};
+
+static libm_test_special_data_f64
+test_silu_conformance_data[] = {
+    { 0x0000000000000000, 0x0000000000000000, AMD_F_NONE },  /* +0: silu(0) = 0 */
+    { 0x8000000000000000, 0x8000000000000000, AMD_F_NONE },  /* -0: silu(-0) = -0 */
+    { 0x7FF0000000000000, 0x7FF0000000000000, AMD_F_NONE },  /* +Inf: silu(inf) = inf */
+    { 0xFFF0000000000000, 0x8000000000000000, AMD_F_NONE },  /* -Inf: silu(-inf) = -0 */
+    { 0x7FF8000000000000, 0x7FF8000000000000, AMD_F_NONE },  /* +QNaN: silu(nan) = nan */
+    { 0xFFF8000000000000, 0xFFF8000000000000, AMD_F_NONE },  /* -QNaN: silu(-nan) = -nan */
+    { 0x0000000000000001, 0x0000000000000000, AMD_F_NONE },  /* min subnormal: silu(4.9406564584124654e-324) = 0 */
+    { 0x8000000000000001, 0x8000000000000000, AMD_F_NONE },  /* -min subnormal: silu(-4.9406564584124654e-324) = -0 */
+    { 0x0010000000000000, 0x0008000000000000, AMD_F_NONE },  /* min normal: silu(2.2250738585072014e-308) = 1.1125369292536007e-308 */
+    { 0x8010000000000000, 0x8008000000000000, AMD_F_NONE },  /* -min normal: silu(-2.2250738585072014e-308) = -1.1125369292536007e-308 */
+    { 0x3FF0000000000000, 0x3FE764D4F5D5A2BD, AMD_F_NONE },  /* 1: silu(1) = 0.7310585786300049 */
+    { 0xBFF0000000000000, 0xBFD136561454BA86, AMD_F_NONE },  /* -1: silu(-1) = -0.2689414213699951 */
+    { 0x3FE0000000000000, 0x3FD3EB2FD4D34391, AMD_F_NONE },  /* 0.5: silu(0.5) = 0.3112296656009273 */
+    { 0xBFE0000000000000, 0xBFC829A0565978DF, AMD_F_NONE },  /* -0.5: silu(-0.5) = -0.18877033439907273 */
+    { 0x4024000000000000, 0x4023FFC47F00C5B5, AMD_F_NONE },  /* 10: silu(10) = 9.999546021312975 */
+    { 0xC024000000000000, 0xBF3DC07F9D254FB8, AMD_F_NONE },  /* -10: silu(-10) = -0.00045397868702434395 */
+    { 0x4044000000000000, 0x4044000000000000, AMD_F_NONE },  /* 40: silu(40) = 40 */
+    { 0xC044000000000000, 0xBCA87D76DC01E0AD, AMD_F_NONE },  /* -40: silu(-40) = -1.6993417021166355e-16 */
+    { 0xC086300000000000, 0x8081DAB0943DC51E, AMD_F_NONE },  /* exp underflow: silu(-710) = -3.1781632202293424e-306 */
+    { 0xC086800000000000, 0x80001AEF6CAC6366, AMD_F_NONE },  /* subnormal result: silu(-720) = -1.4632061777454681e-310 */
+    { 0xC087C00000000000, 0x8000000000000000, AMD_F_NONE },  /* -760: silu(-760) = -0 */
+    { 0x7FEFFFFFFFFFFFFF, 0x7FEFFFFFFFFFFFFF, AMD_F_NONE },  /* max: silu(1.7976931348623157e+308) = 1.7976931348623157e+308 */
+    { 0xFFEFFFFFFFFFFFFF, 0x8000000000000000, AMD_F_NONE },  /* -max: silu(-1.7976931348623157e+308) = -0 */
+};
+
+#endif /*__TEST_SILU_DATA_H__*/
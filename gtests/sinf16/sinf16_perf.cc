@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include <string>
+#include <cstring>
+#include <vector>
+#include <chrono>
+#include "benchmark.h"
+#include "almtestperf.h"
+#include "almhalf.h"
+#include "callback.h"
+
+using namespace std;
+using namespace ALM;
+
+/*
+ * The generic benchmarks would time the float <-> FP16 conversions of the
+ * callbacks as well, so the inputs are converted once and the FP16
+ * variants are timed directly.
+ */
+enum { HALF_S1, HALF_V8, HALF_V16, HALF_VA };
+
+static void LibmPerfTestHalf(benchmark::State& st, InputParams* param,
+                             int which) {
+  AoclLibmTest<float> objtest(param, GetnIpArgs());
+  int n = (int)param->count;
+  vector<uint16_t> in(n), out(n);
+  double szn = param->niter * param->count;
+
+  for (int i = 0; i < n; i++)
+    in[i] = FloatToHalf(objtest.inpbuff[i]);
+
+  for (auto _ : st) {
+    switch (which) {
+    case HALF_S1:
+      for (int i = 0; i < n; i++)
+        out[i] = amd_sinf16(in[i]);
+      break;
+    case HALF_V8:
+      for (int i = 0; i + 8 <= n; i += 8)
+        _mm_storeu_si128((__m128i *)&out[i],
+          amd_vrh8_sinf16(_mm_loadu_si128((const __m128i *)&in[i])));
+      break;
+    case HALF_V16:
+      for (int i = 0; i + 16 <= n; i += 16)
+        _mm256_storeu_si256((__m256i *)&out[i],
+          amd_vrh16_sinf16(_mm256_loadu_si256((const __m256i *)&in[i])));
+      break;
+    default:
+      amd_vrha_sinf16(n, in.data(), out.data());
+      break;
+    }
+    benchmark::DoNotOptimize(out.data());
+  }
+
+  namespace bm = benchmark;
+  st.counters["MOPS"] = bm::Counter{szn, bm::Counter::kIsRate};
+}
+
+int AlmTestPerfFramework::AlmTestPerformance(InputParams *params) {
+  static const struct {
+    const char *name;
+    ALM::FloatQuantity fqty;
+    int which;
+  } variants[] = {
+    { "_s1h(sinf16)",   ALM::FloatQuantity::E_Scalar,       HALF_S1  },
+    { "_v8h(sinf16)",   ALM::FloatQuantity::E_Vector_8,     HALF_V8  },
+    { "_v16h(sinf16)",  ALM::FloatQuantity::E_Vector_16,    HALF_V16 },
+    { "_vah(sinf16)",   ALM::FloatQuantity::E_Vector_Array, HALF_VA  },
+  };
+  string funcnam = "AoclLibm";
+  string libm;
+
+  if((params->fwidth != ALM::FloatWidth::E_ALL) &&
+     (params->fwidth != ALM::FloatWidth::E_F32)) {
+    cout << "FP16 sin is tested through the float width (-i f)" << endl;
+    return 0;
+  }
+
+  for (auto &v : variants) {
+    if((params->fqty == ALM::FloatQuantity::E_All) ||
+     (params->fqty == v.fqty)) {
+      libm = funcnam + v.name;
+      benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestHalf, params,
+                                   v.which)
+                 ->Args({(int)params->count})->Iterations(params->niter);
+    }
+  }
+
+  size_t retval = benchmark::RunSpecifiedBenchmarks();
+
+  return (int)retval;
+}
+
+
+AlmTestPerfFramework::~AlmTestPerfFramework() {
+#if defined(DEBUG_PRINTS)
+  cout << "AlmTestPerfFramework destructor completed" << endl;
+#endif
+}
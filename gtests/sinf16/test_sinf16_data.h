@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_SINF16_DATA_H__
+#define __TEST_SINF16_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for sinf16(), as the float values of FP16 inputs
+ * and correctly rounded FP16 results: zeros, infinities, NaNs, subnormals,
+ * the largest finite value, and inputs near multiples of pi/2 and large arguments.
+ *
+ * The FP16 kernels keep special inputs on the vector path (see
+ * include/libm/alm_half.h) and make no promise about the status flags, so
+ * none are expected.
+ */
+
+static libm_test_special_data_f32
+test_sinf16_conformance_data[] = {
+    { 0x00000000, 0x00000000, AMD_F_NONE },  /* +0: sin(0) = 0 */
+    { 0x80000000, 0x80000000, AMD_F_NONE },  /* -0: sin(-0) = -0 */
+    { 0x7F800000, 0x7FC00000, AMD_F_NONE },  /* +Inf: sin(inf) = nan */
+    { 0xFF800000, 0x7FC00000, AMD_F_NONE },  /* -Inf: sin(-inf) = nan */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: sin(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: sin(-nan) = -nan */
+    { 0x33800000, 0x33800000, AMD_F_NONE },  /* min subnormal: sin(5.96046448e-08) = 5.96046448e-08 */
+    { 0xB3800000, 0xB3800000, AMD_F_NONE },  /* -min subnormal: sin(-5.96046448e-08) = -5.96046448e-08 */
+    { 0x387FC000, 0x387FC000, AMD_F_NONE },  /* max subnormal: sin(6.09755516e-05) = 6.09755516e-05 */
+    { 0x38800000, 0x38800000, AMD_F_NONE },  /* min normal: sin(6.10351562e-05) = 6.10351562e-05 */
+    { 0x3F800000, 0x3F576000, AMD_F_NONE },  /* 1: sin(1) = 0.841308594 */
+    { 0xBF800000, 0xBF576000, AMD_F_NONE },  /* -1: sin(-1) = -0.841308594 */
+    { 0x477FE000, 0x3F79C000, AMD_F_NONE },  /* max: sin(65504) = 0.975585938 */
+    { 0xC77FE000, 0xBF79C000, AMD_F_NONE },  /* -max: sin(-65504) = -0.975585938 */
+    { 0x40490000, 0x3A7DA000, AMD_F_NONE },  /* pi: sin(3.140625) = 0.000967502594 */
+    { 0x3FC90000, 0x3F800000, AMD_F_NONE },  /* pi/2: sin(1.5703125) = 1 */
+    { 0x3A000000, 0x3A000000, AMD_F_NONE },  /* small: sin(0.00048828125) = 0.00048828125 */
+    { 0x447A0000, 0x3F53A000, AMD_F_NONE },  /* 1000: sin(1000) = 0.826660156 */
+    { 0x47000000, 0x3F6D8000, AMD_F_NONE },  /* 32768: sin(32768) = 0.927734375 */
+    { 0x40000000, 0x3F68C000, AMD_F_NONE },  /* 2: sin(2) = 0.909179688 */
+};
+
+#endif /*__TEST_SINF16_DATA_H__*/
@@ -0,0 +1,413 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+
+/*
+ * softmax and log_softmax rows against a compensated long double reference,
+ * the propagation of NaN and Inf, and the batch variants against row by
+ * row calls.
+ *
+ * The rows are generated here rather than taken from the fixture: the
+ * interesting ones are long, span the exp() underflow range, or sit at
+ * magnitudes where exp(x) alone overflows and only x - max(x) is usable.
+ */
+
+enum { SM_SOFTMAX, SM_LOG_SOFTMAX, SM_NFUNCS };
+
+static const char *sm_names[SM_NFUNCS] = { "softmax", "log_softmax" };
+
+template <typename T> struct SoftmaxOps;
+
+template <> struct SoftmaxOps<double> {
+  typedef long double ref;
+  static constexpr double bound[SM_NFUNCS] = { 5.0, 2.0 };
+  static void run(int f, int n, const double *x, double *y) {
+    if (f == SM_SOFTMAX)
+      amd_vrda_softmax(n, x, y);
+    else
+      amd_vrda_log_softmax(n, x, y);
+  }
+  static void batch(int f, int rows, int cols, const double *x, int xs,
+                    double *y, int ys) {
+    if (f == SM_SOFTMAX)
+      amd_vrda_softmax_batch(rows, cols, x, xs, y, ys);
+    else
+      amd_vrda_log_softmax_batch(rows, cols, x, xs, y, ys);
+  }
+};
+
+template <> struct SoftmaxOps<float> {
+  typedef double ref;
+  static constexpr double bound[SM_NFUNCS] = { 4.0, 1.5 };
+  static void run(int f, int n, const float *x, float *y) {
+    if (f == SM_SOFTMAX)
+      amd_vrsa_softmaxf(n, x, y);
+    else
+      amd_vrsa_log_softmaxf(n, x, y);
+  }
+  static void batch(int f, int rows, int cols, const float *x, int xs,
+                    float *y, int ys) {
+    if (f == SM_SOFTMAX)
+      amd_vrsa_softmax_batchf(rows, cols, x, xs, y, ys);
+    else
+      amd_vrsa_log_softmax_batchf(rows, cols, x, xs, y, ys);
+  }
+};
+
+constexpr double SoftmaxOps<double>::bound[SM_NFUNCS];
+constexpr double SoftmaxOps<float>::bound[SM_NFUNCS];
+
+/* Kahan-Babuska sum in long double */
+static long double RefSum(const std::vector<long double> &v)
+{
+  long double s = 0.0L, c = 0.0L;
+
+  for (long double x : v) {
+    long double t = s + x;
+    if (fabsl(s) >= fabsl(x))
+      c += (s - t) + x;
+    else
+      c += (x - t) + s;
+    s = t;
+  }
+  return s + c;
+}
+
+/* A row holding NaN or +Inf, or only -Inf, gives NaN throughout */
+template <typename T>
+static void Reference(int f, size_t n, const T *x, std::vector<long double> &r)
+{
+  std::vector<long double> e(n);
+  long double m = -INFINITY;
+  bool nan = false;
+
+  for (size_t i = 0; i < n; i++) {
+    nan |= std::isnan(x[i]);
+    m = fmaxl(m, x[i]);
+  }
+  r.assign(n, (long double)NAN);
+  if (nan || std::isinf(m))
+    return;
+
+  for (size_t i = 0; i < n; i++)
+    e[i] = expl((long double)x[i] - m);
+  long double s = RefSum(e);
+  for (size_t i = 0; i < n; i++)
+    r[i] = f == SM_SOFTMAX ? e[i] / s : ((long double)x[i] - m) - logl(s);
+}
+
+/*
+ * softmax in ULPs of the result; log_softmax in ULPs of max(|result|, 1),
+ * as quoted in the sources. Results that round to zero or Inf must be
+ * exact, and NaN must give NaN.
+ */
+template <typename T>
+static double Ulp(int f, T got, long double exptd)
+{
+  T e = (T)exptd;
+
+  if (std::isnan(exptd))
+    return std::isnan(got) ? 0.0 : INFINITY;
+  if (!std::isfinite(e) || (f == SM_SOFTMAX && e == 0))
+    return e == got ? 0.0 : INFINITY;
+  if (!std::isfinite(got))
+    return INFINITY;
+  if (f == SM_SOFTMAX)
+    return getUlp(got, (typename SoftmaxOps<T>::ref)exptd);
+
+  long double a = fmaxl(fabsl(exptd), 1.0L);
+  long double ulp = ldexpl(std::numeric_limits<T>::epsilon(), ilogbl(a));
+  return (double)(fabsl((long double)got - exptd) / ulp);
+}
+
+/* Deterministic uniform values in [lo, hi] */
+template <typename T>
+static void Fill(std::vector<T> &x, double lo, double hi, uint64_t seed)
+{
+  for (size_t i = 0; i < x.size(); i++) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    x[i] = (T)(lo + (hi - lo) * ((double)(seed >> 11) * 0x1p-53));
+  }
+}
+
+typedef struct {
+  double lo, hi;       /* double range */
+  double lof, hif;     /* float range */
+} SoftmaxRange;
+
+static const SoftmaxRange sm_ranges[] = {
+  { -20.0,    20.0,          -20.0,    20.0 },
+  { -800.0,   800.0,         -110.0,   110.0 },     /* outputs underflow */
+  { 700.0,    760.0,         80.0,     100.0 },     /* exp() alone overflows */
+  { -1.0e5,   -0.99e5,       -1.0e4,   -0.99e4 },   /* and underflows */
+  { 1.0e9,    1.0e9 + 40.0,  3.0e5,    3.0e5 + 40.0 },
+  { -1.0e300, 1.0e300,       -1.0e30,  1.0e30 },
+  { -1.0e-6,  1.0e-6,        -1.0e-6,  1.0e-6 },    /* near uniform */
+};
+
+/* Around the vector widths, the register blocks, and long rows */
+static const size_t sm_lengths[] = { 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 32, 33,
+                                     63, 64, 65, 100, 255, 256, 257, 1000,
+                                     4097, 65537 };
+
+/* Every element of one row, counting the row as failed if any is */
+template <typename T>
+static double CheckRow(int f, const std::vector<T> &x, int vflag, int *nfail,
+                       const char *what)
+{
+  size_t n = x.size();
+  std::vector<T> y(n);
+  std::vector<long double> r;
+  double bound = SoftmaxOps<T>::bound[f], max_ulp = 0.0;
+  bool bad = false;
+
+  SoftmaxOps<T>::run(f, (int)n, x.data(), y.data());
+  Reference(f, n, x.data(), r);
+  for (size_t i = 0; i < n; i++) {
+    double ulp = Ulp(f, y[i], r[i]);
+
+    if (ulp > max_ulp)
+      max_ulp = ulp;
+    if (ulp > bound && !bad) {
+      bad = true;
+      if (vflag)
+        printf("%s %s n=%zu: [%zu] x=%a got %a expected %La ulp %g\n",
+               sm_names[f], what, n, i, (double)x[i], (double)y[i], r[i], ulp);
+    }
+  }
+  *nfail += bad;
+  return max_ulp;
+}
+
+template <typename T>
+static void RunAccuracy(int f, int vflag, int *ntests, int *nfail,
+                        double *max_ulp)
+{
+  bool dbl = sizeof(T) == sizeof(double);
+  uint64_t seed = 1;
+
+  for (const SoftmaxRange &r : sm_ranges) {
+    for (size_t n : sm_lengths) {
+      std::vector<T> x(n);
+      char what[64];
+
+      Fill(x, dbl ? r.lo : r.lof, dbl ? r.hi : r.hif, seed++);
+      snprintf(what, sizeof(what), "[%g, %g]", dbl ? r.lo : r.lof,
+               dbl ? r.hi : r.hif);
+      *max_ulp = fmax(*max_ulp, CheckRow(f, x, vflag, nfail, what));
+      (*ntests)++;
+    }
+  }
+}
+
+typedef struct {
+  int nspecial;
+  double special[2];   /* placed into a finite row */
+} SoftmaxSpecial;
+
+static const SoftmaxSpecial sm_specials[] = {
+  { 1, { NAN } },
+  { 1, { INFINITY } },
+  { 1, { -INFINITY } },
+  { 2, { INFINITY, -INFINITY } },
+  { 2, { -INFINITY, NAN } },
+  { 2, { -INFINITY, -INFINITY } },
+  { 2, { DBL_MAX, -DBL_MAX } },        /* x - max(x) overflows */
+  { 2, { DBL_MAX, DBL_MAX } },
+  { 1, { -DBL_MAX } },
+  { 1, { 0x1p-1074 } },
+};
+
+static const size_t sm_special_lengths[] = { 1, 2, 9, 17, 300, 1030 };
+
+/*
+ * Each special case at the start, the middle and the end of rows of zeros
+ * and of large values, then rows that are all -Inf, constant rows, and the
+ * empty row, which must leave dst alone.
+ */
+template <typename T>
+static void RunSpecials(int f, int vflag, int *ntests, int *nfail)
+{
+  const T big = (T)(sizeof(T) == sizeof(double) ? 1.0e300 : 1.0e30);
+  const T lim = std::numeric_limits<T>::max();
+
+  for (const SoftmaxSpecial &s : sm_specials) {
+    for (size_t n : sm_special_lengths) {
+      if (n < (size_t)s.nspecial || (s.nspecial == 2 && (n / 3 + 1) % n == 0))
+        continue;
+      for (T fill : { (T)0.0, big }) {
+        for (size_t pos : { (size_t)0, n / 2, n - s.nspecial }) {
+          std::vector<T> x(n, fill);
+
+          for (int k = 0; k < s.nspecial; k++) {
+            double v = s.special[k];
+            x[(pos + k * (n / 3 + 1)) % n] = fabs(v) == DBL_MAX ?
+                                             (T)copysign(lim, v) : (T)v;
+          }
+          CheckRow(f, x, vflag, nfail, "special");
+          (*ntests)++;
+        }
+      }
+    }
+  }
+
+  for (size_t n : sm_special_lengths) {
+    for (T v : { -std::numeric_limits<T>::infinity(), (T)0.0, big, -big, lim,
+                 -lim }) {
+      CheckRow(f, std::vector<T>(n, v), vflag, nfail, "constant");
+      (*ntests)++;
+    }
+  }
+
+  T x = 1.0, y = (T)-7.0;
+  SoftmaxOps<T>::run(f, 0, &x, &y);
+  SoftmaxOps<T>::run(f, -1, &x, &y);
+  *nfail += y != (T)-7.0;
+  (*ntests)++;
+}
+
+/*
+ * Each batch row must match the single row call bit for bit, the elements
+ * between the rows must be left alone, and a NaN in one row must not reach
+ * the others.
+ */
+template <typename T>
+static void RunBatch(int f, int vflag, int *ntests, int *nfail)
+{
+  static const int rows_list[] = { 0, 1, 2, 3, 5, 17 };
+  static const int cols_list[] = { 1, 7, 8, 9, 16, 33, 100 };
+  const T canary = (T)-1234.5;
+  uint64_t seed = 7;
+
+  for (int rows : rows_list) {
+    for (int cols : cols_list) {
+      for (int xpad : { 0, 3 }) {
+        for (int ypad : { 0, 5 }) {
+          int xs = cols + xpad, ys = cols + ypad;
+          std::vector<T> x((size_t)rows * xs + 1), y((size_t)rows * ys + 8,
+                                                     canary);
+          std::vector<T> row(cols), want(cols);
+          bool bad = false;
+
+          Fill(x, -30.0, 30.0, seed++);
+          if (rows > 2)
+            x[(size_t)xs + cols / 2] = (T)NAN;
+          if (rows > 3)
+            for (int j = 0; j < cols; j++)
+              x[(size_t)3 * xs + j] += (T)(sizeof(T) == sizeof(double) ?
+                                           1.0e300 : 1.0e30);
+
+          SoftmaxOps<T>::batch(f, rows, cols, x.data(), xs, y.data(), ys);
+          for (int i = 0; i < rows; i++) {
+            row.assign(x.begin() + (size_t)i * xs,
+                       x.begin() + (size_t)i * xs + cols);
+            SoftmaxOps<T>::run(f, cols, row.data(), want.data());
+            for (int j = 0; j < ys; j++) {
+              T got = y[(size_t)i * ys + j];
+              if (j >= cols)
+                bad |= got != canary;
+              else if (std::isnan(want[j]) != std::isnan(got) ||
+                       (!std::isnan(got) && memcmp(&got, &want[j], sizeof(T))))
+                bad = true;
+              else
+                bad |= std::isnan(got) != (rows > 2 && i == 1);
+            }
+          }
+          for (size_t j = (size_t)rows * ys; j < y.size(); j++)
+            bad |= y[j] != canary;
+
+          if (bad && vflag)
+            printf("%s_batch rows=%d cols=%d strides=%d,%d differs\n",
+                   sm_names[f], rows, cols, xs, ys);
+          *nfail += bad;
+          (*ntests)++;
+        }
+      }
+    }
+  }
+
+  /* cols <= 0 writes nothing */
+  T x = 1.0, y = canary;
+  SoftmaxOps<T>::batch(f, 1, 0, &x, 1, &y, 1);
+  SoftmaxOps<T>::batch(f, 1, -1, &x, 1, &y, 1);
+  *nfail += y != canary;
+  (*ntests)++;
+}
+
+#define SOFTMAX_REPORT(name, var)                                             \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail);            \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+#define SOFTMAX_REPORT_ULP(name, var)                                         \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d %-12g",\
+          name, "Accuracy", var, ntests, (ntests - nfail), nfail, max_ulp);   \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+#define SOFTMAX_TESTS(Fixture, T, FLOATS, var)                                \
+  TEST_P(Fixture, ACCURACY_VECTOR_ARRAY_##FLOATS##_SOFTMAX) {                 \
+    int ntests = 0, nfail = 0;                                                \
+    double max_ulp = 0.0;                                                     \
+    RunAccuracy<T>(SM_SOFTMAX, vflag, &ntests, &nfail, &max_ulp);             \
+    SOFTMAX_REPORT_ULP("Softmax", var);                                       \
+  }                                                                           \
+                                                                              \
+  TEST_P(Fixture, ACCURACY_VECTOR_ARRAY_##FLOATS##_LOG_SOFTMAX) {             \
+    int ntests = 0, nfail = 0;                                                \
+    double max_ulp = 0.0;                                                     \
+    RunAccuracy<T>(SM_LOG_SOFTMAX, vflag, &ntests, &nfail, &max_ulp);         \
+    SOFTMAX_REPORT_ULP("LogSoftmax", var);                                    \
+  }                                                                           \
+                                                                              \
+  TEST_P(Fixture, ACCURACY_VECTOR_ARRAY_##FLOATS##_SPECIALS) {                \
+    int ntests = 0, nfail = 0;                                                \
+    RunSpecials<T>(SM_SOFTMAX, vflag, &ntests, &nfail);                       \
+    RunSpecials<T>(SM_LOG_SOFTMAX, vflag, &ntests, &nfail);                   \
+    SOFTMAX_REPORT("Specials", var);                                          \
+  }                                                                           \
+                                                                              \
+  TEST_P(Fixture, ACCURACY_VECTOR_ARRAY_##FLOATS##_BATCH) {                   \
+    int ntests = 0, nfail = 0;                                                \
+    RunBatch<T>(SM_SOFTMAX, vflag, &ntests, &nfail);                          \
+    RunBatch<T>(SM_LOG_SOFTMAX, vflag, &ntests, &nfail);                      \
+    SOFTMAX_REPORT("Batch", var);                                             \
+  }
+
+SOFTMAX_TESTS(AccuTestFixtureDouble, double, DOUBLES, "vrda")
+SOFTMAX_TESTS(AccuTestFixtureFloat, float, FLOATS, "vrsa")
@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <stdio.h>
+#include <float.h>
+#include <math.h>
+#include <string>
+#include <cstring>
+#include <chrono>
+#include "benchmark.h"
+#include "almtestperf.h"
+#include "callback.h"
+
+using namespace std;
+using namespace ALM;
+
+/*
+ * The generic benchmarks would time one element rows, so the whole input
+ * array is taken as one row here instead, and as a batch of 64 element rows.
+ */
+template <typename T>
+static void Run(int which, int n, const T *x, T *y);
+
+template <>
+void Run(int which, int n, const double *x, double *y) {
+  switch (which) {
+  case 0: amd_vrda_softmax(n, x, y); break;
+  case 1: amd_vrda_log_softmax(n, x, y); break;
+  case 2: amd_vrda_softmax_batch(n / 64, 64, x, 64, y, 64); break;
+  default: amd_vrda_log_softmax_batch(n / 64, 64, x, 64, y, 64); break;
+  }
+}
+
+template <>
+void Run(int which, int n, const float *x, float *y) {
+  switch (which) {
+  case 0: amd_vrsa_softmaxf(n, x, y); break;
+  case 1: amd_vrsa_log_softmaxf(n, x, y); break;
+  case 2: amd_vrsa_softmax_batchf(n / 64, 64, x, 64, y, 64); break;
+  default: amd_vrsa_log_softmax_batchf(n / 64, 64, x, 64, y, 64); break;
+  }
+}
+
+template <typename T>
+static void LibmPerfTestSoftmax(benchmark::State& st, InputParams* param,
+                                int which) {
+  AoclLibmTest<T> objtest(param, GetnIpArgs());
+  double szn = param->niter * param->count;
+
+  for (auto _ : st) {
+    Run<T>(which, param->count, objtest.inpbuff, objtest.outbuff);
+    benchmark::ClobberMemory();
+  }
+
+  namespace bm = benchmark;
+  st.counters["MOPS"] = bm::Counter{szn, bm::Counter::kIsRate};
+}
+
+int AlmTestPerfFramework::AlmTestPerformance(InputParams *params) {
+  static const char *names[] = { "softmax", "log_softmax", "softmax_batch",
+                                  "log_softmax_batch" };
+  string funcnam = "AoclLibm";
+  string libm;
+
+  if((params->fqty != ALM::FloatQuantity::E_All) &&
+     (params->fqty != ALM::FloatQuantity::E_Vector_Array)) {
+    cout << "Only the array variants (-e 32) are available for softmax" << endl;
+    return 0;
+  }
+
+  for (int which = 0; which < 4; which++) {
+    if((params->fwidth == ALM::FloatWidth::E_ALL) ||
+      (params->fwidth == ALM::FloatWidth::E_F64)) {
+      string varnam = string("_vad(") + names[which] + ")";
+      libm = funcnam + varnam;
+      benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestSoftmax<double>,
+                                   params, which)
+                 ->Args({(int)params->count})->Iterations(params->niter);
+    }
+
+    if((params->fwidth == ALM::FloatWidth::E_ALL) ||
+      (params->fwidth == ALM::FloatWidth::E_F32)) {
+      string varnam = string("_vas(") + names[which] + "f)";
+      libm = funcnam + varnam;
+      benchmark::RegisterBenchmark(libm.c_str(), &LibmPerfTestSoftmax<float>,
+                                   params, which)
+                 ->Args({(int)params->count})->Iterations(params->niter);
+    }
+  }
+
+  size_t retval = benchmark::RunSpecifiedBenchmarks();
+
+  return (int)retval;
+}
+
+
+AlmTestPerfFramework::~AlmTestPerfFramework() {
+#if defined(DEBUG_PRINTS)
+  cout << "AlmTestPerfFramework destructor completed" << endl;
+#endif
+}
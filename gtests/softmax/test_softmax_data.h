@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef __TEST_SOFTMAX_DATA_H__
+#define __TEST_SOFTMAX_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for softmax, run element by element through
+ * amd_vrsa_softmaxf() and amd_vrda_softmax() with len = 1, so every finite
+ * input gives 1. A row holding NaN or +Inf, or only -Inf, gives NaN.
+ *
+ * The softmax kernels keep special inputs on the vector path and make no
+ * promise about the status flags, so none are expected.
+ */
+
+static libm_test_special_data_f32
+test_softmaxf_conformance_data[] = {
+    { POS_ZERO_F32,    POS_ONE_F32,     AMD_F_NONE },  /* softmax(+0) = 1 */
+    { NEG_ZERO_F32,    POS_ONE_F32,     AMD_F_NONE },  /* softmax(-0) = 1 */
+    { POS_INF_F32,     POS_QNAN_F32,    AMD_F_NONE },  /* softmax(+Inf) = QNaN */
+    { NEG_INF_F32,     POS_QNAN_F32,    AMD_F_NONE },  /* softmax(-Inf) = QNaN */
+    { POS_QNAN_F32,    POS_QNAN_F32,    AMD_F_NONE },  /* softmax(+QNaN) = QNaN */
+    { NEG_QNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE },  /* softmax(-QNaN) = QNaN */
+    { POS_ONE_F32,     POS_ONE_F32,     AMD_F_NONE },  /* softmax(1) = 1 */
+    { NEG_ONE_F32,     POS_ONE_F32,     AMD_F_NONE },  /* softmax(-1) = 1 */
+    { POS_LDENORM_F32, POS_ONE_F32,     AMD_F_NONE },  /* smallest denormal */
+    { POS_HNORMAL_F32, POS_ONE_F32,     AMD_F_NONE },  /* FLT_MAX */
+    { NEG_HNORMAL_F32, POS_ONE_F32,     AMD_F_NONE },  /* -FLT_MAX */
+};
+
+static libm_test_special_data_f64
+test_softmax_conformance_data[] = {
+    { POS_ZERO_F64,    POS_ONE_F64,     AMD_F_NONE },  /* softmax(+0) = 1 */
+    { NEG_ZERO_F64,    POS_ONE_F64,     AMD_F_NONE },  /* softmax(-0) = 1 */
+    { POS_INF_F64,     POS_QNAN_F64,    AMD_F_NONE },  /* softmax(+Inf) = QNaN */
+    { NEG_INF_F64,     POS_QNAN_F64,    AMD_F_NONE },  /* softmax(-Inf) = QNaN */
+    { POS_QNAN_F64,    POS_QNAN_F64,    AMD_F_NONE },  /* softmax(+QNaN) = QNaN */
+    { NEG_QNAN_F64,    NEG_QNAN_F64,    AMD_F_NONE },  /* softmax(-QNaN) = QNaN */
+    { POS_ONE_F64,     POS_ONE_F64,     AMD_F_NONE },  /* softmax(1) = 1 */
+    { NEG_ONE_F64,     POS_ONE_F64,     AMD_F_NONE },  /* softmax(-1) = 1 */
+    { POS_LDENORM_F64, POS_ONE_F64,     AMD_F_NONE },  /* smallest denormal */
+    { POS_HNORMAL_F64, POS_ONE_F64,     AMD_F_NONE },  /* DBL_MAX */
+    { NEG_HNORMAL_F64, POS_ONE_F64,     AMD_F_NONE },  /* -DBL_MAX */
+};
+
+#endif /*__TEST_SOFTMAX_DATA_H__*/
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+#ifndef __TEST_SOFTPLUS_DATA_H__
+#define __TEST_SOFTPLUS_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for softplus(): zeros, infinities, NaNs, subnormals,
+ * the extremes, and the tails where exp() underflows.
+ *
+ * The activation kernels keep special inputs on the vector path (see
+ * include/libm/alm_activation.h) and make no promise about the status
+ * flags, so none are expected.
+ */
+
+static libm_test_special_data_f32
+test_softplusf_conformance_data[] = {
+    { 0x00000000, 0x3F317218, AMD_F_NONE },  /* +0: softplus(0) = 0.693147182 */
+    { 0x80000000, 0x3F317218, AMD_F_NONE },  /* -0: softplus(-0) = 0.693147182 */
+    { 0x7F800000, 0x7F800000, AMD_F_NONE },  /* +Inf: softplus(inf) = inf */
+    { 0xFF800000, 0x00000000, AMD_F_NONE },  /* -Inf: softplus(-inf) = 0 */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: softplus(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: softplus(-nan) = -nan */
+    { 0x00000001, 0x3F317218, AMD_F_NONE },  /* min subnormal: softplus(1.40129846e-45) = 0.693147182 */
+    { 0x80000001, 0x3F317218, AMD_F_NONE },  /* -min subnormal: softplus(-1.40129846e-45) = 0.693147182 */
+    { 0x00800000, 0x3F317218, AMD_F_NONE },  /* min normal: softplus(1.17549435e-38) = 0.693147182 */
+    { 0x80800000, 0x3F317218, AMD_F_NONE },  /* -min normal: softplus(-1.17549435e-38) = 0.693147182 */
+    { 0x3F800000, 0x3FA818F5, AMD_F_NONE },  /* 1: softplus(1) = 1.31326163 */
+    { 0xBF800000, 0x3EA063D6, AMD_F_NONE },  /* -1: softplus(-1) = 0.313261688 */
+    { 0x3F000000, 0x3F795D1C, AMD_F_NONE },  /* 0.5: softplus(0.5) = 0.974076986 */
+    { 0xBF000000, 0x3EF2BA38, AMD_F_NONE },  /* -0.5: softplus(-0.5) = 0.474076986 */
+    { 0x41200000, 0x41200030, AMD_F_NONE },  /* 10: softplus(10) = 10.0000458 */
+    { 0xC1200000, 0x383E6AB2, AMD_F_NONE },  /* -10: softplus(-10) = 4.53988978e-05 */
+    { 0x41A00000, 0x41A00000, AMD_F_NONE },  /* 20: softplus(20) = 20 */
+    { 0xC1A00000, 0x310DA433, AMD_F_NONE },  /* -20: softplus(-20) = 2.06115369e-09 */
+    { 0xC2B40000, 0x0008EC28, AMD_F_NONE },  /* exp underflow: softplus(-90) = 8.19400869e-40 */
+    { 0xC2C80000, 0x0000001B, AMD_F_NONE },  /* subnormal result: softplus(-100) = 3.78350585e-44 */
+    { 0xC2DC0000, 0x00000000, AMD_F_NONE },  /* -110: softplus(-110) = 0 */
+    { 0x7F7FFFFF, 0x7F7FFFFF, AMD_F_NONE },  /* max: softplus(3.40282347e+38) = 3.40282347e+38 */
+    { 0xFF7FFFFF, 0x00000000, AMD_F_NONE },  /* -max: softplus(-3.40282347e+38) = 0 */
+};
+
+static libm_test_special_data_f64
+test_softplus_conformance_data[] = {
+    { 0x0000000000000000, 0x3FE62E42FEFA39EF, AMD_F_NONE },  /* +0: softplus(0) = 0.69314718055994529 */
+    { 0x8000000000000000, 0x3FE62E42FEFA39EF, AMD_F_NONE },  /* -0: softplus(-0) = 0.69314718055994529 */
+    { 0x7FF0000000000000, 0x7FF0000000000000, AMD_F_NONE },  /* +Inf: softplus(inf) = inf */
+    { 0xFFF0000000000000, 0x0000000000000000, AMD_F_NONE },  /* -Inf: softplus(-inf) = 0 */
+    { 0x7FF8000000000000, 0x7FF8000000000000, AMD_F_NONE },  /* +QNaN: softplus(nan) = nan */
+    { 0xFFF8000000000000, 0xFFF8000000000000, AMD_F_NONE },  /* -QNaN: softplus(-nan) = -nan */
+    { 0x0000000000000001, 0x3FE62E42FEFA39EF, AMD_F_NONE },  /* min subnormal: softplus(4.9406564584124654e-324) = 0.69314718055994529 */
+    { 0x8000000000000001, 0x3FE62E42FEFA39EF, AMD_F_NONE },  /* -min subnormal: softplus(-4.9406564584124654e-324) = 0.69314718055994529 */
+    { 0x0010000000000000, 0x3FE62E42FEFA39EF, AMD_F_NONE },  /* min normal: softplus(2.2250738585072014e-308) = 0.69314718055994529 */
+    { 0x8010000000000000, 0x3FE62E42FEFA39EF, AMD_F_NONE },  /* -min normal: softplus(-2.2250738585072014e-308) = 0.69314718055994529 */
+    { 0x3FF0000000000000, 0x3FF5031EAFEFB049, AMD_F_NONE },  /* 1: softplus(1) = 1.3132616875182228 */
+    { 0xBFF0000000000000, 0x3FD40C7ABFBEC124, AMD_F_NONE },  /* -1: softplus(-1) = 0.31326168751822281 */
+    { 0x3FE0000000000000, 0x3FEF2BA37EDAE032, AMD_F_NONE },  /* 0.5: softplus(0.5) = 0.97407698418010669 */
+    { 0xBFE0000000000000, 0x3FDE5746FDB5C064, AMD_F_NONE },  /* -0.5: softplus(-0.5) = 0.47407698418010669 */
+    { 0x4024000000000000, 0x40240005F3559328, AMD_F_NONE },  /* 10: softplus(10) = 10.000045398899218 */
+    { 0xC024000000000000, 0x3F07CD564C9E0D19, AMD_F_NONE },  /* -10: softplus(-10) = 4.5398899216864647e-05 */
+    { 0x4044000000000000, 0x4044000000000000, AMD_F_NONE },  /* 40: softplus(40) = 40 */
+    { 0xC044000000000000, 0x3C539792499B1A24, AMD_F_NONE },  /* -40: softplus(-40) = 4.2483542552915889e-18 */
+    { 0xC086300000000000, 0x00033802FD28B3C3, AMD_F_NONE },  /* exp underflow: softplus(-710) = 4.4762862256751298e-309 */
+    { 0xC086800000000000, 0x0000000993B4DC95, AMD_F_NONE },  /* subnormal result: softplus(-720) = 2.0322308024183599e-313 */
+    { 0xC087C00000000000, 0x0000000000000000, AMD_F_NONE },  /* -760: softplus(-760) = 0 */
+    { 0x7FEFFFFFFFFFFFFF, 0x7FEFFFFFFFFFFFFF, AMD_F_NONE },  /* max: softplus(1.7976931348623157e+308) = 1.7976931348623157e+308 */
+    { 0xFFEFFFFFFFFFFFFF, 0x0000000000000000, AMD_F_NONE },  /* -max: softplus(-1.7976931348623157e+308) = 0 */
+};
+
+#endif /*__TEST_SOFTPLUS_DATA_H__*/
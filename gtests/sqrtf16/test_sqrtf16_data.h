@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_SQRTF16_DATA_H__
+#define __TEST_SQRTF16_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for sqrtf16(), as the float values of FP16 inputs
+ * and correctly rounded FP16 results: zeros, infinities, NaNs, subnormals,
+ * the largest finite value, and negative inputs and exact squares.
+ *
+ * The FP16 kernels keep special inputs on the vector path (see
+ * include/libm/alm_half.h) and make no promise about the status flags, so
+ * none are expected.
+ */
+
+static libm_test_special_data_f32
+test_sqrtf16_conformance_data[] = {
+    { 0x00000000, 0x00000000, AMD_F_NONE },  /* +0: sqrt(0) = 0 */
+    { 0x80000000, 0x80000000, AMD_F_NONE },  /* -0: sqrt(-0) = -0 */
+    { 0x7F800000, 0x7F800000, AMD_F_NONE },  /* +Inf: sqrt(inf) = inf */
+    { 0xFF800000, 0x7FC00000, AMD_F_NONE },  /* -Inf: sqrt(-inf) = nan */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: sqrt(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: sqrt(-nan) = -nan */
+    { 0x33800000, 0x39800000, AMD_F_NONE },  /* min subnormal: sqrt(5.96046448e-08) = 0.000244140625 */
+    { 0xB3800000, 0x7FC00000, AMD_F_NONE },  /* -min subnormal: sqrt(-5.96046448e-08) = nan */
+    { 0x387FC000, 0x3BFFE000, AMD_F_NONE },  /* max subnormal: sqrt(6.09755516e-05) = 0.0078086853 */
+    { 0x38800000, 0x3C000000, AMD_F_NONE },  /* min normal: sqrt(6.10351562e-05) = 0.0078125 */
+    { 0x3F800000, 0x3F800000, AMD_F_NONE },  /* 1: sqrt(1) = 1 */
+    { 0xBF800000, 0x7FC00000, AMD_F_NONE },  /* -1: sqrt(-1) = nan */
+    { 0x477FE000, 0x437FE000, AMD_F_NONE },  /* max: sqrt(65504) = 255.875 */
+    { 0xC77FE000, 0x7FC00000, AMD_F_NONE },  /* -max: sqrt(-65504) = nan */
+    { 0x40000000, 0x3FB50000, AMD_F_NONE },  /* 2: sqrt(2) = 1.4140625 */
+    { 0x40800000, 0x40000000, AMD_F_NONE },  /* 4: sqrt(4) = 2 */
+    { 0x34000000, 0x39B50000, AMD_F_NONE },  /* 2 min subnormal: sqrt(1.1920929e-07) = 0.000345230103 */
+    { 0x3F7FE000, 0x3F7FE000, AMD_F_NONE },  /* 1-ulp: sqrt(0.999511719) = 0.999511719 */
+    { 0xC0800000, 0x7FC00000, AMD_F_NONE },  /* negative: sqrt(-4) = nan */
+};
+
+#endif /*__TEST_SQRTF16_DATA_H__*/
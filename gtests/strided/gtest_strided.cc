@@ -0,0 +1,330 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "almstruct.h"
+#include "defs.h"
+#include "almtest.h"
+#include "callback.h"
+#include <external/amdlibm.h>
+
+/*
+ * Strided (_i_64) variants against the contiguous array kernels.
+ *
+ * The strided entry points only gather, scatter and block the data, so every
+ * element they produce must be bit-identical to the array kernel on the same
+ * input. The tests below place the fixture inputs at the given strides in a
+ * buffer guarded by a canary pattern, run the strided call and check both the
+ * results and that nothing between or around the strided elements changed.
+ *
+ * Strides are size_t. A stride of 0 repeats the first input element, and a
+ * stride of (size_t)-k walks the array backwards, the pointer then naming
+ * the element at the highest address.
+ */
+
+#define STRIDED_GUARD 16
+
+template <typename T> struct StridedOps;
+
+template <> struct StridedOps<double> {
+  typedef uint64_t bits;
+  static constexpr bits canary = 0x7ff4deadbeef5a5aULL;
+  static void array(int n, const double *x, double *r) {
+    amd_vrda_exp(n, x, r);
+  }
+  static void strided(size_t n, const double *x, size_t ix, double *r, size_t ir) {
+    amd_vrda_expi_64(n, x, ix, r, ir);
+  }
+  static void array2(int n, const double *x, const double *y, double *r) {
+    amd_vrda_pow(n, x, y, r);
+  }
+  static void strided2(size_t n, const double *x, size_t ix, const double *y,
+                       size_t iy, double *r, size_t ir) {
+    amd_vrda_powi_64(n, x, ix, y, iy, r, ir);
+  }
+};
+
+template <> struct StridedOps<float> {
+  typedef uint32_t bits;
+  static constexpr bits canary = 0x7fa5a5a5U;
+  static void array(int n, const float *x, float *r) {
+    amd_vrsa_expf(n, x, r);
+  }
+  static void strided(size_t n, const float *x, size_t ix, float *r, size_t ir) {
+    amd_vrsa_expfi_64(n, x, ix, r, ir);
+  }
+  static void array2(int n, const float *x, const float *y, float *r) {
+    amd_vrsa_powf(n, x, y, r);
+  }
+  static void strided2(size_t n, const float *x, size_t ix, const float *y,
+                       size_t iy, float *r, size_t ir) {
+    amd_vrsa_powfi_64(n, x, ix, y, iy, r, ir);
+  }
+};
+
+/*
+ * A strided view of n elements inside a canary filled buffer. Signed strides
+ * (size_t wraparound) put the base pointer at the high end of the buffer.
+ */
+template <typename T>
+class StridedBuf {
+ public:
+  typedef typename StridedOps<T>::bits bits;
+
+  StridedBuf(size_t n, size_t inc) : inc(inc) {
+    ptrdiff_t s = (ptrdiff_t)inc;
+    ptrdiff_t last = n ? (ptrdiff_t)(n - 1) * s : 0;
+    size_t span = (size_t)(last < 0 ? -last : last) + 1;
+
+    buf.assign(span + 2 * STRIDED_GUARD, StridedOps<T>::canary);
+    base = (T *)buf.data() + STRIDED_GUARD + (last < 0 ? -last : 0);
+  }
+
+  T &at(size_t i) { return base[(ptrdiff_t)(i * inc)]; }
+
+  /* Check every word that is not one of the n strided elements */
+  size_t untouched(size_t n) const {
+    std::vector<bool> mine(buf.size(), false);
+    size_t off = (size_t)(base - (T *)buf.data()), bad = 0;
+
+    for (size_t i = 0; i < n; i++)
+      mine[off + (ptrdiff_t)(i * inc)] = true;
+    for (size_t j = 0; j < buf.size(); j++)
+      if (!mine[j] && buf[j] != StridedOps<T>::canary)
+        bad++;
+    return bad;
+  }
+
+  std::vector<bits> buf;
+  T *base;
+  size_t inc;
+};
+
+template <typename T>
+static bool SameBits(T a, T b) {
+  return memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+/* Unary strided call on n inputs (cycled from in[]) against the array kernel */
+template <typename T>
+static int CheckUnary(const T *in, size_t cnt, size_t n, size_t is, size_t id,
+                      bool alias, int vflag) {
+  std::vector<T> x(n ? n : 1), ref(n ? n : 1);
+  StridedBuf<T> src(n, is), dst(n, alias ? is : id);
+  StridedBuf<T> &out = alias ? src : dst;
+  int nfail = 0;
+
+  for (size_t i = 0; i < n; i++)
+    x[i] = in[(is ? i : 0) % cnt];
+  for (size_t i = 0; i < n; i++)
+    src.at(i) = x[i];
+  if (n)
+    StridedOps<T>::array((int)n, x.data(), ref.data());
+
+  StridedOps<T>::strided(n, src.base, is, out.base, out.inc);
+
+  for (size_t i = 0; i < n; i++) {
+    if (!SameBits(out.at(i), ref[i])) {
+      nfail++;
+      if (vflag)
+        printf("n=%zu inc_src=%td inc_dst=%td i=%zu: got %a expected %a\n",
+               n, (ptrdiff_t)is, (ptrdiff_t)out.inc, i,
+               (double)out.at(i), (double)ref[i]);
+    }
+  }
+  if (!alias)
+    nfail += (int)src.untouched(n);
+  nfail += (int)out.untouched(n);
+  return nfail;
+}
+
+/* Binary strided call, the second operand cycling through ys[] */
+template <typename T>
+static int CheckBinary(const T *in, size_t cnt, size_t n, size_t ia, size_t ib,
+                       size_t ir, int vflag) {
+  static const T ys[] = { 0.5, -1.5, 2.0, 3.0, -0.25, 1.0, 0.0, 7.0 };
+  std::vector<T> a(n), b(n), ref(n);
+  StridedBuf<T> lhs(n, ia), rhs(n, ib), dst(n, ir);
+  int nfail = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    a[i] = in[(ia ? i : 0) % cnt];
+    b[i] = ys[(ib ? i : 0) % ARRAY_SIZE(ys)];
+    lhs.at(i) = a[i];
+    rhs.at(i) = b[i];
+  }
+  StridedOps<T>::array2((int)n, a.data(), b.data(), ref.data());
+
+  StridedOps<T>::strided2(n, lhs.base, ia, rhs.base, ib, dst.base, ir);
+
+  for (size_t i = 0; i < n; i++) {
+    if (!SameBits(dst.at(i), ref[i])) {
+      nfail++;
+      if (vflag)
+        printf("n=%zu inc_a=%td inc_b=%td inc_res=%td i=%zu: got %a expected %a\n",
+               n, (ptrdiff_t)ia, (ptrdiff_t)ib, (ptrdiff_t)ir, i,
+               (double)dst.at(i), (double)ref[i]);
+    }
+  }
+  nfail += (int)dst.untouched(n);
+  return nfail;
+}
+
+static const size_t strided_incs_src[] = { 0, 1, 2, 3, 5, (size_t)-1, (size_t)-3 };
+static const size_t strided_incs_dst[] = { 1, 2, 3, 4, (size_t)-1, (size_t)-2 };
+static const size_t strided_incs_alias[] = { 1, 2, 3, 7, (size_t)-1, (size_t)-2 };
+
+/* Lengths around the vector widths and the 512 element blocks */
+static const size_t strided_tails[] = { 0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 31, 33,
+                                        511, 512, 513, 1023, 1024, 1025, 1539 };
+
+static const size_t strided_incs_binary[][3] = {
+  { 1, 0, 1 }, { 2, 0, 3 }, { 3, 1, 1 }, { 0, 2, 1 },
+  { 1, 1, 2 }, { 0, 0, 1 }, { (size_t)-1, 2, (size_t)-1 },
+};
+
+template <typename T>
+static void RunStrides(const T *in, uint32_t count, int vflag, int *ntests,
+                       int *nfail) {
+  for (size_t is : strided_incs_src) {
+    for (size_t id : strided_incs_dst) {
+      *nfail += CheckUnary(in, count, count, is, id, false, vflag);
+      *ntests += count;
+    }
+  }
+  for (size_t inc : strided_incs_alias) {
+    *nfail += CheckUnary(in, count, count, inc, inc, true, vflag);
+    *ntests += count;
+  }
+}
+
+/*
+ * Tail lengths, first on the calling thread and then split over four
+ * threads with a small grain, so the partitions start mid block.
+ */
+template <typename T>
+static void RunTails(const T *in, uint32_t count, int vflag, int *ntests,
+                     int *nfail) {
+  int nthreads = alm_get_num_threads();
+  size_t grain = alm_get_grain_size();
+
+  for (int pass = 0; pass < 2; pass++) {
+    if (pass == 1) {
+      alm_set_num_threads(4);
+      alm_set_grain_size(64);
+    }
+    for (size_t n : strided_tails) {
+      *nfail += CheckUnary(in, count, n, 2, 3, false, vflag);
+      *nfail += CheckUnary(in, count, n, 3, 3, true, vflag);
+      *nfail += CheckUnary(in, count, n, (size_t)-1, 1, false, vflag);
+      *ntests += 3 * (int)n + 3;
+    }
+    *nfail += CheckUnary(in, count, 3 * (size_t)count + 5, 2, 2, true, vflag);
+    *ntests += 3 * count + 5;
+  }
+
+  alm_set_num_threads(nthreads);
+  alm_set_grain_size(grain);
+}
+
+template <typename T>
+static void RunBinary(const T *in, uint32_t count, int vflag, int *ntests,
+                      int *nfail) {
+  for (auto &inc : strided_incs_binary) {
+    *nfail += CheckBinary(in, count, count, inc[0], inc[1], inc[2], vflag);
+    *ntests += count;
+  }
+}
+
+#define STRIDED_REPORT(name, var)                                             \
+  sprintf(ptr->print[ptr->tstcnt], "%-12s %-12s %-12s %-12d %-12d %-12d",     \
+          "Strided", name, var, ntests, (ntests - nfail), nfail);             \
+  ptr->tstcnt++;                                                              \
+  EXPECT_EQ(nfail, 0)
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_STRIDES) {
+  int ntests = 0, nfail = 0;
+  RunStrides(inpbuff, count, vflag, &ntests, &nfail);
+  STRIDED_REPORT("Strides", "vrda_i_64");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_TAILS) {
+  int ntests = 0, nfail = 0;
+  RunTails(inpbuff, count, vflag, &ntests, &nfail);
+  STRIDED_REPORT("Tails", "vrda_i_64");
+}
+
+TEST_P(AccuTestFixtureDouble, ACCURACY_VECTOR_ARRAY_DOUBLES_BINARY) {
+  int ntests = 0, nfail = 0;
+  RunBinary(inpbuff, count, vflag, &ntests, &nfail);
+  STRIDED_REPORT("Binary", "vrda_i_64");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_STRIDES) {
+  int ntests = 0, nfail = 0;
+  RunStrides(inpbuff, count, vflag, &ntests, &nfail);
+  STRIDED_REPORT("Strides", "vrsa_i_64");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_TAILS) {
+  int ntests = 0, nfail = 0;
+  RunTails(inpbuff, count, vflag, &ntests, &nfail);
+  STRIDED_REPORT("Tails", "vrsa_i_64");
+}
+
+TEST_P(AccuTestFixtureFloat, ACCURACY_VECTOR_ARRAY_FLOATS_BINARY) {
+  int ntests = 0, nfail = 0;
+  RunBinary(inpbuff, count, vflag, &ntests, &nfail);
+  STRIDED_REPORT("Binary", "vrsa_i_64");
+}
+
+/* The conformance table through a gathering, reversing and aliasing call */
+TEST_P(SpecTestFixtureDoubleArray, CONFORMANCE_VECTOR_ARRAY_DOUBLES_STRIDES) {
+  int ntests = 0, nfail = 0;
+  for (size_t is : strided_incs_src) {
+    if (is == 0)
+      continue;
+    nfail += CheckUnary(data, count, count, is, 2, false, vflag);
+    nfail += CheckUnary(data, count, count, is, is, true, vflag);
+    ntests += 2 * count;
+  }
+  STRIDED_REPORT("Conformance", "vrda_i_64");
+}
+
+TEST_P(SpecTestFixtureFloatArray, CONFORMANCE_VECTOR_ARRAY_FLOATS_STRIDES) {
+  int ntests = 0, nfail = 0;
+  for (size_t is : strided_incs_src) {
+    if (is == 0)
+      continue;
+    nfail += CheckUnary(data, count, count, is, 2, false, vflag);
+    nfail += CheckUnary(data, count, count, is, is, true, vflag);
+    ntests += 2 * count;
+  }
+  STRIDED_REPORT("Conformance", "vrsa_i_64");
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef __TEST_STRIDED_DATA_H__
+#define __TEST_STRIDED_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for the strided array variants, run through
+ * amd_vrsa_expfi_64() and amd_vrda_expi_64().
+ *
+ * The strided entry points only move data around the array kernels, so the
+ * table sticks to the special values whose bit patterns must come through
+ * the pack/unpack path unchanged: signed zeros, infinities, NaNs, denormals
+ * and the overflow/underflow edges of exp.
+ */
+
+static libm_test_special_data_f32
+test_stridedf_conformance_data[] = {
+    { POS_ZERO_F32,    POS_ONE_F32,     AMD_F_NONE      },  /* exp(+0) = 1 */
+    { NEG_ZERO_F32,    POS_ONE_F32,     AMD_F_NONE      },  /* exp(-0) = 1 */
+    { POS_INF_F32,     POS_INF_F32,     AMD_F_NONE      },  /* exp(+Inf) = +Inf */
+    { NEG_INF_F32,     POS_ZERO_F32,    AMD_F_NONE      },  /* exp(-Inf) = +0 */
+    { POS_QNAN_F32,    POS_QNAN_F32,    AMD_F_NONE      },  /* exp(+QNaN) = +QNaN */
+    { NEG_QNAN_F32,    NEG_QNAN_F32,    AMD_F_NONE      },  /* exp(-QNaN) = -QNaN */
+    { POS_LDENORM_F32, POS_ONE_F32,     AMD_F_INEXACT   },  /* exp(tiny) = 1 */
+    { NEG_HDENORM_F32, POS_ONE_F32,     AMD_F_INEXACT   },  /* exp(-tiny) = 1 */
+    { 0x42b17218,      POS_INF_F32,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* 88.7228, overflow */
+    { 0x42b17217,      0x7f7fff84,      AMD_F_INEXACT   },  /* 88.7228, largest finite result */
+    { 0xc2aeac50,      0x007fffe6,      AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* -87.3365, denormal result */
+    { 0xc2e00000,      POS_ZERO_F32,    AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* -112, underflow */
+    { POS_HNORMAL_F32, POS_INF_F32,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* FLT_MAX */
+    { NEG_HNORMAL_F32, POS_ZERO_F32,    AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* -FLT_MAX */
+    { POS_ONE_F32,     0x402df854,      AMD_F_INEXACT   },  /* exp(1) = e */
+};
+
+static libm_test_special_data_f64
+test_strided_conformance_data[] = {
+    { POS_ZERO_F64,    POS_ONE_F64,     AMD_F_NONE      },  /* exp(+0) = 1 */
+    { NEG_ZERO_F64,    POS_ONE_F64,     AMD_F_NONE      },  /* exp(-0) = 1 */
+    { POS_INF_F64,     POS_INF_F64,     AMD_F_NONE      },  /* exp(+Inf) = +Inf */
+    { NEG_INF_F64,     POS_ZERO_F64,    AMD_F_NONE      },  /* exp(-Inf) = +0 */
+    { POS_QNAN_F64,    POS_QNAN_F64,    AMD_F_NONE      },  /* exp(+QNaN) = +QNaN */
+    { NEG_QNAN_F64,    NEG_QNAN_F64,    AMD_F_NONE      },  /* exp(-QNaN) = -QNaN */
+    { POS_LDENORM_F64, POS_ONE_F64,     AMD_F_INEXACT   },  /* exp(tiny) = 1 */
+    { NEG_HDENORM_F64, POS_ONE_F64,     AMD_F_INEXACT   },  /* exp(-tiny) = 1 */
+    { 0x40862e42fefa39f0, POS_INF_F64,  AMD_F_OVERFLOW | AMD_F_INEXACT },  /* 709.79, overflow */
+    { 0x40862e42fefa39ef, 0x7fefffffffffff2a, AMD_F_INEXACT },  /* 709.78, largest finite result */
+    { 0xc086232bdd7abcd2, 0x001000000000007c, AMD_F_INEXACT },  /* -708.40, smallest normal result */
+    { 0xc0874385446d71c3, 0x0000000000000001, AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* -744.44, smallest denormal */
+    { 0xc08f400000000000, POS_ZERO_F64, AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* -1000, underflow */
+    { POS_HNORMAL_F64, POS_INF_F64,     AMD_F_OVERFLOW | AMD_F_INEXACT },  /* DBL_MAX */
+    { NEG_HNORMAL_F64, POS_ZERO_F64,    AMD_F_UNDERFLOW | AMD_F_INEXACT },  /* -DBL_MAX */
+    { POS_ONE_F64,     0x4005bf0a8b145769, AMD_F_INEXACT },  /* exp(1) = e */
+};
+
+#endif /*__TEST_STRIDED_DATA_H__*/
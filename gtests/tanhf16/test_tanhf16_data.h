@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+#ifndef __TEST_TANHF16_DATA_H__
+#define __TEST_TANHF16_DATA_H__
+
+#include <fenv.h>
+#include "almstruct.h"
+#include <libm_util_amd.h>
+
+/*
+ * Conformance test cases for tanhf16(), as the float values of FP16 inputs
+ * and correctly rounded FP16 results: zeros, infinities, NaNs, subnormals,
+ * the largest finite value, and the inputs where the result saturates to 1.
+ *
+ * The FP16 kernels keep special inputs on the vector path (see
+ * include/libm/alm_half.h) and make no promise about the status flags, so
+ * none are expected.
+ */
+
+static libm_test_special_data_f32
+test_tanhf16_conformance_data[] = {
+    { 0x00000000, 0x00000000, AMD_F_NONE },  /* +0: tanh(0) = 0 */
+    { 0x80000000, 0x80000000, AMD_F_NONE },  /* -0: tanh(-0) = -0 */
+    { 0x7F800000, 0x3F800000, AMD_F_NONE },  /* +Inf: tanh(inf) = 1 */
+    { 0xFF800000, 0xBF800000, AMD_F_NONE },  /* -Inf: tanh(-inf) = -1 */
+    { 0x7FC00000, 0x7FC00000, AMD_F_NONE },  /* +QNaN: tanh(nan) = nan */
+    { 0xFFC00000, 0xFFC00000, AMD_F_NONE },  /* -QNaN: tanh(-nan) = -nan */
+    { 0x33800000, 0x33800000, AMD_F_NONE },  /* min subnormal: tanh(5.96046448e-08) = 5.96046448e-08 */
+    { 0xB3800000, 0xB3800000, AMD_F_NONE },  /* -min subnormal: tanh(-5.96046448e-08) = -5.96046448e-08 */
+    { 0x387FC000, 0x387FC000, AMD_F_NONE },  /* max subnormal: tanh(6.09755516e-05) = 6.09755516e-05 */
+    { 0x38800000, 0x38800000, AMD_F_NONE },  /* min normal: tanh(6.10351562e-05) = 6.10351562e-05 */
+    { 0x3F800000, 0x3F430000, AMD_F_NONE },  /* 1: tanh(1) = 0.76171875 */
+    { 0xBF800000, 0xBF430000, AMD_F_NONE },  /* -1: tanh(-1) = -0.76171875 */
+    { 0x477FE000, 0x3F800000, AMD_F_NONE },  /* max: tanh(65504) = 1 */
+    { 0xC77FE000, 0xBF800000, AMD_F_NONE },  /* -max: tanh(-65504) = -1 */
+    { 0x3F000000, 0x3EECA000, AMD_F_NONE },  /* 0.5: tanh(0.5) = 0.462158203 */
+    { 0x3A000000, 0x3A000000, AMD_F_NONE },  /* small: tanh(0.00048828125) = 0.00048828125 */
+    { 0x40900000, 0x3F7FE000, AMD_F_NONE },  /* 4.5: tanh(4.5) = 0.999511719 */
+    { 0x40A00000, 0x3F800000, AMD_F_NONE },  /* saturated: tanh(5) = 1 */
+    { 0xC0A00000, 0xBF800000, AMD_F_NONE },  /* -saturated: tanh(-5) = -1 */
+    { 0x40000000, 0x3F76C000, AMD_F_NONE },  /* 2: tanh(2) = 0.963867188 */
+};
+
+#endif /*__TEST_TANHF16_DATA_H__*/
@@ -561,6 +561,12 @@ extern "C" {
    * @return erfinv(x).
    */
   double amd_erfinv (double x);
+  /**
+   * @brief Computes the Gaussian inverse error function for a single-precision value.
+   * @param x Input value.
+   * @return erfinvf(x).
+   */
+  float amd_erfinvf (float x);
 
 /* Complementary Error */
   /**
@@ -583,6 +589,12 @@ extern "C" {
    * @return cdfnorm(x).
    */
   double amd_cdfnorm (double x);
+  /**
+   * @brief Computes the cumulative normal distribution function values of a single-precision value
+   * @param x Input value.
+   * @return cdfnormf(x).
+   */
+  float amd_cdfnormf (float x);
 
   /**
    * @brief Computes the inverse cumulative normal distribution function
@@ -590,6 +602,12 @@ extern "C" {
    * @return cdfnorminv(x).
    */
   double amd_cdfnorminv (double x);
+  /**
+   * @brief Computes the inverse cumulative normal distribution function for a single-precision value
+   * @param x Input value.
+   * @return cdfnorminvf(x).
+   */
+  float amd_cdfnorminvf (float x);
 
   /* Inverse Complementary Error */
   /**
@@ -598,6 +616,12 @@ extern "C" {
    * @return erfcinv(x).
    */
   double amd_erfcinv (double x);
+  /**
+   * @brief Computes the inverse complementary error function for a single-precision value.
+   * @param x Input value.
+   * @return erfcinvf(x).
+   */
+  float amd_erfcinvf (float x);
 
 /* Remainder */
   /**
@@ -1068,6 +1092,123 @@ extern "C" {
    */
   fc32_t amd_cpowf (fc32_t x, fc32_t y);
 
+  /**
+   * @brief Computes the complex square root of a double-precision complex value.
+   * @param x Input complex value.
+   * @return Complex square root of x, with non-negative real part.
+   */
+  fc64_t amd_csqrt (fc64_t x);
+  /**
+   * @brief Computes the complex square root of a single-precision complex value.
+   * @param y Input complex value.
+   * @return Complex square root of y, with non-negative real part.
+   */
+  fc32_t amd_csqrtf (fc32_t y);
+
+  /**
+   * @brief Computes the magnitude of a double-precision complex value.
+   * @param x Input complex value.
+   * @return Magnitude |x|, without undue overflow or underflow.
+   */
+  double amd_cabs (fc64_t x);
+  /**
+   * @brief Computes the magnitude of a single-precision complex value.
+   * @param y Input complex value.
+   * @return Magnitude |y|, without undue overflow or underflow.
+   */
+  float amd_cabsf (fc32_t y);
+
+  /**
+   * @brief Computes the argument of a double-precision complex value.
+   * @param x Input complex value.
+   * @return Argument of x in [-pi, pi].
+   */
+  double amd_carg (fc64_t x);
+  /**
+   * @brief Computes the argument of a single-precision complex value.
+   * @param y Input complex value.
+   * @return Argument of y in [-pi, pi].
+   */
+  float amd_cargf (fc32_t y);
+
+  /**
+   * @brief Computes the complex sine of a double-precision complex value.
+   * @param x Input complex value.
+   * @return Complex sine of x.
+   */
+  fc64_t amd_csin (fc64_t x);
+  /**
+   * @brief Computes the complex sine of a single-precision complex value.
+   * @param y Input complex value.
+   * @return Complex sine of y.
+   */
+  fc32_t amd_csinf (fc32_t y);
+
+  /**
+   * @brief Computes the complex cosine of a double-precision complex value.
+   * @param x Input complex value.
+   * @return Complex cosine of x.
+   */
+  fc64_t amd_ccos (fc64_t x);
+  /**
+   * @brief Computes the complex cosine of a single-precision complex value.
+   * @param y Input complex value.
+   * @return Complex cosine of y.
+   */
+  fc32_t amd_ccosf (fc32_t y);
+
+  /**
+   * @brief Computes the complex tangent of a double-precision complex value.
+   * @param x Input complex value.
+   * @return Complex tangent of x.
+   */
+  fc64_t amd_ctan (fc64_t x);
+  /**
+   * @brief Computes the complex tangent of a single-precision complex value.
+   * @param y Input complex value.
+   * @return Complex tangent of y.
+   */
+  fc32_t amd_ctanf (fc32_t y);
+
+  /**
+   * @brief Computes the complex hyperbolic sine of a double-precision complex value.
+   * @param x Input complex value.
+   * @return Complex hyperbolic sine of x.
+   */
+  fc64_t amd_csinh (fc64_t x);
+  /**
+   * @brief Computes the complex hyperbolic sine of a single-precision complex value.
+   * @param y Input complex value.
+   * @return Complex hyperbolic sine of y.
+   */
+  fc32_t amd_csinhf (fc32_t y);
+
+  /**
+   * @brief Computes the complex hyperbolic cosine of a double-precision complex value.
+   * @param x Input complex value.
+   * @return Complex hyperbolic cosine of x.
+   */
+  fc64_t amd_ccosh (fc64_t x);
+  /**
+   * @brief Computes the complex hyperbolic cosine of a single-precision complex value.
+   * @param y Input complex value.
+   * @return Complex hyperbolic cosine of y.
+   */
+  fc32_t amd_ccoshf (fc32_t y);
+
+  /**
+   * @brief Computes the complex hyperbolic tangent of a double-precision complex value.
+   * @param x Input complex value.
+   * @return Complex hyperbolic tangent of x.
+   */
+  fc64_t amd_ctanh (fc64_t x);
+  /**
+   * @brief Computes the complex hyperbolic tangent of a single-precision complex value.
+   * @param y Input complex value.
+   * @return Complex hyperbolic tangent of y.
+   */
+  fc32_t amd_ctanhf (fc32_t y);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1222,6 +1363,8 @@ extern "C" {
 /* Inverse Error */
   #undef erfinv
   #define erfinv amd_erfinv
+  #undef erfinvf
+  #define erfinvf amd_erfinvf
 
 /* Complementary Error */
   #undef erfc
@@ -1232,13 +1375,19 @@ extern "C" {
 /* Inverse Complementary Error */
   #undef erfcinv
   #define erfcinv amd_erfcinv
+  #undef erfcinvf
+  #define erfcinvf amd_erfcinvf
   
 /* Special */
   #undef cdfnorm
   #define cdfnorm amd_cdfnorm
+  #undef cdfnormf
+  #define cdfnormf amd_cdfnormf
 
   #undef cdfnorminv
   #define cdfnorminv amd_cdfnorminv
+  #undef cdfnorminvf
+  #define cdfnorminvf amd_cdfnorminvf
 
 /* Remainder */
   #undef fmod
@@ -1420,6 +1569,42 @@ extern "C" {
   #define cexp amd_cexp
   #undef cexpf
   #define cexpf amd_cexpf
+  #undef csqrt
+  #define csqrt amd_csqrt
+  #undef csqrtf
+  #define csqrtf amd_csqrtf
+  #undef cabs
+  #define cabs amd_cabs
+  #undef cabsf
+  #define cabsf amd_cabsf
+  #undef carg
+  #define carg amd_carg
+  #undef cargf
+  #define cargf amd_cargf
+  #undef csin
+  #define csin amd_csin
+  #undef csinf
+  #define csinf amd_csinf
+  #undef ccos
+  #define ccos amd_ccos
+  #undef ccosf
+  #define ccosf amd_ccosf
+  #undef ctan
+  #define ctan amd_ctan
+  #undef ctanf
+  #define ctanf amd_ctanf
+  #undef csinh
+  #define csinh amd_csinh
+  #undef csinhf
+  #define csinhf amd_csinhf
+  #undef ccosh
+  #define ccosh amd_ccosh
+  #undef ccoshf
+  #define ccoshf amd_ccoshf
+  #undef ctanh
+  #define ctanh amd_ctanh
+  #undef ctanhf
+  #define ctanhf amd_ctanhf
 
 #endif /* REPLACE_WITH_AMDLIBM */
 
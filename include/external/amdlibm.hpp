@@ -0,0 +1,797 @@
+/*
+(C) 2008-2026 Advanced Micro Devices, Inc. All Rights Reserved.
+
+Advanced Micro Devices, Inc.
+Software License Agreement
+
+IMPORTANT-READ CAREFULLY:  Do not load or use the Software until you have
+carefully read and agreed to the following terms and conditions.  This is a
+legal agreement ("Agreement") between you (either an individual or an entity)
+("Licensee") and Advanced Micro Devices, Inc. ("AMD"). If Licensee does not
+agree to the terms of this Agreement, do not install or use this software or
+any portion thereof.  By loading or using the object code version only of the
+software obtained herewith, which may include associated install scripts and
+online or electronic documentation or any portion thereof, that is made
+available by AMD to download from any media ("Software"), Licensee agrees to
+all of the terms of this Agreement.
+
+1.  LICENSE:
+
+    a.  Subject to the terms and conditions of this Agreement, AMD grants
+    Licensee the following non-exclusive, non-transferable, royalty-free,
+    limited copyright license to download, copy, use, distribute and sublicense
+    the foregoing rights through multiple tiers of sublicenses the object code
+    version of the Software and materials associated with this Agreement,
+    including without limitation printed documentation, (collectively,
+    "Materials"), provided that Licensee agrees to include all copyright
+    legends and other legal notices that may appear in the Materials.  The
+    foregoing license is conditioned upon Licensee distributing the object code
+    version of the Software only and under this software license agreement.
+    Except for the limited license granted herein, Licensee shall have no other
+    rights in the Materials, whether express, implied, arising by estoppel or
+    otherwise.
+
+    b.  Except as expressly set forth in Section 1(a), Licensee does not have
+    the right to (i) distribute, rent, lease, sell, sublicense, assign, or
+    otherwise transfer the Materials, in whole or in part, to third parties for
+    commercial or for non-commercial use; or (ii) modify, disassemble, reverse
+    engineer, or decompile the Software, or otherwise reduce any part of the
+    Software to any human readable form.  All rights in and to the Materials
+    not expressly granted to Licensee in this Agreement are reserved to AMD.
+
+2.  FEEDBACK:  Licensee may provide AMD feedback, suggestions or opinions as to
+the Software, its features, and desired enhancements or changes.  If Licensee
+provides feedback, suggestions or opinions to AMD regarding any new features,
+use, functionality, or change to the Software or any materials related to the
+Software, Licensee hereby agrees to grant, and does grant, AMD all rights
+needed for AMD to incorporate, modify, distribute, use and commercialize any
+new feature, use, functionality, or change at no charge or encumbrance to AMD.
+Licensee agrees that AMD may disclose such feedback, suggestions or opinions to
+any third party in any manner, and Licensee agrees that AMD has the ability to
+sublicense any of the foregoing rights in any feedback, suggestions or opinions
+or AMD products or services in any form to any third party without restriction.
+
+3.  OWNERSHIP AND COPYRIGHT OF MATERIALS: Licensee agrees that the Materials
+are owned by AMD and are protected by United States and foreign intellectual
+property laws (e.g. patent and copyright laws) and international treaty
+provisions.  Licensee will not remove the copyright notice from the Materials.
+Licensee agrees to prevent any unauthorized copying of the Materials.  All
+title and copyrights in and to the Materials, all copies thereof (in whole or
+in part, and in any form), and all rights therein shall remain vested in AMD.
+Except as expressly provided herein, AMD does not grant any express or implied
+right to Licensee under AMD patents, copyrights, trademarks, or trade secret
+information.
+
+4.  WARRANTY DISCLAIMER: THE MATERIALS ARE PROVIDED "AS IS" WITHOUT ANY EXPRESS
+OR IMPLIED WARRANTY OF ANY KIND INCLUDING WARRANTIES OF MERCHANTABILITY,
+NONINFRINGEMENT OF THIRD-PARTY INTELLECTUAL PROPERTY, TITLE, OR FITNESS FOR ANY
+PARTICULAR PURPOSE, OR THOSE ARISING FROM CUSTOM OF TRADE OR COURSE OF USAGE.
+THE ENTIRE RISK ARISING OUT OF USE OR PERFORMANCE OF THE MATERIALS REMAINS WITH
+LICENSEE.  AMD DOES NOT WARRANT, GUARANTEE, OR MAKE ANY REPRESENTATIONS AS TO
+THE CORRECTNESS, ACCURACY, COMPLETENESS, QUALITY, OR RELIABILITY OF THE
+MATERIALS.
+
+AMD DOES NOT WARRANT THAT OPERATION OF THE MATERIALS WILL BE UNINTERRUPTED OR
+ERROR-FREE.  YOU ARE RESPONSIBLE FOR DETERMINING THE APPROPRIATENESS OF USING
+THE SOFTWARE AND ASSUME ALL RISKS ASSOCIATED WITH THE USE OF THE MATERIALS,
+INCLUDING BUT NOT LIMITED TO THE RISKS OF PROGRAM ERRORS, DAMAGE TO OR LOSS OF
+DATA, PROGRAMS OR EQUIPMENT, AND UNAVAILABILITY OR INTERRUPTION OF OPERATIONS.
+SOME JURISDICTIONS DO NOT ALLOW FOR THE EXCLUSION OR LIMITATION OF IMPLIED
+WARRANTIES, SO THE ABOVE LIMITATIONS OR EXCLUSIONS MAY NOT APPLY TO LICENSEE.
+
+5.  LIMITATION OF LIABILITY:  IN NO EVENT SHALL AMD OR ITS DIRECTORS, OFFICERS,
+EMPLOYEES AND AGENTS, ITS SUPPLIERS OR ITS LICENSORS BE LIABLE TO LICENSEE OR
+ANY THIRD PARTIES IN RECEIPT OF THE MATERIALS FOR CONSEQUENTIAL, INCIDENTAL,
+PUNITIVE OR SPECIAL DAMAGES, INCLUDING, BUT NOT LIMITED TO LOSS OF PROFITS,
+BUSINESS INTERRUPTION, OR LOSS OF INFORMATION ARISING OUT OF THE USE OF OR
+INABILITY TO USE THE MATERIALS, EVEN IF AMD HAS BEEN ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGES.  AMD DOES NOT ASSUME ANY RESPONSIBILITY TO SUPPORT OR UPDATE
+THE MATERIALS.  BY USING THE MATERIALS WITHOUT CHARGE, YOU ACCEPT THIS
+ALLOCATION OF RISK.  BECAUSE SOME JURSIDICTIONS PROHIBIT THE EXCLUSION OR
+LIMITATION OF LIABILITY FOR CONSEQUENTIAL OR INCIDENTAL DAMAGES, THE ABOVE
+LIMITATION MAY NOT APPLY TO LICENSEE.
+
+6.  U.S. GOVERNMENT RESTRICTED RIGHTS: The Materials are provided with
+"RESTRICTED RIGHTS."  Use, duplication or disclosure by the Government is
+subject to restrictions as set forth in FAR52.227-14 and DFAR252.227-7013, et
+seq., or its successor.  Use of the Materials by the Government constitutes
+acknowledgment of AMD's proprietary rights in them.
+
+7.  TERMINATION OF LICENSE: This Agreement will terminate immediately without
+notice from AMD or judicial resolution if Licensee fails to comply with any
+provisions of this Agreement.  Upon termination of this Agreement, Licensee
+must delete or destroy all copies of the Materials.
+
+8.  SUPPORT.  Under this Agreement, AMD is under no obligation to assist in the
+use of the Materials, to provide support to licensees of the Materials, or to
+provide maintenance, correction, modification, enhancement, or upgrades to the
+Materials.  If AMD determines, in its sole discretion, to support, maintain,
+correct, modify, enhance, or upgrade the Software, such support, maintenance,
+correction, modification, enhancement or upgrade shall be considered part of
+the Materials, and shall be subject to this Agreement.
+
+9.  SURVIVAL:  Sections 1(b), 2, 3, 4, 5, 6, and 8 through 14 shall survive any
+expiration or termination of this Agreement.
+
+10. APPLICABLE LAWS:  Any claim arising under or relating to this Agreement
+shall be governed by and construed in accordance with the substantive laws of
+the State of California, without regard to principles of conflict of laws.
+Each party hereto submits to the jurisdiction of the state and federal courts
+of Santa Clara County and the Northern District of California for the purposes
+of all legal proceedings arising out of or relating to this Agreement or the
+subject matter hereof.  Each party waives any objection which it may have to
+contest such forum.
+
+11. IMPORT/EXPORT/RE-EXPORT/USE/RELEASE/TRANSFER RESTRICTIONS AND COMPLIANCE
+WITH LAWS:  Licensee is hereby provided notice, and agrees and acknowledges,
+that the Software, its source code, any accompanying media, material or
+information, and any product of the foregoing, may be subject to restrictions
+on use, release, transfer, importation, exportation and/or re- exportation
+under the laws and regulations of the United States or other countries
+("Applicable Laws"), which include but are not limited to U.S. export control
+laws such as the Export Administration Regulations and national security
+controls as defined thereunder, as well as State Department controls under the
+U.S. Munitions List.  Licensee further agrees that the Software, its source
+code, any accompanying media, material or information, and any product of the
+foregoing, will not be used, released, transferred, imported, exported and/or
+re-exported in any manner prohibited under Applicable Laws, including U.S.
+export control laws regarding specifically designated persons, countries and
+nationals of countries subject to national security controls as provided in
+License Exception TSR of the Export Administration Regulations and any
+successor regulations.
+
+12. SEVERABILITY:  Should any term of this Agreement be declared void or
+unenforceable by any court of competent jurisdiction, such declaration shall
+have no effect on the remaining terms hereof.
+
+13. NO WAIVER:  The failure of either party to enforce any rights granted
+hereunder or to take action against the other party in the event of any breach
+hereunder shall not be deemed a waiver by that party as to subsequent
+enforcement of rights or subsequent actions in the event of future breaches.
+
+14. ENTIRE AGREEMENT:  This Agreement constitutes the entire agreement between
+the parties and supersedes any prior or contemporaneous oral or written
+agreements with respect to the subject matter of this Agreement.
+*/
+
+
+/** @file amdlibm.hpp
+ *  @brief C++ interface to the AOCL-LibM array functions.
+ *
+ *  Span overloads of the vrda/vrsa array functions, taking the length
+ *  from the spans (std::span under C++20, alm::span otherwise), with
+ *  optional execution policies, and lazy expressions that are evaluated
+ *  in one fused pass by alm_expr_execute():
+ *
+ *    alm::exp(x, y);                                    y = exp(x)
+ *    alm::exp(std::execution::par, x, y);               on the library threads
+ *    alm::eval(3.0 * alm::exp(0.5 * alm::view(x) + 1.0), y);
+ *
+ *  The element type selects the binary64 (amd_vrda_*) or binary32
+ *  (amd_vrsa_*) functions; the library picks the vector width at run
+ *  time. Lengths are size_t: nothing is chunked by the caller.
+ *
+ *  Execution policies, when <execution> is included first: sequenced and
+ *  unsequenced calls run on the calling thread, parallel ones on the
+ *  threads set with alm_set_num_threads() or the executor of
+ *  alm_set_executor(). Without a policy a call behaves
+ *  like the C function, amd_vrda_<fn>i_64 and alm_expr_execute().
+ *
+ *  Mismatched lengths throw std::length_error, an expression that does
+ *  not fit in an alm_expr_t (ALM_EXPR_MAX_OPS steps, ALM_EXPR_MAX_DEPTH
+ *  values, ALM_EXPR_MAX_ARGS distinct arrays) std::invalid_argument.
+ *  Requires C++17.
+ */
+
+#ifndef __AMDLIBM_HPP__
+#define __AMDLIBM_HPP__
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#if __has_include(<version>)
+#include <version>
+#endif
+#if defined(__cpp_lib_span)
+#include <span>
+#endif
+
+/*
+ * The execution policy overloads are declared when <execution> is included
+ * before this header. It is not included here: with libstdc++ and oneTBB
+ * installed, including it makes the program depend on libtbb.
+ */
+#if defined(__cpp_lib_execution) && (defined(_GLIBCXX_EXECUTION) || \
+    defined(_LIBCPP_EXECUTION) || defined(_EXECUTION_))
+#define __ALM_HPP_POLICIES
+#endif
+
+#include "amdlibm_vec.h"
+
+namespace alm {
+
+/*
+ * Spans
+ */
+
+#if defined(__cpp_lib_span)
+
+template <typename T>
+using span = std::span<T>;
+
+#else
+
+/* the subset of std::span used here */
+template <typename T>
+class span {
+public:
+    typedef T element_type;
+
+    constexpr span() noexcept : p_(nullptr), n_(0) {}
+    constexpr span(T *p, std::size_t n) noexcept : p_(p), n_(n) {}
+
+    template <typename C, typename = typename std::enable_if<
+                  std::is_convertible<typename std::remove_pointer<decltype(
+                                          std::data(std::declval<C &>()))>::type (*)[],
+                                      T (*)[]>::value>::type>
+    constexpr span(C &c) : p_(std::data(c)), n_(std::size(c)) {}
+
+    template <typename U, typename = typename std::enable_if<
+                  std::is_convertible<U (*)[], T (*)[]>::value>::type>
+    constexpr span(const span<U> &s) noexcept : p_(s.data()), n_(s.size()) {}
+
+    constexpr T *data() const noexcept         { return p_; }
+    constexpr std::size_t size() const noexcept { return n_; }
+
+private:
+    T *p_;
+    std::size_t n_;
+};
+
+#endif
+
+namespace detail {
+
+inline void check_len(std::size_t n, std::size_t m)
+{
+    if (n != m)
+        throw std::length_error("alm: array lengths differ");
+}
+
+/*
+ * Runs f(start, count) over [0, n). Serial policies split the range in
+ * pieces shorter than twice the grain size, which the library never
+ * hands to other threads.
+ */
+template <typename Policy, typename F>
+inline void run(std::size_t n, F f)
+{
+    bool serial = false;
+#if defined(__ALM_HPP_POLICIES)
+    typedef typename std::decay<Policy>::type P;
+    serial = std::is_same<P, std::execution::sequenced_policy>::value;
+#if __cpp_lib_execution >= 201902L
+    serial = serial || std::is_same<P, std::execution::unsequenced_policy>::value;
+#endif
+#endif
+
+    if (!serial) {
+        f(std::size_t(0), n);
+        return;
+    }
+
+    std::size_t grain = alm_get_grain_size();
+    for (std::size_t i = 0; i < n; i += grain)
+        f(i, n - i < grain ? n - i : grain);
+}
+
+#if defined(__ALM_HPP_POLICIES)
+template <typename P>
+using if_policy = typename std::enable_if<
+    std::is_execution_policy<typename std::decay<P>::type>::value, int>::type;
+#endif
+
+} /* namespace detail */
+
+/*
+ * Array functions
+ *
+ * fn(x, y): y[i] = fn(x[i]); fn(a, b, y): y[i] = fn(a[i], b[i]).
+ * The output may be one of the inputs.
+ */
+
+#define __ALM_HPP_UNARY_T(fn, T, cfn)                                       \
+    inline void fn(span<const T> x, span<T> y)                              \
+    {                                                                       \
+        detail::check_len(x.size(), y.size());                              \
+        cfn(x.size(), x.data(), 1, y.data(), 1);                            \
+    }
+
+#define __ALM_HPP_BINARY_T(fn, T, cfn)                                      \
+    inline void fn(span<const T> a, span<const T> b, span<T> y)             \
+    {                                                                       \
+        detail::check_len(a.size(), y.size());                              \
+        detail::check_len(b.size(), y.size());                              \
+        cfn(y.size(), a.data(), 1, b.data(), 1, y.data(), 1);               \
+    }
+
+#if defined(__ALM_HPP_POLICIES)
+
+#define __ALM_HPP_UNARY_P(fn, T, cfn)                                       \
+    template <typename P, detail::if_policy<P> = 0>                         \
+    inline void fn(P &&, span<const T> x, span<T> y)                        \
+    {                                                                       \
+        detail::check_len(x.size(), y.size());                              \
+        detail::run<P>(x.size(), [&](std::size_t i, std::size_t n) {        \
+            cfn(n, x.data() + i, 1, y.data() + i, 1);                       \
+        });                                                                 \
+    }
+
+#define __ALM_HPP_BINARY_P(fn, T, cfn)                                      \
+    template <typename P, detail::if_policy<P> = 0>                         \
+    inline void fn(P &&, span<const T> a, span<const T> b, span<T> y)       \
+    {                                                                       \
+        detail::check_len(a.size(), y.size());                              \
+        detail::check_len(b.size(), y.size());                              \
+        detail::run<P>(y.size(), [&](std::size_t i, std::size_t n) {        \
+            cfn(n, a.data() + i, 1, b.data() + i, 1, y.data() + i, 1);      \
+        });                                                                 \
+    }
+
+#else
+
+#define __ALM_HPP_UNARY_P(fn, T, cfn)
+#define __ALM_HPP_BINARY_P(fn, T, cfn)
+
+#endif
+
+#define __ALM_HPP_UNARY(fn)                                                 \
+    __ALM_HPP_UNARY_T(fn, double, amd_vrda_##fn##i_64)                      \
+    __ALM_HPP_UNARY_T(fn, float, amd_vrsa_##fn##fi_64)                      \
+    __ALM_HPP_UNARY_P(fn, double, amd_vrda_##fn##i_64)                      \
+    __ALM_HPP_UNARY_P(fn, float, amd_vrsa_##fn##fi_64)
+
+#define __ALM_HPP_BINARY(fn)                                                \
+    __ALM_HPP_BINARY_T(fn, double, amd_vrda_##fn##i_64)                     \
+    __ALM_HPP_BINARY_T(fn, float, amd_vrsa_##fn##fi_64)                     \
+    __ALM_HPP_BINARY_P(fn, double, amd_vrda_##fn##i_64)                     \
+    __ALM_HPP_BINARY_P(fn, float, amd_vrsa_##fn##fi_64)
+
+__ALM_HPP_UNARY(sin)
+__ALM_HPP_UNARY(cos)
+__ALM_HPP_UNARY(tan)
+__ALM_HPP_UNARY(asin)
+__ALM_HPP_UNARY(acos)
+__ALM_HPP_UNARY(atan)
+__ALM_HPP_UNARY(cosh)
+__ALM_HPP_UNARY(exp)
+__ALM_HPP_UNARY(exp2)
+__ALM_HPP_UNARY(exp10)
+__ALM_HPP_UNARY(expm1)
+__ALM_HPP_UNARY(log)
+__ALM_HPP_UNARY(log2)
+__ALM_HPP_UNARY(log10)
+__ALM_HPP_UNARY(log1p)
+__ALM_HPP_UNARY(sqrt)
+__ALM_HPP_UNARY(cbrt)
+__ALM_HPP_UNARY(erf)
+__ALM_HPP_UNARY(erfc)
+__ALM_HPP_UNARY(fabs)
+__ALM_HPP_UNARY(round)
+
+__ALM_HPP_BINARY(pow)
+__ALM_HPP_BINARY(add)
+__ALM_HPP_BINARY(sub)
+__ALM_HPP_BINARY(mul)
+__ALM_HPP_BINARY(div)
+__ALM_HPP_BINARY(fmax)
+__ALM_HPP_BINARY(fmin)
+
+#undef __ALM_HPP_UNARY
+#undef __ALM_HPP_BINARY
+#undef __ALM_HPP_UNARY_T
+#undef __ALM_HPP_BINARY_T
+#undef __ALM_HPP_UNARY_P
+#undef __ALM_HPP_BINARY_P
+
+/* y[i] = pow(x[i], p) */
+inline void powx(span<const double> x, double p, span<double> y)
+{
+    detail::check_len(x.size(), y.size());
+    amd_vrda_powxi_64(x.size(), x.data(), 1, p, y.data(), 1);
+}
+
+inline void powx(span<const float> x, float p, span<float> y)
+{
+    detail::check_len(x.size(), y.size());
+    amd_vrsa_powxfi_64(x.size(), x.data(), 1, p, y.data(), 1);
+}
+
+/* s[i] = sin(x[i]), c[i] = cos(x[i]) */
+inline void sincos(span<const double> x, span<double> s, span<double> c)
+{
+    detail::check_len(x.size(), s.size());
+    detail::check_len(x.size(), c.size());
+    amd_vrda_sincosi_64(x.size(), x.data(), 1, s.data(), 1, c.data(), 1);
+}
+
+inline void sincos(span<const float> x, span<float> s, span<float> c)
+{
+    detail::check_len(x.size(), s.size());
+    detail::check_len(x.size(), c.size());
+    amd_vrsa_sincosfi_64(x.size(), x.data(), 1, s.data(), 1, c.data(), 1);
+}
+
+#if defined(__ALM_HPP_POLICIES)
+
+template <typename P, detail::if_policy<P> = 0>
+inline void powx(P &&, span<const double> x, double p, span<double> y)
+{
+    detail::check_len(x.size(), y.size());
+    detail::run<P>(x.size(), [&](std::size_t i, std::size_t n) {
+        amd_vrda_powxi_64(n, x.data() + i, 1, p, y.data() + i, 1);
+    });
+}
+
+template <typename P, detail::if_policy<P> = 0>
+inline void powx(P &&, span<const float> x, float p, span<float> y)
+{
+    detail::check_len(x.size(), y.size());
+    detail::run<P>(x.size(), [&](std::size_t i, std::size_t n) {
+        amd_vrsa_powxfi_64(n, x.data() + i, 1, p, y.data() + i, 1);
+    });
+}
+
+template <typename P, detail::if_policy<P> = 0>
+inline void sincos(P &&, span<const double> x, span<double> s, span<double> c)
+{
+    detail::check_len(x.size(), s.size());
+    detail::check_len(x.size(), c.size());
+    detail::run<P>(x.size(), [&](std::size_t i, std::size_t n) {
+        amd_vrda_sincosi_64(n, x.data() + i, 1, s.data() + i, 1, c.data() + i, 1);
+    });
+}
+
+template <typename P, detail::if_policy<P> = 0>
+inline void sincos(P &&, span<const float> x, span<float> s, span<float> c)
+{
+    detail::check_len(x.size(), s.size());
+    detail::check_len(x.size(), c.size());
+    detail::run<P>(x.size(), [&](std::size_t i, std::size_t n) {
+        amd_vrsa_sincosfi_64(n, x.data() + i, 1, s.data() + i, 1, c.data() + i, 1);
+    });
+}
+
+#endif /* __ALM_HPP_POLICIES */
+
+/*
+ * Lazy expressions
+ *
+ * view(x) makes an array an operand; arithmetic with other views and
+ * scalars and the functions below build an expression type without
+ * computing anything. eval(e, y) lowers it to an alm_expr_t (scalar add,
+ * sub and mul become affine steps, pow with a scalar exponent a powx
+ * step) and computes y in a single pass, block by block, so no
+ * intermediate array is written.
+ */
+
+namespace detail {
+
+/* alm_expr_t under construction, with the distinct arrays it reads */
+struct builder {
+    alm_expr_t  e;
+    const void *args[ALM_EXPR_MAX_ARGS];
+    int         nargs;
+    std::size_t len;
+    bool        err;
+
+    explicit builder(std::size_t n) : nargs(0), len(n), err(false)
+    {
+        alm_expr_init(&e);
+    }
+
+    void arg(const void *p, std::size_t n)
+    {
+        int i = 0;
+        if (n != len)
+            throw std::length_error("alm: array lengths differ");
+        while (i < nargs && args[i] != p)
+            i++;
+        if (i == ALM_EXPR_MAX_ARGS) {
+            err = true;
+            return;
+        }
+        if (i == nargs)
+            args[nargs++] = p;
+        step(alm_expr_arg(&e, i));
+    }
+
+    void step(int rc) { err = err || rc != 0; }
+};
+
+} /* namespace detail */
+
+/* base of every expression node E */
+template <typename E>
+struct expr {
+    const E &self() const { return static_cast<const E &>(*this); }
+};
+
+template <typename T>
+struct view_expr : expr<view_expr<T> > {
+    typedef T value_type;
+    const T    *p;
+    std::size_t n;
+
+    view_expr(const T *p_, std::size_t n_) : p(p_), n(n_) {}
+
+    int depth() const { return 1; }
+    void emit(detail::builder &b) const { b.arg(p, n); }
+};
+
+/* a * e + s */
+template <typename E>
+struct affine_expr : expr<affine_expr<E> > {
+    typedef typename E::value_type value_type;
+    E      e;
+    double a, s;
+
+    affine_expr(const E &e_, double a_, double s_) : e(e_), a(a_), s(s_) {}
+
+    int depth() const { return e.depth(); }
+    void emit(detail::builder &b) const
+    {
+        e.emit(b);
+        b.step(alm_expr_affine(&b.e, a, s));
+    }
+};
+
+/* pow(e, y) */
+template <typename E>
+struct powx_expr : expr<powx_expr<E> > {
+    typedef typename E::value_type value_type;
+    E      e;
+    double y;
+
+    powx_expr(const E &e_, double y_) : e(e_), y(y_) {}
+
+    int depth() const { return e.depth(); }
+    void emit(detail::builder &b) const
+    {
+        e.emit(b);
+        b.step(alm_expr_powx(&b.e, y));
+    }
+};
+
+template <typename E>
+struct unary_expr : expr<unary_expr<E> > {
+    typedef typename E::value_type value_type;
+    E             e;
+    alm_expr_op_t op;
+
+    unary_expr(const E &e_, alm_expr_op_t op_) : e(e_), op(op_) {}
+
+    int depth() const { return e.depth(); }
+    void emit(detail::builder &b) const
+    {
+        e.emit(b);
+        b.step(alm_expr_op(&b.e, op));
+    }
+};
+
+/*
+ * l op r. Operands of commutative operations are emitted deepest first,
+ * which keeps the value stack within ALM_EXPR_MAX_DEPTH for balanced
+ * trees.
+ */
+template <typename L, typename R>
+struct binary_expr : expr<binary_expr<L, R> > {
+    static_assert(std::is_same<typename L::value_type,
+                               typename R::value_type>::value,
+                  "alm: operands of different element types");
+    typedef typename L::value_type value_type;
+    L             l;
+    R             r;
+    alm_expr_op_t op;
+
+    binary_expr(const L &l_, const R &r_, alm_expr_op_t op_)
+        : l(l_), r(r_), op(op_) {}
+
+    bool swap() const
+    {
+        return (op == ALM_EXPR_ADD || op == ALM_EXPR_MUL ||
+                op == ALM_EXPR_FMAX || op == ALM_EXPR_FMIN) &&
+               r.depth() > l.depth();
+    }
+    int depth() const
+    {
+        int dl = l.depth(), dr = r.depth();
+        if (swap())
+            return dr;
+        return dl > dr + 1 ? dl : dr + 1;
+    }
+    void emit(detail::builder &b) const
+    {
+        if (swap()) {
+            r.emit(b);
+            l.emit(b);
+        } else {
+            l.emit(b);
+            r.emit(b);
+        }
+        b.step(alm_expr_op(&b.e, op));
+    }
+};
+
+/* s op e, the constant pushed first */
+template <typename E>
+struct lconst_expr : expr<lconst_expr<E> > {
+    typedef typename E::value_type value_type;
+    double        s;
+    E             e;
+    alm_expr_op_t op;
+
+    lconst_expr(double s_, const E &e_, alm_expr_op_t op_) : s(s_), e(e_), op(op_) {}
+
+    int depth() const { return e.depth() + 1; }
+    void emit(detail::builder &b) const
+    {
+        b.step(alm_expr_const(&b.e, s));
+        e.emit(b);
+        b.step(alm_expr_op(&b.e, op));
+    }
+};
+
+/* e op s */
+template <typename E>
+struct rconst_expr : expr<rconst_expr<E> > {
+    typedef typename E::value_type value_type;
+    E             e;
+    double        s;
+    alm_expr_op_t op;
+
+    rconst_expr(const E &e_, double s_, alm_expr_op_t op_) : e(e_), s(s_), op(op_) {}
+
+    int depth() const { return e.depth() > 1 ? e.depth() : 2; }
+    void emit(detail::builder &b) const
+    {
+        e.emit(b);
+        b.step(alm_expr_const(&b.e, s));
+        b.step(alm_expr_op(&b.e, op));
+    }
+};
+
+/* operand of an expression */
+inline view_expr<double> view(span<const double> x) { return view_expr<double>(x.data(), x.size()); }
+inline view_expr<float> view(span<const float> x)   { return view_expr<float>(x.data(), x.size()); }
+
+namespace detail {
+template <typename S>
+using if_scalar = typename std::enable_if<std::is_arithmetic<S>::value, int>::type;
+}
+
+template <typename L, typename R>
+inline binary_expr<L, R> operator+(const expr<L> &l, const expr<R> &r)
+{ return binary_expr<L, R>(l.self(), r.self(), ALM_EXPR_ADD); }
+template <typename L, typename R>
+inline binary_expr<L, R> operator-(const expr<L> &l, const expr<R> &r)
+{ return binary_expr<L, R>(l.self(), r.self(), ALM_EXPR_SUB); }
+template <typename L, typename R>
+inline binary_expr<L, R> operator*(const expr<L> &l, const expr<R> &r)
+{ return binary_expr<L, R>(l.self(), r.self(), ALM_EXPR_MUL); }
+template <typename L, typename R>
+inline binary_expr<L, R> operator/(const expr<L> &l, const expr<R> &r)
+{ return binary_expr<L, R>(l.self(), r.self(), ALM_EXPR_DIV); }
+
+template <typename E, typename S, detail::if_scalar<S> = 0>
+inline affine_expr<E> operator+(const expr<E> &e, S s) { return affine_expr<E>(e.self(), 1.0, (double)s); }
+template <typename E, typename S, detail::if_scalar<S> = 0>
+inline affine_expr<E> operator+(S s, const expr<E> &e) { return affine_expr<E>(e.self(), 1.0, (double)s); }
+template <typename E, typename S, detail::if_scalar<S> = 0>
+inline affine_expr<E> operator-(const expr<E> &e, S s) { return affine_expr<E>(e.self(), 1.0, -(double)s); }
+template <typename E, typename S, detail::if_scalar<S> = 0>
+inline affine_expr<E> operator-(S s, const expr<E> &e) { return affine_expr<E>(e.self(), -1.0, (double)s); }
+template <typename E, typename S, detail::if_scalar<S> = 0>
+inline affine_expr<E> operator*(const expr<E> &e, S s) { return affine_expr<E>(e.self(), (double)s, 0.0); }
+template <typename E, typename S, detail::if_scalar<S> = 0>
+inline affine_expr<E> operator*(S s, const expr<E> &e) { return affine_expr<E>(e.self(), (double)s, 0.0); }
+template <typename E, typename S, detail::if_scalar<S> = 0>
+inline rconst_expr<E> operator/(const expr<E> &e, S s) { return rconst_expr<E>(e.self(), (double)s, ALM_EXPR_DIV); }
+template <typename E, typename S, detail::if_scalar<S> = 0>
+inline lconst_expr<E> operator/(S s, const expr<E> &e) { return lconst_expr<E>((double)s, e.self(), ALM_EXPR_DIV); }
+template <typename E>
+inline affine_expr<E> operator-(const expr<E> &e) { return affine_expr<E>(e.self(), -1.0, 0.0); }
+
+template <typename L, typename R>
+inline binary_expr<L, R> pow(const expr<L> &l, const expr<R> &r)
+{ return binary_expr<L, R>(l.self(), r.self(), ALM_EXPR_POW); }
+template <typename E, typename S, detail::if_scalar<S> = 0>
+inline powx_expr<E> pow(const expr<E> &e, S y) { return powx_expr<E>(e.self(), (double)y); }
+template <typename E, typename S, detail::if_scalar<S> = 0>
+inline lconst_expr<E> pow(S x, const expr<E> &e) { return lconst_expr<E>((double)x, e.self(), ALM_EXPR_POW); }
+template <typename L, typename R>
+inline binary_expr<L, R> fmax(const expr<L> &l, const expr<R> &r)
+{ return binary_expr<L, R>(l.self(), r.self(), ALM_EXPR_FMAX); }
+template <typename L, typename R>
+inline binary_expr<L, R> fmin(const expr<L> &l, const expr<R> &r)
+{ return binary_expr<L, R>(l.self(), r.self(), ALM_EXPR_FMIN); }
+
+#define __ALM_HPP_EXPR_FN(fn, op)                                           \
+    template <typename E>                                                   \
+    inline unary_expr<E> fn(const expr<E> &e)                               \
+    { return unary_expr<E>(e.self(), op); }
+
+__ALM_HPP_EXPR_FN(exp, ALM_EXPR_EXP)
+__ALM_HPP_EXPR_FN(exp2, ALM_EXPR_EXP2)
+__ALM_HPP_EXPR_FN(expm1, ALM_EXPR_EXPM1)
+__ALM_HPP_EXPR_FN(log, ALM_EXPR_LOG)
+__ALM_HPP_EXPR_FN(log2, ALM_EXPR_LOG2)
+__ALM_HPP_EXPR_FN(log10, ALM_EXPR_LOG10)
+__ALM_HPP_EXPR_FN(log1p, ALM_EXPR_LOG1P)
+__ALM_HPP_EXPR_FN(sin, ALM_EXPR_SIN)
+__ALM_HPP_EXPR_FN(cos, ALM_EXPR_COS)
+__ALM_HPP_EXPR_FN(tan, ALM_EXPR_TAN)
+__ALM_HPP_EXPR_FN(atan, ALM_EXPR_ATAN)
+__ALM_HPP_EXPR_FN(cosh, ALM_EXPR_COSH)
+__ALM_HPP_EXPR_FN(sqrt, ALM_EXPR_SQRT)
+__ALM_HPP_EXPR_FN(cbrt, ALM_EXPR_CBRT)
+__ALM_HPP_EXPR_FN(erf, ALM_EXPR_ERF)
+__ALM_HPP_EXPR_FN(fabs, ALM_EXPR_FABS)
+
+#undef __ALM_HPP_EXPR_FN
+
+namespace detail {
+
+inline void execute(const alm_expr_t *e, std::size_t n, const double *const *args,
+                    double *y)
+{
+    alm_expr_execute(e, n, args, y);
+}
+
+inline void execute(const alm_expr_t *e, std::size_t n, const float *const *args,
+                    float *y)
+{
+    alm_expr_executef(e, n, args, y);
+}
+
+template <typename P, typename T, typename E>
+inline void eval(const expr<E> &x, span<T> y)
+{
+    builder b(y.size());
+
+    x.self().emit(b);
+    if (b.err || alm_expr_compile(&b.e) != 0)
+        throw std::invalid_argument("alm: expression does not fit in alm_expr_t");
+
+    run<P>(y.size(), [&](std::size_t i, std::size_t n) {
+        const T *args[ALM_EXPR_MAX_ARGS];
+        for (int k = 0; k < b.nargs; k++)
+            args[k] = static_cast<const T *>(b.args[k]) + i;
+        execute(&b.e, n, args, y.data() + i);
+    });
+}
+
+} /* namespace detail */
+
+/* y = x, in one pass; y may be one of the operands */
+template <typename E>
+inline void eval(const expr<E> &x, span<typename E::value_type> y)
+{
+    detail::eval<void>(x, y);
+}
+
+#if defined(__ALM_HPP_POLICIES)
+template <typename P, typename E, detail::if_policy<P> = 0>
+inline void eval(P &&, const expr<E> &x, span<typename E::value_type> y)
+{
+    detail::eval<P>(x, y);
+}
+#endif
+
+} /* namespace alm */
+
+#undef __ALM_HPP_POLICIES
+
+#endif /* __AMDLIBM_HPP__ */
@@ -0,0 +1,374 @@
+/*
+(C) 2008-2026 Advanced Micro Devices, Inc. All Rights Reserved.
+
+Advanced Micro Devices, Inc.
+Software License Agreement
+
+IMPORTANT-READ CAREFULLY:  Do not load or use the Software until you have
+carefully read and agreed to the following terms and conditions.  This is a
+legal agreement ("Agreement") between you (either an individual or an entity)
+("Licensee") and Advanced Micro Devices, Inc. ("AMD"). If Licensee does not
+agree to the terms of this Agreement, do not install or use this software or
+any portion thereof.  By loading or using the object code version only of the
+software obtained herewith, which may include associated install scripts and
+online or electronic documentation or any portion thereof, that is made
+available by AMD to download from any media ("Software"), Licensee agrees to
+all of the terms of this Agreement.
+
+1.  LICENSE:
+
+    a.  Subject to the terms and conditions of this Agreement, AMD grants
+    Licensee the following non-exclusive, non-transferable, royalty-free,
+    limited copyright license to download, copy, use, distribute and sublicense
+    the foregoing rights through multiple tiers of sublicenses the object code
+    version of the Software and materials associated with this Agreement,
+    including without limitation printed documentation, (collectively,
+    "Materials"), provided that Licensee agrees to include all copyright
+    legends and other legal notices that may appear in the Materials.  The
+    foregoing license is conditioned upon Licensee distributing the object code
+    version of the Software only and under this software license agreement.
+    Except for the limited license granted herein, Licensee shall have no other
+    rights in the Materials, whether express, implied, arising by estoppel or
+    otherwise.
+
+    b.  Except as expressly set forth in Section 1(a), Licensee does not have
+    the right to (i) distribute, rent, lease, sell, sublicense, assign, or
+    otherwise transfer the Materials, in whole or in part, to third parties for
+    commercial or for non-commercial use; or (ii) modify, disassemble, reverse
+    engineer, or decompile the Software, or otherwise reduce any part of the
+    Software to any human readable form.  All rights in and to the Materials
+    not expressly granted to Licensee in this Agreement are reserved to AMD.
+
+2.  FEEDBACK:  Licensee may provide AMD feedback, suggestions or opinions as to
+the Software, its features, and desired enhancements or changes.  If Licensee
+provides feedback, suggestions or opinions to AMD regarding any new features,
+use, functionality, or change to the Software or any materials related to the
+Software, Licensee hereby agrees to grant, and does grant, AMD all rights
+needed for AMD to incorporate, modify, distribute, use and commercialize any
+new feature, use, functionality, or change at no charge or encumbrance to AMD.
+Licensee agrees that AMD may disclose such feedback, suggestions or opinions to
+any third party in any manner, and Licensee agrees that AMD has the ability to
+sublicense any of the foregoing rights in any feedback, suggestions or opinions
+or AMD products or services in any form to any third party without restriction.
+
+3.  OWNERSHIP AND COPYRIGHT OF MATERIALS: Licensee agrees that the Materials
+are owned by AMD and are protected by United States and foreign intellectual
+property laws (e.g. patent and copyright laws) and international treaty
+provisions.  Licensee will not remove the copyright notice from the Materials.
+Licensee agrees to prevent any unauthorized copying of the Materials.  All
+title and copyrights in and to the Materials, all copies thereof (in whole or
+in part, and in any form), and all rights therein shall remain vested in AMD.
+Except as expressly provided herein, AMD does not grant any express or implied
+right to Licensee under AMD patents, copyrights, trademarks, or trade secret
+information.
+
+4.  WARRANTY DISCLAIMER: THE MATERIALS ARE PROVIDED "AS IS" WITHOUT ANY EXPRESS
+OR IMPLIED WARRANTY OF ANY KIND INCLUDING WARRANTIES OF MERCHANTABILITY,
+NONINFRINGEMENT OF THIRD-PARTY INTELLECTUAL PROPERTY, TITLE, OR FITNESS FOR ANY
+PARTICULAR PURPOSE, OR THOSE ARISING FROM CUSTOM OF TRADE OR COURSE OF USAGE.
+THE ENTIRE RISK ARISING OUT OF USE OR PERFORMANCE OF THE MATERIALS REMAINS WITH
+LICENSEE.  AMD DOES NOT WARRANT, GUARANTEE, OR MAKE ANY REPRESENTATIONS AS TO
+THE CORRECTNESS, ACCURACY, COMPLETENESS, QUALITY, OR RELIABILITY OF THE
+MATERIALS.
+
+AMD DOES NOT WARRANT THAT OPERATION OF THE MATERIALS WILL BE UNINTERRUPTED OR
+ERROR-FREE.  YOU ARE RESPONSIBLE FOR DETERMINING THE APPROPRIATENESS OF USING
+THE SOFTWARE AND ASSUME ALL RISKS ASSOCIATED WITH THE USE OF THE MATERIALS,
+INCLUDING BUT NOT LIMITED TO THE RISKS OF PROGRAM ERRORS, DAMAGE TO OR LOSS OF
+DATA, PROGRAMS OR EQUIPMENT, AND UNAVAILABILITY OR INTERRUPTION OF OPERATIONS.
+SOME JURISDICTIONS DO NOT ALLOW FOR THE EXCLUSION OR LIMITATION OF IMPLIED
+WARRANTIES, SO THE ABOVE LIMITATIONS OR EXCLUSIONS MAY NOT APPLY TO LICENSEE.
+
+5.  LIMITATION OF LIABILITY:  IN NO EVENT SHALL AMD OR ITS DIRECTORS, OFFICERS,
+EMPLOYEES AND AGENTS, ITS SUPPLIERS OR ITS LICENSORS BE LIABLE TO LICENSEE OR
+ANY THIRD PARTIES IN RECEIPT OF THE MATERIALS FOR CONSEQUENTIAL, INCIDENTAL,
+PUNITIVE OR SPECIAL DAMAGES, INCLUDING, BUT NOT LIMITED TO LOSS OF PROFITS,
+BUSINESS INTERRUPTION, OR LOSS OF INFORMATION ARISING OUT OF THE USE OF OR
+INABILITY TO USE THE MATERIALS, EVEN IF AMD HAS BEEN ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGES.  AMD DOES NOT ASSUME ANY RESPONSIBILITY TO SUPPORT OR UPDATE
+THE MATERIALS.  BY USING THE MATERIALS WITHOUT CHARGE, YOU ACCEPT THIS
+ALLOCATION OF RISK.  BECAUSE SOME JURSIDICTIONS PROHIBIT THE EXCLUSION OR
+LIMITATION OF LIABILITY FOR CONSEQUENTIAL OR INCIDENTAL DAMAGES, THE ABOVE
+LIMITATION MAY NOT APPLY TO LICENSEE.
+
+6.  U.S. GOVERNMENT RESTRICTED RIGHTS: The Materials are provided with
+"RESTRICTED RIGHTS."  Use, duplication or disclosure by the Government is
+subject to restrictions as set forth in FAR52.227-14 and DFAR252.227-7013, et
+seq., or its successor.  Use of the Materials by the Government constitutes
+acknowledgment of AMD's proprietary rights in them.
+
+7.  TERMINATION OF LICENSE: This Agreement will terminate immediately without
+notice from AMD or judicial resolution if Licensee fails to comply with any
+provisions of this Agreement.  Upon termination of this Agreement, Licensee
+must delete or destroy all copies of the Materials.
+
+8.  SUPPORT.  Under this Agreement, AMD is under no obligation to assist in the
+use of the Materials, to provide support to licensees of the Materials, or to
+provide maintenance, correction, modification, enhancement, or upgrades to the
+Materials.  If AMD determines, in its sole discretion, to support, maintain,
+correct, modify, enhance, or upgrade the Software, such support, maintenance,
+correction, modification, enhancement or upgrade shall be considered part of
+the Materials, and shall be subject to this Agreement.
+
+9.  SURVIVAL:  Sections 1(b), 2, 3, 4, 5, 6, and 8 through 14 shall survive any
+expiration or termination of this Agreement.
+
+10. APPLICABLE LAWS:  Any claim arising under or relating to this Agreement
+shall be governed by and construed in accordance with the substantive laws of
+the State of California, without regard to principles of conflict of laws.
+Each party hereto submits to the jurisdiction of the state and federal courts
+of Santa Clara County and the Northern District of California for the purposes
+of all legal proceedings arising out of or relating to this Agreement or the
+subject matter hereof.  Each party waives any objection which it may have to
+contest such forum.
+
+11. IMPORT/EXPORT/RE-EXPORT/USE/RELEASE/TRANSFER RESTRICTIONS AND COMPLIANCE
+WITH LAWS:  Licensee is hereby provided notice, and agrees and acknowledges,
+that the Software, its source code, any accompanying media, material or
+information, and any product of the foregoing, may be subject to restrictions
+on use, release, transfer, importation, exportation and/or re- exportation
+under the laws and regulations of the United States or other countries
+("Applicable Laws"), which include but are not limited to U.S. export control
+laws such as the Export Administration Regulations and national security
+controls as defined thereunder, as well as State Department controls under the
+U.S. Munitions List.  Licensee further agrees that the Software, its source
+code, any accompanying media, material or information, and any product of the
+foregoing, will not be used, released, transferred, imported, exported and/or
+re-exported in any manner prohibited under Applicable Laws, including U.S.
+export control laws regarding specifically designated persons, countries and
+nationals of countries subject to national security controls as provided in
+License Exception TSR of the Export Administration Regulations and any
+successor regulations.
+
+12. SEVERABILITY:  Should any term of this Agreement be declared void or
+unenforceable by any court of competent jurisdiction, such declaration shall
+have no effect on the remaining terms hereof.
+
+13. NO WAIVER:  The failure of either party to enforce any rights granted
+hereunder or to take action against the other party in the event of any breach
+hereunder shall not be deemed a waiver by that party as to subsequent
+enforcement of rights or subsequent actions in the event of future breaches.
+
+14. ENTIRE AGREEMENT:  This Agreement constitutes the entire agreement between
+the parties and supersedes any prior or contemporaneous oral or written
+agreements with respect to the subject matter of this Agreement.
+*/
+
+
+/** @file amdlibm_inline.hpp
+ *  @brief C++ templates over the header-only kernels of amdlibm_inline.h.
+ *
+ *  kernels<T, ISA> gathers the kernels of one element type and instruction
+ *  set, so that a loop can be written once and instantiated per width:
+ *
+ *    using K = amdlibm::inl::kernels<double, amdlibm::inl::avx512>;
+ *    for (i = 0; i + K::width <= n; i += K::width)
+ *        K::store(y + i, K::exp(K::load(x + i)) * a);
+ *
+ *  simd<T, W> selects the instruction set from the element count W, and
+ *  transform<ISA>() runs a callable over an array, the tail with masked
+ *  loads and stores. The free functions exp(), log(), pow(), sin(),
+ *  cos(), tanh() and erf() are overloaded on the vector types.
+ *
+ *  The kernels use hexadecimal floating constants: compile with C++17 or a
+ *  GNU dialect (-std=gnu++11 and later).
+ */
+
+#ifndef __AMDLIBM_INLINE_HPP__
+#define __AMDLIBM_INLINE_HPP__
+
+#include <cstddef>
+#include "amdlibm_inline.h"
+
+namespace amdlibm {
+namespace inl {
+
+/* instruction set tags */
+struct avx2 {};
+struct avx512 {};
+
+template <typename T, typename ISA> struct kernels;
+
+#define __AMD_INL_FUNCS                                                     \
+    static vec exp(vec x)          { return inl::exp(x); }                  \
+    static vec log(vec x)          { return inl::log(x); }                  \
+    static vec pow(vec x, vec y)   { return inl::pow(x, y); }               \
+    static vec sin(vec x)          { return inl::sin(x); }                  \
+    static vec cos(vec x)          { return inl::cos(x); }                  \
+    static vec tanh(vec x)         { return inl::tanh(x); }                 \
+    static vec erf(vec x)          { return inl::erf(x); }
+
+#define __AMD_INL_FREE(vec, d, s)                                           \
+    inline vec exp(vec x)          { return d##exp##s(x); }                 \
+    inline vec log(vec x)          { return d##log##s(x); }                 \
+    inline vec pow(vec x, vec y)   { return d##pow##s(x, y); }              \
+    inline vec sin(vec x)          { return d##sin##s(x); }                 \
+    inline vec cos(vec x)          { return d##cos##s(x); }                 \
+    inline vec tanh(vec x)         { return d##tanh##s(x); }                \
+    inline vec erf(vec x)          { return d##erf##s(x); }
+
+#if defined(__AVX2__) && defined(__FMA__)
+
+__AMD_INL_FREE(__m256d, amd_inl_vrd4_, )
+__AMD_INL_FREE(__m256, amd_inl_vrs8_, f)
+
+/*
+ * load_n/store_n touch the first n < width elements only, the other
+ * lanes are loaded as 1.0, a valid argument of every kernel.
+ */
+template <> struct kernels<double, avx2> {
+    typedef __m256d vec;
+    static constexpr int width = 4;
+
+    static __m256i mask(int n)
+    {
+        return _mm256_cmpgt_epi64(_mm256_set1_epi64x(n),
+                                  _mm256_setr_epi64x(0, 1, 2, 3));
+    }
+    static vec load(const double *p)       { return _mm256_loadu_pd(p); }
+    static void store(double *p, vec v)    { _mm256_storeu_pd(p, v); }
+    static vec load_n(const double *p, int n)
+    {
+        __m256i m = mask(n);
+        return _mm256_blendv_pd(_mm256_set1_pd(1.0), _mm256_maskload_pd(p, m),
+                                _mm256_castsi256_pd(m));
+    }
+    static void store_n(double *p, vec v, int n)
+    {
+        _mm256_maskstore_pd(p, mask(n), v);
+    }
+
+    __AMD_INL_FUNCS
+};
+
+template <> struct kernels<float, avx2> {
+    typedef __m256 vec;
+    static constexpr int width = 8;
+
+    static __m256i mask(int n)
+    {
+        return _mm256_cmpgt_epi32(_mm256_set1_epi32(n),
+                                  _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+    }
+    static vec load(const float *p)        { return _mm256_loadu_ps(p); }
+    static void store(float *p, vec v)     { _mm256_storeu_ps(p, v); }
+    static vec load_n(const float *p, int n)
+    {
+        __m256i m = mask(n);
+        return _mm256_blendv_ps(_mm256_set1_ps(1.0f), _mm256_maskload_ps(p, m),
+                                _mm256_castsi256_ps(m));
+    }
+    static void store_n(float *p, vec v, int n)
+    {
+        _mm256_maskstore_ps(p, mask(n), v);
+    }
+
+    __AMD_INL_FUNCS
+};
+
+#endif /* __AVX2__ && __FMA__ */
+
+#if defined(__AVX512F__)
+
+__AMD_INL_FREE(__m512d, amd_inl_vrd8_, )
+__AMD_INL_FREE(__m512, amd_inl_vrs16_, f)
+
+template <> struct kernels<double, avx512> {
+    typedef __m512d vec;
+    static constexpr int width = 8;
+
+    static __mmask8 mask(int n)           { return (__mmask8)((1u << n) - 1); }
+    static vec load(const double *p)       { return _mm512_loadu_pd(p); }
+    static void store(double *p, vec v)    { _mm512_storeu_pd(p, v); }
+    static vec load_n(const double *p, int n)
+    {
+        return _mm512_mask_loadu_pd(_mm512_set1_pd(1.0), mask(n), p);
+    }
+    static void store_n(double *p, vec v, int n)
+    {
+        _mm512_mask_storeu_pd(p, mask(n), v);
+    }
+
+    __AMD_INL_FUNCS
+};
+
+template <> struct kernels<float, avx512> {
+    typedef __m512 vec;
+    static constexpr int width = 16;
+
+    static __mmask16 mask(int n)          { return (__mmask16)((1u << n) - 1); }
+    static vec load(const float *p)        { return _mm512_loadu_ps(p); }
+    static void store(float *p, vec v)     { _mm512_storeu_ps(p, v); }
+    static vec load_n(const float *p, int n)
+    {
+        return _mm512_mask_loadu_ps(_mm512_set1_ps(1.0f), mask(n), p);
+    }
+    static void store_n(float *p, vec v, int n)
+    {
+        _mm512_mask_storeu_ps(p, mask(n), v);
+    }
+
+    __AMD_INL_FUNCS
+};
+
+#endif /* __AVX512F__ */
+
+#undef __AMD_INL_FUNCS
+#undef __AMD_INL_FREE
+
+/* instruction set of a vector of W elements of type T: 256 or 512 bits */
+template <typename T, int W> struct isa_for;
+template <> struct isa_for<double, 4>  { typedef avx2 type; };
+template <> struct isa_for<float, 8>   { typedef avx2 type; };
+template <> struct isa_for<double, 8>  { typedef avx512 type; };
+template <> struct isa_for<float, 16>  { typedef avx512 type; };
+
+template <typename T, int W>
+using simd = kernels<T, typename isa_for<T, W>::type>;
+
+/* widest instruction set enabled at compile time */
+#if defined(__AVX512F__)
+typedef avx512 native;
+#elif defined(__AVX2__) && defined(__FMA__)
+typedef avx2 native;
+#endif
+
+/**
+ * y[i] = f(x[i]) for i < n, f taking and returning kernels<T, ISA>::vec.
+ * x and y may be the same array.
+ */
+template <typename ISA, typename T, typename F>
+inline void transform(std::size_t n, const T *x, T *y, F f)
+{
+    typedef kernels<T, ISA> K;
+    std::size_t i = 0;
+
+    for (; i + K::width <= n; i += K::width)
+        K::store(y + i, f(K::load(x + i)));
+
+    if (i < n)
+        K::store_n(y + i, f(K::load_n(x + i, (int)(n - i))), (int)(n - i));
+}
+
+/**
+ * z[i] = f(x[i], y[i]) for i < n.
+ */
+template <typename ISA, typename T, typename F>
+inline void transform(std::size_t n, const T *x, const T *y, T *z, F f)
+{
+    typedef kernels<T, ISA> K;
+    std::size_t i = 0;
+
+    for (; i + K::width <= n; i += K::width)
+        K::store(z + i, f(K::load(x + i), K::load(y + i)));
+
+    if (i < n) {
+        int r = (int)(n - i);
+        K::store_n(z + i, f(K::load_n(x + i, r), K::load_n(y + i, r)), r);
+    }
+}
+
+} /* namespace inl */
+} /* namespace amdlibm */
+
+#endif /* __AMDLIBM_INLINE_HPP__ */
@@ -0,0 +1,881 @@
+/*
+(C) 2008-2026 Advanced Micro Devices, Inc. All Rights Reserved.
+
+Advanced Micro Devices, Inc.
+Software License Agreement
+
+IMPORTANT-READ CAREFULLY:  Do not load or use the Software until you have
+carefully read and agreed to the following terms and conditions.  This is a
+legal agreement ("Agreement") between you (either an individual or an entity)
+("Licensee") and Advanced Micro Devices, Inc. ("AMD"). If Licensee does not
+agree to the terms of this Agreement, do not install or use this software or
+any portion thereof.  By loading or using the object code version only of the
+software obtained herewith, which may include associated install scripts and
+online or electronic documentation or any portion thereof, that is made
+available by AMD to download from any media ("Software"), Licensee agrees to
+all of the terms of this Agreement.
+
+1.  LICENSE:
+
+    a.  Subject to the terms and conditions of this Agreement, AMD grants
+    Licensee the following non-exclusive, non-transferable, royalty-free,
+    limited copyright license to download, copy, use, distribute and sublicense
+    the foregoing rights through multiple tiers of sublicenses the object code
+    version of the Software and materials associated with this Agreement,
+    including without limitation printed documentation, (collectively,
+    "Materials"), provided that Licensee agrees to include all copyright
+    legends and other legal notices that may appear in the Materials.  The
+    foregoing license is conditioned upon Licensee distributing the object code
+    version of the Software only and under this software license agreement.
+    Except for the limited license granted herein, Licensee shall have no other
+    rights in the Materials, whether express, implied, arising by estoppel or
+    otherwise.
+
+    b.  Except as expressly set forth in Section 1(a), Licensee does not have
+    the right to (i) distribute, rent, lease, sell, sublicense, assign, or
+    otherwise transfer the Materials, in whole or in part, to third parties for
+    commercial or for non-commercial use; or (ii) modify, disassemble, reverse
+    engineer, or decompile the Software, or otherwise reduce any part of the
+    Software to any human readable form.  All rights in and to the Materials
+    not expressly granted to Licensee in this Agreement are reserved to AMD.
+
+2.  FEEDBACK:  Licensee may provide AMD feedback, suggestions or opinions as to
+the Software, its features, and desired enhancements or changes.  If Licensee
+provides feedback, suggestions or opinions to AMD regarding any new features,
+use, functionality, or change to the Software or any materials related to the
+Software, Licensee hereby agrees to grant, and does grant, AMD all rights
+needed for AMD to incorporate, modify, distribute, use and commercialize any
+new feature, use, functionality, or change at no charge or encumbrance to AMD.
+Licensee agrees that AMD may disclose such feedback, suggestions or opinions to
+any third party in any manner, and Licensee agrees that AMD has the ability to
+sublicense any of the foregoing rights in any feedback, suggestions or opinions
+or AMD products or services in any form to any third party without restriction.
+
+3.  OWNERSHIP AND COPYRIGHT OF MATERIALS: Licensee agrees that the Materials
+are owned by AMD and are protected by United States and foreign intellectual
+property laws (e.g. patent and copyright laws) and international treaty
+provisions.  Licensee will not remove the copyright notice from the Materials.
+Licensee agrees to prevent any unauthorized copying of the Materials.  All
+title and copyrights in and to the Materials, all copies thereof (in whole or
+in part, and in any form), and all rights therein shall remain vested in AMD.
+Except as expressly provided herein, AMD does not grant any express or implied
+right to Licensee under AMD patents, copyrights, trademarks, or trade secret
+information.
+
+4.  WARRANTY DISCLAIMER: THE MATERIALS ARE PROVIDED "AS IS" WITHOUT ANY EXPRESS
+OR IMPLIED WARRANTY OF ANY KIND INCLUDING WARRANTIES OF MERCHANTABILITY,
+NONINFRINGEMENT OF THIRD-PARTY INTELLECTUAL PROPERTY, TITLE, OR FITNESS FOR ANY
+PARTICULAR PURPOSE, OR THOSE ARISING FROM CUSTOM OF TRADE OR COURSE OF USAGE.
+THE ENTIRE RISK ARISING OUT OF USE OR PERFORMANCE OF THE MATERIALS REMAINS WITH
+LICENSEE.  AMD DOES NOT WARRANT, GUARANTEE, OR MAKE ANY REPRESENTATIONS AS TO
+THE CORRECTNESS, ACCURACY, COMPLETENESS, QUALITY, OR RELIABILITY OF THE
+MATERIALS.
+
+AMD DOES NOT WARRANT THAT OPERATION OF THE MATERIALS WILL BE UNINTERRUPTED OR
+ERROR-FREE.  YOU ARE RESPONSIBLE FOR DETERMINING THE APPROPRIATENESS OF USING
+THE SOFTWARE AND ASSUME ALL RISKS ASSOCIATED WITH THE USE OF THE MATERIALS,
+INCLUDING BUT NOT LIMITED TO THE RISKS OF PROGRAM ERRORS, DAMAGE TO OR LOSS OF
+DATA, PROGRAMS OR EQUIPMENT, AND UNAVAILABILITY OR INTERRUPTION OF OPERATIONS.
+SOME JURISDICTIONS DO NOT ALLOW FOR THE EXCLUSION OR LIMITATION OF IMPLIED
+WARRANTIES, SO THE ABOVE LIMITATIONS OR EXCLUSIONS MAY NOT APPLY TO LICENSEE.
+
+5.  LIMITATION OF LIABILITY:  IN NO EVENT SHALL AMD OR ITS DIRECTORS, OFFICERS,
+EMPLOYEES AND AGENTS, ITS SUPPLIERS OR ITS LICENSORS BE LIABLE TO LICENSEE OR
+ANY THIRD PARTIES IN RECEIPT OF THE MATERIALS FOR CONSEQUENTIAL, INCIDENTAL,
+PUNITIVE OR SPECIAL DAMAGES, INCLUDING, BUT NOT LIMITED TO LOSS OF PROFITS,
+BUSINESS INTERRUPTION, OR LOSS OF INFORMATION ARISING OUT OF THE USE OF OR
+INABILITY TO USE THE MATERIALS, EVEN IF AMD HAS BEEN ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGES.  AMD DOES NOT ASSUME ANY RESPONSIBILITY TO SUPPORT OR UPDATE
+THE MATERIALS.  BY USING THE MATERIALS WITHOUT CHARGE, YOU ACCEPT THIS
+ALLOCATION OF RISK.  BECAUSE SOME JURSIDICTIONS PROHIBIT THE EXCLUSION OR
+LIMITATION OF LIABILITY FOR CONSEQUENTIAL OR INCIDENTAL DAMAGES, THE ABOVE
+LIMITATION MAY NOT APPLY TO LICENSEE.
+
+6.  U.S. GOVERNMENT RESTRICTED RIGHTS: The Materials are provided with
+"RESTRICTED RIGHTS."  Use, duplication or disclosure by the Government is
+subject to restrictions as set forth in FAR52.227-14 and DFAR252.227-7013, et
+seq., or its successor.  Use of the Materials by the Government constitutes
+acknowledgment of AMD's proprietary rights in them.
+
+7.  TERMINATION OF LICENSE: This Agreement will terminate immediately without
+notice from AMD or judicial resolution if Licensee fails to comply with any
+provisions of this Agreement.  Upon termination of this Agreement, Licensee
+must delete or destroy all copies of the Materials.
+
+8.  SUPPORT.  Under this Agreement, AMD is under no obligation to assist in the
+use of the Materials, to provide support to licensees of the Materials, or to
+provide maintenance, correction, modification, enhancement, or upgrades to the
+Materials.  If AMD determines, in its sole discretion, to support, maintain,
+correct, modify, enhance, or upgrade the Software, such support, maintenance,
+correction, modification, enhancement or upgrade shall be considered part of
+the Materials, and shall be subject to this Agreement.
+
+9.  SURVIVAL:  Sections 1(b), 2, 3, 4, 5, 6, and 8 through 14 shall survive any
+expiration or termination of this Agreement.
+
+10. APPLICABLE LAWS:  Any claim arising under or relating to this Agreement
+shall be governed by and construed in accordance with the substantive laws of
+the State of California, without regard to principles of conflict of laws.
+Each party hereto submits to the jurisdiction of the state and federal courts
+of Santa Clara County and the Northern District of California for the purposes
+of all legal proceedings arising out of or relating to this Agreement or the
+subject matter hereof.  Each party waives any objection which it may have to
+contest such forum.
+
+11. IMPORT/EXPORT/RE-EXPORT/USE/RELEASE/TRANSFER RESTRICTIONS AND COMPLIANCE
+WITH LAWS:  Licensee is hereby provided notice, and agrees and acknowledges,
+that the Software, its source code, any accompanying media, material or
+information, and any product of the foregoing, may be subject to restrictions
+on use, release, transfer, importation, exportation and/or re- exportation
+under the laws and regulations of the United States or other countries
+("Applicable Laws"), which include but are not limited to U.S. export control
+laws such as the Export Administration Regulations and national security
+controls as defined thereunder, as well as State Department controls under the
+U.S. Munitions List.  Licensee further agrees that the Software, its source
+code, any accompanying media, material or information, and any product of the
+foregoing, will not be used, released, transferred, imported, exported and/or
+re-exported in any manner prohibited under Applicable Laws, including U.S.
+export control laws regarding specifically designated persons, countries and
+nationals of countries subject to national security controls as provided in
+License Exception TSR of the Export Administration Regulations and any
+successor regulations.
+
+12. SEVERABILITY:  Should any term of this Agreement be declared void or
+unenforceable by any court of competent jurisdiction, such declaration shall
+have no effect on the remaining terms hereof.
+
+13. NO WAIVER:  The failure of either party to enforce any rights granted
+hereunder or to take action against the other party in the event of any breach
+hereunder shall not be deemed a waiver by that party as to subsequent
+enforcement of rights or subsequent actions in the event of future breaches.
+
+14. ENTIRE AGREEMENT:  This Agreement constitutes the entire agreement between
+the parties and supersedes any prior or contemporaneous oral or written
+agreements with respect to the subject matter of this Agreement.
+*/
+
+
+/** @file amdlibm_inline_kern.h
+ *  @brief Width-generic bodies of the header-only AOCL-LibM kernels.
+ *
+ *  Not to be included directly: amdlibm_inline.h includes it once per
+ *  vector width, after defining
+ *
+ *    ALM_INL_DOUBLE        for binary64
+ *    ALM_INL_VLEN          lanes: 4 or 8 (binary64), 8 or 16 (binary32)
+ *    ALM_INL_VF, _VI, _VU  the floating-point vector type and the signed
+ *                          and unsigned integer vectors of the same shape
+ *    ALM_INL_FN(fn)        public name of fn at this width
+ *    ALM_INL_HLP(fn)       name of the width-private helper fn
+ *    ALM_INL_SET1(c)       broadcast
+ *    ALM_INL_FMA(a, b, c)  fused a*b + c
+ *    ALM_INL_ANY(m)        nonzero if any lane of mask m is set
+ *    ALM_INL_RINT(x)       round to nearest integer (binary64)
+ *    ALM_INL_VD            binary64 vector of half the width, and
+ *    ALM_INL_LO/HI(x)      the low and high halves of x widened to it,
+ *    ALM_INL_JOIN(lo, hi)  and narrowed back into one vector (binary32)
+ *    ALM_INL_DFN(fn)       public binary64 fn at half the width (binary32)
+ *
+ *  The kernels are those of the library written with vector extensions,
+ *  so that the compiler sees through them: exp() and log() are the
+ *  table-free reductions of vrd4_exp/vrs8_expf and fdlibm log, sin() and
+ *  cos() those of vrd8_sin/vrd8_cos and vrs16_sinf/vrs16_cosf, erf() is
+ *  vrd8_erf and the whole-range polynomial of vrs16_erff, and tanh() the
+ *  rational approximations of tanh and vrs16_tanhf. Lanes that the
+ *  library hands to scalar code are blended in with selects instead,
+ *  except for the sin/cos arguments beyond the Cody-Waite range, which go
+ *  to the scalar sin()/cos() of <math.h>.
+ */
+
+#define __alm_t         ALM_INL_T
+#define __alm_vf        ALM_INL_VF
+#define __alm_vi        ALM_INL_VI
+#define __alm_vu        ALM_INL_VU
+#define __alm_c(c)      ((__alm_t)(c))
+
+#if defined(ALM_INL_DOUBLE)
+#define __ALM_MANT          52
+#define __ALM_BIAS          1023
+#define __ALM_ABS           INT64_C(0x7fffffffffffffff)
+/* 0x1.8p52: adding it rounds |x| < 2^51 to an integer in the low bits */
+#define __ALM_SHIFT         0x1.8p52
+#define __ALM_SHIFT_BITS    INT64_C(0x4338000000000000)
+/* bits of sqrt(2)/2, the bottom of the log() reduction interval */
+#define __ALM_SQRTH_BITS    INT64_C(0x3fe6a09e667f3bcd)
+#define __ALM_EXP_HI        710.0
+#define __ALM_EXP_LO        -760.0
+#define __ALM_MIN_NORMAL    0x1p-1022
+#define __ALM_MAX           0x1.fffffffffffffp+1023
+#define __ALM_SUB           0x1p54
+#define __ALM_SUB_K         54.0
+#else
+#define __ALM_MANT          23
+#define __ALM_BIAS          127
+#define __ALM_ABS           0x7fffffff
+#define __ALM_SHIFT         0x1.8p23f
+#define __ALM_SHIFT_BITS    0x4b400000
+#define __ALM_SQRTH_BITS    0x3f3504f3
+#define __ALM_EXP_HI        89.0f
+#define __ALM_EXP_LO        -110.0f
+#define __ALM_MIN_NORMAL    0x1p-126f
+#define __ALM_MAX           0x1.fffffep+127f
+#define __ALM_SUB           0x1p25f
+#define __ALM_SUB_K         25.0f
+#endif
+
+/* m ? a : b, bitwise */
+static inline __alm_vf
+ALM_INL_HLP(sel)(__alm_vi m, __alm_vf a, __alm_vf b)
+{
+    return (__alm_vf)(((__alm_vi)a & m) | ((__alm_vi)b & ~m));
+}
+
+static inline __alm_vf
+ALM_INL_HLP(abs)(__alm_vf x)
+{
+    return (__alm_vf)((__alm_vi)x & __ALM_ABS);
+}
+
+/*
+ * exp(x) = q * *scale, x = n*ln2 + r with ln2 split into head and tail
+ * and 2^r from the vrd4_exp degree 11 (binary64) or vrs8_expf degree 7
+ * (binary32) polynomial. 2^n is split into 2^(n/2) folded into q and the
+ * rest returned in *scale, so that q stays normal over the clamped range
+ * and a subnormal result is rounded once. NaN propagates.
+ */
+static inline __alm_vf
+ALM_INL_HLP(exp_split)(__alm_vf x, __alm_vf *scale)
+{
+#if defined(ALM_INL_DOUBLE)
+    const __alm_t INVLN2 = 0x1.71547652b82fep+0;
+    const __alm_t LN2_HI = 0x1.63p-1, LN2_LO = -0x1.bd0105c610ca8p-13;
+#else
+    const __alm_t INVLN2 = 0x1.715476p+0f;
+    const __alm_t LN2_HI = 0x1.63p-1f, LN2_LO = -0x1.bd0104p-13f;
+#endif
+
+    x = ALM_INL_HLP(sel)(x > __ALM_EXP_HI, ALM_INL_SET1(__ALM_EXP_HI), x);
+    x = ALM_INL_HLP(sel)(x < __ALM_EXP_LO, ALM_INL_SET1(__ALM_EXP_LO), x);
+
+    __alm_vf k = x * INVLN2 + __ALM_SHIFT;
+    __alm_vf n = k - __ALM_SHIFT;
+    __alm_vi ni = (__alm_vi)k - __ALM_SHIFT_BITS;
+    __alm_vi n1 = ni >> 1;
+
+    __alm_vf r = x - n * LN2_HI;
+    r = r - n * LN2_LO;
+
+#if defined(ALM_INL_DOUBLE)
+    __alm_vf p = 0x1.ad661ce7af3e3p-26 * r + 0x1.28b311c80e499p-22;
+    p = p * r + 0x1.71df4520705a4p-19;
+    p = p * r + 0x1.a01992d0fe581p-16;
+    p = p * r + 0x1.a01a011057479p-13;
+    p = p * r + 0x1.6c16c1878111dp-10;
+    p = p * r + 0x1.1111111130dd6p-7;
+    p = p * r + 0x1.555555554f37p-5;
+    p = p * r + 0x1.55555555554a2p-3;
+    p = p * r + 0x1.000000000001p-1;
+#else
+    __alm_vf p = 0x1.9eb724p-13f * r + 0x1.6da4acp-10f;
+    p = p * r + 0x1.1112fap-7f;
+    p = p * r + 0x1.555468p-5f;
+    p = p * r + 0x1.555554p-3f;
+    p = p * r + 0.5f;
+#endif
+    p = p * r + __alm_c(1.0);
+    p = p * r + __alm_c(1.0);
+
+    *scale = (__alm_vf)((ni - n1 + __ALM_BIAS) << __ALM_MANT);
+
+    return p * (__alm_vf)((n1 + __ALM_BIAS) << __ALM_MANT);
+}
+
+/*
+ * k*ln2 + log(1 + f), sqrt(2)/2 <= 1 + f < sqrt(2), as in fdlibm log:
+ * s = f/(2 + f), log(1 + f) = f - hfsq + s*(hfsq + R(s^2)).
+ */
+static inline __alm_vf
+ALM_INL_HLP(log_kf)(__alm_vf k, __alm_vf f)
+{
+#if defined(ALM_INL_DOUBLE)
+    const __alm_t LN2_HI = 0x1.62e42feep-1, LN2_LO = 0x1.a39ef35793c76p-33;
+#else
+    const __alm_t LN2_HI = 0x1.62e3p-1f, LN2_LO = 0x1.2fefa2p-17f;
+#endif
+    __alm_vf s = f / (__alm_c(2.0) + f);
+    __alm_vf z = s * s;
+    __alm_vf w = z * z;
+
+#if defined(ALM_INL_DOUBLE)
+    __alm_vf t1 = w * (0x1.999999997fa04p-2 +
+                       w * (0x1.c71c51d8e78afp-3 + w * 0x1.39a09d078c69fp-3));
+    __alm_vf t2 = z * (0x1.5555555555593p-1 +
+                       w * (0x1.2492494229359p-2 +
+                            w * (0x1.7466496cb03dep-3 + w * 0x1.2f112df3e5244p-3)));
+#else
+    __alm_vf t1 = w * (0x1.999c26p-2f + w * 0x1.f13c4cp-3f);
+    __alm_vf t2 = z * (0x1.555554p-1f + w * 0x1.23d3dcp-2f);
+#endif
+    __alm_vf hfsq = __alm_c(0.5) * f * f;
+
+    return k * LN2_HI + (f - (hfsq - (s * (hfsq + (t1 + t2)) + k * LN2_LO)));
+}
+
+/*
+ * x = 2^k * m with sqrt(2)/2 <= m < sqrt(2), found by offsetting the bits
+ * of positive normal x by those of sqrt(2)/2; k is converted through the
+ * __ALM_SHIFT bias.
+ */
+static inline __alm_vf
+ALM_INL_HLP(log_reduce)(__alm_vf x, __alm_vf *k)
+{
+    __alm_vi ki = ((__alm_vi)x - __ALM_SQRTH_BITS) >> __ALM_MANT;
+
+    *k = (__alm_vf)(ki + __ALM_SHIFT_BITS) - __ALM_SHIFT;
+
+    return (__alm_vf)((__alm_vi)x - (__alm_vi)((__alm_vu)ki << __ALM_MANT));
+}
+
+/**
+ * exp(x). Max 1.5 ULP binary64, 1 ULP binary32.
+ */
+static inline __alm_vf
+ALM_INL_FN(exp)(__alm_vf x)
+{
+    __alm_vf sc;
+    __alm_vf q = ALM_INL_HLP(exp_split)(x, &sc);
+
+    return q * sc;
+}
+
+/**
+ * log(x). Max 1 ULP. Zero, subnormal, negative, infinite and NaN lanes
+ * are fixed up on a branch that ordinary data does not take.
+ */
+static inline __alm_vf
+ALM_INL_FN(log)(__alm_vf x)
+{
+    __alm_vf k;
+    __alm_vf m = ALM_INL_HLP(log_reduce)(x, &k);
+    __alm_vf y = ALM_INL_HLP(log_kf)(k, m - __alm_c(1.0));
+    __alm_vi ok = (x >= __ALM_MIN_NORMAL) & (x <= __ALM_MAX);
+
+    if (__builtin_expect(ALM_INL_ANY(~ok), 0)) {
+        m = ALM_INL_HLP(log_reduce)(x * __ALM_SUB, &k);
+
+        __alm_vf s = ALM_INL_HLP(log_kf)(k - __ALM_SUB_K, m - __alm_c(1.0));
+        __alm_vf z = ALM_INL_HLP(sel)(x == __alm_c(0.0),
+                                      ALM_INL_SET1(-__builtin_inf()),
+                                      ALM_INL_SET1(__builtin_nan("")));
+
+        z = ALM_INL_HLP(sel)(x > __alm_c(0.0), s, z);
+        z = ALM_INL_HLP(sel)(x > __ALM_MAX, x, z);
+        y = ALM_INL_HLP(sel)(ok, y, z);
+    }
+
+    return y;
+}
+
+#if defined(ALM_INL_DOUBLE)
+
+/*
+ * log(x) = hi + *lo for positive normal x and exponent k + kadj, with a
+ * relative error near 2^-64, for pow().
+ * log(1 + f) = 2*atanh(s), s = f/(2 + f), is carried as s + sl from an
+ * exact remainder; 2s^3/3 is a double-double product, the rest of the
+ * series is summed in plain binary64 up to s^25, which bounds |s| <=
+ * 0.1716 to below 2^-64. k*ln2 uses a head with 11 trailing zero bits.
+ */
+static inline __alm_vf
+ALM_INL_HLP(log_dd)(__alm_vf x, __alm_vf kadj, __alm_vf *lo)
+{
+    const double LN2_HI = 0x1.62e42fefa3800p-1, LN2_LO = 0x1.ef35793c7673p-45;
+    const double C3 = 0x1.5555555555555p-1, C3_LO = 0x1.5555555555555p-55;
+
+    __alm_vf k;
+    __alm_vf m = ALM_INL_HLP(log_reduce)(x, &k);
+    k = k + kadj;
+
+    /* s + sl = f / (d + dl), f = m - 1 and d + dl = m + 1 exactly */
+    __alm_vf f = m - 1.0;
+    __alm_vf d = m + 1.0;
+    __alm_vf dl = m - (d - 1.0);
+    __alm_vf s = f / d;
+    __alm_vf sl = (ALM_INL_FMA(-s, d, f) - s * dl) / d;
+
+    /* t + tl = 2s^3/3 */
+    __alm_vf z = s * s;
+    __alm_vf zl = ALM_INL_FMA(s, s, -z);
+    __alm_vf c = s * z;
+    __alm_vf cl = ALM_INL_FMA(s, z, -c) + s * zl;
+    __alm_vf t = c * C3;
+    __alm_vf tl = ALM_INL_FMA(c, ALM_INL_SET1(C3), -t) + (cl * C3 + c * C3_LO);
+
+    /* 2s^5/5 + ... + 2s^25/25 */
+    __alm_vf p = 0x1.47ae147ae147bp-4 * z + 0x1.642c8590b2164p-4;
+    p = p * z + 0x1.8618618618618p-4;
+    p = p * z + 0x1.af286bca1af28p-4;
+    p = p * z + 0x1.e1e1e1e1e1e1ep-4;
+    p = p * z + 0x1.1111111111111p-3;
+    p = p * z + 0x1.3b13b13b13b14p-3;
+    p = p * z + 0x1.745d1745d1746p-3;
+    p = p * z + 0x1.c71c71c71c71cp-3;
+    p = p * z + 0x1.2492492492492p-2;
+    p = p * z + 0x1.999999999999ap-2;
+    __alm_vf u = c * z * p;
+
+    /* k*ln2 + 2s + t, two exact two-sums */
+    __alm_vf a = k * LN2_HI;
+    __alm_vf b = 2.0 * s;
+    __alm_vf h = a + b;
+    __alm_vf bb = h - a;
+    __alm_vf e = (a - (h - bb)) + (b - bb);
+    __alm_vf h2 = h + t;
+    bb = h2 - h;
+    e = e + ((h - (h2 - bb)) + (t - bb));
+
+    /* the sl terms are 2sl * d/ds (s + s^3/3) */
+    __alm_vf l = (u + tl) + e + 2.0 * sl * (1.0 + z) + k * LN2_LO;
+    __alm_vf hi = h2 + l;
+
+    *lo = l - (hi - h2);
+
+    return hi;
+}
+
+/**
+ * pow(x, y) = exp(y * log(x)), log(x) in double-double and the product
+ * split with an FMA. Max 1.5 ULP. The C99 special cases, negative x with
+ * integral y and subnormal x are handled on a branch that ordinary data
+ * does not take.
+ */
+static inline __alm_vf
+ALM_INL_FN(pow)(__alm_vf x, __alm_vf y)
+{
+    const __alm_vf zero = ALM_INL_SET1(0.0);
+    const __alm_vf inf = ALM_INL_SET1(__builtin_inf());
+
+    __alm_vi ok = (x >= __ALM_MIN_NORMAL) & (x <= __ALM_MAX) &
+                  (ALM_INL_HLP(abs)(y) <= __ALM_MAX);
+    int special = ALM_INL_ANY(~ok) != 0;
+    __alm_vf ax = x, kadj = zero, lo;
+
+    if (__builtin_expect(special, 0)) {
+        ax = ALM_INL_HLP(abs)(x);
+        __alm_vi tiny = ax < __ALM_MIN_NORMAL;
+        ax = ALM_INL_HLP(sel)(tiny, ax * __ALM_SUB, ax);
+        kadj = ALM_INL_HLP(sel)(tiny, ALM_INL_SET1(-__ALM_SUB_K), zero);
+    }
+
+    __alm_vf hi = ALM_INL_HLP(log_dd)(ax, kadj, &lo);
+
+    if (__builtin_expect(special, 0)) {
+        __alm_vi nf = ~(ax <= __ALM_MAX);       /* Inf and NaN */
+        hi = ALM_INL_HLP(sel)(ax == 0.0, -inf, hi);
+        hi = ALM_INL_HLP(sel)(nf, ax, hi);
+        lo = ALM_INL_HLP(sel)((ax == 0.0) | nf, zero, lo);
+    }
+
+    __alm_vf ph = y * hi;
+    __alm_vf pl = ALM_INL_FMA(y, hi, -ph) + y * lo;
+    pl = ALM_INL_HLP(sel)(ALM_INL_HLP(abs)(ph) < 1024.0, pl, zero);
+
+    __alm_vf sc;
+    __alm_vf q = ALM_INL_HLP(exp_split)(ph, &sc);
+    __alm_vf r = (q + q * pl) * sc;
+
+    if (__builtin_expect(special, 0)) {
+        __alm_vf ay = ALM_INL_HLP(abs)(y);
+        __alm_vf hy = y * 0.5;
+        __alm_vi yint = ALM_INL_RINT(y) == y;
+        __alm_vi yodd = yint & (ALM_INL_RINT(hy) != hy);
+        __alm_vi neg = (__alm_vi)x < 0;
+
+        r = ALM_INL_HLP(sel)(neg & yodd, -r, r);
+        r = ALM_INL_HLP(sel)((x < 0.0) & (x >= -__ALM_MAX) & ~yint,
+                             ALM_INL_SET1(__builtin_nan("")), r);
+        r = ALM_INL_HLP(sel)((x == 1.0) | (y == 0.0) |
+                             ((ALM_INL_HLP(abs)(x) == 1.0) & (ay == inf)),
+                             ALM_INL_SET1(1.0), r);
+    }
+
+    return r;
+}
+
+/**
+ * sin(x), as vrd8_sin: |x| = N*pi + f, sin(x) = sign(x) * (-1)^N * sin(f)
+ * with pi in three parts and a degree 17 odd polynomial. Max 2.5 ULP.
+ * |x| > 2^23, Inf and NaN go to the scalar sin().
+ */
+static inline __alm_vf
+ALM_INL_FN(sin)(__alm_vf x)
+{
+    const double PI1 = 0x1.921fb54442d18p+1, PI2 = 0x1.1a62633145c06p-53;
+    const double PI3 = 0x1.c1cd129024e09p-106, INVPI = 0x1.45f306dc9c883p-2;
+
+    __alm_vi sign = (__alm_vi)x & ~__ALM_ABS;
+    __alm_vf r = ALM_INL_HLP(abs)(x);
+    __alm_vi big = ~(r <= 0x1p23);
+
+    __alm_vf dn = r * INVPI + __ALM_SHIFT;
+    __alm_vi odd = (__alm_vi)((__alm_vu)dn << 63);
+    dn = dn - __ALM_SHIFT;
+
+    __alm_vf f = r - dn * PI1;
+    f = f - dn * PI2;
+    f = f - dn * PI3;
+
+    __alm_vf f2 = f * f, f4 = f2 * f2, f6 = f4 * f2, f10 = f6 * f4, f14 = f10 * f4;
+    __alm_vf a1 = -0x1.5555555555555p-3 + 0x1.11111111110bp-7 * f2;
+    __alm_vf a2 = -0x1.a01a01a013e1ap-13 + 0x1.71de3a524f063p-19 * f2;
+    __alm_vf a3 = -0x1.ae6454b5dc0abp-26 + 0x1.6123c686ad43p-33 * f2;
+    __alm_vf a4 = -0x1.ae420dc08499cp-41 + 0x1.880ff6993df95p-49 * f2;
+    __alm_vf p = f + f * ((a1 * f2 + a2 * f6) + (f10 * a3 + f14 * a4));
+
+    __alm_vf res = (__alm_vf)((__alm_vi)p ^ sign ^ odd);
+
+    if (__builtin_expect(ALM_INL_ANY(big), 0)) {
+        for (int i = 0; i < ALM_INL_VLEN; i++)
+            if (big[i])
+                res[i] = sin(x[i]);
+    }
+
+    return res;
+}
+
+/**
+ * cos(x), as vrd8_cos: |x| = (N + 1/2)*pi + f, cos(x) = (-1)^N * sin(f),
+ * the sin() polynomial on f. Max 2.5 ULP. |x| > 2^23, Inf and NaN go to the
+ * scalar cos().
+ */
+static inline __alm_vf
+ALM_INL_FN(cos)(__alm_vf x)
+{
+    const double PI1 = -0x1.921fb54442d18p+1, PI2 = -0x1.1a62633145c07p-53;
+    const double PI3 = 0x1.f1976b7ed8fbcp-109, INVPI = 0x1.45f306dc9c883p-2;
+
+    __alm_vf r = ALM_INL_HLP(abs)(x);
+    __alm_vi big = ~(r <= 0x1p23);
+
+    __alm_vf dn = (r * INVPI + 0.5) + __ALM_SHIFT;
+    __alm_vi odd = (__alm_vi)((__alm_vu)dn << 63);
+    dn = (dn - __ALM_SHIFT) - 0.5;
+
+    __alm_vf f = r + dn * PI1;
+    f = f + dn * PI2;
+    f = f + dn * PI3;
+
+    __alm_vf f2 = f * f, f4 = f2 * f2, f6 = f4 * f2, f10 = f6 * f4, f14 = f10 * f4;
+    __alm_vf a1 = -0x1.5555555555555p-3 + 0x1.11111111110bp-7 * f2;
+    __alm_vf a2 = -0x1.a01a01a013e1ap-13 + 0x1.71de3a524f063p-19 * f2;
+    __alm_vf a3 = -0x1.ae6454b5dc0b5p-26 + 0x1.6123c686ad6b4p-33 * f2;
+    __alm_vf a4 = -0x1.ae420dc08fd52p-41 + 0x1.880ff69a83bbep-49 * f2;
+    __alm_vf p = f + f * ((a1 * f2 + a2 * f6) + (f10 * a3 + f14 * a4));
+
+    __alm_vf res = (__alm_vf)((__alm_vi)p ^ odd);
+
+    if (__builtin_expect(ALM_INL_ANY(big), 0)) {
+        for (int i = 0; i < ALM_INL_VLEN; i++)
+            if (big[i])
+                res[i] = cos(x[i]);
+    }
+
+    return res;
+}
+
+/**
+ * tanh(x) as the scalar tanh: [3,3] rational approximations on [0, 0.9)
+ * and [0.9, 1], 1 - 2/(e^2|x| + 1) above, 1 beyond 20. Max 1.5 ULP.
+ */
+static inline __alm_vf
+ALM_INL_FN(tanh)(__alm_vf x)
+{
+    __alm_vi sign = (__alm_vi)x & ~__ALM_ABS;
+    __alm_vf y = ALM_INL_HLP(abs)(x);
+    __alm_vf y2 = y * y;
+    __alm_vi r1 = y < 0.9;
+
+#define __ALM_PICK(a, b) ALM_INL_HLP(sel)(r1, ALM_INL_SET1(a), ALM_INL_SET1(b))
+    __alm_vf n = __ALM_PICK(0.142077926378834722618091e-7, 0.115475878996143396378318e-7);
+    n = __ALM_PICK(-0.200047621071909498730453e-3, -0.165597043903549960486816e-3) - n * y2;
+    n = n * y2 + __ALM_PICK(-0.176016349003044679402273e-1, -0.146173047288731678404066e-1);
+    n = n * y2 + __ALM_PICK(-0.274030424656179760118928e0, -0.227793870659088295252442e0);
+
+    __alm_vf d = __ALM_PICK(0.2091140262529164482568557e-3, 0.173076050126225961768710e-3);
+    d = d * y2 + __ALM_PICK(0.201562166026937652780575e-1, 0.167358775461896562588695e-1);
+    d = d * y2 + __ALM_PICK(0.381641414288328849317962e0, 0.317204558977294374244770e0);
+    d = d * y2 + __ALM_PICK(0.822091273968539282568011e0, 0.683381611977295894959554e0);
+#undef __ALM_PICK
+
+    __alm_vf z = y + (y * y2 * n) / d;
+
+    __alm_vi far = y > 1.0;
+    if (ALM_INL_ANY(far)) {
+        __alm_vf yc = ALM_INL_HLP(sel)(y > 20.0, ALM_INL_SET1(20.0), y);
+        __alm_vf e = ALM_INL_FN(exp)(2.0 * yc);
+        z = ALM_INL_HLP(sel)(far, 1.0 - 2.0 / (e + 1.0), z);
+    }
+
+    return (__alm_vf)((__alm_vi)z | sign);
+}
+
+/**
+ * erf(x) as vrd8_erf: x*P(x^2) for |x| <= 1, 1 - exp(x*Q(x)) up to
+ * 5.921875 and 1 beyond, the regions blended per lane. Max 2 ULP.
+ */
+static inline __alm_vf
+ALM_INL_FN(erf)(__alm_vf x)
+{
+    __alm_vi sign = (__alm_vi)x & ~__ALM_ABS;
+    __alm_vf a = ALM_INL_HLP(abs)(x);
+    __alm_vf a2 = a * a;
+
+    __alm_vf p = -0x1.abae491c28860p-31 * a2 + 0x1.d71b0f1b08156p-27;
+    p = p * a2 - 0x1.5c0726f04cb5ap-23;
+    p = p * a2 + 0x1.b97fd3d9926d0p-20;
+    p = p * a2 - 0x1.f4ca4d6f3e2e1p-17;
+    p = p * a2 + 0x1.f9a2baa8fedd0p-14;
+    p = p * a2 - 0x1.c02db03dd71d4p-11;
+    p = p * a2 + 0x1.565bccf92b2f9p-8;
+    p = p * a2 - 0x1.b82ce311fa93ep-6;
+    p = p * a2 + 0x1.ce2f21a040d16p-4;
+    p = p * a2 - 0x1.812746b0379bdp-2;
+    p = p * a2 + 0x1.20dd750429b6dp+0;
+    __alm_vf res = a * p;
+
+    __alm_vi far = a > 1.0;
+    if (ALM_INL_ANY(far)) {
+        __alm_vf t = ALM_INL_HLP(sel)(a > 0x1.7bp+2, ALM_INL_SET1(0x1.7bp+2), a);
+
+        __alm_vf q = 0x1.1910cfbd5c781p-54 * t - 0x1.59fa2297bf414p-48;
+        q = q * t + 0x1.934bdf577f269p-43;
+        q = q * t - 0x1.2818b20d1fbc6p-38;
+        q = q * t + 0x1.3342dc7d8ce27p-34;
+        q = q * t - 0x1.df393acf45881p-31;
+        q = q * t + 0x1.23753970b571ep-27;
+        q = q * t - 0x1.1b0d2cbfee91ap-24;
+        q = q * t + 0x1.bd40e69c39497p-22;
+        q = q * t - 0x1.1d804d01ae12dp-19;
+        q = q * t + 0x1.29e6dbb394a45p-17;
+        q = q * t - 0x1.f22cc1d2f21fbp-16;
+        q = q * t + 0x1.3f6794bb9cb84p-14;
+        q = q * t - 0x1.114144e09abccp-13;
+        q = q * t + 0x1.9c68216ea9240p-15;
+        q = q * t + 0x1.1195488d78110p-11;
+        q = q * t - 0x1.afdbe8e55573bp-10;
+        q = q * t + 0x1.7eebfdb640bccp-13;
+        q = q * t + 0x1.3992f604e0b05p-6;
+        q = q * t - 0x1.a4f7e461b3921p-4;
+        q = q * t - 0x1.45f2f7628562ap-1;
+        q = q * t - 0x1.20dd758d25ff4p+0;
+
+        __alm_vf e = 1.0 - ALM_INL_FN(exp)(q * t);
+        res = ALM_INL_HLP(sel)(far, e, res);
+        res = ALM_INL_HLP(sel)(a > 0x1.7bp+2, ALM_INL_SET1(1.0), res);
+    }
+
+    return (__alm_vf)((__alm_vi)res | sign);
+}
+
+#else /* binary32 */
+
+/**
+ * powf(x, y): the binary64 pow() of the widened halves, rounded once.
+ * Max 0.6 ULP.
+ */
+static inline __alm_vf
+ALM_INL_FN(pow)(__alm_vf x, __alm_vf y)
+{
+    return ALM_INL_JOIN(ALM_INL_DFN(pow)(ALM_INL_LO(x), ALM_INL_LO(y)),
+                        ALM_INL_DFN(pow)(ALM_INL_HI(x), ALM_INL_HI(y)));
+}
+
+/**
+ * sinf(x), as vrs16_sinf: |x| = N*pi + f with pi in three parts and a
+ * degree 9 odd polynomial. Max 3.5 ULP. |x| > 2^20, Inf and NaN go to the
+ * scalar sinf().
+ */
+static inline __alm_vf
+ALM_INL_FN(sin)(__alm_vf x)
+{
+    const float PI1 = -0x1.921fb6p1f, PI2 = 0x1.777a5cp-24f, PI3 = 0x1.ee59dap-49f;
+    const float INVPI = 0x1.45f306p-2f;
+
+    __alm_vi sign = (__alm_vi)x & ~__ALM_ABS;
+    __alm_vf r = ALM_INL_HLP(abs)(x);
+    __alm_vi big = ~(r <= 0x1p20f);
+
+    __alm_vf dn = r * INVPI + __ALM_SHIFT;
+    __alm_vi odd = (__alm_vi)((__alm_vu)dn << 31);
+    dn = dn - __ALM_SHIFT;
+
+    __alm_vf f = r + dn * PI1;
+    f = f + dn * PI2;
+    f = f + dn * PI3;
+
+    __alm_vf f2 = f * f, f4 = f2 * f2;
+    __alm_vf p = (0x1.110e7cp-7f * f2 - 0x1.555548p-3f) * f2 + 1.0f;
+    p = f * (p + (-0x1.9f6446p-13f * f2 + 0x1.5d38b6p-19f * f4) * f4);
+
+    __alm_vf res = (__alm_vf)((__alm_vi)p ^ sign ^ odd);
+
+    if (__builtin_expect(ALM_INL_ANY(big), 0)) {
+        for (int i = 0; i < ALM_INL_VLEN; i++)
+            if (big[i])
+                res[i] = sinf(x[i]);
+    }
+
+    return res;
+}
+
+/**
+ * cosf(x), as vrs16_cosf: |x| = (N + 1/2)*pi + f and the sinf()
+ * polynomial on f. Max 3.5 ULP. |x| > 2^20, Inf and NaN go to the scalar
+ * cosf().
+ */
+static inline __alm_vf
+ALM_INL_FN(cos)(__alm_vf x)
+{
+    const float PI1 = -0x1.921fb6p1f, PI2 = 0x1.777a5cp-24f, PI3 = 0x1.ee59dap-49f;
+    const float INVPI = 0x1.45f306p-2f, HALFPI = 0x1.921fb6p0f;
+
+    __alm_vf r = ALM_INL_HLP(abs)(x);
+    __alm_vi big = ~(r <= 0x1p20f);
+
+    __alm_vf dn = (r + HALFPI) * INVPI + __ALM_SHIFT;
+    __alm_vi odd = (__alm_vi)((__alm_vu)dn << 31);
+    dn = (dn - __ALM_SHIFT) - 0.5f;
+
+    __alm_vf f = r + dn * PI1;
+    f = f + dn * PI2;
+    f = f + dn * PI3;
+
+    __alm_vf f2 = f * f, f4 = f2 * f2;
+    __alm_vf p = (0x1.110df4p-7f * f2 - 0x1.555548p-3f) * f2 + 1.0f;
+    p = f * (p + (-0x1.9f42eap-13f * f2 + 0x1.5b2e76p-19f * f4) * f4);
+
+    __alm_vf res = (__alm_vf)((__alm_vi)p ^ odd);
+
+    if (__builtin_expect(ALM_INL_ANY(big), 0)) {
+        for (int i = 0; i < ALM_INL_VLEN; i++)
+            if (big[i])
+                res[i] = cosf(x[i]);
+    }
+
+    return res;
+}
+
+/* vrs16_tanhf: x*N(x^2)/D(x^2), degree 7 each, in binary64 */
+static inline ALM_INL_VD
+ALM_INL_HLP(tanh_rat)(ALM_INL_VD z)
+{
+    ALM_INL_VD z2 = z * z, z4 = z2 * z2, z8 = z4 * z4;
+
+    ALM_INL_VD n = (1.0 + z2 * 0x1.30877b8b72d33p-3) +
+                   z4 * (0x1.694aa09ae9e5ep-8 + z2 * 0x1.4101377abb729p-14);
+    n = n + z8 * ((0x1.e0392b1db0018p-22 + z2 * 0x1.2533756e546f7p-30) +
+                  z4 * (0x1.d62e5abe6ae8ap-41 + z2 * 0x1.b06be534182dep-54));
+
+    ALM_INL_VD d = (1.0 + z2 * 0x1.ed99131b0ebeap-2) +
+                   z4 * (0x1.0d27ed6c95a69p-5 + z2 * 0x1.7cbdaca0e9fccp-11);
+    d = d + z8 * ((0x1.b4e60b892578ep-18 + z2 * 0x1.a6f707c5c71abp-26) +
+                  z4 * (0x1.35a8b6e2cd94cp-35 + z2 * 0x1.ca8230677aa01p-47));
+
+    return z * n / d;
+}
+
+/**
+ * tanhf(x), as vrs16_tanhf: a degree 8 rational approximation evaluated
+ * in binary64, +-1 from |x| = 9.01 on. Max 1 ULP.
+ */
+static inline __alm_vf
+ALM_INL_FN(tanh)(__alm_vf x)
+{
+    __alm_vf res = ALM_INL_JOIN(ALM_INL_HLP(tanh_rat)(ALM_INL_LO(x)),
+                                ALM_INL_HLP(tanh_rat)(ALM_INL_HI(x)));
+    __alm_vf one = (__alm_vf)(((__alm_vi)x & ~__ALM_ABS) | 0x3f800000);
+
+    return ALM_INL_HLP(sel)(ALM_INL_HLP(abs)(x) >= 0x1.205966p+3f, one, res);
+}
+
+/* vrs16_erff: a*P(a), degree 16 in binary64, 0 <= a <= 3.92 */
+static inline ALM_INL_VD
+ALM_INL_HLP(erf_poly)(ALM_INL_VD a)
+{
+    ALM_INL_VD p = 0x1.c6a4181da4ef7p-25 * a - 0x1.155445e2e0067p-20;
+    p = p * a + 0x1.12a30f42c7131p-18;
+    p = p * a + 0x1.224ffc80cc199p-14;
+    p = p * a - 0x1.10e8f8c89ad86p-10;
+    p = p * a + 0x1.b9183fc75d327p-8;
+    p = p * a - 0x1.9eb1491956e32p-6;
+    p = p * a + 0x1.d45745fff0e4bp-5;
+    p = p * a - 0x1.2300882a7d1b7p-4;
+    p = p * a + 0x1.4101f320bf8bcp-5;
+    p = p * a - 0x1.51f0ce4ac87c5p-5;
+    p = p * a + 0x1.092cba598f96fp-3;
+    p = p * a - 0x1.07cb4cde6a7d9p-8;
+    p = p * a - 0x1.80a1bd5878e0bp-2;
+    p = p * a - 0x1.ab4bed70f2384p-16;
+    p = p * a + 0x1.20dd7890d27e2p+0;
+
+    return a * p;
+}
+
+/**
+ * erff(x), as the whole-range polynomial of vrs16_erff, evaluated in
+ * binary64, and 1 beyond 3.92. Max 4 ULP.
+ */
+static inline __alm_vf
+ALM_INL_FN(erf)(__alm_vf x)
+{
+    const float BOUND = 0x1.f5a88ep1f;
+
+    __alm_vi sign = (__alm_vi)x & ~__ALM_ABS;
+    __alm_vf a = ALM_INL_HLP(abs)(x);
+    __alm_vf ac = ALM_INL_HLP(sel)(a > BOUND, ALM_INL_SET1(BOUND), a);
+
+    __alm_vf res = ALM_INL_JOIN(ALM_INL_HLP(erf_poly)(ALM_INL_LO(ac)),
+                                ALM_INL_HLP(erf_poly)(ALM_INL_HI(ac)));
+    res = ALM_INL_HLP(sel)(a > BOUND, ALM_INL_SET1(1.0f), res);
+
+    return (__alm_vf)((__alm_vi)res | sign);
+}
+
+#endif /* ALM_INL_DOUBLE */
+
+#undef __alm_t
+#undef __alm_vf
+#undef __alm_vi
+#undef __alm_vu
+#undef __alm_c
+#undef __ALM_MANT
+#undef __ALM_BIAS
+#undef __ALM_ABS
+#undef __ALM_SHIFT
+#undef __ALM_SHIFT_BITS
+#undef __ALM_SQRTH_BITS
+#undef __ALM_EXP_HI
+#undef __ALM_EXP_LO
+#undef __ALM_MIN_NORMAL
+#undef __ALM_MAX
+#undef __ALM_SUB
+#undef __ALM_SUB_K
+
+#undef ALM_INL_DOUBLE
+#undef ALM_INL_VLEN
+#undef ALM_INL_T
+#undef ALM_INL_VF
+#undef ALM_INL_VI
+#undef ALM_INL_VU
+#undef ALM_INL_FN
+#undef ALM_INL_HLP
+#undef ALM_INL_SET1
+#undef ALM_INL_FMA
+#undef ALM_INL_ANY
+#undef ALM_INL_RINT
+#undef ALM_INL_VD
+#undef ALM_INL_HALF
+#undef ALM_INL_LO
+#undef ALM_INL_HI
+#undef ALM_INL_JOIN
+#undef ALM_INL_DFN
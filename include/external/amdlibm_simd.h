@@ -0,0 +1,310 @@
+/*
+(C) 2008-2026 Advanced Micro Devices, Inc. All Rights Reserved.
+
+Advanced Micro Devices, Inc.
+Software License Agreement
+
+IMPORTANT-READ CAREFULLY:  Do not load or use the Software until you have
+carefully read and agreed to the following terms and conditions.  This is a
+legal agreement ("Agreement") between you (either an individual or an entity)
+("Licensee") and Advanced Micro Devices, Inc. ("AMD"). If Licensee does not
+agree to the terms of this Agreement, do not install or use this software or
+any portion thereof.  By loading or using the object code version only of the
+software obtained herewith, which may include associated install scripts and
+online or electronic documentation or any portion thereof, that is made
+available by AMD to download from any media ("Software"), Licensee agrees to
+all of the terms of this Agreement.
+
+1.  LICENSE:
+
+    a.  Subject to the terms and conditions of this Agreement, AMD grants
+    Licensee the following non-exclusive, non-transferable, royalty-free,
+    limited copyright license to download, copy, use, distribute and sublicense
+    the foregoing rights through multiple tiers of sublicenses the object code
+    version of the Software and materials associated with this Agreement,
+    including without limitation printed documentation, (collectively,
+    "Materials"), provided that Licensee agrees to include all copyright
+    legends and other legal notices that may appear in the Materials.  The
+    foregoing license is conditioned upon Licensee distributing the object code
+    version of the Software only and under this software license agreement.
+    Except for the limited license granted herein, Licensee shall have no other
+    rights in the Materials, whether express, implied, arising by estoppel or
+    otherwise.
+
+    b.  Except as expressly set forth in Section 1(a), Licensee does not have
+    the right to (i) distribute, rent, lease, sell, sublicense, assign, or
+    otherwise transfer the Materials, in whole or in part, to third parties for
+    commercial or for non-commercial use; or (ii) modify, disassemble, reverse
+    engineer, or decompile the Software, or otherwise reduce any part of the
+    Software to any human readable form.  All rights in and to the Materials
+    not expressly granted to Licensee in this Agreement are reserved to AMD.
+
+2.  FEEDBACK:  Licensee may provide AMD feedback, suggestions or opinions as to
+the Software, its features, and desired enhancements or changes.  If Licensee
+provides feedback, suggestions or opinions to AMD regarding any new features,
+use, functionality, or change to the Software or any materials related to the
+Software, Licensee hereby agrees to grant, and does grant, AMD all rights
+needed for AMD to incorporate, modify, distribute, use and commercialize any
+new feature, use, functionality, or change at no charge or encumbrance to AMD.
+Licensee agrees that AMD may disclose such feedback, suggestions or opinions to
+any third party in any manner, and Licensee agrees that AMD has the ability to
+sublicense any of the foregoing rights in any feedback, suggestions or opinions
+or AMD products or services in any form to any third party without restriction.
+
+3.  OWNERSHIP AND COPYRIGHT OF MATERIALS: Licensee agrees that the Materials
+are owned by AMD and are protected by United States and foreign intellectual
+property laws (e.g. patent and copyright laws) and international treaty
+provisions.  Licensee will not remove the copyright notice from the Materials.
+Licensee agrees to prevent any unauthorized copying of the Materials.  All
+title and copyrights in and to the Materials, all copies thereof (in whole or
+in part, and in any form), and all rights therein shall remain vested in AMD.
+Except as expressly provided herein, AMD does not grant any express or implied
+right to Licensee under AMD patents, copyrights, trademarks, or trade secret
+information.
+
+4.  WARRANTY DISCLAIMER: THE MATERIALS ARE PROVIDED "AS IS" WITHOUT ANY EXPRESS
+OR IMPLIED WARRANTY OF ANY KIND INCLUDING WARRANTIES OF MERCHANTABILITY,
+NONINFRINGEMENT OF THIRD-PARTY INTELLECTUAL PROPERTY, TITLE, OR FITNESS FOR ANY
+PARTICULAR PURPOSE, OR THOSE ARISING FROM CUSTOM OF TRADE OR COURSE OF USAGE.
+THE ENTIRE RISK ARISING OUT OF USE OR PERFORMANCE OF THE MATERIALS REMAINS WITH
+LICENSEE.  AMD DOES NOT WARRANT, GUARANTEE, OR MAKE ANY REPRESENTATIONS AS TO
+THE CORRECTNESS, ACCURACY, COMPLETENESS, QUALITY, OR RELIABILITY OF THE
+MATERIALS.
+
+AMD DOES NOT WARRANT THAT OPERATION OF THE MATERIALS WILL BE UNINTERRUPTED OR
+ERROR-FREE.  YOU ARE RESPONSIBLE FOR DETERMINING THE APPROPRIATENESS OF USING
+THE SOFTWARE AND ASSUME ALL RISKS ASSOCIATED WITH THE USE OF THE MATERIALS,
+INCLUDING BUT NOT LIMITED TO THE RISKS OF PROGRAM ERRORS, DAMAGE TO OR LOSS OF
+DATA, PROGRAMS OR EQUIPMENT, AND UNAVAILABILITY OR INTERRUPTION OF OPERATIONS.
+SOME JURISDICTIONS DO NOT ALLOW FOR THE EXCLUSION OR LIMITATION OF IMPLIED
+WARRANTIES, SO THE ABOVE LIMITATIONS OR EXCLUSIONS MAY NOT APPLY TO LICENSEE.
+
+5.  LIMITATION OF LIABILITY:  IN NO EVENT SHALL AMD OR ITS DIRECTORS, OFFICERS,
+EMPLOYEES AND AGENTS, ITS SUPPLIERS OR ITS LICENSORS BE LIABLE TO LICENSEE OR
+ANY THIRD PARTIES IN RECEIPT OF THE MATERIALS FOR CONSEQUENTIAL, INCIDENTAL,
+PUNITIVE OR SPECIAL DAMAGES, INCLUDING, BUT NOT LIMITED TO LOSS OF PROFITS,
+BUSINESS INTERRUPTION, OR LOSS OF INFORMATION ARISING OUT OF THE USE OF OR
+INABILITY TO USE THE MATERIALS, EVEN IF AMD HAS BEEN ADVISED OF THE POSSIBILITY
+OF SUCH DAMAGES.  AMD DOES NOT ASSUME ANY RESPONSIBILITY TO SUPPORT OR UPDATE
+THE MATERIALS.  BY USING THE MATERIALS WITHOUT CHARGE, YOU ACCEPT THIS
+ALLOCATION OF RISK.  BECAUSE SOME JURSIDICTIONS PROHIBIT THE EXCLUSION OR
+LIMITATION OF LIABILITY FOR CONSEQUENTIAL OR INCIDENTAL DAMAGES, THE ABOVE
+LIMITATION MAY NOT APPLY TO LICENSEE.
+
+6.  U.S. GOVERNMENT RESTRICTED RIGHTS: The Materials are provided with
+"RESTRICTED RIGHTS."  Use, duplication or disclosure by the Government is
+subject to restrictions as set forth in FAR52.227-14 and DFAR252.227-7013, et
+seq., or its successor.  Use of the Materials by the Government constitutes
+acknowledgment of AMD's proprietary rights in them.
+
+7.  TERMINATION OF LICENSE: This Agreement will terminate immediately without
+notice from AMD or judicial resolution if Licensee fails to comply with any
+provisions of this Agreement.  Upon termination of this Agreement, Licensee
+must delete or destroy all copies of the Materials.
+
+8.  SUPPORT.  Under this Agreement, AMD is under no obligation to assist in the
+use of the Materials, to provide support to licensees of the Materials, or to
+provide maintenance, correction, modification, enhancement, or upgrades to the
+Materials.  If AMD determines, in its sole discretion, to support, maintain,
+correct, modify, enhance, or upgrade the Software, such support, maintenance,
+correction, modification, enhancement or upgrade shall be considered part of
+the Materials, and shall be subject to this Agreement.
+
+9.  SURVIVAL:  Sections 1(b), 2, 3, 4, 5, 6, and 8 through 14 shall survive any
+expiration or termination of this Agreement.
+
+10. APPLICABLE LAWS:  Any claim arising under or relating to this Agreement
+shall be governed by and construed in accordance with the substantive laws of
+the State of California, without regard to principles of conflict of laws.
+Each party hereto submits to the jurisdiction of the state and federal courts
+of Santa Clara County and the Northern District of California for the purposes
+of all legal proceedings arising out of or relating to this Agreement or the
+subject matter hereof.  Each party waives any objection which it may have to
+contest such forum.
+
+11. IMPORT/EXPORT/RE-EXPORT/USE/RELEASE/TRANSFER RESTRICTIONS AND COMPLIANCE
+WITH LAWS:  Licensee is hereby provided notice, and agrees and acknowledges,
+that the Software, its source code, any accompanying media, material or
+information, and any product of the foregoing, may be subject to restrictions
+on use, release, transfer, importation, exportation and/or re- exportation
+under the laws and regulations of the United States or other countries
+("Applicable Laws"), which include but are not limited to U.S. export control
+laws such as the Export Administration Regulations and national security
+controls as defined thereunder, as well as State Department controls under the
+U.S. Munitions List.  Licensee further agrees that the Software, its source
+code, any accompanying media, material or information, and any product of the
+foregoing, will not be used, released, transferred, imported, exported and/or
+re-exported in any manner prohibited under Applicable Laws, including U.S.
+export control laws regarding specifically designated persons, countries and
+nationals of countries subject to national security controls as provided in
+License Exception TSR of the Export Administration Regulations and any
+successor regulations.
+
+12. SEVERABILITY:  Should any term of this Agreement be declared void or
+unenforceable by any court of competent jurisdiction, such declaration shall
+have no effect on the remaining terms hereof.
+
+13. NO WAIVER:  The failure of either party to enforce any rights granted
+hereunder or to take action against the other party in the event of any breach
+hereunder shall not be deemed a waiver by that party as to subsequent
+enforcement of rights or subsequent actions in the event of future breaches.
+
+14. ENTIRE AGREEMENT:  This Agreement constitutes the entire agreement between
+the parties and supersedes any prior or contemporaneous oral or written
+agreements with respect to the subject matter of this Agreement.
+*/
+
+
+/** @file amdlibm_simd.h
+ *  @brief Vector-variant declarations of the AOCL-LibM scalar functions.
+ *
+ *  Redeclares the amd_ scalar functions of amdlibm.h with the OpenMP
+ *  "declare simd" annotation, so that a vectorizing compiler can replace a
+ *  call in a loop such as
+ *
+ *      for (i = 0; i < n; i++) y[i] = amd_exp(x[i]);
+ *
+ *  with calls to the vector variants. The variants are exported by libalm
+ *  under the x86-64 vector function ABI names, _ZGV<isa>N<vlen><params>_<fn>:
+ *
+ *    isa  b (SSE), c (AVX), d (AVX2), e (AVX-512)
+ *    vlen 2, 4, 4, 8 lanes of double; 4, 8, 8, 16 lanes of float
+ *
+ *  e.g. _ZGVdN4v_amd_exp, which calls amd_vrd4_exp(). Besides the plain
+ *  "v" variants, amd_pow()/amd_powf() with a loop-invariant exponent map
+ *  to the powx kernels ("vu", uniform(y)), and amd_sincos()/amd_sincosf()
+ *  writing consecutive outputs map to the sincos kernels ("vl8l8"/"vl4l4",
+ *  linear(s, c), Clang and GCC 13 or later).
+ *
+ *  GCC:   the plain and two-operand variants are declared with
+ *         __attribute__((simd)) and need no flag.
+ *  Clang: all variants are declared with #pragma omp declare simd, and so
+ *         are the uniform/linear variants on GCC. These are emitted when
+ *         _OPENMP is defined (-fopenmp) or, with -fopenmp-simd, when
+ *         ALM_OMP_SIMD is defined before including this header.
+ *
+ *  A call that may set errno is not vectorized outside "#pragma omp simd"
+ *  loops: the functions are also declared const under -fno-math-errno (or
+ *  -ffast-math), which lets -O3 auto-vectorize them.
+ *
+ *  Functions annotated: acos asin atan cbrt cdfnorm cdfnorminv cos cosh
+ *  erf erfc erfcinv erfinv exp exp10 exp2 fabs log log10 log1p log2 pow
+ *  round sin sincos sqrt tan, and the float forms of these plus expm1f and
+ *  tanhf. Vector lengths without a native kernel are assembled from the
+ *  next narrower one.
+ */
+
+#ifndef __AMDLIBM_SIMD_H__
+#define __AMDLIBM_SIMD_H__
+
+#include "amdlibm.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+
+#define __ALM_PRAGMA(x)         _Pragma(#x)
+
+#if defined(_OPENMP) || defined(ALM_OMP_SIMD)
+  #define __ALM_OMP_SIMD(cl)    __ALM_PRAGMA(omp declare simd cl notinbranch)
+#else
+  #define __ALM_OMP_SIMD(cl)
+#endif
+
+#if defined(__NO_MATH_ERRNO__)
+  #define __ALM_CONST           __attribute__((__const__))
+#else
+  #define __ALM_CONST
+#endif
+
+#if defined(__clang__)
+  /* __ALM_SIMD before the declaration, __ALM_SIMD_ATTR after it */
+  #define __ALM_SIMD            __ALM_OMP_SIMD()
+  #define __ALM_SIMD_ATTR       __ALM_CONST
+#else
+  #define __ALM_SIMD
+  #define __ALM_SIMD_ATTR       __attribute__((__simd__("notinbranch"))) __ALM_CONST
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+  __ALM_SIMD double amd_acos (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_asin (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_atan (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_cbrt (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_cdfnorm (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_cdfnorminv (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_cos (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_cosh (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_erf (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_erfc (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_erfcinv (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_erfinv (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_exp (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_exp10 (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_exp2 (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_fabs (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_log (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_log10 (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_log1p (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_log2 (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_round (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_sin (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_sqrt (double x) __ALM_SIMD_ATTR;
+  __ALM_SIMD double amd_tan (double x) __ALM_SIMD_ATTR;
+
+  __ALM_SIMD float amd_acosf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_asinf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_atanf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_cbrtf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_cdfnormf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_cdfnorminvf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_cosf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_coshf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_erfcf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_erfcinvf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_erff (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_erfinvf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_exp10f (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_exp2f (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_expf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_expm1f (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_fabsf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_log10f (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_log1pf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_log2f (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_logf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_roundf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_sinf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_sqrtf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_tanf (float x) __ALM_SIMD_ATTR;
+  __ALM_SIMD float amd_tanhf (float x) __ALM_SIMD_ATTR;
+
+  /* vv: both operands vary, vu: loop-invariant exponent (powx) */
+  __ALM_SIMD __ALM_OMP_SIMD(uniform(y))
+  double amd_pow (double x, double y) __ALM_SIMD_ATTR;
+  __ALM_SIMD __ALM_OMP_SIMD(uniform(y))
+  float amd_powf (float x, float y) __ALM_SIMD_ATTR;
+
+  /* s[i] and c[i] written for consecutive i. GCC 12 passes the
+     unadjusted s and c to the variant in a vectorized loop epilogue. */
+#if defined(__clang__) || __GNUC__ >= 13
+  __ALM_OMP_SIMD(linear(s, c))
+  void amd_sincos (double x, double *s, double *c);
+  __ALM_OMP_SIMD(linear(s, c))
+  void amd_sincosf (float x, float *s, float *c);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#undef __ALM_SIMD_ATTR
+#undef __ALM_SIMD
+#undef __ALM_CONST
+#undef __ALM_OMP_SIMD
+#undef __ALM_PRAGMA
+
+#endif /* __x86_64__ && __GNUC__ */
+
+#endif /* __AMDLIBM_SIMD_H__ */
@@ -165,6 +165,8 @@ agreements with respect to the subject matter of this Agreement.
 #define __AMDLIBM_VEC_H__
 
 
+#include <stddef.h>
+#include <stdint.h>
 #include <emmintrin.h>
 #include <immintrin.h>
 
@@ -472,6 +474,30 @@ extern "C" {
    * @return Vector of erf values.
    */
   __m128 amd_vrs4_erff (__m128 x);
+  /**
+   * @brief Computes Inverse Error function per-lane for four single-precision elements.
+   * @param x Input vector.
+   * @return Vector of erfinvf values.
+   */
+  __m128 amd_vrs4_erfinvf (__m128 x);
+  /**
+   * @brief Computes erfcinv per-lane for four single-precision elements.
+   * @param x Input vector.
+   * @return Vector of erfcinvf values.
+   */
+  __m128 amd_vrs4_erfcinvf (__m128 x);
+  /**
+   * @brief Computes cdfnorm per-lane for four single-precision elements.
+   * @param x Input vector.
+   * @return Vector of cdfnormf values.
+   */
+  __m128 amd_vrs4_cdfnormf (__m128 x);
+  /**
+   * @brief Computes cdfnorminv per-lane for four single-precision elements.
+   * @param x Input vector with values in (0, 1).
+   * @return Vector of cdfnorminvf values.
+   */
+  __m128 amd_vrs4_cdfnorminvf (__m128 x);
 
 /* Complementary Error */
   /**
@@ -812,6 +838,30 @@ extern "C" {
    * @return Vector of erf values.
    */
   __m256 amd_vrs8_erff (__m256 x);
+  /**
+   * @brief Computes Inverse Error function per-lane for eight single-precision elements.
+   * @param x Input vector.
+   * @return Vector of erfinvf values.
+   */
+  __m256 amd_vrs8_erfinvf (__m256 x);
+  /**
+   * @brief Computes erfcinv per-lane for eight single-precision elements.
+   * @param x Input vector.
+   * @return Vector of erfcinvf values.
+   */
+  __m256 amd_vrs8_erfcinvf (__m256 x);
+  /**
+   * @brief Computes cdfnorm per-lane for eight single-precision elements.
+   * @param x Input vector.
+   * @return Vector of cdfnormf values.
+   */
+  __m256 amd_vrs8_cdfnormf (__m256 x);
+  /**
+   * @brief Computes cdfnorminv per-lane for eight single-precision elements.
+   * @param x Input vector with values in (0, 1).
+   * @return Vector of cdfnorminvf values.
+   */
+  __m256 amd_vrs8_cdfnorminvf (__m256 x);
 
 /* Complementary Error */
   /**
@@ -1127,6 +1177,30 @@ extern "C" {
    * @return Vector of erf values.
    */
   __m512 amd_vrs16_erff (__m512 x);
+  /**
+   * @brief Computes Inverse Error function per-lane for sixteen single-precision elements.
+   * @param x Input vector.
+   * @return Vector of erfinvf values.
+   */
+  __m512 amd_vrs16_erfinvf (__m512 x);
+  /**
+   * @brief Computes erfcinv per-lane for sixteen single-precision elements.
+   * @param x Input vector.
+   * @return Vector of erfcinvf values.
+   */
+  __m512 amd_vrs16_erfcinvf (__m512 x);
+  /**
+   * @brief Computes cdfnorm per-lane for sixteen single-precision elements.
+   * @param x Input vector.
+   * @return Vector of cdfnormf values.
+   */
+  __m512 amd_vrs16_cdfnormf (__m512 x);
+  /**
+   * @brief Computes cdfnorminv per-lane for sixteen single-precision elements.
+   * @param x Input vector with values in (0, 1).
+   * @return Vector of cdfnorminvf values.
+   */
+  __m512 amd_vrs16_cdfnorminvf (__m512 x);
 
 /* Complementary Error */
   /**
@@ -1544,6 +1618,30 @@ extern "C" {
    */
   void amd_vrda_powx(int len, const double *src, double y, double *dst);
 
+  /**
+   * @brief Raises elements of x to a scalar integer exponent.
+   *
+   * Same results as amd_vrsa_powxf() with y = n, computed by repeated
+   * squaring for |n| up to 1024.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param n Integer exponent.
+   * @param dst Output array of x^n.
+   */
+  void amd_vrsa_powif(int len, const float *src, int n, float *dst);
+
+  /**
+   * @brief Raises elements of x to a scalar integer exponent.
+   *
+   * Same results as amd_vrda_powx() with y = n, computed by repeated
+   * squaring for |n| up to 1024.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param n Integer exponent.
+   * @param dst Output array of x^n.
+   */
+  void amd_vrda_powi(int len, const double *src, int n, double *dst);
+
   /**
    * @brief Computes elementwise square root for double array.
    * @param len Number of elements.
@@ -1595,6 +1693,34 @@ extern "C" {
    * @param dst Output array of erf values.
    */
   void amd_vrsa_erff (int len, const float *src, float *dst);
+  /**
+   * @brief Computes Inverse Error function elementwise for float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param dst Output array of erfinvf values.
+   */
+  void amd_vrsa_erfinvf (int len, const float *src, float *dst);
+  /**
+   * @brief Computes erfcinv elementwise for float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param dst Output array of erfcinvf values.
+   */
+  void amd_vrsa_erfcinvf (int len, const float *src, float *dst);
+  /**
+   * @brief Computes cdfnorm elementwise for float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param dst Output array of cdfnormf values.
+   */
+  void amd_vrsa_cdfnormf (int len, const float *src, float *dst);
+  /**
+   * @brief Computes cdfnorminv elementwise for float array.
+   * @param len Number of elements.
+   * @param src Input array with values in (0, 1).
+   * @param dst Output array of cdfnorminvf values.
+   */
+  void amd_vrsa_cdfnorminvf (int len, const float *src, float *dst);
 
 /* Complementary Error */
   /**
@@ -1967,6 +2093,4437 @@ extern "C" {
   void amd_vrsa_fminfi (int len, const float *lhs, int inc_a,
                         const float *rhs, int inc_b, float *dst, int inc_res);
 
+/* Strided Variants with 64-bit length */
+  /**
+   * @brief Computes sine elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_sini_64 (size_t len, const double *src, size_t inc_src,
+                         double *dst, size_t inc_dst);
+  /**
+   * @brief Computes sine elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_sinfi_64 (size_t len, const float *src, size_t inc_src,
+                          float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes cosine elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_cosi_64 (size_t len, const double *src, size_t inc_src,
+                         double *dst, size_t inc_dst);
+  /**
+   * @brief Computes cosine elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_cosfi_64 (size_t len, const float *src, size_t inc_src,
+                          float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes tangent elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_tani_64 (size_t len, const double *src, size_t inc_src,
+                         double *dst, size_t inc_dst);
+  /**
+   * @brief Computes tangent elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_tanfi_64 (size_t len, const float *src, size_t inc_src,
+                          float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes arcsine elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_asini_64 (size_t len, const double *src, size_t inc_src,
+                          double *dst, size_t inc_dst);
+  /**
+   * @brief Computes arcsine elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_asinfi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes arccosine elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_acosi_64 (size_t len, const double *src, size_t inc_src,
+                          double *dst, size_t inc_dst);
+  /**
+   * @brief Computes arccosine elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_acosfi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes arctangent elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_atani_64 (size_t len, const double *src, size_t inc_src,
+                          double *dst, size_t inc_dst);
+  /**
+   * @brief Computes arctangent elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_atanfi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes hyperbolic cosine elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_coshi_64 (size_t len, const double *src, size_t inc_src,
+                          double *dst, size_t inc_dst);
+  /**
+   * @brief Computes hyperbolic cosine elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_coshfi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes e raised to the power elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_expi_64 (size_t len, const double *src, size_t inc_src,
+                         double *dst, size_t inc_dst);
+  /**
+   * @brief Computes e raised to the power elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_expfi_64 (size_t len, const float *src, size_t inc_src,
+                          float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes 2 raised to the power elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_exp2i_64 (size_t len, const double *src, size_t inc_src,
+                          double *dst, size_t inc_dst);
+  /**
+   * @brief Computes 2 raised to the power elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_exp2fi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes 10 raised to the power elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_exp10i_64 (size_t len, const double *src, size_t inc_src,
+                           double *dst, size_t inc_dst);
+  /**
+   * @brief Computes 10 raised to the power elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_exp10fi_64 (size_t len, const float *src, size_t inc_src,
+                            float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes exp(x) - 1 elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_expm1i_64 (size_t len, const double *src, size_t inc_src,
+                           double *dst, size_t inc_dst);
+  /**
+   * @brief Computes exp(x) - 1 elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_expm1fi_64 (size_t len, const float *src, size_t inc_src,
+                            float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes natural logarithm elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_logi_64 (size_t len, const double *src, size_t inc_src,
+                         double *dst, size_t inc_dst);
+  /**
+   * @brief Computes natural logarithm elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_logfi_64 (size_t len, const float *src, size_t inc_src,
+                          float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes base-2 logarithm elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_log2i_64 (size_t len, const double *src, size_t inc_src,
+                          double *dst, size_t inc_dst);
+  /**
+   * @brief Computes base-2 logarithm elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_log2fi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes base-10 logarithm elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_log10i_64 (size_t len, const double *src, size_t inc_src,
+                           double *dst, size_t inc_dst);
+  /**
+   * @brief Computes base-10 logarithm elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_log10fi_64 (size_t len, const float *src, size_t inc_src,
+                            float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes log(1 + x) elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_log1pi_64 (size_t len, const double *src, size_t inc_src,
+                           double *dst, size_t inc_dst);
+  /**
+   * @brief Computes log(1 + x) elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_log1pfi_64 (size_t len, const float *src, size_t inc_src,
+                            float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes power elementwise for strided double arrays.
+   * @param len Number of elements.
+   * @param lhs Base array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Exponent array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrda_powi_64 (size_t len, const double *lhs, size_t inc_a,
+                         const double *rhs, size_t inc_b, double *dst,
+                         size_t inc_res);
+  /**
+   * @brief Computes power elementwise for strided float arrays.
+   * @param len Number of elements.
+   * @param lhs Base array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Exponent array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrsa_powfi_64 (size_t len, const float *lhs, size_t inc_a,
+                          const float *rhs, size_t inc_b, float *dst,
+                          size_t inc_res);
+
+  /**
+   * @brief Computes square root elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_sqrti_64 (size_t len, const double *src, size_t inc_src,
+                          double *dst, size_t inc_dst);
+  /**
+   * @brief Computes square root elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_sqrtfi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes cube root elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_cbrti_64 (size_t len, const double *src, size_t inc_src,
+                          double *dst, size_t inc_dst);
+  /**
+   * @brief Computes cube root elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_cbrtfi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes error function elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_erfi_64 (size_t len, const double *src, size_t inc_src,
+                         double *dst, size_t inc_dst);
+  /**
+   * @brief Computes error function elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_erffi_64 (size_t len, const float *src, size_t inc_src,
+                          float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes complementary error function elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_erfci_64 (size_t len, const double *src, size_t inc_src,
+                          double *dst, size_t inc_dst);
+  /**
+   * @brief Computes complementary error function elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_erfcfi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes inverse error function elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_erfinvi_64 (size_t len, const double *src, size_t inc_src,
+                            double *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes inverse complementary error function elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_erfcinvi_64 (size_t len, const double *src, size_t inc_src,
+                             double *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes standard normal CDF elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_cdfnormi_64 (size_t len, const double *src, size_t inc_src,
+                             double *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes inverse standard normal CDF elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_cdfnorminvi_64 (size_t len, const double *src, size_t inc_src,
+                                double *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes absolute value elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_fabsi_64 (size_t len, const double *src, size_t inc_src,
+                          double *dst, size_t inc_dst);
+  /**
+   * @brief Computes absolute value elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_fabsfi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes rounded value elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_roundi_64 (size_t len, const double *src, size_t inc_src,
+                           double *dst, size_t inc_dst);
+  /**
+   * @brief Computes rounded value elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_roundfi_64 (size_t len, const float *src, size_t inc_src,
+                            float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes sum elementwise for strided double arrays.
+   * @param len Number of elements.
+   * @param lhs Left-hand array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Right-hand array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrda_addi_64 (size_t len, const double *lhs, size_t inc_a,
+                         const double *rhs, size_t inc_b, double *dst,
+                         size_t inc_res);
+  /**
+   * @brief Computes sum elementwise for strided float arrays.
+   * @param len Number of elements.
+   * @param lhs Left-hand array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Right-hand array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrsa_addfi_64 (size_t len, const float *lhs, size_t inc_a,
+                          const float *rhs, size_t inc_b, float *dst,
+                          size_t inc_res);
+
+  /**
+   * @brief Computes difference elementwise for strided double arrays.
+   * @param len Number of elements.
+   * @param lhs Left-hand array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Right-hand array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrda_subi_64 (size_t len, const double *lhs, size_t inc_a,
+                         const double *rhs, size_t inc_b, double *dst,
+                         size_t inc_res);
+  /**
+   * @brief Computes difference elementwise for strided float arrays.
+   * @param len Number of elements.
+   * @param lhs Left-hand array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Right-hand array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrsa_subfi_64 (size_t len, const float *lhs, size_t inc_a,
+                          const float *rhs, size_t inc_b, float *dst,
+                          size_t inc_res);
+
+  /**
+   * @brief Computes product elementwise for strided double arrays.
+   * @param len Number of elements.
+   * @param lhs Left-hand array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Right-hand array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrda_muli_64 (size_t len, const double *lhs, size_t inc_a,
+                         const double *rhs, size_t inc_b, double *dst,
+                         size_t inc_res);
+  /**
+   * @brief Computes product elementwise for strided float arrays.
+   * @param len Number of elements.
+   * @param lhs Left-hand array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Right-hand array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrsa_mulfi_64 (size_t len, const float *lhs, size_t inc_a,
+                          const float *rhs, size_t inc_b, float *dst,
+                          size_t inc_res);
+
+  /**
+   * @brief Computes quotient elementwise for strided double arrays.
+   * @param len Number of elements.
+   * @param lhs Numerator array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Denominator array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrda_divi_64 (size_t len, const double *lhs, size_t inc_a,
+                         const double *rhs, size_t inc_b, double *dst,
+                         size_t inc_res);
+  /**
+   * @brief Computes quotient elementwise for strided float arrays.
+   * @param len Number of elements.
+   * @param lhs Numerator array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Denominator array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrsa_divfi_64 (size_t len, const float *lhs, size_t inc_a,
+                          const float *rhs, size_t inc_b, float *dst,
+                          size_t inc_res);
+
+  /**
+   * @brief Computes maximum elementwise for strided double arrays.
+   * @param len Number of elements.
+   * @param lhs Left-hand array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Right-hand array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrda_fmaxi_64 (size_t len, const double *lhs, size_t inc_a,
+                          const double *rhs, size_t inc_b, double *dst,
+                          size_t inc_res);
+  /**
+   * @brief Computes maximum elementwise for strided float arrays.
+   * @param len Number of elements.
+   * @param lhs Left-hand array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Right-hand array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrsa_fmaxfi_64 (size_t len, const float *lhs, size_t inc_a,
+                           const float *rhs, size_t inc_b, float *dst,
+                           size_t inc_res);
+
+  /**
+   * @brief Computes minimum elementwise for strided double arrays.
+   * @param len Number of elements.
+   * @param lhs Left-hand array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Right-hand array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrda_fmini_64 (size_t len, const double *lhs, size_t inc_a,
+                          const double *rhs, size_t inc_b, double *dst,
+                          size_t inc_res);
+  /**
+   * @brief Computes minimum elementwise for strided float arrays.
+   * @param len Number of elements.
+   * @param lhs Left-hand array.
+   * @param inc_a Stride for lhs (in elements).
+   * @param rhs Right-hand array.
+   * @param inc_b Stride for rhs (in elements).
+   * @param dst Output array.
+   * @param inc_res Stride for dst (in elements).
+   */
+  void amd_vrsa_fminfi_64 (size_t len, const float *lhs, size_t inc_a,
+                           const float *rhs, size_t inc_b, float *dst,
+                           size_t inc_res);
+
+  /**
+   * @brief Computes sine and cosine elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param sin Output array for sines.
+   * @param inc_sin Stride for sin (in elements).
+   * @param cos Output array for cosines.
+   * @param inc_cos Stride for cos (in elements).
+   */
+  void amd_vrda_sincosi_64 (size_t len, const double *src, size_t inc_src,
+                            double *sin, size_t inc_sin, double *cos,
+                            size_t inc_cos);
+  /**
+   * @brief Computes sine and cosine elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param sin Output array for sines.
+   * @param inc_sin Stride for sin (in elements).
+   * @param cos Output array for cosines.
+   * @param inc_cos Stride for cos (in elements).
+   */
+  void amd_vrsa_sincosfi_64 (size_t len, const float *src, size_t inc_src,
+                             float *sin, size_t inc_sin, float *cos,
+                             size_t inc_cos);
+
+  /**
+   * @brief Computes power with a scalar exponent elementwise for strided double array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param y Scalar exponent.
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_powxi_64 (size_t len, const double *src, size_t inc_src,
+                          double y, double *dst, size_t inc_dst);
+  /**
+   * @brief Computes power with a scalar exponent elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param y Scalar exponent.
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_powxfi_64 (size_t len, const float *src, size_t inc_src,
+                           float y, float *dst, size_t inc_dst);
+
+  /**
+   * @brief Computes a linear fractional transform elementwise for strided double arrays.
+   * @param len Number of elements.
+   * @param x Input array x.
+   * @param inc_x Stride for x (in elements).
+   * @param y Input array y.
+   * @param inc_y Stride for y (in elements).
+   * @param scx Scale for x.
+   * @param shx Shift for x.
+   * @param scy Scale for y.
+   * @param shy Shift for y.
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrda_linearfraci_64 (size_t len, const double *x, size_t inc_x,
+                                const double *y, size_t inc_y, double scx,
+                                double shx, double scy, double shy, double *dst,
+                                size_t inc_dst);
+  /**
+   * @brief Computes a linear fractional transform elementwise for strided float arrays.
+   * @param len Number of elements.
+   * @param x Input array x.
+   * @param inc_x Stride for x (in elements).
+   * @param y Input array y.
+   * @param inc_y Stride for y (in elements).
+   * @param scx Scale for x.
+   * @param shx Shift for x.
+   * @param scy Scale for y.
+   * @param shy Shift for y.
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_linearfracfi_64 (size_t len, const float *x, size_t inc_x,
+                                 const float *y, size_t inc_y, float scx,
+                                 float shx, float scy, float shy, float *dst,
+                                 size_t inc_dst);
+
+  /**
+   * @brief Computes hyperbolic tangent elementwise for strided float array.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @param inc_src Stride for src (in elements).
+   * @param dst Output array.
+   * @param inc_dst Stride for dst (in elements).
+   */
+  void amd_vrsa_tanhfi_64 (size_t len, const float *src, size_t inc_src,
+                           float *dst, size_t inc_dst);
+
+/* Indexed & Masked Variants */
+  /**
+   * @brief Computes sine of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_sin_idx (size_t len, const size_t *idx, const double *src,
+                         double *dst);
+  /**
+   * @brief Computes sine of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_sin_mask (size_t len, const unsigned char *mask,
+                          const double *src, double *dst);
+  /**
+   * @brief Computes sine of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_sin_bmask (size_t len, const unsigned char *bits,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes sine of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_sinf_idx (size_t len, const size_t *idx, const float *src,
+                          float *dst);
+  /**
+   * @brief Computes sine of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_sinf_mask (size_t len, const unsigned char *mask,
+                           const float *src, float *dst);
+  /**
+   * @brief Computes sine of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_sinf_bmask (size_t len, const unsigned char *bits,
+                            const float *src, float *dst);
+
+  /**
+   * @brief Computes cosine of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cos_idx (size_t len, const size_t *idx, const double *src,
+                         double *dst);
+  /**
+   * @brief Computes cosine of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cos_mask (size_t len, const unsigned char *mask,
+                          const double *src, double *dst);
+  /**
+   * @brief Computes cosine of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cos_bmask (size_t len, const unsigned char *bits,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes cosine of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_cosf_idx (size_t len, const size_t *idx, const float *src,
+                          float *dst);
+  /**
+   * @brief Computes cosine of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_cosf_mask (size_t len, const unsigned char *mask,
+                           const float *src, float *dst);
+  /**
+   * @brief Computes cosine of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_cosf_bmask (size_t len, const unsigned char *bits,
+                            const float *src, float *dst);
+
+  /**
+   * @brief Computes tangent of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_tan_idx (size_t len, const size_t *idx, const double *src,
+                         double *dst);
+  /**
+   * @brief Computes tangent of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_tan_mask (size_t len, const unsigned char *mask,
+                          const double *src, double *dst);
+  /**
+   * @brief Computes tangent of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_tan_bmask (size_t len, const unsigned char *bits,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes tangent of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_tanf_idx (size_t len, const size_t *idx, const float *src,
+                          float *dst);
+  /**
+   * @brief Computes tangent of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_tanf_mask (size_t len, const unsigned char *mask,
+                           const float *src, float *dst);
+  /**
+   * @brief Computes tangent of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_tanf_bmask (size_t len, const unsigned char *bits,
+                            const float *src, float *dst);
+
+  /**
+   * @brief Computes arcsine of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_asin_idx (size_t len, const size_t *idx, const double *src,
+                          double *dst);
+  /**
+   * @brief Computes arcsine of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_asin_mask (size_t len, const unsigned char *mask,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes arcsine of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_asin_bmask (size_t len, const unsigned char *bits,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes arcsine of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_asinf_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes arcsine of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_asinf_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes arcsine of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_asinf_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes arccosine of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_acos_idx (size_t len, const size_t *idx, const double *src,
+                          double *dst);
+  /**
+   * @brief Computes arccosine of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_acos_mask (size_t len, const unsigned char *mask,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes arccosine of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_acos_bmask (size_t len, const unsigned char *bits,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes arccosine of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_acosf_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes arccosine of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_acosf_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes arccosine of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_acosf_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes arctangent of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_atan_idx (size_t len, const size_t *idx, const double *src,
+                          double *dst);
+  /**
+   * @brief Computes arctangent of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_atan_mask (size_t len, const unsigned char *mask,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes arctangent of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_atan_bmask (size_t len, const unsigned char *bits,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes arctangent of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_atanf_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes arctangent of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_atanf_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes arctangent of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_atanf_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes hyperbolic cosine of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cosh_idx (size_t len, const size_t *idx, const double *src,
+                          double *dst);
+  /**
+   * @brief Computes hyperbolic cosine of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cosh_mask (size_t len, const unsigned char *mask,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes hyperbolic cosine of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cosh_bmask (size_t len, const unsigned char *bits,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes hyperbolic cosine of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_coshf_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes hyperbolic cosine of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_coshf_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes hyperbolic cosine of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_coshf_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes hyperbolic tangent of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_tanhf_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes hyperbolic tangent of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_tanhf_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes hyperbolic tangent of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_tanhf_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes exponential of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_exp_idx (size_t len, const size_t *idx, const double *src,
+                         double *dst);
+  /**
+   * @brief Computes exponential of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_exp_mask (size_t len, const unsigned char *mask,
+                          const double *src, double *dst);
+  /**
+   * @brief Computes exponential of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_exp_bmask (size_t len, const unsigned char *bits,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes exponential of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_expf_idx (size_t len, const size_t *idx, const float *src,
+                          float *dst);
+  /**
+   * @brief Computes exponential of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_expf_mask (size_t len, const unsigned char *mask,
+                           const float *src, float *dst);
+  /**
+   * @brief Computes exponential of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_expf_bmask (size_t len, const unsigned char *bits,
+                            const float *src, float *dst);
+
+  /**
+   * @brief Computes base-2 exponential of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_exp2_idx (size_t len, const size_t *idx, const double *src,
+                          double *dst);
+  /**
+   * @brief Computes base-2 exponential of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_exp2_mask (size_t len, const unsigned char *mask,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes base-2 exponential of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_exp2_bmask (size_t len, const unsigned char *bits,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes base-2 exponential of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_exp2f_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes base-2 exponential of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_exp2f_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes base-2 exponential of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_exp2f_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes base-10 exponential of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_exp10_idx (size_t len, const size_t *idx, const double *src,
+                           double *dst);
+  /**
+   * @brief Computes base-10 exponential of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_exp10_mask (size_t len, const unsigned char *mask,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes base-10 exponential of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_exp10_bmask (size_t len, const unsigned char *bits,
+                             const double *src, double *dst);
+  /**
+   * @brief Computes base-10 exponential of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_exp10f_idx (size_t len, const size_t *idx, const float *src,
+                            float *dst);
+  /**
+   * @brief Computes base-10 exponential of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_exp10f_mask (size_t len, const unsigned char *mask,
+                             const float *src, float *dst);
+  /**
+   * @brief Computes base-10 exponential of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_exp10f_bmask (size_t len, const unsigned char *bits,
+                              const float *src, float *dst);
+
+  /**
+   * @brief Computes exp(x) - 1 of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_expm1_idx (size_t len, const size_t *idx, const double *src,
+                           double *dst);
+  /**
+   * @brief Computes exp(x) - 1 of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_expm1_mask (size_t len, const unsigned char *mask,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes exp(x) - 1 of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_expm1_bmask (size_t len, const unsigned char *bits,
+                             const double *src, double *dst);
+  /**
+   * @brief Computes exp(x) - 1 of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_expm1f_idx (size_t len, const size_t *idx, const float *src,
+                            float *dst);
+  /**
+   * @brief Computes exp(x) - 1 of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_expm1f_mask (size_t len, const unsigned char *mask,
+                             const float *src, float *dst);
+  /**
+   * @brief Computes exp(x) - 1 of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_expm1f_bmask (size_t len, const unsigned char *bits,
+                              const float *src, float *dst);
+
+  /**
+   * @brief Computes natural logarithm of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log_idx (size_t len, const size_t *idx, const double *src,
+                         double *dst);
+  /**
+   * @brief Computes natural logarithm of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log_mask (size_t len, const unsigned char *mask,
+                          const double *src, double *dst);
+  /**
+   * @brief Computes natural logarithm of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log_bmask (size_t len, const unsigned char *bits,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes natural logarithm of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_logf_idx (size_t len, const size_t *idx, const float *src,
+                          float *dst);
+  /**
+   * @brief Computes natural logarithm of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_logf_mask (size_t len, const unsigned char *mask,
+                           const float *src, float *dst);
+  /**
+   * @brief Computes natural logarithm of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_logf_bmask (size_t len, const unsigned char *bits,
+                            const float *src, float *dst);
+
+  /**
+   * @brief Computes base-2 logarithm of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log2_idx (size_t len, const size_t *idx, const double *src,
+                          double *dst);
+  /**
+   * @brief Computes base-2 logarithm of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log2_mask (size_t len, const unsigned char *mask,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes base-2 logarithm of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log2_bmask (size_t len, const unsigned char *bits,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes base-2 logarithm of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_log2f_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes base-2 logarithm of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_log2f_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes base-2 logarithm of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_log2f_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes base-10 logarithm of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log10_idx (size_t len, const size_t *idx, const double *src,
+                           double *dst);
+  /**
+   * @brief Computes base-10 logarithm of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log10_mask (size_t len, const unsigned char *mask,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes base-10 logarithm of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log10_bmask (size_t len, const unsigned char *bits,
+                             const double *src, double *dst);
+  /**
+   * @brief Computes base-10 logarithm of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_log10f_idx (size_t len, const size_t *idx, const float *src,
+                            float *dst);
+  /**
+   * @brief Computes base-10 logarithm of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_log10f_mask (size_t len, const unsigned char *mask,
+                             const float *src, float *dst);
+  /**
+   * @brief Computes base-10 logarithm of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_log10f_bmask (size_t len, const unsigned char *bits,
+                              const float *src, float *dst);
+
+  /**
+   * @brief Computes log(1 + x) of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log1p_idx (size_t len, const size_t *idx, const double *src,
+                           double *dst);
+  /**
+   * @brief Computes log(1 + x) of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log1p_mask (size_t len, const unsigned char *mask,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes log(1 + x) of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_log1p_bmask (size_t len, const unsigned char *bits,
+                             const double *src, double *dst);
+  /**
+   * @brief Computes log(1 + x) of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_log1pf_idx (size_t len, const size_t *idx, const float *src,
+                            float *dst);
+  /**
+   * @brief Computes log(1 + x) of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_log1pf_mask (size_t len, const unsigned char *mask,
+                             const float *src, float *dst);
+  /**
+   * @brief Computes log(1 + x) of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_log1pf_bmask (size_t len, const unsigned char *bits,
+                              const float *src, float *dst);
+
+  /**
+   * @brief Computes square root of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_sqrt_idx (size_t len, const size_t *idx, const double *src,
+                          double *dst);
+  /**
+   * @brief Computes square root of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_sqrt_mask (size_t len, const unsigned char *mask,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes square root of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_sqrt_bmask (size_t len, const unsigned char *bits,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes square root of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_sqrtf_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes square root of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_sqrtf_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes square root of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_sqrtf_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes cube root of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cbrt_idx (size_t len, const size_t *idx, const double *src,
+                          double *dst);
+  /**
+   * @brief Computes cube root of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cbrt_mask (size_t len, const unsigned char *mask,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes cube root of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cbrt_bmask (size_t len, const unsigned char *bits,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes cube root of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_cbrtf_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes cube root of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_cbrtf_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes cube root of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_cbrtf_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes error function of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erf_idx (size_t len, const size_t *idx, const double *src,
+                         double *dst);
+  /**
+   * @brief Computes error function of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erf_mask (size_t len, const unsigned char *mask,
+                          const double *src, double *dst);
+  /**
+   * @brief Computes error function of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erf_bmask (size_t len, const unsigned char *bits,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes error function of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_erff_idx (size_t len, const size_t *idx, const float *src,
+                          float *dst);
+  /**
+   * @brief Computes error function of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_erff_mask (size_t len, const unsigned char *mask,
+                           const float *src, float *dst);
+  /**
+   * @brief Computes error function of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_erff_bmask (size_t len, const unsigned char *bits,
+                            const float *src, float *dst);
+
+  /**
+   * @brief Computes complementary error function of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erfc_idx (size_t len, const size_t *idx, const double *src,
+                          double *dst);
+  /**
+   * @brief Computes complementary error function of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erfc_mask (size_t len, const unsigned char *mask,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes complementary error function of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erfc_bmask (size_t len, const unsigned char *bits,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes complementary error function of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_erfcf_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes complementary error function of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_erfcf_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes complementary error function of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_erfcf_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes inverse error function of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erfinv_idx (size_t len, const size_t *idx, const double *src,
+                            double *dst);
+  /**
+   * @brief Computes inverse error function of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erfinv_mask (size_t len, const unsigned char *mask,
+                             const double *src, double *dst);
+  /**
+   * @brief Computes inverse error function of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erfinv_bmask (size_t len, const unsigned char *bits,
+                              const double *src, double *dst);
+
+  /**
+   * @brief Computes inverse complementary error function of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erfcinv_idx (size_t len, const size_t *idx, const double *src,
+                             double *dst);
+  /**
+   * @brief Computes inverse complementary error function of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erfcinv_mask (size_t len, const unsigned char *mask,
+                              const double *src, double *dst);
+  /**
+   * @brief Computes inverse complementary error function of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_erfcinv_bmask (size_t len, const unsigned char *bits,
+                               const double *src, double *dst);
+
+  /**
+   * @brief Computes standard normal CDF of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cdfnorm_idx (size_t len, const size_t *idx, const double *src,
+                             double *dst);
+  /**
+   * @brief Computes standard normal CDF of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cdfnorm_mask (size_t len, const unsigned char *mask,
+                              const double *src, double *dst);
+  /**
+   * @brief Computes standard normal CDF of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cdfnorm_bmask (size_t len, const unsigned char *bits,
+                               const double *src, double *dst);
+
+  /**
+   * @brief Computes inverse standard normal CDF of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cdfnorminv_idx (size_t len, const size_t *idx,
+                                const double *src, double *dst);
+  /**
+   * @brief Computes inverse standard normal CDF of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cdfnorminv_mask (size_t len, const unsigned char *mask,
+                                 const double *src, double *dst);
+  /**
+   * @brief Computes inverse standard normal CDF of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_cdfnorminv_bmask (size_t len, const unsigned char *bits,
+                                  const double *src, double *dst);
+
+  /**
+   * @brief Computes absolute value of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_fabs_idx (size_t len, const size_t *idx, const double *src,
+                          double *dst);
+  /**
+   * @brief Computes absolute value of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_fabs_mask (size_t len, const unsigned char *mask,
+                           const double *src, double *dst);
+  /**
+   * @brief Computes absolute value of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_fabs_bmask (size_t len, const unsigned char *bits,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes absolute value of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_fabsf_idx (size_t len, const size_t *idx, const float *src,
+                           float *dst);
+  /**
+   * @brief Computes absolute value of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_fabsf_mask (size_t len, const unsigned char *mask,
+                            const float *src, float *dst);
+  /**
+   * @brief Computes absolute value of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_fabsf_bmask (size_t len, const unsigned char *bits,
+                             const float *src, float *dst);
+
+  /**
+   * @brief Computes rounded value of the double array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_round_idx (size_t len, const size_t *idx, const double *src,
+                           double *dst);
+  /**
+   * @brief Computes rounded value of the double array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_round_mask (size_t len, const unsigned char *mask,
+                            const double *src, double *dst);
+  /**
+   * @brief Computes rounded value of the double array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrda_round_bmask (size_t len, const unsigned char *bits,
+                             const double *src, double *dst);
+  /**
+   * @brief Computes rounded value of the float array elements selected by an index array.
+   * @param len Number of indices.
+   * @param idx Indices of the elements to compute, dst[idx[i]] = f(src[idx[i]]).
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_roundf_idx (size_t len, const size_t *idx, const float *src,
+                            float *dst);
+  /**
+   * @brief Computes rounded value of the float array elements selected by a byte mask.
+   * @param len Number of elements.
+   * @param mask Byte mask, element i is computed when mask[i] is non-zero.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_roundf_mask (size_t len, const unsigned char *mask,
+                             const float *src, float *dst);
+  /**
+   * @brief Computes rounded value of the float array elements selected by a bit mask.
+   * @param len Number of elements.
+   * @param bits Bit mask, element i is computed when bit (i % 8) of bits[i / 8] is set.
+   * @param src Input array.
+   * @param dst Output array, unselected elements are left untouched.
+   */
+  void amd_vrsa_roundf_bmask (size_t len, const unsigned char *bits,
+                              const float *src, float *dst);
+
+/*
+ * Fused Expressions
+ */
+
+/** Maximum number of steps in a fused expression. */
+#define ALM_EXPR_MAX_OPS    32
+/** Maximum number of input arrays of a fused expression. */
+#define ALM_EXPR_MAX_ARGS   4
+/** Maximum number of intermediate values alive at the same time. */
+#define ALM_EXPR_MAX_DEPTH  4
+
+/**
+ * @brief Element-wise operations available in a fused expression.
+ *
+ * Binary operations take the two topmost values of the expression stack,
+ * the top being the right-hand operand. Unary operations replace the top.
+ */
+typedef enum {
+  ALM_EXPR_ADD = 0,   /**< lhs + rhs */
+  ALM_EXPR_SUB,       /**< lhs - rhs */
+  ALM_EXPR_MUL,       /**< lhs * rhs */
+  ALM_EXPR_DIV,       /**< lhs / rhs */
+  ALM_EXPR_POW,       /**< pow(lhs, rhs) */
+  ALM_EXPR_FMAX,      /**< fmax(lhs, rhs) */
+  ALM_EXPR_FMIN,      /**< fmin(lhs, rhs) */
+  ALM_EXPR_EXP,       /**< exp(x) */
+  ALM_EXPR_EXP2,      /**< exp2(x) */
+  ALM_EXPR_EXPM1,     /**< expm1(x) */
+  ALM_EXPR_LOG,       /**< log(x) */
+  ALM_EXPR_LOG2,      /**< log2(x) */
+  ALM_EXPR_LOG10,     /**< log10(x) */
+  ALM_EXPR_LOG1P,     /**< log1p(x) */
+  ALM_EXPR_SIN,       /**< sin(x) */
+  ALM_EXPR_COS,       /**< cos(x) */
+  ALM_EXPR_TAN,       /**< tan(x) */
+  ALM_EXPR_ATAN,      /**< atan(x) */
+  ALM_EXPR_COSH,      /**< cosh(x) */
+  ALM_EXPR_SQRT,      /**< sqrt(x) */
+  ALM_EXPR_CBRT,      /**< cbrt(x) */
+  ALM_EXPR_ERF,       /**< erf(x) */
+  ALM_EXPR_FABS,      /**< fabs(x) */
+  ALM_EXPR_OP_MAX
+} alm_expr_op_t;
+
+/**
+ * @brief A fused element-wise expression.
+ *
+ * The expression is a postfix program over a small value stack. Build it
+ * with alm_expr_init() and the alm_expr_arg()/alm_expr_const()/
+ * alm_expr_affine()/alm_expr_powx()/alm_expr_op() steps, compile it once
+ * with alm_expr_compile() and run it any number of times with
+ * alm_expr_execute() or alm_expr_executef().
+ * The members are private to the library.
+ */
+typedef struct alm_expr {
+  int nops;
+  int depth;
+  int state;
+  struct {
+    int    op;
+    int    arg;
+    double a;
+    double b;
+  } code[ALM_EXPR_MAX_OPS];
+} alm_expr_t;
+
+  /**
+   * @brief Initializes an empty fused expression.
+   * @param expr Expression to initialize.
+   */
+  void alm_expr_init (alm_expr_t *expr);
+
+  /**
+   * @brief Pushes an input array of the expression.
+   * @param expr Expression being built.
+   * @param index Index of the input in the args array passed at execution,
+   *              less than ALM_EXPR_MAX_ARGS.
+   * @return 0 on success, -1 on error.
+   */
+  int alm_expr_arg (alm_expr_t *expr, int index);
+
+  /**
+   * @brief Pushes a constant.
+   * @param expr Expression being built.
+   * @param value Constant value.
+   * @return 0 on success, -1 on error.
+   */
+  int alm_expr_const (alm_expr_t *expr, double value);
+
+  /**
+   * @brief Replaces the top value t with scale * t + shift.
+   * @param expr Expression being built.
+   * @param scale Scale factor.
+   * @param shift Shift added after scaling.
+   * @return 0 on success, -1 on error.
+   */
+  int alm_expr_affine (alm_expr_t *expr, double scale, double shift);
+
+  /**
+   * @brief Replaces the top value t with pow(t, y).
+   * @param expr Expression being built.
+   * @param y Scalar exponent.
+   * @return 0 on success, -1 on error.
+   */
+  int alm_expr_powx (alm_expr_t *expr, double y);
+
+  /**
+   * @brief Applies an element-wise operation to the top of the stack.
+   * @param expr Expression being built.
+   * @param op Operation to apply.
+   * @return 0 on success, -1 on error.
+   */
+  int alm_expr_op (alm_expr_t *expr, alm_expr_op_t op);
+
+  /**
+   * @brief Validates and optimizes an expression for execution.
+   *
+   * The expression must leave exactly one value on the stack. Constants
+   * feeding add, sub, mul and pow are folded into affine and powx steps,
+   * and consecutive affine steps are merged.
+   * @param expr Expression to compile.
+   * @return 0 on success, -1 if any build step failed or the expression
+   *         is incomplete.
+   */
+  int alm_expr_compile (alm_expr_t *expr);
+
+  /**
+   * @brief Evaluates a compiled expression over double arrays in one pass.
+   * @param expr Compiled expression.
+   * @param len Number of elements.
+   * @param args Input arrays, each of length len.
+   * @param dst Output array of length len, may be one of the inputs.
+   * @return 0 on success, -1 if the expression is not compiled.
+   */
+  int alm_expr_execute (const alm_expr_t *expr, size_t len,
+                        const double *const *args, double *dst);
+
+  /**
+   * @brief Evaluates a compiled expression over float arrays in one pass.
+   * @param expr Compiled expression.
+   * @param len Number of elements.
+   * @param args Input arrays, each of length len.
+   * @param dst Output array of length len, may be one of the inputs.
+   * @return 0 on success, -1 if the expression is not compiled.
+   */
+  int alm_expr_executef (const alm_expr_t *expr, size_t len,
+                         const float *const *args, float *dst);
+
+
+/*
+ * Parallel Execution
+ */
+
+/**
+ * @brief A unit of parallel work, called once for every index in
+ *        [0, ntasks) of an executor run.
+ */
+typedef void (*alm_task_t)(void *arg, size_t index);
+
+/**
+ * @brief Runs task(arg, i) exactly once for every i in [0, ntasks), possibly
+ *        concurrently, and returns when all of them have completed.
+ *
+ * A caller supplied executor lets the library share the threads of an
+ * application runtime. With OpenMP for example:
+ * @code
+ * static void omp_exec(void *ctx, size_t ntasks, alm_task_t task, void *arg)
+ * {
+ *     #pragma omp parallel for schedule(static)
+ *     for (size_t i = 0; i < ntasks; i++)
+ *         task(arg, i);
+ * }
+ * @endcode
+ * A TBB executor calls task() from tbb::parallel_for with a
+ * static_partitioner the same way.
+ */
+typedef void (*alm_executor_t)(void *ctx, size_t ntasks, alm_task_t task,
+                               void *arg);
+
+  /**
+   * @brief Sets the number of threads used by the 64-bit length array
+   *        functions (amd_vrda_<fn>i_64, amd_vrsa_<fn>fi_64), by
+   *        alm_expr_execute()/alm_expr_executef() and by
+   *        alm_randn()/alm_randnf().
+   *
+   * The default is 1, which keeps every call on the calling thread. Other
+   * array functions are not affected.
+   * @param nthreads Number of threads, 0 for all online processors. Values
+   *                 above 256 are clamped.
+   * @return 0 on success, -1 if nthreads is negative.
+   */
+  int alm_set_num_threads (int nthreads);
+
+  /**
+   * @brief Returns the number of threads set with alm_set_num_threads().
+   */
+  int alm_get_num_threads (void);
+
+  /**
+   * @brief Sets the minimum number of elements handled by one thread.
+   *
+   * Calls shorter than twice the grain size run on the calling thread.
+   * @param grain Minimum elements per thread, 0 restores the default of
+   *              65536.
+   */
+  void alm_set_grain_size (size_t grain);
+
+  /**
+   * @brief Returns the grain size set with alm_set_grain_size().
+   */
+  size_t alm_get_grain_size (void);
+
+  /**
+   * @brief Selects the executor running parallel calls.
+   *
+   * Work is always split into contiguous, statically assigned partitions
+   * that only depend on the length, the thread count and the grain size,
+   * so an executor that maps index i to the same thread on every run keeps
+   * first-touch page placement intact. Library calls made from inside a
+   * task run serially.
+   *
+   * The executor can be replaced while other threads are in parallel
+   * calls. Each call uses the exec/ctx pair current when it starts, so the
+   * previous executor and ctx must stay usable until those calls return.
+   * @param exec Executor, NULL restores the built-in thread pool.
+   * @param ctx Opaque pointer passed to exec.
+   */
+  void alm_set_executor (alm_executor_t exec, void *ctx);
+
+/*
+ * Accuracy Tiers
+ */
+
+/**
+ * @brief Accuracy tiers selectable at run time.
+ */
+typedef enum {
+  ALM_ACC_1ULP = 0,       /**< Default implementations, max 1 ULP */
+  ALM_ACC_FAST,           /**< Faster, max 4 ULP, reduced special case care */
+  ALM_ACC_CR              /**< Correctly rounded */
+} alm_accuracy_t;
+
+  /**
+   * @brief Selects the accuracy tier of every function.
+   *
+   * Each variant that has an implementation of the tier switches to it,
+   * the others keep ALM_ACC_1ULP. Tiers set with alm_set_func_accuracy()
+   * are kept. The fast tier covers the scalar acos, asin, atan, cos, sin,
+   * tan, erf, exp, log and pow (the implementations of libalmfast), the
+   * vector and array exp, log, rsqrt and recip; the correctly rounded
+   * tier covers rsqrt and recip.
+   *
+   * The switch replaces the library's dispatch pointers. Select tiers
+   * from one thread, before the functions are used concurrently: a call
+   * running while the tier changes completes with either implementation.
+   * @param acc Tier.
+   * @return 0 on success, -1 if acc is invalid.
+   */
+  int alm_set_accuracy (alm_accuracy_t acc);
+
+  /**
+   * @brief Returns the tier set with alm_set_accuracy().
+   */
+  alm_accuracy_t alm_get_accuracy (void);
+
+  /**
+   * @brief Selects the accuracy tier of one function variant.
+   *
+   * The variant is named without the amd_ prefix, e.g. "exp", "logf",
+   * "vrs8_expf" or "vrda_log", so that, say, bulk vrda_exp calls can run
+   * in the fast tier while scalar exp stays within 1 ULP.
+   * @param name Function variant.
+   * @param acc Tier, or -1 to follow alm_set_accuracy() again.
+   * @return The tier now in effect for the variant, which is
+   *         ALM_ACC_1ULP where it has no implementation of acc, or -1 if
+   *         name or acc is invalid.
+   */
+  int alm_set_func_accuracy (const char *name, int acc);
+
+  /**
+   * @brief Returns the tier in effect for one function variant, or -1 if
+   *        name is not a function variant of the library.
+   */
+  int alm_get_func_accuracy (const char *name);
+
+/*
+ * Statistics
+ */
+
+/**
+ * @brief Counters of one function variant, filled by alm_stats_get().
+ */
+typedef struct {
+  const char *name;       /**< Variant without the amd_ prefix, e.g. "vrd4_exp" */
+  uint64_t calls;         /**< Calls of amd_<name> */
+  uint64_t elements;      /**< Elements computed by those calls */
+  uint64_t special;       /**< Vector lanes recomputed by the scalar function */
+  uint64_t reductions;    /**< Large-argument reductions modulo pi/2 */
+  uint64_t errors;        /**< Calls of the special-case (exception) handler */
+} alm_stats_t;
+
+  /**
+   * @brief Reads the call and slow-path counters.
+   *
+   * Counters are kept by libraries built with ALM_STATS (the CMake option
+   * LIBM_ENABLE_STATS, or use_stats=1 with SCons), striped across threads
+   * so that concurrent calls do not contend. The scalar fallbacks, pi/2
+   * reductions and special-case handlers count for the variant they are
+   * compiled in, e.g. a vrd4_exp lane recomputed by scalar exp counts in
+   * the special column of "vrd4_exp", the reduction of that lane for a
+   * trigonometric function in "sin".
+   *
+   * Setting the environment variable AOCL_LIBM_STATS to 1 prints the
+   * table to stderr at exit, any other value writes it to that file.
+   * @param stats Array of n rows, filled with the variants that have a
+   *              non-zero counter, sorted by name. May be NULL.
+   * @param n Size of stats.
+   * @return Number of variants with a non-zero counter, which may be more
+   *         than n, or -1 if the library was built without ALM_STATS.
+   */
+  int alm_stats_get (alm_stats_t *stats, int n);
+
+  /**
+   * @brief Sets every counter to zero.
+   */
+  void alm_stats_reset (void);
+
+  /**
+   * @brief Writes the non-zero counters as a table.
+   * @param path Output file, NULL for stderr.
+   * @return 0 on success, -1 if the file cannot be written or the library
+   *         was built without ALM_STATS.
+   */
+  int alm_stats_dump (const char *path);
+
+/*
+ * Random Numbers
+ */
+
+/**
+ * @brief Transforms turning uniform random numbers into normal variates.
+ */
+typedef enum {
+  ALM_RANDN_ICDF = 0,     /**< Inverse CDF, one uniform per variate */
+  ALM_RANDN_BOX_MULLER    /**< Box-Muller, two uniforms per pair of variates */
+} alm_randn_method_t;
+
+  /**
+   * @brief Fills a double array with standard normal random variates.
+   *
+   * The uniforms come from a Philox4x32-10 counter based generator keyed
+   * with seed. Element i of dst is element offset + i of the stream, and
+   * depends only on method, seed and offset + i, so a call can be split in
+   * ranges with matching offsets, e.g. to generate disjoint parts of one
+   * sequence on several threads, without changing the values. Long calls
+   * are split across the threads set with alm_set_num_threads().
+   * @param method Transform, ALM_RANDN_ICDF or ALM_RANDN_BOX_MULLER.
+   * @param seed Stream key, streams of different seeds are independent.
+   * @param offset Position of dst[0] in the stream.
+   * @param len Number of elements.
+   * @param dst Output array.
+   * @return 0 on success, -1 if method is invalid or dst is NULL.
+   */
+  int alm_randn (alm_randn_method_t method, uint64_t seed, uint64_t offset,
+                 size_t len, double *dst);
+
+  /**
+   * @brief Fills a float array with standard normal random variates.
+   *
+   * Same as alm_randn(), from a separate stream of 24-bit uniforms.
+   * @param method Transform, ALM_RANDN_ICDF or ALM_RANDN_BOX_MULLER.
+   * @param seed Stream key, streams of different seeds are independent.
+   * @param offset Position of dst[0] in the stream.
+   * @param len Number of elements.
+   * @param dst Output array.
+   * @return 0 on success, -1 if method is invalid or dst is NULL.
+   */
+  int alm_randnf (alm_randn_method_t method, uint64_t seed, uint64_t offset,
+                  size_t len, float *dst);
+
+  /**
+   * @brief Single threaded kernel of alm_randn().
+   * @param method Transform, an alm_randn_method_t value. Nothing is
+   *               written for an invalid method.
+   * @param seed Stream key.
+   * @param offset Position of dst[0] in the stream.
+   * @param len Number of elements.
+   * @param dst Output array.
+   */
+  void amd_vrda_randn (int method, uint64_t seed, uint64_t offset, int len,
+                       double *dst);
+
+  /**
+   * @brief Single threaded kernel of alm_randnf().
+   * @param method Transform, an alm_randn_method_t value. Nothing is
+   *               written for an invalid method.
+   * @param seed Stream key.
+   * @param offset Position of dst[0] in the stream.
+   * @param len Number of elements.
+   * @param dst Output array.
+   */
+  void amd_vrsa_randnf (int method, uint64_t seed, uint64_t offset, int len,
+                        float *dst);
+
+/*
+ * Reductions
+ */
+
+  /**
+   * @brief Computes the sum of exp() over a double array without storing
+   *        the intermediate values.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @return sum(exp(src[i])), 0 if len <= 0.
+   */
+  double amd_vrda_sumexp (int len, const double *src);
+
+  /**
+   * @brief Computes the sum of exp() over a float array without storing
+   *        the intermediate values.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @return sum(expf(src[i])), accumulated in double, 0 if len <= 0.
+   */
+  float amd_vrsa_sumexpf (int len, const float *src);
+
+  /**
+   * @brief Computes log(sum(exp(src[i]))) of a double array.
+   *
+   * The maximum is subtracted before exponentiation, so the result is
+   * finite whenever the inputs are, e.g. for softmax normalisers.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @return The log-sum-exp of src, -Inf if len <= 0.
+   */
+  double amd_vrda_logsumexp (int len, const double *src);
+
+  /**
+   * @brief Computes log(sum(exp(src[i]))) of a float array.
+   *
+   * The maximum is subtracted before exponentiation, so the result is
+   * finite whenever the inputs are.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @return The log-sum-exp of src, -Inf if len <= 0.
+   */
+  float amd_vrsa_logsumexpf (int len, const float *src);
+
+  /**
+   * @brief Computes the sum of log() over a double array without storing
+   *        the intermediate values.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @return sum(log(src[i])), 0 if len <= 0.
+   */
+  double amd_vrda_sumlog (int len, const double *src);
+
+  /**
+   * @brief Computes the sum of log() over a float array, e.g. a
+   *        log-likelihood.
+   *
+   * Positive normal inputs are reduced through the product of their
+   * mantissas and the sum of their exponents, needing a single log.
+   * @param len Number of elements.
+   * @param src Input array.
+   * @return sum(logf(src[i])), 0 if len <= 0.
+   */
+  float amd_vrsa_sumlogf (int len, const float *src);
+
+/*
+ * Half precision
+ *
+ * IEEE binary16 values are passed as their 16-bit patterns. The functions
+ * widen to single precision with F16C (AVX512F for the 32-wide variants),
+ * evaluate shortened polynomials and round once on the way back, to within
+ * 1 FP16 ulp.
+ */
+
+  /**
+   * @brief Bit pattern of an IEEE 754 binary16 value.
+   */
+  typedef unsigned short alm_f16_t;
+
+  /**
+   * @brief Computes the exponential of a half-precision value.
+   * @param x Input value.
+   * @return The exponential of x.
+   */
+  alm_f16_t amd_expf16 (alm_f16_t x);
+
+  /**
+   * @brief Computes the natural logarithm of a half-precision value.
+   * @param x Input value.
+   * @return The natural logarithm of x.
+   */
+  alm_f16_t amd_logf16 (alm_f16_t x);
+
+  /**
+   * @brief Computes the square root of a half-precision value.
+   * @param x Input value.
+   * @return The square root of x.
+   */
+  alm_f16_t amd_sqrtf16 (alm_f16_t x);
+
+  /**
+   * @brief Computes the hyperbolic tangent of a half-precision value.
+   * @param x Input value.
+   * @return The hyperbolic tangent of x.
+   */
+  alm_f16_t amd_tanhf16 (alm_f16_t x);
+
+  /**
+   * @brief Computes the error function of a half-precision value.
+   * @param x Input value.
+   * @return The error function of x.
+   */
+  alm_f16_t amd_erff16 (alm_f16_t x);
+
+  /**
+   * @brief Computes the sine of a half-precision value.
+   * @param x Input value.
+   * @return The sine of x.
+   */
+  alm_f16_t amd_sinf16 (alm_f16_t x);
+
+  /**
+   * @brief Computes the cosine of a half-precision value.
+   * @param x Input value.
+   * @return The cosine of x.
+   */
+  alm_f16_t amd_cosf16 (alm_f16_t x);
+
+#if defined (__AVX2__)
+  /**
+   * @brief Computes the exponential of 8 half-precision values.
+   * @param x Input vector of 8 binary16 values.
+   * @return Result vector of 8 binary16 values.
+   */
+  __m128i amd_vrh8_expf16 (__m128i x);
+
+  /**
+   * @brief Computes the exponential of 16 half-precision values.
+   * @param x Input vector of 16 binary16 values.
+   * @return Result vector of 16 binary16 values.
+   */
+  __m256i amd_vrh16_expf16 (__m256i x);
+
+  /**
+   * @brief Computes the exponential elementwise for a half-precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrha_expf16 (int len, const alm_f16_t *src, alm_f16_t *dst);
+
+  /**
+   * @brief Computes the natural logarithm of 8 half-precision values.
+   * @param x Input vector of 8 binary16 values.
+   * @return Result vector of 8 binary16 values.
+   */
+  __m128i amd_vrh8_logf16 (__m128i x);
+
+  /**
+   * @brief Computes the natural logarithm of 16 half-precision values.
+   * @param x Input vector of 16 binary16 values.
+   * @return Result vector of 16 binary16 values.
+   */
+  __m256i amd_vrh16_logf16 (__m256i x);
+
+  /**
+   * @brief Computes the natural logarithm elementwise for a half-precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrha_logf16 (int len, const alm_f16_t *src, alm_f16_t *dst);
+
+  /**
+   * @brief Computes the square root of 8 half-precision values.
+   * @param x Input vector of 8 binary16 values.
+   * @return Result vector of 8 binary16 values.
+   */
+  __m128i amd_vrh8_sqrtf16 (__m128i x);
+
+  /**
+   * @brief Computes the square root of 16 half-precision values.
+   * @param x Input vector of 16 binary16 values.
+   * @return Result vector of 16 binary16 values.
+   */
+  __m256i amd_vrh16_sqrtf16 (__m256i x);
+
+  /**
+   * @brief Computes the square root elementwise for a half-precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrha_sqrtf16 (int len, const alm_f16_t *src, alm_f16_t *dst);
+
+  /**
+   * @brief Computes the hyperbolic tangent of 8 half-precision values.
+   * @param x Input vector of 8 binary16 values.
+   * @return Result vector of 8 binary16 values.
+   */
+  __m128i amd_vrh8_tanhf16 (__m128i x);
+
+  /**
+   * @brief Computes the hyperbolic tangent of 16 half-precision values.
+   * @param x Input vector of 16 binary16 values.
+   * @return Result vector of 16 binary16 values.
+   */
+  __m256i amd_vrh16_tanhf16 (__m256i x);
+
+  /**
+   * @brief Computes the hyperbolic tangent elementwise for a half-precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrha_tanhf16 (int len, const alm_f16_t *src, alm_f16_t *dst);
+
+  /**
+   * @brief Computes the error function of 8 half-precision values.
+   * @param x Input vector of 8 binary16 values.
+   * @return Result vector of 8 binary16 values.
+   */
+  __m128i amd_vrh8_erff16 (__m128i x);
+
+  /**
+   * @brief Computes the error function of 16 half-precision values.
+   * @param x Input vector of 16 binary16 values.
+   * @return Result vector of 16 binary16 values.
+   */
+  __m256i amd_vrh16_erff16 (__m256i x);
+
+  /**
+   * @brief Computes the error function elementwise for a half-precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrha_erff16 (int len, const alm_f16_t *src, alm_f16_t *dst);
+
+  /**
+   * @brief Computes the sine of 8 half-precision values.
+   * @param x Input vector of 8 binary16 values.
+   * @return Result vector of 8 binary16 values.
+   */
+  __m128i amd_vrh8_sinf16 (__m128i x);
+
+  /**
+   * @brief Computes the sine of 16 half-precision values.
+   * @param x Input vector of 16 binary16 values.
+   * @return Result vector of 16 binary16 values.
+   */
+  __m256i amd_vrh16_sinf16 (__m256i x);
+
+  /**
+   * @brief Computes the sine elementwise for a half-precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrha_sinf16 (int len, const alm_f16_t *src, alm_f16_t *dst);
+
+  /**
+   * @brief Computes the cosine of 8 half-precision values.
+   * @param x Input vector of 8 binary16 values.
+   * @return Result vector of 8 binary16 values.
+   */
+  __m128i amd_vrh8_cosf16 (__m128i x);
+
+  /**
+   * @brief Computes the cosine of 16 half-precision values.
+   * @param x Input vector of 16 binary16 values.
+   * @return Result vector of 16 binary16 values.
+   */
+  __m256i amd_vrh16_cosf16 (__m256i x);
+
+  /**
+   * @brief Computes the cosine elementwise for a half-precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrha_cosf16 (int len, const alm_f16_t *src, alm_f16_t *dst);
+#endif /* __AVX2__ */
+
+#if defined (__AVX512F__)
+  /**
+   * @brief Computes the exponential of 32 half-precision values.
+   * @param x Input vector of 32 binary16 values.
+   * @return Result vector of 32 binary16 values.
+   */
+  __m512i amd_vrh32_expf16 (__m512i x);
+
+  /**
+   * @brief Computes the natural logarithm of 32 half-precision values.
+   * @param x Input vector of 32 binary16 values.
+   * @return Result vector of 32 binary16 values.
+   */
+  __m512i amd_vrh32_logf16 (__m512i x);
+
+  /**
+   * @brief Computes the square root of 32 half-precision values.
+   * @param x Input vector of 32 binary16 values.
+   * @return Result vector of 32 binary16 values.
+   */
+  __m512i amd_vrh32_sqrtf16 (__m512i x);
+
+  /**
+   * @brief Computes the hyperbolic tangent of 32 half-precision values.
+   * @param x Input vector of 32 binary16 values.
+   * @return Result vector of 32 binary16 values.
+   */
+  __m512i amd_vrh32_tanhf16 (__m512i x);
+
+  /**
+   * @brief Computes the error function of 32 half-precision values.
+   * @param x Input vector of 32 binary16 values.
+   * @return Result vector of 32 binary16 values.
+   */
+  __m512i amd_vrh32_erff16 (__m512i x);
+
+  /**
+   * @brief Computes the sine of 32 half-precision values.
+   * @param x Input vector of 32 binary16 values.
+   * @return Result vector of 32 binary16 values.
+   */
+  __m512i amd_vrh32_sinf16 (__m512i x);
+
+  /**
+   * @brief Computes the cosine of 32 half-precision values.
+   * @param x Input vector of 32 binary16 values.
+   * @return Result vector of 32 binary16 values.
+   */
+  __m512i amd_vrh32_cosf16 (__m512i x);
+#endif /* __AVX512F__ */
+
+/*
+ * bfloat16
+ *
+ * BF16 values are passed as their 16-bit patterns, the upper half of the
+ * IEEE binary32 encoding. The functions widen to single precision, evaluate
+ * shortened polynomials and round to nearest even on the way back, to within
+ * 1 BF16 ulp. Zen4 and later use AVX512_BF16, other CPUs an AVX2 emulation
+ * with identical results. Subnormal results are flushed to zero, as
+ * VCVTNEPS2BF16 does.
+ */
+
+  /**
+   * @brief Bit pattern of a bfloat16 value.
+   */
+  typedef unsigned short alm_bf16_t;
+
+#if defined (__AVX2__)
+  /**
+   * @brief Computes the exponential elementwise for a bfloat16 array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrba_expbf16 (int len, const alm_bf16_t *src, alm_bf16_t *dst);
+
+  /**
+   * @brief Computes the natural logarithm elementwise for a bfloat16 array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrba_logbf16 (int len, const alm_bf16_t *src, alm_bf16_t *dst);
+
+  /**
+   * @brief Computes the hyperbolic tangent elementwise for a bfloat16 array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrba_tanhbf16 (int len, const alm_bf16_t *src, alm_bf16_t *dst);
+
+  /**
+   * @brief Computes the error function elementwise for a bfloat16 array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrba_erfbf16 (int len, const alm_bf16_t *src, alm_bf16_t *dst);
+
+  /**
+   * @brief Computes the logistic sigmoid 1/(1 + exp(-x)) elementwise for a bfloat16 array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrba_sigmoidbf16 (int len, const alm_bf16_t *src, alm_bf16_t *dst);
+
+  /**
+   * @brief Computes the GELU activation x * Phi(x) elementwise for a bfloat16 array.
+   *
+   * Uses the exact erf form, x * erfc(-x/sqrt(2)) / 2, which stays accurate
+   * in relative terms for negative x.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrba_gelubf16 (int len, const alm_bf16_t *src, alm_bf16_t *dst);
+#endif /* __AVX2__ */
+
+/*
+ * Activation functions
+ *
+ * Sigmoid, softplus, GELU (erf and tanh forms), SiLU and mish, fused into a
+ * single pass: the exponential and logarithm are inlined rather than called,
+ * and the negative tails are scaled so that they neither overflow nor lose
+ * relative accuracy before underflowing to zero. Softmax and log-softmax
+ * read each row twice: once for the maximum and the sum of exponentials
+ * together, once to write the result.
+ */
+
+#if defined (__AVX2__)
+  /**
+   * @brief Computes the logistic sigmoid 1/(1 + exp(-x)) for 8 floats.
+   * @param x Input vector of 8 floats.
+   * @return Result vector of 8 floats.
+   */
+  __m256 amd_vrs8_sigmoidf (__m256 x);
+
+  /**
+   * @brief Computes the softplus log(1 + exp(x)) for 8 floats.
+   * @param x Input vector of 8 floats.
+   * @return Result vector of 8 floats.
+   */
+  __m256 amd_vrs8_softplusf (__m256 x);
+
+  /**
+   * @brief Computes the GELU activation x * Phi(x) for 8 floats.
+   *
+   * Uses the exact erf form, x * erfc(-x/sqrt(2)) / 2.
+   * @param x Input vector of 8 floats.
+   * @return Result vector of 8 floats.
+   */
+  __m256 amd_vrs8_geluf (__m256 x);
+
+  /**
+   * @brief Computes the tanh approximation of GELU,
+   * x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 x^3))) for 8 floats.
+   *
+   * Evaluated as x * sigmoid(2 * sqrt(2/pi) * (x + 0.044715 x^3)).
+   * @param x Input vector of 8 floats.
+   * @return Result vector of 8 floats.
+   */
+  __m256 amd_vrs8_gelu_tanhf (__m256 x);
+
+  /**
+   * @brief Computes the SiLU (swish) activation x * sigmoid(x) for 8 floats.
+   * @param x Input vector of 8 floats.
+   * @return Result vector of 8 floats.
+   */
+  __m256 amd_vrs8_siluf (__m256 x);
+
+  /**
+   * @brief Computes the mish activation x * tanh(softplus(x)) for 8 floats.
+   * @param x Input vector of 8 floats.
+   * @return Result vector of 8 floats.
+   */
+  __m256 amd_vrs8_mishf (__m256 x);
+
+  /**
+   * @brief Computes the logistic sigmoid 1/(1 + exp(-x)) for 4 doubles.
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_sigmoid (__m256d x);
+
+  /**
+   * @brief Computes the softplus log(1 + exp(x)) for 4 doubles.
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_softplus (__m256d x);
+
+  /**
+   * @brief Computes the GELU activation x * Phi(x) for 4 doubles.
+   *
+   * Uses the exact erf form, x * erfc(-x/sqrt(2)) / 2.
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_gelu (__m256d x);
+
+  /**
+   * @brief Computes the tanh approximation of GELU,
+   * x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 x^3))) for 4 doubles.
+   *
+   * Evaluated as x * sigmoid(2 * sqrt(2/pi) * (x + 0.044715 x^3)).
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_gelu_tanh (__m256d x);
+
+  /**
+   * @brief Computes the SiLU (swish) activation x * sigmoid(x) for 4 doubles.
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_silu (__m256d x);
+
+  /**
+   * @brief Computes the mish activation x * tanh(softplus(x)) for 4 doubles.
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_mish (__m256d x);
+
+  /**
+   * @brief Computes the logistic sigmoid 1/(1 + exp(-x)) elementwise for a single precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_sigmoidf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the softplus log(1 + exp(x)) elementwise for a single precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_softplusf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the GELU activation x * Phi(x) elementwise for a single precision array.
+   *
+   * Uses the exact erf form, x * erfc(-x/sqrt(2)) / 2.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_geluf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the tanh approximation of GELU,
+   * x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 x^3))) elementwise for a single precision array.
+   *
+   * Evaluated as x * sigmoid(2 * sqrt(2/pi) * (x + 0.044715 x^3)).
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_gelu_tanhf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the SiLU (swish) activation x * sigmoid(x) elementwise for a single precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_siluf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the mish activation x * tanh(softplus(x)) elementwise for a single precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_mishf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the logistic sigmoid 1/(1 + exp(-x)) elementwise for a double precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_sigmoid (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the softplus log(1 + exp(x)) elementwise for a double precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_softplus (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the GELU activation x * Phi(x) elementwise for a double precision array.
+   *
+   * Uses the exact erf form, x * erfc(-x/sqrt(2)) / 2.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_gelu (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the tanh approximation of GELU,
+   * x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 x^3))) elementwise for a double precision array.
+   *
+   * Evaluated as x * sigmoid(2 * sqrt(2/pi) * (x + 0.044715 x^3)).
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_gelu_tanh (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the SiLU (swish) activation x * sigmoid(x) elementwise for a double precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_silu (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the mish activation x * tanh(softplus(x)) elementwise for a double precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_mish (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the softmax exp(x[i] - max(x)) / sum(exp(x[j] - max(x)))
+   * of a single precision array.
+   *
+   * Reads src once for the maximum and the sum, then once more to write dst.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_softmaxf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the softmax of each row of a single precision matrix.
+   * @param rows Number of rows.
+   * @param cols Number of elements in each row.
+   * @param src Input matrix, row i at src + i * src_stride.
+   * @param src_stride Distance between the input rows, in elements.
+   * @param dst Output matrix, row i at dst + i * dst_stride.
+   * @param dst_stride Distance between the output rows, in elements.
+   */
+  void amd_vrsa_softmax_batchf (int rows, int cols, const float *src, int src_stride,
+                                float *dst, int dst_stride);
+
+  /**
+   * @brief Computes the log-softmax (x[i] - max(x)) - log(sum(exp(x[j] - max(x))))
+   * of a single precision array.
+   *
+   * Reads src once for the maximum and the sum, then once more to write dst.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_log_softmaxf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the log-softmax of each row of a single precision matrix.
+   * @param rows Number of rows.
+   * @param cols Number of elements in each row.
+   * @param src Input matrix, row i at src + i * src_stride.
+   * @param src_stride Distance between the input rows, in elements.
+   * @param dst Output matrix, row i at dst + i * dst_stride.
+   * @param dst_stride Distance between the output rows, in elements.
+   */
+  void amd_vrsa_log_softmax_batchf (int rows, int cols, const float *src, int src_stride,
+                                    float *dst, int dst_stride);
+
+  /**
+   * @brief Computes the softmax exp(x[i] - max(x)) / sum(exp(x[j] - max(x)))
+   * of a double precision array.
+   *
+   * Reads src once for the maximum and the sum, then once more to write dst.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_softmax (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the softmax of each row of a double precision matrix.
+   * @param rows Number of rows.
+   * @param cols Number of elements in each row.
+   * @param src Input matrix, row i at src + i * src_stride.
+   * @param src_stride Distance between the input rows, in elements.
+   * @param dst Output matrix, row i at dst + i * dst_stride.
+   * @param dst_stride Distance between the output rows, in elements.
+   */
+  void amd_vrda_softmax_batch (int rows, int cols, const double *src, int src_stride,
+                               double *dst, int dst_stride);
+
+  /**
+   * @brief Computes the log-softmax (x[i] - max(x)) - log(sum(exp(x[j] - max(x))))
+   * of a double precision array.
+   *
+   * Reads src once for the maximum and the sum, then once more to write dst.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_log_softmax (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the log-softmax of each row of a double precision matrix.
+   * @param rows Number of rows.
+   * @param cols Number of elements in each row.
+   * @param src Input matrix, row i at src + i * src_stride.
+   * @param src_stride Distance between the input rows, in elements.
+   * @param dst Output matrix, row i at dst + i * dst_stride.
+   * @param dst_stride Distance between the output rows, in elements.
+   */
+  void amd_vrda_log_softmax_batch (int rows, int cols, const double *src, int src_stride,
+                                   double *dst, int dst_stride);
+#endif /* __AVX2__ */
+
+#if defined (__AVX512F__)
+  /**
+   * @brief Computes the logistic sigmoid 1/(1 + exp(-x)) for 16 floats.
+   * @param x Input vector of 16 floats.
+   * @return Result vector of 16 floats.
+   */
+  __m512 amd_vrs16_sigmoidf (__m512 x);
+
+  /**
+   * @brief Computes the softplus log(1 + exp(x)) for 16 floats.
+   * @param x Input vector of 16 floats.
+   * @return Result vector of 16 floats.
+   */
+  __m512 amd_vrs16_softplusf (__m512 x);
+
+  /**
+   * @brief Computes the GELU activation x * Phi(x) for 16 floats.
+   *
+   * Uses the exact erf form, x * erfc(-x/sqrt(2)) / 2.
+   * @param x Input vector of 16 floats.
+   * @return Result vector of 16 floats.
+   */
+  __m512 amd_vrs16_geluf (__m512 x);
+
+  /**
+   * @brief Computes the tanh approximation of GELU,
+   * x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 x^3))) for 16 floats.
+   *
+   * Evaluated as x * sigmoid(2 * sqrt(2/pi) * (x + 0.044715 x^3)).
+   * @param x Input vector of 16 floats.
+   * @return Result vector of 16 floats.
+   */
+  __m512 amd_vrs16_gelu_tanhf (__m512 x);
+
+  /**
+   * @brief Computes the SiLU (swish) activation x * sigmoid(x) for 16 floats.
+   * @param x Input vector of 16 floats.
+   * @return Result vector of 16 floats.
+   */
+  __m512 amd_vrs16_siluf (__m512 x);
+
+  /**
+   * @brief Computes the mish activation x * tanh(softplus(x)) for 16 floats.
+   * @param x Input vector of 16 floats.
+   * @return Result vector of 16 floats.
+   */
+  __m512 amd_vrs16_mishf (__m512 x);
+
+  /**
+   * @brief Computes the logistic sigmoid 1/(1 + exp(-x)) for 8 doubles.
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_sigmoid (__m512d x);
+
+  /**
+   * @brief Computes the softplus log(1 + exp(x)) for 8 doubles.
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_softplus (__m512d x);
+
+  /**
+   * @brief Computes the GELU activation x * Phi(x) for 8 doubles.
+   *
+   * Uses the exact erf form, x * erfc(-x/sqrt(2)) / 2.
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_gelu (__m512d x);
+
+  /**
+   * @brief Computes the tanh approximation of GELU,
+   * x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 x^3))) for 8 doubles.
+   *
+   * Evaluated as x * sigmoid(2 * sqrt(2/pi) * (x + 0.044715 x^3)).
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_gelu_tanh (__m512d x);
+
+  /**
+   * @brief Computes the SiLU (swish) activation x * sigmoid(x) for 8 doubles.
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_silu (__m512d x);
+
+  /**
+   * @brief Computes the mish activation x * tanh(softplus(x)) for 8 doubles.
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_mish (__m512d x);
+#endif /* __AVX512F__ */
+
+/*
+ * Reciprocal and reciprocal square root
+ *
+ * Three accuracy tiers, picked by name. The default functions use the IEEE
+ * divide and square root: 1/x is correctly rounded, double 1/sqrt(x) is
+ * within 1.5 ULP and float 1/sqrt(x), evaluated in double, correctly
+ * rounded. The _fast functions refine the hardware estimate (VRSQRT14,
+ * VRCP14 on AVX512, VRSQRTPS, VRCPPS on AVX2) with Newton steps: within
+ * 1 ULP in double, 4 ULP in single precision (about 1 ULP on AVX512).
+ * The _cr functions return the correctly rounded double 1/sqrt(x).
+ * Special values are those of 1/sqrt(x) and 1/x in every tier.
+ */
+
+#if defined (__AVX2__)
+  /**
+   * @brief Computes 1/sqrt(x) for 8 floats.
+   * @param x Input vector of 8 floats.
+   * @return Result vector of 8 floats.
+   */
+  __m256 amd_vrs8_rsqrtf (__m256 x);
+
+  /**
+   * @brief Computes 1/sqrt(x) for 8 floats, fast tier.
+   * @param x Input vector of 8 floats.
+   * @return Result vector of 8 floats.
+   */
+  __m256 amd_vrs8_rsqrt_fastf (__m256 x);
+
+  /**
+   * @brief Computes 1/sqrt(x) for 4 doubles.
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_rsqrt (__m256d x);
+
+  /**
+   * @brief Computes 1/sqrt(x) for 4 doubles, fast tier.
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_rsqrt_fast (__m256d x);
+
+  /**
+   * @brief Computes 1/sqrt(x) for 4 doubles, correctly rounded.
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_rsqrt_cr (__m256d x);
+
+  /**
+   * @brief Computes 1/x for 8 floats.
+   * @param x Input vector of 8 floats.
+   * @return Result vector of 8 floats.
+   */
+  __m256 amd_vrs8_recipf (__m256 x);
+
+  /**
+   * @brief Computes 1/x for 8 floats, fast tier.
+   * @param x Input vector of 8 floats.
+   * @return Result vector of 8 floats.
+   */
+  __m256 amd_vrs8_recip_fastf (__m256 x);
+
+  /**
+   * @brief Computes 1/x for 4 doubles.
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_recip (__m256d x);
+
+  /**
+   * @brief Computes 1/x for 4 doubles, fast tier.
+   * @param x Input vector of 4 doubles.
+   * @return Result vector of 4 doubles.
+   */
+  __m256d amd_vrd4_recip_fast (__m256d x);
+
+  /**
+   * @brief Computes 1/sqrt(x) elementwise for a single precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_rsqrtf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes 1/sqrt(x) elementwise for a single precision array, fast tier.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_rsqrt_fastf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes 1/sqrt(x) elementwise for a double precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_rsqrt (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes 1/sqrt(x) elementwise for a double precision array, fast tier.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_rsqrt_fast (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes 1/sqrt(x) elementwise for a double precision array, correctly rounded.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_rsqrt_cr (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes 1/x elementwise for a single precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_recipf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes 1/x elementwise for a single precision array, fast tier.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrsa_recip_fastf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes 1/x elementwise for a double precision array.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_recip (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes 1/x elementwise for a double precision array, fast tier.
+   * @param len Number of elements.
+   * @param src Input array of length len.
+   * @param dst Output array of length len.
+   */
+  void amd_vrda_recip_fast (int len, const double *src, double *dst);
+#endif /* __AVX2__ */
+
+#if defined (__AVX512F__)
+  /**
+   * @brief Computes 1/sqrt(x) for 16 floats.
+   * @param x Input vector of 16 floats.
+   * @return Result vector of 16 floats.
+   */
+  __m512 amd_vrs16_rsqrtf (__m512 x);
+
+  /**
+   * @brief Computes 1/sqrt(x) for 16 floats, fast tier.
+   * @param x Input vector of 16 floats.
+   * @return Result vector of 16 floats.
+   */
+  __m512 amd_vrs16_rsqrt_fastf (__m512 x);
+
+  /**
+   * @brief Computes 1/sqrt(x) for 8 doubles.
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_rsqrt (__m512d x);
+
+  /**
+   * @brief Computes 1/sqrt(x) for 8 doubles, fast tier.
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_rsqrt_fast (__m512d x);
+
+  /**
+   * @brief Computes 1/sqrt(x) for 8 doubles, correctly rounded.
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_rsqrt_cr (__m512d x);
+
+  /**
+   * @brief Computes 1/x for 16 floats.
+   * @param x Input vector of 16 floats.
+   * @return Result vector of 16 floats.
+   */
+  __m512 amd_vrs16_recipf (__m512 x);
+
+  /**
+   * @brief Computes 1/x for 16 floats, fast tier.
+   * @param x Input vector of 16 floats.
+   * @return Result vector of 16 floats.
+   */
+  __m512 amd_vrs16_recip_fastf (__m512 x);
+
+  /**
+   * @brief Computes 1/x for 8 doubles.
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_recip (__m512d x);
+
+  /**
+   * @brief Computes 1/x for 8 doubles, fast tier.
+   * @param x Input vector of 8 doubles.
+   * @return Result vector of 8 doubles.
+   */
+  __m512d amd_vrd8_recip_fast (__m512d x);
+#endif /* __AVX512F__ */
+
+/*
+ * Complex functions
+ *
+ * The vector variants take and return complex values in split form, real
+ * parts in one register and imaginary parts in another. The interleaved
+ * array variants take (real, imaginary) pairs, the layout of C99 complex
+ * and std::complex arrays; the _split array variants take separate real and
+ * imaginary arrays. Lanes with infinite, NaN or zero inputs, or whose
+ * results overflow or underflow, are computed by the scalar functions, so
+ * special values follow the scalar function of the same name. cabs and
+ * carg return real results: one register, or one real per element in the
+ * arrays. Single precision is evaluated in double precision.
+ */
+
+#if defined (__AVX2__)
+  /**
+   * @brief Computes the complex exponential exp(x) for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz4_cexp (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+
+  /**
+   * @brief Computes the complex natural logarithm log(x) for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz4_clog (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+
+  /**
+   * @brief Computes the complex power x^y for 4 complex doubles, in split form.
+   * @param xre Real parts of the bases.
+   * @param xim Imaginary parts of the bases.
+   * @param yre Real parts of the exponents.
+   * @param yim Imaginary parts of the exponents.
+   * @param zre Receives the real parts of the results.
+   * @param zim Receives the imaginary parts of the results.
+   */
+  void amd_vrz4_cpow (__m256d xre, __m256d xim, __m256d yre, __m256d yim,
+                      __m256d *zre, __m256d *zim);
+
+  /**
+   * @brief Computes the complex square root sqrt(x) for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz4_csqrt (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+
+  /**
+   * @brief Computes the magnitude |x| for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @return The 4 results.
+   */
+  __m256d amd_vrz4_cabs (__m256d xre, __m256d xim);
+
+  /**
+   * @brief Computes the argument arg(x) for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @return The 4 results.
+   */
+  __m256d amd_vrz4_carg (__m256d xre, __m256d xim);
+
+  /**
+   * @brief Computes the complex sine sin(x) for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz4_csin (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+
+  /**
+   * @brief Computes the complex cosine cos(x) for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz4_ccos (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+
+  /**
+   * @brief Computes the complex tangent tan(x) for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz4_ctan (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic sine sinh(x) for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz4_csinh (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic cosine cosh(x) for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz4_ccosh (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic tangent tanh(x) for 4 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz4_ctanh (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+
+  /**
+   * @brief Computes the complex exponential exp(x) for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc8_cexpf (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+
+  /**
+   * @brief Computes the complex natural logarithm log(x) for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc8_clogf (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+
+  /**
+   * @brief Computes the complex power x^y for 8 complex floats, in split form.
+   * @param xre Real parts of the bases.
+   * @param xim Imaginary parts of the bases.
+   * @param yre Real parts of the exponents.
+   * @param yim Imaginary parts of the exponents.
+   * @param zre Receives the real parts of the results.
+   * @param zim Receives the imaginary parts of the results.
+   */
+  void amd_vrc8_cpowf (__m256 xre, __m256 xim, __m256 yre, __m256 yim,
+                       __m256 *zre, __m256 *zim);
+
+  /**
+   * @brief Computes the complex square root sqrt(x) for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc8_csqrtf (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+
+  /**
+   * @brief Computes the magnitude |x| for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @return The 8 results.
+   */
+  __m256 amd_vrc8_cabsf (__m256 xre, __m256 xim);
+
+  /**
+   * @brief Computes the argument arg(x) for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @return The 8 results.
+   */
+  __m256 amd_vrc8_cargf (__m256 xre, __m256 xim);
+
+  /**
+   * @brief Computes the complex sine sin(x) for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc8_csinf (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+
+  /**
+   * @brief Computes the complex cosine cos(x) for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc8_ccosf (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+
+  /**
+   * @brief Computes the complex tangent tan(x) for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc8_ctanf (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic sine sinh(x) for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc8_csinhf (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic cosine cosh(x) for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc8_ccoshf (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic tangent tanh(x) for 8 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc8_ctanhf (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+
+  /**
+   * @brief Computes the complex exponential exp(x) elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrca_cexpf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the complex exponential exp(x) elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrca_cexpf_split (int len, const float *src_re, const float *src_im,
+                             float *dst_re, float *dst_im);
+
+  /**
+   * @brief Computes the complex exponential exp(x) elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrza_cexp (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the complex exponential exp(x) elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrza_cexp_split (int len, const double *src_re, const double *src_im,
+                            double *dst_re, double *dst_im);
+
+  /**
+   * @brief Computes the complex natural logarithm log(x) elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrca_clogf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the complex natural logarithm log(x) elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrca_clogf_split (int len, const float *src_re, const float *src_im,
+                             float *dst_re, float *dst_im);
+
+  /**
+   * @brief Computes the complex natural logarithm log(x) elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrza_clog (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the complex natural logarithm log(x) elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrza_clog_split (int len, const double *src_re, const double *src_im,
+                            double *dst_re, double *dst_im);
+
+  /**
+   * @brief Computes the complex power x^y elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param x Bases, len (real, imaginary) pairs.
+   * @param y Exponents, len (real, imaginary) pairs.
+   * @param z Results, len (real, imaginary) pairs.
+   */
+  void amd_vrca_cpowf (int len, const float *x, const float *y, float *z);
+
+  /**
+   * @brief Computes the complex power x^y elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param x_re Real parts of the bases.
+   * @param x_im Imaginary parts of the bases.
+   * @param y_re Real parts of the exponents.
+   * @param y_im Imaginary parts of the exponents.
+   * @param z_re Real parts of the results.
+   * @param z_im Imaginary parts of the results.
+   */
+  void amd_vrca_cpowf_split (int len, const float *x_re, const float *x_im,
+                             const float *y_re, const float *y_im,
+                             float *z_re, float *z_im);
+
+  /**
+   * @brief Computes the complex power x^y elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param x Bases, len (real, imaginary) pairs.
+   * @param y Exponents, len (real, imaginary) pairs.
+   * @param z Results, len (real, imaginary) pairs.
+   */
+  void amd_vrza_cpow (int len, const double *x, const double *y, double *z);
+
+  /**
+   * @brief Computes the complex power x^y elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param x_re Real parts of the bases.
+   * @param x_im Imaginary parts of the bases.
+   * @param y_re Real parts of the exponents.
+   * @param y_im Imaginary parts of the exponents.
+   * @param z_re Real parts of the results.
+   * @param z_im Imaginary parts of the results.
+   */
+  void amd_vrza_cpow_split (int len, const double *x_re, const double *x_im,
+                            const double *y_re, const double *y_im,
+                            double *z_re, double *z_im);
+
+  /**
+   * @brief Computes the complex square root sqrt(x) elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrca_csqrtf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the complex square root sqrt(x) elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrca_csqrtf_split (int len, const float *src_re, const float *src_im,
+                              float *dst_re, float *dst_im);
+
+  /**
+   * @brief Computes the complex square root sqrt(x) elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrza_csqrt (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the complex square root sqrt(x) elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrza_csqrt_split (int len, const double *src_re, const double *src_im,
+                             double *dst_re, double *dst_im);
+
+  /**
+   * @brief Computes the magnitude |x| elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len real results.
+   */
+  void amd_vrca_cabsf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the magnitude |x| elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst Output array of len real results.
+   */
+  void amd_vrca_cabsf_split (int len, const float *src_re, const float *src_im,
+                             float *dst);
+
+  /**
+   * @brief Computes the magnitude |x| elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len real results.
+   */
+  void amd_vrza_cabs (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the magnitude |x| elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst Output array of len real results.
+   */
+  void amd_vrza_cabs_split (int len, const double *src_re, const double *src_im,
+                            double *dst);
+
+  /**
+   * @brief Computes the argument arg(x) elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len real results.
+   */
+  void amd_vrca_cargf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the argument arg(x) elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst Output array of len real results.
+   */
+  void amd_vrca_cargf_split (int len, const float *src_re, const float *src_im,
+                             float *dst);
+
+  /**
+   * @brief Computes the argument arg(x) elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len real results.
+   */
+  void amd_vrza_carg (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the argument arg(x) elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst Output array of len real results.
+   */
+  void amd_vrza_carg_split (int len, const double *src_re, const double *src_im,
+                            double *dst);
+
+  /**
+   * @brief Computes the complex sine sin(x) elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrca_csinf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the complex sine sin(x) elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrca_csinf_split (int len, const float *src_re, const float *src_im,
+                             float *dst_re, float *dst_im);
+
+  /**
+   * @brief Computes the complex sine sin(x) elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrza_csin (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the complex sine sin(x) elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrza_csin_split (int len, const double *src_re, const double *src_im,
+                            double *dst_re, double *dst_im);
+
+  /**
+   * @brief Computes the complex cosine cos(x) elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrca_ccosf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the complex cosine cos(x) elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrca_ccosf_split (int len, const float *src_re, const float *src_im,
+                             float *dst_re, float *dst_im);
+
+  /**
+   * @brief Computes the complex cosine cos(x) elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrza_ccos (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the complex cosine cos(x) elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrza_ccos_split (int len, const double *src_re, const double *src_im,
+                            double *dst_re, double *dst_im);
+
+  /**
+   * @brief Computes the complex tangent tan(x) elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrca_ctanf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the complex tangent tan(x) elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrca_ctanf_split (int len, const float *src_re, const float *src_im,
+                             float *dst_re, float *dst_im);
+
+  /**
+   * @brief Computes the complex tangent tan(x) elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrza_ctan (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the complex tangent tan(x) elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrza_ctan_split (int len, const double *src_re, const double *src_im,
+                            double *dst_re, double *dst_im);
+
+  /**
+   * @brief Computes the complex hyperbolic sine sinh(x) elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrca_csinhf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the complex hyperbolic sine sinh(x) elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrca_csinhf_split (int len, const float *src_re, const float *src_im,
+                              float *dst_re, float *dst_im);
+
+  /**
+   * @brief Computes the complex hyperbolic sine sinh(x) elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrza_csinh (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the complex hyperbolic sine sinh(x) elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrza_csinh_split (int len, const double *src_re, const double *src_im,
+                             double *dst_re, double *dst_im);
+
+  /**
+   * @brief Computes the complex hyperbolic cosine cosh(x) elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrca_ccoshf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the complex hyperbolic cosine cosh(x) elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrca_ccoshf_split (int len, const float *src_re, const float *src_im,
+                              float *dst_re, float *dst_im);
+
+  /**
+   * @brief Computes the complex hyperbolic cosine cosh(x) elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrza_ccosh (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the complex hyperbolic cosine cosh(x) elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrza_ccosh_split (int len, const double *src_re, const double *src_im,
+                             double *dst_re, double *dst_im);
+
+  /**
+   * @brief Computes the complex hyperbolic tangent tanh(x) elementwise for an interleaved single precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrca_ctanhf (int len, const float *src, float *dst);
+
+  /**
+   * @brief Computes the complex hyperbolic tangent tanh(x) elementwise for a single precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrca_ctanhf_split (int len, const float *src_re, const float *src_im,
+                              float *dst_re, float *dst_im);
+
+  /**
+   * @brief Computes the complex hyperbolic tangent tanh(x) elementwise for an interleaved double precision complex array.
+   * @param len Number of complex elements.
+   * @param src Input array of len (real, imaginary) pairs.
+   * @param dst Output array of len (real, imaginary) pairs.
+   */
+  void amd_vrza_ctanh (int len, const double *src, double *dst);
+
+  /**
+   * @brief Computes the complex hyperbolic tangent tanh(x) elementwise for a double precision complex array
+   * stored as separate real and imaginary arrays.
+   * @param len Number of complex elements.
+   * @param src_re Real parts of the inputs.
+   * @param src_im Imaginary parts of the inputs.
+   * @param dst_re Real parts of the results.
+   * @param dst_im Imaginary parts of the results.
+   */
+  void amd_vrza_ctanh_split (int len, const double *src_re, const double *src_im,
+                             double *dst_re, double *dst_im);
+#endif /* __AVX2__ */
+
+#if defined (__AVX512F__)
+  /**
+   * @brief Computes the complex exponential exp(x) for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz8_cexp (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+
+  /**
+   * @brief Computes the complex natural logarithm log(x) for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz8_clog (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+
+  /**
+   * @brief Computes the complex power x^y for 8 complex doubles, in split form.
+   * @param xre Real parts of the bases.
+   * @param xim Imaginary parts of the bases.
+   * @param yre Real parts of the exponents.
+   * @param yim Imaginary parts of the exponents.
+   * @param zre Receives the real parts of the results.
+   * @param zim Receives the imaginary parts of the results.
+   */
+  void amd_vrz8_cpow (__m512d xre, __m512d xim, __m512d yre, __m512d yim,
+                      __m512d *zre, __m512d *zim);
+
+  /**
+   * @brief Computes the complex square root sqrt(x) for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz8_csqrt (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+
+  /**
+   * @brief Computes the magnitude |x| for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @return The 8 results.
+   */
+  __m512d amd_vrz8_cabs (__m512d xre, __m512d xim);
+
+  /**
+   * @brief Computes the argument arg(x) for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @return The 8 results.
+   */
+  __m512d amd_vrz8_carg (__m512d xre, __m512d xim);
+
+  /**
+   * @brief Computes the complex sine sin(x) for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz8_csin (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+
+  /**
+   * @brief Computes the complex cosine cos(x) for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz8_ccos (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+
+  /**
+   * @brief Computes the complex tangent tan(x) for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz8_ctan (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic sine sinh(x) for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz8_csinh (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic cosine cosh(x) for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz8_ccosh (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic tangent tanh(x) for 8 complex doubles, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrz8_ctanh (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+
+  /**
+   * @brief Computes the complex exponential exp(x) for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc16_cexpf (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+
+  /**
+   * @brief Computes the complex natural logarithm log(x) for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc16_clogf (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+
+  /**
+   * @brief Computes the complex power x^y for 16 complex floats, in split form.
+   * @param xre Real parts of the bases.
+   * @param xim Imaginary parts of the bases.
+   * @param yre Real parts of the exponents.
+   * @param yim Imaginary parts of the exponents.
+   * @param zre Receives the real parts of the results.
+   * @param zim Receives the imaginary parts of the results.
+   */
+  void amd_vrc16_cpowf (__m512 xre, __m512 xim, __m512 yre, __m512 yim,
+                        __m512 *zre, __m512 *zim);
+
+  /**
+   * @brief Computes the complex square root sqrt(x) for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc16_csqrtf (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+
+  /**
+   * @brief Computes the magnitude |x| for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @return The 16 results.
+   */
+  __m512 amd_vrc16_cabsf (__m512 xre, __m512 xim);
+
+  /**
+   * @brief Computes the argument arg(x) for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @return The 16 results.
+   */
+  __m512 amd_vrc16_cargf (__m512 xre, __m512 xim);
+
+  /**
+   * @brief Computes the complex sine sin(x) for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc16_csinf (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+
+  /**
+   * @brief Computes the complex cosine cos(x) for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc16_ccosf (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+
+  /**
+   * @brief Computes the complex tangent tan(x) for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc16_ctanf (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic sine sinh(x) for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc16_csinhf (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic cosine cosh(x) for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc16_ccoshf (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+
+  /**
+   * @brief Computes the complex hyperbolic tangent tanh(x) for 16 complex floats, in split form.
+   * @param xre Real parts of the inputs.
+   * @param xim Imaginary parts of the inputs.
+   * @param yre Receives the real parts of the results.
+   * @param yim Receives the imaginary parts of the results.
+   */
+  void amd_vrc16_ctanhf (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+#endif /* __AVX512F__ */
+
 #ifdef __cplusplus
 }
 #endif
@@ -155,6 +155,10 @@ extern float     ALM_PROTO_INTERNAL(tanhf)                (float x);
 extern float     ALM_PROTO_INTERNAL(tanpif)               (float x);
 extern float     ALM_PROTO_INTERNAL(truncf)               (float x);
 extern float     ALM_PROTO_INTERNAL(erff)                 (float x);
+extern float     ALM_PROTO_INTERNAL(erfinvf)                  (float x);
+extern float     ALM_PROTO_INTERNAL(erfcinvf)                 (float x);
+extern float     ALM_PROTO_INTERNAL(cdfnormf)                 (float x);
+extern float     ALM_PROTO_INTERNAL(cdfnorminvf)              (float x);
 extern void      ALM_PROTO_INTERNAL(sincosf)              (float x, float *s, float *c);
 extern float     ALM_PROTO_INTERNAL(erfcf)                (float x);
 /*
@@ -181,6 +185,24 @@ extern fc64_t   ALM_PROTO_INTERNAL(clog)          (fc64_t f);
 extern fc32_t   ALM_PROTO_INTERNAL(clogf)         (fc32_t f);
 extern fc64_t   ALM_PROTO_INTERNAL(cpow)          (fc64_t x, fc64_t y);
 extern fc32_t   ALM_PROTO_INTERNAL(cpowf)         (fc32_t x, fc32_t y);
+extern fc64_t   ALM_PROTO_INTERNAL(csqrt)         (fc64_t f);
+extern fc32_t   ALM_PROTO_INTERNAL(csqrtf)        (fc32_t f);
+extern double   ALM_PROTO_INTERNAL(cabs)          (fc64_t f);
+extern float    ALM_PROTO_INTERNAL(cabsf)         (fc32_t f);
+extern double   ALM_PROTO_INTERNAL(carg)          (fc64_t f);
+extern float    ALM_PROTO_INTERNAL(cargf)         (fc32_t f);
+extern fc64_t   ALM_PROTO_INTERNAL(csin)          (fc64_t f);
+extern fc32_t   ALM_PROTO_INTERNAL(csinf)         (fc32_t f);
+extern fc64_t   ALM_PROTO_INTERNAL(ccos)          (fc64_t f);
+extern fc32_t   ALM_PROTO_INTERNAL(ccosf)         (fc32_t f);
+extern fc64_t   ALM_PROTO_INTERNAL(ctan)          (fc64_t f);
+extern fc32_t   ALM_PROTO_INTERNAL(ctanf)         (fc32_t f);
+extern fc64_t   ALM_PROTO_INTERNAL(csinh)         (fc64_t f);
+extern fc32_t   ALM_PROTO_INTERNAL(csinhf)        (fc32_t f);
+extern fc64_t   ALM_PROTO_INTERNAL(ccosh)         (fc64_t f);
+extern fc32_t   ALM_PROTO_INTERNAL(ccoshf)        (fc32_t f);
+extern fc64_t   ALM_PROTO_INTERNAL(ctanh)         (fc64_t f);
+extern fc32_t   ALM_PROTO_INTERNAL(ctanhf)        (fc32_t f);
 #include <immintrin.h>
 /*
  * Vector Single precision
@@ -205,6 +227,10 @@ extern __m128    ALM_PROTO_INTERNAL(vrs4_tanhf)           (__m128 x);
 extern __m128    ALM_PROTO_INTERNAL(vrs4_asinf)           (__m128 x);
 extern __m128    ALM_PROTO_INTERNAL(vrs4_atanf)           (__m128 x);
 extern __m128    ALM_PROTO_INTERNAL(vrs4_erff)            (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_erfinvf)             (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_erfcinvf)            (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_cdfnormf)            (__m128 x);
+extern __m128    ALM_PROTO_INTERNAL(vrs4_cdfnorminvf)         (__m128 x);
 extern __m128    ALM_PROTO_INTERNAL(vrs4_fabsf)           (__m128 x);
 extern __m128    ALM_PROTO_INTERNAL(vrs4_sqrtf)           (__m128 x);
 extern __m128    ALM_PROTO_INTERNAL(vrs4_linearfracf)     (__m128 x, __m128 y, float sca, float sha, float scb, float shb);
@@ -234,6 +260,10 @@ extern __m256    ALM_PROTO_INTERNAL(vrs8_coshf)           (__m256 x);
 extern __m256    ALM_PROTO_INTERNAL(vrs8_tanhf)           (__m256 x);
 extern __m256    ALM_PROTO_INTERNAL(vrs8_asinf)           (__m256 x);
 extern __m256    ALM_PROTO_INTERNAL(vrs8_erff)            (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_erfinvf)             (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_erfcinvf)            (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_cdfnormf)            (__m256 x);
+extern __m256    ALM_PROTO_INTERNAL(vrs8_cdfnorminvf)         (__m256 x);
 extern __m256    ALM_PROTO_INTERNAL(vrs8_fabsf)           (__m256 x);
 extern __m256    ALM_PROTO_INTERNAL(vrs8_sqrtf)           (__m256 x);
 extern __m256    ALM_PROTO_INTERNAL(vrs8_linearfracf)     (__m256 x, __m256 y, float sca, float sha, float scb, float shb);
@@ -263,6 +293,10 @@ extern __m512    ALM_PROTO_INTERNAL(vrs16_atanf)           (__m512 x);
 extern __m512    ALM_PROTO_INTERNAL(vrs16_coshf)           (__m512 x);
 extern __m512    ALM_PROTO_INTERNAL(vrs16_tanhf)           (__m512 x);
 extern __m512    ALM_PROTO_INTERNAL(vrs16_erff)            (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_erfinvf)             (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_erfcinvf)            (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_cdfnormf)            (__m512 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_cdfnorminvf)         (__m512 x);
 extern __m512    ALM_PROTO_INTERNAL(vrs16_sqrtf)           (__m512 x);
 extern __m512    ALM_PROTO_INTERNAL(vrs16_linearfracf)     (__m512 x, __m512 y, float sca, float sha, float scb, float shb);
 extern void      ALM_PROTO_INTERNAL(vrs16_sincosf)         (__m512 x, __m512 *sin, __m512 *cos);
@@ -394,6 +428,7 @@ extern void      ALM_PROTO_INTERNAL(vrsa_log2f)    (int n, const float *src, flo
 extern void      ALM_PROTO_INTERNAL(vrsa_logf)     (int n, const float *src, float *dst);
 extern void      ALM_PROTO_INTERNAL(vrsa_powf)     (int n, const float *s1, const float *s2, float *d);
 extern void      ALM_PROTO_INTERNAL(vrsa_powxf)    (int n, const float *s1, float s2, float *d);
+extern void      ALM_PROTO_INTERNAL(vrsa_powif)    (int n, const float *x, int e, float *y);
 extern void      ALM_PROTO_INTERNAL(vrsa_sincosf)  (int n, const float *x, float *ys, float *yc);
 extern void      ALM_PROTO_INTERNAL(vrsa_sinf)     (int n, const float *x, float *y);
 extern void      ALM_PROTO_INTERNAL(vrsa_addf)     (int len, const float *lhs, const float *rhs, float *dst);
@@ -415,6 +450,10 @@ extern void      ALM_PROTO_INTERNAL(vrsa_asinf)    (int n, const float *x, float
 extern void      ALM_PROTO_INTERNAL(vrsa_atanf)    (int n, const float *x, float *y);
 extern void      ALM_PROTO_INTERNAL(vrsa_coshf)    (int n, const float *x, float *y);
 extern void      ALM_PROTO_INTERNAL(vrsa_erff)     (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_erfinvf)   (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_erfcinvf)  (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_cdfnormf)  (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_cdfnorminvf) (int n, const float *x, float *y);
 extern void      ALM_PROTO_INTERNAL(vrsa_tanhf)    (int n, const float *x, float *y);
 extern void      ALM_PROTO_INTERNAL(vrsa_tanf)    (int n, const float *x, float *y);
 extern void      ALM_PROTO_INTERNAL(vrda_atan)     (int n, const double *x, double *y);
@@ -430,6 +469,7 @@ extern void      ALM_PROTO_INTERNAL(vrda_fmini)    (int len, const double *lhs,
 extern void      ALM_PROTO_INTERNAL(vrda_linearfrac)(int len, const double *x, const double *y, double scx, double shx, double scy, double shy, double *result);
 extern void      ALM_PROTO_INTERNAL(vrsa_linearfracf)(int len, const float *x, const float *y, float scx, float shx, float scy, float shy, float *result);
 extern void      ALM_PROTO_INTERNAL(vrda_powx)     (int n, const double *s1, double s2, double* d);
+extern void      ALM_PROTO_INTERNAL(vrda_powi)     (int n, const double *x, int e, double *y);
 extern void      ALM_PROTO_INTERNAL(vrda_erfc)     (int n, const double *x, double *y);
 extern void      ALM_PROTO_INTERNAL(vrda_erfinv)   (int n, const double *x, double *y);
 extern void      ALM_PROTO_INTERNAL(vrsa_erfcf)    (int n, const float *x, float *y);
@@ -448,6 +488,266 @@ extern void      ALM_PROTO_INTERNAL(vrda_asin)     (int n, const double *x, doub
 extern void      ALM_PROTO_INTERNAL(vrda_round)     (int n, const double *x, double *y);
 extern void      ALM_PROTO_INTERNAL(vrsa_roundf)    (int n, const float *x, float *y);
 
+extern uint16_t  ALM_PROTO_INTERNAL(expf16)    (uint16_t x);
+extern __m128i   ALM_PROTO_INTERNAL(vrh8_expf16)    (__m128i x);
+extern __m256i   ALM_PROTO_INTERNAL(vrh16_expf16)   (__m256i x);
+extern __m512i   ALM_PROTO_INTERNAL(vrh32_expf16)   (__m512i x);
+extern void      ALM_PROTO_INTERNAL(vrha_expf16)    (int n, const uint16_t *x, uint16_t *y);
+
+extern uint16_t  ALM_PROTO_INTERNAL(logf16)    (uint16_t x);
+extern __m128i   ALM_PROTO_INTERNAL(vrh8_logf16)    (__m128i x);
+extern __m256i   ALM_PROTO_INTERNAL(vrh16_logf16)   (__m256i x);
+extern __m512i   ALM_PROTO_INTERNAL(vrh32_logf16)   (__m512i x);
+extern void      ALM_PROTO_INTERNAL(vrha_logf16)    (int n, const uint16_t *x, uint16_t *y);
+
+extern uint16_t  ALM_PROTO_INTERNAL(sqrtf16)   (uint16_t x);
+extern __m128i   ALM_PROTO_INTERNAL(vrh8_sqrtf16)   (__m128i x);
+extern __m256i   ALM_PROTO_INTERNAL(vrh16_sqrtf16)  (__m256i x);
+extern __m512i   ALM_PROTO_INTERNAL(vrh32_sqrtf16)  (__m512i x);
+extern void      ALM_PROTO_INTERNAL(vrha_sqrtf16)   (int n, const uint16_t *x, uint16_t *y);
+
+extern uint16_t  ALM_PROTO_INTERNAL(tanhf16)   (uint16_t x);
+extern __m128i   ALM_PROTO_INTERNAL(vrh8_tanhf16)   (__m128i x);
+extern __m256i   ALM_PROTO_INTERNAL(vrh16_tanhf16)  (__m256i x);
+extern __m512i   ALM_PROTO_INTERNAL(vrh32_tanhf16)  (__m512i x);
+extern void      ALM_PROTO_INTERNAL(vrha_tanhf16)   (int n, const uint16_t *x, uint16_t *y);
+
+extern uint16_t  ALM_PROTO_INTERNAL(erff16)    (uint16_t x);
+extern __m128i   ALM_PROTO_INTERNAL(vrh8_erff16)    (__m128i x);
+extern __m256i   ALM_PROTO_INTERNAL(vrh16_erff16)   (__m256i x);
+extern __m512i   ALM_PROTO_INTERNAL(vrh32_erff16)   (__m512i x);
+extern void      ALM_PROTO_INTERNAL(vrha_erff16)    (int n, const uint16_t *x, uint16_t *y);
+
+extern uint16_t  ALM_PROTO_INTERNAL(sinf16)    (uint16_t x);
+extern __m128i   ALM_PROTO_INTERNAL(vrh8_sinf16)    (__m128i x);
+extern __m256i   ALM_PROTO_INTERNAL(vrh16_sinf16)   (__m256i x);
+extern __m512i   ALM_PROTO_INTERNAL(vrh32_sinf16)   (__m512i x);
+extern void      ALM_PROTO_INTERNAL(vrha_sinf16)    (int n, const uint16_t *x, uint16_t *y);
+
+extern uint16_t  ALM_PROTO_INTERNAL(cosf16)    (uint16_t x);
+extern __m128i   ALM_PROTO_INTERNAL(vrh8_cosf16)    (__m128i x);
+extern __m256i   ALM_PROTO_INTERNAL(vrh16_cosf16)   (__m256i x);
+extern __m512i   ALM_PROTO_INTERNAL(vrh32_cosf16)   (__m512i x);
+extern void      ALM_PROTO_INTERNAL(vrha_cosf16)    (int n, const uint16_t *x, uint16_t *y);
+
+extern void      ALM_PROTO_INTERNAL(vrba_expbf16)      (int n, const uint16_t *x, uint16_t *y);
+extern void      ALM_PROTO_INTERNAL(vrba_logbf16)      (int n, const uint16_t *x, uint16_t *y);
+extern void      ALM_PROTO_INTERNAL(vrba_tanhbf16)     (int n, const uint16_t *x, uint16_t *y);
+extern void      ALM_PROTO_INTERNAL(vrba_erfbf16)      (int n, const uint16_t *x, uint16_t *y);
+extern void      ALM_PROTO_INTERNAL(vrba_sigmoidbf16)  (int n, const uint16_t *x, uint16_t *y);
+extern void      ALM_PROTO_INTERNAL(vrba_gelubf16)     (int n, const uint16_t *x, uint16_t *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_sigmoidf)     (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_sigmoidf)    (__m512 x);
+extern void      ALM_PROTO_INTERNAL(vrsa_sigmoidf)     (int n, const float *x, float *y);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_sigmoid)      (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_sigmoid)      (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrda_sigmoid)      (int n, const double *x, double *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_softplusf)    (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_softplusf)   (__m512 x);
+extern void      ALM_PROTO_INTERNAL(vrsa_softplusf)    (int n, const float *x, float *y);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_softplus)     (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_softplus)     (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrda_softplus)     (int n, const double *x, double *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_geluf)        (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_geluf)       (__m512 x);
+extern void      ALM_PROTO_INTERNAL(vrsa_geluf)        (int n, const float *x, float *y);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_gelu)         (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_gelu)         (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrda_gelu)         (int n, const double *x, double *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_gelu_tanhf)   (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_gelu_tanhf)  (__m512 x);
+extern void      ALM_PROTO_INTERNAL(vrsa_gelu_tanhf)   (int n, const float *x, float *y);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_gelu_tanh)    (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_gelu_tanh)    (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrda_gelu_tanh)    (int n, const double *x, double *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_siluf)        (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_siluf)       (__m512 x);
+extern void      ALM_PROTO_INTERNAL(vrsa_siluf)        (int n, const float *x, float *y);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_silu)         (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_silu)         (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrda_silu)         (int n, const double *x, double *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_mishf)        (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_mishf)       (__m512 x);
+extern void      ALM_PROTO_INTERNAL(vrsa_mishf)        (int n, const float *x, float *y);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_mish)         (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_mish)         (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrda_mish)         (int n, const double *x, double *y);
+
+extern void      ALM_PROTO_INTERNAL(vrsa_softmaxf)     (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_softmax_batchf) (int rows, int cols, const float *x, int ldx, float *y, int ldy);
+extern void      ALM_PROTO_INTERNAL(vrda_softmax)      (int n, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_softmax_batch) (int rows, int cols, const double *x, int ldx, double *y, int ldy);
+
+extern void      ALM_PROTO_INTERNAL(vrsa_log_softmaxf) (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrsa_log_softmax_batchf) (int rows, int cols, const float *x, int ldx, float *y, int ldy);
+extern void      ALM_PROTO_INTERNAL(vrda_log_softmax)  (int n, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrda_log_softmax_batch) (int rows, int cols, const double *x, int ldx, double *y, int ldy);
+
+extern void      ALM_PROTO_INTERNAL(vrsa_randnf)       (int method, uint64_t seed, uint64_t offset, int len, float *dst);
+extern void      ALM_PROTO_INTERNAL(vrda_randn)        (int method, uint64_t seed, uint64_t offset, int len, double *dst);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_rsqrtf)       (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_rsqrtf)      (__m512 x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_rsqrt)        (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_rsqrt)        (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrsa_rsqrtf)       (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrda_rsqrt)        (int n, const double *x, double *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_rsqrt_fastf)  (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_rsqrt_fastf) (__m512 x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_rsqrt_fast)   (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_rsqrt_fast)   (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrsa_rsqrt_fastf)  (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrda_rsqrt_fast)   (int n, const double *x, double *y);
+
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_rsqrt_cr)     (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_rsqrt_cr)     (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrda_rsqrt_cr)     (int n, const double *x, double *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_recipf)       (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_recipf)      (__m512 x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_recip)        (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_recip)        (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrsa_recipf)       (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrda_recip)        (int n, const double *x, double *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_recip_fastf)  (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_recip_fastf) (__m512 x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_recip_fast)   (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_recip_fast)   (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrsa_recip_fastf)  (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrda_recip_fast)   (int n, const double *x, double *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_exp_fastf)    (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_exp_fastf)   (__m512 x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_exp_fast)     (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrsa_exp_fastf)    (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrda_exp_fast)     (int n, const double *x, double *y);
+
+extern __m256    ALM_PROTO_INTERNAL(vrs8_log_fastf)    (__m256 x);
+extern __m512    ALM_PROTO_INTERNAL(vrs16_log_fastf)   (__m512 x);
+extern __m256d   ALM_PROTO_INTERNAL(vrd4_log_fast)     (__m256d x);
+extern __m512d   ALM_PROTO_INTERNAL(vrd8_log_fast)     (__m512d x);
+extern void      ALM_PROTO_INTERNAL(vrsa_log_fastf)    (int n, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrda_log_fast)     (int n, const double *x, double *y);
+
+/*
+ * Complex vector and array variants
+ */
+extern void      ALM_PROTO_INTERNAL(vrz4_cexp)         (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+extern void      ALM_PROTO_INTERNAL(vrz8_cexp)         (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+extern void      ALM_PROTO_INTERNAL(vrc8_cexpf)        (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+extern void      ALM_PROTO_INTERNAL(vrc16_cexpf)       (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+extern void      ALM_PROTO_INTERNAL(vrza_cexp)         (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_cexp_split)   (int len, const double *xre, const double *xim, double *yre, double *yim);
+extern void      ALM_PROTO_INTERNAL(vrca_cexpf)        (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_cexpf_split)  (int len, const float *xre, const float *xim, float *yre, float *yim);
+
+extern void      ALM_PROTO_INTERNAL(vrz4_clog)         (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+extern void      ALM_PROTO_INTERNAL(vrz8_clog)         (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+extern void      ALM_PROTO_INTERNAL(vrc8_clogf)        (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+extern void      ALM_PROTO_INTERNAL(vrc16_clogf)       (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+extern void      ALM_PROTO_INTERNAL(vrza_clog)         (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_clog_split)   (int len, const double *xre, const double *xim, double *yre, double *yim);
+extern void      ALM_PROTO_INTERNAL(vrca_clogf)        (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_clogf_split)  (int len, const float *xre, const float *xim, float *yre, float *yim);
+
+extern void      ALM_PROTO_INTERNAL(vrz4_cpow)         (__m256d xre, __m256d xim, __m256d yre, __m256d yim, __m256d *zre, __m256d *zim);
+extern void      ALM_PROTO_INTERNAL(vrz8_cpow)         (__m512d xre, __m512d xim, __m512d yre, __m512d yim, __m512d *zre, __m512d *zim);
+extern void      ALM_PROTO_INTERNAL(vrc8_cpowf)        (__m256 xre, __m256 xim, __m256 yre, __m256 yim, __m256 *zre, __m256 *zim);
+extern void      ALM_PROTO_INTERNAL(vrc16_cpowf)       (__m512 xre, __m512 xim, __m512 yre, __m512 yim, __m512 *zre, __m512 *zim);
+extern void      ALM_PROTO_INTERNAL(vrza_cpow)         (int len, const double *x, const double *y, double *z);
+extern void      ALM_PROTO_INTERNAL(vrza_cpow_split)   (int len, const double *xre, const double *xim, const double *yre, const double *yim, double *zre, double *zim);
+extern void      ALM_PROTO_INTERNAL(vrca_cpowf)        (int len, const float *x, const float *y, float *z);
+extern void      ALM_PROTO_INTERNAL(vrca_cpowf_split)  (int len, const float *xre, const float *xim, const float *yre, const float *yim, float *zre, float *zim);
+
+extern void      ALM_PROTO_INTERNAL(vrz4_csqrt)        (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+extern void      ALM_PROTO_INTERNAL(vrz8_csqrt)        (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+extern void      ALM_PROTO_INTERNAL(vrc8_csqrtf)       (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+extern void      ALM_PROTO_INTERNAL(vrc16_csqrtf)      (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+extern void      ALM_PROTO_INTERNAL(vrza_csqrt)        (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_csqrt_split)  (int len, const double *xre, const double *xim, double *yre, double *yim);
+extern void      ALM_PROTO_INTERNAL(vrca_csqrtf)       (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_csqrtf_split) (int len, const float *xre, const float *xim, float *yre, float *yim);
+
+extern __m256d   ALM_PROTO_INTERNAL(vrz4_cabs)         (__m256d xre, __m256d xim);
+extern __m512d   ALM_PROTO_INTERNAL(vrz8_cabs)         (__m512d xre, __m512d xim);
+extern __m256    ALM_PROTO_INTERNAL(vrc8_cabsf)        (__m256 xre, __m256 xim);
+extern __m512    ALM_PROTO_INTERNAL(vrc16_cabsf)       (__m512 xre, __m512 xim);
+extern void      ALM_PROTO_INTERNAL(vrza_cabs)         (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_cabs_split)   (int len, const double *xre, const double *xim, double *y);
+extern void      ALM_PROTO_INTERNAL(vrca_cabsf)        (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_cabsf_split)  (int len, const float *xre, const float *xim, float *y);
+
+extern __m256d   ALM_PROTO_INTERNAL(vrz4_carg)         (__m256d xre, __m256d xim);
+extern __m512d   ALM_PROTO_INTERNAL(vrz8_carg)         (__m512d xre, __m512d xim);
+extern __m256    ALM_PROTO_INTERNAL(vrc8_cargf)        (__m256 xre, __m256 xim);
+extern __m512    ALM_PROTO_INTERNAL(vrc16_cargf)       (__m512 xre, __m512 xim);
+extern void      ALM_PROTO_INTERNAL(vrza_carg)         (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_carg_split)   (int len, const double *xre, const double *xim, double *y);
+extern void      ALM_PROTO_INTERNAL(vrca_cargf)        (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_cargf_split)  (int len, const float *xre, const float *xim, float *y);
+
+extern void      ALM_PROTO_INTERNAL(vrz4_csin)         (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+extern void      ALM_PROTO_INTERNAL(vrz8_csin)         (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+extern void      ALM_PROTO_INTERNAL(vrc8_csinf)        (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+extern void      ALM_PROTO_INTERNAL(vrc16_csinf)       (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+extern void      ALM_PROTO_INTERNAL(vrza_csin)         (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_csin_split)   (int len, const double *xre, const double *xim, double *yre, double *yim);
+extern void      ALM_PROTO_INTERNAL(vrca_csinf)        (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_csinf_split)  (int len, const float *xre, const float *xim, float *yre, float *yim);
+
+extern void      ALM_PROTO_INTERNAL(vrz4_ccos)         (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+extern void      ALM_PROTO_INTERNAL(vrz8_ccos)         (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+extern void      ALM_PROTO_INTERNAL(vrc8_ccosf)        (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+extern void      ALM_PROTO_INTERNAL(vrc16_ccosf)       (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+extern void      ALM_PROTO_INTERNAL(vrza_ccos)         (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_ccos_split)   (int len, const double *xre, const double *xim, double *yre, double *yim);
+extern void      ALM_PROTO_INTERNAL(vrca_ccosf)        (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_ccosf_split)  (int len, const float *xre, const float *xim, float *yre, float *yim);
+
+extern void      ALM_PROTO_INTERNAL(vrz4_ctan)         (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+extern void      ALM_PROTO_INTERNAL(vrz8_ctan)         (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+extern void      ALM_PROTO_INTERNAL(vrc8_ctanf)        (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+extern void      ALM_PROTO_INTERNAL(vrc16_ctanf)       (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+extern void      ALM_PROTO_INTERNAL(vrza_ctan)         (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_ctan_split)   (int len, const double *xre, const double *xim, double *yre, double *yim);
+extern void      ALM_PROTO_INTERNAL(vrca_ctanf)        (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_ctanf_split)  (int len, const float *xre, const float *xim, float *yre, float *yim);
+
+extern void      ALM_PROTO_INTERNAL(vrz4_csinh)        (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+extern void      ALM_PROTO_INTERNAL(vrz8_csinh)        (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+extern void      ALM_PROTO_INTERNAL(vrc8_csinhf)       (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+extern void      ALM_PROTO_INTERNAL(vrc16_csinhf)      (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+extern void      ALM_PROTO_INTERNAL(vrza_csinh)        (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_csinh_split)  (int len, const double *xre, const double *xim, double *yre, double *yim);
+extern void      ALM_PROTO_INTERNAL(vrca_csinhf)       (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_csinhf_split) (int len, const float *xre, const float *xim, float *yre, float *yim);
+
+extern void      ALM_PROTO_INTERNAL(vrz4_ccosh)        (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+extern void      ALM_PROTO_INTERNAL(vrz8_ccosh)        (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+extern void      ALM_PROTO_INTERNAL(vrc8_ccoshf)       (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+extern void      ALM_PROTO_INTERNAL(vrc16_ccoshf)      (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+extern void      ALM_PROTO_INTERNAL(vrza_ccosh)        (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_ccosh_split)  (int len, const double *xre, const double *xim, double *yre, double *yim);
+extern void      ALM_PROTO_INTERNAL(vrca_ccoshf)       (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_ccoshf_split) (int len, const float *xre, const float *xim, float *yre, float *yim);
+
+extern void      ALM_PROTO_INTERNAL(vrz4_ctanh)        (__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+extern void      ALM_PROTO_INTERNAL(vrz8_ctanh)        (__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+extern void      ALM_PROTO_INTERNAL(vrc8_ctanhf)       (__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+extern void      ALM_PROTO_INTERNAL(vrc16_ctanhf)      (__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+extern void      ALM_PROTO_INTERNAL(vrza_ctanh)        (int len, const double *x, double *y);
+extern void      ALM_PROTO_INTERNAL(vrza_ctanh_split)  (int len, const double *xre, const double *xim, double *yre, double *yim);
+extern void      ALM_PROTO_INTERNAL(vrca_ctanhf)       (int len, const float *x, float *y);
+extern void      ALM_PROTO_INTERNAL(vrca_ctanhf_split) (int len, const float *xre, const float *xim, float *yre, float *yim);
+
 #ifdef __cplusplus
 }
 #endif
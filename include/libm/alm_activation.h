@@ -0,0 +1,714 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Width- and precision-generic kernels for the neural-network activation
+ * functions: sigmoid, softplus, GELU (erf and tanh forms), SiLU, mish and
+ * (log-)softmax.
+ *
+ * Each activation is fused into a single pass over registers. exp() uses
+ * the reduction and polynomial of vrs8_expf/vrd4_exp, log1p() and log()
+ * the fdlibm log coefficients and GELU the fdlibm erf/erfc rational
+ * approximations behind vrs8_erfcf/vrd4_erfc. Where those kernels hand
+ * lanes outside their main range to scalar code, here the inputs are
+ * clamped and the regions blended with selects, so a vector never leaves
+ * the fast path.
+ *
+ * exp() results are returned as q * scale with q normal, and callers
+ * apply the scale last: a tail result such as x * exp(x) is rounded once
+ * even when it is subnormal.
+ *
+ * The includer defines ALM_ACT_VLEN to 8 or 16 for binary32 and, with
+ * ALM_ACT_DOUBLE defined, to 4 or 8 for binary64, before including this
+ * file.
+ */
+
+#ifndef __LIBM_ALM_ACTIVATION_H__
+#define __LIBM_ALM_ACTIVATION_H__
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_util_amd.h>
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+
+#if defined(ALM_ACT_DOUBLE)
+typedef double      act_t;
+#if ALM_ACT_VLEN == 4
+typedef v_f64x4_t   act_vf_t;
+typedef v_i64x4_t   act_vi_t;
+#define ACT_LOADU(p)            _mm256_loadu_pd(p)
+#define ACT_STOREU(p, v)        _mm256_storeu_pd(p, v)
+#define ACT_LOAD_TAIL(p, n)     _mm256_maskload_pd(p, GET_MASK_DOUBLE_256_BIT(n))
+#define ACT_STORE_TAIL(p, n, v) _mm256_maskstore_pd(p, GET_MASK_DOUBLE_256_BIT(n), v)
+#define ACT_ANY(m)              _mm256_movemask_pd((__m256d)(m))
+#define ACT_FMA(a, b, c)        _mm256_fmadd_pd(a, b, c)
+#elif ALM_ACT_VLEN == 8
+typedef v_f64x8_t   act_vf_t;
+typedef v_i64x8_t   act_vi_t;
+#define ACT_LOADU(p)            _mm512_loadu_pd(p)
+#define ACT_STOREU(p, v)        _mm512_storeu_pd(p, v)
+#define ACT_LOAD_TAIL(p, n)     _mm512_maskz_loadu_pd((__mmask8)((1u << (n)) - 1), p)
+#define ACT_STORE_TAIL(p, n, v) _mm512_mask_storeu_pd(p, (__mmask8)((1u << (n)) - 1), v)
+#define ACT_ANY(m)              _mm512_test_epi64_mask((__m512i)(m), (__m512i)(m))
+#define ACT_FMA(a, b, c)        _mm512_fmadd_pd(a, b, c)
+#else
+#error "ALM_ACT_VLEN must be 4 or 8 for double"
+#endif
+
+#define ACT_MANT_BITS   52
+#define ACT_EXP_BIAS    1023
+#define ACT_ABS_MASK    INT64_C(0x7fffffffffffffff)
+/* keeps the top 21 significant bits, so that X*X is exact */
+#define ACT_SPLIT_MASK  INT64_C(-0x100000000)
+/* 0x1.8p52: adding it rounds |x| < 2^51 to an integer in the low bits */
+#define ACT_SHIFT       0x1.8p52
+#define ACT_SHIFT_BITS  INT64_C(0x4338000000000000)
+
+/* exp() input range: e^710 overflows, |x|*e^-760 underflows to zero */
+#define ACT_EXP_HI      710.0
+#define ACT_EXP_LO      -760.0
+/* GELU: |x| beyond which x*Phi(x) is 0 or x, |w| beyond the exp() range */
+#define ACT_GELU_MAX    40.0
+#define ACT_GELU_TANH_MAX 32.0
+/* mish: x beyond which tanh(softplus(x)) rounds to 1 */
+#define ACT_MISH_BIG    20.0
+#define ACT_MAX         0x1.fffffffffffffp+1023
+
+#else /* binary32 */
+
+typedef float       act_t;
+#if ALM_ACT_VLEN == 8
+typedef v_f32x8_t   act_vf_t;
+typedef v_i32x8_t   act_vi_t;
+#define ACT_LOADU(p)            _mm256_loadu_ps(p)
+#define ACT_STOREU(p, v)        _mm256_storeu_ps(p, v)
+#define ACT_LOAD_TAIL(p, n)     _mm256_maskload_ps(p, GET_MASK_FLOAT_256_BIT(n))
+#define ACT_STORE_TAIL(p, n, v) _mm256_maskstore_ps(p, GET_MASK_FLOAT_256_BIT(n), v)
+#define ACT_ANY(m)              _mm256_movemask_ps((__m256)(m))
+#define ACT_FMA(a, b, c)        _mm256_fmadd_ps(a, b, c)
+#elif ALM_ACT_VLEN == 16
+typedef v_f32x16_t  act_vf_t;
+typedef v_i32x16_t  act_vi_t;
+#define ACT_LOADU(p)            _mm512_loadu_ps(p)
+#define ACT_STOREU(p, v)        _mm512_storeu_ps(p, v)
+#define ACT_LOAD_TAIL(p, n)     _mm512_maskz_loadu_ps((__mmask16)((1u << (n)) - 1), p)
+#define ACT_STORE_TAIL(p, n, v) _mm512_mask_storeu_ps(p, (__mmask16)((1u << (n)) - 1), v)
+#define ACT_ANY(m)              _mm512_test_epi32_mask((__m512i)(m), (__m512i)(m))
+#define ACT_FMA(a, b, c)        _mm512_fmadd_ps(a, b, c)
+#else
+#error "ALM_ACT_VLEN must be 8 or 16 for float"
+#endif
+
+#define ACT_MANT_BITS   23
+#define ACT_EXP_BIAS    127
+#define ACT_ABS_MASK    0x7fffffff
+/* keeps the top 11 significant bits, so that X*X is exact */
+#define ACT_SPLIT_MASK  ((int32_t)0xffffe000)
+#define ACT_SHIFT       0x1.8p23f
+#define ACT_SHIFT_BITS  0x4b400000
+
+#define ACT_EXP_HI      89.0f
+#define ACT_EXP_LO      -110.0f
+#define ACT_GELU_MAX    15.0f
+#define ACT_GELU_TANH_MAX 16.0f
+#define ACT_MISH_BIG    10.0f
+#define ACT_MAX         0x1.fffffep+127f
+
+#endif
+
+#define ACT_C(c)        ((act_t)(c))
+
+typedef act_vf_t (*act_kern_t)(act_vf_t x);
+
+/* m ? a : b, bitwise */
+static inline act_vf_t
+act_sel(act_vi_t m, act_vf_t a, act_vf_t b)
+{
+    return (act_vf_t)(((act_vi_t)a & m) | ((act_vi_t)b & ~m));
+}
+
+static inline act_vf_t
+act_set1(act_t c)
+{
+    act_vf_t v = {0};
+    return v + c;
+}
+
+/* per-lane choice between two polynomial coefficients */
+static inline act_vf_t
+act_pick(act_vi_t m, double a, double b)
+{
+    return act_sel(m, act_set1((act_t)a), act_set1((act_t)b));
+}
+
+static inline act_vf_t
+act_abs(act_vf_t x)
+{
+    return (act_vf_t)((act_vi_t)x & ACT_ABS_MASK);
+}
+
+/*
+ * exp(x) = q * *scale.
+ * x = n*ln2 + r with ln2 split into head and tail, 2^r by the vrs8_expf
+ * degree 7 (binary32) or vrd4_exp degree 11 (binary64) polynomial. 2^n
+ * is split into 2^(n/2) folded into q and the rest returned in *scale,
+ * so q stays normal over the whole clamped range. NaN propagates.
+ */
+static inline act_vf_t
+act_exp_split(act_vf_t x, act_vf_t *scale)
+{
+#if defined(ALM_ACT_DOUBLE)
+    const act_t INVLN2 = 0x1.71547652b82fep+0;
+    const act_t LN2_HI = 0x1.63p-1, LN2_LO = -0x1.bd0105c610ca8p-13;
+#else
+    const act_t INVLN2 = 0x1.715476p+0f;
+    const act_t LN2_HI = 0x1.63p-1f, LN2_LO = -0x1.bd0104p-13f;
+#endif
+
+    x = act_sel(x > ACT_EXP_HI, act_set1(ACT_EXP_HI), x);
+    x = act_sel(x < ACT_EXP_LO, act_set1(ACT_EXP_LO), x);
+
+    act_vf_t k = x * INVLN2 + ACT_SHIFT;
+    act_vf_t n = k - ACT_SHIFT;
+    act_vi_t ni = (act_vi_t)k - ACT_SHIFT_BITS;
+    act_vi_t n1 = ni >> 1;
+
+    act_vf_t r = x - n * LN2_HI;
+    r = r - n * LN2_LO;
+
+#if defined(ALM_ACT_DOUBLE)
+    act_vf_t p = 0x1.ad661ce7af3e3p-26 * r + 0x1.28b311c80e499p-22;
+    p = p * r + 0x1.71df4520705a4p-19;
+    p = p * r + 0x1.a01992d0fe581p-16;
+    p = p * r + 0x1.a01a011057479p-13;
+    p = p * r + 0x1.6c16c1878111dp-10;
+    p = p * r + 0x1.1111111130dd6p-7;
+    p = p * r + 0x1.555555554f37p-5;
+    p = p * r + 0x1.55555555554a2p-3;
+    p = p * r + 0x1.000000000001p-1;
+#else
+    act_vf_t p = 0x1.9eb724p-13f * r + 0x1.6da4acp-10f;
+    p = p * r + 0x1.1112fap-7f;
+    p = p * r + 0x1.555468p-5f;
+    p = p * r + 0x1.555554p-3f;
+    p = p * r + 0.5f;
+#endif
+    p = p * r + ACT_C(1.0);
+    p = p * r + ACT_C(1.0);
+
+    *scale = (act_vf_t)((ni - n1 + ACT_EXP_BIAS) << ACT_MANT_BITS);
+
+    return p * (act_vf_t)((n1 + ACT_EXP_BIAS) << ACT_MANT_BITS);
+}
+
+static inline act_vf_t
+act_exp(act_vf_t x)
+{
+    act_vf_t sc;
+    act_vf_t q = act_exp_split(x, &sc);
+    return q * sc;
+}
+
+/*
+ * k*ln2 + log(1 + f) + c, sqrt(2)/2 <= 1 + f < sqrt(2), c a small
+ * correction, as in fdlibm log: s = f/(2 + f),
+ * log(1 + f) = f - hfsq + s*(hfsq + R(s^2)), ln2 split into head and tail.
+ */
+static inline act_vf_t
+act_log_kf(act_vf_t k, act_vf_t f, act_vf_t c)
+{
+#if defined(ALM_ACT_DOUBLE)
+    const act_t LN2_HI = 0x1.62e42feep-1, LN2_LO = 0x1.a39ef35793c76p-33;
+#else
+    const act_t LN2_HI = 0x1.62e3p-1f, LN2_LO = 0x1.2fefa2p-17f;
+#endif
+    act_vf_t s = f / (ACT_C(2.0) + f);
+    act_vf_t z = s * s;
+    act_vf_t w = z * z;
+
+#if defined(ALM_ACT_DOUBLE)
+    act_vf_t t1 = w * (0x1.999999997fa04p-2 +
+                       w * (0x1.c71c51d8e78afp-3 + w * 0x1.39a09d078c69fp-3));
+    act_vf_t t2 = z * (0x1.5555555555593p-1 +
+                       w * (0x1.2492494229359p-2 +
+                            w * (0x1.7466496cb03dep-3 + w * 0x1.2f112df3e5244p-3)));
+#else
+    act_vf_t t1 = w * (0x1.999c26p-2f + w * 0x1.f13c4cp-3f);
+    act_vf_t t2 = z * (0x1.555554p-1f + w * 0x1.23d3dcp-2f);
+#endif
+    act_vf_t R = t1 + t2;
+    act_vf_t hfsq = ACT_C(0.5) * f * f;
+
+    return k * LN2_HI + (f - (hfsq - (s * (hfsq + R) + (k * LN2_LO + c))));
+}
+
+/*
+ * log1p(e) for 0 <= e <= 1 (NaN propagates), as in fdlibm log1p:
+ * u = 1 + e, c = e - (u - 1) is exact, log1p(e) = log(u) + c/u,
+ * u = 2^k * (1 + f) with k in {0, 1}.
+ */
+static inline act_vf_t
+act_log1p_unit(act_vf_t e)
+{
+    act_vf_t u = ACT_C(1.0) + e;
+    act_vf_t c = e - (u - ACT_C(1.0));
+
+    act_vi_t big = u > ACT_C(0x1.6a09e667f3bcdp+0);
+    act_vf_t k = act_sel(big, act_set1(ACT_C(1.0)), act_set1(ACT_C(0.0)));
+    act_vf_t f = act_sel(big, u * ACT_C(0.5), u) - ACT_C(1.0);
+
+    return act_log_kf(k, f, c / u);
+}
+
+/*
+ * log(x) for positive normal x. x = 2^k * m with sqrt(2)/2 <= m < sqrt(2),
+ * found by offsetting the bits of x by those of sqrt(2)/2; k is converted
+ * through the ACT_SHIFT bias.
+ */
+static inline act_vf_t
+act_log(act_vf_t x)
+{
+#if defined(ALM_ACT_DOUBLE)
+    act_vi_t ix = (act_vi_t)x - INT64_C(0x3fe6a09e667f3bcd);
+#else
+    act_vi_t ix = (act_vi_t)x - 0x3f3504f3;
+#endif
+    act_vi_t ki = ix >> ACT_MANT_BITS;
+    act_vf_t m = (act_vf_t)((act_vi_t)x - (ki << ACT_MANT_BITS));
+    act_vf_t k = (act_vf_t)(ki + ACT_SHIFT_BITS) - ACT_SHIFT;
+
+    return act_log_kf(k, m - ACT_C(1.0), act_set1(ACT_C(0.0)));
+}
+
+/*
+ * sigmoid(x) = 1/(1 + exp(-x)).
+ * e = exp(-|x|), s = 1/(1 + e); s for x >= 0, e*s for x < 0.
+ */
+static inline act_vf_t
+act_sigmoid(act_vf_t x)
+{
+    act_vf_t sc;
+    act_vf_t q = act_exp_split(-act_abs(x), &sc);
+    act_vf_t s = ACT_C(1.0) / (ACT_C(1.0) + q * sc);
+
+    return act_sel(x < ACT_C(0.0), (q * s) * sc, s);
+}
+
+/*
+ * softplus(x) = log(1 + exp(x)) = max(x, 0) + log1p(exp(-|x|)).
+ */
+static inline act_vf_t
+act_softplus(act_vf_t x)
+{
+    act_vf_t l = act_log1p_unit(act_exp(-act_abs(x)));
+
+    return act_sel(x > ACT_C(0.0), x + l, l);
+}
+
+/*
+ * silu(x) = x * sigmoid(x). In the negative tail x is clamped to the
+ * bottom of the exp() range, where x*exp(x) already rounds to -0, so
+ * that -Inf gives -0 rather than NaN.
+ */
+static inline act_vf_t
+act_silu(act_vf_t x)
+{
+    act_vf_t sc;
+    act_vf_t q = act_exp_split(-act_abs(x), &sc);
+    act_vf_t s = ACT_C(1.0) / (ACT_C(1.0) + q * sc);
+    act_vf_t m = act_sel(x < ACT_EXP_LO, act_set1(ACT_EXP_LO), x);
+
+    return act_sel(x < ACT_C(0.0), ((m * s) * q) * sc, x * s);
+}
+
+/*
+ * mish(x) = x * tanh(softplus(x)). With e = exp(x),
+ * tanh(log(1 + e)) = e*(e + 2) / (e*(e + 2) + 2), evaluated as
+ * e * r, r = (e + 2)/(e*(e + 2) + 2), without cancellation on either
+ * side. Above ACT_MISH_BIG the factor rounds to 1 and x is returned.
+ */
+static inline act_vf_t
+act_mish(act_vf_t x)
+{
+    act_vf_t sc;
+    act_vf_t xc = act_sel(x > ACT_MISH_BIG, act_set1(ACT_MISH_BIG), x);
+    act_vf_t q = act_exp_split(xc, &sc);
+    act_vf_t e = q * sc;
+    act_vf_t r = (e + ACT_C(2.0)) / (e * (e + ACT_C(2.0)) + ACT_C(2.0));
+    act_vf_t m = act_sel(x < ACT_EXP_LO, act_set1(ACT_EXP_LO), x);
+
+    return act_sel(x > ACT_MISH_BIG, x, ((m * r) * q) * sc);
+}
+
+/*
+ * GELU, tanh approximation:
+ * x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 x^3))) = x * sigmoid(w),
+ * w = K0*x + K1*x^3, K0 = 2*sqrt(2/pi), K1 = 0.044715*K0, which needs no
+ * tanh and does not cancel for x < 0.
+ *
+ * In the negative tail the result is about exp(w), so an absolute error in
+ * w becomes a relative error in the result. w is therefore carried as
+ * w + wl: the products' rounding errors come from FMAs, the sum with K0
+ * from an exact two-sum, and K0, K1 have tails. The products stay
+ * separate from the additions (they feed an FMA too), so FP contraction
+ * cannot change the roundings the compensation relies on.
+ */
+static inline act_vf_t
+act_gelu_tanh(act_vf_t x)
+{
+#if defined(ALM_ACT_DOUBLE)
+    const act_t K0 = 0x1.9884533d43651p+0, K0L = -0x1.cbc0d30ebfd15p-54;
+    const act_t K1 = 0x1.2444f2a4d8b4bp-4, K1L = -0x1.6c843a29d1c7p-61;
+#else
+    const act_t K0 = 0x1.988454p+0f, K0L = -0x1.857936p-25f;
+    const act_t K1 = 0x1.2444f2p-4f, K1L = 0x1.49b16ap-29f;
+#endif
+    act_vf_t k1 = act_set1(K1);
+
+    /* |w| > 110 (binary32) / 760 (binary64) beyond this */
+    act_vf_t xw = act_sel(x > ACT_GELU_TANH_MAX, act_set1(ACT_GELU_TANH_MAX), x);
+    xw = act_sel(xw < -ACT_GELU_TANH_MAX, act_set1(-ACT_GELU_TANH_MAX), xw);
+
+    act_vf_t x2 = xw * xw;
+    act_vf_t x2l = ACT_FMA(xw, xw, -x2);
+
+    /* t + tl = K0 + K1*x^2 */
+    act_vf_t p = k1 * x2;
+    act_vf_t pl = ACT_FMA(k1, x2, -p);
+    act_vf_t t = p + K0;
+    act_vf_t bb = t - p;
+    act_vf_t tl = (p - (t - bb)) + (K0 - bb);
+    tl = tl + (pl + (K1 * x2l + (K1L * x2 + K0L)));
+
+    /* w + wl = x * (t + tl) */
+    act_vf_t w = xw * t;
+    act_vf_t wl = ACT_FMA(xw, t, -w) + xw * tl;
+
+    act_vi_t neg = w < ACT_C(0.0);
+    act_vf_t sc;
+    act_vf_t q = act_exp_split(-act_abs(w), &sc);
+    q = q * (ACT_C(1.0) + act_sel(neg, wl, -wl));
+
+    act_vf_t s = ACT_C(1.0) / (ACT_C(1.0) + q * sc);
+    act_vf_t m = act_sel(x < ACT_EXP_LO, act_set1(ACT_EXP_LO), x);
+
+    return act_sel(neg, ((m * s) * q) * sc, x * s);
+}
+
+/*
+ * GELU(x) = x * Phi(x), Phi(x) = (1 + erf(x/sqrt(2)))/2 = erfc(-x/sqrt(2))/2.
+ * With z = |x|/sqrt(2), the fdlibm regions of erf/erfc(z):
+ *
+ *   z < 0.84375:        erf  = z + z*P(z^2)/Q(z^2)
+ *                       erfc = 1 - erf, regrouped around 0.5 for z >= 1/4
+ *   0.84375 <= z < 1.25: erf  = erx + P(z-1)/Q(z-1), erfc = (1 - erx) - P/Q
+ *   z >= 1.25:           erfc = exp(-z^2 - 0.5625 + R(1/z^2)/S(1/z^2)) / z
+ *                        (two coefficient sets, split at 1/0.35)
+ *
+ * The two inner regions share one rational evaluation with per-lane
+ * coefficients, as do the two outer ones; the outer regions are only
+ * evaluated when a lane needs them. Outside, x/2 * erfc(z)/z collapses to
+ * -E/sqrt(2), so
+ *
+ *   GELU(x) = -E/sqrt(2)       x < 0
+ *   GELU(x) = x - E/sqrt(2)    x > 0,  E = exp(-x^2/2 - 0.5625 + R/S)
+ *
+ * -x^2/2 is carried exactly by splitting x as in fdlibm, and the exp()
+ * scale is applied last for the subnormal tail.
+ */
+static inline act_vf_t
+act_gelu(act_vf_t x)
+{
+    const act_t ERX = ACT_C(0x1.b0ac16p-1), EFC = ACT_C(0x1.3d4fa8p-3);   /* erf(1), 1 - erf(1) */
+
+    act_vf_t a = act_abs(x);
+    a = act_sel(a > ACT_GELU_MAX, act_set1(ACT_GELU_MAX), a);
+    act_vf_t z = a * ACT_C(0x1.6a09e667f3bcdp-1);
+    act_vi_t neg = x < ACT_C(0.0);
+
+    /* z < 1.25 */
+    act_vi_t r1 = z < ACT_C(0.84375);
+    act_vf_t v = act_sel(r1, z * z, z - ACT_C(1.0));
+
+    act_vf_t P = act_pick(r1, 0.0, -0x1.1bf380a96073fp-9);
+    P = P * v + act_pick(r1, 0.0, 0x1.22a36599795ebp-5);
+    P = P * v + act_pick(r1, -0x1.8ead6120016acp-16, -0x1.c63983d3e28ecp-4);
+    P = P * v + act_pick(r1, -0x1.7a291236668e4p-8, 0x1.45fca805120e4p-2);
+    P = P * v + act_pick(r1, -0x1.d2a51dbd7194fp-6, -0x1.7d240fbb8c3f1p-2);
+    P = P * v + act_pick(r1, -0x1.4cd7d691cb913p-2, 0x1.a8d00ad92b34dp-2);
+    P = P * v + act_pick(r1, 0x1.06eba8214db68p-3, -0x1.359b8bef77538p-9);
+
+    act_vf_t Q = act_pick(r1, 0.0, 0x1.88b545735151dp-7);
+    Q = Q * v + act_pick(r1, -0x1.09c4342a2612p-18, 0x1.bedc26b51dd1cp-7);
+    Q = Q * v + act_pick(r1, 0x1.15dc9221c1a1p-13, 0x1.02660e763351fp-3);
+    Q = Q * v + act_pick(r1, 0x1.4d022c4d36b0fp-8, 0x1.2635cd99fe9a8p-4);
+    Q = Q * v + act_pick(r1, 0x1.0a54c5536cebap-4, 0x1.14af092eb6f33p-1);
+    Q = Q * v + act_pick(r1, 0x1.97779cddadc09p-2, 0x1.b3e6618eee323p-4);
+    Q = Q * v + ACT_C(1.0);
+
+    act_vf_t y = P / Q;
+    act_vi_t quarter = z < ACT_C(0.25);
+
+    act_vf_t B = act_sel(r1, z, act_set1(ACT_C(1.0)));
+    act_vf_t erf = act_sel(r1, z, act_set1(ERX)) + B * y;
+    act_vf_t C = act_sel(r1, act_pick(quarter, 1.0, 0.5), act_set1(EFC));
+    act_vf_t D = act_sel(r1, act_sel(quarter, z, z - ACT_C(0.5)), act_set1(ACT_C(0.0)));
+    act_vf_t erfc = C - (D + B * y);
+
+    act_vf_t res = x * act_sel(neg, ACT_C(0.5) * erfc, ACT_C(0.5) + ACT_C(0.5) * erf);
+
+    /* z >= 1.25 */
+    act_vi_t far = z >= ACT_C(1.25);
+    if (ACT_ANY(far)) {
+        act_vi_t r3 = z < ACT_C(0x1.6db6db6db6db7p+1);
+        act_vf_t s = ACT_C(1.0) / (z * z);
+
+        act_vf_t R = act_pick(r3, -0x1.3a0efc69ac25cp3, 0.0);
+        R = R * s + act_pick(r3, -0x1.4526557e4d2f2p6, -0x1.e384e9bdc383fp8);
+        R = R * s + act_pick(r3, -0x1.7135cebccabb2p7, -0x1.004616a2e5992p10);
+        R = R * s + act_pick(r3, -0x1.44cb184282266p7, -0x1.3ec881375f228p9);
+        R = R * s + act_pick(r3, -0x1.f300ae4cba38dp5, -0x1.4145d43c5ed98p7);
+        R = R * s + act_pick(r3, -0x1.51e0441b0e726p3, -0x1.1c209555f995ap4);
+        R = R * s + act_pick(r3, -0x1.63416e4ba736p-1, -0x1.993ba70c285dep-1);
+        R = R * s + act_pick(r3, -0x1.43412600d6435p-7, -0x1.4341239e86f4ap-7);
+
+        act_vf_t S = act_pick(r3, -0x1.eeff2ee749a62p-5, 0.0);
+        S = S * s + act_pick(r3, 0x1.a47ef8e484a93p2, -0x1.670e242712d62p4);
+        S = S * s + act_pick(r3, 0x1.b28a3ee48ae2cp6, 0x1.da874e79fe763p8);
+        S = S * s + act_pick(r3, 0x1.ad02157700314p8, 0x1.3f219cedf3be6p11);
+        S = S * s + act_pick(r3, 0x1.42b1921ec2868p9, 0x1.8ffb7688c246ap11);
+        S = S * s + act_pick(r3, 0x1.b290dd58a1a71p8, 0x1.802eb189d5118p10);
+        S = S * s + act_pick(r3, 0x1.1350c526ae721p7, 0x1.45cae221b9f0ap8);
+        S = S * s + act_pick(r3, 0x1.3a6b9bd707687p4, 0x1.e568b261d519p4);
+        S = S * s + ACT_C(1.0);
+
+        act_vf_t X = (act_vf_t)((act_vi_t)a & ACT_SPLIT_MASK);
+        act_vf_t b = ACT_C(0.5) * ((X - a) * (X + a)) + R / S;
+
+        act_vf_t sc;
+        act_vf_t q = act_exp_split(ACT_C(-0.5) * (X * X) - ACT_C(0.5625), &sc);
+        act_vf_t t = ACT_C(0x1.6a09e667f3bcdp-1) * act_exp(b);
+
+        act_vf_t fr = act_sel(neg, ((-t) * q) * sc, x - (t * q) * sc);
+        res = act_sel(far, fr, res);
+    }
+
+    return res;
+}
+
+/*
+ * Array driver: full vectors, then one masked vector for the tail.
+ */
+static inline void
+act_apply_array(act_kern_t kern, int len, const act_t *src, act_t *dst)
+{
+    int j = 0;
+
+    for (; j <= len - ALM_ACT_VLEN; j += ALM_ACT_VLEN)
+        ACT_STOREU(&dst[j], kern(ACT_LOADU(&src[j])));
+
+    if (j < len) {
+        int rem = len - j;
+        ACT_STORE_TAIL(&dst[j], rem, kern(ACT_LOAD_TAIL(&src[j], rem)));
+    }
+}
+
+/*
+ * Softmax, a row at a time.
+ *
+ * act_softmax_stats() reads the row once. Per lane it keeps the running
+ * maximum m and the Kahan-compensated sum of exp(x - m), a block of
+ * ACT_SMX_BLK vectors at a time: the block is loaded into registers, its
+ * maximum taken, the sum rescaled by exp(m_old - m) only if the maximum
+ * grew, and the exponentials added. At the end the lanes are merged into
+ * the row maximum M and the sum S = sum(exp(x - M)) >= 1.
+ *
+ * m starts at -ACT_MAX rather than -Inf, so -Inf inputs add exp(-Inf) = 0
+ * instead of NaN. NaN inputs, +Inf inputs and rows of -Inf give S = NaN,
+ * and every output of the row is then NaN.
+ */
+#define ACT_SMX_BLK     8
+
+/* lanes [0, n) from p, -Inf in the others */
+static inline act_vf_t
+act_load_tail_ninf(const act_t *p, int n)
+{
+    act_vi_t m = {0};
+
+    for (int i = 0; i < n; i++)
+        m[i] = -1;
+
+    return act_sel(m, ACT_LOAD_TAIL(p, n), act_set1(-ACT_C(__builtin_inf())));
+}
+
+static inline void
+act_softmax_stats(int len, const act_t *src, act_t *max, double *sum)
+{
+    act_vf_t blk[ACT_SMX_BLK];
+    act_vf_t m = act_set1(-ACT_MAX);
+    act_vf_t s = act_set1(ACT_C(0.0)), c = s;
+    act_t lm[ALM_ACT_VLEN], ls[ALM_ACT_VLEN];
+    int j = 0;
+
+    while (j < len) {
+        act_vf_t bm = m;
+        int nv;
+
+        for (nv = 0; nv < ACT_SMX_BLK && j < len; nv++, j += ALM_ACT_VLEN) {
+            act_vf_t x = len - j >= ALM_ACT_VLEN ? ACT_LOADU(&src[j]) :
+                         act_load_tail_ninf(&src[j], len - j);
+            blk[nv] = x;
+            bm = act_sel(x > bm, x, bm);
+        }
+
+        act_vi_t up = bm > m;
+        if (ACT_ANY(up)) {
+            act_vf_t r = act_sel(up, act_exp(m - bm), act_set1(ACT_C(1.0)));
+            s = s * r;
+            c = c * r;
+            m = bm;
+        }
+
+        for (int i = 0; i < nv; i++) {
+            act_vf_t y = act_exp(blk[i] - m) - c;
+            act_vf_t t = s + y;
+            c = (t - s) - y;
+            s = t;
+        }
+    }
+
+    __builtin_memcpy(lm, &m, sizeof(lm));
+    act_t mx = lm[0];
+    for (int i = 1; i < ALM_ACT_VLEN; i++)
+        mx = lm[i] > mx ? lm[i] : mx;
+
+    s = (s - c) * act_exp(m - mx);
+    __builtin_memcpy(ls, &s, sizeof(ls));
+    double sm = 0.0;
+    for (int i = 0; i < ALM_ACT_VLEN; i++)
+        sm += (double)ls[i];
+
+    /* only a row of -Inf leaves S = 0 */
+    *max = mx;
+    *sum = sm > 0.0 ? sm : __builtin_nan("");
+}
+
+/*
+ * x - M as d + e exactly (two-sum), with e = 0 where d is not finite.
+ */
+static inline act_vf_t
+act_sub_exact(act_vf_t x, act_vf_t M, act_vf_t *e)
+{
+    act_vf_t d = x - M;
+    act_vf_t bv = d - x;
+    act_vf_t l = (x - (d - bv)) - (M + bv);
+
+    *e = act_sel(l == l, l, act_set1(ACT_C(0.0)));
+    return d;
+}
+
+/*
+ * exp(x - M) / S = exp(d) * (1 + e) * inv, inv = 1/S, the exp() scale
+ * applied last. Below ACT_EXP_LO the result is 0, but e is only bounded
+ * by ulp(d) there and may be huge, so it is dropped.
+ */
+static inline act_vf_t
+act_softmax_vec(act_vf_t x, act_vf_t M, act_vf_t inv)
+{
+    act_vf_t e, sc;
+    act_vf_t d = act_sub_exact(x, M, &e);
+    act_vf_t q = act_exp_split(d, &sc);
+
+    e = act_sel(d < ACT_EXP_LO, act_set1(ACT_C(0.0)), e);
+
+    q = ACT_FMA(q, e, q);
+    return (q * inv) * sc;
+}
+
+/*
+ * (x - M) - log(S) = (d - Lh) + (e - Ll), log(S) = Lh + Ll.
+ */
+static inline act_vf_t
+act_log_softmax_vec(act_vf_t x, act_vf_t M, act_vf_t Lh, act_vf_t Ll)
+{
+    act_vf_t e;
+    act_vf_t d = act_sub_exact(x, M, &e);
+
+    return (d - Lh) + (e - Ll);
+}
+
+static inline void
+act_softmax_row(int len, const act_t *src, act_t *dst)
+{
+    act_t mx;
+    double sm;
+    int j = 0;
+
+    act_softmax_stats(len, src, &mx, &sm);
+
+    act_vf_t M = act_set1(mx);
+    act_vf_t inv = act_set1((act_t)(1.0 / sm));
+
+    for (; j <= len - ALM_ACT_VLEN; j += ALM_ACT_VLEN)
+        ACT_STOREU(&dst[j], act_softmax_vec(ACT_LOADU(&src[j]), M, inv));
+
+    if (j < len) {
+        int rem = len - j;
+        ACT_STORE_TAIL(&dst[j], rem,
+                       act_softmax_vec(ACT_LOAD_TAIL(&src[j], rem), M, inv));
+    }
+}
+
+/* log_fn is the scalar log(), supplied by the includer */
+static inline void
+act_log_softmax_row(int len, const act_t *src, act_t *dst,
+                    double (*log_fn)(double))
+{
+    act_t mx;
+    double sm;
+    int j = 0;
+
+    act_softmax_stats(len, src, &mx, &sm);
+
+    double L = log_fn(sm);
+    act_vf_t M = act_set1(mx);
+    act_vf_t Lh = act_set1((act_t)L);
+    act_vf_t Ll = act_set1((act_t)(L - (double)(act_t)L));
+
+    for (; j <= len - ALM_ACT_VLEN; j += ALM_ACT_VLEN)
+        ACT_STOREU(&dst[j], act_log_softmax_vec(ACT_LOADU(&src[j]), M, Lh, Ll));
+
+    if (j < len) {
+        int rem = len - j;
+        ACT_STORE_TAIL(&dst[j], rem,
+                       act_log_softmax_vec(ACT_LOAD_TAIL(&src[j], rem), M, Lh, Ll));
+    }
+}
+
+#endif  /* __LIBM_ALM_ACTIVATION_H__ */
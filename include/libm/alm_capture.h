@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Argument capture, enabled at run time with AOCL_LIBM_CAPTURE=<file>
+ * (Linux only).
+ *
+ * Every captured function variant has a struct alm_capture_fn in the
+ * alm_capture section, declared with one of the ALM_CAPTURE_* macros
+ * below. When capture is on, alm_iface_fixup() hands each dispatch pointer
+ * it sets to alm_capture_fixup(), which swaps in the wrapper of the
+ * variant; the wrapper records about one call in AOCL_LIBM_CAPTURE_RATE
+ * (default 1000) and calls the implementation. When capture is off nothing is
+ * swapped and calls do not pass through the wrappers.
+ *
+ * Trace format, written by src/alm_capture.c and read by the almbench
+ * replay tests, host byte order:
+ *
+ *   header   struct alm_capture_hdr
+ *   record   struct alm_capture_rec, then its payload
+ *
+ *   ALM_CAPTURE_TAG_NAME   names id: len bytes of payload, uint8 nargs,
+ *                          uint8 esize, "<function>\0<variant>\0", named
+ *                          as in almbench ("exp", "vrd4")
+ *   ALM_CAPTURE_TAG_CALL   one call of id over len elements: nargs
+ *                          arguments of nval values each, nval being len
+ *                          up to ALM_CAPTURE_MAX_VALUES
+ */
+
+#ifndef __LIBM_ALM_CAPTURE_H__
+#define __LIBM_ALM_CAPTURE_H__
+
+#include <stdint.h>
+#include <string.h>
+
+#include <libm/entry_pt.h>
+
+#define ALM_CAPTURE_MAGIC       "ALMTRACE"
+#define ALM_CAPTURE_VERSION     1
+#define ALM_CAPTURE_TAG_NAME    1
+#define ALM_CAPTURE_TAG_CALL    2
+#define ALM_CAPTURE_MAX_VALUES  1024    /* per argument of an array call */
+
+struct alm_capture_hdr {
+    char     magic[8];
+    uint32_t version;
+    uint32_t rate;                      /* one call in rate recorded */
+};
+
+struct alm_capture_rec {
+    uint16_t tag;
+    uint16_t id;
+    uint32_t len;
+    uint32_t nval;
+};
+
+struct alm_capture_fn {
+    alm_ep_func_t *ep;                  /* dispatch pointer of the variant */
+    alm_ep_func_t  wrap;                /* recording wrapper */
+    alm_ep_func_t  next;                /* implementation wrap calls */
+    const char    *func;                /* "exp", "pow" */
+    const char    *variant;             /* "sd", "ss", "vrd4", ..., "vrda" */
+    uint8_t        nargs;
+    uint8_t        esize;
+    int            id;                  /* trace id, -1 until named */
+} __attribute__((aligned(64)));         /* no padding between sites */
+
+int  alm_capture_sample(void);
+void alm_capture_nest(int d);
+void alm_capture_record(struct alm_capture_fn *fn, uint32_t len,
+                        const void *x, const void *y);
+void alm_capture_fixup(alm_ep_func_t *ep);
+
+#if defined(__GNUC__) && !defined(_WIN32)
+
+#define ALM_CAPTURE_SECTION __attribute__((section("alm_capture"), used))
+
+#define __ALM_CAPTURE_FN(nm, fn, var, n, T)                             \
+    static struct alm_capture_fn __alm_capture_##nm ALM_CAPTURE_SECTION = { \
+        .ep = &G_ENTRY_PT_PTR(nm),                                      \
+        .wrap = (alm_ep_func_t)__alm_capture_wrap_##nm,                 \
+        .func = fn, .variant = var, .nargs = n, .esize = sizeof(T),     \
+        .id = -1,                                                       \
+    }
+
+/* T f(T), T f(T, T): scalar variants */
+#define ALM_CAPTURE_SCALAR1(nm, fn, var, T)                             \
+    static struct alm_capture_fn __alm_capture_##nm;                    \
+    static T __alm_capture_wrap_##nm(T x)                               \
+    {                                                                   \
+        if (alm_capture_sample())                                       \
+            alm_capture_record(&__alm_capture_##nm, 1, &x, NULL);       \
+        return ((T (*)(T))__alm_capture_##nm.next)(x);                  \
+    }                                                                   \
+    __ALM_CAPTURE_FN(nm, fn, var, 1, T)
+
+#define ALM_CAPTURE_SCALAR2(nm, fn, var, T)                             \
+    static struct alm_capture_fn __alm_capture_##nm;                    \
+    static T __alm_capture_wrap_##nm(T x, T y)                          \
+    {                                                                   \
+        if (alm_capture_sample())                                       \
+            alm_capture_record(&__alm_capture_##nm, 1, &x, &y);         \
+        return ((T (*)(T, T))__alm_capture_##nm.next)(x, y);            \
+    }                                                                   \
+    __ALM_CAPTURE_FN(nm, fn, var, 2, T)
+
+/* V f(V), V f(V, V): vector variants of N lanes of T */
+#define ALM_CAPTURE_VECTOR1(nm, fn, var, V, T)                          \
+    static struct alm_capture_fn __alm_capture_##nm;                    \
+    static V __alm_capture_wrap_##nm(V x)                               \
+    {                                                                   \
+        if (alm_capture_sample()) {                                     \
+            T a[sizeof(V) / sizeof(T)];                                 \
+            memcpy(a, &x, sizeof(a));                                   \
+            alm_capture_record(&__alm_capture_##nm,                     \
+                               sizeof(V) / sizeof(T), a, NULL);         \
+        }                                                               \
+        return ((V (*)(V))__alm_capture_##nm.next)(x);                  \
+    }                                                                   \
+    __ALM_CAPTURE_FN(nm, fn, var, 1, T)
+
+#define ALM_CAPTURE_VECTOR2(nm, fn, var, V, T)                          \
+    static struct alm_capture_fn __alm_capture_##nm;                    \
+    static V __alm_capture_wrap_##nm(V x, V y)                          \
+    {                                                                   \
+        if (alm_capture_sample()) {                                     \
+            T a[sizeof(V) / sizeof(T)], b[sizeof(V) / sizeof(T)];       \
+            memcpy(a, &x, sizeof(a));                                   \
+            memcpy(b, &y, sizeof(b));                                   \
+            alm_capture_record(&__alm_capture_##nm,                     \
+                               sizeof(V) / sizeof(T), a, b);            \
+        }                                                               \
+        return ((V (*)(V, V))__alm_capture_##nm.next)(x, y);            \
+    }                                                                   \
+    __ALM_CAPTURE_FN(nm, fn, var, 2, T)
+
+/* void f(int, const T *, T *), void f(int, const T *, const T *, T *) */
+#define ALM_CAPTURE_ARRAY1(nm, fn, var, T)                              \
+    static struct alm_capture_fn __alm_capture_##nm;                    \
+    static void __alm_capture_wrap_##nm(int len, const T *x, T *z)      \
+    {                                                                   \
+        if (len > 0 && alm_capture_sample())                            \
+            alm_capture_record(&__alm_capture_##nm, (uint32_t)len,      \
+                               x, NULL);                                \
+        alm_capture_nest(1);                                            \
+        ((void (*)(int, const T *, T *))__alm_capture_##nm.next)(len, x, z); \
+        alm_capture_nest(-1);                                           \
+    }                                                                   \
+    __ALM_CAPTURE_FN(nm, fn, var, 1, T)
+
+#define ALM_CAPTURE_ARRAY2(nm, fn, var, T)                              \
+    static struct alm_capture_fn __alm_capture_##nm;                    \
+    static void __alm_capture_wrap_##nm(int len, const T *x, const T *y, \
+                                        T *z)                           \
+    {                                                                   \
+        if (len > 0 && alm_capture_sample())                            \
+            alm_capture_record(&__alm_capture_##nm, (uint32_t)len, x, y); \
+        alm_capture_nest(1);                                            \
+        ((void (*)(int, const T *, const T *, T *))                     \
+            __alm_capture_##nm.next)(len, x, y, z);                     \
+        alm_capture_nest(-1);                                           \
+    }                                                                   \
+    __ALM_CAPTURE_FN(nm, fn, var, 2, T)
+
+#else   /* no capture */
+
+#define ALM_CAPTURE_SCALAR1(nm, fn, var, T)
+#define ALM_CAPTURE_SCALAR2(nm, fn, var, T)
+#define ALM_CAPTURE_VECTOR1(nm, fn, var, V, T)
+#define ALM_CAPTURE_VECTOR2(nm, fn, var, V, T)
+#define ALM_CAPTURE_ARRAY1(nm, fn, var, T)
+#define ALM_CAPTURE_ARRAY2(nm, fn, var, T)
+
+#endif
+
+#endif  /* __LIBM_ALM_CAPTURE_H__ */
@@ -0,0 +1,893 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Width-generic kernels for the complex vector and array variants of
+ * cexp, clog, cpow, csqrt, cabs, carg and the circular and hyperbolic
+ * functions.
+ *
+ * A vector of complex numbers is held split, the real parts in one
+ * register and the imaginary parts in another. Interleaved arrays
+ * (re, im pairs, the layout of double complex and std::complex) are
+ * de-interleaved on load and re-interleaved on store.
+ *
+ * Lanes with ordinary operands are computed with the vrd4/vrd8 exp, expm1,
+ * log, sincos and atan kernels:
+ *     cexp(a + ib)  = exp(a) * (cos(b) + i sin(b))
+ *     clog(a + ib)  = log|z| + i atan2(b, a)
+ *     cpow(x, y)    = cexp(y * clog(x))
+ *     csinh(a + ib) = sinh(a) cos(b) + i cosh(a) sin(b)
+ *     ccosh(a + ib) = cosh(a) cos(b) + i sinh(a) sin(b)
+ *     ctanh(a + ib) = (sinh(a) cosh(a) + i sin(b) cos(b))
+ *                     / (sinh(a)^2 + cos(b)^2)
+ *     csqrt(a + ib) = t + i b/2t, t = sqrt((|z| + a)/2), for a >= 0
+ * csin, ccos and ctan are csinh, ccosh and ctanh of iz, rotated back.
+ * The remaining lanes, zero, infinite or NaN operands and results that
+ * would overflow or underflow, are recomputed with the scalar function,
+ * so special values are exactly those of the scalar amd_ functions.
+ *
+ * |z| and log|z| keep a*a + b*b as a double-double, so accuracy holds for
+ * |z| close to 1, and operands outside [2^-500, 2^500] are scaled by 2^600
+ * or 2^-600 first. atan2 is the atan of the smaller over the larger
+ * magnitude, moved to the right quadrant. sinh and cosh share one exp,
+ * below 1 sinh is a polynomial instead to stay accurate near zero.
+ *
+ * Single precision operands are widened, evaluated with the same binary64
+ * kernels and rounded once.
+ *
+ * The includer defines ALM_ACT_DOUBLE and ALM_ACT_VLEN to 4 or 8.
+ */
+
+#ifndef __LIBM_ALM_COMPLEX_H__
+#define __LIBM_ALM_COMPLEX_H__
+
+#include <string.h>
+
+#include <libm/alm_normal.h>
+
+/*
+ * CPX_DEINT splits re/im within 128-bit lanes, which leaves the elements
+ * permuted. CPX_INT undoes it for complex results, CPX_UNPERM for real
+ * ones (the pairs of 64 bits are in the same order in both precisions).
+ */
+#if ALM_ACT_VLEN == 4
+#define CPX_EXP(x)              ALM_PROTO(vrd4_exp)(x)
+#define CPX_LOG(x)              ALM_PROTO(vrd4_log)(x)
+#define CPX_ATAN(x)             ALM_PROTO(vrd4_atan)(x)
+#define CPX_SINCOS(x, s, c)     ALM_PROTO(vrd4_sincos)(x, s, c)
+#define CPX_DEINT(p, q, a, b)   (a = _mm256_unpacklo_pd(p, q), b = _mm256_unpackhi_pd(p, q))
+#define CPX_INT(a, b, p, q)     (p = _mm256_unpacklo_pd(a, b), q = _mm256_unpackhi_pd(a, b))
+#define CPX_DEINTF(p, q, a, b)  (a = _mm256_shuffle_ps(p, q, 0x88), b = _mm256_shuffle_ps(p, q, 0xdd))
+#define CPX_INTF(a, b, p, q)    (p = _mm256_unpacklo_ps(a, b), q = _mm256_unpackhi_ps(a, b))
+#define CPX_UNPERM(v)           ((__typeof__(v))_mm256_permute4x64_pd((__m256d)(v), 0xd8))
+#else
+#define CPX_EXP(x)              ALM_PROTO(vrd8_exp)(x)
+#define CPX_LOG(x)              ALM_PROTO(vrd8_log)(x)
+#define CPX_ATAN(x)             ALM_PROTO(vrd8_atan)(x)
+#define CPX_SINCOS(x, s, c)     ALM_PROTO(vrd8_sincos)(x, s, c)
+#define CPX_DEINT(p, q, a, b)   (a = _mm512_unpacklo_pd(p, q), b = _mm512_unpackhi_pd(p, q))
+#define CPX_INT(a, b, p, q)     (p = _mm512_unpacklo_pd(a, b), q = _mm512_unpackhi_pd(a, b))
+#define CPX_DEINTF(p, q, a, b)  (a = _mm512_shuffle_ps(p, q, 0x88), b = _mm512_shuffle_ps(p, q, 0xdd))
+#define CPX_INTF(a, b, p, q)    (p = _mm512_unpacklo_ps(a, b), q = _mm512_unpackhi_ps(a, b))
+#define CPX_UNPERM(v)           ((__typeof__(v))_mm512_permutexvar_pd(                 \
+                                     _mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), (__m512d)(v)))
+#endif
+
+#define CPX_INF_BITS    INT64_C(0x7ff0000000000000)
+#define CPX_PI          0x1.921fb54442d18p+1
+#define CPX_PI_2        0x1.921fb54442d18p+0
+#define CPX_BIG         0x1p500
+#define CPX_SMALL       0x1p-500
+#define CPX_DOWN        0x1p-600
+#define CPX_UP          0x1p600
+#define CPX_SCALE_LOG   (600 * 0x1.62e42fefa39efp-1)
+#define CPX_SQRT_DOWN   0x1p-300
+#define CPX_SQRT_UP     0x1p300
+
+/*
+ * exp(a) range handled in vectors. Single precision is evaluated in double,
+ * its overflow and underflow happen on the final narrowing with the right
+ * signs, so it uses the same range.
+ */
+#define CPX_EXP_LO      -708.0
+#define CPX_EXP_HI      0x1.62e42fefa39efp+9
+
+/* |a| handled in vectors by csinh and ccosh, and where tanh(a) = +-1 */
+#define CPX_SINH_MAX    709.0
+#define CPX_TANH_BIG    20.0
+
+typedef fc64_t (*cpx_scal1_t)(fc64_t x);
+typedef fc64_t (*cpx_scal2_t)(fc64_t x, fc64_t y);
+typedef fc32_t (*cpx_scal1f_t)(fc32_t x);
+typedef fc32_t (*cpx_scal2f_t)(fc32_t x, fc32_t y);
+typedef double (*cpx_scalr_t)(fc64_t x);
+typedef float  (*cpx_scalrf_t)(fc32_t x);
+
+static inline act_vi_t
+cpx_finite(act_vf_t x)
+{
+    return ((act_vi_t)x & ACT_ABS_MASK) < CPX_INF_BITS;
+}
+
+static inline act_vi_t
+cpx_nonzero(act_vf_t a, act_vf_t b)
+{
+    return (((act_vi_t)a | (act_vi_t)b) & ACT_ABS_MASK) != 0;
+}
+
+/* lanes of ok, as a bit mask */
+static inline int
+cpx_bits(act_vi_t ok)
+{
+    return (int)ACT_ANY(ok);
+}
+
+/* atan2(y, x) for finite x and y, not both zero */
+static inline act_vf_t
+cpx_atan2(act_vf_t y, act_vf_t x)
+{
+    act_vi_t swap = act_abs(y) > act_abs(x);
+    act_vi_t sign = (act_vi_t)y & ~ACT_ABS_MASK;
+    act_vf_t t = CPX_ATAN(act_sel(swap, x, y) / act_sel(swap, y, x));
+    act_vf_t pi = (act_vf_t)((act_vi_t)act_set1(CPX_PI) | sign);
+    act_vf_t pi_2 = (act_vf_t)((act_vi_t)act_set1(CPX_PI_2) | sign);
+
+    return act_sel(swap, pi_2 - t, act_sel(x < 0.0, t + pi, t));
+}
+
+/*
+ * a*a + b*b as s + t for finite a and b. a and b are scaled in place by
+ * 2^-600 (big lanes) or 2^600 (small lanes) when their larger magnitude
+ * lies outside [2^-500, 2^500].
+ */
+static inline void
+cpx_sumsq(act_vf_t *a, act_vf_t *b, act_vf_t *s, act_vf_t *t,
+          act_vi_t *big, act_vi_t *small)
+{
+    act_vf_t m = act_sel(act_abs(*a) > act_abs(*b), act_abs(*a), act_abs(*b));
+    act_vf_t sc, aa, bb, hi, lo;
+
+    *big = m > CPX_BIG;
+    *small = m < CPX_SMALL;
+    sc = act_sel(*big, act_set1(CPX_DOWN),
+                 act_sel(*small, act_set1(CPX_UP), act_set1(1.0)));
+
+    *a *= sc;
+    *b *= sc;
+    aa = *a * *a;
+    bb = *b * *b;
+    hi = act_sel(aa > bb, aa, bb);
+    lo = act_sel(aa > bb, bb, aa);
+    *s = hi + lo;
+    *t = ((hi - *s) + lo) + (ACT_FMA(*a, *a, -aa) + ACT_FMA(*b, *b, -bb));
+}
+
+/* log|a + ib| for finite a and b, not both zero */
+static inline act_vf_t
+cpx_log_abs(act_vf_t a, act_vf_t b)
+{
+    act_vf_t s, t, k;
+    act_vi_t big, small;
+
+    cpx_sumsq(&a, &b, &s, &t, &big, &small);
+    k = act_sel(big, act_set1(CPX_SCALE_LOG),
+                act_sel(small, act_set1(-CPX_SCALE_LOG), act_set1(0.0)));
+
+    return 0.5 * (CPX_LOG(s) + t / s) + k;
+}
+
+/*
+ * sinh(x) for |x| < 1 by its Taylor series to degree 19, the remainder is
+ * under 2^-65. There is no vector expm1 in double to take it from.
+ */
+static const double cpx_sinh_poly[] = {
+    0x1.2f49b46814157p-57, 0x1.952c77030ad4ap-49, 0x1.ae7f3e733b81fp-41,
+    0x1.6124613a86d09p-33, 0x1.ae64567f544e4p-26, 0x1.71de3a556c734p-19,
+    0x1.a01a01a01a01ap-13, 0x1.1111111111111p-7,  0x1.5555555555555p-3,
+};
+
+static inline act_vf_t
+cpx_sinh_small(act_vf_t x)
+{
+    act_vf_t x2 = x * x, p = act_set1(cpx_sinh_poly[0]);
+
+    for (size_t i = 1; i < sizeof(cpx_sinh_poly) / sizeof(cpx_sinh_poly[0]); i++)
+        p = p * x2 + cpx_sinh_poly[i];
+
+    return x + x * x2 * p;
+}
+
+/*
+ * sinh(a) and cosh(a) for |a| <= CPX_SINH_MAX, *q gets e^-|a|. Past 1 the
+ * difference 0.5 (e^|a| - e^-|a|) loses under a bit.
+ */
+static inline void
+cpx_sinhcosh(act_vf_t a, act_vf_t *sh, act_vf_t *ch, act_vf_t *q)
+{
+    act_vf_t e = CPX_EXP(act_abs(a));
+
+    *q = 1.0 / e;
+    *ch = 0.5 * (e + *q);
+    *sh = act_sel(act_abs(a) < 1.0, cpx_sinh_small(a),
+                  (act_vf_t)((act_vi_t)(0.5 * (e - *q)) |
+                             ((act_vi_t)a & ~ACT_ABS_MASK)));
+}
+
+/*
+ * Fast paths. Each returns the bit mask of the lanes it could not handle,
+ * their results are left undefined. lo and hi bound the real part of the
+ * exponent, see CPX_EXP_LO/HI.
+ */
+static inline int
+cpx_exp_fast(act_vf_t a, act_vf_t b, double lo, double hi,
+             act_vf_t *re, act_vf_t *im)
+{
+    act_vi_t ok = (a >= lo) & (a <= hi) & cpx_finite(b);
+    act_vf_t zero = act_set1(0.0), e, s, c;
+
+    a = act_sel(ok, a, zero);
+    b = act_sel(ok, b, zero);
+
+    e = CPX_EXP(a);
+    CPX_SINCOS(b, &s, &c);
+    *re = e * c;
+    *im = e * s;
+
+    return ~cpx_bits(ok) & ((1 << ALM_ACT_VLEN) - 1);
+}
+
+static inline int
+cpx_log_fast(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)
+{
+    act_vi_t ok = cpx_finite(a) & cpx_finite(b) & cpx_nonzero(a, b);
+    act_vf_t one = act_set1(1.0);
+
+    a = act_sel(ok, a, one);
+    b = act_sel(ok, b, one);
+
+    *re = cpx_log_abs(a, b);
+    *im = cpx_atan2(b, a);
+
+    return ~cpx_bits(ok) & ((1 << ALM_ACT_VLEN) - 1);
+}
+
+static inline int
+cpx_pow_fast(act_vf_t a, act_vf_t b, act_vf_t c, act_vf_t d,
+             double lo, double hi, act_vf_t *re, act_vf_t *im)
+{
+    act_vi_t ok = cpx_finite(c) & cpx_finite(d);
+    act_vf_t zero = act_set1(0.0), l, t;
+    int bad;
+
+    bad = cpx_log_fast(a, b, &l, &t);
+    c = act_sel(ok, c, zero);
+    d = act_sel(ok, d, zero);
+
+    bad |= cpx_exp_fast(c * l - d * t, d * l + c * t, lo, hi, re, im);
+
+    return bad | (~cpx_bits(ok) & ((1 << ALM_ACT_VLEN) - 1));
+}
+
+static inline int
+cpx_sqrt_fast(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)
+{
+    act_vi_t ok = cpx_finite(a) & cpx_finite(b) & cpx_nonzero(a, b);
+    act_vf_t one = act_set1(1.0), s, t, r, u, v, b0;
+    act_vi_t big, small;
+
+    a = act_sel(ok, a, one);
+    b0 = b = act_sel(ok, b, one);
+
+    cpx_sumsq(&a, &b, &s, &t, &big, &small);
+    r = NRM_SQRT(s);
+    r += t / (r + r);
+    u = NRM_SQRT(0.5 * (act_abs(a) + r));
+
+    /* unscaled, as the scaled b may have underflowed */
+    u *= act_sel(big, act_set1(CPX_SQRT_UP),
+                 act_sel(small, act_set1(CPX_SQRT_DOWN), one));
+    v = b0 / (u + u);
+
+    *re = act_sel(a >= 0.0, u, act_abs(v));
+    *im = act_sel(a >= 0.0, v,
+                  (act_vf_t)((act_vi_t)u | ((act_vi_t)b0 & ~ACT_ABS_MASK)));
+
+    return ~cpx_bits(ok) & ((1 << ALM_ACT_VLEN) - 1);
+}
+
+static inline int
+cpx_abs_fast(act_vf_t a, act_vf_t b, act_vf_t *r)
+{
+    act_vi_t ok = cpx_finite(a) & cpx_finite(b), big, small;
+    act_vf_t zero = act_set1(0.0), s, t, h;
+
+    a = act_sel(ok, a, zero);
+    b = act_sel(ok, b, zero);
+
+    cpx_sumsq(&a, &b, &s, &t, &big, &small);
+    h = NRM_SQRT(s);
+    h = act_sel(s == 0.0, zero, h + t / (h + h));
+    *r = h * act_sel(big, act_set1(CPX_UP),
+                     act_sel(small, act_set1(CPX_DOWN), act_set1(1.0)));
+
+    return ~cpx_bits(ok) & ((1 << ALM_ACT_VLEN) - 1);
+}
+
+static inline int
+cpx_arg_fast(act_vf_t a, act_vf_t b, act_vf_t *r)
+{
+    act_vi_t ok = cpx_finite(a) & cpx_finite(b) & cpx_nonzero(a, b);
+    act_vf_t one = act_set1(1.0);
+
+    *r = cpx_atan2(act_sel(ok, b, one), act_sel(ok, a, one));
+
+    return ~cpx_bits(ok) & ((1 << ALM_ACT_VLEN) - 1);
+}
+
+static inline int
+cpx_sinh_fast(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)
+{
+    act_vi_t ok = (act_abs(a) <= CPX_SINH_MAX) & cpx_finite(b);
+    act_vf_t zero = act_set1(0.0), sh, ch, q, s, c;
+
+    a = act_sel(ok, a, zero);
+    b = act_sel(ok, b, zero);
+
+    cpx_sinhcosh(a, &sh, &ch, &q);
+    CPX_SINCOS(b, &s, &c);
+    *re = sh * c;
+    *im = ch * s;
+
+    return ~cpx_bits(ok) & ((1 << ALM_ACT_VLEN) - 1);
+}
+
+static inline int
+cpx_cosh_fast(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)
+{
+    act_vi_t ok = (act_abs(a) <= CPX_SINH_MAX) & cpx_finite(b);
+    act_vf_t zero = act_set1(0.0), sh, ch, q, s, c;
+
+    a = act_sel(ok, a, zero);
+    b = act_sel(ok, b, zero);
+
+    cpx_sinhcosh(a, &sh, &ch, &q);
+    CPX_SINCOS(b, &s, &c);
+    *re = ch * c;
+    *im = sh * s;
+
+    return ~cpx_bits(ok) & ((1 << ALM_ACT_VLEN) - 1);
+}
+
+/*
+ * Past CPX_TANH_BIG, tanh(a) rounds to +-1 and the imaginary part is
+ * sin(2b) / cosh(2a) = 4 sin(b) cos(b) / (e^|a|)^2, to working accuracy.
+ */
+static inline int
+cpx_tanh_fast(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)
+{
+    act_vi_t ok = cpx_finite(a) & cpx_finite(b), big;
+    act_vi_t sign = (act_vi_t)a & ~ACT_ABS_MASK;
+    act_vf_t zero = act_set1(0.0), q, sh, ch, s, c, d;
+
+    a = act_sel(ok, a, zero);
+    b = act_sel(ok, b, zero);
+    big = act_abs(a) > CPX_TANH_BIG;
+
+    cpx_sinhcosh(a, &sh, &ch, &q);
+    CPX_SINCOS(b, &s, &c);
+    d = sh * sh + c * c;
+
+    *re = act_sel(big, (act_vf_t)((act_vi_t)act_set1(1.0) | sign), sh * ch / d);
+    *im = act_sel(big, 4.0 * s * c * q * q, s * c / d);
+
+    return ~cpx_bits(ok) & ((1 << ALM_ACT_VLEN) - 1);
+}
+
+/* csin(z) = -i csinh(iz), ccos(z) = ccosh(iz), ctan(z) = -i ctanh(iz) */
+static inline int
+cpx_sin_fast(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)
+{
+    act_vf_t u, v;
+    int bad = cpx_sinh_fast(-b, a, &u, &v);
+
+    *re = v;
+    *im = -u;
+    return bad;
+}
+
+static inline int
+cpx_cos_fast(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)
+{
+    return cpx_cosh_fast(-b, a, re, im);
+}
+
+static inline int
+cpx_tan_fast(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)
+{
+    act_vf_t u, v;
+    int bad = cpx_tanh_fast(-b, a, &u, &v);
+
+    *re = v;
+    *im = -u;
+    return bad;
+}
+
+static inline fc64_t
+cpx_make(double re, double im)
+{
+    double p[2] = {re, im};
+    fc64_t z;
+
+    memcpy(&z, p, sizeof(z));
+    return z;
+}
+
+static inline fc32_t
+cpx_makef(float re, float im)
+{
+    float p[2] = {re, im};
+    fc32_t z;
+
+    memcpy(&z, p, sizeof(z));
+    return z;
+}
+
+/*
+ * Scalar fallback for the lanes in bad. scal1 is called for unary
+ * functions, scal2 with (c, d) as second operand otherwise.
+ */
+#define CPX_FIXUP(name, T, V, N, STOREU, LOADU, C, make, scal1_t, scal2_t)  \
+static inline void                                                          \
+name(int bad, scal1_t scal1, scal2_t scal2, V a, V b, V c, V d,             \
+     V *re, V *im)                                                          \
+{                                                                           \
+    T pa[N], pb[N], pc[N], pd[N], pr[N], pi[N], r[2];                       \
+    int i;                                                                  \
+                                                                            \
+    STOREU(pa, a); STOREU(pb, b); STOREU(pc, c); STOREU(pd, d);             \
+    STOREU(pr, *re); STOREU(pi, *im);                                       \
+                                                                            \
+    for (i = 0; i < N; i++) {                                               \
+        C z;                                                                \
+                                                                            \
+        if (!(bad & (1 << i)))                                              \
+            continue;                                                       \
+        z = scal2 ? scal2(make(pa[i], pb[i]), make(pc[i], pd[i]))           \
+                  : scal1(make(pa[i], pb[i]));                              \
+        memcpy(r, &z, sizeof(r));                                           \
+        pr[i] = r[0];                                                       \
+        pi[i] = r[1];                                                       \
+    }                                                                       \
+                                                                            \
+    *re = LOADU(pr);                                                        \
+    *im = LOADU(pi);                                                        \
+}
+
+CPX_FIXUP(cpx_fixup, double, act_vf_t, ALM_ACT_VLEN, ACT_STOREU, ACT_LOADU,
+          fc64_t, cpx_make, cpx_scal1_t, cpx_scal2_t)
+CPX_FIXUP(cpx_fixupf, float, nrm_vf_t, NRM_VLENF, NRM_STOREU, NRM_LOADU,
+          fc32_t, cpx_makef, cpx_scal1f_t, cpx_scal2f_t)
+
+/* Scalar fallback for real valued functions (cabs, carg) */
+#define CPX_FIXUP_REAL(name, T, V, N, STOREU, LOADU, make, scal_t)          \
+static inline V                                                             \
+name(int bad, scal_t scal, V a, V b, V r)                                   \
+{                                                                           \
+    T pa[N], pb[N], pr[N];                                                  \
+    int i;                                                                  \
+                                                                            \
+    STOREU(pa, a); STOREU(pb, b); STOREU(pr, r);                            \
+                                                                            \
+    for (i = 0; i < N; i++)                                                 \
+        if (bad & (1 << i))                                                 \
+            pr[i] = scal(make(pa[i], pb[i]));                               \
+                                                                            \
+    return LOADU(pr);                                                       \
+}
+
+CPX_FIXUP_REAL(cpx_fixup_real, double, act_vf_t, ALM_ACT_VLEN, ACT_STOREU,
+               ACT_LOADU, cpx_make, cpx_scalr_t)
+CPX_FIXUP_REAL(cpx_fixup_realf, float, nrm_vf_t, NRM_VLENF, NRM_STOREU,
+               NRM_LOADU, cpx_makef, cpx_scalrf_t)
+
+/* Vector kernels */
+
+static inline void
+cpx_cexp(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)
+{
+    int bad = cpx_exp_fast(a, b, CPX_EXP_LO, CPX_EXP_HI, re, im);
+
+    if (bad)
+        cpx_fixup(bad, ALM_PROTO(cexp), NULL, a, b, a, b, re, im);
+}
+
+static inline void
+cpx_clog(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)
+{
+    int bad = cpx_log_fast(a, b, re, im);
+
+    if (bad)
+        cpx_fixup(bad, ALM_PROTO(clog), NULL, a, b, a, b, re, im);
+}
+
+static inline void
+cpx_cpow(act_vf_t a, act_vf_t b, act_vf_t c, act_vf_t d,
+         act_vf_t *re, act_vf_t *im)
+{
+    int bad = cpx_pow_fast(a, b, c, d, CPX_EXP_LO, CPX_EXP_HI, re, im);
+
+    if (bad)
+        cpx_fixup(bad, NULL, ALM_PROTO(cpow), a, b, c, d, re, im);
+}
+
+/*
+ * Kernels with a fast path of the form fast(a, b, &re, &im), and of the
+ * form fast(a, b, &r) for real results.
+ */
+#define CPX_KERN1(name, fast, scal)                                         \
+static inline void                                                          \
+name(act_vf_t a, act_vf_t b, act_vf_t *re, act_vf_t *im)                    \
+{                                                                           \
+    int bad = fast(a, b, re, im);                                           \
+                                                                            \
+    if (bad)                                                                \
+        cpx_fixup(bad, scal, NULL, a, b, a, b, re, im);                     \
+}
+
+#define CPX_KERNR(name, fast, scal)                                         \
+static inline act_vf_t                                                      \
+name(act_vf_t a, act_vf_t b)                                                \
+{                                                                           \
+    act_vf_t r;                                                             \
+    int bad = fast(a, b, &r);                                               \
+                                                                            \
+    return bad ? cpx_fixup_real(bad, scal, a, b, r) : r;                    \
+}
+
+CPX_KERN1(cpx_csqrt, cpx_sqrt_fast, ALM_PROTO(csqrt))
+CPX_KERN1(cpx_csin,  cpx_sin_fast,  ALM_PROTO(csin))
+CPX_KERN1(cpx_ccos,  cpx_cos_fast,  ALM_PROTO(ccos))
+CPX_KERN1(cpx_ctan,  cpx_tan_fast,  ALM_PROTO(ctan))
+CPX_KERN1(cpx_csinh, cpx_sinh_fast, ALM_PROTO(csinh))
+CPX_KERN1(cpx_ccosh, cpx_cosh_fast, ALM_PROTO(ccosh))
+CPX_KERN1(cpx_ctanh, cpx_tanh_fast, ALM_PROTO(ctanh))
+CPX_KERNR(cpx_cabs,  cpx_abs_fast,  ALM_PROTO(cabs))
+CPX_KERNR(cpx_carg,  cpx_arg_fast,  ALM_PROTO(carg))
+
+/* Single precision, in two binary64 halves */
+
+static inline void
+cpx_cexpf(nrm_vf_t a, nrm_vf_t b, nrm_vf_t *re, nrm_vf_t *im)
+{
+    act_vf_t r0, i0, r1, i1;
+    int bad;
+
+    bad  = cpx_exp_fast(NRM_WIDEN(NRM_LO(a)), NRM_WIDEN(NRM_LO(b)),
+                        CPX_EXP_LO, CPX_EXP_HI, &r0, &i0);
+    bad |= cpx_exp_fast(NRM_WIDEN(NRM_HI(a)), NRM_WIDEN(NRM_HI(b)),
+                        CPX_EXP_LO, CPX_EXP_HI, &r1, &i1) << ALM_ACT_VLEN;
+    *re = NRM_JOIN(NRM_NARROW(r0), NRM_NARROW(r1));
+    *im = NRM_JOIN(NRM_NARROW(i0), NRM_NARROW(i1));
+
+    if (bad)
+        cpx_fixupf(bad, ALM_PROTO(cexpf), NULL, a, b, a, b, re, im);
+}
+
+static inline void
+cpx_clogf(nrm_vf_t a, nrm_vf_t b, nrm_vf_t *re, nrm_vf_t *im)
+{
+    act_vf_t r0, i0, r1, i1;
+    int bad;
+
+    bad  = cpx_log_fast(NRM_WIDEN(NRM_LO(a)), NRM_WIDEN(NRM_LO(b)), &r0, &i0);
+    bad |= cpx_log_fast(NRM_WIDEN(NRM_HI(a)), NRM_WIDEN(NRM_HI(b)),
+                        &r1, &i1) << ALM_ACT_VLEN;
+    *re = NRM_JOIN(NRM_NARROW(r0), NRM_NARROW(r1));
+    *im = NRM_JOIN(NRM_NARROW(i0), NRM_NARROW(i1));
+
+    if (bad)
+        cpx_fixupf(bad, ALM_PROTO(clogf), NULL, a, b, a, b, re, im);
+}
+
+static inline void
+cpx_cpowf(nrm_vf_t a, nrm_vf_t b, nrm_vf_t c, nrm_vf_t d,
+          nrm_vf_t *re, nrm_vf_t *im)
+{
+    act_vf_t r0, i0, r1, i1;
+    int bad;
+
+    bad  = cpx_pow_fast(NRM_WIDEN(NRM_LO(a)), NRM_WIDEN(NRM_LO(b)),
+                        NRM_WIDEN(NRM_LO(c)), NRM_WIDEN(NRM_LO(d)),
+                        CPX_EXP_LO, CPX_EXP_HI, &r0, &i0);
+    bad |= cpx_pow_fast(NRM_WIDEN(NRM_HI(a)), NRM_WIDEN(NRM_HI(b)),
+                        NRM_WIDEN(NRM_HI(c)), NRM_WIDEN(NRM_HI(d)),
+                        CPX_EXP_LO, CPX_EXP_HI, &r1, &i1) << ALM_ACT_VLEN;
+    *re = NRM_JOIN(NRM_NARROW(r0), NRM_NARROW(r1));
+    *im = NRM_JOIN(NRM_NARROW(i0), NRM_NARROW(i1));
+
+    if (bad)
+        cpx_fixupf(bad, NULL, ALM_PROTO(cpowf), a, b, c, d, re, im);
+}
+
+#define CPX_KERN1F(name, fast, scal)                                        \
+static inline void                                                          \
+name(nrm_vf_t a, nrm_vf_t b, nrm_vf_t *re, nrm_vf_t *im)                    \
+{                                                                           \
+    act_vf_t r0, i0, r1, i1;                                                \
+    int bad;                                                                \
+                                                                            \
+    bad  = fast(NRM_WIDEN(NRM_LO(a)), NRM_WIDEN(NRM_LO(b)), &r0, &i0);      \
+    bad |= fast(NRM_WIDEN(NRM_HI(a)), NRM_WIDEN(NRM_HI(b)),                 \
+                &r1, &i1) << ALM_ACT_VLEN;                                  \
+    *re = NRM_JOIN(NRM_NARROW(r0), NRM_NARROW(r1));                         \
+    *im = NRM_JOIN(NRM_NARROW(i0), NRM_NARROW(i1));                         \
+                                                                            \
+    if (bad)                                                                \
+        cpx_fixupf(bad, scal, NULL, a, b, a, b, re, im);                    \
+}
+
+#define CPX_KERNRF(name, fast, scal)                                        \
+static inline nrm_vf_t                                                      \
+name(nrm_vf_t a, nrm_vf_t b)                                                \
+{                                                                           \
+    act_vf_t r0, r1;                                                        \
+    nrm_vf_t r;                                                             \
+    int bad;                                                                \
+                                                                            \
+    bad  = fast(NRM_WIDEN(NRM_LO(a)), NRM_WIDEN(NRM_LO(b)), &r0);           \
+    bad |= fast(NRM_WIDEN(NRM_HI(a)), NRM_WIDEN(NRM_HI(b)),                 \
+                &r1) << ALM_ACT_VLEN;                                       \
+    r = NRM_JOIN(NRM_NARROW(r0), NRM_NARROW(r1));                           \
+                                                                            \
+    return bad ? cpx_fixup_realf(bad, scal, a, b, r) : r;                   \
+}
+
+CPX_KERN1F(cpx_csqrtf, cpx_sqrt_fast, ALM_PROTO(csqrtf))
+CPX_KERN1F(cpx_csinf,  cpx_sin_fast,  ALM_PROTO(csinf))
+CPX_KERN1F(cpx_ccosf,  cpx_cos_fast,  ALM_PROTO(ccosf))
+CPX_KERN1F(cpx_ctanf,  cpx_tan_fast,  ALM_PROTO(ctanf))
+CPX_KERN1F(cpx_csinhf, cpx_sinh_fast, ALM_PROTO(csinhf))
+CPX_KERN1F(cpx_ccoshf, cpx_cosh_fast, ALM_PROTO(ccoshf))
+CPX_KERN1F(cpx_ctanhf, cpx_tanh_fast, ALM_PROTO(ctanhf))
+CPX_KERNRF(cpx_cabsf,  cpx_abs_fast,  ALM_PROTO(cabsf))
+CPX_KERNRF(cpx_cargf,  cpx_arg_fast,  ALM_PROTO(cargf))
+
+/*
+ * Array drivers, N complex numbers per vector. Full vectors are loaded
+ * in place; the tail is copied into a buffer of 1 + 0i, so that the
+ * unused lanes stay on the fast path.
+ */
+#define CPX_ARRAY1(name, T, V, N, LOADU, STOREU, DEINT, INT, kern)          \
+static inline void                                                          \
+name(int len, const T *x, T *y)                                             \
+{                                                                           \
+    T bx[2 * N], by[2 * N];                                                 \
+    V p, q, a, b, re, im;                                                   \
+    int j = 0, i;                                                           \
+                                                                            \
+    for (; j <= len - N; j += N) {                                          \
+        p = LOADU(&x[2 * j]);                                               \
+        q = LOADU(&x[2 * j + N]);                                           \
+        DEINT(p, q, a, b);                                                  \
+        kern(a, b, &re, &im);                                               \
+        INT(re, im, p, q);                                                  \
+        STOREU(&y[2 * j], p);                                               \
+        STOREU(&y[2 * j + N], q);                                           \
+    }                                                                       \
+                                                                            \
+    if (j < len) {                                                          \
+        for (i = 0; i < 2 * N; i++)                                         \
+            bx[i] = (T)(1 - (i & 1));                                       \
+        memcpy(bx, &x[2 * j], 2 * (size_t)(len - j) * sizeof(T));           \
+        name(N, bx, by);                                                    \
+        memcpy(&y[2 * j], by, 2 * (size_t)(len - j) * sizeof(T));           \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+static inline void                                                          \
+name##_split(int len, const T *xre, const T *xim, T *yre, T *yim)           \
+{                                                                           \
+    T br[N], bi[N], cr[N], ci[N];                                           \
+    V re, im;                                                               \
+    int j = 0, i;                                                           \
+                                                                            \
+    for (; j <= len - N; j += N) {                                          \
+        kern(LOADU(&xre[j]), LOADU(&xim[j]), &re, &im);                     \
+        STOREU(&yre[j], re);                                                \
+        STOREU(&yim[j], im);                                                \
+    }                                                                       \
+                                                                            \
+    if (j < len) {                                                          \
+        for (i = 0; i < N; i++) {                                           \
+            br[i] = 1;                                                      \
+            bi[i] = 0;                                                      \
+        }                                                                   \
+        memcpy(br, &xre[j], (size_t)(len - j) * sizeof(T));                 \
+        memcpy(bi, &xim[j], (size_t)(len - j) * sizeof(T));                 \
+        name##_split(N, br, bi, cr, ci);                                    \
+        memcpy(&yre[j], cr, (size_t)(len - j) * sizeof(T));                 \
+        memcpy(&yim[j], ci, (size_t)(len - j) * sizeof(T));                 \
+    }                                                                       \
+}
+
+#define CPX_ARRAY2(name, T, V, N, LOADU, STOREU, DEINT, INT, kern)          \
+static inline void                                                          \
+name(int len, const T *x, const T *y, T *z)                                 \
+{                                                                           \
+    T bx[2 * N], by[2 * N], bz[2 * N];                                      \
+    V p, q, a, b, c, d, re, im;                                             \
+    int j = 0, i;                                                           \
+                                                                            \
+    for (; j <= len - N; j += N) {                                          \
+        p = LOADU(&x[2 * j]);                                               \
+        q = LOADU(&x[2 * j + N]);                                           \
+        DEINT(p, q, a, b);                                                  \
+        p = LOADU(&y[2 * j]);                                               \
+        q = LOADU(&y[2 * j + N]);                                           \
+        DEINT(p, q, c, d);                                                  \
+        kern(a, b, c, d, &re, &im);                                         \
+        INT(re, im, p, q);                                                  \
+        STOREU(&z[2 * j], p);                                               \
+        STOREU(&z[2 * j + N], q);                                           \
+    }                                                                       \
+                                                                            \
+    if (j < len) {                                                          \
+        for (i = 0; i < 2 * N; i++)                                         \
+            bx[i] = by[i] = (T)(1 - (i & 1));                               \
+        memcpy(bx, &x[2 * j], 2 * (size_t)(len - j) * sizeof(T));           \
+        memcpy(by, &y[2 * j], 2 * (size_t)(len - j) * sizeof(T));           \
+        name(N, bx, by, bz);                                                \
+        memcpy(&z[2 * j], bz, 2 * (size_t)(len - j) * sizeof(T));           \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+static inline void                                                          \
+name##_split(int len, const T *xre, const T *xim, const T *yre,             \
+             const T *yim, T *zre, T *zim)                                  \
+{                                                                           \
+    T b[4][N], cr[N], ci[N];                                                \
+    V re, im;                                                               \
+    int j = 0, i;                                                           \
+                                                                            \
+    for (; j <= len - N; j += N) {                                          \
+        kern(LOADU(&xre[j]), LOADU(&xim[j]), LOADU(&yre[j]),                \
+             LOADU(&yim[j]), &re, &im);                                     \
+        STOREU(&zre[j], re);                                                \
+        STOREU(&zim[j], im);                                                \
+    }                                                                       \
+                                                                            \
+    if (j < len) {                                                          \
+        for (i = 0; i < N; i++) {                                           \
+            b[0][i] = b[2][i] = 1;                                          \
+            b[1][i] = b[3][i] = 0;                                          \
+        }                                                                   \
+        memcpy(b[0], &xre[j], (size_t)(len - j) * sizeof(T));               \
+        memcpy(b[1], &xim[j], (size_t)(len - j) * sizeof(T));               \
+        memcpy(b[2], &yre[j], (size_t)(len - j) * sizeof(T));               \
+        memcpy(b[3], &yim[j], (size_t)(len - j) * sizeof(T));               \
+        name##_split(N, b[0], b[1], b[2], b[3], cr, ci);                    \
+        memcpy(&zre[j], cr, (size_t)(len - j) * sizeof(T));                 \
+        memcpy(&zim[j], ci, (size_t)(len - j) * sizeof(T));                 \
+    }                                                                       \
+}
+
+/* Real results: y holds len values, the real and imaginary parts of x */
+#define CPX_ARRAYR(name, T, V, N, LOADU, STOREU, DEINT, kern)               \
+static inline void                                                          \
+name(int len, const T *x, T *y)                                             \
+{                                                                           \
+    T bx[2 * N], by[N];                                                     \
+    V p, q, a, b;                                                           \
+    int j = 0, i;                                                           \
+                                                                            \
+    for (; j <= len - N; j += N) {                                          \
+        p = LOADU(&x[2 * j]);                                               \
+        q = LOADU(&x[2 * j + N]);                                           \
+        DEINT(p, q, a, b);                                                  \
+        STOREU(&y[j], CPX_UNPERM(kern(a, b)));                              \
+    }                                                                       \
+                                                                            \
+    if (j < len) {                                                          \
+        for (i = 0; i < 2 * N; i++)                                         \
+            bx[i] = (T)(1 - (i & 1));                                       \
+        memcpy(bx, &x[2 * j], 2 * (size_t)(len - j) * sizeof(T));           \
+        name(N, bx, by);                                                    \
+        memcpy(&y[j], by, (size_t)(len - j) * sizeof(T));                   \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+static inline void                                                          \
+name##_split(int len, const T *xre, const T *xim, T *y)                     \
+{                                                                           \
+    T br[N], bi[N], by[N];                                                  \
+    int j = 0, i;                                                           \
+                                                                            \
+    for (; j <= len - N; j += N)                                            \
+        STOREU(&y[j], kern(LOADU(&xre[j]), LOADU(&xim[j])));                \
+                                                                            \
+    if (j < len) {                                                          \
+        for (i = 0; i < N; i++) {                                           \
+            br[i] = 1;                                                      \
+            bi[i] = 0;                                                      \
+        }                                                                   \
+        memcpy(br, &xre[j], (size_t)(len - j) * sizeof(T));                 \
+        memcpy(bi, &xim[j], (size_t)(len - j) * sizeof(T));                 \
+        name##_split(N, br, bi, by);                                        \
+        memcpy(&y[j], by, (size_t)(len - j) * sizeof(T));                   \
+    }                                                                       \
+}
+
+CPX_ARRAY1(cpx_cexp_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, CPX_INT, cpx_cexp)
+CPX_ARRAY1(cpx_clog_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, CPX_INT, cpx_clog)
+CPX_ARRAY2(cpx_cpow_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, CPX_INT, cpx_cpow)
+CPX_ARRAY1(cpx_cexpf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, CPX_INTF, cpx_cexpf)
+CPX_ARRAY1(cpx_clogf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, CPX_INTF, cpx_clogf)
+CPX_ARRAY2(cpx_cpowf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, CPX_INTF, cpx_cpowf)
+CPX_ARRAY1(cpx_csqrt_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, CPX_INT, cpx_csqrt)
+CPX_ARRAY1(cpx_csin_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, CPX_INT, cpx_csin)
+CPX_ARRAY1(cpx_ccos_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, CPX_INT, cpx_ccos)
+CPX_ARRAY1(cpx_ctan_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, CPX_INT, cpx_ctan)
+CPX_ARRAY1(cpx_csinh_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, CPX_INT, cpx_csinh)
+CPX_ARRAY1(cpx_ccosh_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, CPX_INT, cpx_ccosh)
+CPX_ARRAY1(cpx_ctanh_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, CPX_INT, cpx_ctanh)
+CPX_ARRAYR(cpx_cabs_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, cpx_cabs)
+CPX_ARRAYR(cpx_carg_array, double, act_vf_t, ALM_ACT_VLEN, ACT_LOADU, ACT_STOREU,
+           CPX_DEINT, cpx_carg)
+CPX_ARRAY1(cpx_csqrtf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, CPX_INTF, cpx_csqrtf)
+CPX_ARRAY1(cpx_csinf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, CPX_INTF, cpx_csinf)
+CPX_ARRAY1(cpx_ccosf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, CPX_INTF, cpx_ccosf)
+CPX_ARRAY1(cpx_ctanf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, CPX_INTF, cpx_ctanf)
+CPX_ARRAY1(cpx_csinhf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, CPX_INTF, cpx_csinhf)
+CPX_ARRAY1(cpx_ccoshf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, CPX_INTF, cpx_ccoshf)
+CPX_ARRAY1(cpx_ctanhf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, CPX_INTF, cpx_ctanhf)
+CPX_ARRAYR(cpx_cabsf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, cpx_cabsf)
+CPX_ARRAYR(cpx_cargf_array, float, nrm_vf_t, NRM_VLENF, NRM_LOADU, NRM_STOREU,
+           CPX_DEINTF, cpx_cargf)
+
+#endif  /* __LIBM_ALM_COMPLEX_H__ */
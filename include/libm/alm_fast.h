@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Width- and precision-generic kernels for the fast accuracy tier of
+ * exp() and log(), the vector and array counterparts of src/fast.
+ *
+ * exp: x = (N*n + j) * ln2/N + r, |r| <= ln2/(2N), with 2^(j/N) taken
+ *      from an N-entry table held in registers and looked up with a lane
+ *      permute, so no gather is needed. e^r - 1 is a minimax polynomial
+ *      of degree 6 (binary64, N = 16) or 3 (binary32, N = 8 on AVX2,
+ *      16 on AVX-512). 2^n is applied in two halves, as in act_exp_split,
+ *      so subnormal results are rounded once. Max 1.5 ULP (binary64) and
+ *      2 ULP (binary32).
+ *
+ *      binary64 is provided for 8 lanes only: the 16-entry table fits the
+ *      two-source vpermt2pd. AVX2 has no 64-bit permute of that reach,
+ *      and its 4-entry variant did not beat act_exp(), so the AVX2 fast
+ *      tier keeps vrd4_exp.
+ *
+ * log: act_log(), the table-free fdlibm reduction, for positive normal
+ *      x. Zero, subnormal, negative, infinite and NaN lanes are fixed up
+ *      on a branch that is not taken for ordinary data. Max 1 ULP.
+ *
+ * The includer defines ALM_ACT_VLEN, and ALM_ACT_DOUBLE for binary64, as
+ * for alm_activation.h.
+ */
+
+#ifndef __LIBM_ALM_FAST_H__
+#define __LIBM_ALM_FAST_H__
+
+#include <libm/alm_activation.h>
+
+#if defined(ALM_ACT_DOUBLE)
+#if ALM_ACT_VLEN == 8
+typedef v_u64x8_t   fst_vu_t;
+#define FST_EXP_BITS    4
+/* 2^(j/16), j = 0..7 and 8..15 */
+#define FST_EXP_TBL(j)                                                      \
+    _mm512_permutex2var_pd(                                                 \
+        _mm512_setr_pd(0x1p+0, 0x1.0b5586cf9890fp+0, 0x1.172b83c7d517bp+0,  \
+                       0x1.2387a6e756238p+0, 0x1.306fe0a31b715p+0,          \
+                       0x1.3dea64c123422p+0, 0x1.4bfdad5362a27p+0,          \
+                       0x1.5ab07dd485429p+0),                               \
+        (__m512i)(j),                                                       \
+        _mm512_setr_pd(0x1.6a09e667f3bcdp+0, 0x1.7a11473eb0187p+0,          \
+                       0x1.8ace5422aa0dbp+0, 0x1.9c49182a3f09p+0,           \
+                       0x1.ae89f995ad3adp+0, 0x1.c199bdd85529cp+0,          \
+                       0x1.d5818dcfba487p+0, 0x1.ea4afa2a490dap+0))
+#endif
+#define FST_LOG_SUB     0x1p54
+#define FST_LOG_SUB_K   54.0
+#define FST_LN2         0x1.62e42fefa39efp-1
+#define FST_MIN_NORMAL  0x1p-1022
+#else /* binary32 */
+#if ALM_ACT_VLEN == 8
+#define FST_EXP_BITS    3
+/* 2^(j/8) */
+#define FST_EXP_TBL(j)                                                      \
+    _mm256_permutevar8x32_ps(                                               \
+        _mm256_setr_ps(0x1p+0f, 0x1.172b84p+0f, 0x1.306fep+0f,              \
+                       0x1.4bfdaep+0f, 0x1.6a09e6p+0f, 0x1.8ace54p+0f,      \
+                       0x1.ae89fap+0f, 0x1.d5818ep+0f),                     \
+        (__m256i)(j))
+#else
+#define FST_EXP_BITS    4
+/* 2^(j/16) */
+#define FST_EXP_TBL(j)                                                      \
+    _mm512_permutexvar_ps(                                                  \
+        (__m512i)(j),                                                       \
+        _mm512_setr_ps(0x1p+0f, 0x1.0b5586p+0f, 0x1.172b84p+0f,             \
+                       0x1.2387a6p+0f, 0x1.306fep+0f, 0x1.3dea64p+0f,       \
+                       0x1.4bfdaep+0f, 0x1.5ab07ep+0f, 0x1.6a09e6p+0f,      \
+                       0x1.7a1148p+0f, 0x1.8ace54p+0f, 0x1.9c4918p+0f,      \
+                       0x1.ae89fap+0f, 0x1.c199bep+0f, 0x1.d5818ep+0f,      \
+                       0x1.ea4afap+0f))
+#endif
+#define FST_LOG_SUB     0x1p25f
+#define FST_LOG_SUB_K   25.0f
+#define FST_LN2         0x1.62e43p-1f
+#define FST_MIN_NORMAL  0x1p-126f
+#endif
+
+#if defined(FST_EXP_BITS)
+
+#define FST_EXP_N       (1 << FST_EXP_BITS)
+
+/*
+ * exp(x) for the fast tier. The table index is the low FST_EXP_BITS of
+ * N*n + j, which the permutes read without masking; n itself is split
+ * off with shifts, logical for binary64 where AVX2 and AVX-512F have no
+ * cheap arithmetic 64-bit shift.
+ */
+static inline act_vf_t
+fst_exp(act_vf_t x)
+{
+#if defined(ALM_ACT_DOUBLE)
+    const act_t INVLN2 = 0x1.71547652b82fep+0 * FST_EXP_N;
+    const act_t LN2_HI = 0x1.62e42fefa0000p-1 / FST_EXP_N;
+    const act_t LN2_LO = 0x1.cf79abc9e3b3ap-40 / FST_EXP_N;
+#else
+    const act_t INVLN2 = 0x1.715476p+0f * FST_EXP_N;
+    const act_t LN2_HI = 0x1.62e4p-1f / FST_EXP_N;
+    const act_t LN2_LO = 0x1.7f7d1cp-20f / FST_EXP_N;
+#endif
+
+    act_vf_t xc = act_sel(x > ACT_EXP_HI, act_set1(ACT_EXP_HI), x);
+    xc = act_sel(xc < ACT_EXP_LO, act_set1(ACT_EXP_LO), xc);
+
+    act_vf_t k = xc * INVLN2 + ACT_SHIFT;
+    act_vf_t n = k - ACT_SHIFT;
+    act_vi_t ni = (act_vi_t)k - ACT_SHIFT_BITS;
+
+    act_vf_t r = xc - n * LN2_HI;
+    r = r - n * LN2_LO;
+
+    act_vf_t t = FST_EXP_TBL(ni);
+
+#if defined(ALM_ACT_DOUBLE)
+    act_vf_t p = 0x1.6c17bb51f236dp-10 * r + 0x1.11120af701debp-7;
+    p = p * r + 0x1.55555555194d2p-5;
+    p = p * r + 0x1.55555554dd44dp-3;
+    p = p * r + 0.5;
+
+    act_vi_t m = (act_vi_t)((fst_vu_t)k >> FST_EXP_BITS) -
+                 (ACT_SHIFT_BITS >> FST_EXP_BITS);
+    act_vi_t m1 = (act_vi_t)((fst_vu_t)(m + 2048) >> 1) - 1024;
+#else
+#if FST_EXP_BITS == 3
+    act_vf_t p = 0x1.55596ep-3f * r + 0x1.00052p-1f;
+#else
+    act_vf_t p = 0x1.55565cp-3f * r + 0x1.000148p-1f;
+#endif
+
+    act_vi_t m = ni >> FST_EXP_BITS;
+    act_vi_t m1 = m >> 1;
+#endif
+    p = p * r * r + r;
+
+    act_vf_t q = t + t * p;
+    q = (act_vf_t)((act_vi_t)q + (m1 << ACT_MANT_BITS));
+    q = q * (act_vf_t)((m - m1 + ACT_EXP_BIAS) << ACT_MANT_BITS);
+
+    return act_sel(x == x, q, x);
+}
+
+#endif /* FST_EXP_BITS */
+
+/*
+ * log(x) for the fast tier: act_log() on the common path, subnormals
+ * scaled into the normal range, log(0) = -Inf, log(+Inf) = +Inf and
+ * NaN for negative and NaN operands.
+ */
+static inline act_vf_t
+fst_log(act_vf_t x)
+{
+    act_vf_t y = act_log(x);
+    act_vi_t ok = (x >= FST_MIN_NORMAL) & (x <= ACT_MAX);
+
+    if (unlikely(ACT_ANY(~ok))) {
+        act_vf_t s = act_log(x * FST_LOG_SUB) - FST_LOG_SUB_K * FST_LN2;
+        act_vf_t z = act_sel(x == ACT_C(0.0), act_set1(-__builtin_inf()),
+                             act_set1(__builtin_nan("")));
+
+        z = act_sel(x > ACT_C(0.0), s, z);
+        z = act_sel(x > ACT_MAX, x, z);
+        y = act_sel(ok, y, z);
+    }
+
+    return y;
+}
+
+#endif /* __LIBM_ALM_FAST_H__ */
@@ -0,0 +1,467 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Width-generic binary32 kernels behind the half-precision (FP16) and
+ * bfloat16 (BF16) families.
+ *
+ * FP16 carries 11 significant bits and BF16 8, so every function is
+ * evaluated in binary32 with polynomials a few degrees shorter than the
+ * float versions and rounded once on the way back. The kernels never
+ * call out to scalar code: special inputs fall out of the clamps and
+ * selects, keeping a whole vector on the fast path.
+ *
+ * The includer defines ALM_HALF_VLEN to 8 (AVX2, F16C conversions) or
+ * 16 (AVX512F conversions) before including this file. BF16 stores use
+ * VCVTNEPS2BF16 when compiled for AVX512_BF16 and an integer emulation of
+ * it otherwise.
+ */
+
+#ifndef __LIBM_ALM_HALF_H__
+#define __LIBM_ALM_HALF_H__
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm/types.h>
+#include <libm/typehelper-vec.h>
+
+#if ALM_HALF_VLEN == 8
+typedef v_f32x8_t   half_vf_t;
+typedef v_i32x8_t   half_vi_t;
+typedef __m128i     half_vh_t;      /* 8 x binary16 */
+#define HALF_SQRT(x)        _mm256_sqrt_ps(x)
+#define HALF_CVT_F32(h)     _mm256_cvtph_ps(h)
+#define HALF_CVT_F16(f)     _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT)
+#define HALF_CVT_I2F(i)     cast_v8_i32_to_f32(i)
+#define HALF_LOAD(p)        _mm_loadu_si128((const __m128i *)(p))
+#define HALF_STORE(p, h)    _mm_storeu_si128((__m128i *)(p), h)
+#define HALF_WIDEN_U16(h)   _mm256_cvtepu16_epi32(h)
+#elif ALM_HALF_VLEN == 16
+typedef v_f32x16_t  half_vf_t;
+typedef v_i32x16_t  half_vi_t;
+typedef __m256i     half_vh_t;      /* 16 x binary16 */
+#define HALF_SQRT(x)        _mm512_sqrt_ps(x)
+#define HALF_CVT_F32(h)     _mm512_cvtph_ps(h)
+#define HALF_CVT_F16(f)     _mm512_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT)
+#define HALF_CVT_I2F(i)     cast_v16_i32_to_f32(i)
+#define HALF_LOAD(p)        _mm256_loadu_si256((const __m256i *)(p))
+#define HALF_STORE(p, h)    _mm256_storeu_si256((__m256i *)(p), h)
+#define HALF_WIDEN_U16(h)   _mm512_cvtepu16_epi32(h)
+#define HALF_NARROW_U32(i)  _mm512_cvtepi32_epi16((__m512i)(i))
+#else
+#error "ALM_HALF_VLEN must be 8 or 16"
+#endif
+
+typedef half_vf_t (*half_kern_t)(half_vf_t x);
+
+#define HALF_SIGN_MASK      ((int32_t)0x80000000)
+#define HALF_ABS_MASK       0x7fffffff
+#define HALF_INF_BITS       0x7f800000
+#define HALF_QNAN_BITS      0x7fc00000
+
+/* 0x1.8p23: adding it rounds |x| < 2^22 to an integer in the low bits */
+#define HALF_SHIFT          0x1.8p23f
+#define HALF_SHIFT_BITS     0x4b400000
+
+/* m ? a : b, bitwise */
+static inline half_vi_t
+half_seli(half_vi_t m, half_vi_t a, half_vi_t b)
+{
+    return (a & m) | (b & ~m);
+}
+
+static inline half_vf_t
+half_sel(half_vi_t m, half_vf_t a, half_vf_t b)
+{
+    return (half_vf_t)half_seli(m, (half_vi_t)a, (half_vi_t)b);
+}
+
+static inline half_vf_t
+half_bits(int32_t b)
+{
+    half_vi_t v = {0};
+    return (half_vf_t)(v + b);
+}
+
+static inline half_vf_t
+half_set1(float f)
+{
+    half_vf_t v = {0};
+    return v + f;
+}
+
+/*
+ * exp(x) for x roughly within [-87, 88], no special case handling.
+ * x = n*ln2 + r, |r| <= ln2/2, exp(r) by its degree 5 Taylor polynomial.
+ * ln2 is split so that n * LN2_HI is exact for |n| < 2^11.
+ */
+static inline half_vf_t
+half_exp_core(half_vf_t x)
+{
+    const float LN2_HI = 0x1.62ep-1f, LN2_LO = 0x1.0bfbe8p-15f;
+    half_vf_t k = x * 0x1.715476p+0f + HALF_SHIFT;
+    half_vf_t n = k - HALF_SHIFT;
+    half_vi_t e = ((half_vi_t)k - HALF_SHIFT_BITS + 127) << 23;
+
+    half_vf_t r = x - n * LN2_HI;
+    r = r - n * LN2_LO;
+
+    half_vf_t p = 0x1.111112p-7f * r + 0x1.555556p-5f;
+    p = p * r + 0x1.555556p-3f;
+    p = p * r + 0.5f;
+    p = p * r + 1.0f;
+    p = p * r + 1.0f;
+
+    return p * (half_vf_t)e;
+}
+
+/*
+ * exp() over the FP16 domain: e^-18 is below half of the smallest
+ * subnormal and e^12 above the largest finite value, so clamping there
+ * gives 0 and Inf after rounding. NaN fails both compares and propagates.
+ */
+static inline half_vf_t
+half_exp(half_vf_t x)
+{
+    x = half_sel(x > 12.0f, half_set1(12.0f), x);
+    x = half_sel(x < -18.0f, half_set1(-18.0f), x);
+    return half_exp_core(x);
+}
+
+/*
+ * exp() over the binary32 domain, for BF16. The scale is applied in two
+ * halves so that 2^n stays representable for n = 128 and for results in
+ * the subnormal range.
+ */
+static inline half_vf_t
+half_exp_wide(half_vf_t x)
+{
+    const float LN2_HI = 0x1.62ep-1f, LN2_LO = 0x1.0bfbe8p-15f;
+
+    x = half_sel(x > 89.0f, half_set1(89.0f), x);
+    x = half_sel(x < -104.0f, half_set1(-104.0f), x);
+
+    half_vf_t k = x * 0x1.715476p+0f + HALF_SHIFT;
+    half_vf_t n = k - HALF_SHIFT;
+    half_vi_t ni = (half_vi_t)k - HALF_SHIFT_BITS;
+    half_vi_t n1 = ni >> 1;
+
+    half_vf_t r = x - n * LN2_HI;
+    r = r - n * LN2_LO;
+
+    half_vf_t p = 0x1.111112p-7f * r + 0x1.555556p-5f;
+    p = p * r + 0x1.555556p-3f;
+    p = p * r + 0.5f;
+    p = p * r + 1.0f;
+    p = p * r + 1.0f;
+
+    half_vf_t s1 = (half_vf_t)((n1 + 127) << 23);
+    half_vf_t s2 = (half_vf_t)((ni - n1 + 127) << 23);
+
+    return p * s1 * s2;
+}
+
+/*
+ * sigmoid(x) = 1/(1 + exp(-x)), evaluated as e/(1 + e) for x < 0 with
+ * e = exp(-|x|) so that neither side overflows.
+ */
+static inline half_vf_t
+half_sigmoid(half_vf_t x)
+{
+    half_vf_t a = (half_vf_t)((half_vi_t)x & HALF_ABS_MASK);
+    half_vf_t e = half_exp_wide(-a);
+    half_vf_t s = 1.0f / (1.0f + e);
+
+    return half_sel(x < 0.0f, e * s, s);
+}
+
+/*
+ * log(x) = e*ln2 + log(m), m in [sqrt(2)/2, sqrt(2)).
+ * log(m) = 2s + 2s^3/3 + 2s^5/5 + 2s^7/7 with s = (m-1)/(m+1).
+ * binary32 subnormals, reachable from BF16 only, are scaled by 2^23.
+ */
+static inline half_vf_t
+half_log(half_vf_t x)
+{
+    const int32_t SQRT_HALF = 0x3f3504f3;
+    half_vi_t sub = x < 0x1p-126f;
+    half_vf_t xn  = half_sel(sub, x * 0x1p23f, x);
+    half_vi_t ix  = (half_vi_t)xn - SQRT_HALF;
+    half_vi_t e   = (ix >> 23) - (sub & 23);
+    half_vf_t m  = (half_vf_t)((ix & 0x007fffff) + SQRT_HALF);
+
+    half_vf_t f  = m - 1.0f;
+    half_vf_t s  = f / (f + 2.0f);
+    half_vf_t s2 = s * s;
+
+    half_vf_t p = 0x1.24924ap-2f * s2 + 0x1.99999ap-2f;
+    p = p * s2 + 0x1.555556p-1f;
+    p = p * s2 * s + 2.0f * s;
+
+    half_vf_t res = HALF_CVT_I2F(e) * 0x1.62e43p-1f + p;
+
+    res = half_sel(x == 0.0f, half_bits((int32_t)0xff800000), res);
+    res = half_sel(x < 0.0f, half_bits(HALF_QNAN_BITS), res);
+    res = half_sel((half_vi_t)x == HALF_INF_BITS, x, res);
+    res = half_sel(x != x, x, res);
+
+    return res;
+}
+
+static inline half_vf_t
+half_sqrt(half_vf_t x)
+{
+    return HALF_SQRT(x);
+}
+
+/*
+ * tanh(x):
+ *   |x| < 0.55  odd Taylor polynomial up to x^11
+ *   otherwise   1 - 2/(exp(2|x|) + 1), |x| clamped to 9 where tanh
+ *               rounds to 1 in FP16
+ */
+static inline half_vf_t
+half_tanh(half_vf_t x)
+{
+    half_vi_t sign = (half_vi_t)x & HALF_SIGN_MASK;
+    half_vf_t a = (half_vf_t)((half_vi_t)x & HALF_ABS_MASK);
+    half_vf_t z = x * x;
+
+    half_vf_t p = -0x1.226e36p-7f * z + 0x1.664f48p-6f;
+    p = p * z - 0x1.ba1ba2p-5f;
+    p = p * z + 0x1.111112p-3f;
+    p = p * z - 0x1.555556p-2f;
+    p = p * z * x + x;
+
+    a = half_sel(a > 9.0f, half_set1(9.0f), a);
+    half_vf_t t = 1.0f - 2.0f / (half_exp_core(2.0f * a) + 1.0f);
+    t = (half_vf_t)((half_vi_t)t | sign);
+
+    return half_sel(z < 0x1.35c29p-2f, p, t);
+}
+
+/*
+ * erf(x):
+ *   |x| < 0.5  2/sqrt(pi) * odd Taylor polynomial up to x^9
+ *   otherwise  1 - poly(t) * exp(-x^2), t = 1/(1 + 0.3275911|x|),
+ *              Abramowitz & Stegun 7.1.26 (|error| < 1.5e-7),
+ *              |x| clamped to 4 where erf rounds to 1 in FP16
+ */
+static inline half_vf_t
+half_erf(half_vf_t x)
+{
+    half_vi_t sign = (half_vi_t)x & HALF_SIGN_MASK;
+    half_vf_t a = (half_vf_t)((half_vi_t)x & HALF_ABS_MASK);
+    half_vf_t z = x * x;
+
+    half_vf_t p = 0x1.565bcep-8f * z - 0x1.b82ce4p-6f;
+    p = p * z + 0x1.ce2f22p-4f;
+    p = p * z - 0x1.812746p-2f;
+    p = p * z + 0x1.20dd76p+0f;
+    p = p * x;
+
+    a = half_sel(a > 4.0f, half_set1(4.0f), a);
+    half_vf_t t = 1.0f / (0x1.4f740ap-2f * a + 1.0f);
+    half_vf_t q = 0x1.0fb844p+0f * t - 0x1.7401c6p+0f;
+    q = q * t + 0x1.6be1c6p+0f;
+    q = q * t - 0x1.23531cp-2f;
+    q = q * t + 0x1.04f20cp-2f;
+    q = q * t;
+    half_vf_t r = 1.0f - q * half_exp_core(-a * a);
+    r = (half_vf_t)((half_vi_t)r | sign);
+    r = half_sel(x != x, x, r);
+
+    return half_sel(z < 0.25f, p, r);
+}
+
+/*
+ * GELU(x) = x * Phi(x) = x * erfc(-x/sqrt(2)) / 2.
+ * erfc(a), a >= 0, is t * exp(-a^2 + P(t)), t = 1/(1 + a/2), with the
+ * degree 9 Chebyshev fit from Numerical Recipes (relative error below
+ * 1.2e-7). It keeps the negative tail accurate, where 1 + erf(x/sqrt(2))
+ * cancels. x is clamped to -14 from below, where the result underflows.
+ */
+static inline half_vf_t
+half_gelu(half_vf_t x)
+{
+    x = half_sel(x < -14.0f, half_set1(-14.0f), x);
+
+    half_vf_t a = (half_vf_t)((half_vi_t)x & HALF_ABS_MASK) * 0x1.6a09e6p-1f;
+
+    half_vf_t t = 1.0f / (0.5f * a + 1.0f);
+    half_vf_t p = 0x1.5df28ap-3f * t - 0x1.a4f124p-1f;
+    p = p * t + 0x1.7d0f6p+0f;
+    p = p * t - 0x1.229cbap+0f;
+    p = p * t + 0x1.1d8f98p-2f;
+    p = p * t - 0x1.7d8498p-3f;
+    p = p * t + 0x1.8c6d92p-4f;
+    p = p * t + 0x1.7f11f6p-2f;
+    p = p * t + 0x1.00018ep+0f;
+    p = p * t - 0x1.43f89cp+0f;
+
+    half_vf_t c = 0.5f * t * half_exp_wide(p - a * a);
+
+    return x * half_sel(x < 0.0f, c, 1.0f - c);
+}
+
+/*
+ * sin(x) and cos(x), |x| <= 65504.
+ * x = n*pi/2 + r, |r| <= pi/4. pi/2 is split into three 8-bit pieces and
+ * a binary32 tail, so n*PIO2_1..3 are exact for the 16-bit n reachable
+ * from FP16 inputs. sin(r) degree 7, cos(r) degree 8; the quadrant
+ * (n + q) & 3 picks between them and the sign. Inf gives NaN.
+ */
+static inline half_vf_t
+half_sincos(half_vf_t x, int32_t q)
+{
+    const float PIO2_1 = 0x1.92p+0f, PIO2_2 = 0x1.fap-12f;
+    const float PIO2_3 = 0x1.54p-20f, PIO2_4 = 0x1.10b462p-30f;
+
+    half_vf_t k = x * 0x1.45f306p-1f + HALF_SHIFT;
+    half_vf_t n = k - HALF_SHIFT;
+    half_vi_t quad = (half_vi_t)k - HALF_SHIFT_BITS + q;
+
+    half_vf_t r = x - n * PIO2_1;
+    r = r - n * PIO2_2;
+    r = r - n * PIO2_3;
+    r = r - n * PIO2_4;
+
+    half_vf_t r2 = r * r;
+
+    half_vf_t s = -0x1.a01a02p-13f * r2 + 0x1.111112p-7f;
+    s = s * r2 - 0x1.555556p-3f;
+    s = s * r2 * r + r;
+
+    half_vf_t c = 0x1.a01a02p-16f * r2 - 0x1.6c16c2p-10f;
+    c = c * r2 + 0x1.555556p-5f;
+    c = c * r2 - 0.5f;
+    c = c * r2 + 1.0f;
+
+    half_vf_t res = half_sel((quad & 1) != 0, c, s);
+    return (half_vf_t)((half_vi_t)res ^ ((quad & 2) << 30));
+}
+
+static inline half_vf_t
+half_sin(half_vf_t x)
+{
+    return half_sincos(x, 0);
+}
+
+static inline half_vf_t
+half_cos(half_vf_t x)
+{
+    return half_sincos(x, 1);
+}
+
+/*
+ * BF16 is the upper half of binary32: widening is a shift, narrowing
+ * rounds to nearest even. Like VCVTNEPS2BF16, the emulation flushes
+ * subnormal results to signed zero and quiets NaNs.
+ */
+static inline half_vf_t
+half_bf16_to_f32(half_vh_t h)
+{
+    return (half_vf_t)((half_vi_t)HALF_WIDEN_U16(h) << 16);
+}
+
+static inline half_vh_t
+half_f32_to_bf16(half_vf_t x)
+{
+#if ALM_HALF_VLEN == 16 && defined(__AVX512BF16__)
+    return (half_vh_t)_mm512_cvtneps_pbh(x);
+#else
+    half_vi_t u = (half_vi_t)x;
+    half_vi_t a = u & HALF_ABS_MASK;
+    half_vi_t r = (u + 0x7fff + ((u >> 16) & 1)) >> 16;
+
+    r = half_seli(a < 0x00800000, (u >> 16) & 0x8000, r);
+    r = half_seli(a > HALF_INF_BITS, (u >> 16) | 0x0040, r);
+    r = r & 0xffff;
+#if ALM_HALF_VLEN == 8
+    __m256i pk = _mm256_packus_epi32((__m256i)r, (__m256i)r);
+    return _mm256_castsi256_si128(_mm256_permute4x64_epi64(pk, 0x08));
+#else
+    return HALF_NARROW_U32(r);
+#endif
+#endif
+}
+
+/*
+ * Conversion wrappers
+ */
+typedef half_vh_t (*half_conv_t)(half_kern_t kern, half_vh_t x);
+
+static inline half_vh_t
+half_apply(half_kern_t kern, half_vh_t x)
+{
+    return HALF_CVT_F16(kern(HALF_CVT_F32(x)));
+}
+
+static inline half_vh_t
+half_apply_bf16(half_kern_t kern, half_vh_t x)
+{
+    return half_f32_to_bf16(kern(half_bf16_to_f32(x)));
+}
+
+static inline void
+half_apply_array_with(half_conv_t conv, half_kern_t kern, int len,
+                      const uint16_t *src, uint16_t *dst)
+{
+    int i = 0;
+
+    for (; i + ALM_HALF_VLEN <= len; i += ALM_HALF_VLEN)
+        HALF_STORE(dst + i, conv(kern, HALF_LOAD(src + i)));
+
+    if (i < len) {
+        uint16_t buf[ALM_HALF_VLEN] = {0};
+        int j, rem = len - i;
+
+        for (j = 0; j < rem; j++)
+            buf[j] = src[i + j];
+
+        HALF_STORE(buf, conv(kern, HALF_LOAD(buf)));
+
+        for (j = 0; j < rem; j++)
+            dst[i + j] = buf[j];
+    }
+}
+
+static inline void
+half_apply_array(half_kern_t kern, int len, const uint16_t *src, uint16_t *dst)
+{
+    half_apply_array_with(half_apply, kern, len, src, dst);
+}
+
+static inline void
+half_apply_array_bf16(half_kern_t kern, int len, const uint16_t *src,
+                      uint16_t *dst)
+{
+    half_apply_array_with(half_apply_bf16, kern, len, src, dst);
+}
+
+#endif  /* __LIBM_ALM_HALF_H__ */
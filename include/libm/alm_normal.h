@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Width-generic binary32 kernels for the statistical functions erfinvf,
+ * erfcinvf, cdfnormf and cdfnorminvf.
+ *
+ * The float inputs are widened and the functions evaluated in binary64
+ * with the exp() and log() of alm_activation.h, so that 1 - x*x, y*(2 - y)
+ * and x*x/2 are exact and the polynomials need no argument splitting.
+ * Each result is rounded to float once at the end. Special inputs are
+ * handled with selects, without a scalar fallback.
+ *
+ * erfinv(x) is computed from x and t = 1 - x*x, w = -log(t):
+ *     w < 6.25:  x * P1(w - 3.125)                degree 13
+ *     otherwise: x * s * P2(1/s - c), s = sqrt(w) degree 9, c and the
+ *                coefficients picked per lane for s < 4 or s >= 4
+ * t carries the precision near |x| = 1, so erfcinv(y) and cdfnorminv(p)
+ * call the same kernel with t = y*(2 - y) and t = 4*p*(1 - p).
+ *
+ * cdfnorm(x) = 0.5 * erfc(-x/sqrt(2)) with erfc(a) = exp(-a*a) * h(a),
+ * a = |x|/sqrt(2):
+ *     a < 1.5:   h = P3(a - 0.75)                 degree 12
+ *     otherwise: h = P4(1/a - 0.38) / a           degree 12
+ * and Phi(x) = 0.5*erfc(a) for x < 0, 1 - 0.5*erfc(a) otherwise.
+ *
+ * All four polynomials are Chebyshev fits with relative error below
+ * 4e-10.
+ *
+ * The includer defines ALM_ACT_DOUBLE and ALM_ACT_VLEN to 4 or 8; float
+ * vectors of ALM_ACT_VLEN and 2 * ALM_ACT_VLEN lanes are converted in
+ * halves.
+ */
+
+#ifndef __LIBM_ALM_NORMAL_H__
+#define __LIBM_ALM_NORMAL_H__
+
+#if !defined(ALM_ACT_DOUBLE)
+#error "alm_normal.h evaluates in binary64, define ALM_ACT_DOUBLE"
+#endif
+
+#include <libm/alm_activation.h>
+
+#if ALM_ACT_VLEN == 4
+typedef v_f32x4_t   nrm_hf_t;
+typedef v_f32x8_t   nrm_vf_t;
+#define NRM_WIDEN(h)            _mm256_cvtps_pd(h)
+#define NRM_NARROW(d)           _mm256_cvtpd_ps(d)
+#define NRM_LO(v)               _mm256_castps256_ps128(v)
+#define NRM_HI(v)               _mm256_extractf128_ps(v, 1)
+#define NRM_JOIN(l, h)          _mm256_insertf128_ps(_mm256_castps128_ps256(l), h, 1)
+#define NRM_LOADU(p)            _mm256_loadu_ps(p)
+#define NRM_STOREU(p, v)        _mm256_storeu_ps(p, v)
+#define NRM_LOAD_TAIL(p, n)     _mm256_maskload_ps(p, GET_MASK_FLOAT_256_BIT(n))
+#define NRM_STORE_TAIL(p, n, v) _mm256_maskstore_ps(p, GET_MASK_FLOAT_256_BIT(n), v)
+#define NRM_SQRT(x)             _mm256_sqrt_pd(x)
+#else
+typedef v_f32x8_t   nrm_hf_t;
+typedef v_f32x16_t  nrm_vf_t;
+#define NRM_WIDEN(h)            _mm512_cvtps_pd(h)
+#define NRM_NARROW(d)           _mm512_cvtpd_ps(d)
+#define NRM_LO(v)               _mm512_castps512_ps256(v)
+#define NRM_HI(v)               _mm512_extractf32x8_ps(v, 1)
+#define NRM_JOIN(l, h)          _mm512_insertf32x8(_mm512_castps256_ps512(l), h, 1)
+#define NRM_LOADU(p)            _mm512_loadu_ps(p)
+#define NRM_STOREU(p, v)        _mm512_storeu_ps(p, v)
+#define NRM_LOAD_TAIL(p, n)     _mm512_maskz_loadu_ps((__mmask16)((1u << (n)) - 1), p)
+#define NRM_STORE_TAIL(p, n, v) _mm512_mask_storeu_ps(p, (__mmask16)((1u << (n)) - 1), v)
+#define NRM_SQRT(x)             _mm512_sqrt_pd(x)
+#endif
+
+#define NRM_VLENF       (2 * ALM_ACT_VLEN)
+
+static inline act_vf_t
+nrm_inf_nan(act_vi_t zero, act_vf_t x)
+{
+    act_vf_t inf = act_set1(__builtin_inf());
+    inf = (act_vf_t)((act_vi_t)inf | ((act_vi_t)x & ~ACT_ABS_MASK));
+
+    return act_sel(zero, inf, act_set1(__builtin_nan("")));
+}
+
+/*
+ * erfinv(x) given t = 1 - x*x. t == 0 gives +-Inf, t < 0 or NaN gives NaN.
+ */
+static inline act_vf_t
+nrm_erfinv_t(act_vf_t x, act_vf_t t)
+{
+    act_vi_t ok = t > 0.0;
+    act_vf_t w = -act_log(act_sel(ok, t, act_set1(1.0)));
+    act_vf_t d = w - 3.125;
+
+    act_vf_t r = act_set1(0x1.8000901c337dbp-40);
+    r = r * d - 0x1.b42bae9349c6fp-37;
+    r = r * d - 0x1.4c86369a961c9p-35;
+    r = r * d + 0x1.1b7ccfda5bc2dp-30;
+    r = r * d - 0x1.21ed784ad67eep-28;
+    r = r * d - 0x1.f090161788d7bp-26;
+    r = r * d + 0x1.c71783a4fa511p-22;
+    r = r * d - 0x1.6eb58eebaf457p-20;
+    r = r * d - 0x1.d1d6f068cc4a1p-17;
+    r = r * d + 0x1.879cbe105bcbcp-13;
+    r = r * d - 0x1.84575d325031bp-11;
+    r = r * d - 0x1.8b6c35f4e6dc1p-8;
+    r = r * d + 0x1.ebd80d99dfd3p-3;
+    r = r * d + 0x1.a755e7c9e4f12p+0;
+
+    act_vi_t tail = w >= 6.25;
+
+    if (ACT_ANY(tail)) {
+        act_vf_t s = NRM_SQRT(w);
+        act_vi_t lo = s < 4.0;
+        act_vf_t u = 1.0 / s - act_pick(lo, 0.325, 0.175);
+
+        act_vf_t q = act_pick(lo, 0x1.765b68b1c1af7p+11, 0x1.01a072fb00558p+10);
+        q = q * u + act_pick(lo, 0x1.4256051b8b5d9p+10, -0x1.210757022b2cbp+6);
+        q = q * u + act_pick(lo, -0x1.82ded08d5f7d1p+7, 0x1.b05987f62295dp+4);
+        q = q * u + act_pick(lo, -0x1.309b283974d3cp+6, -0x1.137a82fed21d9p+3);
+        q = q * u + act_pick(lo, 0x1.64183cfb23b8p+2, 0x1.7240c8fe38664p+1);
+        q = q * u + act_pick(lo, 0x1.b75f4d7db1b5cp+1, -0x1.82f2fa72b2ca5p+0);
+        q = q * u + act_pick(lo, 0x1.f31fbc1a40935p-1, 0x1.c9c4f54100526p-1);
+        q = q * u + act_pick(lo, 0x1.d568245597214p-3, -0x1.44224cf110305p-4);
+        q = q * u + act_pick(lo, -0x1.689cba343314fp-3, -0x1.9803f933a79d6p-3);
+        q = q * u + act_pick(lo, 0x1.e43ccf207212ap-1, 0x1.f332efce6fedp-1);
+
+        r = act_sel(tail, s * q, r);
+    }
+
+    return act_sel(ok, x * r, nrm_inf_nan(t == 0.0, x));
+}
+
+static inline act_vf_t
+nrm_erfinv(act_vf_t x)
+{
+    return nrm_erfinv_t(x, (1.0 - x) * (1.0 + x));
+}
+
+static inline act_vf_t
+nrm_erfcinv(act_vf_t y)
+{
+    return nrm_erfinv_t(1.0 - y, y * (2.0 - y));
+}
+
+/* sqrt(2) * erfinv(2p - 1) */
+static inline act_vf_t
+nrm_cdfnorminv(act_vf_t p)
+{
+    const double SQRT2 = 0x1.6a09e667f3bcdp+0;
+
+    return SQRT2 * nrm_erfinv_t(2.0 * p - 1.0, 4.0 * p * (1.0 - p));
+}
+
+static inline act_vf_t
+nrm_cdfnorm(act_vf_t x)
+{
+    const double INV_SQRT2 = 0x1.6a09e667f3bcdp-1;
+    act_vf_t a = act_abs(x) * INV_SQRT2;
+    act_vf_t e = act_exp(-0.5 * (x * x));
+    act_vi_t near = a < 1.5;
+    act_vf_t h;
+
+    if (!ACT_ANY(~near)) {
+        act_vf_t d = a - 0.75;
+
+        h = act_set1(0x1.b13d54460b51ep-15);
+        h = h * d - 0x1.3f61caaf05c2cp-13;
+        h = h * d + 0x1.64843917f0e44p-12;
+        h = h * d - 0x1.e0fc62a51ea6cp-11;
+        h = h * d + 0x1.3fcf3cceb9b3dp-9;
+        h = h * d - 0x1.8d1170fd033fp-8;
+        h = h * d + 0x1.d4374563a8ce8p-7;
+        h = h * d - 0x1.054ae3e8ca877p-5;
+        h = h * d + 0x1.1192fd0223149p-4;
+        h = h * d - 0x1.09e788a283ba1p-3;
+        h = h * d + 0x1.d900939b56ca1p-3;
+        h = h * d - 0x1.78cdd5349b25fp-2;
+        h = h * d + 0x1.038d54ea3d834p-1;
+    } else {
+        act_vf_t u = 1.0 / a;
+        act_vf_t d = act_sel(near, a - 0.75, u - 0.38);
+
+        h = act_pick(near, 0x1.b13d54460b51ep-15, 0x1.3deb6ae8b36a5p-1);
+        h = h * d + act_pick(near, -0x1.3f61caaf05c2cp-13, 0x1.01a2baafda615p-1);
+        h = h * d + act_pick(near, 0x1.64843917f0e44p-12, -0x1.72ec75c3bb4a4p-1);
+        h = h * d + act_pick(near, -0x1.e0fc62a51ea6cp-11, 0x1.6a905446ee2f6p-3);
+        h = h * d + act_pick(near, 0x1.3fcf3cceb9b3dp-9, 0x1.482efcdb8218fp-3);
+        h = h * d + act_pick(near, -0x1.8d1170fd033fp-8, -0x1.022a071feebd7p-2);
+        h = h * d + act_pick(near, 0x1.d4374563a8ce8p-7, 0x1.7e64d582eab54p-3);
+        h = h * d + act_pick(near, -0x1.054ae3e8ca877p-5, -0x1.061aea4cba84bp-5);
+        h = h * d + act_pick(near, 0x1.1192fd0223149p-4, -0x1.dfd0a66c6966dp-4);
+        h = h * d + act_pick(near, -0x1.09e788a283ba1p-3, 0x1.66431b93bd63ap-3);
+        h = h * d + act_pick(near, 0x1.d900939b56ca1p-3, -0x1.6e2d29166d71ep-4);
+        h = h * d + act_pick(near, -0x1.78cdd5349b25fp-2, -0x1.384e165f293cp-3);
+        h = h * d + act_pick(near, 0x1.038d54ea3d834p-1, 0x1.0f6949323ad63p-1);
+        h = act_sel(near, h, h * u);
+    }
+
+    act_vf_t q = 0.5 * e * h;
+
+    return act_sel(x < 0.0, q, 1.0 - q);
+}
+
+typedef act_vf_t (*nrm_kern_t)(act_vf_t x);
+
+static inline nrm_hf_t
+nrm_apply_half(nrm_kern_t kern, nrm_hf_t x)
+{
+    return NRM_NARROW(kern(NRM_WIDEN(x)));
+}
+
+static inline float
+nrm_apply_scalar(nrm_kern_t kern, float x)
+{
+    nrm_hf_t h = {x};
+
+    return nrm_apply_half(kern, h)[0];
+}
+
+static inline nrm_vf_t
+nrm_apply(nrm_kern_t kern, nrm_vf_t x)
+{
+    return NRM_JOIN(nrm_apply_half(kern, NRM_LO(x)),
+                    nrm_apply_half(kern, NRM_HI(x)));
+}
+
+/*
+ * Array driver: full vectors of NRM_VLENF floats, then one masked vector
+ * for the tail.
+ */
+static inline void
+nrm_apply_array(nrm_kern_t kern, int len, const float *src, float *dst)
+{
+    int j = 0;
+
+    for (; j <= len - NRM_VLENF; j += NRM_VLENF)
+        NRM_STOREU(&dst[j], nrm_apply(kern, NRM_LOADU(&src[j])));
+
+    if (j < len) {
+        int rem = len - j;
+        NRM_STORE_TAIL(&dst[j], rem, nrm_apply(kern, NRM_LOAD_TAIL(&src[j], rem)));
+    }
+}
+
+#endif  /* __LIBM_ALM_NORMAL_H__ */
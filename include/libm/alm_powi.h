@@ -0,0 +1,317 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Width-generic kernels for x^y with y an integer or half an integer, used
+ * by vrda_powi/vrsa_powif and by vrda_powx/vrsa_powxf when the exponent
+ * allows it.
+ *
+ * With |y| = k or k + 1/2, x^k is formed by left to right binary
+ * exponentiation, one squaring per bit of k and one multiplication by x
+ * per set bit, and the half multiplies in sqrt(x). A negative y takes the
+ * reciprocal at the end.
+ *
+ * In double precision x is first split into m 2^e with |m| in
+ * [sqrt(1/2), sqrt(2)), so m^k stays within [2^-512, 2^512] for any k up
+ * to POWI_MAX and the exponent e*k is applied at the very end. The chain
+ * is carried as a double-double, the products split exactly with FMA, and
+ * the result is rounded once, denormal and overflowing results included:
+ * within 0.501 ULP of powl() for any k up to POWI_MAX, measured on 8M
+ * operands. Only zero, infinite and NaN operands, and negative x under a
+ * half exponent, are left to the scalar pow().
+ *
+ * Single precision is evaluated in plain binary64: for k up to POWI_MAX
+ * the chain error stays below 2^-40 and the binary64 range covers every
+ * intermediate that matters, so overflow, underflow and the special
+ * operands come out right on the final narrowing without a fallback.
+ *
+ * The includer defines ALM_ACT_DOUBLE and ALM_ACT_VLEN to 4 or 8.
+ */
+
+#ifndef __LIBM_ALM_POWI_H__
+#define __LIBM_ALM_POWI_H__
+
+#include <math.h>
+
+#include <libm/alm_normal.h>
+
+/* Largest |y| taken by the chains, past it pow's log/exp is cheaper */
+#define POWI_MAX        1024
+
+#define POWI_EXP_MASK   INT64_C(0x7ff0000000000000)
+#define POWI_ONE_BITS   INT64_C(0x3ff0000000000000)
+
+/* (h, l) *= (h, l) */
+static inline void
+powi_sqr(act_vf_t *h, act_vf_t *l)
+{
+    act_vf_t p = *h * *h;
+    act_vf_t e = ACT_FMA(*h, *h, -p) + 2.0 * *h * *l;
+
+    *h = p + e;
+    *l = e - (*h - p);
+}
+
+/* (h, l) *= (a, b) */
+static inline void
+powi_mul(act_vf_t *h, act_vf_t *l, act_vf_t a, act_vf_t b)
+{
+    act_vf_t p = *h * a;
+    act_vf_t e = ACT_FMA(*h, a, -p) + (*h * b + *l * a);
+
+    *h = p + e;
+    *l = e - (*h - p);
+}
+
+/* 2^n for integral n in [-1022, 1023] */
+static inline act_vf_t
+powi_pow2(act_vf_t n)
+{
+    act_vi_t b = (act_vi_t)(n + ACT_SHIFT) - ACT_SHIFT_BITS + ACT_EXP_BIAS;
+
+    return (act_vf_t)(b << ACT_MANT_BITS);
+}
+
+/* Unbiased exponent of a normal x, as a double */
+static inline act_vf_t
+powi_ilogb(act_vf_t x)
+{
+    act_vi_t e = (((act_vi_t)x >> ACT_MANT_BITS) & 0x7ff) - ACT_EXP_BIAS;
+
+    return (act_vf_t)(e + ACT_SHIFT_BITS) - ACT_SHIFT;
+}
+
+/* x = m 2^e with |m| in [sqrt(1/2), sqrt(2)), for finite nonzero x */
+static inline act_vf_t
+powi_frexp(act_vf_t x, act_vf_t *e)
+{
+    act_vi_t sub = act_abs(x) < 0x1p-1022, big;
+    act_vf_t m;
+
+    x = act_sel(sub, x * 0x1p54, x);
+    m = (act_vf_t)(((act_vi_t)x & ~POWI_EXP_MASK) | POWI_ONE_BITS);
+    big = act_abs(m) > 0x1.6a09e667f3bcdp+0;
+
+    *e = powi_ilogb(x) - act_pick(sub, 54.0, 0.0) + act_pick(big, 1.0, 0.0);
+    return act_sel(big, m * 0.5, m);
+}
+
+/*
+ * (h + l) 2^E rounded once, h normal and |l| within half an ulp of h.
+ * Below 2^-1022 the denormal grid is coarser than the ulp of h, so h
+ * alone rounds the same way as h + l except on a midpoint of that grid,
+ * where l decides. The last multiplication does the rounding, and raises
+ * overflow or underflow as a single one would.
+ */
+static inline act_vf_t
+powi_ldexp(act_vf_t h, act_vf_t l, act_vf_t E)
+{
+    act_vf_t eh = powi_ilogb(h), F = E + eh, a = h * powi_pow2(-eh);
+    act_vf_t g, aa, t, d, f2;
+    act_vi_t sub = F < -1022.0, tie;
+
+    F = act_sel(F < -1086.0, act_set1(-1086.0), F);
+    F = act_sel(F > 1024.0, act_set1(1024.0), F);
+
+    if (unlikely(ACT_ANY(sub))) {
+        g = powi_pow2(act_sel(sub, -1074.0 - F, act_set1(0.0)));
+        aa = act_abs(a);
+        t = (aa + 0x1.8p52 * g) - 0x1.8p52 * g;
+        d = aa - t;
+        tie = sub & (act_abs(d) == 0.5 * g) & (l != 0.0) &
+              (((act_vi_t)d ^ (act_vi_t)l ^ (act_vi_t)a) >= 0);
+        a = act_sel(tie, (t + d + d) * (a / aa), a);
+    }
+
+    f2 = act_sel(sub, act_set1(-64.0), act_pick(F > 1023.0, 1.0, 0.0));
+    return a * powi_pow2(F - f2) * powi_pow2(f2);
+}
+
+/*
+ * x^(k + half/2), or its reciprocal when neg is set. Returns the bit mask
+ * of the lanes left for the scalar pow().
+ */
+static inline int
+powi_kern(act_vf_t x, unsigned k, int half, int neg, act_vf_t *r)
+{
+    act_vf_t h = act_set1(1.0), l = act_set1(0.0), m, e, E, s, t, q;
+    act_vi_t bad;
+    unsigned b;
+
+    bad = ~((act_abs(x) <= ACT_MAX) & (x != 0.0));
+    if (half)
+        bad |= x < 0.0;
+
+    m = powi_frexp(act_sel(bad, act_set1(1.0), x), &e);
+
+    if (k) {
+        h = m;
+        for (b = (1u << (31 - __builtin_clz(k))) >> 1; b; b >>= 1) {
+            powi_sqr(&h, &l);
+            if (k & b)
+                powi_mul(&h, &l, m, act_set1(0.0));
+        }
+    }
+    E = e * (double)k;
+
+    if (half) {
+        /* sqrt(m 2^e) with the exponent made even, m stays normal */
+        t = act_pick(((act_vi_t)(e + ACT_SHIFT) & 1) != 0, 1.0, 0.0);
+        m = act_sel(t != 0.0, m + m, m);
+        E = E + (e - t) * 0.5;
+        s = NRM_SQRT(m);
+        t = ACT_FMA(-s, s, m) / (s + s);
+        powi_mul(&h, &l, s, t);
+    }
+
+    if (neg) {
+        q = 1.0 / h;
+        t = q * (ACT_FMA(-h, q, act_set1(1.0)) - l * q);
+        h = q + t;
+        l = t - (h - q);
+        E = -E;
+    }
+
+    *r = powi_ldexp(h, l, E);
+
+    return (int)ACT_ANY(bad);
+}
+
+/* Plain binary64 chain for the widened single precision operands */
+static inline act_vf_t
+powi_kernf(act_vf_t x, unsigned k, int half, int neg)
+{
+    act_vf_t p = act_set1(1.0), inf = act_set1(__builtin_inf());
+    unsigned b;
+
+    if (half) {
+        /* pow(-0, y) and pow(-inf, y) for y not an integer are those of +0, +inf */
+        x = act_sel(x == -inf, inf, x + 0.0);
+    }
+
+    if (k) {
+        p = x;
+        for (b = (1u << (31 - __builtin_clz(k))) >> 1; b; b >>= 1) {
+            p *= p;
+            if (k & b)
+                p *= x;
+        }
+    }
+
+    if (half)
+        p *= NRM_SQRT(x);
+
+    if (neg)
+        p = 1.0 / p;
+
+    return p;
+}
+
+static inline act_vf_t
+powi_fixup(int bad, act_vf_t x, double y, act_vf_t r)
+{
+    double px[ALM_ACT_VLEN], pr[ALM_ACT_VLEN];
+    int i;
+
+    ACT_STOREU(px, x);
+    ACT_STOREU(pr, r);
+
+    for (i = 0; i < ALM_ACT_VLEN; i++)
+        if (bad & (1 << i))
+            pr[i] = ALM_PROTO(pow)(px[i], y);
+
+    return ACT_LOADU(pr);
+}
+
+/*
+ * y[i] = x[i]^(k + half/2), or its reciprocal when neg is set; e is the
+ * exponent as a double for the fallback.
+ */
+static inline void
+powi_array(int len, const double *x, unsigned k, int half, int neg, double e,
+           double *y)
+{
+    act_vf_t v, r;
+    int j = 0, bad;
+
+    for (; j <= len - ALM_ACT_VLEN; j += ALM_ACT_VLEN) {
+        v = ACT_LOADU(&x[j]);
+        bad = powi_kern(v, k, half, neg, &r);
+        if (unlikely(bad))
+            r = powi_fixup(bad, v, e, r);
+        ACT_STOREU(&y[j], r);
+    }
+
+    if (j < len) {
+        v = ACT_LOAD_TAIL(&x[j], len - j);
+        bad = powi_kern(v, k, half, neg, &r);
+        bad &= (1 << (len - j)) - 1;
+        if (bad)
+            r = powi_fixup(bad, v, e, r);
+        ACT_STORE_TAIL(&y[j], len - j, r);
+    }
+}
+
+static inline nrm_vf_t
+powi_vecf(nrm_vf_t x, unsigned k, int half, int neg)
+{
+    return NRM_JOIN(NRM_NARROW(powi_kernf(NRM_WIDEN(NRM_LO(x)), k, half, neg)),
+                    NRM_NARROW(powi_kernf(NRM_WIDEN(NRM_HI(x)), k, half, neg)));
+}
+
+static inline void
+powi_arrayf(int len, const float *x, unsigned k, int half, int neg, float *y)
+{
+    int j = 0;
+
+    for (; j <= len - NRM_VLENF; j += NRM_VLENF)
+        NRM_STOREU(&y[j], powi_vecf(NRM_LOADU(&x[j]), k, half, neg));
+
+    if (j < len)
+        NRM_STORE_TAIL(&y[j], len - j,
+                       powi_vecf(NRM_LOAD_TAIL(&x[j], len - j), k, half, neg));
+}
+
+/*
+ * Splits y into |y| = k + half/2 and its sign. Returns 0 when y is not an
+ * integer or half-integer of magnitude up to POWI_MAX.
+ */
+static inline int
+powi_split(double y, unsigned *k, int *half, int *neg)
+{
+    double a = fabs(2.0 * y);
+
+    if (!(a <= 2.0 * POWI_MAX) || a != (double)(unsigned)a)
+        return 0;
+
+    *k = (unsigned)a >> 1;
+    *half = (int)((unsigned)a & 1);
+    *neg = y < 0.0;
+    return 1;
+}
+
+#endif /* __LIBM_ALM_POWI_H__ */
@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Width-generic normal random variate kernels for vrda_randn and
+ * vrsa_randnf.
+ *
+ * Uniforms come from the Philox4x32-10 counter based generator: block b
+ * of a stream is the 10 round bijection of the counter {lo(b), hi(b), 0, 0}
+ * under the key {lo(seed), hi(seed)}, four 32-bit words. Blocks are
+ * independent, so any element of a stream can be computed without the
+ * preceding ones and the stream offset is just a counter value.
+ *
+ *     binary64: block b gives elements 2b and 2b+1, from the words
+ *               (w0, w1) and (w2, w3), u = (m + 0.5) * 2^-52 for the top
+ *               52 bits m of each pair
+ *     binary32: block b gives elements 4b .. 4b+3, one per word,
+ *               u = (m + 0.5) * 2^-24 for the top 24 bits m
+ *
+ * u never reaches 0 or 1. The uniforms go through one of
+ *
+ *     ALM_RANDN_ICDF:        z = cdfnorminv(u), element by element
+ *     ALM_RANDN_BOX_MULLER:  r = sqrt(-2*log(u0)), t = 2*pi*u1,
+ *                            z0 = r*cos(t), z1 = r*sin(t)
+ *                            for the element pairs (2i, 2i+1)
+ *
+ * The binary64 variates use the vrd4/vrd8 log, sincos and cdfnorminv
+ * kernels. The binary32 ones are evaluated in binary64 with the log of
+ * alm_activation.h and the cdfnorminv of alm_normal.h, then rounded.
+ *
+ * The multiplications of the rounds take the 32-bit words from the low
+ * halves of 64-bit lanes, so ALM_ACT_VLEN blocks are generated at a time.
+ * The includer defines ALM_ACT_DOUBLE and ALM_ACT_VLEN to 4 or 8.
+ */
+
+#ifndef __LIBM_ALM_RANDN_H__
+#define __LIBM_ALM_RANDN_H__
+
+#include <string.h>
+
+#include <libm/alm_normal.h>
+
+#if ALM_ACT_VLEN == 4
+typedef v_u64x4_t   rnd_vu_t;
+#define RND_MUL32(a, b)         ((rnd_vu_t)_mm256_mul_epu32((__m256i)(a), (__m256i)(b)))
+#define RND_LOG(x)              ALM_PROTO(vrd4_log)(x)
+#define RND_SINCOS(x, s, c)     ALM_PROTO(vrd4_sincos)(x, s, c)
+#define RND_CDFNORMINV(x)       ALM_PROTO(vrd4_cdfnorminv)(x)
+#else
+typedef v_u64x8_t   rnd_vu_t;
+#define RND_MUL32(a, b)         ((rnd_vu_t)_mm512_mul_epu32((__m512i)(a), (__m512i)(b)))
+#define RND_LOG(x)              ALM_PROTO(vrd8_log)(x)
+#define RND_SINCOS(x, s, c)     ALM_PROTO(vrd8_sincos)(x, s, c)
+#define RND_CDFNORMINV(x)       ALM_PROTO(vrd8_cdfnorminv)(x)
+#endif
+
+/* Method numbers, as in alm_randn_method_t */
+#define RND_ICDF        0
+#define RND_BOX_MULLER  1
+
+#define RND_ROUNDS      10
+#define RND_M0          UINT64_C(0xD2511F53)
+#define RND_M1          UINT64_C(0xCD9E8D57)
+#define RND_W0          0x9E3779B9u
+#define RND_W1          0xBB67AE85u
+#define RND_LO32        UINT64_C(0xffffffff)
+
+#define RND_ONE_BITS    UINT64_C(0x3ff0000000000000)
+#define RND_TWO52_BITS  UINT64_C(0x4330000000000000)
+#define RND_2PI         0x1.921fb54442d18p+2
+
+/* elements of one group, ALM_ACT_VLEN blocks */
+#define RND_GROUP       (2 * ALM_ACT_VLEN)
+#define RND_GROUPF      (4 * ALM_ACT_VLEN)
+
+static inline rnd_vu_t
+rnd_set1(uint64_t c)
+{
+    rnd_vu_t v = {0};
+    return v + c;
+}
+
+/*
+ * Philox4x32-10 of the ALM_ACT_VLEN consecutive blocks starting at blk,
+ * the words of block blk + i in lane i of w[0..3].
+ */
+static inline void
+rnd_philox(uint64_t seed, uint64_t blk, rnd_vu_t w[4])
+{
+    rnd_vu_t b = rnd_set1(blk), m0 = rnd_set1(RND_M0), m1 = rnd_set1(RND_M1);
+    uint32_t k0 = (uint32_t)seed, k1 = (uint32_t)(seed >> 32);
+    int i;
+
+    for (i = 0; i < ALM_ACT_VLEN; i++)
+        b[i] += (uint64_t)i;
+
+    w[0] = b & RND_LO32;
+    w[1] = b >> 32;
+    w[2] = rnd_set1(0);
+    w[3] = rnd_set1(0);
+
+    for (i = 0; i < RND_ROUNDS; i++) {
+        rnd_vu_t p0 = RND_MUL32(w[0], m0);
+        rnd_vu_t p1 = RND_MUL32(w[2], m1);
+
+        w[0] = (p1 >> 32) ^ w[1] ^ (uint64_t)k0;
+        w[1] = p1 & RND_LO32;
+        w[2] = (p0 >> 32) ^ w[3] ^ (uint64_t)k1;
+        w[3] = p0 & RND_LO32;
+
+        k0 += RND_W0;
+        k1 += RND_W1;
+    }
+}
+
+/* (m + 0.5) * 2^-52, m the top 52 bits of the 64-bit word hi:lo */
+static inline act_vf_t
+rnd_uniform(rnd_vu_t lo, rnd_vu_t hi)
+{
+    rnd_vu_t m = ((hi << 32) | lo) >> 12;
+
+    return (act_vf_t)(m | RND_ONE_BITS) - (1.0 - 0x1p-53);
+}
+
+/* (m + 0.5) * 2^-24, m the top 24 bits of the word w */
+static inline act_vf_t
+rnd_uniformf(rnd_vu_t w)
+{
+    act_vf_t m = (act_vf_t)((w >> 8) | RND_TWO52_BITS) - 0x1p52;
+
+    return (m + 0.5) * 0x1p-24;
+}
+
+static inline act_vf_t
+rnd_radius(act_vf_t l)
+{
+    return NRM_SQRT(l * -2.0);
+}
+
+#if ALM_ACT_VLEN == 4
+/* e0 o0 e1 o1 | e2 o2 e3 o3 */
+static inline void
+rnd_zip(act_vf_t e, act_vf_t o, act_vf_t z[2])
+{
+    __m256d lo = _mm256_unpacklo_pd(e, o), hi = _mm256_unpackhi_pd(e, o);
+
+    z[0] = _mm256_permute2f128_pd(lo, hi, 0x20);
+    z[1] = _mm256_permute2f128_pd(lo, hi, 0x31);
+}
+
+/* h[w] lane b to element 4b + w */
+static inline void
+rnd_zipf(nrm_hf_t h[4], nrm_vf_t z[2])
+{
+    _MM_TRANSPOSE4_PS(h[0], h[1], h[2], h[3]);
+
+    z[0] = NRM_JOIN(h[0], h[1]);
+    z[1] = NRM_JOIN(h[2], h[3]);
+}
+#else
+static inline void
+rnd_zip(act_vf_t e, act_vf_t o, act_vf_t z[2])
+{
+    const __m512i lo = _mm512_set_epi64(11, 3, 10, 2, 9, 1, 8, 0);
+    const __m512i hi = _mm512_set_epi64(15, 7, 14, 6, 13, 5, 12, 4);
+
+    z[0] = _mm512_permutex2var_pd(e, lo, o);
+    z[1] = _mm512_permutex2var_pd(e, hi, o);
+}
+
+static inline void
+rnd_zipf(nrm_hf_t h[4], nrm_vf_t z[2])
+{
+    const __m512i lo = _mm512_set_epi32(27, 19, 11, 3, 26, 18, 10, 2,
+                                         25, 17, 9, 1, 24, 16, 8, 0);
+    const __m512i hi = _mm512_set_epi32(31, 23, 15, 7, 30, 22, 14, 6,
+                                         29, 21, 13, 5, 28, 20, 12, 4);
+    nrm_vf_t a = NRM_JOIN(h[0], h[1]), b = NRM_JOIN(h[2], h[3]);
+
+    z[0] = _mm512_permutex2var_ps(a, lo, b);
+    z[1] = _mm512_permutex2var_ps(a, hi, b);
+}
+#endif
+
+/* elements RND_GROUP * g .. RND_GROUP * (g + 1) - 1 of the stream */
+static inline void
+rnd_group(int method, uint64_t seed, uint64_t g, act_vf_t z[2])
+{
+    rnd_vu_t w[4];
+    act_vf_t u0, u1, e, o, r, s, c;
+
+    rnd_philox(seed, g * ALM_ACT_VLEN, w);
+    u0 = rnd_uniform(w[0], w[1]);
+    u1 = rnd_uniform(w[2], w[3]);
+
+    if (method == RND_ICDF) {
+        e = RND_CDFNORMINV(u0);
+        o = RND_CDFNORMINV(u1);
+    } else {
+        r = rnd_radius(RND_LOG(u0));
+        RND_SINCOS(u1 * RND_2PI, &s, &c);
+        e = r * c;
+        o = r * s;
+    }
+
+    rnd_zip(e, o, z);
+}
+
+static inline void
+rnd_groupf(int method, uint64_t seed, uint64_t g, nrm_vf_t z[2])
+{
+    rnd_vu_t w[4];
+    act_vf_t u[4], r, s, c;
+    nrm_hf_t h[4];
+    int i;
+
+    rnd_philox(seed, g * ALM_ACT_VLEN, w);
+    for (i = 0; i < 4; i++)
+        u[i] = rnd_uniformf(w[i]);
+
+    if (method == RND_ICDF) {
+        for (i = 0; i < 4; i++)
+            h[i] = NRM_NARROW(nrm_cdfnorminv(u[i]));
+    } else {
+        for (i = 0; i < 4; i += 2) {
+            r = rnd_radius(act_log(u[i]));
+            RND_SINCOS(u[i + 1] * RND_2PI, &s, &c);
+            h[i]     = NRM_NARROW(r * c);
+            h[i + 1] = NRM_NARROW(r * s);
+        }
+    }
+
+    rnd_zipf(h, z);
+}
+
+/*
+ * Array drivers: elements offset .. offset + len - 1 of the stream.
+ * Whole groups are stored directly, a group cut by either end of the
+ * range goes through a buffer.
+ */
+#define RND_ARRAY(name, T, V, GROUP, group, STOREU)                         \
+static inline void                                                          \
+name(int method, uint64_t seed, uint64_t offset, int len, T *dst)           \
+{                                                                           \
+    uint64_t g = offset / GROUP;                                            \
+    int skip = (int)(offset % GROUP), n;                                    \
+    V z[2];                                                                 \
+    T buf[GROUP];                                                           \
+                                                                            \
+    if (method != RND_ICDF && method != RND_BOX_MULLER)                     \
+        return;                                                             \
+                                                                            \
+    for (; len > 0; g++, dst += n, len -= n) {                              \
+        group(method, seed, g, z);                                          \
+        if (skip == 0 && len >= GROUP) {                                    \
+            STOREU(dst, z[0]);                                              \
+            STOREU(dst + GROUP / 2, z[1]);                                  \
+            n = GROUP;                                                      \
+            continue;                                                       \
+        }                                                                   \
+        STOREU(buf, z[0]);                                                  \
+        STOREU(buf + GROUP / 2, z[1]);                                      \
+        n = GROUP - skip < len ? GROUP - skip : len;                        \
+        memcpy(dst, buf + skip, (size_t)n * sizeof(T));                     \
+        skip = 0;                                                           \
+    }                                                                       \
+}
+
+RND_ARRAY(rnd_randn_array, double, act_vf_t, RND_GROUP, rnd_group, ACT_STOREU)
+RND_ARRAY(rnd_randnf_array, float, nrm_vf_t, RND_GROUPF, rnd_groupf, NRM_STOREU)
+
+#endif  /* __LIBM_ALM_RANDN_H__ */
@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Width- and precision-generic kernels for 1/sqrt(x) and 1/x, in three
+ * accuracy tiers:
+ *
+ *   fast     the hardware estimate (vrsqrt14/vrcp14 on AVX-512, the 12-bit
+ *            vrsqrtps/vrcpps on AVX2) refined by Newton steps: one for
+ *            binary32, two (AVX-512) or three (AVX2, from the binary32
+ *            estimate) for binary64. Lanes the estimate cannot take,
+ *            zero, subnormal, huge, infinite, negative or NaN operands,
+ *            go to the default tier (the cr tier for binary64 rsqrt), on
+ *            a branch that is not taken for ordinary data.
+ *   default  1/sqrt(x) and 1/x with the IEEE divide and square root.
+ *            binary32 rsqrt is evaluated in binary64 and rounded once,
+ *            which is correctly rounded for every float; binary32 and
+ *            binary64 reciprocals are correctly rounded. binary64 rsqrt
+ *            rounds twice, in the square root and in the divide, and is
+ *            within 1.5 ULP.
+ *   cr       correctly rounded binary64 rsqrt, below.
+ *
+ * Newton step for y ~ 1/sqrt(x), e = 1 - x*y*y:  y += y*e/2
+ * Newton step for y ~ 1/x,       e = 1 - x*y:    y += y*e
+ *
+ * Correctly rounded rsqrt: y = 1/sqrt(x) has a relative error below
+ * 2^-52. With y*y = h + l and x*h = p + q split exactly by FMA,
+ * e = ((1 - p) - q) - x*l is 1 - x*y*y to about 2^-105, and
+ * y + y*e*(1/2 + 3/8 e) approximates 1/sqrt(x) to about 2^-104. Adding
+ * the correction is then correctly rounded unless 1/sqrt(x) lies within
+ * 2^-98 of a midpoint, which shows as y + (c + eps) and y + (c - eps)
+ * rounding apart. Those lanes, about one in 2^45, are decided exactly in
+ * integer arithmetic by rcp_rsqrt_exact(). Operands below 2^-1000 or
+ * above 2^1000 are scaled by 2^+-200 first, so y*y neither overflows nor
+ * underflows.
+ *
+ * The includer defines ALM_ACT_VLEN, and ALM_ACT_DOUBLE for binary64, as
+ * for alm_activation.h.
+ */
+
+#ifndef __LIBM_ALM_RECIP_H__
+#define __LIBM_ALM_RECIP_H__
+
+#include <libm/alm_activation.h>
+
+#if defined(ALM_ACT_DOUBLE)
+#if ALM_ACT_VLEN == 4
+#define RCP_SQRT(x)             _mm256_sqrt_pd(x)
+/* binary32 estimates of x in the binary32 range, 1.5 * 2^-12 */
+#define RCP_RSQRT_EST(x)        _mm256_cvtps_pd(_mm_rsqrt_ps(_mm256_cvtpd_ps(x)))
+#define RCP_RCP_EST(x)          _mm256_cvtps_pd(_mm_rcp_ps(_mm256_cvtpd_ps(x)))
+#define RCP_STEPS               3
+#define RCP_MIN                 0x1p-120
+#define RCP_MAX                 0x1p120
+#else
+#define RCP_SQRT(x)             _mm512_sqrt_pd(x)
+#define RCP_RSQRT_EST(x)        _mm512_rsqrt14_pd(x)
+#define RCP_RCP_EST(x)          _mm512_rcp14_pd(x)
+#define RCP_STEPS               2
+#define RCP_MIN                 0x1p-1020
+#define RCP_MAX                 0x1p1020
+#endif
+#else /* binary32 */
+#if ALM_ACT_VLEN == 8
+typedef v_f64x4_t   rcp_vd_t;
+#define RCP_WIDEN_LO(v)         _mm256_cvtps_pd(_mm256_castps256_ps128(v))
+#define RCP_WIDEN_HI(v)         _mm256_cvtps_pd(_mm256_extractf128_ps(v, 1))
+#define RCP_NARROW2(l, h)       _mm256_insertf128_ps(_mm256_castps128_ps256( \
+                                    _mm256_cvtpd_ps(l)), _mm256_cvtpd_ps(h), 1)
+#define RCP_SQRTD(x)            _mm256_sqrt_pd(x)
+#define RCP_RSQRT_EST(x)        _mm256_rsqrt_ps(x)
+#define RCP_RCP_EST(x)          _mm256_rcp_ps(x)
+#else
+typedef v_f64x8_t   rcp_vd_t;
+#define RCP_WIDEN_LO(v)         _mm512_cvtps_pd(_mm512_castps512_ps256(v))
+#define RCP_WIDEN_HI(v)         _mm512_cvtps_pd(_mm512_extractf32x8_ps(v, 1))
+#define RCP_NARROW2(l, h)       _mm512_insertf32x8(_mm512_castps256_ps512( \
+                                    _mm512_cvtpd_ps(l)), _mm512_cvtpd_ps(h), 1)
+#define RCP_SQRTD(x)            _mm512_sqrt_pd(x)
+#define RCP_RSQRT_EST(x)        _mm512_rsqrt14_ps(x)
+#define RCP_RCP_EST(x)          _mm512_rcp14_ps(x)
+#endif
+#define RCP_STEPS               1
+#define RCP_MIN                 0x1p-125f
+#define RCP_MAX                 0x1p125f
+#endif
+
+/* Default tier */
+
+static inline act_vf_t
+rcp_recip(act_vf_t x)
+{
+    return ACT_C(1.0) / x;
+}
+
+#if defined(ALM_ACT_DOUBLE)
+static inline act_vf_t
+rcp_rsqrt(act_vf_t x)
+{
+    return 1.0 / RCP_SQRT(x);
+}
+#else
+static inline act_vf_t
+rcp_rsqrt(act_vf_t x)
+{
+    rcp_vd_t lo = RCP_WIDEN_LO(x), hi = RCP_WIDEN_HI(x);
+
+    return RCP_NARROW2(1.0 / RCP_SQRTD(lo), 1.0 / RCP_SQRTD(hi));
+}
+#endif
+
+#if defined(ALM_ACT_DOUBLE)
+
+/* Correctly rounded tier */
+
+/* r[0..na+nb) = a[0..na) * b[0..nb), little-endian 32-bit limbs */
+static inline void
+rcp_mul_limbs(const uint32_t *a, int na, const uint32_t *b, int nb,
+              uint32_t *r)
+{
+    for (int i = 0; i < na + nb; i++)
+        r[i] = 0;
+
+    for (int i = 0; i < na; i++) {
+        uint64_t c = 0;
+        for (int j = 0; j < nb; j++) {
+            c += (uint64_t)a[i] * b[j] + r[i + j];
+            r[i + j] = (uint32_t)c;
+            c >>= 32;
+        }
+        r[i + nb] = (uint32_t)c;
+    }
+}
+
+/*
+ * Whether x * (M * 2^em)^2 < 1, exactly, for x = X * 2^ex. P = X*M*M is
+ * below 2^-(ex + 2em) iff its bit length is at most -(ex + 2em): M is odd
+ * and larger than 1, so P is never a power of two.
+ */
+static inline int
+rcp_below_one(uint64_t X, int ex, uint64_t M, int em)
+{
+    uint32_t a[2] = {(uint32_t)X, (uint32_t)(X >> 32)};
+    uint32_t m[2] = {(uint32_t)M, (uint32_t)(M >> 32)};
+    uint32_t m2[4], p[6];
+    int n = 6;
+
+    rcp_mul_limbs(m, 2, m, 2, m2);
+    rcp_mul_limbs(a, 2, m2, 4, p);
+
+    while (n > 1 && p[n - 1] == 0)
+        n--;
+
+    return 32 * (n - 1) + (32 - __builtin_clz(p[n - 1])) <= -(ex + 2 * em);
+}
+
+/*
+ * Correctly rounded 1/sqrt(x) for x positive and finite, given y within
+ * 1 ULP of it: the result is y or a neighbour, picked by comparing
+ * 1/sqrt(x) with the midpoints around y.
+ */
+static inline double
+rcp_rsqrt_exact(double x, double y)
+{
+    uint64_t bx, by, X, Y;
+    int ex, ey;
+    double up, dn;
+
+    __builtin_memcpy(&bx, &x, sizeof(bx));
+    __builtin_memcpy(&by, &y, sizeof(by));
+
+    X = bx & ((UINT64_C(1) << 52) - 1);
+    ex = (int)(bx >> 52);
+    if (ex) {
+        X |= UINT64_C(1) << 52;
+        ex -= 1075;
+    } else {
+        ex = -1074;
+    }
+
+    /* y is normal: 2^-512 < y < 2^537 */
+    Y = (by & ((UINT64_C(1) << 52) - 1)) | (UINT64_C(1) << 52);
+    ey = (int)(by >> 52) - 1075;
+
+    by++;
+    __builtin_memcpy(&up, &by, sizeof(up));
+    by -= 2;
+    __builtin_memcpy(&dn, &by, sizeof(dn));
+
+    /* 1/sqrt(x) above (y + up)/2 */
+    if (rcp_below_one(X, ex, 2 * Y + 1, ey - 1))
+        return up;
+
+    /* 1/sqrt(x) below (dn + y)/2, a quarter ULP down at a power of two */
+    if (Y == UINT64_C(1) << 52) {
+        if (!rcp_below_one(X, ex, 4 * Y - 1, ey - 2))
+            return dn;
+    } else if (!rcp_below_one(X, ex, 2 * Y - 1, ey - 1)) {
+        return dn;
+    }
+
+    return y;
+}
+
+static inline act_vf_t
+rcp_rsqrt_cr(act_vf_t x)
+{
+    act_vi_t small = x < 0x1p-1000, big = x > 0x1p1000;
+    act_vf_t xs = act_sel(small, x * 0x1p200, act_sel(big, x * 0x1p-200, x));
+    act_vf_t sc = act_sel(small, act_set1(0x1p100),
+                          act_sel(big, act_set1(0x1p-100), act_set1(1.0)));
+    act_vi_t ok = (x > 0.0) & (x < __builtin_inf());
+
+    act_vf_t y = 1.0 / RCP_SQRT(xs);
+    act_vf_t h = y * y, l = ACT_FMA(y, y, -h);
+    act_vf_t p = xs * h, q = ACT_FMA(xs, h, -p);
+    act_vf_t e = ((1.0 - p) - q) - xs * l;
+    act_vf_t c = y * e * (0.5 + 0.375 * e);
+    act_vf_t eps = y * 0x1p-98;
+    act_vf_t r = y + c;
+
+    act_vi_t hard = ok & ((y + (c + eps)) != (y + (c - eps)));
+    if (unlikely(ACT_ANY(hard))) {
+        double px[ALM_ACT_VLEN], pr[ALM_ACT_VLEN];
+
+        ACT_STOREU(px, xs);
+        ACT_STOREU(pr, r);
+        for (int i = 0; i < ALM_ACT_VLEN; i++)
+            if (hard[i])
+                pr[i] = rcp_rsqrt_exact(px[i], pr[i]);
+        r = ACT_LOADU(pr);
+    }
+
+    return act_sel(ok, r, y) * sc;
+}
+
+#endif /* ALM_ACT_DOUBLE */
+
+/*
+ * The binary64 default rsqrt rounds twice, so binary64 lanes the estimate
+ * cannot take go to the correctly rounded tier to stay within 1 ULP.
+ */
+#if defined(ALM_ACT_DOUBLE)
+#define RCP_RSQRT_SLOW(x)       rcp_rsqrt_cr(x)
+#else
+#define RCP_RSQRT_SLOW(x)       rcp_rsqrt(x)
+#endif
+
+/* Fast tier */
+
+static inline act_vf_t
+rcp_rsqrt_fast(act_vf_t x)
+{
+    act_vf_t y = RCP_RSQRT_EST(x), e;
+    act_vi_t ok = (x >= RCP_MIN) & (x <= RCP_MAX);
+
+    for (int i = 0; i < RCP_STEPS; i++) {
+        e = ACT_FMA(-(x * y), y, act_set1(ACT_C(1.0)));
+        y = ACT_FMA(ACT_C(0.5) * y, e, y);
+    }
+
+    if (unlikely(ACT_ANY(~ok)))
+        y = act_sel(ok, y, RCP_RSQRT_SLOW(x));
+
+    return y;
+}
+
+static inline act_vf_t
+rcp_recip_fast(act_vf_t x)
+{
+    act_vf_t y = RCP_RCP_EST(x), e;
+    act_vf_t a = act_abs(x);
+    act_vi_t ok = (a >= RCP_MIN) & (a <= RCP_MAX);
+
+    for (int i = 0; i < RCP_STEPS; i++) {
+        e = ACT_FMA(-x, y, act_set1(ACT_C(1.0)));
+        y = ACT_FMA(y, e, y);
+    }
+
+    if (unlikely(ACT_ANY(~ok)))
+        y = act_sel(ok, y, rcp_recip(x));
+
+    return y;
+}
+
+#endif /* __LIBM_ALM_RECIP_H__ */
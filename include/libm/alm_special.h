@@ -34,6 +34,7 @@
 #include <libm_errno_amd.h>
 /* Complex exponential special handler */
 #include <libm/types.h>
+#include <libm/alm_stats.h>
 /*
  * Error codes to specify if an input is or
  *  output will be special floating point numbers
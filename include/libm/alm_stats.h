@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Call and slow-path counters, built with ALM_STATS defined
+ * (LIBM_ENABLE_STATS=ON with CMake, use_stats=1 with SCons).
+ *
+ * A site is one row of counters, in the alm_stats section, which
+ * src/alm_stats.c walks to report them per function:
+ *
+ *   - the amd_<fn> entry points (src/entry_pt_macros.h) count calls, and
+ *     the array ones elements,
+ *   - ALM_STATS_LANES() in the call_vN helpers, and ALM_STATS_LANE() in
+ *     kernels with a loop of their own, count the vector lanes handed to
+ *     the scalar function,
+ *   - ALM_STATS_REDUCE() counts large-argument pi/2 reductions,
+ *   - ALM_STATS_ERROR() counts calls of the special-case handlers of
+ *     src/alm_special.c.
+ *
+ * Sites of the last three are named after the source file they are
+ * compiled in (__BASE_FILE__, e.g. vrd4_exp.c counts for "vrd4_exp"), or
+ * given a name explicitly.
+ *
+ * Each site holds one cache line of counters per stripe; a thread adds to
+ * the stripe its thread pointer hashes to, so that threads do not share
+ * lines. Without ALM_STATS the macros expand to nothing.
+ */
+
+#ifndef __LIBM_ALM_STATS_H__
+#define __LIBM_ALM_STATS_H__
+
+#include <stdint.h>
+
+#define ALM_STATS_STRIPES_LOG2  5
+#define ALM_STATS_STRIPES       (1 << ALM_STATS_STRIPES_LOG2)
+#define ALM_STATS_LINE          64      /* bytes per stripe */
+
+enum {
+    ALM_STATS_CALLS = 0,
+    ALM_STATS_ELEMS,
+    ALM_STATS_SPECIAL,
+    ALM_STATS_REDUCE,
+    ALM_STATS_ERROR,
+    ALM_STATS_NCTR
+};
+
+struct alm_stats_site {
+    uint64_t ctr[ALM_STATS_STRIPES][ALM_STATS_LINE / sizeof(uint64_t)];
+    const char *name;                   /* function, or source file path */
+} __attribute__((aligned(ALM_STATS_LINE)));
+
+#if defined(ALM_STATS)
+
+#define ALM_STATS_SECTION                                               \
+    __attribute__((section("alm_stats"), used, aligned(ALM_STATS_LINE)))
+
+/* thread pointer hashed to a stripe, the entry points use the same hash */
+static inline unsigned int
+alm_stats_stripe(void)
+{
+    uint64_t tp;
+
+    __asm__("movq %%fs:0, %0" : "=r"(tp));
+
+    return ((uint32_t)(tp >> 12) * 0x9e3779b1u) >> (32 - ALM_STATS_STRIPES_LOG2);
+}
+
+static inline void
+alm_stats_add(struct alm_stats_site *site, int ctr, uint64_t n)
+{
+    __atomic_fetch_add(&site->ctr[alm_stats_stripe()][ctr], n,
+                       __ATOMIC_RELAXED);
+}
+
+#define ALM_STATS_COUNT_AS(nm, ctr, n)                                  \
+    do {                                                                \
+        static struct alm_stats_site __alm_stats_site ALM_STATS_SECTION \
+            = { .name = nm };                                           \
+        alm_stats_add(&__alm_stats_site, ctr, n);                       \
+    } while (0)
+
+#define ALM_STATS_COUNT(ctr, n) ALM_STATS_COUNT_AS(__BASE_FILE__, ctr, n)
+
+/* number of non-zero lanes of cond */
+#define ALM_STATS_LANES(cond, vlen)                                     \
+    do {                                                                \
+        uint64_t __alm_stats_n = 0;                                     \
+        for (int __i = 0; __i < (vlen); __i++)                          \
+            __alm_stats_n += (cond)[__i] != 0;                          \
+        if (__alm_stats_n)                                              \
+            ALM_STATS_COUNT(ALM_STATS_SPECIAL, __alm_stats_n);          \
+    } while (0)
+
+#define ALM_STATS_LANE()        ALM_STATS_COUNT(ALM_STATS_SPECIAL, 1)
+#define ALM_STATS_REDUCE()      ALM_STATS_COUNT(ALM_STATS_REDUCE, 1)
+#define ALM_STATS_ERROR(nm)     ALM_STATS_COUNT_AS(nm, ALM_STATS_ERROR, 1)
+
+#else
+
+#define ALM_STATS_LANES(cond, vlen)     do { } while (0)
+#define ALM_STATS_LANE()                do { } while (0)
+#define ALM_STATS_REDUCE()              do { } while (0)
+#define ALM_STATS_ERROR(nm)             do { } while (0)
+
+#endif  /* ALM_STATS */
+
+#endif  /* __LIBM_ALM_STATS_H__ */
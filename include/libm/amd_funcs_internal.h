@@ -64,6 +64,12 @@
 #include "__alm_func_internal.h"
 #undef ALM_PROTO_INTERNAL
 
+#ifndef ALM_FAST_TIER
+#define ALM_PROTO_INTERNAL ALM_PROTO_FAST_TIER
+#include "__alm_func_internal.h"
+#undef ALM_PROTO_INTERNAL
+#endif
+
 #pragma pop_macro("ALM_PROTO_INTERNAL")
 
 #endif	/* __ALM_FUNCS_INTERNAL_H__ */
@@ -153,6 +153,10 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(tanhf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(tanpif);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(truncf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(erff);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(erfinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(erfcinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cdfnormf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cdfnorminvf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(erfcf);
 
 /*
@@ -164,6 +168,24 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(clog);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(clogf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(cpow);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(cpowf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(csqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(csqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cabs);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cabsf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(carg);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cargf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(csin);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(csinf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ccos);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ccosf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ctan);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ctanf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(csinh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(csinhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ccosh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ccoshf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ctanh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(ctanhf);
 
 
 /*
@@ -197,6 +219,7 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_pow);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_sqrt);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_linearfrac);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_powx);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_powi);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_sincos);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_round);
 
@@ -215,6 +238,7 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_powf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_sqrtf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_linearfracf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_powxf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_powif);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_sincosf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_roundf);
 
@@ -253,6 +277,10 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_asinf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_atanf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_coshf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_erff);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_erfinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_erfcinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_cdfnormf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_cdfnorminvf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_tanhf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_tanf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_atan);
@@ -290,6 +318,10 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_cbrtf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_asinf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_atanf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_erff);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_erfinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_erfcinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_cdfnormf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_cdfnorminvf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_fabsf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_sqrtf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs4_linearfracf);
@@ -313,6 +345,10 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_powf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_powxf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_asinf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_erff);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_erfinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_erfcinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_cdfnormf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_cdfnorminvf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_fabsf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_sqrtf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_linearfracf);
@@ -418,6 +454,10 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_tanf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_atanf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_tanhf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_erff);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_erfinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_erfcinvf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_cdfnormf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_cdfnorminvf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_sqrtf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_linearfracf);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_sincosf);
@@ -432,4 +472,248 @@ extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd2_asin);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_asin);
 extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_asin);
 
+extern alm_ep_func_t        G_ENTRY_PT_PTR(expf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_expf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_expf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_expf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_expf16);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(logf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_logf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_logf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_logf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_logf16);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(sqrtf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_sqrtf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_sqrtf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_sqrtf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_sqrtf16);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(tanhf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_tanhf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_tanhf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_tanhf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_tanhf16);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(erff16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_erff16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_erff16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_erff16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_erff16);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(sinf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_sinf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_sinf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_sinf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_sinf16);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(cosf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh8_cosf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh16_cosf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrh32_cosf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrha_cosf16);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_expbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_logbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_tanhbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_erfbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_sigmoidbf16);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrba_gelubf16);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_sigmoidf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_sigmoidf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_sigmoidf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_sigmoid);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_sigmoid);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_sigmoid);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_softplusf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_softplusf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_softplusf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_softplus);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_softplus);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_softplus);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_geluf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_geluf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_geluf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_gelu);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_gelu);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_gelu);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_gelu_tanhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_gelu_tanhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_gelu_tanhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_gelu_tanh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_gelu_tanh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_gelu_tanh);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_siluf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_siluf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_siluf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_silu);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_silu);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_silu);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_mishf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_mishf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_mishf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_mish);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_mish);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_mish);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_softmaxf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_softmax_batchf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_softmax);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_softmax_batch);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_log_softmaxf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_log_softmax_batchf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_log_softmax);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_log_softmax_batch);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_randnf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_randn);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_rsqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_rsqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_rsqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_rsqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_rsqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_rsqrt);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_rsqrt_fastf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_rsqrt_fastf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_rsqrt_fast);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_rsqrt_fast);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_rsqrt_fastf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_rsqrt_fast);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_rsqrt_cr);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_rsqrt_cr);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_rsqrt_cr);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_recipf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_recipf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_recip);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_recip);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_recipf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_recip);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs8_recip_fastf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrs16_recip_fastf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd4_recip_fast);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrd8_recip_fast);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrsa_recip_fastf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrda_recip_fast);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_cexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_cexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_cexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_cexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cexp);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cexp_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cexpf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cexpf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_clog);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_clog);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_clogf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_clogf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_clog);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_clog_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_clogf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_clogf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_cpow);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_cpow);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_cpowf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_cpowf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cpow);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cpow_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cpowf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cpowf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_csqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_csqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_csqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_csqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_csqrt);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_csqrt_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_csqrtf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_csqrtf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_cabs);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_cabs);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_cabsf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_cabsf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cabs);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_cabs_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cabsf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cabsf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_carg);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_carg);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_cargf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_cargf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_carg);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_carg_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cargf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_cargf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_csin);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_csin);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_csinf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_csinf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_csin);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_csin_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_csinf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_csinf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_ccos);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_ccos);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_ccosf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_ccosf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_ccos);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_ccos_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_ccosf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_ccosf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_ctan);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_ctan);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_ctanf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_ctanf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_ctan);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_ctan_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_ctanf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_ctanf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_csinh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_csinh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_csinhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_csinhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_csinh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_csinh_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_csinhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_csinhf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_ccosh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_ccosh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_ccoshf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_ccoshf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_ccosh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_ccosh_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_ccoshf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_ccoshf_split);
+
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz4_ctanh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrz8_ctanh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc8_ctanhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrc16_ctanhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_ctanh);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrza_ctanh_split);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_ctanhf);
+extern alm_ep_func_t        G_ENTRY_PT_PTR(vrca_ctanhf_split);
+
 #endif	/* __AMD_LIBM_ENTRY_PT_PTR_H__ */
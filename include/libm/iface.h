@@ -75,6 +75,7 @@ enum {
     C_AMD_NEXTTOWARD,
     C_AMD_POW,
     C_AMD_POWX,
+    C_AMD_POWI,
     C_AMD_REMAINDER,
     C_AMD_REMQUO,
     C_AMD_RINT,
@@ -107,6 +108,22 @@ enum {
     C_AMD_LINEARFRAC,
     C_AMD_CDFNORM,
     C_AMD_CDFNORMINV,
+    C_AMD_SIGMOID,
+    C_AMD_GELU,
+    C_AMD_GELU_TANH,
+    C_AMD_SOFTPLUS,
+    C_AMD_SILU,
+    C_AMD_MISH,
+    C_AMD_SOFTMAX,
+    C_AMD_SOFTMAX_BATCH,
+    C_AMD_LOG_SOFTMAX,
+    C_AMD_LOG_SOFTMAX_BATCH,
+    C_AMD_RANDN,
+    C_AMD_RSQRT,
+    C_AMD_RSQRT_FAST,
+    C_AMD_RSQRT_CR,
+    C_AMD_RECIP,
+    C_AMD_RECIP_FAST,
 
     /*
      * INTEGER VARIANTS
@@ -122,6 +139,15 @@ enum {
     C_AMD_CEXP,
     C_AMD_CPOW,
     C_AMD_CLOG,
+    C_AMD_CSQRT,
+    C_AMD_CABS,
+    C_AMD_CARG,
+    C_AMD_CSIN,
+    C_AMD_CCOS,
+    C_AMD_CTAN,
+    C_AMD_CSINH,
+    C_AMD_CCOSH,
+    C_AMD_CTANH,
 
     /*
      * This one needs to be last one, REALLY !!!
@@ -138,6 +164,12 @@ enum {
 /* INIT function for libm */
 extern void libm_iface_init(void);
 
+/* re-run one initializer with an accuracy tier per variant, see iface.c */
+extern int libm_iface_reinit(int idx, const int *tier, int *got);
+
+/* index of the initializer for function family 'name', or -1 */
+extern int libm_iface_find(const char *name);
+
 /* function specific initializer */
 extern void LIBM_IFACE_PROTO(acos)(void *arg);
 extern void LIBM_IFACE_PROTO(acosh)(void *arg);
@@ -183,6 +215,7 @@ extern void LIBM_IFACE_PROTO(nextafter)(void *arg);
 extern void LIBM_IFACE_PROTO(nexttoward)(void *arg);
 extern void LIBM_IFACE_PROTO(pow)(void *arg);
 extern void LIBM_IFACE_PROTO(powx)(void *arg);
+extern void LIBM_IFACE_PROTO(powi)(void *arg);
 extern void LIBM_IFACE_PROTO(remainder)(void *arg);
 extern void LIBM_IFACE_PROTO(remquo)(void *arg);
 extern void LIBM_IFACE_PROTO(rint)(void *arg);
@@ -204,6 +237,15 @@ extern void LIBM_IFACE_PROTO(erfcinv)(void *arg);
 extern void LIBM_IFACE_PROTO(cexp)(void *arg);
 extern void LIBM_IFACE_PROTO(clog)(void *arg);
 extern void LIBM_IFACE_PROTO(cpow)(void *arg);
+extern void LIBM_IFACE_PROTO(csqrt)(void *arg);
+extern void LIBM_IFACE_PROTO(cabs)(void *arg);
+extern void LIBM_IFACE_PROTO(carg)(void *arg);
+extern void LIBM_IFACE_PROTO(csin)(void *arg);
+extern void LIBM_IFACE_PROTO(ccos)(void *arg);
+extern void LIBM_IFACE_PROTO(ctan)(void *arg);
+extern void LIBM_IFACE_PROTO(csinh)(void *arg);
+extern void LIBM_IFACE_PROTO(ccosh)(void *arg);
+extern void LIBM_IFACE_PROTO(ctanh)(void *arg);
 extern void LIBM_IFACE_PROTO(add)(void *arg);
 extern void LIBM_IFACE_PROTO(sub)(void *arg);
 extern void LIBM_IFACE_PROTO(mul)(void *arg);
@@ -219,10 +261,27 @@ extern void LIBM_IFACE_PROTO(fmini)(void *arg);
 extern void LIBM_IFACE_PROTO(linearfrac)(void *arg);
 extern void LIBM_IFACE_PROTO(cdfnorm)(void *arg);
 extern void LIBM_IFACE_PROTO(cdfnorminv)(void *arg);
+extern void LIBM_IFACE_PROTO(sigmoid)(void *arg);
+extern void LIBM_IFACE_PROTO(gelu)(void *arg);
+extern void LIBM_IFACE_PROTO(gelu_tanh)(void *arg);
+extern void LIBM_IFACE_PROTO(softplus)(void *arg);
+extern void LIBM_IFACE_PROTO(silu)(void *arg);
+extern void LIBM_IFACE_PROTO(mish)(void *arg);
+extern void LIBM_IFACE_PROTO(softmax)(void *arg);
+extern void LIBM_IFACE_PROTO(softmax_batch)(void *arg);
+extern void LIBM_IFACE_PROTO(log_softmax)(void *arg);
+extern void LIBM_IFACE_PROTO(log_softmax_batch)(void *arg);
+extern void LIBM_IFACE_PROTO(randn)(void *arg);
+extern void LIBM_IFACE_PROTO(rsqrt)(void *arg);
+extern void LIBM_IFACE_PROTO(rsqrt_fast)(void *arg);
+extern void LIBM_IFACE_PROTO(rsqrt_cr)(void *arg);
+extern void LIBM_IFACE_PROTO(recip)(void *arg);
+extern void LIBM_IFACE_PROTO(recip_fast)(void *arg);
 
 struct entry_pt_interface {
     void (*epi_init)(void *arg);
     void *epi_arg;
+    const char *epi_name;               /* function family, e.g. "exp" */
 };
 
 extern struct entry_pt_interface entry_pt_initializers[C_AMD_LAST_ENTRY];
@@ -254,6 +313,18 @@ enum ALM_FUNC_VARIANTS {
     ALM_FUNC_SCAL_SP_CMPLX, /* Complex variant */
     ALM_FUNC_SCAL_DP_CMPLX,
 
+    ALM_FUNC_VECT_HP_ARR,   /* Half precision array */
+    ALM_FUNC_VECT_BF16_ARR, /* bfloat16 array */
+
+    ALM_FUNC_VECT_SP_CMPLX_8,   /* Complex vector, split re/im registers */
+    ALM_FUNC_VECT_SP_CMPLX_16,
+    ALM_FUNC_VECT_DP_CMPLX_4,
+    ALM_FUNC_VECT_DP_CMPLX_8,
+    ALM_FUNC_VECT_SP_CMPLX_ARR, /* Complex array, interleaved re/im */
+    ALM_FUNC_VECT_DP_CMPLX_ARR,
+    ALM_FUNC_VECT_SP_CMPLX_SPLIT, /* Complex array, separate re[]/im[] */
+    ALM_FUNC_VECT_DP_CMPLX_SPLIT,
+
     ALM_FUNC_VAR_MAX,                   /* should be last, always */
 };
 typedef enum ALM_FUNC_VARIANTS alm_func_var_t;
@@ -274,6 +345,17 @@ enum ALM_UARCH_VERSIONS {
 };
 typedef enum ALM_UARCH_VERSIONS alm_uarch_ver_t;
 
+/*
+ * Accuracy tiers, in the order of alm_accuracy_t in amdlibm_vec.h
+ */
+enum ALM_ACC_TIERS {
+    ALM_ACC_TIER_1ULP,                  /* the funcs[][] tables */
+    ALM_ACC_TIER_FAST,
+    ALM_ACC_TIER_CR,
+
+    ALM_ACC_TIER_MAX,                   /* should be last, always */
+};
+
 #ifndef alm_func_t
 typedef void (*alm_func_t)(void);
 #endif
@@ -286,6 +368,8 @@ typedef struct alm_ep_wrapper alm_ep_wrapper_t;
 struct alm_arch_funcs {
     alm_uarch_ver_t  def_arch;          /* Default version to choose */
     void *           funcs[ALM_UARCH_MAX][ALM_FUNC_VAR_MAX]; /* function array */
+    /* variants for the other accuracy tiers, overlaid on funcs[][] */
+    const struct alm_arch_funcs *tiers[ALM_ACC_TIER_MAX];
 };
 
 void alm_iface_fixup(alm_ep_wrapper_t *g_ep_wrapper,
@@ -29,6 +29,7 @@
 #define __LIBM_TYPEHELPER_VEC_H__
 
 #include <libm/types.h>
+#include <libm/alm_stats.h>
 
 #include <emmintrin.h>
 #if defined(_WIN64) || defined(_WIN32)
@@ -565,6 +566,8 @@ call2_v16_f32(float (*fn)(float, float),
         v_f32x16_t result,
         v_i32x16_t cond)
 {
+    ALM_STATS_LANES(cond, 16);
+
     return (v_f32x16_t) {
         cond[0] ? fn(x[0], y[0]) : result[0],
             cond[1] ? fn(x[1], y[1]) : result[1],
@@ -596,6 +599,8 @@ call_v8_f32(float (*fn)(float),
             v_f32x8_t result,
             v_u32x8_t cond)
 {
+    ALM_STATS_LANES(cond, 8);
+
     return (v_f32x8_t) {
         cond[0] ? fn(x[0]) : result[0],
             cond[1] ? fn(x[1]) : result[1],
@@ -616,6 +621,8 @@ call_v16_f32(float (*fn)(float),
              v_f32x16_t result,
              v_u32x16_t cond)
 {
+    ALM_STATS_LANES(cond, 16);
+
     return (v_f32x16_t) {
         cond[0] ? fn(x[0]) : result[0],
         cond[1] ? fn(x[1]) : result[1],
@@ -655,6 +662,8 @@ call2_v8_f32(float (*fn)(float, float),
         v_f32x8_t result,
         v_i32x8_t cond)
 {
+    ALM_STATS_LANES(cond, 8);
+
     return (v_f32x8_t) {
         cond[0] ? fn(x[0], y[0]) : result[0],
             cond[1] ? fn(x[1], y[1]) : result[1],
@@ -679,6 +688,8 @@ call2_v8_f32_spl(float (*fn)(float, float),
         v_f32x8_t result,
         v_i32x8_t cond)
 {
+    ALM_STATS_LANES(cond, 8);
+
     return (v_f32x8_t) {
         cond[0] ? fn(x[0], y) : result[0],
             cond[1] ? fn(x[1], y) : result[1],
@@ -702,6 +713,8 @@ call_v4_f32(float (*fn)(float),
            v_f32x4_t result,
            v_u32x4_t cond)
 {
+    ALM_STATS_LANES(cond, 4);
+
     return (v_f32x4_t){cond[0] ? fn(orig[0]) : result[0],
             cond[1] ? fn(orig[1]) : result[1],
             cond[2] ? fn(orig[2]) : result[2],
@@ -721,6 +734,8 @@ call2_v4_f32(float (*fn)(float, float),
             v_f32x4_t result,
             v_i32x4_t cond)
 {
+    ALM_STATS_LANES(cond, 4);
+
     return (v_f32x4_t){cond[0] ? fn(x[0], y[0]) : result[0],
             cond[1] ? fn(x[1], y[1]) : result[1],
             cond[2] ? fn(x[2], y[2]) : result[2],
@@ -736,6 +751,8 @@ call_v8_f64(double (*fn)(double),
             v_f64x8_t result,
             v_u64x8_t cond)
 {
+    ALM_STATS_LANES(cond, 8);
+
     return (v_f64x8_t){cond[0] ? fn(orig[0]) : result[0],
         cond[1] ? fn(orig[1]) : result[1],
         cond[2] ? fn(orig[2]) : result[2],
@@ -753,6 +770,8 @@ call2_v8_f64(double (*fn)(double, double),
        v_f64x8_t result,
        v_i64x8_t cond)
 {
+    ALM_STATS_LANES(cond, 8);
+
     return (v_f64x8_t){cond[0] ? fn(x[0], y[0]) : result[0],
             cond[1] ? fn(x[1], y[1]) : result[1],
             cond[2] ? fn(x[2], y[2]) : result[2],
@@ -779,6 +798,8 @@ call_v4_f64(double (*fn)(double),
            v_f64x4_t result,
            v_u64x4_t cond)
 {
+    ALM_STATS_LANES(cond, 4);
+
     return (v_f64x4_t){cond[0] ? fn(orig[0]) : result[0],
             cond[1] ? fn(orig[1]) : result[1],
             cond[2] ? fn(orig[2]) : result[2],
@@ -797,6 +818,8 @@ call_v2_f64(double (*fn)(double),
             v_f64x2_t result,
             v_u64x2_t cond)
 {
+    ALM_STATS_LANES(cond, 2);
+
     return (v_f64x2_t) {
         cond[0] ? fn(x[0]) : result[0],
         cond[1] ? fn(x[1]) : result[1],
@@ -814,6 +837,8 @@ call2_v4_f64(double (*fn)(double, double),
        v_f64x4_t result,
        v_i64x4_t cond)
 {
+    ALM_STATS_LANES(cond, 4);
+
     return (v_f64x4_t){cond[0] ? fn(x[0], y[0]) : result[0],
             cond[1] ? fn(x[1], y[1]) : result[1],
             cond[2] ? fn(x[2], y[2]) : result[2],
@@ -830,6 +855,8 @@ call2_v2_f64(double (*fn)(double, double),
        v_f64x2_t result,
        v_i64x2_t cond)
 {
+    ALM_STATS_LANES(cond, 2);
+
     return (v_f64x2_t){cond[0] ? fn(x[0], y[0]) : result[0],
             cond[1] ? fn(x[1], y[1]) : result[1]};
 }
@@ -28,6 +28,8 @@
 #ifndef LIBM_AMD_H_INCLUDED
 #define LIBM_AMD_H_INCLUDED 1
 
+#include <stddef.h>
+#include <stdint.h>
 #include "libm_macros.h"
 #ifdef WIN64
 #include <intrin.h>
@@ -76,6 +78,10 @@ double FN_PROTOTYPE(acos)(double x);
 
  double FN_PROTOTYPE( erf)(double x);
  float FN_PROTOTYPE(erff)(float x);
+ float FN_PROTOTYPE(erfinvf)(float x);
+ float FN_PROTOTYPE(erfcinvf)(float x);
+ float FN_PROTOTYPE(cdfnormf)(float x);
+ float FN_PROTOTYPE(cdfnorminvf)(float x);
 
  double FN_PROTOTYPE(erfc)(double x);
  float FN_PROTOTYPE(erfcf)(float x);
@@ -295,6 +301,10 @@ __m256d FN_PROTOTYPE(vrd4_cdfnorminv)(__m256d x);
 __m256d FN_PROTOTYPE(vrd4_erfcinv)(__m256d x);
 
 __m128 FN_PROTOTYPE(vrs4_erff)(__m128 x);
+__m128 FN_PROTOTYPE(vrs4_erfinvf)(__m128 x);
+__m128 FN_PROTOTYPE(vrs4_erfcinvf)(__m128 x);
+__m128 FN_PROTOTYPE(vrs4_cdfnormf)(__m128 x);
+__m128 FN_PROTOTYPE(vrs4_cdfnorminvf)(__m128 x);
 __m128 FN_PROTOTYPE(vrs4_expf)(__m128 x);
 __m128 FN_PROTOTYPE(vrs4_exp2f)(__m128 x);
 __m128 FN_PROTOTYPE(vrs4_exp10f)(__m128 x);
@@ -320,6 +330,10 @@ __m128 FN_PROTOTYPE(vrs4_erfcf)(__m128 x);
 __m128 FN_PROTOTYPE(vrs4_roundf)(__m128 x);
 
 __m256 FN_PROTOTYPE(vrs8_erff)(__m256 x);
+__m256 FN_PROTOTYPE(vrs8_erfinvf)(__m256 x);
+__m256 FN_PROTOTYPE(vrs8_erfcinvf)(__m256 x);
+__m256 FN_PROTOTYPE(vrs8_cdfnormf)(__m256 x);
+__m256 FN_PROTOTYPE(vrs8_cdfnorminvf)(__m256 x);
 __m256 FN_PROTOTYPE(vrs8_expf)(__m256 x);
 __m256 FN_PROTOTYPE(vrs8_logf)(__m256 x);
 __m256 FN_PROTOTYPE(vrs8_cosf)(__m256 x);
@@ -362,6 +376,7 @@ void FN_PROTOTYPE(vrda_log10)( int len, const double *src, double* dst );
 void FN_PROTOTYPE(vrsa_log1pf)( int len, const float *src, float *dst );
 void FN_PROTOTYPE(vrda_log1p)( int len, const double *src, double* dst );
 void FN_PROTOTYPE(vrsa_powxf)( int len, const float *src1, float src2, float *dst );
+void FN_PROTOTYPE(vrsa_powif)( int len, const float *src, int n, float *dst );
 void FN_PROTOTYPE(vrda_pow)( int len, const double *src1, const double *src2, double* dst );
 void FN_PROTOTYPE(vrsa_powf)( int len, const float *src1, const float *src2, float *dst );
 void FN_PROTOTYPE(vrda_fabs)(int len, const double *x, double* y);
@@ -407,6 +422,7 @@ void FN_PROTOTYPE(vrsa_linearfracf)(int len, const float *x, const float *y, flo
 
 /* Array variants of Powx */
 void FN_PROTOTYPE(vrda_powx)(int len, const double *x, double y, double *result);
+void FN_PROTOTYPE(vrda_powi)(int len, const double *x, int n, double *result);
 
 /* Array variant of of float precision*/
 void FN_PROTOTYPE(vrsa_acosf)(int n, const float *x, float *y);
@@ -414,6 +430,10 @@ void FN_PROTOTYPE(vrsa_asinf)(int n, const float *x, float *y);
 void FN_PROTOTYPE(vrsa_atanf)(int n, const float *x, float *y);
 void FN_PROTOTYPE(vrsa_coshf)(int n, const float *x, float *y);
 void FN_PROTOTYPE(vrsa_erff)(int n, const float *x, float *y);
+void FN_PROTOTYPE(vrsa_erfinvf)(int n, const float *x, float *y);
+void FN_PROTOTYPE(vrsa_erfcinvf)(int n, const float *x, float *y);
+void FN_PROTOTYPE(vrsa_cdfnormf)(int n, const float *x, float *y);
+void FN_PROTOTYPE(vrsa_cdfnorminvf)(int n, const float *x, float *y);
 void FN_PROTOTYPE(vrsa_tanhf)(int n, const float *x, float *y);
 void FN_PROTOTYPE(vrsa_tanf)(int n, const float *x, float *y);
 void FN_PROTOTYPE(vrda_atan)(int n, const double *x, double *y);
@@ -435,6 +455,430 @@ __m128d FN_PROTOTYPE(vrd2_asin)(__m128d x);
 __m256d FN_PROTOTYPE(vrd4_asin)(__m256d x);
 void FN_PROTOTYPE(vrda_asin)(int n, const double *x, double *y);
 
+/* Strided array variants with 64-bit length */
+void FN_PROTOTYPE(vrda_sini_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_cosi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_tani_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_asini_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_acosi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_atani_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_coshi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_expi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_exp2i_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_exp10i_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_expm1i_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_logi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_log2i_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_log10i_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_log1pi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_powi_64)(size_t len, const double *lhs, size_t inc_a, const double *rhs, size_t inc_b, double *dst, size_t inc_res);
+void FN_PROTOTYPE(vrda_sqrti_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_cbrti_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_erfi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_erfci_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_erfinvi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_erfcinvi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_cdfnormi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_cdfnorminvi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_fabsi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_roundi_64)(size_t len, const double *src, size_t inc_src, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_addi_64)(size_t len, const double *lhs, size_t inc_a, const double *rhs, size_t inc_b, double *dst, size_t inc_res);
+void FN_PROTOTYPE(vrda_subi_64)(size_t len, const double *lhs, size_t inc_a, const double *rhs, size_t inc_b, double *dst, size_t inc_res);
+void FN_PROTOTYPE(vrda_muli_64)(size_t len, const double *lhs, size_t inc_a, const double *rhs, size_t inc_b, double *dst, size_t inc_res);
+void FN_PROTOTYPE(vrda_divi_64)(size_t len, const double *lhs, size_t inc_a, const double *rhs, size_t inc_b, double *dst, size_t inc_res);
+void FN_PROTOTYPE(vrda_fmaxi_64)(size_t len, const double *lhs, size_t inc_a, const double *rhs, size_t inc_b, double *dst, size_t inc_res);
+void FN_PROTOTYPE(vrda_fmini_64)(size_t len, const double *lhs, size_t inc_a, const double *rhs, size_t inc_b, double *dst, size_t inc_res);
+void FN_PROTOTYPE(vrda_sincosi_64)(size_t len, const double *src, size_t inc_src, double *sin, size_t inc_sin, double *cos, size_t inc_cos);
+void FN_PROTOTYPE(vrda_powxi_64)(size_t len, const double *src, size_t inc_src, double y, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrda_linearfraci_64)(size_t len, const double *x, size_t inc_x, const double *y, size_t inc_y, double scx, double shx, double scy, double shy, double *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_sinfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_cosfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_tanfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_asinfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_acosfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_atanfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_coshfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_tanhfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_expfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_exp2fi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_exp10fi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_expm1fi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_logfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_log2fi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_log10fi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_log1pfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_powfi_64)(size_t len, const float *lhs, size_t inc_a, const float *rhs, size_t inc_b, float *dst, size_t inc_res);
+void FN_PROTOTYPE(vrsa_sqrtfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_cbrtfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_erffi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_erfcfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_fabsfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_roundfi_64)(size_t len, const float *src, size_t inc_src, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_addfi_64)(size_t len, const float *lhs, size_t inc_a, const float *rhs, size_t inc_b, float *dst, size_t inc_res);
+void FN_PROTOTYPE(vrsa_subfi_64)(size_t len, const float *lhs, size_t inc_a, const float *rhs, size_t inc_b, float *dst, size_t inc_res);
+void FN_PROTOTYPE(vrsa_mulfi_64)(size_t len, const float *lhs, size_t inc_a, const float *rhs, size_t inc_b, float *dst, size_t inc_res);
+void FN_PROTOTYPE(vrsa_divfi_64)(size_t len, const float *lhs, size_t inc_a, const float *rhs, size_t inc_b, float *dst, size_t inc_res);
+void FN_PROTOTYPE(vrsa_fmaxfi_64)(size_t len, const float *lhs, size_t inc_a, const float *rhs, size_t inc_b, float *dst, size_t inc_res);
+void FN_PROTOTYPE(vrsa_fminfi_64)(size_t len, const float *lhs, size_t inc_a, const float *rhs, size_t inc_b, float *dst, size_t inc_res);
+void FN_PROTOTYPE(vrsa_sincosfi_64)(size_t len, const float *src, size_t inc_src, float *sin, size_t inc_sin, float *cos, size_t inc_cos);
+void FN_PROTOTYPE(vrsa_powxfi_64)(size_t len, const float *src, size_t inc_src, float y, float *dst, size_t inc_dst);
+void FN_PROTOTYPE(vrsa_linearfracfi_64)(size_t len, const float *x, size_t inc_x, const float *y, size_t inc_y, float scx, float shx, float scy, float shy, float *dst, size_t inc_dst);
+
+/* Indexed and masked array variants */
+void FN_PROTOTYPE(vrda_sin_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_sin_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_sin_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cos_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cos_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cos_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_tan_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_tan_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_tan_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_asin_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_asin_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_asin_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_acos_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_acos_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_acos_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_atan_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_atan_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_atan_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cosh_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cosh_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cosh_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_exp_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_exp_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_exp_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_exp2_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_exp2_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_exp2_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_exp10_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_exp10_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_exp10_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_expm1_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_expm1_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_expm1_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log2_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log2_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log2_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log10_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log10_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log10_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log1p_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log1p_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_log1p_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_sqrt_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_sqrt_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_sqrt_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cbrt_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cbrt_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cbrt_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erf_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erf_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erf_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erfc_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erfc_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erfc_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erfinv_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erfinv_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erfinv_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erfcinv_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erfcinv_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_erfcinv_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cdfnorm_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cdfnorm_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cdfnorm_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cdfnorminv_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cdfnorminv_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_cdfnorminv_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_fabs_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_fabs_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_fabs_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_round_idx)(size_t len, const size_t *idx, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_round_mask)(size_t len, const unsigned char *mask, const double *src, double *dst);
+void FN_PROTOTYPE(vrda_round_bmask)(size_t len, const unsigned char *bits, const double *src, double *dst);
+void FN_PROTOTYPE(vrsa_sinf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_sinf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_sinf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_cosf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_cosf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_cosf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_tanf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_tanf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_tanf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_asinf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_asinf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_asinf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_acosf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_acosf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_acosf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_atanf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_atanf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_atanf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_coshf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_coshf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_coshf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_tanhf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_tanhf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_tanhf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_expf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_expf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_expf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_exp2f_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_exp2f_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_exp2f_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_exp10f_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_exp10f_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_exp10f_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_expm1f_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_expm1f_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_expm1f_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_logf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_logf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_logf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_log2f_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_log2f_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_log2f_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_log10f_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_log10f_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_log10f_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_log1pf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_log1pf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_log1pf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_sqrtf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_sqrtf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_sqrtf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_cbrtf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_cbrtf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_cbrtf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_erff_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_erff_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_erff_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_erfcf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_erfcf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_erfcf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_fabsf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_fabsf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_fabsf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_roundf_idx)(size_t len, const size_t *idx, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_roundf_mask)(size_t len, const unsigned char *mask, const float *src, float *dst);
+void FN_PROTOTYPE(vrsa_roundf_bmask)(size_t len, const unsigned char *bits, const float *src, float *dst);
+
+double FN_PROTOTYPE(vrda_sumexp)(int len, const double *src);
+double FN_PROTOTYPE(vrda_logsumexp)(int len, const double *src);
+double FN_PROTOTYPE(vrda_sumlog)(int len, const double *src);
+float FN_PROTOTYPE(vrsa_sumexpf)(int len, const float *src);
+float FN_PROTOTYPE(vrsa_logsumexpf)(int len, const float *src);
+float FN_PROTOTYPE(vrsa_sumlogf)(int len, const float *src);
+
+unsigned short FN_PROTOTYPE(expf16)(unsigned short x);
+unsigned short FN_PROTOTYPE(logf16)(unsigned short x);
+unsigned short FN_PROTOTYPE(sqrtf16)(unsigned short x);
+unsigned short FN_PROTOTYPE(tanhf16)(unsigned short x);
+unsigned short FN_PROTOTYPE(erff16)(unsigned short x);
+unsigned short FN_PROTOTYPE(sinf16)(unsigned short x);
+unsigned short FN_PROTOTYPE(cosf16)(unsigned short x);
+void FN_PROTOTYPE(vrha_expf16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrha_logf16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrha_sqrtf16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrha_tanhf16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrha_erff16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrha_sinf16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrha_cosf16)(int len, const unsigned short *src, unsigned short *dst);
+
+void FN_PROTOTYPE(vrba_expbf16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrba_logbf16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrba_tanhbf16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrba_erfbf16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrba_sigmoidbf16)(int len, const unsigned short *src, unsigned short *dst);
+void FN_PROTOTYPE(vrba_gelubf16)(int len, const unsigned short *src, unsigned short *dst);
+
+__m256 FN_PROTOTYPE(vrs8_sigmoidf)(__m256 x);
+void FN_PROTOTYPE(vrsa_sigmoidf)(int n, const float *x, float *y);
+__m256d FN_PROTOTYPE(vrd4_sigmoid)(__m256d x);
+void FN_PROTOTYPE(vrda_sigmoid)(int n, const double *x, double *y);
+
+__m256 FN_PROTOTYPE(vrs8_softplusf)(__m256 x);
+void FN_PROTOTYPE(vrsa_softplusf)(int n, const float *x, float *y);
+__m256d FN_PROTOTYPE(vrd4_softplus)(__m256d x);
+void FN_PROTOTYPE(vrda_softplus)(int n, const double *x, double *y);
+
+__m256 FN_PROTOTYPE(vrs8_geluf)(__m256 x);
+void FN_PROTOTYPE(vrsa_geluf)(int n, const float *x, float *y);
+__m256d FN_PROTOTYPE(vrd4_gelu)(__m256d x);
+void FN_PROTOTYPE(vrda_gelu)(int n, const double *x, double *y);
+
+__m256 FN_PROTOTYPE(vrs8_gelu_tanhf)(__m256 x);
+void FN_PROTOTYPE(vrsa_gelu_tanhf)(int n, const float *x, float *y);
+__m256d FN_PROTOTYPE(vrd4_gelu_tanh)(__m256d x);
+void FN_PROTOTYPE(vrda_gelu_tanh)(int n, const double *x, double *y);
+
+__m256 FN_PROTOTYPE(vrs8_siluf)(__m256 x);
+void FN_PROTOTYPE(vrsa_siluf)(int n, const float *x, float *y);
+__m256d FN_PROTOTYPE(vrd4_silu)(__m256d x);
+void FN_PROTOTYPE(vrda_silu)(int n, const double *x, double *y);
+
+__m256 FN_PROTOTYPE(vrs8_mishf)(__m256 x);
+void FN_PROTOTYPE(vrsa_mishf)(int n, const float *x, float *y);
+__m256d FN_PROTOTYPE(vrd4_mish)(__m256d x);
+void FN_PROTOTYPE(vrda_mish)(int n, const double *x, double *y);
+
+void FN_PROTOTYPE(vrsa_softmaxf)(int n, const float *x, float *y);
+void FN_PROTOTYPE(vrsa_softmax_batchf)(int rows, int cols, const float *x, int ldx, float *y, int ldy);
+void FN_PROTOTYPE(vrda_softmax)(int n, const double *x, double *y);
+void FN_PROTOTYPE(vrda_softmax_batch)(int rows, int cols, const double *x, int ldx, double *y, int ldy);
+
+void FN_PROTOTYPE(vrsa_log_softmaxf)(int n, const float *x, float *y);
+void FN_PROTOTYPE(vrsa_log_softmax_batchf)(int rows, int cols, const float *x, int ldx, float *y, int ldy);
+void FN_PROTOTYPE(vrda_log_softmax)(int n, const double *x, double *y);
+void FN_PROTOTYPE(vrda_log_softmax_batch)(int rows, int cols, const double *x, int ldx, double *y, int ldy);
+
+void FN_PROTOTYPE(vrsa_randnf)(int method, uint64_t seed, uint64_t offset, int len, float *dst);
+void FN_PROTOTYPE(vrda_randn)(int method, uint64_t seed, uint64_t offset, int len, double *dst);
+
+__m256 FN_PROTOTYPE(vrs8_rsqrtf)(__m256 x);
+__m512 FN_PROTOTYPE(vrs16_rsqrtf)(__m512 x);
+__m256d FN_PROTOTYPE(vrd4_rsqrt)(__m256d x);
+__m512d FN_PROTOTYPE(vrd8_rsqrt)(__m512d x);
+void FN_PROTOTYPE(vrsa_rsqrtf)(int n, const float *x, float *y);
+void FN_PROTOTYPE(vrda_rsqrt)(int n, const double *x, double *y);
+
+__m256 FN_PROTOTYPE(vrs8_rsqrt_fastf)(__m256 x);
+__m512 FN_PROTOTYPE(vrs16_rsqrt_fastf)(__m512 x);
+__m256d FN_PROTOTYPE(vrd4_rsqrt_fast)(__m256d x);
+__m512d FN_PROTOTYPE(vrd8_rsqrt_fast)(__m512d x);
+void FN_PROTOTYPE(vrsa_rsqrt_fastf)(int n, const float *x, float *y);
+void FN_PROTOTYPE(vrda_rsqrt_fast)(int n, const double *x, double *y);
+
+__m256d FN_PROTOTYPE(vrd4_rsqrt_cr)(__m256d x);
+__m512d FN_PROTOTYPE(vrd8_rsqrt_cr)(__m512d x);
+void FN_PROTOTYPE(vrda_rsqrt_cr)(int n, const double *x, double *y);
+
+__m256 FN_PROTOTYPE(vrs8_recipf)(__m256 x);
+__m512 FN_PROTOTYPE(vrs16_recipf)(__m512 x);
+__m256d FN_PROTOTYPE(vrd4_recip)(__m256d x);
+__m512d FN_PROTOTYPE(vrd8_recip)(__m512d x);
+void FN_PROTOTYPE(vrsa_recipf)(int n, const float *x, float *y);
+void FN_PROTOTYPE(vrda_recip)(int n, const double *x, double *y);
+
+__m256 FN_PROTOTYPE(vrs8_recip_fastf)(__m256 x);
+__m512 FN_PROTOTYPE(vrs16_recip_fastf)(__m512 x);
+__m256d FN_PROTOTYPE(vrd4_recip_fast)(__m256d x);
+__m512d FN_PROTOTYPE(vrd8_recip_fast)(__m512d x);
+void FN_PROTOTYPE(vrsa_recip_fastf)(int n, const float *x, float *y);
+void FN_PROTOTYPE(vrda_recip_fast)(int n, const double *x, double *y);
+
+void FN_PROTOTYPE(vrz4_cexp)(__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+void FN_PROTOTYPE(vrz8_cexp)(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+void FN_PROTOTYPE(vrc8_cexpf)(__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+void FN_PROTOTYPE(vrc16_cexpf)(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+void FN_PROTOTYPE(vrza_cexp)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_cexp_split)(int len, const double *xre, const double *xim, double *yre, double *yim);
+void FN_PROTOTYPE(vrca_cexpf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_cexpf_split)(int len, const float *xre, const float *xim, float *yre, float *yim);
+
+void FN_PROTOTYPE(vrz4_clog)(__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+void FN_PROTOTYPE(vrz8_clog)(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+void FN_PROTOTYPE(vrc8_clogf)(__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+void FN_PROTOTYPE(vrc16_clogf)(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+void FN_PROTOTYPE(vrza_clog)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_clog_split)(int len, const double *xre, const double *xim, double *yre, double *yim);
+void FN_PROTOTYPE(vrca_clogf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_clogf_split)(int len, const float *xre, const float *xim, float *yre, float *yim);
+
+void FN_PROTOTYPE(vrz4_cpow)(__m256d xre, __m256d xim, __m256d yre, __m256d yim, __m256d *zre, __m256d *zim);
+void FN_PROTOTYPE(vrz8_cpow)(__m512d xre, __m512d xim, __m512d yre, __m512d yim, __m512d *zre, __m512d *zim);
+void FN_PROTOTYPE(vrc8_cpowf)(__m256 xre, __m256 xim, __m256 yre, __m256 yim, __m256 *zre, __m256 *zim);
+void FN_PROTOTYPE(vrc16_cpowf)(__m512 xre, __m512 xim, __m512 yre, __m512 yim, __m512 *zre, __m512 *zim);
+void FN_PROTOTYPE(vrza_cpow)(int len, const double *x, const double *y, double *z);
+void FN_PROTOTYPE(vrza_cpow_split)(int len, const double *xre, const double *xim, const double *yre, const double *yim, double *zre, double *zim);
+void FN_PROTOTYPE(vrca_cpowf)(int len, const float *x, const float *y, float *z);
+void FN_PROTOTYPE(vrca_cpowf_split)(int len, const float *xre, const float *xim, const float *yre, const float *yim, float *zre, float *zim);
+
+void FN_PROTOTYPE(vrz4_csqrt)(__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+void FN_PROTOTYPE(vrz8_csqrt)(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+void FN_PROTOTYPE(vrc8_csqrtf)(__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+void FN_PROTOTYPE(vrc16_csqrtf)(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+void FN_PROTOTYPE(vrza_csqrt)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_csqrt_split)(int len, const double *xre, const double *xim, double *yre, double *yim);
+void FN_PROTOTYPE(vrca_csqrtf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_csqrtf_split)(int len, const float *xre, const float *xim, float *yre, float *yim);
+
+__m256d FN_PROTOTYPE(vrz4_cabs)(__m256d xre, __m256d xim);
+__m512d FN_PROTOTYPE(vrz8_cabs)(__m512d xre, __m512d xim);
+__m256 FN_PROTOTYPE(vrc8_cabsf)(__m256 xre, __m256 xim);
+__m512 FN_PROTOTYPE(vrc16_cabsf)(__m512 xre, __m512 xim);
+void FN_PROTOTYPE(vrza_cabs)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_cabs_split)(int len, const double *xre, const double *xim, double *y);
+void FN_PROTOTYPE(vrca_cabsf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_cabsf_split)(int len, const float *xre, const float *xim, float *y);
+
+__m256d FN_PROTOTYPE(vrz4_carg)(__m256d xre, __m256d xim);
+__m512d FN_PROTOTYPE(vrz8_carg)(__m512d xre, __m512d xim);
+__m256 FN_PROTOTYPE(vrc8_cargf)(__m256 xre, __m256 xim);
+__m512 FN_PROTOTYPE(vrc16_cargf)(__m512 xre, __m512 xim);
+void FN_PROTOTYPE(vrza_carg)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_carg_split)(int len, const double *xre, const double *xim, double *y);
+void FN_PROTOTYPE(vrca_cargf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_cargf_split)(int len, const float *xre, const float *xim, float *y);
+
+void FN_PROTOTYPE(vrz4_csin)(__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+void FN_PROTOTYPE(vrz8_csin)(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+void FN_PROTOTYPE(vrc8_csinf)(__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+void FN_PROTOTYPE(vrc16_csinf)(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+void FN_PROTOTYPE(vrza_csin)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_csin_split)(int len, const double *xre, const double *xim, double *yre, double *yim);
+void FN_PROTOTYPE(vrca_csinf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_csinf_split)(int len, const float *xre, const float *xim, float *yre, float *yim);
+
+void FN_PROTOTYPE(vrz4_ccos)(__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+void FN_PROTOTYPE(vrz8_ccos)(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+void FN_PROTOTYPE(vrc8_ccosf)(__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+void FN_PROTOTYPE(vrc16_ccosf)(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+void FN_PROTOTYPE(vrza_ccos)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_ccos_split)(int len, const double *xre, const double *xim, double *yre, double *yim);
+void FN_PROTOTYPE(vrca_ccosf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_ccosf_split)(int len, const float *xre, const float *xim, float *yre, float *yim);
+
+void FN_PROTOTYPE(vrz4_ctan)(__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+void FN_PROTOTYPE(vrz8_ctan)(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+void FN_PROTOTYPE(vrc8_ctanf)(__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+void FN_PROTOTYPE(vrc16_ctanf)(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+void FN_PROTOTYPE(vrza_ctan)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_ctan_split)(int len, const double *xre, const double *xim, double *yre, double *yim);
+void FN_PROTOTYPE(vrca_ctanf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_ctanf_split)(int len, const float *xre, const float *xim, float *yre, float *yim);
+
+void FN_PROTOTYPE(vrz4_csinh)(__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+void FN_PROTOTYPE(vrz8_csinh)(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+void FN_PROTOTYPE(vrc8_csinhf)(__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+void FN_PROTOTYPE(vrc16_csinhf)(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+void FN_PROTOTYPE(vrza_csinh)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_csinh_split)(int len, const double *xre, const double *xim, double *yre, double *yim);
+void FN_PROTOTYPE(vrca_csinhf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_csinhf_split)(int len, const float *xre, const float *xim, float *yre, float *yim);
+
+void FN_PROTOTYPE(vrz4_ccosh)(__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+void FN_PROTOTYPE(vrz8_ccosh)(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+void FN_PROTOTYPE(vrc8_ccoshf)(__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+void FN_PROTOTYPE(vrc16_ccoshf)(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+void FN_PROTOTYPE(vrza_ccosh)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_ccosh_split)(int len, const double *xre, const double *xim, double *yre, double *yim);
+void FN_PROTOTYPE(vrca_ccoshf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_ccoshf_split)(int len, const float *xre, const float *xim, float *yre, float *yim);
+
+void FN_PROTOTYPE(vrz4_ctanh)(__m256d xre, __m256d xim, __m256d *yre, __m256d *yim);
+void FN_PROTOTYPE(vrz8_ctanh)(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim);
+void FN_PROTOTYPE(vrc8_ctanhf)(__m256 xre, __m256 xim, __m256 *yre, __m256 *yim);
+void FN_PROTOTYPE(vrc16_ctanhf)(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim);
+void FN_PROTOTYPE(vrza_ctanh)(int len, const double *x, double *y);
+void FN_PROTOTYPE(vrza_ctanh_split)(int len, const double *xre, const double *xim, double *yre, double *yim);
+void FN_PROTOTYPE(vrca_ctanhf)(int len, const float *x, float *y);
+void FN_PROTOTYPE(vrca_ctanhf_split)(int len, const float *xre, const float *xim, float *yre, float *yim);
+
 #ifdef __cplusplus
 }
 #endif
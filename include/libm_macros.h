@@ -67,7 +67,16 @@
 #define __ALM_MAKE_PROTO(pfx, fn)                 pfx##_##fn
 
 #define ALM_PROTO_REF(fn)    		amd_ref_##fn
+/*
+ * src/fast is also built into libalm, with ALM_FAST_TIER, for the fast
+ * accuracy tier; its copies are renamed so as not to clash with libalmfast.
+ */
+#define ALM_PROTO_FAST_TIER(fn)		amd_fast_tier_##fn
+#if defined(ALM_FAST_TIER)
+#define ALM_PROTO_FAST(fn)   		ALM_PROTO_FAST_TIER(fn)
+#else
 #define ALM_PROTO_FAST(fn)   		amd_fast##fn
+#endif
 #define ALM_PROTO_KERN(fn)    		alm_kern_##fn
 
 /* 64-bit variants */
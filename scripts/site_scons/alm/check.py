@@ -173,6 +173,13 @@ def All(almenv):
         ctx.env['SUPPORTS_UNALIGNED_VEC_MOVE'] = ret
         return ret
 
+    def CheckAvx512Bf16(ctx):
+        # Without -mavx512bf16 the BF16 kernels fall back to emulated
+        # conversions (same as get_avx512bf16_flag in CMake)
+        ret = CheckCompilerFlag(ctx, '-mavx512bf16')
+        ctx.env['SUPPORTS_AVX512BF16'] = ret
+        return ret
+
     conf = env.Configure (
         help = False,
         custom_tests = {
@@ -182,6 +189,7 @@ def All(almenv):
             'CheckCPUIDInstall' :   CheckCPUIDInstall,
             'CheckZenVer'       : lambda ctx : CheckZenVer(ctx),
             'CheckUnalignedVectorMove' : lambda ctx : CheckUnalignedVectorMove(ctx),
+            'CheckAvx512Bf16'   : lambda ctx : CheckAvx512Bf16(ctx),
         },
         conf_dir = joinpath(env['BUILDDIR'], '.sconf_temp'),
     )
@@ -206,6 +214,8 @@ def All(almenv):
 
     conf.CheckUnalignedVectorMove()
 
+    conf.CheckAvx512Bf16()
+
     if not conf.CheckCPUIDInstall():
         Exit(1)
 
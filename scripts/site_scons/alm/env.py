@@ -235,6 +235,7 @@ class AlmEnvironment(object):
         abi        = opts.GetOption('libabi')
         arch_config = opts.GetOption('arch_config')
         use_asan    = opts.GetOption('use_asan')
+        use_stats   = opts.GetOption('use_stats')
         aocl_utils_install_path = opts.GetOption('aocl_utils_install_path')
         aocl_utils_link = opts.GetOption('aocl_utils_link')
 
@@ -259,6 +260,7 @@ class AlmEnvironment(object):
         env['libabi'] = abi
         env['arch_config'] = arch_config
         env['use_asan'] = use_asan
+        env['use_stats'] = use_stats
         env['aocl_utils_install_path'] = aocl_utils_install_path
         env['aocl_utils_link'] = aocl_utils_link
 
@@ -117,6 +117,14 @@ class AlmOptions(object):
                         help = "Compile to use address sanitizer"
         )
 
+        #per-function call and slow-path counters
+        self.add_option('use_stats',
+                        nargs = 1,
+                        default = 0,
+                        type =  int,
+                        help = "Compile with call and slow-path counters (ALM_STATS)"
+        )
+
         #provide libau_cpuid install path
         self.add_option('aocl_utils_install_path',
                         nargs = 1,
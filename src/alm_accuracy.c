@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Run time selection of accuracy tiers
+ *
+ * Implementation notes:
+ *
+ *    Every function family has one initializer in entry_pt_initializers[]
+ *    (src/iface.c), which points the dispatch pointers of its variants at
+ *    the implementations for the running CPU. A family with other tiers
+ *    carries their tables in alm_arch_funcs.tiers[]; switching a tier
+ *    re-runs the initializer with the tier wanted for each variant, and
+ *    libm_iface_reinit() reports the tier each variant actually got.
+ *
+ *    A variant follows the global tier unless alm_set_func_accuracy() gave
+ *    it one of its own. Variants are named as the public functions without
+ *    the amd_ prefix; the family is the name less its vector prefix and,
+ *    for binary32, its trailing 'f'.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <libm_macros.h>
+#include <libm/iface.h>
+#include <external/amdlibm_vec.h>
+
+#define ACC_NAME_MAX    64
+
+#ifndef ARRAY_SIZE
+#define ARRAY_SIZE(x) (sizeof(x) / sizeof((x)[0]))
+#endif
+
+static int acc_global = ALM_ACC_1ULP;
+
+/* tier asked for a variant plus one, 0 to follow acc_global */
+static signed char acc_req[C_AMD_LAST_ENTRY][ALM_FUNC_VAR_MAX];
+
+/* tier in effect, or -1 for no such variant; valid once acc_known */
+static int acc_got[C_AMD_LAST_ENTRY][ALM_FUNC_VAR_MAX];
+static char acc_known[C_AMD_LAST_ENTRY];
+
+static const struct {
+    const char *prefix;
+    int sp;                             /* binary32, name ends in 'f' */
+    alm_func_var_t var;
+} acc_vec_names[] = {
+    {"vrs4_",  1, ALM_FUNC_VECT_SP_4},
+    {"vrs8_",  1, ALM_FUNC_VECT_SP_8},
+    {"vrs16_", 1, ALM_FUNC_VECT_SP_16},
+    {"vrsa_",  1, ALM_FUNC_VECT_SP_ARR},
+    {"vrd2_",  0, ALM_FUNC_VECT_DP_2},
+    {"vrd4_",  0, ALM_FUNC_VECT_DP_4},
+    {"vrd8_",  0, ALM_FUNC_VECT_DP_8},
+    {"vrda_",  0, ALM_FUNC_VECT_DP_ARR},
+};
+
+/* family index and variant of a function name, -1 if there is none */
+static int
+acc_lookup(const char *name, int *var)
+{
+    char base[ACC_NAME_MAX];
+    size_t n;
+    int idx;
+
+    if (!name)
+        return -1;
+
+    for (size_t i = 0; i < ARRAY_SIZE(acc_vec_names); i++) {
+        size_t lp = strlen(acc_vec_names[i].prefix);
+
+        if (strncmp(name, acc_vec_names[i].prefix, lp) != 0)
+            continue;
+
+        n = strlen(name + lp);
+        if (n == 0 || n >= ACC_NAME_MAX)
+            return -1;
+
+        memcpy(base, name + lp, n + 1);
+        if (acc_vec_names[i].sp) {
+            if (base[n - 1] != 'f')
+                return -1;
+            base[n - 1] = '\0';
+        }
+
+        *var = acc_vec_names[i].var;
+        return libm_iface_find(base);
+    }
+
+    /* scalar: exp is binary64, expf binary32 */
+    idx = libm_iface_find(name);
+    if (idx >= 0) {
+        *var = ALM_FUNC_SCAL_DP;
+        return idx;
+    }
+
+    n = strlen(name);
+    if (n < 2 || n >= ACC_NAME_MAX || name[n - 1] != 'f')
+        return -1;
+
+    memcpy(base, name, n - 1);
+    base[n - 1] = '\0';
+    *var = ALM_FUNC_SCAL_SP;
+
+    return libm_iface_find(base);
+}
+
+/* re-initialize one family with the tiers currently asked for */
+static int
+acc_apply(int idx)
+{
+    int tier[ALM_FUNC_VAR_MAX];
+
+    for (int v = 0; v < ALM_FUNC_VAR_MAX; v++)
+        tier[v] = acc_req[idx][v] ? acc_req[idx][v] - 1 : acc_global;
+
+    if (libm_iface_reinit(idx, tier, acc_got[idx]) != 0)
+        return -1;
+
+    acc_known[idx] = 1;
+    return 0;
+}
+
+int
+alm_set_accuracy(alm_accuracy_t acc)
+{
+    if ((int)acc < ALM_ACC_TIER_1ULP || (int)acc >= ALM_ACC_TIER_MAX)
+        return -1;
+
+    acc_global = (int)acc;
+
+    for (int idx = 0; idx < C_AMD_LAST_ENTRY; idx++)
+        acc_apply(idx);
+
+    return 0;
+}
+
+alm_accuracy_t
+alm_get_accuracy(void)
+{
+    return (alm_accuracy_t)acc_global;
+}
+
+int
+alm_set_func_accuracy(const char *name, int acc)
+{
+    int var, idx = acc_lookup(name, &var);
+    signed char old;
+
+    if (idx < 0 || acc < -1 || acc >= ALM_ACC_TIER_MAX)
+        return -1;
+
+    old = acc_req[idx][var];
+    acc_req[idx][var] = (signed char)(acc + 1);
+
+    if (acc_apply(idx) != 0 || acc_got[idx][var] < 0) {
+        acc_req[idx][var] = old;
+        return -1;
+    }
+
+    return acc_got[idx][var];
+}
+
+int
+alm_get_func_accuracy(const char *name)
+{
+    int var, idx = acc_lookup(name, &var);
+
+    if (idx < 0)
+        return -1;
+
+    if (!acc_known[idx] && acc_apply(idx) != 0)
+        return -1;
+
+    return acc_got[idx][var];
+}
@@ -0,0 +1,379 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Argument capture
+ *
+ * Implementation notes:
+ *
+ *    AOCL_LIBM_CAPTURE=<file> turns capture on for the whole run; it is
+ *    read once, by the first alm_capture_fixup() call, which comes from
+ *    the constructor setting up the dispatch pointers. From then on
+ *    alm_capture_fixup() replaces the dispatch pointer of each variant
+ *    with a wrapper from the alm_capture section (include/libm/alm_capture.h),
+ *    also when an accuracy tier switch sets the pointer again.
+ *
+ *    Wrappers count calls per thread and record one in rate on average,
+ *    so the threads of a run are sampled alike without sharing a counter.
+ *    Records are appended under one lock; a variant is named in the trace
+ *    before its first call. The file is closed at exit, calls after that
+ *    are not recorded.
+ *
+ *    The scalar and array variants are wrapped here, the vector ones in
+ *    optimized/vec/capture.c and optimized/vec/avx512/capture.c, which are
+ *    built for their instruction sets.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libm_macros.h>
+#include <libm/alm_capture.h>
+
+#if defined(__GNUC__) && !defined(_WIN32)
+
+#include <pthread.h>
+
+extern struct alm_capture_fn __start_alm_capture[];
+extern struct alm_capture_fn __stop_alm_capture[];
+
+static pthread_once_t capture_once = PTHREAD_ONCE_INIT;
+static pthread_mutex_t capture_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static FILE *capture_file;
+static uint32_t capture_rate = 1000;
+static int capture_nnames;
+static __thread uint32_t capture_left;      /* calls until the next sample */
+static __thread uint32_t capture_seed;
+static __thread int capture_depth;          /* inside an array variant */
+
+static void
+capture_close(void)
+{
+    pthread_mutex_lock(&capture_lock);
+    if (capture_file)
+        fclose(capture_file);
+    capture_file = NULL;
+    pthread_mutex_unlock(&capture_lock);
+}
+
+static void
+capture_open(void)
+{
+    const char *path = getenv("AOCL_LIBM_CAPTURE");
+    const char *rate = getenv("AOCL_LIBM_CAPTURE_RATE");
+    struct alm_capture_hdr hdr;
+
+    if (!path || !*path)
+        return;
+
+    if (rate) {
+        unsigned long r = strtoul(rate, NULL, 10);
+        if (r > 0)
+            capture_rate = r > UINT32_MAX ? UINT32_MAX : (uint32_t)r;
+    }
+
+    capture_file = fopen(path, "wb");
+    if (!capture_file)
+        return;
+
+    memcpy(hdr.magic, ALM_CAPTURE_MAGIC, sizeof(hdr.magic));
+    hdr.version = ALM_CAPTURE_VERSION;
+    hdr.rate = capture_rate;
+    fwrite(&hdr, sizeof(hdr), 1, capture_file);
+
+    atexit(capture_close);
+}
+
+/*
+ * The gap to the next sample is drawn from 1 .. 2 * rate - 1, so that a
+ * program calling functions in a fixed pattern is not sampled in step with
+ * it. Calls an array variant makes through other entry points, e.g.
+ * vrda_exp through vrd4_exp, are neither counted nor recorded.
+ */
+static uint32_t
+capture_gap(void)
+{
+    if (!capture_seed)
+        capture_seed = (uint32_t)(uintptr_t)&capture_seed | 1;
+    capture_seed = capture_seed * 1664525u + 1013904223u;
+
+    return 1 + (uint32_t)(((uint64_t)capture_seed *
+                           (2 * (uint64_t)capture_rate - 1)) >> 32);
+}
+
+int
+alm_capture_sample(void)
+{
+    if (capture_depth)
+        return 0;
+
+    if (!capture_left)
+        capture_left = capture_gap();
+
+    if (--capture_left)
+        return 0;
+
+    capture_left = capture_gap();
+    return 1;
+}
+
+void
+alm_capture_nest(int d)
+{
+    capture_depth += d;
+}
+
+void
+alm_capture_record(struct alm_capture_fn *fn, uint32_t len,
+                   const void *x, const void *y)
+{
+    struct alm_capture_rec rec;
+    uint32_t nval = len < ALM_CAPTURE_MAX_VALUES ? len : ALM_CAPTURE_MAX_VALUES;
+
+    pthread_mutex_lock(&capture_lock);
+
+    if (!capture_file)
+        goto out;
+
+    if (fn->id < 0) {
+        size_t nf = strlen(fn->func) + 1, nv = strlen(fn->variant) + 1;
+
+        rec.tag = ALM_CAPTURE_TAG_NAME;
+        rec.id = (uint16_t)capture_nnames;
+        rec.len = (uint32_t)(2 + nf + nv);
+        rec.nval = 0;
+
+        fwrite(&rec, sizeof(rec), 1, capture_file);
+        fwrite(&fn->nargs, 1, 1, capture_file);
+        fwrite(&fn->esize, 1, 1, capture_file);
+        fwrite(fn->func, 1, nf, capture_file);
+        fwrite(fn->variant, 1, nv, capture_file);
+
+        fn->id = capture_nnames++;
+    }
+
+    rec.tag = ALM_CAPTURE_TAG_CALL;
+    rec.id = (uint16_t)fn->id;
+    rec.len = len;
+    rec.nval = nval;
+
+    fwrite(&rec, sizeof(rec), 1, capture_file);
+    fwrite(x, fn->esize, nval, capture_file);
+    if (fn->nargs > 1)
+        fwrite(y, fn->esize, nval, capture_file);
+
+out:
+    pthread_mutex_unlock(&capture_lock);
+}
+
+void
+alm_capture_fixup(alm_ep_func_t *ep)
+{
+    pthread_once(&capture_once, capture_open);
+    if (!capture_file)
+        return;
+
+    for (struct alm_capture_fn *fn = __start_alm_capture;
+         fn < __stop_alm_capture; fn++) {
+        if (fn->ep == ep) {
+            if (*ep != fn->wrap) {
+                fn->next = *ep;
+                *ep = fn->wrap;
+            }
+            return;
+        }
+    }
+}
+
+ALM_CAPTURE_SCALAR1(acos, "acos", "sd", double);
+ALM_CAPTURE_SCALAR1(acosf, "acos", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_acosf, "acos", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_acos, "acos", "vrda", double);
+ALM_CAPTURE_SCALAR1(asin, "asin", "sd", double);
+ALM_CAPTURE_SCALAR1(asinf, "asin", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_asinf, "asin", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_asin, "asin", "vrda", double);
+ALM_CAPTURE_SCALAR1(atan, "atan", "sd", double);
+ALM_CAPTURE_SCALAR1(atanf, "atan", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_atanf, "atan", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_atan, "atan", "vrda", double);
+ALM_CAPTURE_SCALAR1(acosh, "acosh", "sd", double);
+ALM_CAPTURE_SCALAR1(acoshf, "acosh", "ss", float);
+ALM_CAPTURE_SCALAR1(asinh, "asinh", "sd", double);
+ALM_CAPTURE_SCALAR1(asinhf, "asinh", "ss", float);
+ALM_CAPTURE_SCALAR1(atanh, "atanh", "sd", double);
+ALM_CAPTURE_SCALAR1(atanhf, "atanh", "ss", float);
+ALM_CAPTURE_SCALAR1(cos, "cos", "sd", double);
+ALM_CAPTURE_SCALAR1(cosf, "cos", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_cosf, "cos", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_cos, "cos", "vrda", double);
+ALM_CAPTURE_SCALAR1(sin, "sin", "sd", double);
+ALM_CAPTURE_SCALAR1(sinf, "sin", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_sinf, "sin", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_sin, "sin", "vrda", double);
+ALM_CAPTURE_SCALAR1(tan, "tan", "sd", double);
+ALM_CAPTURE_SCALAR1(tanf, "tan", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_tanf, "tan", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_tan, "tan", "vrda", double);
+ALM_CAPTURE_SCALAR1(cosh, "cosh", "sd", double);
+ALM_CAPTURE_SCALAR1(coshf, "cosh", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_coshf, "cosh", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_cosh, "cosh", "vrda", double);
+ALM_CAPTURE_SCALAR1(sinh, "sinh", "sd", double);
+ALM_CAPTURE_SCALAR1(sinhf, "sinh", "ss", float);
+ALM_CAPTURE_SCALAR1(tanh, "tanh", "sd", double);
+ALM_CAPTURE_SCALAR1(tanhf, "tanh", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_tanhf, "tanh", "vrsa", float);
+ALM_CAPTURE_SCALAR1(exp, "exp", "sd", double);
+ALM_CAPTURE_SCALAR1(expf, "exp", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_expf, "exp", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_exp, "exp", "vrda", double);
+ALM_CAPTURE_SCALAR1(exp2, "exp2", "sd", double);
+ALM_CAPTURE_SCALAR1(exp2f, "exp2", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_exp2f, "exp2", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_exp2, "exp2", "vrda", double);
+ALM_CAPTURE_SCALAR1(exp10, "exp10", "sd", double);
+ALM_CAPTURE_SCALAR1(exp10f, "exp10", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_exp10f, "exp10", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_exp10, "exp10", "vrda", double);
+ALM_CAPTURE_SCALAR1(expm1, "expm1", "sd", double);
+ALM_CAPTURE_SCALAR1(expm1f, "expm1", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_expm1f, "expm1", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_expm1, "expm1", "vrda", double);
+ALM_CAPTURE_SCALAR1(erf, "erf", "sd", double);
+ALM_CAPTURE_SCALAR1(erff, "erf", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_erff, "erf", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_erf, "erf", "vrda", double);
+ALM_CAPTURE_SCALAR1(erfc, "erfc", "sd", double);
+ALM_CAPTURE_SCALAR1(erfcf, "erfc", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_erfcf, "erfc", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_erfc, "erfc", "vrda", double);
+ALM_CAPTURE_SCALAR1(log, "log", "sd", double);
+ALM_CAPTURE_SCALAR1(logf, "log", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_logf, "log", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_log, "log", "vrda", double);
+ALM_CAPTURE_SCALAR1(log1p, "log1p", "sd", double);
+ALM_CAPTURE_SCALAR1(log1pf, "log1p", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_log1pf, "log1p", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_log1p, "log1p", "vrda", double);
+ALM_CAPTURE_SCALAR1(log2, "log2", "sd", double);
+ALM_CAPTURE_SCALAR1(log2f, "log2", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_log2f, "log2", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_log2, "log2", "vrda", double);
+ALM_CAPTURE_SCALAR1(log10, "log10", "sd", double);
+ALM_CAPTURE_SCALAR1(log10f, "log10", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_log10f, "log10", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_log10, "log10", "vrda", double);
+ALM_CAPTURE_SCALAR1(logb, "logb", "sd", double);
+ALM_CAPTURE_SCALAR1(logbf, "logb", "ss", float);
+ALM_CAPTURE_SCALAR1(cbrt, "cbrt", "sd", double);
+ALM_CAPTURE_SCALAR1(cbrtf, "cbrt", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_cbrtf, "cbrt", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_cbrt, "cbrt", "vrda", double);
+ALM_CAPTURE_SCALAR1(sqrt, "sqrt", "sd", double);
+ALM_CAPTURE_SCALAR1(sqrtf, "sqrt", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_sqrtf, "sqrt", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_sqrt, "sqrt", "vrda", double);
+ALM_CAPTURE_SCALAR1(fabs, "fabs", "sd", double);
+ALM_CAPTURE_SCALAR1(fabsf, "fabs", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_fabsf, "fabs", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_fabs, "fabs", "vrda", double);
+ALM_CAPTURE_SCALAR1(ceil, "ceil", "sd", double);
+ALM_CAPTURE_SCALAR1(ceilf, "ceil", "ss", float);
+ALM_CAPTURE_SCALAR1(floor, "floor", "sd", double);
+ALM_CAPTURE_SCALAR1(floorf, "floor", "ss", float);
+ALM_CAPTURE_SCALAR1(nearbyint, "nearbyint", "sd", double);
+ALM_CAPTURE_SCALAR1(nearbyintf, "nearbyint", "ss", float);
+ALM_CAPTURE_SCALAR1(rint, "rint", "sd", double);
+ALM_CAPTURE_SCALAR1(rintf, "rint", "ss", float);
+ALM_CAPTURE_SCALAR1(round, "round", "sd", double);
+ALM_CAPTURE_SCALAR1(roundf, "round", "ss", float);
+ALM_CAPTURE_ARRAY1(vrsa_roundf, "round", "vrsa", float);
+ALM_CAPTURE_ARRAY1(vrda_round, "round", "vrda", double);
+ALM_CAPTURE_SCALAR1(trunc, "trunc", "sd", double);
+ALM_CAPTURE_SCALAR1(truncf, "trunc", "ss", float);
+ALM_CAPTURE_SCALAR2(pow, "pow", "sd", double);
+ALM_CAPTURE_SCALAR2(powf, "pow", "ss", float);
+ALM_CAPTURE_ARRAY2(vrsa_powf, "pow", "vrsa", float);
+ALM_CAPTURE_ARRAY2(vrda_pow, "pow", "vrda", double);
+ALM_CAPTURE_SCALAR2(atan2, "atan2", "sd", double);
+ALM_CAPTURE_SCALAR2(atan2f, "atan2", "ss", float);
+ALM_CAPTURE_SCALAR2(hypot, "hypot", "sd", double);
+ALM_CAPTURE_SCALAR2(hypotf, "hypot", "ss", float);
+ALM_CAPTURE_SCALAR2(fmax, "fmax", "sd", double);
+ALM_CAPTURE_SCALAR2(fmaxf, "fmax", "ss", float);
+ALM_CAPTURE_ARRAY2(vrsa_fmaxf, "fmax", "vrsa", float);
+ALM_CAPTURE_ARRAY2(vrda_fmax, "fmax", "vrda", double);
+ALM_CAPTURE_SCALAR2(fmin, "fmin", "sd", double);
+ALM_CAPTURE_SCALAR2(fminf, "fmin", "ss", float);
+ALM_CAPTURE_ARRAY2(vrsa_fminf, "fmin", "vrsa", float);
+ALM_CAPTURE_ARRAY2(vrda_fmin, "fmin", "vrda", double);
+ALM_CAPTURE_SCALAR2(fdim, "fdim", "sd", double);
+ALM_CAPTURE_SCALAR2(fdimf, "fdim", "ss", float);
+ALM_CAPTURE_SCALAR2(fmod, "fmod", "sd", double);
+ALM_CAPTURE_SCALAR2(fmodf, "fmod", "ss", float);
+ALM_CAPTURE_SCALAR2(remainder, "remainder", "sd", double);
+ALM_CAPTURE_SCALAR2(remainderf, "remainder", "ss", float);
+ALM_CAPTURE_SCALAR2(copysign, "copysign", "sd", double);
+ALM_CAPTURE_SCALAR2(copysignf, "copysign", "ss", float);
+ALM_CAPTURE_SCALAR2(nextafter, "nextafter", "sd", double);
+ALM_CAPTURE_SCALAR2(nextafterf, "nextafter", "ss", float);
+ALM_CAPTURE_ARRAY2(vrsa_addf, "add", "vrsa", float);
+ALM_CAPTURE_ARRAY2(vrda_add, "add", "vrda", double);
+ALM_CAPTURE_ARRAY2(vrsa_subf, "sub", "vrsa", float);
+ALM_CAPTURE_ARRAY2(vrda_sub, "sub", "vrda", double);
+ALM_CAPTURE_ARRAY2(vrsa_mulf, "mul", "vrsa", float);
+ALM_CAPTURE_ARRAY2(vrda_mul, "mul", "vrda", double);
+
+#else   /* no capture */
+
+int
+alm_capture_sample(void)
+{
+    return 0;
+}
+
+void
+alm_capture_nest(int d)
+{
+}
+
+void
+alm_capture_record(struct alm_capture_fn *fn, uint32_t len,
+                   const void *x, const void *y)
+{
+}
+
+void
+alm_capture_fixup(alm_ep_func_t *ep)
+{
+}
+
+#endif
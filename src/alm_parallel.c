@@ -0,0 +1,386 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Parallel execution of the 64-bit length array functions
+ *
+ * Implementation notes:
+ *
+ *    A call of len elements is split into at most alm_get_num_threads()
+ *    contiguous partitions of at least alm_get_grain_size() elements. The
+ *    partition boundaries are rounded to ALM_PAR_ALIGN elements, so no two
+ *    tasks write to the same page of a float or double array.
+ *
+ *    The split only depends on len, the thread count and the grain size,
+ *    and the built-in pool always runs task t on the same worker (task 0
+ *    on the calling thread). Repeated calls over the same arrays therefore
+ *    touch each page from the same thread, which keeps memory first
+ *    touched by an identically partitioned initialization on the local
+ *    NUMA node.
+ *
+ *    The built-in pool starts its workers lazily, on the first call that
+ *    needs them, and parks them on a condition variable between calls.
+ *    Only one caller uses the pool at a time: a concurrent caller, or a
+ *    library call made from inside a task, runs serially instead of
+ *    waiting. A caller supplied executor replaces the pool entirely.
+ *
+ *    The settings may be changed while other threads are inside parallel
+ *    calls. The thread count and grain size are single words read once per
+ *    call. The executor and its context are only meaningful as a pair, so
+ *    they are published and read under par_cfg_lock: a call runs on the
+ *    pair that was current when it started, and never mixes the executor of
+ *    one alm_set_executor() with the context of another.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+  #include <Windows.h>
+#else
+  #include <pthread.h>
+  #include <unistd.h>
+  #define ALM_PAR_PTHREADS  1
+#endif
+
+#include <libm_macros.h>
+#include <libm/alm_parallel.h>
+#include <external/amdlibm_vec.h>
+
+#define ALM_PAR_MAX_THREADS 256
+#define ALM_PAR_GRAIN       ((size_t)1 << 16)
+#define ALM_PAR_ALIGN       ((size_t)1024)
+
+#if defined(_MSC_VER) && !defined(__clang__)
+  #define ALM_THREAD_LOCAL  __declspec(thread)
+  /* volatile word accesses are atomic on MSVC x86/x64 */
+  #define PAR_LOAD(v)       (*(volatile size_t *)&(v))
+  #define PAR_STORE(v, x)   (*(volatile size_t *)&(v) = (x))
+#else
+  #define ALM_THREAD_LOCAL  __thread
+  #define PAR_LOAD(v)       __atomic_load_n(&(v), __ATOMIC_RELAXED)
+  #define PAR_STORE(v, x)   __atomic_store_n(&(v), (x), __ATOMIC_RELAXED)
+#endif
+
+#if defined(ALM_PAR_PTHREADS)
+  static pthread_rwlock_t par_cfg_lock = PTHREAD_RWLOCK_INITIALIZER;
+  #define PAR_CFG_RDLOCK()    pthread_rwlock_rdlock(&par_cfg_lock)
+  #define PAR_CFG_RDUNLOCK()  pthread_rwlock_unlock(&par_cfg_lock)
+  #define PAR_CFG_WRLOCK()    pthread_rwlock_wrlock(&par_cfg_lock)
+  #define PAR_CFG_WRUNLOCK()  pthread_rwlock_unlock(&par_cfg_lock)
+#else
+  static SRWLOCK par_cfg_lock = SRWLOCK_INIT;
+  #define PAR_CFG_RDLOCK()    AcquireSRWLockShared(&par_cfg_lock)
+  #define PAR_CFG_RDUNLOCK()  ReleaseSRWLockShared(&par_cfg_lock)
+  #define PAR_CFG_WRLOCK()    AcquireSRWLockExclusive(&par_cfg_lock)
+  #define PAR_CFG_WRUNLOCK()  ReleaseSRWLockExclusive(&par_cfg_lock)
+#endif
+
+static size_t par_threads = 1;
+static size_t par_grain = ALM_PAR_GRAIN;
+
+/* Executor and its context, only accessed under par_cfg_lock */
+static alm_executor_t par_exec;
+static void *par_ctx;
+
+/* Set while the current thread runs a task, nested calls stay serial */
+static ALM_THREAD_LOCAL int par_active;
+
+struct par_job {
+    alm_par_body_t  body;
+    void           *arg;
+    size_t          len;
+    size_t          chunk;
+};
+
+static size_t
+par_online_cpus(void)
+{
+#if defined(ALM_PAR_PTHREADS)
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return n > 0 ? (size_t)n : 1;
+#else
+    SYSTEM_INFO info;
+
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors ? (size_t)info.dwNumberOfProcessors : 1;
+#endif
+}
+
+static void
+par_task(void *p, size_t t)
+{
+    const struct par_job *job = p;
+    size_t start = t * job->chunk;
+    size_t end = start + job->chunk;
+    int outer = par_active;
+
+    if (end > job->len)
+        end = job->len;
+
+    par_active = 1;
+    if (start < end)
+        job->body(job->arg, start, end);
+    par_active = outer;
+}
+
+static void
+par_run_serial(size_t ntasks, alm_task_t task, void *arg)
+{
+    size_t t;
+
+    for (t = 0; t < ntasks; t++)
+        task(arg, t);
+}
+
+#if defined(ALM_PAR_PTHREADS)
+
+static struct {
+    pthread_mutex_t  owner;        /* held by the caller using the pool */
+    pthread_mutex_t  lock;         /* protects the fields below */
+    pthread_cond_t   wake;
+    pthread_cond_t   done;
+    unsigned long    gen;          /* bumped for every published job */
+    unsigned long    born[ALM_PAR_MAX_THREADS];
+    size_t           nworkers;     /* workers 1..nworkers are running */
+    size_t           ntasks;
+    size_t           pending;
+    alm_task_t       task;
+    void            *arg;
+} pool = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER,
+    0, {0}, 0, 0, 0, NULL, NULL,
+};
+
+static pthread_once_t pool_once = PTHREAD_ONCE_INIT;
+
+/* Worker threads do not survive fork(), the child starts a fresh pool */
+static void
+pool_atfork_child(void)
+{
+    pthread_rwlock_init(&par_cfg_lock, NULL);
+    pthread_mutex_init(&pool.owner, NULL);
+    pthread_mutex_init(&pool.lock, NULL);
+    pthread_cond_init(&pool.wake, NULL);
+    pthread_cond_init(&pool.done, NULL);
+    pool.nworkers = 0;
+    pool.pending = 0;
+}
+
+static void
+pool_init(void)
+{
+    pthread_atfork(NULL, NULL, pool_atfork_child);
+}
+
+static void *
+pool_worker(void *p)
+{
+    size_t id = (size_t)(uintptr_t)p;
+    unsigned long seen;
+
+    pthread_mutex_lock(&pool.lock);
+    seen = pool.born[id];
+
+    for (;;) {
+        while (pool.gen == seen)
+            pthread_cond_wait(&pool.wake, &pool.lock);
+
+        seen = pool.gen;
+        if (id >= pool.ntasks)
+            continue;
+
+        alm_task_t task = pool.task;
+        void *arg = pool.arg;
+
+        pthread_mutex_unlock(&pool.lock);
+        task(arg, id);
+        pthread_mutex_lock(&pool.lock);
+
+        if (--pool.pending == 0)
+            pthread_cond_signal(&pool.done);
+    }
+
+    return NULL;
+}
+
+/* Starts workers up to 'want', returns the number actually running */
+static size_t
+pool_grow(size_t want)
+{
+    pthread_attr_t attr;
+    pthread_t tid;
+
+    if (want > ALM_PAR_MAX_THREADS - 1)
+        want = ALM_PAR_MAX_THREADS - 1;
+
+    if (pool.nworkers >= want)
+        return pool.nworkers;
+
+    pthread_once(&pool_once, pool_init);
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+
+    while (pool.nworkers < want) {
+        size_t id = pool.nworkers + 1;
+
+        pool.born[id] = pool.gen;
+        if (pthread_create(&tid, &attr, pool_worker, (void *)(uintptr_t)id))
+            break;
+        pool.nworkers = id;
+    }
+
+    pthread_attr_destroy(&attr);
+    return pool.nworkers;
+}
+
+static void
+pool_run(size_t ntasks, alm_task_t task, void *arg)
+{
+    size_t shared, t;
+
+    if (pthread_mutex_trylock(&pool.owner)) {
+        par_run_serial(ntasks, task, arg);
+        return;
+    }
+
+    pthread_mutex_lock(&pool.lock);
+
+    /* Tasks 1..shared-1 go to the workers, the rest stay on this thread */
+    shared = pool_grow(ntasks - 1) + 1;
+    if (shared > ntasks)
+        shared = ntasks;
+
+    pool.task = task;
+    pool.arg = arg;
+    pool.ntasks = shared;
+    pool.pending = shared - 1;
+    pool.gen++;
+    pthread_cond_broadcast(&pool.wake);
+    pthread_mutex_unlock(&pool.lock);
+
+    task(arg, 0);
+    for (t = shared; t < ntasks; t++)
+        task(arg, t);
+
+    pthread_mutex_lock(&pool.lock);
+    while (pool.pending)
+        pthread_cond_wait(&pool.done, &pool.lock);
+    pthread_mutex_unlock(&pool.lock);
+
+    pthread_mutex_unlock(&pool.owner);
+}
+
+#else
+
+/* No built-in pool on this platform, use alm_set_executor() */
+static void
+pool_run(size_t ntasks, alm_task_t task, void *arg)
+{
+    par_run_serial(ntasks, task, arg);
+}
+
+#endif
+
+void
+__alm_parallel_for(size_t len, alm_par_body_t body, void *arg)
+{
+    size_t nthreads = PAR_LOAD(par_threads), grain = PAR_LOAD(par_grain);
+    size_t ntasks;
+    alm_executor_t exec;
+    void *ctx;
+    struct par_job job;
+
+    if (nthreads <= 1 || par_active || len / grain < 2) {
+        body(arg, 0, len);
+        return;
+    }
+
+    ntasks = len / grain;
+    if (ntasks > nthreads)
+        ntasks = nthreads;
+
+    job.body = body;
+    job.arg = arg;
+    job.len = len;
+    job.chunk = (len + ntasks - 1) / ntasks;
+    job.chunk = (job.chunk + ALM_PAR_ALIGN - 1) & ~(ALM_PAR_ALIGN - 1);
+    ntasks = (len + job.chunk - 1) / job.chunk;
+
+    PAR_CFG_RDLOCK();
+    exec = par_exec;
+    ctx = par_ctx;
+    PAR_CFG_RDUNLOCK();
+
+    if (exec)
+        exec(ctx, ntasks, par_task, &job);
+    else
+        pool_run(ntasks, par_task, &job);
+}
+
+int
+alm_set_num_threads(int nthreads)
+{
+    size_t n;
+
+    if (nthreads < 0)
+        return -1;
+
+    n = nthreads ? (size_t)nthreads : par_online_cpus();
+    PAR_STORE(par_threads, n < ALM_PAR_MAX_THREADS ? n : ALM_PAR_MAX_THREADS);
+
+    return 0;
+}
+
+int
+alm_get_num_threads(void)
+{
+    return (int)PAR_LOAD(par_threads);
+}
+
+void
+alm_set_grain_size(size_t grain)
+{
+    PAR_STORE(par_grain, grain ? grain : ALM_PAR_GRAIN);
+}
+
+size_t
+alm_get_grain_size(void)
+{
+    return PAR_LOAD(par_grain);
+}
+
+void
+alm_set_executor(alm_executor_t exec, void *ctx)
+{
+    PAR_CFG_WRLOCK();
+    par_exec = exec;
+    par_ctx = ctx;
+    PAR_CFG_WRUNLOCK();
+}
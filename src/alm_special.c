@@ -76,6 +76,7 @@ float __alm_handle_errorf(uint64_t value, int flags)
 
 
 double alm_log_special(double y, U32 error_code) {
+    ALM_STATS_ERROR("log");
     flt64_t ym = {.d = y};
 
     switch (error_code) {
@@ -110,6 +111,7 @@ double alm_log_special(double y, U32 error_code) {
 float
 alm_acosf_special(float x, uint32_t code)
 {
+    ALM_STATS_ERROR("acosf");
     flt32_t fl = {.f = x};
     if (code == ALM_E_IN_X_NAN)
     {
@@ -130,6 +132,7 @@ alm_acosf_special(float x, uint32_t code)
 double
 alm_acos_special(double x, uint32_t code)
 {
+    ALM_STATS_ERROR("acos");
     flt64_t fl = {.d = x};
     if (code == ALM_E_IN_X_NAN)
     {
@@ -150,6 +153,7 @@ alm_acos_special(double x, uint32_t code)
 float
 alm_asinf_special(float x, uint32_t code)
 {
+    ALM_STATS_ERROR("asinf");
     flt32_t fl = {.f = x};
     if (code == ALM_E_IN_X_NAN)
     {
@@ -169,6 +173,7 @@ alm_asinf_special(float x, uint32_t code)
 
 float _atanf_special_overflow(float x)
 {
+    ALM_STATS_ERROR("atanf");
     UT32 xu;
     xu.f32 = x;
     return __alm_handle_errorf(xu.u32, AMD_F_OVERFLOW);
@@ -176,6 +181,7 @@ float _atanf_special_overflow(float x)
 
 double
 alm_atan_special(double x) {
+    ALM_STATS_ERROR("atan");
     flt64_t fl = {.d = x};
     return __alm_handle_error(fl.u, AMD_F_INVALID);
 }
@@ -183,6 +189,7 @@ alm_atan_special(double x) {
 double
 alm_asin_special(double x, uint32_t code)
 {
+    ALM_STATS_ERROR("asin");
     flt64_t fl = {.d = x};
     if (code == ALM_E_IN_X_NAN)
     {
@@ -279,6 +286,7 @@ double _sin_cos_special(double x, char *name, uint32_t code)
 
 void _sincosf_special(float x, float *sy, float *cy)
 {
+    ALM_STATS_ERROR("sincosf");
     float xu = _sinf_cosf_special(x, "sincosf", __amd_sin);
     *sy = xu;
     *cy = xu;
@@ -287,6 +295,7 @@ void _sincosf_special(float x, float *sy, float *cy)
 
 void _sincos_special(double x, double *sy, double *cy)
 {
+    ALM_STATS_ERROR("sincos");
     double xu = _sin_cos_special(x, "sincos", __amd_sin);
     *sy = xu;
     *cy = xu;
@@ -296,36 +305,43 @@ void _sincos_special(double x, double *sy, double *cy)
 /* trig functions */
 double _sin_special_underflow(double x)
 {
+    ALM_STATS_ERROR("sin");
     return _sincos_special_underflow(x, "sin", __amd_sin);
 }
 
 float _sinf_special(float x)
 {
+    ALM_STATS_ERROR("sinf");
     return _sinf_cosf_special(x, "sinf", __amd_sin);
 }
 
 double _sin_special(double x)
 {
+    ALM_STATS_ERROR("sin");
     return _sin_cos_special(x, "sin", __amd_sin);
 }
 
 float _cosf_special(float x)
 {
+    ALM_STATS_ERROR("cosf");
     return _sinf_cosf_special(x, "cosf",__amd_cos);
 }
 
 double _cos_special(double x)
 {
+    ALM_STATS_ERROR("cos");
     return _sin_cos_special(x, "cos",__amd_cos);
 }
 
 double _tan_special(double x)
 {
+    ALM_STATS_ERROR("tan");
     return _sin_cos_special(x, "tan", __amd_tan);
 }
 
 float _tanf_special(float x)
 {
+    ALM_STATS_ERROR("tanf");
 
     UT32 xu = {.f32 = x};
     if ((xu.u32 & ~SIGNBIT_SP32) < 0x39000000) {
@@ -336,6 +352,7 @@ float _tanf_special(float x)
 
 float _tanhf_special(float x)
 {
+    ALM_STATS_ERROR("tanhf");
     UT32 xu = {.f32 = x};
     return __alm_handle_errorf(xu.u32, AMD_F_INEXACT|AMD_F_UNDERFLOW);
 }
@@ -343,6 +360,7 @@ float _tanhf_special(float x)
 /*fabs*/
 double _fabs_special(double x)
 {
+    ALM_STATS_ERROR("fabs");
     UT64 xu;
     xu.f64 = x;
 
@@ -362,6 +380,7 @@ double _fabs_special(double x)
 
 float _fabsf_special(float x)
 {
+    ALM_STATS_ERROR("fabsf");
     UT32 xu;
     xu.f32 = x;
 
@@ -381,6 +400,7 @@ float _fabsf_special(float x)
 
 double _cbrt_special(double x)
 {
+    ALM_STATS_ERROR("cbrt");
     UT64 xu;
     xu.f64 = x;
 
@@ -390,6 +410,7 @@ double _cbrt_special(double x)
 
 float _cbrtf_special(float x)
 {
+    ALM_STATS_ERROR("cbrtf");
     UT32 xu;
     xu.f32 = x;
 
@@ -400,6 +421,7 @@ float _cbrtf_special(float x)
 
 /* exp, log, pow*/
 float alm_expf_special(float y, U32 code) {
+    ALM_STATS_ERROR("expf");
     flt32_t ym = {.f = y};
 
     switch (code) {
@@ -425,6 +447,7 @@ float alm_expf_special(float y, U32 code) {
 }
 
 double alm_exp_special(double y, U32 code) {
+    ALM_STATS_ERROR("exp");
     flt64_t ym = {.d = y};
 
     switch (code) {
@@ -444,6 +467,7 @@ double alm_exp_special(double y, U32 code) {
 }
 
 double alm_expm1_special(double y, U32 code) {
+    ALM_STATS_ERROR("expm1");
     flt64_t ym = {.d = y};
 
     switch (code)
@@ -462,6 +486,7 @@ double alm_expm1_special(double y, U32 code) {
 }
 
 double alm_nextafter_special(double y, U32 code) {
+    ALM_STATS_ERROR("nextafter");
     flt64_t ym = {.d = y};
 
     switch (code)
@@ -488,6 +513,7 @@ double alm_nextafter_special(double y, U32 code) {
 }
 
 float alm_nextafterf_special(float y, U32 code) {
+    ALM_STATS_ERROR("nextafterf");
     flt32_t ym = {.f = y};
 
     switch (code)
@@ -525,6 +551,7 @@ float alm_nextafterf_special(float y, U32 code) {
 #define POW_Z_INF                   9
 
 double alm_pow_special(double z, U32 code) {
+    ALM_STATS_ERROR("pow");
     flt64_t zu = {.d = z};
 
     switch (code) {
@@ -556,6 +583,7 @@ double alm_pow_special(double z, U32 code) {
 }
 
 float alm_powf_special(float z, U32 code) {
+    ALM_STATS_ERROR("powf");
     flt32_t zu = {.f = z};
 
     switch (code) {
@@ -590,6 +618,7 @@ float alm_powf_special(float z, U32 code) {
 #define LOG_X_NEG       2
 #define LOG_X_NAN       3
 float alm_logf_special(float y, U32 errorCode) {
+    ALM_STATS_ERROR("logf");
     flt32_t ym = {.f = y};
 
     switch (errorCode) {
@@ -619,6 +648,7 @@ float alm_logf_special(float y, U32 errorCode) {
 
 /* coshf */
 float alm_coshf_special(float y, U32 errorCode) {
+    ALM_STATS_ERROR("coshf");
     flt32_t ym = {.f = y};
 
     switch (errorCode) {
@@ -633,6 +663,7 @@ float alm_coshf_special(float y, U32 errorCode) {
 
 double _nearbyint_special(double x)
 {
+    ALM_STATS_ERROR("nearbyint");
     UT64 checkbits;
     checkbits.f64 = x;
 
@@ -663,6 +694,7 @@ double _nearbyint_special(double x)
 
 float _truncf_special(float x, float r)
 {
+    ALM_STATS_ERROR("truncf");
     UT64 rm;
     rm.u64 = 0;
     rm.f32[0] = r;
@@ -672,6 +704,7 @@ float _truncf_special(float x, float r)
 
 double _trunc_special(double x, double r)
 {
+    ALM_STATS_ERROR("trunc");
     UT64 rm;
     rm.f64 = r;
     __alm_handle_error(rm.u64, 0);
@@ -680,6 +713,7 @@ double _trunc_special(double x, double r)
 
 double _round_special(double x, double r)
 {
+    ALM_STATS_ERROR("round");
     UT64 rm;
     rm.f64 = r;
     __alm_handle_error(rm.u64, 0);
@@ -688,6 +722,7 @@ double _round_special(double x, double r)
 
 float _fdimf_special(float x, float y, float r)
 {
+    ALM_STATS_ERROR("fdimf");
     UT64 rm;
     rm.u64 = 0;
     rm.f32[0] = r;
@@ -697,6 +732,7 @@ float _fdimf_special(float x, float y, float r)
 
 double _fdim_special(double x, double y, double r)
 {
+    ALM_STATS_ERROR("fdim");
     UT64 rm;
     rm.f64 = r;
     __alm_handle_error(rm.u64, 0);
@@ -705,6 +741,7 @@ double _fdim_special(double x, double y, double r)
 
 double _fmax_special(double x, double y)
 {
+    ALM_STATS_ERROR("fmax");
     UT64 xu, yu;
     xu.f64 = x;
     yu.f64 = y;
@@ -725,6 +762,7 @@ double _fmax_special(double x, double y)
 
 float _fmaxf_special(float x, float y)
 {
+    ALM_STATS_ERROR("fmaxf");
     UT32 xu, yu;
     xu.f32 = x;
     yu.f32 = y;
@@ -745,6 +783,7 @@ float _fmaxf_special(float x, float y)
 
 double _fmin_special(double x, double y)
 {
+    ALM_STATS_ERROR("fmin");
     UT64 xu, yu;
     xu.f64 = x;
     yu.f64 = y;
@@ -765,6 +804,7 @@ double _fmin_special(double x, double y)
 
 float _fminf_special(float x, float y)
 {
+    ALM_STATS_ERROR("fminf");
     UT32 xu, yu;
     xu.f32 = x;
     yu.f32 = y;
@@ -788,6 +828,7 @@ float _fminf_special(float x, float y)
 #define REMAINDER_X_DIVIDEND_INF      3
 float _remainderf_special(float x, float y, U32 errorCode)
 {
+    ALM_STATS_ERROR("remainderf");
     switch (errorCode) {
         /*All the three conditions are considered to be the same
            for Windows. It might be different for Linux.
@@ -819,6 +860,7 @@ float _remainderf_special(float x, float y, U32 errorCode)
 
 double _remainder_special(double x, double y, U32 errorCode)
 {
+    ALM_STATS_ERROR("remainder");
     switch (errorCode) {
         /*All the three conditions are considered to be the same
            for Windows. It might be different for Linux.
@@ -850,6 +892,7 @@ double _remainder_special(double x, double y, U32 errorCode)
 
 double _fmod_special(double x, double y, U32 errorCode)
 {
+    ALM_STATS_ERROR("fmod");
     switch (errorCode) {
         /*All the three conditions are considered to be the same
            for Windows. It might be different for Linux.
@@ -881,6 +924,7 @@ double _fmod_special(double x, double y, U32 errorCode)
 
 float _fmodf_special(float x, float y, U32 errorCode)
 {
+    ALM_STATS_ERROR("fmodf");
     switch (errorCode) {
         /*All the three conditions are considered to be the same
            for Windows. It might be different for Linux.
@@ -912,6 +956,7 @@ float _fmodf_special(float x, float y, U32 errorCode)
 }
 
 double alm_ldexp_special(double y, U32 code) {
+    ALM_STATS_ERROR("ldexp");
     flt64_t ym = {.d = y};
 
     switch (code) {
@@ -932,6 +977,7 @@ double alm_ldexp_special(double y, U32 code) {
 
 /* cexp - complex exponential */
 fc64_t alm_cexp_special(fc64_t z, uint32_t code) {
+    ALM_STATS_ERROR("cexp");
     double re = creal(z);
     flt64_t rem = {.d = re};
 
@@ -968,6 +1014,7 @@ fc64_t alm_cexp_special(fc64_t z, uint32_t code) {
 }
 
 fc32_t alm_cexpf_special(fc32_t z, uint32_t code) {
+    ALM_STATS_ERROR("cexpf");
     float re = crealf(z);
     flt32_t rem = {.f = re};
 
@@ -1003,11 +1050,13 @@ fc32_t alm_cexpf_special(fc32_t z, uint32_t code) {
     #endif
 }
 double alm_erfcinv_special(double x) {
+    ALM_STATS_ERROR("erfcinv");
     flt64_t fl = {.d = x};
     return __alm_handle_error(fl.u, AMD_F_INVALID);
 }
 
 double alm_cdfnorminv_special(double x) {
+    ALM_STATS_ERROR("cdfnorminv");
     flt64_t fl = {.d = x};
     return __alm_handle_error(fl.u, AMD_F_INVALID);
 }
@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Call and slow-path counters
+ *
+ * Implementation notes:
+ *
+ *    Built with ALM_STATS, every counting site is a struct alm_stats_site
+ *    in the alm_stats section (include/libm/alm_stats.h). Sites of the
+ *    entry points are named after the function, the others after their
+ *    source file; both are folded into one row per name, so "vrd4_exp"
+ *    gathers the calls of amd_vrd4_exp and the fallback lanes counted in
+ *    vrd4_exp.c. Rows are built once, sorted by name, and chain their
+ *    sites through stats_next[].
+ *
+ *    Elements are counted by the array entry points; for the vector and
+ *    scalar ones they are the calls times the lanes in the name.
+ *
+ *    Counters are read and reset without stopping the threads updating
+ *    them, a concurrent update can land on either side of a reset.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <libm_macros.h>
+#include <libm/compiler.h>
+#include <libm/alm_stats.h>
+#include <external/amdlibm_vec.h>
+
+#if defined(ALM_STATS)
+
+#include <pthread.h>
+
+#define STATS_NAME_MAX  48
+
+extern struct alm_stats_site __start_alm_stats[];
+extern struct alm_stats_site __stop_alm_stats[];
+
+static pthread_once_t stats_once = PTHREAD_ONCE_INIT;
+
+static int stats_nrows;
+static char (*stats_names)[STATS_NAME_MAX];  /* per row */
+static int *stats_first;                     /* per row, first site */
+static int *stats_next;                      /* per site, next of its row */
+static int *stats_row;                       /* per site */
+
+static int
+stats_nsites(void)
+{
+    return (int)(__stop_alm_stats - __start_alm_stats);
+}
+
+/* function name of a site: the name itself, or the file name less .c */
+static void
+stats_site_name(const struct alm_stats_site *site, char *buf)
+{
+    const char *s = site->name, *slash = strrchr(s, '/');
+    size_t n;
+
+    if (slash)
+        s = slash + 1;
+
+    n = strlen(s);
+    if (n > 2 && strcmp(s + n - 2, ".c") == 0)
+        n -= 2;
+    if (n >= STATS_NAME_MAX)
+        n = STATS_NAME_MAX - 1;
+
+    memcpy(buf, s, n);
+    buf[n] = '\0';
+}
+
+static int
+stats_cmp(const void *a, const void *b)
+{
+    return strcmp(a, b);
+}
+
+static void
+stats_build(void)
+{
+    int nsites = stats_nsites();
+    char (*names)[STATS_NAME_MAX];
+
+    names = calloc((size_t)nsites + 1, STATS_NAME_MAX);
+    stats_first = calloc((size_t)nsites + 1, sizeof(int));
+    stats_next = calloc((size_t)nsites + 1, sizeof(int));
+    stats_row = calloc((size_t)nsites + 1, sizeof(int));
+    if (!names || !stats_first || !stats_next || !stats_row)
+        return;
+
+    /* distinct names, sorted */
+    for (int i = 0; i < nsites; i++)
+        stats_site_name(&__start_alm_stats[i], names[i]);
+
+    qsort(names, (size_t)nsites, STATS_NAME_MAX, stats_cmp);
+
+    for (int i = 0; i < nsites; i++)
+        if (stats_nrows == 0 || strcmp(names[i], names[stats_nrows - 1]) != 0)
+            memmove(names[stats_nrows++], names[i], STATS_NAME_MAX);
+
+    for (int r = 0; r < stats_nrows; r++)
+        stats_first[r] = -1;
+
+    for (int i = nsites - 1; i >= 0; i--) {
+        char key[STATS_NAME_MAX];
+        char (*row)[STATS_NAME_MAX];
+
+        stats_site_name(&__start_alm_stats[i], key);
+        row = bsearch(key, names, (size_t)stats_nrows, STATS_NAME_MAX,
+                      stats_cmp);
+
+        stats_row[i] = (int)(row - names);
+        stats_next[i] = stats_first[stats_row[i]];
+        stats_first[stats_row[i]] = i;
+    }
+
+    stats_names = names;
+}
+
+/* lanes of a vector variant, 1 for scalar, 0 for arrays and the rest */
+static uint64_t
+stats_lanes(const char *name)
+{
+    if (name[0] != 'v' || name[1] != 'r')
+        return 1;
+
+    if ((name[2] == 's' || name[2] == 'd') && name[3] >= '1' && name[3] <= '9')
+        return (uint64_t)strtoul(name + 3, NULL, 10);
+
+    return 0;
+}
+
+static void
+stats_row_get(int r, alm_stats_t *st)
+{
+    uint64_t c[ALM_STATS_NCTR] = { 0 };
+
+    for (int i = stats_first[r]; i >= 0; i = stats_next[i]) {
+        struct alm_stats_site *site = &__start_alm_stats[i];
+
+        for (int s = 0; s < ALM_STATS_STRIPES; s++)
+            for (int k = 0; k < ALM_STATS_NCTR; k++)
+                c[k] += __atomic_load_n(&site->ctr[s][k], __ATOMIC_RELAXED);
+    }
+
+    st->name       = stats_names[r];
+    st->calls      = c[ALM_STATS_CALLS];
+    st->elements   = c[ALM_STATS_ELEMS] + c[ALM_STATS_CALLS] * stats_lanes(st->name);
+    st->special    = c[ALM_STATS_SPECIAL];
+    st->reductions = c[ALM_STATS_REDUCE];
+    st->errors     = c[ALM_STATS_ERROR];
+}
+
+int
+alm_stats_get(alm_stats_t *stats, int n)
+{
+    int count = 0;
+
+    pthread_once(&stats_once, stats_build);
+    if (!stats_names)
+        return -1;
+
+    for (int r = 0; r < stats_nrows; r++) {
+        alm_stats_t st;
+
+        stats_row_get(r, &st);
+        if (!st.calls && !st.special && !st.reductions && !st.errors)
+            continue;
+
+        if (stats && count < n)
+            stats[count] = st;
+        count++;
+    }
+
+    return count;
+}
+
+void
+alm_stats_reset(void)
+{
+    int nsites = stats_nsites();
+
+    for (int i = 0; i < nsites; i++)
+        for (int s = 0; s < ALM_STATS_STRIPES; s++)
+            for (int k = 0; k < ALM_STATS_NCTR; k++)
+                __atomic_store_n(&__start_alm_stats[i].ctr[s][k], 0,
+                                 __ATOMIC_RELAXED);
+}
+
+int
+alm_stats_dump(const char *path)
+{
+    FILE *f = stderr;
+
+    pthread_once(&stats_once, stats_build);
+    if (!stats_names)
+        return -1;
+
+    if (path && *path && !(f = fopen(path, "w")))
+        return -1;
+
+    fprintf(f, "%-24s %16s %16s %14s %12s %12s\n", "function", "calls",
+            "elements", "special", "reductions", "errors");
+
+    for (int r = 0; r < stats_nrows; r++) {
+        alm_stats_t st;
+
+        stats_row_get(r, &st);
+        if (!st.calls && !st.special && !st.reductions && !st.errors)
+            continue;
+
+        fprintf(f, "%-24s %16llu %16llu %14llu %12llu %12llu\n", st.name,
+                (unsigned long long)st.calls, (unsigned long long)st.elements,
+                (unsigned long long)st.special,
+                (unsigned long long)st.reductions,
+                (unsigned long long)st.errors);
+    }
+
+    if (f != stderr)
+        fclose(f);
+    else
+        fflush(f);
+
+    return 0;
+}
+
+/* AOCL_LIBM_STATS=1 (or stderr) or =<file> dumps the counters at exit */
+static void
+stats_atexit(void)
+{
+    const char *env = getenv("AOCL_LIBM_STATS");
+
+    if (strcmp(env, "1") == 0 || strcmp(env, "stderr") == 0)
+        env = NULL;
+
+    alm_stats_dump(env);
+}
+
+INITIALIZER(stats_init)
+{
+    const char *env = getenv("AOCL_LIBM_STATS");
+
+    if (env && *env && strcmp(env, "0") != 0)
+        atexit(stats_atexit);
+}
+
+#else   /* ALM_STATS */
+
+int
+alm_stats_get(alm_stats_t *stats, int n)
+{
+    return -1;
+}
+
+void
+alm_stats_reset(void)
+{
+}
+
+int
+alm_stats_dump(const char *path)
+{
+    return -1;
+}
+
+#endif  /* ALM_STATS */
@@ -159,6 +159,10 @@ alm_func_t        G_ENTRY_PT_PTR(tanhf);
 alm_func_t        G_ENTRY_PT_PTR(tanpif);
 alm_func_t        G_ENTRY_PT_PTR(truncf);
 alm_func_t        G_ENTRY_PT_PTR(erff);
+alm_func_t        G_ENTRY_PT_PTR(erfinvf);
+alm_func_t        G_ENTRY_PT_PTR(erfcinvf);
+alm_func_t        G_ENTRY_PT_PTR(cdfnormf);
+alm_func_t        G_ENTRY_PT_PTR(cdfnorminvf);
 alm_func_t        G_ENTRY_PT_PTR(erfcf);
 
 /*
@@ -170,6 +174,24 @@ alm_func_t        G_ENTRY_PT_PTR(clogf);
 alm_func_t        G_ENTRY_PT_PTR(clog);
 alm_func_t        G_ENTRY_PT_PTR(cpowf);
 alm_func_t        G_ENTRY_PT_PTR(cpow);
+alm_func_t        G_ENTRY_PT_PTR(csqrtf);
+alm_func_t        G_ENTRY_PT_PTR(csqrt);
+alm_func_t        G_ENTRY_PT_PTR(cabsf);
+alm_func_t        G_ENTRY_PT_PTR(cabs);
+alm_func_t        G_ENTRY_PT_PTR(cargf);
+alm_func_t        G_ENTRY_PT_PTR(carg);
+alm_func_t        G_ENTRY_PT_PTR(csinf);
+alm_func_t        G_ENTRY_PT_PTR(csin);
+alm_func_t        G_ENTRY_PT_PTR(ccosf);
+alm_func_t        G_ENTRY_PT_PTR(ccos);
+alm_func_t        G_ENTRY_PT_PTR(ctanf);
+alm_func_t        G_ENTRY_PT_PTR(ctan);
+alm_func_t        G_ENTRY_PT_PTR(csinhf);
+alm_func_t        G_ENTRY_PT_PTR(csinh);
+alm_func_t        G_ENTRY_PT_PTR(ccoshf);
+alm_func_t        G_ENTRY_PT_PTR(ccosh);
+alm_func_t        G_ENTRY_PT_PTR(ctanhf);
+alm_func_t        G_ENTRY_PT_PTR(ctanh);
 
 /*
  * Integer variants
@@ -219,6 +241,7 @@ alm_func_t        G_ENTRY_PT_PTR(vrda_divi);
 alm_func_t        G_ENTRY_PT_PTR(vrda_fmaxi);
 alm_func_t        G_ENTRY_PT_PTR(vrda_fmini);
 alm_func_t        G_ENTRY_PT_PTR(vrda_powx);
+alm_func_t        G_ENTRY_PT_PTR(vrda_powi);
 
 alm_func_t        G_ENTRY_PT_PTR(vrsa_cosf);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_expf);
@@ -252,12 +275,17 @@ alm_func_t        G_ENTRY_PT_PTR(vrsa_divfi);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_fmaxfi);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_fminfi);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_powxf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_powif);
 
 alm_func_t        G_ENTRY_PT_PTR(vrsa_acosf);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_asinf);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_atanf);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_coshf);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_erff);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_erfinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_erfcinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_cdfnormf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_cdfnorminvf);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_tanhf);
 alm_func_t        G_ENTRY_PT_PTR(vrsa_tanf);
 alm_func_t        G_ENTRY_PT_PTR(vrda_atan);
@@ -294,6 +322,10 @@ alm_func_t        G_ENTRY_PT_PTR(vrs4_powxf);
 alm_func_t        G_ENTRY_PT_PTR(vrs4_asinf);
 alm_func_t        G_ENTRY_PT_PTR(vrs4_atanf);
 alm_func_t        G_ENTRY_PT_PTR(vrs4_erff);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_erfinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_erfcinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_cdfnormf);
+alm_func_t        G_ENTRY_PT_PTR(vrs4_cdfnorminvf);
 alm_func_t        G_ENTRY_PT_PTR(vrs4_fabsf);
 alm_func_t        G_ENTRY_PT_PTR(vrs4_sqrtf);
 alm_func_t        G_ENTRY_PT_PTR(vrs4_linearfracf);
@@ -317,6 +349,10 @@ alm_func_t        G_ENTRY_PT_PTR(vrs8_powxf);
 alm_func_t        G_ENTRY_PT_PTR(vrs8_log2f);
 alm_func_t        G_ENTRY_PT_PTR(vrs8_asinf);
 alm_func_t        G_ENTRY_PT_PTR(vrs8_erff);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_erfinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_erfcinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_cdfnormf);
+alm_func_t        G_ENTRY_PT_PTR(vrs8_cdfnorminvf);
 alm_func_t        G_ENTRY_PT_PTR(vrs8_fabsf);
 alm_func_t        G_ENTRY_PT_PTR(vrs8_sqrtf);
 alm_func_t        G_ENTRY_PT_PTR(vrs8_linearfracf);
@@ -327,6 +363,10 @@ alm_func_t        G_ENTRY_PT_PTR(vrs8_roundf);
 alm_func_t        G_ENTRY_PT_PTR(vrs16_logf);
 alm_func_t        G_ENTRY_PT_PTR(vrs16_expf);
 alm_func_t        G_ENTRY_PT_PTR(vrs16_erff);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_erfinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_erfcinvf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_cdfnormf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_cdfnorminvf);
 alm_func_t        G_ENTRY_PT_PTR(vrs16_sinf);
 alm_func_t        G_ENTRY_PT_PTR(vrs16_asinf);
 alm_func_t        G_ENTRY_PT_PTR(vrs16_exp2f);
@@ -433,6 +473,250 @@ alm_func_t        G_ENTRY_PT_PTR(vrd2_asin);
 alm_func_t        G_ENTRY_PT_PTR(vrd4_asin);
 alm_func_t        G_ENTRY_PT_PTR(vrda_asin);
 
+alm_func_t        G_ENTRY_PT_PTR(expf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_expf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_expf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_expf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_expf16);
+
+alm_func_t        G_ENTRY_PT_PTR(logf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_logf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_logf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_logf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_logf16);
+
+alm_func_t        G_ENTRY_PT_PTR(sqrtf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_sqrtf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_sqrtf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_sqrtf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_sqrtf16);
+
+alm_func_t        G_ENTRY_PT_PTR(tanhf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_tanhf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_tanhf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_tanhf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_tanhf16);
+
+alm_func_t        G_ENTRY_PT_PTR(erff16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_erff16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_erff16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_erff16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_erff16);
+
+alm_func_t        G_ENTRY_PT_PTR(sinf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_sinf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_sinf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_sinf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_sinf16);
+
+alm_func_t        G_ENTRY_PT_PTR(cosf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh8_cosf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh16_cosf16);
+alm_func_t        G_ENTRY_PT_PTR(vrh32_cosf16);
+alm_func_t        G_ENTRY_PT_PTR(vrha_cosf16);
+
+alm_func_t        G_ENTRY_PT_PTR(vrba_expbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_logbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_tanhbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_erfbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_sigmoidbf16);
+alm_func_t        G_ENTRY_PT_PTR(vrba_gelubf16);
+
+alm_func_t        G_ENTRY_PT_PTR(vrs8_sigmoidf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_sigmoidf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_sigmoidf);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_sigmoid);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_sigmoid);
+alm_func_t        G_ENTRY_PT_PTR(vrda_sigmoid);
+
+alm_func_t        G_ENTRY_PT_PTR(vrs8_softplusf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_softplusf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_softplusf);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_softplus);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_softplus);
+alm_func_t        G_ENTRY_PT_PTR(vrda_softplus);
+
+alm_func_t        G_ENTRY_PT_PTR(vrs8_geluf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_geluf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_geluf);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_gelu);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_gelu);
+alm_func_t        G_ENTRY_PT_PTR(vrda_gelu);
+
+alm_func_t        G_ENTRY_PT_PTR(vrs8_gelu_tanhf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_gelu_tanhf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_gelu_tanhf);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_gelu_tanh);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_gelu_tanh);
+alm_func_t        G_ENTRY_PT_PTR(vrda_gelu_tanh);
+
+alm_func_t        G_ENTRY_PT_PTR(vrs8_siluf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_siluf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_siluf);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_silu);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_silu);
+alm_func_t        G_ENTRY_PT_PTR(vrda_silu);
+
+alm_func_t        G_ENTRY_PT_PTR(vrs8_mishf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_mishf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_mishf);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_mish);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_mish);
+alm_func_t        G_ENTRY_PT_PTR(vrda_mish);
+
+alm_func_t        G_ENTRY_PT_PTR(vrsa_softmaxf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_softmax_batchf);
+alm_func_t        G_ENTRY_PT_PTR(vrda_softmax);
+alm_func_t        G_ENTRY_PT_PTR(vrda_softmax_batch);
+
+alm_func_t        G_ENTRY_PT_PTR(vrsa_log_softmaxf);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_log_softmax_batchf);
+alm_func_t        G_ENTRY_PT_PTR(vrda_log_softmax);
+alm_func_t        G_ENTRY_PT_PTR(vrda_log_softmax_batch);
+
+alm_func_t        G_ENTRY_PT_PTR(vrsa_randnf);
+alm_func_t        G_ENTRY_PT_PTR(vrda_randn);
+
+alm_func_t        G_ENTRY_PT_PTR(vrs8_rsqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_rsqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_rsqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_rsqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_rsqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrda_rsqrt);
+
+alm_func_t        G_ENTRY_PT_PTR(vrs8_rsqrt_fastf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_rsqrt_fastf);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_rsqrt_fast);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_rsqrt_fast);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_rsqrt_fastf);
+alm_func_t        G_ENTRY_PT_PTR(vrda_rsqrt_fast);
+
+alm_func_t        G_ENTRY_PT_PTR(vrd4_rsqrt_cr);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_rsqrt_cr);
+alm_func_t        G_ENTRY_PT_PTR(vrda_rsqrt_cr);
+
+alm_func_t        G_ENTRY_PT_PTR(vrs8_recipf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_recipf);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_recip);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_recip);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_recipf);
+alm_func_t        G_ENTRY_PT_PTR(vrda_recip);
+
+alm_func_t        G_ENTRY_PT_PTR(vrs8_recip_fastf);
+alm_func_t        G_ENTRY_PT_PTR(vrs16_recip_fastf);
+alm_func_t        G_ENTRY_PT_PTR(vrd4_recip_fast);
+alm_func_t        G_ENTRY_PT_PTR(vrd8_recip_fast);
+alm_func_t        G_ENTRY_PT_PTR(vrsa_recip_fastf);
+alm_func_t        G_ENTRY_PT_PTR(vrda_recip_fast);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_cexp);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_cexp);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_cexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_cexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cexp);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cexp_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cexpf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cexpf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_clog);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_clog);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_clogf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_clogf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_clog);
+alm_func_t        G_ENTRY_PT_PTR(vrza_clog_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_clogf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_clogf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_cpow);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_cpow);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_cpowf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_cpowf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cpow);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cpow_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cpowf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cpowf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_csqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_csqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_csqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_csqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_csqrt);
+alm_func_t        G_ENTRY_PT_PTR(vrza_csqrt_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_csqrtf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_csqrtf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_cabs);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_cabs);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_cabsf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_cabsf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cabs);
+alm_func_t        G_ENTRY_PT_PTR(vrza_cabs_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cabsf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cabsf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_carg);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_carg);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_cargf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_cargf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_carg);
+alm_func_t        G_ENTRY_PT_PTR(vrza_carg_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cargf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_cargf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_csin);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_csin);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_csinf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_csinf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_csin);
+alm_func_t        G_ENTRY_PT_PTR(vrza_csin_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_csinf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_csinf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_ccos);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_ccos);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_ccosf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_ccosf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_ccos);
+alm_func_t        G_ENTRY_PT_PTR(vrza_ccos_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_ccosf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_ccosf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_ctan);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_ctan);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_ctanf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_ctanf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_ctan);
+alm_func_t        G_ENTRY_PT_PTR(vrza_ctan_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_ctanf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_ctanf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_csinh);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_csinh);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_csinhf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_csinhf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_csinh);
+alm_func_t        G_ENTRY_PT_PTR(vrza_csinh_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_csinhf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_csinhf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_ccosh);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_ccosh);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_ccoshf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_ccoshf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_ccosh);
+alm_func_t        G_ENTRY_PT_PTR(vrza_ccosh_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_ccoshf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_ccoshf_split);
+
+alm_func_t        G_ENTRY_PT_PTR(vrz4_ctanh);
+alm_func_t        G_ENTRY_PT_PTR(vrz8_ctanh);
+alm_func_t        G_ENTRY_PT_PTR(vrc8_ctanhf);
+alm_func_t        G_ENTRY_PT_PTR(vrc16_ctanhf);
+alm_func_t        G_ENTRY_PT_PTR(vrza_ctanh);
+alm_func_t        G_ENTRY_PT_PTR(vrza_ctanh_split);
+alm_func_t        G_ENTRY_PT_PTR(vrca_ctanhf);
+alm_func_t        G_ENTRY_PT_PTR(vrca_ctanhf_split);
+
 #ifdef __cplusplus
 }
 #endif
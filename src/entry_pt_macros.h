@@ -71,6 +71,40 @@
 	"\n\t" "jmpq *%rax"                                             \
 	);
 
+#elif defined(__GNUC__) && defined(ALM_STATS)
+/*
+ * Same, first adding one to the calls of __alm_stats_<fn> on the stripe
+ * of the calling thread (see include/libm/alm_stats.h), and for the array
+ * functions their int len argument to its elements. %r10 and %r11 carry
+ * no arguments.
+ */
+#define __ALM_STATS_FN_MAP(fn, elems)					\
+	struct alm_stats_site __alm_stats_##fn ALM_STATS_SECTION	\
+		__attribute__((visibility("hidden"))) = { .name = #fn };	\
+	asm (								\
+	"\n\t"".p2align 4"						\
+	"\n\t"".globl " MK_FN_NAME(fn)					\
+	"\n\t"".type " STRINGIFY(FN_PROTOTYPE(fn)) " ,@function"	\
+	"\n\t" MK_FN_NAME(fn) " :"					\
+	"\n\t" "movq %fs:0, %r11"					\
+	"\n\t" "shrq $12, %r11"						\
+	"\n\t" "imull $0x9e3779b1, %r11d, %r11d"			\
+	"\n\t" "shrl $(32 - " STRINGIFY(ALM_STATS_STRIPES_LOG2) "), %r11d"	\
+	"\n\t" "shll $6, %r11d"						\
+	"\n\t" "leaq __alm_stats_" #fn "(%rip), %r10"			\
+	"\n\t" "lock incq (%r10,%r11)"					\
+	elems								\
+	"\n\t" "mov " STRINGIFY(G_ENTRY_PT_ASM(fn)) "@GOTPCREL(%rip), %rax"	\
+	"\n\t" "jmp *(%rax)"						\
+		);
+
+#define LIBM_DECL_FN_MAP(fn)	__ALM_STATS_FN_MAP(fn, "")
+
+#define LIBM_DECL_ARR_FN_MAP(fn)					\
+	__ALM_STATS_FN_MAP(fn,						\
+	"\n\t" "movslq %edi, %rax"					\
+	"\n\t" "lock addq %rax, 8(%r10,%r11)")
+
 #elif defined(__GNUC__)
 #define LIBM_DECL_FN_MAP(fn)						\
 	asm (								\
@@ -92,6 +126,10 @@
                 );
 #endif
 
+#ifndef LIBM_DECL_ARR_FN_MAP
+#define LIBM_DECL_ARR_FN_MAP(fn)	LIBM_DECL_FN_MAP(fn)
+#endif
+
 #define WEAK_LIBM_ALIAS(x, y)					\
 	asm("\n\t"".weak " STRINGIFY(x)				\
 	    "\n\t"".set " STRINGIFY(x) ", " STRINGIFY(y)	\
@@ -28,12 +28,15 @@
 #include <fn_macros.h>
 #include <libm/types.h>
 #include <libm/entry_pt.h>
+#include <libm/alm_stats.h>
 #include "entry_pt_macros.h"
 
 
 /*
  * LIBM_DECL_FN_MAP is used to declare and map AOCL Libm functions.
  * The functions will be mapped as "amd_<func_name>".
+ * LIBM_DECL_ARR_FN_MAP does the same for array functions whose first
+ * argument is the int length, which ALM_STATS builds count as elements.
  */
 
 /* Scalar Arithmetic Functions */
@@ -232,6 +235,10 @@ LIBM_DECL_FN_MAP(atan2f);
 
 LIBM_DECL_FN_MAP(erf);
 LIBM_DECL_FN_MAP(erff);
+LIBM_DECL_FN_MAP(erfinvf);
+LIBM_DECL_FN_MAP(erfcinvf);
+LIBM_DECL_FN_MAP(cdfnormf);
+LIBM_DECL_FN_MAP(cdfnorminvf);
 LIBM_DECL_FN_MAP(erfinv);
 LIBM_DECL_FN_MAP(erfc);
 LIBM_DECL_FN_MAP(erfcf);
@@ -253,91 +260,124 @@ LIBM_DECL_FN_MAP(cpow);
 LIBM_DECL_FN_MAP(clog);
 LIBM_DECL_FN_MAP(clogf);
 
+LIBM_DECL_FN_MAP(csqrt);
+LIBM_DECL_FN_MAP(csqrtf);
+
+LIBM_DECL_FN_MAP(cabs);
+LIBM_DECL_FN_MAP(cabsf);
+
+LIBM_DECL_FN_MAP(carg);
+LIBM_DECL_FN_MAP(cargf);
+
+LIBM_DECL_FN_MAP(csin);
+LIBM_DECL_FN_MAP(csinf);
+
+LIBM_DECL_FN_MAP(ccos);
+LIBM_DECL_FN_MAP(ccosf);
+
+LIBM_DECL_FN_MAP(ctan);
+LIBM_DECL_FN_MAP(ctanf);
+
+LIBM_DECL_FN_MAP(csinh);
+LIBM_DECL_FN_MAP(csinhf);
+
+LIBM_DECL_FN_MAP(ccosh);
+LIBM_DECL_FN_MAP(ccoshf);
+
+LIBM_DECL_FN_MAP(ctanh);
+LIBM_DECL_FN_MAP(ctanhf);
+
 
 /* Vector Array Variants */
 
-LIBM_DECL_FN_MAP(vrsa_powf);
-LIBM_DECL_FN_MAP(vrsa_cbrtf);
-LIBM_DECL_FN_MAP(vrsa_expf);
-LIBM_DECL_FN_MAP(vrsa_exp2f);
-LIBM_DECL_FN_MAP(vrsa_exp10f);
-LIBM_DECL_FN_MAP(vrsa_expm1f);
-LIBM_DECL_FN_MAP(vrsa_logf);
-LIBM_DECL_FN_MAP(vrsa_log2f);
-LIBM_DECL_FN_MAP(vrsa_log10f);
-LIBM_DECL_FN_MAP(vrsa_log1pf);
-LIBM_DECL_FN_MAP(vrsa_sinf);
-LIBM_DECL_FN_MAP(vrsa_cosf);
-LIBM_DECL_FN_MAP(vrsa_fabsf);
-LIBM_DECL_FN_MAP(vrsa_sqrtf);
-LIBM_DECL_FN_MAP(vrsa_linearfracf);
-LIBM_DECL_FN_MAP(vrsa_powxf);
-LIBM_DECL_FN_MAP(vrsa_sincosf);
-LIBM_DECL_FN_MAP(vrsa_acosf);
-LIBM_DECL_FN_MAP(vrsa_asinf);
-LIBM_DECL_FN_MAP(vrsa_atanf);
-LIBM_DECL_FN_MAP(vrsa_coshf);
-LIBM_DECL_FN_MAP(vrsa_erff);
-LIBM_DECL_FN_MAP(vrsa_tanhf);
-LIBM_DECL_FN_MAP(vrsa_tanf);
-LIBM_DECL_FN_MAP(vrda_atan);
-LIBM_DECL_FN_MAP(vrda_erf);
-LIBM_DECL_FN_MAP(vrda_tan);
-LIBM_DECL_FN_MAP(vrda_cosh);
-LIBM_DECL_FN_MAP(vrda_erfc);
-LIBM_DECL_FN_MAP(vrda_erfinv);
-LIBM_DECL_FN_MAP(vrsa_erfcf);
-LIBM_DECL_FN_MAP(vrsa_roundf);
-LIBM_DECL_FN_MAP(vrda_cdfnorm);
-LIBM_DECL_FN_MAP(vrda_cdfnorminv);
-LIBM_DECL_FN_MAP(vrda_erfcinv);
-
-LIBM_DECL_FN_MAP(vrsa_addf);
-LIBM_DECL_FN_MAP(vrsa_subf);
-LIBM_DECL_FN_MAP(vrsa_mulf);
-LIBM_DECL_FN_MAP(vrsa_divf);
-LIBM_DECL_FN_MAP(vrsa_fmaxf);
-LIBM_DECL_FN_MAP(vrsa_fminf);
-
-LIBM_DECL_FN_MAP(vrsa_addfi);
-LIBM_DECL_FN_MAP(vrsa_subfi);
-LIBM_DECL_FN_MAP(vrsa_mulfi);
-LIBM_DECL_FN_MAP(vrsa_divfi);
-LIBM_DECL_FN_MAP(vrsa_fmaxfi);
-LIBM_DECL_FN_MAP(vrsa_fminfi);
-
-LIBM_DECL_FN_MAP(vrda_pow);
-LIBM_DECL_FN_MAP(vrda_cbrt);
-LIBM_DECL_FN_MAP(vrda_exp);
-LIBM_DECL_FN_MAP(vrda_exp2);
-LIBM_DECL_FN_MAP(vrda_exp10);
-LIBM_DECL_FN_MAP(vrda_expm1);
-LIBM_DECL_FN_MAP(vrda_log);
-LIBM_DECL_FN_MAP(vrda_log2);
-LIBM_DECL_FN_MAP(vrda_log10);
-LIBM_DECL_FN_MAP(vrda_log1p);
-LIBM_DECL_FN_MAP(vrda_sin);
-LIBM_DECL_FN_MAP(vrda_cos);
-LIBM_DECL_FN_MAP(vrda_fabs);
-LIBM_DECL_FN_MAP(vrda_sqrt);
-LIBM_DECL_FN_MAP(vrda_linearfrac);
-LIBM_DECL_FN_MAP(vrda_sincos);
-LIBM_DECL_FN_MAP(vrda_round);
-
-LIBM_DECL_FN_MAP(vrda_add);
-LIBM_DECL_FN_MAP(vrda_sub);
-LIBM_DECL_FN_MAP(vrda_mul);
-LIBM_DECL_FN_MAP(vrda_div);
-LIBM_DECL_FN_MAP(vrda_fmax);
-LIBM_DECL_FN_MAP(vrda_fmin);
-
-LIBM_DECL_FN_MAP(vrda_addi);
-LIBM_DECL_FN_MAP(vrda_subi);
-LIBM_DECL_FN_MAP(vrda_muli);
-LIBM_DECL_FN_MAP(vrda_divi);
-LIBM_DECL_FN_MAP(vrda_fmaxi);
-LIBM_DECL_FN_MAP(vrda_fmini);
-LIBM_DECL_FN_MAP(vrda_powx);
+LIBM_DECL_ARR_FN_MAP(vrsa_powf);
+LIBM_DECL_ARR_FN_MAP(vrsa_cbrtf);
+LIBM_DECL_ARR_FN_MAP(vrsa_expf);
+LIBM_DECL_ARR_FN_MAP(vrsa_exp2f);
+LIBM_DECL_ARR_FN_MAP(vrsa_exp10f);
+LIBM_DECL_ARR_FN_MAP(vrsa_expm1f);
+LIBM_DECL_ARR_FN_MAP(vrsa_logf);
+LIBM_DECL_ARR_FN_MAP(vrsa_log2f);
+LIBM_DECL_ARR_FN_MAP(vrsa_log10f);
+LIBM_DECL_ARR_FN_MAP(vrsa_log1pf);
+LIBM_DECL_ARR_FN_MAP(vrsa_sinf);
+LIBM_DECL_ARR_FN_MAP(vrsa_cosf);
+LIBM_DECL_ARR_FN_MAP(vrsa_fabsf);
+LIBM_DECL_ARR_FN_MAP(vrsa_sqrtf);
+LIBM_DECL_ARR_FN_MAP(vrsa_linearfracf);
+LIBM_DECL_ARR_FN_MAP(vrsa_powxf);
+LIBM_DECL_ARR_FN_MAP(vrsa_powif);
+LIBM_DECL_ARR_FN_MAP(vrsa_sincosf);
+LIBM_DECL_ARR_FN_MAP(vrsa_acosf);
+LIBM_DECL_ARR_FN_MAP(vrsa_asinf);
+LIBM_DECL_ARR_FN_MAP(vrsa_atanf);
+LIBM_DECL_ARR_FN_MAP(vrsa_coshf);
+LIBM_DECL_ARR_FN_MAP(vrsa_erff);
+LIBM_DECL_ARR_FN_MAP(vrsa_erfinvf);
+LIBM_DECL_ARR_FN_MAP(vrsa_erfcinvf);
+LIBM_DECL_ARR_FN_MAP(vrsa_cdfnormf);
+LIBM_DECL_ARR_FN_MAP(vrsa_cdfnorminvf);
+LIBM_DECL_ARR_FN_MAP(vrsa_tanhf);
+LIBM_DECL_ARR_FN_MAP(vrsa_tanf);
+LIBM_DECL_ARR_FN_MAP(vrda_atan);
+LIBM_DECL_ARR_FN_MAP(vrda_erf);
+LIBM_DECL_ARR_FN_MAP(vrda_tan);
+LIBM_DECL_ARR_FN_MAP(vrda_cosh);
+LIBM_DECL_ARR_FN_MAP(vrda_erfc);
+LIBM_DECL_ARR_FN_MAP(vrda_erfinv);
+LIBM_DECL_ARR_FN_MAP(vrsa_erfcf);
+LIBM_DECL_ARR_FN_MAP(vrsa_roundf);
+LIBM_DECL_ARR_FN_MAP(vrda_cdfnorm);
+LIBM_DECL_ARR_FN_MAP(vrda_cdfnorminv);
+LIBM_DECL_ARR_FN_MAP(vrda_erfcinv);
+
+LIBM_DECL_ARR_FN_MAP(vrsa_addf);
+LIBM_DECL_ARR_FN_MAP(vrsa_subf);
+LIBM_DECL_ARR_FN_MAP(vrsa_mulf);
+LIBM_DECL_ARR_FN_MAP(vrsa_divf);
+LIBM_DECL_ARR_FN_MAP(vrsa_fmaxf);
+LIBM_DECL_ARR_FN_MAP(vrsa_fminf);
+
+LIBM_DECL_ARR_FN_MAP(vrsa_addfi);
+LIBM_DECL_ARR_FN_MAP(vrsa_subfi);
+LIBM_DECL_ARR_FN_MAP(vrsa_mulfi);
+LIBM_DECL_ARR_FN_MAP(vrsa_divfi);
+LIBM_DECL_ARR_FN_MAP(vrsa_fmaxfi);
+LIBM_DECL_ARR_FN_MAP(vrsa_fminfi);
+
+LIBM_DECL_ARR_FN_MAP(vrda_pow);
+LIBM_DECL_ARR_FN_MAP(vrda_cbrt);
+LIBM_DECL_ARR_FN_MAP(vrda_exp);
+LIBM_DECL_ARR_FN_MAP(vrda_exp2);
+LIBM_DECL_ARR_FN_MAP(vrda_exp10);
+LIBM_DECL_ARR_FN_MAP(vrda_expm1);
+LIBM_DECL_ARR_FN_MAP(vrda_log);
+LIBM_DECL_ARR_FN_MAP(vrda_log2);
+LIBM_DECL_ARR_FN_MAP(vrda_log10);
+LIBM_DECL_ARR_FN_MAP(vrda_log1p);
+LIBM_DECL_ARR_FN_MAP(vrda_sin);
+LIBM_DECL_ARR_FN_MAP(vrda_cos);
+LIBM_DECL_ARR_FN_MAP(vrda_fabs);
+LIBM_DECL_ARR_FN_MAP(vrda_sqrt);
+LIBM_DECL_ARR_FN_MAP(vrda_linearfrac);
+LIBM_DECL_ARR_FN_MAP(vrda_sincos);
+LIBM_DECL_ARR_FN_MAP(vrda_round);
+
+LIBM_DECL_ARR_FN_MAP(vrda_add);
+LIBM_DECL_ARR_FN_MAP(vrda_sub);
+LIBM_DECL_ARR_FN_MAP(vrda_mul);
+LIBM_DECL_ARR_FN_MAP(vrda_div);
+LIBM_DECL_ARR_FN_MAP(vrda_fmax);
+LIBM_DECL_ARR_FN_MAP(vrda_fmin);
+
+LIBM_DECL_ARR_FN_MAP(vrda_addi);
+LIBM_DECL_ARR_FN_MAP(vrda_subi);
+LIBM_DECL_ARR_FN_MAP(vrda_muli);
+LIBM_DECL_ARR_FN_MAP(vrda_divi);
+LIBM_DECL_ARR_FN_MAP(vrda_fmaxi);
+LIBM_DECL_ARR_FN_MAP(vrda_fmini);
+LIBM_DECL_ARR_FN_MAP(vrda_powx);
+LIBM_DECL_ARR_FN_MAP(vrda_powi);
 
 /* Vector Functions */
 
@@ -432,6 +472,10 @@ LIBM_DECL_FN_MAP(vrs4_asinf);
 LIBM_DECL_FN_MAP(vrs4_acosf);
 LIBM_DECL_FN_MAP(vrs4_atanf);
 LIBM_DECL_FN_MAP(vrs4_erff);
+LIBM_DECL_FN_MAP(vrs4_erfinvf);
+LIBM_DECL_FN_MAP(vrs4_erfcinvf);
+LIBM_DECL_FN_MAP(vrs4_cdfnormf);
+LIBM_DECL_FN_MAP(vrs4_cdfnorminvf);
 LIBM_DECL_FN_MAP(vrs4_fabsf);
 LIBM_DECL_FN_MAP(vrs4_sqrtf);
 LIBM_DECL_FN_MAP(vrs4_linearfracf);
@@ -455,6 +499,10 @@ LIBM_DECL_FN_MAP(vrs8_asinf);
 LIBM_DECL_FN_MAP(vrs8_acosf);
 LIBM_DECL_FN_MAP(vrs8_atanf);
 LIBM_DECL_FN_MAP(vrs8_erff);
+LIBM_DECL_FN_MAP(vrs8_erfinvf);
+LIBM_DECL_FN_MAP(vrs8_erfcinvf);
+LIBM_DECL_FN_MAP(vrs8_cdfnormf);
+LIBM_DECL_FN_MAP(vrs8_cdfnorminvf);
 LIBM_DECL_FN_MAP(vrs8_fabsf);
 LIBM_DECL_FN_MAP(vrs8_sqrtf);
 LIBM_DECL_FN_MAP(vrs8_linearfracf);
@@ -477,6 +525,10 @@ LIBM_DECL_FN_MAP(vrs16_asinf);
 LIBM_DECL_FN_MAP(vrs16_acosf);
 LIBM_DECL_FN_MAP(vrs16_atanf);
 LIBM_DECL_FN_MAP(vrs16_erff);
+LIBM_DECL_FN_MAP(vrs16_erfinvf);
+LIBM_DECL_FN_MAP(vrs16_erfcinvf);
+LIBM_DECL_FN_MAP(vrs16_cdfnormf);
+LIBM_DECL_FN_MAP(vrs16_cdfnorminvf);
 LIBM_DECL_FN_MAP(vrs16_sqrtf);
 LIBM_DECL_FN_MAP(vrs16_linearfracf);
 LIBM_DECL_FN_MAP(vrs16_sincosf);
@@ -485,11 +537,255 @@ LIBM_DECL_FN_MAP(vrs16_roundf);
 
 LIBM_DECL_FN_MAP(vrd2_acos);
 LIBM_DECL_FN_MAP(vrd4_acos);
-LIBM_DECL_FN_MAP(vrda_acos);
+LIBM_DECL_ARR_FN_MAP(vrda_acos);
 
 LIBM_DECL_FN_MAP(vrd2_asin);
 LIBM_DECL_FN_MAP(vrd4_asin);
-LIBM_DECL_FN_MAP(vrda_asin);
+LIBM_DECL_ARR_FN_MAP(vrda_asin);
+
+LIBM_DECL_FN_MAP(expf16);
+LIBM_DECL_FN_MAP(vrh8_expf16);
+LIBM_DECL_FN_MAP(vrh16_expf16);
+LIBM_DECL_FN_MAP(vrh32_expf16);
+LIBM_DECL_FN_MAP(vrha_expf16);
+
+LIBM_DECL_FN_MAP(logf16);
+LIBM_DECL_FN_MAP(vrh8_logf16);
+LIBM_DECL_FN_MAP(vrh16_logf16);
+LIBM_DECL_FN_MAP(vrh32_logf16);
+LIBM_DECL_FN_MAP(vrha_logf16);
+
+LIBM_DECL_FN_MAP(sqrtf16);
+LIBM_DECL_FN_MAP(vrh8_sqrtf16);
+LIBM_DECL_FN_MAP(vrh16_sqrtf16);
+LIBM_DECL_FN_MAP(vrh32_sqrtf16);
+LIBM_DECL_FN_MAP(vrha_sqrtf16);
+
+LIBM_DECL_FN_MAP(tanhf16);
+LIBM_DECL_FN_MAP(vrh8_tanhf16);
+LIBM_DECL_FN_MAP(vrh16_tanhf16);
+LIBM_DECL_FN_MAP(vrh32_tanhf16);
+LIBM_DECL_FN_MAP(vrha_tanhf16);
+
+LIBM_DECL_FN_MAP(erff16);
+LIBM_DECL_FN_MAP(vrh8_erff16);
+LIBM_DECL_FN_MAP(vrh16_erff16);
+LIBM_DECL_FN_MAP(vrh32_erff16);
+LIBM_DECL_FN_MAP(vrha_erff16);
+
+LIBM_DECL_FN_MAP(sinf16);
+LIBM_DECL_FN_MAP(vrh8_sinf16);
+LIBM_DECL_FN_MAP(vrh16_sinf16);
+LIBM_DECL_FN_MAP(vrh32_sinf16);
+LIBM_DECL_FN_MAP(vrha_sinf16);
+
+LIBM_DECL_FN_MAP(cosf16);
+LIBM_DECL_FN_MAP(vrh8_cosf16);
+LIBM_DECL_FN_MAP(vrh16_cosf16);
+LIBM_DECL_FN_MAP(vrh32_cosf16);
+LIBM_DECL_FN_MAP(vrha_cosf16);
+
+LIBM_DECL_FN_MAP(vrba_expbf16);
+LIBM_DECL_FN_MAP(vrba_logbf16);
+LIBM_DECL_FN_MAP(vrba_tanhbf16);
+LIBM_DECL_FN_MAP(vrba_erfbf16);
+LIBM_DECL_FN_MAP(vrba_sigmoidbf16);
+LIBM_DECL_FN_MAP(vrba_gelubf16);
+
+LIBM_DECL_FN_MAP(vrs8_sigmoidf);
+LIBM_DECL_FN_MAP(vrs16_sigmoidf);
+LIBM_DECL_ARR_FN_MAP(vrsa_sigmoidf);
+LIBM_DECL_FN_MAP(vrd4_sigmoid);
+LIBM_DECL_FN_MAP(vrd8_sigmoid);
+LIBM_DECL_ARR_FN_MAP(vrda_sigmoid);
+
+LIBM_DECL_FN_MAP(vrs8_softplusf);
+LIBM_DECL_FN_MAP(vrs16_softplusf);
+LIBM_DECL_ARR_FN_MAP(vrsa_softplusf);
+LIBM_DECL_FN_MAP(vrd4_softplus);
+LIBM_DECL_FN_MAP(vrd8_softplus);
+LIBM_DECL_ARR_FN_MAP(vrda_softplus);
+
+LIBM_DECL_FN_MAP(vrs8_geluf);
+LIBM_DECL_FN_MAP(vrs16_geluf);
+LIBM_DECL_ARR_FN_MAP(vrsa_geluf);
+LIBM_DECL_FN_MAP(vrd4_gelu);
+LIBM_DECL_FN_MAP(vrd8_gelu);
+LIBM_DECL_ARR_FN_MAP(vrda_gelu);
+
+LIBM_DECL_FN_MAP(vrs8_gelu_tanhf);
+LIBM_DECL_FN_MAP(vrs16_gelu_tanhf);
+LIBM_DECL_ARR_FN_MAP(vrsa_gelu_tanhf);
+LIBM_DECL_FN_MAP(vrd4_gelu_tanh);
+LIBM_DECL_FN_MAP(vrd8_gelu_tanh);
+LIBM_DECL_ARR_FN_MAP(vrda_gelu_tanh);
+
+LIBM_DECL_FN_MAP(vrs8_siluf);
+LIBM_DECL_FN_MAP(vrs16_siluf);
+LIBM_DECL_ARR_FN_MAP(vrsa_siluf);
+LIBM_DECL_FN_MAP(vrd4_silu);
+LIBM_DECL_FN_MAP(vrd8_silu);
+LIBM_DECL_ARR_FN_MAP(vrda_silu);
+
+LIBM_DECL_FN_MAP(vrs8_mishf);
+LIBM_DECL_FN_MAP(vrs16_mishf);
+LIBM_DECL_ARR_FN_MAP(vrsa_mishf);
+LIBM_DECL_FN_MAP(vrd4_mish);
+LIBM_DECL_FN_MAP(vrd8_mish);
+LIBM_DECL_ARR_FN_MAP(vrda_mish);
+
+LIBM_DECL_ARR_FN_MAP(vrsa_softmaxf);
+LIBM_DECL_FN_MAP(vrsa_softmax_batchf);
+LIBM_DECL_ARR_FN_MAP(vrda_softmax);
+LIBM_DECL_FN_MAP(vrda_softmax_batch);
+
+LIBM_DECL_ARR_FN_MAP(vrsa_log_softmaxf);
+LIBM_DECL_FN_MAP(vrsa_log_softmax_batchf);
+LIBM_DECL_ARR_FN_MAP(vrda_log_softmax);
+LIBM_DECL_FN_MAP(vrda_log_softmax_batch);
+
+LIBM_DECL_FN_MAP(vrsa_randnf);
+LIBM_DECL_FN_MAP(vrda_randn);
+
+LIBM_DECL_FN_MAP(vrs8_rsqrtf);
+LIBM_DECL_FN_MAP(vrs16_rsqrtf);
+LIBM_DECL_FN_MAP(vrd4_rsqrt);
+LIBM_DECL_FN_MAP(vrd8_rsqrt);
+LIBM_DECL_ARR_FN_MAP(vrsa_rsqrtf);
+LIBM_DECL_ARR_FN_MAP(vrda_rsqrt);
+
+LIBM_DECL_FN_MAP(vrs8_rsqrt_fastf);
+LIBM_DECL_FN_MAP(vrs16_rsqrt_fastf);
+LIBM_DECL_FN_MAP(vrd4_rsqrt_fast);
+LIBM_DECL_FN_MAP(vrd8_rsqrt_fast);
+LIBM_DECL_ARR_FN_MAP(vrsa_rsqrt_fastf);
+LIBM_DECL_ARR_FN_MAP(vrda_rsqrt_fast);
+
+LIBM_DECL_FN_MAP(vrd4_rsqrt_cr);
+LIBM_DECL_FN_MAP(vrd8_rsqrt_cr);
+LIBM_DECL_ARR_FN_MAP(vrda_rsqrt_cr);
+
+LIBM_DECL_FN_MAP(vrs8_recipf);
+LIBM_DECL_FN_MAP(vrs16_recipf);
+LIBM_DECL_FN_MAP(vrd4_recip);
+LIBM_DECL_FN_MAP(vrd8_recip);
+LIBM_DECL_ARR_FN_MAP(vrsa_recipf);
+LIBM_DECL_ARR_FN_MAP(vrda_recip);
+
+LIBM_DECL_FN_MAP(vrs8_recip_fastf);
+LIBM_DECL_FN_MAP(vrs16_recip_fastf);
+LIBM_DECL_FN_MAP(vrd4_recip_fast);
+LIBM_DECL_FN_MAP(vrd8_recip_fast);
+LIBM_DECL_ARR_FN_MAP(vrsa_recip_fastf);
+LIBM_DECL_ARR_FN_MAP(vrda_recip_fast);
+
+LIBM_DECL_FN_MAP(vrz4_cexp);
+LIBM_DECL_FN_MAP(vrz8_cexp);
+LIBM_DECL_FN_MAP(vrc8_cexpf);
+LIBM_DECL_FN_MAP(vrc16_cexpf);
+LIBM_DECL_FN_MAP(vrza_cexp);
+LIBM_DECL_FN_MAP(vrza_cexp_split);
+LIBM_DECL_FN_MAP(vrca_cexpf);
+LIBM_DECL_FN_MAP(vrca_cexpf_split);
+
+LIBM_DECL_FN_MAP(vrz4_clog);
+LIBM_DECL_FN_MAP(vrz8_clog);
+LIBM_DECL_FN_MAP(vrc8_clogf);
+LIBM_DECL_FN_MAP(vrc16_clogf);
+LIBM_DECL_FN_MAP(vrza_clog);
+LIBM_DECL_FN_MAP(vrza_clog_split);
+LIBM_DECL_FN_MAP(vrca_clogf);
+LIBM_DECL_FN_MAP(vrca_clogf_split);
+
+LIBM_DECL_FN_MAP(vrz4_cpow);
+LIBM_DECL_FN_MAP(vrz8_cpow);
+LIBM_DECL_FN_MAP(vrc8_cpowf);
+LIBM_DECL_FN_MAP(vrc16_cpowf);
+LIBM_DECL_FN_MAP(vrza_cpow);
+LIBM_DECL_FN_MAP(vrza_cpow_split);
+LIBM_DECL_FN_MAP(vrca_cpowf);
+LIBM_DECL_FN_MAP(vrca_cpowf_split);
+
+LIBM_DECL_FN_MAP(vrz4_csqrt);
+LIBM_DECL_FN_MAP(vrz8_csqrt);
+LIBM_DECL_FN_MAP(vrc8_csqrtf);
+LIBM_DECL_FN_MAP(vrc16_csqrtf);
+LIBM_DECL_FN_MAP(vrza_csqrt);
+LIBM_DECL_FN_MAP(vrza_csqrt_split);
+LIBM_DECL_FN_MAP(vrca_csqrtf);
+LIBM_DECL_FN_MAP(vrca_csqrtf_split);
+
+LIBM_DECL_FN_MAP(vrz4_cabs);
+LIBM_DECL_FN_MAP(vrz8_cabs);
+LIBM_DECL_FN_MAP(vrc8_cabsf);
+LIBM_DECL_FN_MAP(vrc16_cabsf);
+LIBM_DECL_FN_MAP(vrza_cabs);
+LIBM_DECL_FN_MAP(vrza_cabs_split);
+LIBM_DECL_FN_MAP(vrca_cabsf);
+LIBM_DECL_FN_MAP(vrca_cabsf_split);
+
+LIBM_DECL_FN_MAP(vrz4_carg);
+LIBM_DECL_FN_MAP(vrz8_carg);
+LIBM_DECL_FN_MAP(vrc8_cargf);
+LIBM_DECL_FN_MAP(vrc16_cargf);
+LIBM_DECL_FN_MAP(vrza_carg);
+LIBM_DECL_FN_MAP(vrza_carg_split);
+LIBM_DECL_FN_MAP(vrca_cargf);
+LIBM_DECL_FN_MAP(vrca_cargf_split);
+
+LIBM_DECL_FN_MAP(vrz4_csin);
+LIBM_DECL_FN_MAP(vrz8_csin);
+LIBM_DECL_FN_MAP(vrc8_csinf);
+LIBM_DECL_FN_MAP(vrc16_csinf);
+LIBM_DECL_FN_MAP(vrza_csin);
+LIBM_DECL_FN_MAP(vrza_csin_split);
+LIBM_DECL_FN_MAP(vrca_csinf);
+LIBM_DECL_FN_MAP(vrca_csinf_split);
+
+LIBM_DECL_FN_MAP(vrz4_ccos);
+LIBM_DECL_FN_MAP(vrz8_ccos);
+LIBM_DECL_FN_MAP(vrc8_ccosf);
+LIBM_DECL_FN_MAP(vrc16_ccosf);
+LIBM_DECL_FN_MAP(vrza_ccos);
+LIBM_DECL_FN_MAP(vrza_ccos_split);
+LIBM_DECL_FN_MAP(vrca_ccosf);
+LIBM_DECL_FN_MAP(vrca_ccosf_split);
+
+LIBM_DECL_FN_MAP(vrz4_ctan);
+LIBM_DECL_FN_MAP(vrz8_ctan);
+LIBM_DECL_FN_MAP(vrc8_ctanf);
+LIBM_DECL_FN_MAP(vrc16_ctanf);
+LIBM_DECL_FN_MAP(vrza_ctan);
+LIBM_DECL_FN_MAP(vrza_ctan_split);
+LIBM_DECL_FN_MAP(vrca_ctanf);
+LIBM_DECL_FN_MAP(vrca_ctanf_split);
+
+LIBM_DECL_FN_MAP(vrz4_csinh);
+LIBM_DECL_FN_MAP(vrz8_csinh);
+LIBM_DECL_FN_MAP(vrc8_csinhf);
+LIBM_DECL_FN_MAP(vrc16_csinhf);
+LIBM_DECL_FN_MAP(vrza_csinh);
+LIBM_DECL_FN_MAP(vrza_csinh_split);
+LIBM_DECL_FN_MAP(vrca_csinhf);
+LIBM_DECL_FN_MAP(vrca_csinhf_split);
+
+LIBM_DECL_FN_MAP(vrz4_ccosh);
+LIBM_DECL_FN_MAP(vrz8_ccosh);
+LIBM_DECL_FN_MAP(vrc8_ccoshf);
+LIBM_DECL_FN_MAP(vrc16_ccoshf);
+LIBM_DECL_FN_MAP(vrza_ccosh);
+LIBM_DECL_FN_MAP(vrza_ccosh_split);
+LIBM_DECL_FN_MAP(vrca_ccoshf);
+LIBM_DECL_FN_MAP(vrca_ccoshf_split);
+
+LIBM_DECL_FN_MAP(vrz4_ctanh);
+LIBM_DECL_FN_MAP(vrz8_ctanh);
+LIBM_DECL_FN_MAP(vrc8_ctanhf);
+LIBM_DECL_FN_MAP(vrc16_ctanhf);
+LIBM_DECL_FN_MAP(vrza_ctanh);
+LIBM_DECL_FN_MAP(vrza_ctanh_split);
+LIBM_DECL_FN_MAP(vrca_ctanhf);
+LIBM_DECL_FN_MAP(vrca_ctanhf_split);
 
 /*
  * WEAK_LIBM_ALIAS is used to map "amd_<func_name>" to "<func_name>".
@@ -657,6 +953,10 @@ WEAK_LIBM_ALIAS(atan2, FN_PROTOTYPE(atan2));
 /* Scalar Error Functions */
 
 WEAK_LIBM_ALIAS(erff, FN_PROTOTYPE(erff));
+WEAK_LIBM_ALIAS(erfinvf, FN_PROTOTYPE(erfinvf));
+WEAK_LIBM_ALIAS(erfcinvf, FN_PROTOTYPE(erfcinvf));
+WEAK_LIBM_ALIAS(cdfnormf, FN_PROTOTYPE(cdfnormf));
+WEAK_LIBM_ALIAS(cdfnorminvf, FN_PROTOTYPE(cdfnorminvf));
 WEAK_LIBM_ALIAS(erf, FN_PROTOTYPE(erf));
 WEAK_LIBM_ALIAS(erfinv, FN_PROTOTYPE(erfinv));
 WEAK_LIBM_ALIAS(erfc, FN_PROTOTYPE(erfc));
@@ -676,6 +976,24 @@ WEAK_LIBM_ALIAS(cpowf, FN_PROTOTYPE(cpowf));
 WEAK_LIBM_ALIAS(cpow, FN_PROTOTYPE(cpow));
 WEAK_LIBM_ALIAS(clogf, FN_PROTOTYPE(clogf));
 WEAK_LIBM_ALIAS(clog, FN_PROTOTYPE(clog));
+WEAK_LIBM_ALIAS(csqrtf, FN_PROTOTYPE(csqrtf));
+WEAK_LIBM_ALIAS(csqrt, FN_PROTOTYPE(csqrt));
+WEAK_LIBM_ALIAS(cabsf, FN_PROTOTYPE(cabsf));
+WEAK_LIBM_ALIAS(cabs, FN_PROTOTYPE(cabs));
+WEAK_LIBM_ALIAS(cargf, FN_PROTOTYPE(cargf));
+WEAK_LIBM_ALIAS(carg, FN_PROTOTYPE(carg));
+WEAK_LIBM_ALIAS(csinf, FN_PROTOTYPE(csinf));
+WEAK_LIBM_ALIAS(csin, FN_PROTOTYPE(csin));
+WEAK_LIBM_ALIAS(ccosf, FN_PROTOTYPE(ccosf));
+WEAK_LIBM_ALIAS(ccos, FN_PROTOTYPE(ccos));
+WEAK_LIBM_ALIAS(ctanf, FN_PROTOTYPE(ctanf));
+WEAK_LIBM_ALIAS(ctan, FN_PROTOTYPE(ctan));
+WEAK_LIBM_ALIAS(csinhf, FN_PROTOTYPE(csinhf));
+WEAK_LIBM_ALIAS(csinh, FN_PROTOTYPE(csinh));
+WEAK_LIBM_ALIAS(ccoshf, FN_PROTOTYPE(ccoshf));
+WEAK_LIBM_ALIAS(ccosh, FN_PROTOTYPE(ccosh));
+WEAK_LIBM_ALIAS(ctanhf, FN_PROTOTYPE(ctanhf));
+WEAK_LIBM_ALIAS(ctanh, FN_PROTOTYPE(ctanh));
 
 
 /* Vector Array Variants */
@@ -712,12 +1030,17 @@ WEAK_LIBM_ALIAS(vrsa_fmaxfi, FN_PROTOTYPE(vrsa_fmaxfi));
 WEAK_LIBM_ALIAS(vrsa_fminfi, FN_PROTOTYPE(vrsa_fminfi));
 
 WEAK_LIBM_ALIAS(vrsa_powxf, FN_PROTOTYPE(vrsa_powxf));
+WEAK_LIBM_ALIAS(vrsa_powif, FN_PROTOTYPE(vrsa_powif));
 
 WEAK_LIBM_ALIAS(vrsa_acosf, FN_PROTOTYPE(vrsa_acosf));
 WEAK_LIBM_ALIAS(vrsa_asinf, FN_PROTOTYPE(vrsa_asinf));
 WEAK_LIBM_ALIAS(vrsa_atanf, FN_PROTOTYPE(vrsa_atanf));
 WEAK_LIBM_ALIAS(vrsa_coshf, FN_PROTOTYPE(vrsa_coshf));
 WEAK_LIBM_ALIAS(vrsa_erff, FN_PROTOTYPE(vrsa_erff));
+WEAK_LIBM_ALIAS(vrsa_erfinvf, FN_PROTOTYPE(vrsa_erfinvf));
+WEAK_LIBM_ALIAS(vrsa_erfcinvf, FN_PROTOTYPE(vrsa_erfcinvf));
+WEAK_LIBM_ALIAS(vrsa_cdfnormf, FN_PROTOTYPE(vrsa_cdfnormf));
+WEAK_LIBM_ALIAS(vrsa_cdfnorminvf, FN_PROTOTYPE(vrsa_cdfnorminvf));
 WEAK_LIBM_ALIAS(vrsa_tanhf, FN_PROTOTYPE(vrsa_tanhf));
 WEAK_LIBM_ALIAS(vrsa_tanf, FN_PROTOTYPE(vrsa_tanf));
 WEAK_LIBM_ALIAS(vrsa_roundf, FN_PROTOTYPE(vrsa_roundf));
@@ -764,6 +1087,7 @@ WEAK_LIBM_ALIAS(vrda_fmaxi, FN_PROTOTYPE(vrda_fmaxi));
 WEAK_LIBM_ALIAS(vrda_fmini, FN_PROTOTYPE(vrda_fmini));
 
 WEAK_LIBM_ALIAS(vrda_powx, FN_PROTOTYPE(vrda_powx));
+WEAK_LIBM_ALIAS(vrda_powi, FN_PROTOTYPE(vrda_powi));
 WEAK_LIBM_ALIAS(vrda_round, FN_PROTOTYPE(vrda_round));
 
 /* Vector Functions */
@@ -859,6 +1183,10 @@ WEAK_LIBM_ALIAS(vrs4_asinf, FN_PROTOTYPE(vrs4_asinf));
 WEAK_LIBM_ALIAS(vrs4_acosf, FN_PROTOTYPE(vrs4_acosf));
 WEAK_LIBM_ALIAS(vrs4_atanf, FN_PROTOTYPE(vrs4_atanf));
 WEAK_LIBM_ALIAS(vrs4_erff, FN_PROTOTYPE(vrs4_erff));
+WEAK_LIBM_ALIAS(vrs4_erfinvf, FN_PROTOTYPE(vrs4_erfinvf));
+WEAK_LIBM_ALIAS(vrs4_erfcinvf, FN_PROTOTYPE(vrs4_erfcinvf));
+WEAK_LIBM_ALIAS(vrs4_cdfnormf, FN_PROTOTYPE(vrs4_cdfnormf));
+WEAK_LIBM_ALIAS(vrs4_cdfnorminvf, FN_PROTOTYPE(vrs4_cdfnorminvf));
 WEAK_LIBM_ALIAS(vrs4_fabsf, FN_PROTOTYPE(vrs4_fabsf));
 WEAK_LIBM_ALIAS(vrs4_sqrtf, FN_PROTOTYPE(vrs4_sqrtf));
 WEAK_LIBM_ALIAS(vrs4_linearfracf, FN_PROTOTYPE(vrs4_linearfracf));
@@ -882,6 +1210,10 @@ WEAK_LIBM_ALIAS(vrs8_asinf, FN_PROTOTYPE(vrs8_asinf));
 WEAK_LIBM_ALIAS(vrs8_acosf, FN_PROTOTYPE(vrs8_acosf));
 WEAK_LIBM_ALIAS(vrs8_atanf, FN_PROTOTYPE(vrs8_atanf));
 WEAK_LIBM_ALIAS(vrs8_erff, FN_PROTOTYPE(vrs8_erff));
+WEAK_LIBM_ALIAS(vrs8_erfinvf, FN_PROTOTYPE(vrs8_erfinvf));
+WEAK_LIBM_ALIAS(vrs8_erfcinvf, FN_PROTOTYPE(vrs8_erfcinvf));
+WEAK_LIBM_ALIAS(vrs8_cdfnormf, FN_PROTOTYPE(vrs8_cdfnormf));
+WEAK_LIBM_ALIAS(vrs8_cdfnorminvf, FN_PROTOTYPE(vrs8_cdfnorminvf));
 WEAK_LIBM_ALIAS(vrs8_fabsf, FN_PROTOTYPE(vrs8_fabsf));
 WEAK_LIBM_ALIAS(vrs8_sqrtf, FN_PROTOTYPE(vrs8_sqrtf));
 WEAK_LIBM_ALIAS(vrs8_linearfracf, FN_PROTOTYPE(vrs8_linearfracf));
@@ -904,6 +1236,10 @@ WEAK_LIBM_ALIAS(vrs16_asinf, FN_PROTOTYPE(vrs16_asinf));
 WEAK_LIBM_ALIAS(vrs16_acosf, FN_PROTOTYPE(vrs16_acosf));
 WEAK_LIBM_ALIAS(vrs16_atanf, FN_PROTOTYPE(vrs16_atanf));
 WEAK_LIBM_ALIAS(vrs16_erff, FN_PROTOTYPE(vrs16_erff));
+WEAK_LIBM_ALIAS(vrs16_erfinvf, FN_PROTOTYPE(vrs16_erfinvf));
+WEAK_LIBM_ALIAS(vrs16_erfcinvf, FN_PROTOTYPE(vrs16_erfcinvf));
+WEAK_LIBM_ALIAS(vrs16_cdfnormf, FN_PROTOTYPE(vrs16_cdfnormf));
+WEAK_LIBM_ALIAS(vrs16_cdfnorminvf, FN_PROTOTYPE(vrs16_cdfnorminvf));
 WEAK_LIBM_ALIAS(vrs16_sqrtf, FN_PROTOTYPE(vrs16_sqrtf));
 WEAK_LIBM_ALIAS(vrs16_linearfracf, FN_PROTOTYPE(vrs16_linearfracf));
 WEAK_LIBM_ALIAS(vrs16_sincosf, FN_PROTOTYPE(vrs16_sincosf));
@@ -917,6 +1253,175 @@ WEAK_LIBM_ALIAS(vrda_acos, FN_PROTOTYPE(vrda_acos));
 WEAK_LIBM_ALIAS(vrd2_asin, FN_PROTOTYPE(vrd2_asin));
 WEAK_LIBM_ALIAS(vrd4_asin, FN_PROTOTYPE(vrd4_asin));
 WEAK_LIBM_ALIAS(vrda_asin, FN_PROTOTYPE(vrda_asin));
+WEAK_LIBM_ALIAS(vrs8_sigmoidf, FN_PROTOTYPE(vrs8_sigmoidf));
+WEAK_LIBM_ALIAS(vrs16_sigmoidf, FN_PROTOTYPE(vrs16_sigmoidf));
+WEAK_LIBM_ALIAS(vrsa_sigmoidf, FN_PROTOTYPE(vrsa_sigmoidf));
+WEAK_LIBM_ALIAS(vrd4_sigmoid, FN_PROTOTYPE(vrd4_sigmoid));
+WEAK_LIBM_ALIAS(vrd8_sigmoid, FN_PROTOTYPE(vrd8_sigmoid));
+WEAK_LIBM_ALIAS(vrda_sigmoid, FN_PROTOTYPE(vrda_sigmoid));
+WEAK_LIBM_ALIAS(vrs8_softplusf, FN_PROTOTYPE(vrs8_softplusf));
+WEAK_LIBM_ALIAS(vrs16_softplusf, FN_PROTOTYPE(vrs16_softplusf));
+WEAK_LIBM_ALIAS(vrsa_softplusf, FN_PROTOTYPE(vrsa_softplusf));
+WEAK_LIBM_ALIAS(vrd4_softplus, FN_PROTOTYPE(vrd4_softplus));
+WEAK_LIBM_ALIAS(vrd8_softplus, FN_PROTOTYPE(vrd8_softplus));
+WEAK_LIBM_ALIAS(vrda_softplus, FN_PROTOTYPE(vrda_softplus));
+WEAK_LIBM_ALIAS(vrs8_geluf, FN_PROTOTYPE(vrs8_geluf));
+WEAK_LIBM_ALIAS(vrs16_geluf, FN_PROTOTYPE(vrs16_geluf));
+WEAK_LIBM_ALIAS(vrsa_geluf, FN_PROTOTYPE(vrsa_geluf));
+WEAK_LIBM_ALIAS(vrd4_gelu, FN_PROTOTYPE(vrd4_gelu));
+WEAK_LIBM_ALIAS(vrd8_gelu, FN_PROTOTYPE(vrd8_gelu));
+WEAK_LIBM_ALIAS(vrda_gelu, FN_PROTOTYPE(vrda_gelu));
+WEAK_LIBM_ALIAS(vrs8_gelu_tanhf, FN_PROTOTYPE(vrs8_gelu_tanhf));
+WEAK_LIBM_ALIAS(vrs16_gelu_tanhf, FN_PROTOTYPE(vrs16_gelu_tanhf));
+WEAK_LIBM_ALIAS(vrsa_gelu_tanhf, FN_PROTOTYPE(vrsa_gelu_tanhf));
+WEAK_LIBM_ALIAS(vrd4_gelu_tanh, FN_PROTOTYPE(vrd4_gelu_tanh));
+WEAK_LIBM_ALIAS(vrd8_gelu_tanh, FN_PROTOTYPE(vrd8_gelu_tanh));
+WEAK_LIBM_ALIAS(vrda_gelu_tanh, FN_PROTOTYPE(vrda_gelu_tanh));
+WEAK_LIBM_ALIAS(vrs8_siluf, FN_PROTOTYPE(vrs8_siluf));
+WEAK_LIBM_ALIAS(vrs16_siluf, FN_PROTOTYPE(vrs16_siluf));
+WEAK_LIBM_ALIAS(vrsa_siluf, FN_PROTOTYPE(vrsa_siluf));
+WEAK_LIBM_ALIAS(vrd4_silu, FN_PROTOTYPE(vrd4_silu));
+WEAK_LIBM_ALIAS(vrd8_silu, FN_PROTOTYPE(vrd8_silu));
+WEAK_LIBM_ALIAS(vrda_silu, FN_PROTOTYPE(vrda_silu));
+WEAK_LIBM_ALIAS(vrs8_mishf, FN_PROTOTYPE(vrs8_mishf));
+WEAK_LIBM_ALIAS(vrs16_mishf, FN_PROTOTYPE(vrs16_mishf));
+WEAK_LIBM_ALIAS(vrsa_mishf, FN_PROTOTYPE(vrsa_mishf));
+WEAK_LIBM_ALIAS(vrd4_mish, FN_PROTOTYPE(vrd4_mish));
+WEAK_LIBM_ALIAS(vrd8_mish, FN_PROTOTYPE(vrd8_mish));
+WEAK_LIBM_ALIAS(vrda_mish, FN_PROTOTYPE(vrda_mish));
+WEAK_LIBM_ALIAS(vrsa_softmaxf, FN_PROTOTYPE(vrsa_softmaxf));
+WEAK_LIBM_ALIAS(vrsa_softmax_batchf, FN_PROTOTYPE(vrsa_softmax_batchf));
+WEAK_LIBM_ALIAS(vrda_softmax, FN_PROTOTYPE(vrda_softmax));
+WEAK_LIBM_ALIAS(vrda_softmax_batch, FN_PROTOTYPE(vrda_softmax_batch));
+WEAK_LIBM_ALIAS(vrsa_log_softmaxf, FN_PROTOTYPE(vrsa_log_softmaxf));
+WEAK_LIBM_ALIAS(vrsa_log_softmax_batchf, FN_PROTOTYPE(vrsa_log_softmax_batchf));
+WEAK_LIBM_ALIAS(vrda_log_softmax, FN_PROTOTYPE(vrda_log_softmax));
+WEAK_LIBM_ALIAS(vrda_log_softmax_batch, FN_PROTOTYPE(vrda_log_softmax_batch));
+WEAK_LIBM_ALIAS(vrsa_randnf, FN_PROTOTYPE(vrsa_randnf));
+WEAK_LIBM_ALIAS(vrda_randn, FN_PROTOTYPE(vrda_randn));
+WEAK_LIBM_ALIAS(vrs8_rsqrtf, FN_PROTOTYPE(vrs8_rsqrtf));
+WEAK_LIBM_ALIAS(vrs16_rsqrtf, FN_PROTOTYPE(vrs16_rsqrtf));
+WEAK_LIBM_ALIAS(vrd4_rsqrt, FN_PROTOTYPE(vrd4_rsqrt));
+WEAK_LIBM_ALIAS(vrd8_rsqrt, FN_PROTOTYPE(vrd8_rsqrt));
+WEAK_LIBM_ALIAS(vrsa_rsqrtf, FN_PROTOTYPE(vrsa_rsqrtf));
+WEAK_LIBM_ALIAS(vrda_rsqrt, FN_PROTOTYPE(vrda_rsqrt));
+WEAK_LIBM_ALIAS(vrs8_rsqrt_fastf, FN_PROTOTYPE(vrs8_rsqrt_fastf));
+WEAK_LIBM_ALIAS(vrs16_rsqrt_fastf, FN_PROTOTYPE(vrs16_rsqrt_fastf));
+WEAK_LIBM_ALIAS(vrd4_rsqrt_fast, FN_PROTOTYPE(vrd4_rsqrt_fast));
+WEAK_LIBM_ALIAS(vrd8_rsqrt_fast, FN_PROTOTYPE(vrd8_rsqrt_fast));
+WEAK_LIBM_ALIAS(vrsa_rsqrt_fastf, FN_PROTOTYPE(vrsa_rsqrt_fastf));
+WEAK_LIBM_ALIAS(vrda_rsqrt_fast, FN_PROTOTYPE(vrda_rsqrt_fast));
+WEAK_LIBM_ALIAS(vrd4_rsqrt_cr, FN_PROTOTYPE(vrd4_rsqrt_cr));
+WEAK_LIBM_ALIAS(vrd8_rsqrt_cr, FN_PROTOTYPE(vrd8_rsqrt_cr));
+WEAK_LIBM_ALIAS(vrda_rsqrt_cr, FN_PROTOTYPE(vrda_rsqrt_cr));
+WEAK_LIBM_ALIAS(vrs8_recipf, FN_PROTOTYPE(vrs8_recipf));
+WEAK_LIBM_ALIAS(vrs16_recipf, FN_PROTOTYPE(vrs16_recipf));
+WEAK_LIBM_ALIAS(vrd4_recip, FN_PROTOTYPE(vrd4_recip));
+WEAK_LIBM_ALIAS(vrd8_recip, FN_PROTOTYPE(vrd8_recip));
+WEAK_LIBM_ALIAS(vrsa_recipf, FN_PROTOTYPE(vrsa_recipf));
+WEAK_LIBM_ALIAS(vrda_recip, FN_PROTOTYPE(vrda_recip));
+WEAK_LIBM_ALIAS(vrs8_recip_fastf, FN_PROTOTYPE(vrs8_recip_fastf));
+WEAK_LIBM_ALIAS(vrs16_recip_fastf, FN_PROTOTYPE(vrs16_recip_fastf));
+WEAK_LIBM_ALIAS(vrd4_recip_fast, FN_PROTOTYPE(vrd4_recip_fast));
+WEAK_LIBM_ALIAS(vrd8_recip_fast, FN_PROTOTYPE(vrd8_recip_fast));
+WEAK_LIBM_ALIAS(vrsa_recip_fastf, FN_PROTOTYPE(vrsa_recip_fastf));
+WEAK_LIBM_ALIAS(vrda_recip_fast, FN_PROTOTYPE(vrda_recip_fast));
+WEAK_LIBM_ALIAS(vrz4_cexp, FN_PROTOTYPE(vrz4_cexp));
+WEAK_LIBM_ALIAS(vrz8_cexp, FN_PROTOTYPE(vrz8_cexp));
+WEAK_LIBM_ALIAS(vrc8_cexpf, FN_PROTOTYPE(vrc8_cexpf));
+WEAK_LIBM_ALIAS(vrc16_cexpf, FN_PROTOTYPE(vrc16_cexpf));
+WEAK_LIBM_ALIAS(vrza_cexp, FN_PROTOTYPE(vrza_cexp));
+WEAK_LIBM_ALIAS(vrza_cexp_split, FN_PROTOTYPE(vrza_cexp_split));
+WEAK_LIBM_ALIAS(vrca_cexpf, FN_PROTOTYPE(vrca_cexpf));
+WEAK_LIBM_ALIAS(vrca_cexpf_split, FN_PROTOTYPE(vrca_cexpf_split));
+WEAK_LIBM_ALIAS(vrz4_clog, FN_PROTOTYPE(vrz4_clog));
+WEAK_LIBM_ALIAS(vrz8_clog, FN_PROTOTYPE(vrz8_clog));
+WEAK_LIBM_ALIAS(vrc8_clogf, FN_PROTOTYPE(vrc8_clogf));
+WEAK_LIBM_ALIAS(vrc16_clogf, FN_PROTOTYPE(vrc16_clogf));
+WEAK_LIBM_ALIAS(vrza_clog, FN_PROTOTYPE(vrza_clog));
+WEAK_LIBM_ALIAS(vrza_clog_split, FN_PROTOTYPE(vrza_clog_split));
+WEAK_LIBM_ALIAS(vrca_clogf, FN_PROTOTYPE(vrca_clogf));
+WEAK_LIBM_ALIAS(vrca_clogf_split, FN_PROTOTYPE(vrca_clogf_split));
+WEAK_LIBM_ALIAS(vrz4_cpow, FN_PROTOTYPE(vrz4_cpow));
+WEAK_LIBM_ALIAS(vrz8_cpow, FN_PROTOTYPE(vrz8_cpow));
+WEAK_LIBM_ALIAS(vrc8_cpowf, FN_PROTOTYPE(vrc8_cpowf));
+WEAK_LIBM_ALIAS(vrc16_cpowf, FN_PROTOTYPE(vrc16_cpowf));
+WEAK_LIBM_ALIAS(vrza_cpow, FN_PROTOTYPE(vrza_cpow));
+WEAK_LIBM_ALIAS(vrza_cpow_split, FN_PROTOTYPE(vrza_cpow_split));
+WEAK_LIBM_ALIAS(vrca_cpowf, FN_PROTOTYPE(vrca_cpowf));
+WEAK_LIBM_ALIAS(vrca_cpowf_split, FN_PROTOTYPE(vrca_cpowf_split));
+WEAK_LIBM_ALIAS(vrz4_csqrt, FN_PROTOTYPE(vrz4_csqrt));
+WEAK_LIBM_ALIAS(vrz8_csqrt, FN_PROTOTYPE(vrz8_csqrt));
+WEAK_LIBM_ALIAS(vrc8_csqrtf, FN_PROTOTYPE(vrc8_csqrtf));
+WEAK_LIBM_ALIAS(vrc16_csqrtf, FN_PROTOTYPE(vrc16_csqrtf));
+WEAK_LIBM_ALIAS(vrza_csqrt, FN_PROTOTYPE(vrza_csqrt));
+WEAK_LIBM_ALIAS(vrza_csqrt_split, FN_PROTOTYPE(vrza_csqrt_split));
+WEAK_LIBM_ALIAS(vrca_csqrtf, FN_PROTOTYPE(vrca_csqrtf));
+WEAK_LIBM_ALIAS(vrca_csqrtf_split, FN_PROTOTYPE(vrca_csqrtf_split));
+WEAK_LIBM_ALIAS(vrz4_cabs, FN_PROTOTYPE(vrz4_cabs));
+WEAK_LIBM_ALIAS(vrz8_cabs, FN_PROTOTYPE(vrz8_cabs));
+WEAK_LIBM_ALIAS(vrc8_cabsf, FN_PROTOTYPE(vrc8_cabsf));
+WEAK_LIBM_ALIAS(vrc16_cabsf, FN_PROTOTYPE(vrc16_cabsf));
+WEAK_LIBM_ALIAS(vrza_cabs, FN_PROTOTYPE(vrza_cabs));
+WEAK_LIBM_ALIAS(vrza_cabs_split, FN_PROTOTYPE(vrza_cabs_split));
+WEAK_LIBM_ALIAS(vrca_cabsf, FN_PROTOTYPE(vrca_cabsf));
+WEAK_LIBM_ALIAS(vrca_cabsf_split, FN_PROTOTYPE(vrca_cabsf_split));
+WEAK_LIBM_ALIAS(vrz4_carg, FN_PROTOTYPE(vrz4_carg));
+WEAK_LIBM_ALIAS(vrz8_carg, FN_PROTOTYPE(vrz8_carg));
+WEAK_LIBM_ALIAS(vrc8_cargf, FN_PROTOTYPE(vrc8_cargf));
+WEAK_LIBM_ALIAS(vrc16_cargf, FN_PROTOTYPE(vrc16_cargf));
+WEAK_LIBM_ALIAS(vrza_carg, FN_PROTOTYPE(vrza_carg));
+WEAK_LIBM_ALIAS(vrza_carg_split, FN_PROTOTYPE(vrza_carg_split));
+WEAK_LIBM_ALIAS(vrca_cargf, FN_PROTOTYPE(vrca_cargf));
+WEAK_LIBM_ALIAS(vrca_cargf_split, FN_PROTOTYPE(vrca_cargf_split));
+WEAK_LIBM_ALIAS(vrz4_csin, FN_PROTOTYPE(vrz4_csin));
+WEAK_LIBM_ALIAS(vrz8_csin, FN_PROTOTYPE(vrz8_csin));
+WEAK_LIBM_ALIAS(vrc8_csinf, FN_PROTOTYPE(vrc8_csinf));
+WEAK_LIBM_ALIAS(vrc16_csinf, FN_PROTOTYPE(vrc16_csinf));
+WEAK_LIBM_ALIAS(vrza_csin, FN_PROTOTYPE(vrza_csin));
+WEAK_LIBM_ALIAS(vrza_csin_split, FN_PROTOTYPE(vrza_csin_split));
+WEAK_LIBM_ALIAS(vrca_csinf, FN_PROTOTYPE(vrca_csinf));
+WEAK_LIBM_ALIAS(vrca_csinf_split, FN_PROTOTYPE(vrca_csinf_split));
+WEAK_LIBM_ALIAS(vrz4_ccos, FN_PROTOTYPE(vrz4_ccos));
+WEAK_LIBM_ALIAS(vrz8_ccos, FN_PROTOTYPE(vrz8_ccos));
+WEAK_LIBM_ALIAS(vrc8_ccosf, FN_PROTOTYPE(vrc8_ccosf));
+WEAK_LIBM_ALIAS(vrc16_ccosf, FN_PROTOTYPE(vrc16_ccosf));
+WEAK_LIBM_ALIAS(vrza_ccos, FN_PROTOTYPE(vrza_ccos));
+WEAK_LIBM_ALIAS(vrza_ccos_split, FN_PROTOTYPE(vrza_ccos_split));
+WEAK_LIBM_ALIAS(vrca_ccosf, FN_PROTOTYPE(vrca_ccosf));
+WEAK_LIBM_ALIAS(vrca_ccosf_split, FN_PROTOTYPE(vrca_ccosf_split));
+WEAK_LIBM_ALIAS(vrz4_ctan, FN_PROTOTYPE(vrz4_ctan));
+WEAK_LIBM_ALIAS(vrz8_ctan, FN_PROTOTYPE(vrz8_ctan));
+WEAK_LIBM_ALIAS(vrc8_ctanf, FN_PROTOTYPE(vrc8_ctanf));
+WEAK_LIBM_ALIAS(vrc16_ctanf, FN_PROTOTYPE(vrc16_ctanf));
+WEAK_LIBM_ALIAS(vrza_ctan, FN_PROTOTYPE(vrza_ctan));
+WEAK_LIBM_ALIAS(vrza_ctan_split, FN_PROTOTYPE(vrza_ctan_split));
+WEAK_LIBM_ALIAS(vrca_ctanf, FN_PROTOTYPE(vrca_ctanf));
+WEAK_LIBM_ALIAS(vrca_ctanf_split, FN_PROTOTYPE(vrca_ctanf_split));
+WEAK_LIBM_ALIAS(vrz4_csinh, FN_PROTOTYPE(vrz4_csinh));
+WEAK_LIBM_ALIAS(vrz8_csinh, FN_PROTOTYPE(vrz8_csinh));
+WEAK_LIBM_ALIAS(vrc8_csinhf, FN_PROTOTYPE(vrc8_csinhf));
+WEAK_LIBM_ALIAS(vrc16_csinhf, FN_PROTOTYPE(vrc16_csinhf));
+WEAK_LIBM_ALIAS(vrza_csinh, FN_PROTOTYPE(vrza_csinh));
+WEAK_LIBM_ALIAS(vrza_csinh_split, FN_PROTOTYPE(vrza_csinh_split));
+WEAK_LIBM_ALIAS(vrca_csinhf, FN_PROTOTYPE(vrca_csinhf));
+WEAK_LIBM_ALIAS(vrca_csinhf_split, FN_PROTOTYPE(vrca_csinhf_split));
+WEAK_LIBM_ALIAS(vrz4_ccosh, FN_PROTOTYPE(vrz4_ccosh));
+WEAK_LIBM_ALIAS(vrz8_ccosh, FN_PROTOTYPE(vrz8_ccosh));
+WEAK_LIBM_ALIAS(vrc8_ccoshf, FN_PROTOTYPE(vrc8_ccoshf));
+WEAK_LIBM_ALIAS(vrc16_ccoshf, FN_PROTOTYPE(vrc16_ccoshf));
+WEAK_LIBM_ALIAS(vrza_ccosh, FN_PROTOTYPE(vrza_ccosh));
+WEAK_LIBM_ALIAS(vrza_ccosh_split, FN_PROTOTYPE(vrza_ccosh_split));
+WEAK_LIBM_ALIAS(vrca_ccoshf, FN_PROTOTYPE(vrca_ccoshf));
+WEAK_LIBM_ALIAS(vrca_ccoshf_split, FN_PROTOTYPE(vrca_ccoshf_split));
+WEAK_LIBM_ALIAS(vrz4_ctanh, FN_PROTOTYPE(vrz4_ctanh));
+WEAK_LIBM_ALIAS(vrz8_ctanh, FN_PROTOTYPE(vrz8_ctanh));
+WEAK_LIBM_ALIAS(vrc8_ctanhf, FN_PROTOTYPE(vrc8_ctanhf));
+WEAK_LIBM_ALIAS(vrc16_ctanhf, FN_PROTOTYPE(vrc16_ctanhf));
+WEAK_LIBM_ALIAS(vrza_ctanh, FN_PROTOTYPE(vrza_ctanh));
+WEAK_LIBM_ALIAS(vrza_ctanh_split, FN_PROTOTYPE(vrza_ctanh_split));
+WEAK_LIBM_ALIAS(vrca_ctanhf, FN_PROTOTYPE(vrca_ctanhf));
+WEAK_LIBM_ALIAS(vrca_ctanhf_split, FN_PROTOTYPE(vrca_ctanhf_split));
 /*
  * SWLCSG-2283 & CPUPL-4422 - Weak Aliases with "__" prefix in order
  * to support GLIBC's "-mveclibabi=acml" option.
@@ -186,6 +186,8 @@ ALM_PROTO_FAST(acos)(double x)
     return (result);
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__acos_finite, ALM_PROTO_FAST(acos))
 weak_alias (amd_acos, ALM_PROTO_FAST(acos))
 weak_alias (acos, ALM_PROTO_FAST(acos))
+#endif
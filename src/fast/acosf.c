@@ -173,6 +173,8 @@ ALM_PROTO_FAST(acosf)(float x)
 
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__acosf_finite, ALM_PROTO_FAST(acosf))
 weak_alias (amd_acosf, ALM_PROTO_FAST(acosf))
 weak_alias (acosf, ALM_PROTO_FAST(acosf))
+#endif
@@ -170,6 +170,8 @@ ALM_PROTO_FAST(asin)(double x)
     return (sign*result) ;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__asin_finite, ALM_PROTO_FAST(asin))
 weak_alias (amd_asin, ALM_PROTO_FAST(asin))
 weak_alias (asin, ALM_PROTO_FAST(asin))
+#endif
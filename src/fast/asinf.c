@@ -127,6 +127,8 @@ ALM_PROTO_FAST(asinf)(float x)
     return sign*result;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__asinf_finite, ALM_PROTO_FAST(asinf))
 weak_alias (amd_asinf, ALM_PROTO_FAST(asinf))
 weak_alias (asinf, ALM_PROTO_FAST(asinf))
+#endif
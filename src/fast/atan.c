@@ -138,6 +138,8 @@ ALM_PROTO_FAST(atan)(double x)
     return asdouble(asuint64(result) ^ sign);
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__atan_finite, ALM_PROTO_FAST(atan))
 weak_alias (amd_atan, ALM_PROTO_FAST(atan))
 weak_alias (atan, ALM_PROTO_FAST(atan))
+#endif
@@ -126,6 +126,8 @@ ALM_PROTO_FAST(atanf)(float x)
     return asfloat(asuint32(result) ^ sign);
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__atanf_finite, ALM_PROTO_FAST(atanf))
 weak_alias (amd_atanf, ALM_PROTO_FAST(atanf))
-weak_alias (atanf, ALM_PROTO_FAST(atanf))
\ No newline at end of file
+weak_alias (atanf, ALM_PROTO_FAST(atanf))
+#endif
@@ -198,6 +198,8 @@ ALM_PROTO_FAST(cos)(double x)
 
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__cos_finite, ALM_PROTO_FAST(cos))
 weak_alias (amd_cos, ALM_PROTO_FAST(cos))
-weak_alias (cos, ALM_PROTO_FAST(cos))
\ No newline at end of file
+weak_alias (cos, ALM_PROTO_FAST(cos))
+#endif
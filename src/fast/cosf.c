@@ -148,6 +148,8 @@ ALM_PROTO_FAST(cosf)(float x)
 
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__cosf_finite, ALM_PROTO_FAST(cosf))
 weak_alias (amd_cosf, ALM_PROTO_FAST(cosf))
 weak_alias (cosf, ALM_PROTO_FAST(cosf))
+#endif
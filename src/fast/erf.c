@@ -114,6 +114,8 @@ double ALM_PROTO_FAST(erf)(double x) {
     return result;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__erf_finite, ALM_PROTO_FAST(erf))
 weak_alias (amd_erf, ALM_PROTO_FAST(erf))
 weak_alias (erf, ALM_PROTO_FAST(erf))
+#endif
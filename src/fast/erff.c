@@ -197,6 +197,8 @@ float ALM_PROTO_FAST(erff)(float _x) {
 
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__erff_finite, ALM_PROTO_FAST(erff))
 weak_alias (amd_erff, ALM_PROTO_FAST(erff))
-weak_alias (erff, ALM_PROTO_FAST(erff))
\ No newline at end of file
+weak_alias (erff, ALM_PROTO_FAST(erff))
+#endif
@@ -242,6 +242,8 @@ ALM_PROTO_FAST(exp)(double x) {
     return q1.d;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__exp_finite, ALM_PROTO_FAST(exp))
 weak_alias (amd_exp, ALM_PROTO_FAST(exp))
 weak_alias (exp, ALM_PROTO_FAST(exp))
+#endif
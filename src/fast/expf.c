@@ -68,7 +68,9 @@
 #include <libm/compiler.h>
 #include <libm/amd_funcs_internal.h>
 #include <libm/poly.h>
+#ifndef ALM_FAST_TIER
 #include "alm_special.c"
+#endif
 
 #define EXPF_N 6
 #define EXPF_TABLE_SIZE (1 << EXPF_N)
@@ -162,6 +164,8 @@ ALM_PROTO_FAST(expf)(float x) {
 }
 
 
+#ifndef ALM_FAST_TIER
 strong_alias (__expf_finite, ALM_PROTO_FAST(expf))
 weak_alias (amd_expf, ALM_PROTO_FAST(expf))
 weak_alias (expf, ALM_PROTO_FAST(expf))
+#endif
@@ -73,7 +73,12 @@
 #if N == 8
 #define POLY_DEGREE 6
 
+#ifndef ALM_FAST_TIER
 #include "log_tables.c"
+#else
+extern uint64_t log_f_inv_256[];
+extern double log_table_256[];
+#endif
 
 #define TAB_F_INV log_f_inv_256
 #define TAB_LOG   log_table_256
@@ -306,6 +311,8 @@ ALM_PROTO_FAST(log)(double x) {
     return q;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__log_finite, ALM_PROTO_FAST(log))
 weak_alias (amd_log, ALM_PROTO_FAST(log))
 weak_alias (log, ALM_PROTO_FAST(log))
+#endif
@@ -117,7 +117,9 @@ ALM_PROTO_FAST(logf)(float x)
     return r;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__logf_finite, ALM_PROTO_FAST(logf))
 weak_alias (logf, ALM_PROTO_FAST(logf))
 weak_alias (amd_logf, ALM_PROTO_FAST(logf))
 strong_alias (__ieee754_logf, ALM_PROTO_FAST(logf))
+#endif
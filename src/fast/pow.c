@@ -57,7 +57,23 @@
 #include <libm/poly.h>
 #include <libm/amd_funcs_internal.h>
 
+#ifndef ALM_FAST_TIER
 #include "../optimized/pow_data.c"
+#else
+struct log_data {
+    uint64_t head;
+    uint64_t tail;
+};
+
+struct exp_data {
+    uint64_t head;
+    uint64_t tail;
+};
+
+extern struct log_data log_Finv[];
+extern struct log_data log_f_256[];
+extern struct exp_data exp_lookup[];
+#endif
 
 #define L__exp_bias 0x00000000000003ff /* 1023 */
 #define L__mant_mask 0x000fffffffffffff
@@ -569,6 +585,8 @@ ALM_PROTO_FAST(pow)(double x, double y) {
     return result;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__pow_finite, ALM_PROTO_FAST(pow))
 weak_alias (amd_pow, ALM_PROTO_FAST(pow))
-weak_alias (pow, ALM_PROTO_FAST(pow))
\ No newline at end of file
+weak_alias (pow, ALM_PROTO_FAST(pow))
+#endif
@@ -455,6 +455,8 @@ float ALM_PROTO_FAST(powf)(float x, float y)
     return (float)result;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__powf_finite, ALM_PROTO_FAST(powf))
 weak_alias (amd_powf, ALM_PROTO_FAST(powf))
 weak_alias (powf, ALM_PROTO_FAST(powf))
+#endif
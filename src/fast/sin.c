@@ -201,6 +201,8 @@ ALM_PROTO_FAST(sin)(double x)
     return result;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__sin_finite, ALM_PROTO_FAST(sin))
 weak_alias (amd_sin, ALM_PROTO_FAST(sin))
-weak_alias (sin, ALM_PROTO_FAST(sin))
\ No newline at end of file
+weak_alias (sin, ALM_PROTO_FAST(sin))
+#endif
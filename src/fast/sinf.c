@@ -133,6 +133,8 @@ ALM_PROTO_FAST(sinf)(float x)
     return result;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__sinf_finite, ALM_PROTO_FAST(sinf))
 weak_alias (amd_sinf, ALM_PROTO_FAST(sinf))
-weak_alias (sinf, ALM_PROTO_FAST(sinf))
\ No newline at end of file
+weak_alias (sinf, ALM_PROTO_FAST(sinf))
+#endif
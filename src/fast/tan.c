@@ -209,6 +209,8 @@ ALM_PROTO_FAST(tan)(double x)
     return result;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__tan_finite, ALM_PROTO_FAST(tan))
 weak_alias (amd_tan, ALM_PROTO_FAST(tan))
 weak_alias (tan, ALM_PROTO_FAST(tan))
+#endif
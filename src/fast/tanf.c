@@ -158,6 +158,8 @@ ALM_PROTO_FAST(tanf)(float x)
     return result;
 }
 
+#ifndef ALM_FAST_TIER
 strong_alias (__tanf_finite, ALM_PROTO_FAST(tanf))
 weak_alias (amd_tanf, ALM_PROTO_FAST(tanf))
-weak_alias (tanf, ALM_PROTO_FAST(tanf))
\ No newline at end of file
+weak_alias (tanf, ALM_PROTO_FAST(tanf))
+#endif
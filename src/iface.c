@@ -26,103 +26,131 @@
  */
 
 #include <stddef.h>                     /* for NULL */
+#include <string.h>
 
 #ifdef USE_AOCL_UTILS
 #include "alci/arch.h"
 #endif
 #include <libm/entry_pt.h>
 #include <libm/iface.h>
+#include <libm/alm_capture.h>
 
 
 struct entry_pt_interface entry_pt_initializers[C_AMD_LAST_ENTRY] = {
-    [C_AMD_ACOS]       = {LIBM_IFACE_PROTO(acos), NULL},
-    [C_AMD_ACOSH]      = {LIBM_IFACE_PROTO(acosh), NULL},
-    [C_AMD_ASIN]       = {LIBM_IFACE_PROTO(asin), NULL},
-    [C_AMD_ASINH]      = {LIBM_IFACE_PROTO(asinh), NULL},
-    [C_AMD_ATAN2]      = {LIBM_IFACE_PROTO(atan2), NULL},
-    [C_AMD_ATAN]       = {LIBM_IFACE_PROTO(atan), NULL},
-    [C_AMD_ATANH]      = {LIBM_IFACE_PROTO(atanh), NULL},
-    [C_AMD_CBRT]       = {LIBM_IFACE_PROTO(cbrt), NULL},
-    [C_AMD_CEIL]       = {LIBM_IFACE_PROTO(ceil), NULL},
-    [C_AMD_COPYSIGN]   = {LIBM_IFACE_PROTO(copysign), NULL},
-    [C_AMD_COS]        = {LIBM_IFACE_PROTO(cos), NULL},
-    [C_AMD_COSH]       = {LIBM_IFACE_PROTO(cosh), NULL},
-    [C_AMD_COSPI]      = {LIBM_IFACE_PROTO(cospi), NULL},
-    [C_AMD_EXP10]      = {LIBM_IFACE_PROTO(exp10), NULL},
-    [C_AMD_EXP2]       = {LIBM_IFACE_PROTO(exp2), NULL},
-    [C_AMD_EXP]        = {LIBM_IFACE_PROTO(exp), NULL},
-    [C_AMD_EXPM1]      = {LIBM_IFACE_PROTO(expm1), NULL},
-    [C_AMD_FABS]       = {LIBM_IFACE_PROTO(fabs), NULL},
-    [C_AMD_FDIM]       = {LIBM_IFACE_PROTO(fdim), NULL},
-    [C_AMD_FLOOR]      = {LIBM_IFACE_PROTO(floor), NULL},
-    [C_AMD_FMA]        = {LIBM_IFACE_PROTO(fma), NULL},
-    [C_AMD_FMOD]       = {LIBM_IFACE_PROTO(fmod), NULL},
-    [C_AMD_FREXP]      = {LIBM_IFACE_PROTO(frexp), NULL},
-    [C_AMD_HYPOT]      = {LIBM_IFACE_PROTO(hypot), NULL},
-    [C_AMD_LDEXP]      = {LIBM_IFACE_PROTO(ldexp), NULL},
-    [C_AMD_LOG10]      = {LIBM_IFACE_PROTO(log10), NULL},
-    [C_AMD_LOG1P]      = {LIBM_IFACE_PROTO(log1p), NULL},
-    [C_AMD_LOG2]       = {LIBM_IFACE_PROTO(log2), NULL},
-    [C_AMD_LOGB]       = {LIBM_IFACE_PROTO(logb), NULL},
-    [C_AMD_LOG]        = {LIBM_IFACE_PROTO(log), NULL},
-    [C_AMD_MODF]       = {LIBM_IFACE_PROTO(modf), NULL},
-    [C_AMD_NAN]        = {LIBM_IFACE_PROTO(nan), NULL},
-    [C_AMD_NEARBYINT]  = {LIBM_IFACE_PROTO(nearbyint), NULL},
-    [C_AMD_NEXTAFTER]  = {LIBM_IFACE_PROTO(nextafter), NULL},
-    [C_AMD_NEXTTOWARD] = {LIBM_IFACE_PROTO(nexttoward), NULL},
-    [C_AMD_POW]        = {LIBM_IFACE_PROTO(pow), NULL},
-    [C_AMD_POWX]       = {LIBM_IFACE_PROTO(powx), NULL},
-    [C_AMD_REMAINDER]  = {LIBM_IFACE_PROTO(remainder), NULL},
-    [C_AMD_REMQUO]     = {LIBM_IFACE_PROTO(remquo), NULL},
-    [C_AMD_RINT]       = {LIBM_IFACE_PROTO(rint), NULL},
-    [C_AMD_ROUND]      = {LIBM_IFACE_PROTO(round), NULL},
-    [C_AMD_SCALBLN]    = {LIBM_IFACE_PROTO(scalbln), NULL},
-    [C_AMD_SCALBN]     = {LIBM_IFACE_PROTO(scalbn), NULL},
-    [C_AMD_SIN]        = {LIBM_IFACE_PROTO(sin), NULL},
-    [C_AMD_SINH]       = {LIBM_IFACE_PROTO(sinh), NULL},
-    [C_AMD_SINPI]      = {LIBM_IFACE_PROTO(sinpi), NULL},
-    [C_AMD_SQRT]       = {LIBM_IFACE_PROTO(sqrt), NULL},
-    [C_AMD_TAN]        = {LIBM_IFACE_PROTO(tan), NULL},
-    [C_AMD_TANH]       = {LIBM_IFACE_PROTO(tanh), NULL},
-    [C_AMD_TANPI]      = {LIBM_IFACE_PROTO(tanpi), NULL},
-    [C_AMD_TRUNC]      = {LIBM_IFACE_PROTO(trunc), NULL},
-    [C_AMD_ERF]        = {LIBM_IFACE_PROTO(erf), NULL},
-    [C_AMD_ERFC]       = {LIBM_IFACE_PROTO(erfc), NULL},
-    [C_AMD_ERFINV]     = {LIBM_IFACE_PROTO(erfinv), NULL},
-    [C_AMD_ERFCINV]    = {LIBM_IFACE_PROTO(erfcinv), NULL},
-    [C_AMD_SINCOS]     = {LIBM_IFACE_PROTO(sincos), NULL},
-    [C_AMD_CDFNORM]    = {LIBM_IFACE_PROTO(cdfnorm), NULL},
-    [C_AMD_CDFNORMINV] = {LIBM_IFACE_PROTO(cdfnorminv), NULL},
+    [C_AMD_ACOS]       = {LIBM_IFACE_PROTO(acos), NULL, "acos"},
+    [C_AMD_ACOSH]      = {LIBM_IFACE_PROTO(acosh), NULL, "acosh"},
+    [C_AMD_ASIN]       = {LIBM_IFACE_PROTO(asin), NULL, "asin"},
+    [C_AMD_ASINH]      = {LIBM_IFACE_PROTO(asinh), NULL, "asinh"},
+    [C_AMD_ATAN2]      = {LIBM_IFACE_PROTO(atan2), NULL, "atan2"},
+    [C_AMD_ATAN]       = {LIBM_IFACE_PROTO(atan), NULL, "atan"},
+    [C_AMD_ATANH]      = {LIBM_IFACE_PROTO(atanh), NULL, "atanh"},
+    [C_AMD_CBRT]       = {LIBM_IFACE_PROTO(cbrt), NULL, "cbrt"},
+    [C_AMD_CEIL]       = {LIBM_IFACE_PROTO(ceil), NULL, "ceil"},
+    [C_AMD_COPYSIGN]   = {LIBM_IFACE_PROTO(copysign), NULL, "copysign"},
+    [C_AMD_COS]        = {LIBM_IFACE_PROTO(cos), NULL, "cos"},
+    [C_AMD_COSH]       = {LIBM_IFACE_PROTO(cosh), NULL, "cosh"},
+    [C_AMD_COSPI]      = {LIBM_IFACE_PROTO(cospi), NULL, "cospi"},
+    [C_AMD_EXP10]      = {LIBM_IFACE_PROTO(exp10), NULL, "exp10"},
+    [C_AMD_EXP2]       = {LIBM_IFACE_PROTO(exp2), NULL, "exp2"},
+    [C_AMD_EXP]        = {LIBM_IFACE_PROTO(exp), NULL, "exp"},
+    [C_AMD_EXPM1]      = {LIBM_IFACE_PROTO(expm1), NULL, "expm1"},
+    [C_AMD_FABS]       = {LIBM_IFACE_PROTO(fabs), NULL, "fabs"},
+    [C_AMD_FDIM]       = {LIBM_IFACE_PROTO(fdim), NULL, "fdim"},
+    [C_AMD_FLOOR]      = {LIBM_IFACE_PROTO(floor), NULL, "floor"},
+    [C_AMD_FMA]        = {LIBM_IFACE_PROTO(fma), NULL, "fma"},
+    [C_AMD_FMOD]       = {LIBM_IFACE_PROTO(fmod), NULL, "fmod"},
+    [C_AMD_FREXP]      = {LIBM_IFACE_PROTO(frexp), NULL, "frexp"},
+    [C_AMD_HYPOT]      = {LIBM_IFACE_PROTO(hypot), NULL, "hypot"},
+    [C_AMD_LDEXP]      = {LIBM_IFACE_PROTO(ldexp), NULL, "ldexp"},
+    [C_AMD_LOG10]      = {LIBM_IFACE_PROTO(log10), NULL, "log10"},
+    [C_AMD_LOG1P]      = {LIBM_IFACE_PROTO(log1p), NULL, "log1p"},
+    [C_AMD_LOG2]       = {LIBM_IFACE_PROTO(log2), NULL, "log2"},
+    [C_AMD_LOGB]       = {LIBM_IFACE_PROTO(logb), NULL, "logb"},
+    [C_AMD_LOG]        = {LIBM_IFACE_PROTO(log), NULL, "log"},
+    [C_AMD_MODF]       = {LIBM_IFACE_PROTO(modf), NULL, "modf"},
+    [C_AMD_NAN]        = {LIBM_IFACE_PROTO(nan), NULL, "nan"},
+    [C_AMD_NEARBYINT]  = {LIBM_IFACE_PROTO(nearbyint), NULL, "nearbyint"},
+    [C_AMD_NEXTAFTER]  = {LIBM_IFACE_PROTO(nextafter), NULL, "nextafter"},
+    [C_AMD_NEXTTOWARD] = {LIBM_IFACE_PROTO(nexttoward), NULL, "nexttoward"},
+    [C_AMD_POW]        = {LIBM_IFACE_PROTO(pow), NULL, "pow"},
+    [C_AMD_POWX]       = {LIBM_IFACE_PROTO(powx), NULL, "powx"},
+    [C_AMD_POWI]       = {LIBM_IFACE_PROTO(powi), NULL, "powi"},
+    [C_AMD_REMAINDER]  = {LIBM_IFACE_PROTO(remainder), NULL, "remainder"},
+    [C_AMD_REMQUO]     = {LIBM_IFACE_PROTO(remquo), NULL, "remquo"},
+    [C_AMD_RINT]       = {LIBM_IFACE_PROTO(rint), NULL, "rint"},
+    [C_AMD_ROUND]      = {LIBM_IFACE_PROTO(round), NULL, "round"},
+    [C_AMD_SCALBLN]    = {LIBM_IFACE_PROTO(scalbln), NULL, "scalbln"},
+    [C_AMD_SCALBN]     = {LIBM_IFACE_PROTO(scalbn), NULL, "scalbn"},
+    [C_AMD_SIN]        = {LIBM_IFACE_PROTO(sin), NULL, "sin"},
+    [C_AMD_SINH]       = {LIBM_IFACE_PROTO(sinh), NULL, "sinh"},
+    [C_AMD_SINPI]      = {LIBM_IFACE_PROTO(sinpi), NULL, "sinpi"},
+    [C_AMD_SQRT]       = {LIBM_IFACE_PROTO(sqrt), NULL, "sqrt"},
+    [C_AMD_TAN]        = {LIBM_IFACE_PROTO(tan), NULL, "tan"},
+    [C_AMD_TANH]       = {LIBM_IFACE_PROTO(tanh), NULL, "tanh"},
+    [C_AMD_TANPI]      = {LIBM_IFACE_PROTO(tanpi), NULL, "tanpi"},
+    [C_AMD_TRUNC]      = {LIBM_IFACE_PROTO(trunc), NULL, "trunc"},
+    [C_AMD_ERF]        = {LIBM_IFACE_PROTO(erf), NULL, "erf"},
+    [C_AMD_ERFC]       = {LIBM_IFACE_PROTO(erfc), NULL, "erfc"},
+    [C_AMD_ERFINV]     = {LIBM_IFACE_PROTO(erfinv), NULL, "erfinv"},
+    [C_AMD_ERFCINV]    = {LIBM_IFACE_PROTO(erfcinv), NULL, "erfcinv"},
+    [C_AMD_SINCOS]     = {LIBM_IFACE_PROTO(sincos), NULL, "sincos"},
+    [C_AMD_CDFNORM]    = {LIBM_IFACE_PROTO(cdfnorm), NULL, "cdfnorm"},
+    [C_AMD_CDFNORMINV] = {LIBM_IFACE_PROTO(cdfnorminv), NULL, "cdfnorminv"},
+    [C_AMD_SIGMOID]    = {LIBM_IFACE_PROTO(sigmoid), NULL, "sigmoid"},
+    [C_AMD_GELU]       = {LIBM_IFACE_PROTO(gelu), NULL, "gelu"},
+    [C_AMD_GELU_TANH]  = {LIBM_IFACE_PROTO(gelu_tanh), NULL, "gelu_tanh"},
+    [C_AMD_SOFTPLUS]   = {LIBM_IFACE_PROTO(softplus), NULL, "softplus"},
+    [C_AMD_SILU]       = {LIBM_IFACE_PROTO(silu), NULL, "silu"},
+    [C_AMD_MISH]       = {LIBM_IFACE_PROTO(mish), NULL, "mish"},
+    [C_AMD_SOFTMAX]    = {LIBM_IFACE_PROTO(softmax), NULL, "softmax"},
+    [C_AMD_SOFTMAX_BATCH] = {LIBM_IFACE_PROTO(softmax_batch), NULL, "softmax_batch"},
+    [C_AMD_LOG_SOFTMAX] = {LIBM_IFACE_PROTO(log_softmax), NULL, "log_softmax"},
+    [C_AMD_LOG_SOFTMAX_BATCH] = {LIBM_IFACE_PROTO(log_softmax_batch), NULL, "log_softmax_batch"},
+    [C_AMD_RANDN]      = {LIBM_IFACE_PROTO(randn), NULL, "randn"},
+    [C_AMD_RSQRT]      = {LIBM_IFACE_PROTO(rsqrt), NULL, "rsqrt"},
+    [C_AMD_RSQRT_FAST] = {LIBM_IFACE_PROTO(rsqrt_fast), NULL, "rsqrt_fast"},
+    [C_AMD_RSQRT_CR]   = {LIBM_IFACE_PROTO(rsqrt_cr), NULL, "rsqrt_cr"},
+    [C_AMD_RECIP]      = {LIBM_IFACE_PROTO(recip), NULL, "recip"},
+    [C_AMD_RECIP_FAST] = {LIBM_IFACE_PROTO(recip_fast), NULL, "recip_fast"},
 
     /* Integer variants */
-    [C_AMD_FINITE]     = {LIBM_IFACE_PROTO(finite), NULL},
-    [C_AMD_ILOGB]      = {LIBM_IFACE_PROTO(ilogb), NULL},
-    [C_AMD_LRINT]      = {LIBM_IFACE_PROTO(lrint), NULL},
-    [C_AMD_LROUND]     = {LIBM_IFACE_PROTO(lround), NULL},
-    [C_AMD_LLRINT]     = {LIBM_IFACE_PROTO(llrint), NULL},
-    [C_AMD_LLROUND]    = {LIBM_IFACE_PROTO(llround), NULL},
+    [C_AMD_FINITE]     = {LIBM_IFACE_PROTO(finite), NULL, "finite"},
+    [C_AMD_ILOGB]      = {LIBM_IFACE_PROTO(ilogb), NULL, "ilogb"},
+    [C_AMD_LRINT]      = {LIBM_IFACE_PROTO(lrint), NULL, "lrint"},
+    [C_AMD_LROUND]     = {LIBM_IFACE_PROTO(lround), NULL, "lround"},
+    [C_AMD_LLRINT]     = {LIBM_IFACE_PROTO(llrint), NULL, "llrint"},
+    [C_AMD_LLROUND]    = {LIBM_IFACE_PROTO(llround), NULL, "llround"},
 
     /*complex*/
-    [C_AMD_CEXP]       = {LIBM_IFACE_PROTO(cexp), NULL},
-    [C_AMD_CPOW]       = {LIBM_IFACE_PROTO(cpow), NULL},
-    [C_AMD_CLOG]       = {LIBM_IFACE_PROTO(clog), NULL},
+    [C_AMD_CEXP]       = {LIBM_IFACE_PROTO(cexp), NULL, "cexp"},
+    [C_AMD_CPOW]       = {LIBM_IFACE_PROTO(cpow), NULL, "cpow"},
+    [C_AMD_CLOG]       = {LIBM_IFACE_PROTO(clog), NULL, "clog"},
+    [C_AMD_CSQRT]      = {LIBM_IFACE_PROTO(csqrt), NULL, "csqrt"},
+    [C_AMD_CABS]       = {LIBM_IFACE_PROTO(cabs), NULL, "cabs"},
+    [C_AMD_CARG]       = {LIBM_IFACE_PROTO(carg), NULL, "carg"},
+    [C_AMD_CSIN]       = {LIBM_IFACE_PROTO(csin), NULL, "csin"},
+    [C_AMD_CCOS]       = {LIBM_IFACE_PROTO(ccos), NULL, "ccos"},
+    [C_AMD_CTAN]       = {LIBM_IFACE_PROTO(ctan), NULL, "ctan"},
+    [C_AMD_CSINH]      = {LIBM_IFACE_PROTO(csinh), NULL, "csinh"},
+    [C_AMD_CCOSH]      = {LIBM_IFACE_PROTO(ccosh), NULL, "ccosh"},
+    [C_AMD_CTANH]      = {LIBM_IFACE_PROTO(ctanh), NULL, "ctanh"},
 
     /* Arithmetic */
-    [C_AMD_ADD]       = {LIBM_IFACE_PROTO(add), NULL},
-    [C_AMD_SUB]       = {LIBM_IFACE_PROTO(sub), NULL},
-    [C_AMD_MUL]       = {LIBM_IFACE_PROTO(mul), NULL},
-    [C_AMD_DIV]       = {LIBM_IFACE_PROTO(div), NULL},
-    [C_AMD_FMAX]      = {LIBM_IFACE_PROTO(fmax), NULL},
-    [C_AMD_FMIN]       = {LIBM_IFACE_PROTO(fmin), NULL},
-
-    [C_AMD_ADDI]       = {LIBM_IFACE_PROTO(addi), NULL},
-    [C_AMD_SUBI]       = {LIBM_IFACE_PROTO(subi), NULL},
-    [C_AMD_MULI]       = {LIBM_IFACE_PROTO(muli), NULL},
-    [C_AMD_DIVI]       = {LIBM_IFACE_PROTO(divi), NULL},
-    [C_AMD_FMAXI]      = {LIBM_IFACE_PROTO(fmaxi), NULL},
-    [C_AMD_FMINI]      = {LIBM_IFACE_PROTO(fmini), NULL},
-
-    [C_AMD_LINEARFRAC]      = {LIBM_IFACE_PROTO(linearfrac), NULL},
+    [C_AMD_ADD]       = {LIBM_IFACE_PROTO(add), NULL, "add"},
+    [C_AMD_SUB]       = {LIBM_IFACE_PROTO(sub), NULL, "sub"},
+    [C_AMD_MUL]       = {LIBM_IFACE_PROTO(mul), NULL, "mul"},
+    [C_AMD_DIV]       = {LIBM_IFACE_PROTO(div), NULL, "div"},
+    [C_AMD_FMAX]      = {LIBM_IFACE_PROTO(fmax), NULL, "fmax"},
+    [C_AMD_FMIN]       = {LIBM_IFACE_PROTO(fmin), NULL, "fmin"},
+
+    [C_AMD_ADDI]       = {LIBM_IFACE_PROTO(addi), NULL, "addi"},
+    [C_AMD_SUBI]       = {LIBM_IFACE_PROTO(subi), NULL, "subi"},
+    [C_AMD_MULI]       = {LIBM_IFACE_PROTO(muli), NULL, "muli"},
+    [C_AMD_DIVI]       = {LIBM_IFACE_PROTO(divi), NULL, "divi"},
+    [C_AMD_FMAXI]      = {LIBM_IFACE_PROTO(fmaxi), NULL, "fmaxi"},
+    [C_AMD_FMINI]      = {LIBM_IFACE_PROTO(fmini), NULL, "fmini"},
+
+    [C_AMD_LINEARFRAC]      = {LIBM_IFACE_PROTO(linearfrac), NULL, "linearfrac"},
 };
 
 #ifndef ARRAY_SIZE
@@ -143,6 +171,57 @@ libm_iface_init(void)
     }
 }
 
+/*
+ * Accuracy tiers: while an initializer is re-run by libm_iface_reinit(),
+ * alm_iface_fixup() takes each variant from the table of the tier asked
+ * for it, where the function has one, and from funcs[][] otherwise, and
+ * records the tier it installed.
+ */
+static const int *iface_tier;
+static int *iface_tier_got;
+
+int
+libm_iface_find(const char *name)
+{
+    int n = ARRAY_SIZE(entry_pt_initializers);
+
+    for (int i = 0; i < n; i++) {
+        const char *s = entry_pt_initializers[i].epi_name;
+        if (s && strcmp(s, name) == 0)
+            return i;
+    }
+
+    return -1;
+}
+
+/*
+ * tier[v] is the tier wanted for variant v. On return got[v] holds the
+ * tier installed, or -1 where the function has no such variant.
+ */
+int
+libm_iface_reinit(int idx, const int *tier, int *got)
+{
+    struct entry_pt_interface *ptr;
+
+    if (idx < 0 || idx >= (int)ARRAY_SIZE(entry_pt_initializers))
+        return -1;
+
+    ptr = &entry_pt_initializers[idx];
+    if (!ptr->epi_init)
+        return -1;
+
+    for (int i = 0; i < ALM_FUNC_VAR_MAX; i++)
+        got[i] = -1;
+
+    iface_tier = tier;
+    iface_tier_got = got;
+    ptr->epi_init(ptr->epi_arg);
+    iface_tier = NULL;
+    iface_tier_got = NULL;
+
+    return 0;
+}
+
 
 static alm_func_t
 alm_iface_fixup_one(const struct alm_arch_funcs *alm_funcs,
@@ -255,10 +334,25 @@ alm_iface_fixup(alm_ep_wrapper_t *g_ep_wrapper,
         alm_ep_func_t *gptr = g_ep_wrapper->g_ep[i];
 
         if (gptr) {
+            int t = iface_tier ? iface_tier[i] : ALM_ACC_TIER_1ULP;
+            alm_ep_func_t f = NULL;
+
+            if (t > ALM_ACC_TIER_1ULP && t < ALM_ACC_TIER_MAX &&
+                alm_funcs->tiers[t])
+                f = alm_iface_fixup_one(alm_funcs->tiers[t], arch_ver, i);
+
+            if (!f) {
+                t = ALM_ACC_TIER_1ULP;
+                f = alm_iface_fixup_one(alm_funcs, arch_ver, i);
+            }
+
             /* Overwrite only if find valid function */
-            alm_ep_func_t f = alm_iface_fixup_one(alm_funcs, arch_ver, i);
-            if (f)
+            if (f) {
                 *gptr = f;
+                alm_capture_fixup(gptr);
+                if (iface_tier_got)
+                    iface_tier_got[i] = t;
+            }
         }
     }
 }
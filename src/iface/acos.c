@@ -34,6 +34,18 @@
 #include <libm/arch/all.h>
 
 
+/* fast accuracy tier, see alm_set_accuracy() */
+static const
+struct alm_arch_funcs __arch_funcs_acos_fast = {
+    .def_arch = ALM_UARCH_VER_DEFAULT,
+    .funcs = {
+        [ALM_UARCH_VER_DEFAULT] = {
+            [ALM_FUNC_SCAL_SP] = &ALM_PROTO_FAST_TIER(acosf),
+            [ALM_FUNC_SCAL_DP] = &ALM_PROTO_FAST_TIER(acos),
+        },
+    }
+};
+
 static const
 struct alm_arch_funcs __arch_funcs_acos = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
@@ -124,6 +136,9 @@ struct alm_arch_funcs __arch_funcs_acos = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN5(vrda_acos),
         },
     },
+    .tiers = {
+        [ALM_ACC_TIER_FAST] = &__arch_funcs_acos_fast,
+    },
 };
 
 void
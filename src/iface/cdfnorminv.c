@@ -41,6 +41,11 @@ struct alm_arch_funcs __arch_funcs_cdfnorminv = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_AVX2(vrd4_cdfnorminv),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_cdfnorminv),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_cdfnorminv),
+            [ALM_FUNC_SCAL_SP]     = &ALM_PROTO_ARCH_AVX2(cdfnorminvf),
+            [ALM_FUNC_VECT_SP_4]   = &ALM_PROTO_ARCH_AVX2(vrs4_cdfnorminvf),
+            [ALM_FUNC_VECT_SP_8]   = &ALM_PROTO_ARCH_AVX2(vrs8_cdfnorminvf),
+            [ALM_FUNC_VECT_SP_16]  = &ALM_PROTO_ARCH_ZN4(vrs16_cdfnorminvf),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_cdfnorminvf),
         },
         [ALM_UARCH_VER_AVX512] = {
             [ALM_FUNC_SCAL_DP]     = &ALM_PROTO_ARCH_AVX512(cdfnorminv),
@@ -80,6 +85,7 @@ struct alm_arch_funcs __arch_funcs_cdfnorminv = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN4(vrd4_cdfnorminv),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_cdfnorminv),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_cdfnorminv),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_cdfnorminvf),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -102,6 +108,11 @@ LIBM_IFACE_PROTO(cdfnorminv)(void *arg)
         [ALM_FUNC_VECT_DP_4]   = &G_ENTRY_PT_PTR(vrd4_cdfnorminv),
         [ALM_FUNC_VECT_DP_8]   = &G_ENTRY_PT_PTR(vrd8_cdfnorminv),
         [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_cdfnorminv),
+        [ALM_FUNC_SCAL_SP]     = &G_ENTRY_PT_PTR(cdfnorminvf),
+        [ALM_FUNC_VECT_SP_4]   = &G_ENTRY_PT_PTR(vrs4_cdfnorminvf),
+        [ALM_FUNC_VECT_SP_8]   = &G_ENTRY_PT_PTR(vrs8_cdfnorminvf),
+        [ALM_FUNC_VECT_SP_16]  = &G_ENTRY_PT_PTR(vrs16_cdfnorminvf),
+        [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_cdfnorminvf),
         },
     };
 
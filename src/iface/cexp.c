@@ -39,6 +39,14 @@ struct alm_arch_funcs __arch_funcs_cexp = {
         [ALM_UARCH_VER_DEFAULT] = {
             [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_AVX2(cexpf),
             [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_AVX2(cexp),
+            [ALM_FUNC_VECT_DP_CMPLX_4] = &ALM_PROTO_ARCH_AVX2(vrz4_cexp),
+            [ALM_FUNC_VECT_DP_CMPLX_8] = &ALM_PROTO_ARCH_ZN4(vrz8_cexp),
+            [ALM_FUNC_VECT_SP_CMPLX_8] = &ALM_PROTO_ARCH_AVX2(vrc8_cexpf),
+            [ALM_FUNC_VECT_SP_CMPLX_16] = &ALM_PROTO_ARCH_ZN4(vrc16_cexpf),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_AVX2(vrza_cexp),
+            [ALM_FUNC_VECT_DP_CMPLX_SPLIT] = &ALM_PROTO_ARCH_AVX2(vrza_cexp_split),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_AVX2(vrca_cexpf),
+            [ALM_FUNC_VECT_SP_CMPLX_SPLIT] = &ALM_PROTO_ARCH_AVX2(vrca_cexpf_split),
         },
         [ALM_UARCH_VER_AVX512] = {
             [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_AVX512(cexpf),
@@ -63,6 +71,10 @@ struct alm_arch_funcs __arch_funcs_cexp = {
         [ALM_UARCH_VER_ZEN4] = {
             [ALM_FUNC_SCAL_SP_CMPLX] = &ALM_PROTO_ARCH_ZN4(cexpf),
             [ALM_FUNC_SCAL_DP_CMPLX] = &ALM_PROTO_ARCH_ZN4(cexp),
+            [ALM_FUNC_VECT_DP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN4(vrza_cexp),
+            [ALM_FUNC_VECT_DP_CMPLX_SPLIT] = &ALM_PROTO_ARCH_ZN4(vrza_cexp_split),
+            [ALM_FUNC_VECT_SP_CMPLX_ARR] = &ALM_PROTO_ARCH_ZN4(vrca_cexpf),
+            [ALM_FUNC_VECT_SP_CMPLX_SPLIT] = &ALM_PROTO_ARCH_ZN4(vrca_cexpf_split),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -78,6 +90,14 @@ LIBM_IFACE_PROTO(cexp)(void *arg) {
        .g_ep = {
            [ALM_FUNC_SCAL_SP_CMPLX] = &G_ENTRY_PT_PTR(cexpf),
            [ALM_FUNC_SCAL_DP_CMPLX] = &G_ENTRY_PT_PTR(cexp),
+           [ALM_FUNC_VECT_DP_CMPLX_4] = &G_ENTRY_PT_PTR(vrz4_cexp),
+           [ALM_FUNC_VECT_DP_CMPLX_8] = &G_ENTRY_PT_PTR(vrz8_cexp),
+           [ALM_FUNC_VECT_SP_CMPLX_8] = &G_ENTRY_PT_PTR(vrc8_cexpf),
+           [ALM_FUNC_VECT_SP_CMPLX_16] = &G_ENTRY_PT_PTR(vrc16_cexpf),
+           [ALM_FUNC_VECT_DP_CMPLX_ARR] = &G_ENTRY_PT_PTR(vrza_cexp),
+           [ALM_FUNC_VECT_DP_CMPLX_SPLIT] = &G_ENTRY_PT_PTR(vrza_cexp_split),
+           [ALM_FUNC_VECT_SP_CMPLX_ARR] = &G_ENTRY_PT_PTR(vrca_cexpf),
+           [ALM_FUNC_VECT_SP_CMPLX_SPLIT] = &G_ENTRY_PT_PTR(vrca_cexpf_split),
         },
     };
 
@@ -34,6 +34,18 @@
 #include <libm/arch/all.h>
 
 
+/* fast accuracy tier, see alm_set_accuracy() */
+static const
+struct alm_arch_funcs __arch_funcs_cos_fast = {
+    .def_arch = ALM_UARCH_VER_DEFAULT,
+    .funcs = {
+        [ALM_UARCH_VER_DEFAULT] = {
+            [ALM_FUNC_SCAL_SP] = &ALM_PROTO_FAST_TIER(cosf),
+            [ALM_FUNC_SCAL_DP] = &ALM_PROTO_FAST_TIER(cos),
+        },
+    }
+};
+
 static const
 struct alm_arch_funcs __arch_funcs_cos = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
@@ -49,6 +61,11 @@ struct alm_arch_funcs __arch_funcs_cos = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_cos),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_cosf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_cos),
+            [ALM_FUNC_SCAL_HP]     = &ALM_PROTO_ARCH_AVX2(cosf16),
+            [ALM_FUNC_VECT_HP_8]   = &ALM_PROTO_ARCH_AVX2(vrh8_cosf16),
+            [ALM_FUNC_VECT_HP_16]  = &ALM_PROTO_ARCH_AVX2(vrh16_cosf16),
+            [ALM_FUNC_VECT_HP_32]  = &ALM_PROTO_ARCH_ZN4(vrh32_cosf16), /* v32h */
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_cosf16),
         },
 
         [ALM_UARCH_VER_AVX512] = {
@@ -114,6 +131,7 @@ struct alm_arch_funcs __arch_funcs_cos = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_cos),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_cosf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_cos),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_cosf16),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -129,6 +147,9 @@ struct alm_arch_funcs __arch_funcs_cos = {
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_cos),
         },
     },
+    .tiers = {
+        [ALM_ACC_TIER_FAST] = &__arch_funcs_cos_fast,
+    },
 };
 
 void
@@ -145,6 +166,11 @@ LIBM_IFACE_PROTO(cos)(void *arg) {
             [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_cos),
             [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_cosf),
             [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_cos),
+            [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(cosf16),
+            [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_cosf16),
+            [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_cosf16),
+            [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_cosf16),
+            [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_cosf16),
         },
     };
 
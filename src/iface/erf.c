@@ -32,6 +32,18 @@
 #include <libm/arch/all.h>
 
 
+/* fast accuracy tier, see alm_set_accuracy() */
+static const
+struct alm_arch_funcs __arch_funcs_erf_fast = {
+    .def_arch = ALM_UARCH_VER_DEFAULT,
+    .funcs = {
+        [ALM_UARCH_VER_DEFAULT] = {
+            [ALM_FUNC_SCAL_SP] = &ALM_PROTO_FAST_TIER(erff),
+            [ALM_FUNC_SCAL_DP] = &ALM_PROTO_FAST_TIER(erf),
+        },
+    }
+};
+
 static const
 struct alm_arch_funcs __arch_funcs_erf = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
@@ -47,6 +59,12 @@ struct alm_arch_funcs __arch_funcs_erf = {
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_erf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_erff),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_erf),
+            [ALM_FUNC_SCAL_HP]     = &ALM_PROTO_ARCH_AVX2(erff16),
+            [ALM_FUNC_VECT_HP_8]   = &ALM_PROTO_ARCH_AVX2(vrh8_erff16),
+            [ALM_FUNC_VECT_HP_16]  = &ALM_PROTO_ARCH_AVX2(vrh16_erff16),
+            [ALM_FUNC_VECT_HP_32]  = &ALM_PROTO_ARCH_ZN4(vrh32_erff16), /* v32h */
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_erff16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_erfbf16),
         },
 
         [ALM_UARCH_VER_AVX512] = {
@@ -112,6 +130,8 @@ struct alm_arch_funcs __arch_funcs_erf = {
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_erf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_erff),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_erf),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_erff16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_erfbf16),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -127,6 +147,9 @@ struct alm_arch_funcs __arch_funcs_erf = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN5(vrda_erf),
         },
     },
+    .tiers = {
+        [ALM_ACC_TIER_FAST] = &__arch_funcs_erf_fast,
+    },
 };
 
 void
@@ -144,6 +167,12 @@ LIBM_IFACE_PROTO(erf)(void *arg)
         [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_erf),
         [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_erff),
         [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_erf),
+        [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(erff16),
+        [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_erff16),
+        [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_erff16),
+        [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_erff16),
+        [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_erff16),
+        [ALM_FUNC_VECT_BF16_ARR] = &G_ENTRY_PT_PTR(vrba_erfbf16),
         },
     };
 
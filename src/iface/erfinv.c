@@ -42,6 +42,11 @@ struct alm_arch_funcs __arch_funcs_erfinv = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_AVX2(vrd4_erfinv),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_erfinv),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_erfinv),
+            [ALM_FUNC_SCAL_SP]     = &ALM_PROTO_ARCH_AVX2(erfinvf),
+            [ALM_FUNC_VECT_SP_4]   = &ALM_PROTO_ARCH_AVX2(vrs4_erfinvf),
+            [ALM_FUNC_VECT_SP_8]   = &ALM_PROTO_ARCH_AVX2(vrs8_erfinvf),
+            [ALM_FUNC_VECT_SP_16]  = &ALM_PROTO_ARCH_ZN4(vrs16_erfinvf),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_erfinvf),
         },
 
         [ALM_UARCH_VER_AVX512] = {
@@ -82,6 +87,7 @@ struct alm_arch_funcs __arch_funcs_erfinv = {
             [ALM_FUNC_VECT_DP_4] = &ALM_PROTO_ARCH_ZN4(vrd4_erfinv),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_erfinv),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_erfinv),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_erfinvf),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -104,6 +110,11 @@ LIBM_IFACE_PROTO(erfinv)(void *arg)
         [ALM_FUNC_VECT_DP_4] = &G_ENTRY_PT_PTR(vrd4_erfinv),
         [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_erfinv),
         [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_erfinv),
+        [ALM_FUNC_SCAL_SP]     = &G_ENTRY_PT_PTR(erfinvf),
+        [ALM_FUNC_VECT_SP_4]   = &G_ENTRY_PT_PTR(vrs4_erfinvf),
+        [ALM_FUNC_VECT_SP_8]   = &G_ENTRY_PT_PTR(vrs8_erfinvf),
+        [ALM_FUNC_VECT_SP_16]  = &G_ENTRY_PT_PTR(vrs16_erfinvf),
+        [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_erfinvf),
         },
     };
 
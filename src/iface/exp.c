@@ -32,6 +32,26 @@
 #include <libm/arch/all.h>
 
 
+/* fast accuracy tier, see alm_set_accuracy() */
+static const
+struct alm_arch_funcs __arch_funcs_exp_fast = {
+    .def_arch = ALM_UARCH_VER_DEFAULT,
+    .funcs = {
+        [ALM_UARCH_VER_DEFAULT] = {
+            [ALM_FUNC_SCAL_SP]     = &ALM_PROTO_FAST_TIER(expf),
+            [ALM_FUNC_SCAL_DP]     = &ALM_PROTO_FAST_TIER(exp),
+            [ALM_FUNC_VECT_SP_8]   = &ALM_PROTO_ARCH_AVX2(vrs8_exp_fastf),
+            [ALM_FUNC_VECT_SP_16]  = &ALM_PROTO_ARCH_ZN4(vrs16_exp_fastf),
+            [ALM_FUNC_VECT_DP_8]   = &ALM_PROTO_ARCH_ZN4(vrd8_exp_fast),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_exp_fastf),
+        },
+        [ALM_UARCH_VER_ZEN4] = {
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_exp_fastf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_exp_fast),
+        },
+    }
+};
+
 static const
 struct alm_arch_funcs __arch_funcs_exp = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
@@ -47,6 +67,12 @@ struct alm_arch_funcs __arch_funcs_exp = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_exp),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_expf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_exp),
+            [ALM_FUNC_SCAL_HP]     = &ALM_PROTO_ARCH_AVX2(expf16),
+            [ALM_FUNC_VECT_HP_8]   = &ALM_PROTO_ARCH_AVX2(vrh8_expf16),
+            [ALM_FUNC_VECT_HP_16]  = &ALM_PROTO_ARCH_AVX2(vrh16_expf16),
+            [ALM_FUNC_VECT_HP_32]  = &ALM_PROTO_ARCH_ZN4(vrh32_expf16), /* v32h */
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_expf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_expbf16),
         },
 
         [ALM_UARCH_VER_AVX512] = {
@@ -112,6 +138,8 @@ struct alm_arch_funcs __arch_funcs_exp = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_exp),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_expf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_exp),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_expf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_expbf16),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -127,6 +155,9 @@ struct alm_arch_funcs __arch_funcs_exp = {
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_exp),
         },
     },
+    .tiers = {
+        [ALM_ACC_TIER_FAST] = &__arch_funcs_exp_fast,
+    },
 };
 
 void
@@ -143,6 +174,12 @@ LIBM_IFACE_PROTO(exp)(void *arg) {
         [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_exp),
         [ALM_FUNC_VECT_SP_16]  = &G_ENTRY_PT_PTR(vrs16_expf),
         [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_exp),
+        [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(expf16),
+        [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_expf16),
+        [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_expf16),
+        [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_expf16),
+        [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_expf16),
+        [ALM_FUNC_VECT_BF16_ARR] = &G_ENTRY_PT_PTR(vrba_expbf16),
         },
     };
 
@@ -33,6 +33,28 @@
 #include <libm/arch/all.h>
 
 
+/* fast accuracy tier, see alm_set_accuracy() */
+static const
+struct alm_arch_funcs __arch_funcs_log_fast = {
+    .def_arch = ALM_UARCH_VER_DEFAULT,
+    .funcs = {
+        [ALM_UARCH_VER_DEFAULT] = {
+            [ALM_FUNC_SCAL_SP]     = &ALM_PROTO_FAST_TIER(logf),
+            [ALM_FUNC_SCAL_DP]     = &ALM_PROTO_FAST_TIER(log),
+            [ALM_FUNC_VECT_SP_8]   = &ALM_PROTO_ARCH_AVX2(vrs8_log_fastf),
+            [ALM_FUNC_VECT_SP_16]  = &ALM_PROTO_ARCH_ZN4(vrs16_log_fastf),
+            [ALM_FUNC_VECT_DP_4]   = &ALM_PROTO_ARCH_AVX2(vrd4_log_fast),
+            [ALM_FUNC_VECT_DP_8]   = &ALM_PROTO_ARCH_ZN4(vrd8_log_fast),
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_log_fastf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_log_fast),
+        },
+        [ALM_UARCH_VER_ZEN4] = {
+            [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_log_fastf),
+            [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_log_fast),
+        },
+    }
+};
+
 static const
 struct alm_arch_funcs __arch_funcs_log = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
@@ -47,7 +69,13 @@ struct alm_arch_funcs __arch_funcs_log = {
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_logf),  /*vector array variants*/
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_log),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_logf),
-            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_log)
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_log),
+            [ALM_FUNC_SCAL_HP]     = &ALM_PROTO_ARCH_AVX2(logf16),
+            [ALM_FUNC_VECT_HP_8]   = &ALM_PROTO_ARCH_AVX2(vrh8_logf16),
+            [ALM_FUNC_VECT_HP_16]  = &ALM_PROTO_ARCH_AVX2(vrh16_logf16),
+            [ALM_FUNC_VECT_HP_32]  = &ALM_PROTO_ARCH_ZN4(vrh32_logf16), /* v32h */
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_logf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_logbf16),
         },
 
 
@@ -114,6 +142,8 @@ struct alm_arch_funcs __arch_funcs_log = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_log),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_logf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_log),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_logf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_logbf16),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -129,6 +159,9 @@ struct alm_arch_funcs __arch_funcs_log = {
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_log),
         },
     },
+    .tiers = {
+        [ALM_ACC_TIER_FAST] = &__arch_funcs_log_fast,
+    },
 };
 
 void
@@ -145,6 +178,12 @@ LIBM_IFACE_PROTO(log)(void *arg) {
             [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_log),
             [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_logf),
             [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_log),
+            [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(logf16),
+            [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_logf16),
+            [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_logf16),
+            [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_logf16),
+            [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_logf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &G_ENTRY_PT_PTR(vrba_logbf16),
         },
     };
 
@@ -33,6 +33,18 @@
 #include <libm/arch/all.h>
 
 
+/* fast accuracy tier, see alm_set_accuracy() */
+static const
+struct alm_arch_funcs __arch_funcs_pow_fast = {
+    .def_arch = ALM_UARCH_VER_DEFAULT,
+    .funcs = {
+        [ALM_UARCH_VER_DEFAULT] = {
+            [ALM_FUNC_SCAL_SP] = &ALM_PROTO_FAST_TIER(powf),
+            [ALM_FUNC_SCAL_DP] = &ALM_PROTO_FAST_TIER(pow),
+        },
+    }
+};
+
 static const
 struct alm_arch_funcs __arch_funcs_pow = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
@@ -128,6 +140,9 @@ struct alm_arch_funcs __arch_funcs_pow = {
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN5(vrd8_pow),
         },
     },
+    .tiers = {
+        [ALM_ACC_TIER_FAST] = &__arch_funcs_pow_fast,
+    },
 };
 
 void
@@ -34,6 +34,18 @@
 #include <libm/arch/all.h>
 
 
+/* fast accuracy tier, see alm_set_accuracy() */
+static const
+struct alm_arch_funcs __arch_funcs_sin_fast = {
+    .def_arch = ALM_UARCH_VER_DEFAULT,
+    .funcs = {
+        [ALM_UARCH_VER_DEFAULT] = {
+            [ALM_FUNC_SCAL_SP] = &ALM_PROTO_FAST_TIER(sinf),
+            [ALM_FUNC_SCAL_DP] = &ALM_PROTO_FAST_TIER(sin),
+        },
+    }
+};
+
 static const
 struct alm_arch_funcs __arch_funcs_sin = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
@@ -48,7 +60,12 @@ struct alm_arch_funcs __arch_funcs_sin = {
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_sinf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_sin),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_sinf),
-            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_sin)
+            [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_sin),
+            [ALM_FUNC_SCAL_HP]     = &ALM_PROTO_ARCH_AVX2(sinf16),
+            [ALM_FUNC_VECT_HP_8]   = &ALM_PROTO_ARCH_AVX2(vrh8_sinf16),
+            [ALM_FUNC_VECT_HP_16]  = &ALM_PROTO_ARCH_AVX2(vrh16_sinf16),
+            [ALM_FUNC_VECT_HP_32]  = &ALM_PROTO_ARCH_ZN4(vrh32_sinf16), /* v32h */
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_sinf16),
         },
 
         [ALM_UARCH_VER_AVX512] = {
@@ -115,6 +132,7 @@ struct alm_arch_funcs __arch_funcs_sin = {
 
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_sinf),
             [ALM_FUNC_VECT_DP_8] = &ALM_PROTO_ARCH_ZN4(vrd8_sin),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_sinf16),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -132,6 +150,9 @@ struct alm_arch_funcs __arch_funcs_sin = {
         },
 
     },
+    .tiers = {
+        [ALM_ACC_TIER_FAST] = &__arch_funcs_sin_fast,
+    },
 };
 
 void
@@ -148,6 +169,11 @@ LIBM_IFACE_PROTO(sin)(void *arg) {
             [ALM_FUNC_VECT_DP_8] = &G_ENTRY_PT_PTR(vrd8_sin),
             [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_sinf),
             [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_sin),
+            [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(sinf16),
+            [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_sinf16),
+            [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_sinf16),
+            [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_sinf16),
+            [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_sinf16),
         },
     };
 
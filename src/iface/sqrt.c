@@ -48,6 +48,11 @@ struct alm_arch_funcs __arch_funcs_sqrt = {
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_sqrtf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_sqrtf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_AVX2(vrda_sqrt),
+            [ALM_FUNC_SCAL_HP]     = &ALM_PROTO_ARCH_AVX2(sqrtf16),
+            [ALM_FUNC_VECT_HP_8]   = &ALM_PROTO_ARCH_AVX2(vrh8_sqrtf16),
+            [ALM_FUNC_VECT_HP_16]  = &ALM_PROTO_ARCH_AVX2(vrh16_sqrtf16),
+            [ALM_FUNC_VECT_HP_32]  = &ALM_PROTO_ARCH_ZN4(vrh32_sqrtf16), /* v32h */
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_sqrtf16),
         },
 
         [ALM_UARCH_VER_AVX512] = {
@@ -113,6 +118,7 @@ struct alm_arch_funcs __arch_funcs_sqrt = {
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_sqrtf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_sqrtf),
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN4(vrda_sqrt),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_sqrtf16),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -144,6 +150,11 @@ LIBM_IFACE_PROTO(sqrt)(void *arg) {
             [ALM_FUNC_VECT_SP_16] = &G_ENTRY_PT_PTR(vrs16_sqrtf),
             [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_sqrtf),
             [ALM_FUNC_VECT_DP_ARR] = &G_ENTRY_PT_PTR(vrda_sqrt),
+            [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(sqrtf16),
+            [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_sqrtf16),
+            [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_sqrtf16),
+            [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_sqrtf16),
+            [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_sqrtf16),
         },
     };
 
@@ -34,6 +34,18 @@
 #include <libm/arch/all.h>
 
 
+/* fast accuracy tier, see alm_set_accuracy() */
+static const
+struct alm_arch_funcs __arch_funcs_tan_fast = {
+    .def_arch = ALM_UARCH_VER_DEFAULT,
+    .funcs = {
+        [ALM_UARCH_VER_DEFAULT] = {
+            [ALM_FUNC_SCAL_SP] = &ALM_PROTO_FAST_TIER(tanf),
+            [ALM_FUNC_SCAL_DP] = &ALM_PROTO_FAST_TIER(tan),
+        },
+    }
+};
+
 static const
 struct alm_arch_funcs __arch_funcs_tan = {
     .def_arch = ALM_UARCH_VER_DEFAULT,
@@ -131,6 +143,9 @@ struct alm_arch_funcs __arch_funcs_tan = {
             [ALM_FUNC_VECT_DP_ARR] = &ALM_PROTO_ARCH_ZN5(vrda_tan),
         },
     },
+    .tiers = {
+        [ALM_ACC_TIER_FAST] = &__arch_funcs_tan_fast,
+    },
 };
 
 void
@@ -45,6 +45,12 @@ struct alm_arch_funcs __arch_funcs_tanh = {
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_AVX2(vrs8_tanhf), /* v8s ? */
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_tanhf), /* v16s */
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_AVX2(vrsa_tanhf),
+            [ALM_FUNC_SCAL_HP]     = &ALM_PROTO_ARCH_AVX2(tanhf16),
+            [ALM_FUNC_VECT_HP_8]   = &ALM_PROTO_ARCH_AVX2(vrh8_tanhf16),
+            [ALM_FUNC_VECT_HP_16]  = &ALM_PROTO_ARCH_AVX2(vrh16_tanhf16),
+            [ALM_FUNC_VECT_HP_32]  = &ALM_PROTO_ARCH_ZN4(vrh32_tanhf16), /* v32h */
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_AVX2(vrha_tanhf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_AVX2(vrba_tanhbf16),
         },
 
         [ALM_UARCH_VER_AVX512] = {
@@ -90,6 +96,8 @@ struct alm_arch_funcs __arch_funcs_tanh = {
             [ALM_FUNC_VECT_SP_8] = &ALM_PROTO_ARCH_ZN4(vrs8_tanhf),
             [ALM_FUNC_VECT_SP_16] = &ALM_PROTO_ARCH_ZN4(vrs16_tanhf),
             [ALM_FUNC_VECT_SP_ARR] = &ALM_PROTO_ARCH_ZN4(vrsa_tanhf),
+            [ALM_FUNC_VECT_HP_ARR] = &ALM_PROTO_ARCH_ZN4(vrha_tanhf16),
+            [ALM_FUNC_VECT_BF16_ARR] = &ALM_PROTO_ARCH_ZN4(vrba_tanhbf16),
         },
 
         [ALM_UARCH_VER_ZEN5] = {
@@ -114,6 +122,12 @@ LIBM_IFACE_PROTO(tanh)(void *arg) {
           [ALM_FUNC_VECT_SP_8] = &G_ENTRY_PT_PTR(vrs8_tanhf),
           [ALM_FUNC_VECT_SP_16] = &G_ENTRY_PT_PTR(vrs16_tanhf),
           [ALM_FUNC_VECT_SP_ARR] = &G_ENTRY_PT_PTR(vrsa_tanhf),
+          [ALM_FUNC_SCAL_HP] = &G_ENTRY_PT_PTR(tanhf16),
+          [ALM_FUNC_VECT_HP_8] = &G_ENTRY_PT_PTR(vrh8_tanhf16),
+          [ALM_FUNC_VECT_HP_16] = &G_ENTRY_PT_PTR(vrh16_tanhf16),
+          [ALM_FUNC_VECT_HP_32] = &G_ENTRY_PT_PTR(vrh32_tanhf16),
+          [ALM_FUNC_VECT_HP_ARR] = &G_ENTRY_PT_PTR(vrha_tanhf16),
+          [ALM_FUNC_VECT_BF16_ARR] = &G_ENTRY_PT_PTR(vrba_tanhbf16),
         },
     };
 
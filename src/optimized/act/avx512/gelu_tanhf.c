@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   v_f32x16_t vrs16_gelu_tanhf(v_f32x16_t x)
+ *   void vrsa_gelu_tanhf(int len, const float *src, float *dst)
+ *
+ * Computes the tanh approximation of GELU, x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 x^3))), 16 lanes at a time.
+ * See ../gelu_tanhf.c for the implementation notes.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+
+#include <libm/arch/zen4.h>
+
+#define ALM_ACT_VLEN 16
+#include <libm/alm_activation.h>
+
+v_f32x16_t
+ALM_PROTO_ARCH_ZN4(vrs16_gelu_tanhf)(v_f32x16_t x)
+{
+    return act_gelu_tanh(x);
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrsa_gelu_tanhf)(int len, const float *src, float *dst)
+{
+    act_apply_array(act_gelu_tanh, len, src, dst);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   void vrda_log_softmax(int len, const double *src, double *dst)
+ *   void vrda_log_softmax_batch(int rows, int cols,
+ *                               const double *src, int src_stride,
+ *                               double *dst, int dst_stride)
+ *
+ * Computes (x[i] - max(x)) - log(sum(exp(x[j] - max(x))))
+ * over each row, 8 lanes at a time. The batch variant treats src and dst
+ * as rows x cols matrices with the given row strides, in elements.
+ * See ../log_softmax.c for the implementation notes.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+
+#include <libm/arch/zen4.h>
+
+#define ALM_ACT_VLEN 8
+#define ALM_ACT_DOUBLE
+#include <libm/alm_activation.h>
+
+void
+ALM_PROTO_ARCH_ZN4(vrda_log_softmax)(int len, const double *src, double *dst)
+{
+    if (len <= 0)
+        return;
+
+    act_log_softmax_row(len, src, dst, ALM_PROTO(log));
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrda_log_softmax_batch)(int rows, int cols,
+                                           const double *src, int src_stride,
+                                           double *dst, int dst_stride)
+{
+    if (cols <= 0)
+        return;
+
+    for (int i = 0; i < rows; i++) {
+        const double *s = src + (ptrdiff_t)i * src_stride;
+        double *d = dst + (ptrdiff_t)i * dst_stride;
+
+        act_log_softmax_row(cols, s, d, ALM_PROTO(log));
+    }
+}
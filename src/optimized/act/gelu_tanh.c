@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   v_f64x4_t vrd4_gelu_tanh(v_f64x4_t x)
+ *   void vrda_gelu_tanh(int len, const double *src, double *dst)
+ *
+ * Computes the tanh approximation of GELU, x/2 * (1 + tanh(sqrt(2/pi) * (x + 0.044715 x^3))), 4 lanes at a time.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * Evaluated as x * sigmoid(w), w = 2*sqrt(2/pi) * (x + 0.044715 x^3),
+ * which is the same function without a tanh and without cancellation
+ * for x < 0.
+ *
+ * gelu_tanh(-Inf) = -0, gelu_tanh(+Inf) = +Inf, NaN propagates.
+ *
+ * The array variant runs the same kernel inline, one masked load/store
+ * for the tail, with no intermediate arrays. See
+ * include/libm/alm_activation.h for the kernels.
+ *
+ * Max ULP: 4.5
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 4
+#include <libm/alm_activation.h>
+
+v_f64x4_t
+ALM_PROTO_ARCH_AVX2(vrd4_gelu_tanh)(v_f64x4_t x)
+{
+    return act_gelu_tanh(x);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrda_gelu_tanh)(int len, const double *src, double *dst)
+{
+    act_apply_array(act_gelu_tanh, len, src, dst);
+}
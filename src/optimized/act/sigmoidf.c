@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   v_f32x8_t vrs8_sigmoidf(v_f32x8_t x)
+ *   void vrsa_sigmoidf(int len, const float *src, float *dst)
+ *
+ * Computes the logistic sigmoid 1/(1 + exp(-x)), 8 lanes at a time.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * e = exp(-|x|), then 1/(1 + e) for x >= 0 and e/(1 + e) for x < 0, so
+ * that neither side overflows. The exp() scale is applied after the
+ * multiply by 1/(1 + e), so subnormal results are rounded once.
+ *
+ * sigmoid(-Inf) = 0, sigmoid(+Inf) = 1, NaN propagates.
+ *
+ * The array variant runs the same kernel inline, one masked load/store
+ * for the tail, with no intermediate arrays. See
+ * include/libm/alm_activation.h for the kernels.
+ *
+ * Max ULP: 3
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_VLEN 8
+#include <libm/alm_activation.h>
+
+v_f32x8_t
+ALM_PROTO_ARCH_AVX2(vrs8_sigmoidf)(v_f32x8_t x)
+{
+    return act_sigmoid(x);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrsa_sigmoidf)(int len, const float *src, float *dst)
+{
+    act_apply_array(act_sigmoid, len, src, dst);
+}
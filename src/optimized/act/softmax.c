@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   void vrda_softmax(int len, const double *src, double *dst)
+ *   void vrda_softmax_batch(int rows, int cols,
+ *                           const double *src, int src_stride,
+ *                           double *dst, int dst_stride)
+ *
+ * Computes exp(x[i] - max(x)) / sum(exp(x[j] - max(x)))
+ * over each row, 4 lanes at a time. The batch variant treats src and dst
+ * as rows x cols matrices with the given row strides, in elements.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * Two passes over the row. The first reads it once and keeps, per lane,
+ * the running maximum and the compensated sum of exp(x - max), rescaling
+ * the sum once per block of vectors only when the maximum grew. The
+ * second writes exp(x - M) * (1/S), with x - M carried exactly as a
+ * double-word so that outputs far below the maximum keep their relative
+ * accuracy. The lane sums are merged in double.
+ *
+ * -Inf inputs give 0. A row holding NaN or +Inf, or only -Inf, gives NaN
+ * throughout.
+ *
+ * See include/libm/alm_activation.h for the kernels.
+ *
+ * Max ULP: 5
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_VLEN 4
+#define ALM_ACT_DOUBLE
+#include <libm/alm_activation.h>
+
+void
+ALM_PROTO_ARCH_AVX2(vrda_softmax)(int len, const double *src, double *dst)
+{
+    if (len <= 0)
+        return;
+
+    act_softmax_row(len, src, dst);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrda_softmax_batch)(int rows, int cols,
+                                        const double *src, int src_stride,
+                                        double *dst, int dst_stride)
+{
+    if (cols <= 0)
+        return;
+
+    for (int i = 0; i < rows; i++) {
+        const double *s = src + (ptrdiff_t)i * src_stride;
+        double *d = dst + (ptrdiff_t)i * dst_stride;
+
+        act_softmax_row(cols, s, d);
+    }
+}
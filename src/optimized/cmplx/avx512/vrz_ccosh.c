@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   void vrz8_ccosh(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim)
+ *   void vrc16_ccoshf(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim)
+ *   void vrza_ccosh(int len, const double *x, double *y)
+ *   void vrza_ccosh_split(int len, const double *xre, const double *xim,
+ *                         double *yre, double *yim)
+ *   void vrca_ccoshf(int len, const float *x, float *y)
+ *   void vrca_ccoshf_split(int len, const float *xre, const float *xim,
+ *                          float *yre, float *yim)
+ *
+ * Computes the complex hyperbolic cosine of 8 complex
+ * doubles or 16 complex floats at a time.
+ * See ../vrz_ccosh.c for the implementation notes.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/amd_funcs_internal.h>
+
+#include <libm/arch/zen4.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 8
+#include <libm/alm_complex.h>
+
+void
+ALM_PROTO_ARCH_ZN4(vrz8_ccosh)(__m512d xre, __m512d xim, __m512d *yre, __m512d *yim)
+{
+    act_vf_t re, im;
+
+    cpx_ccosh(xre, xim, &re, &im);
+    *yre = re;
+    *yim = im;
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrc16_ccoshf)(__m512 xre, __m512 xim, __m512 *yre, __m512 *yim)
+{
+    nrm_vf_t re, im;
+
+    cpx_ccoshf(xre, xim, &re, &im);
+    *yre = re;
+    *yim = im;
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrza_ccosh)(int len, const double *x, double *y)
+{
+    cpx_ccosh_array(len, x, y);
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrza_ccosh_split)(int len, const double *xre, const double *xim,
+                                     double *yre, double *yim)
+{
+    cpx_ccosh_array_split(len, xre, xim, yre, yim);
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrca_ccoshf)(int len, const float *x, float *y)
+{
+    cpx_ccoshf_array(len, x, y);
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrca_ccoshf_split)(int len, const float *xre, const float *xim,
+                                      float *yre, float *yim)
+{
+    cpx_ccoshf_array_split(len, xre, xim, yre, yim);
+}
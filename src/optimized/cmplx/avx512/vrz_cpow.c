@@ -0,0 +1,109 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   void vrz8_cpow(__m512d xre, __m512d xim, __m512d yre, __m512d yim,
+ *                  __m512d *zre, __m512d *zim)
+ *   void vrc16_cpowf(__m512 xre, __m512 xim, __m512 yre, __m512 yim,
+ *                    __m512 *zre, __m512 *zim)
+ *   void vrza_cpow(int len, const double *x, const double *y, double *z)
+ *   void vrza_cpow_split(int len, const double *xre, const double *xim,
+ *                        const double *yre, const double *yim,
+ *                        double *zre, double *zim)
+ *   void vrca_cpowf(int len, const float *x, const float *y, float *z)
+ *   void vrca_cpowf_split(int len, const float *xre, const float *xim,
+ *                         const float *yre, const float *yim,
+ *                         float *zre, float *zim)
+ *
+ * Computes the complex power x^y of 8 complex
+ * doubles or 16 complex floats at a time.
+ * See ../vrz_cpow.c for the implementation notes.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/amd_funcs_internal.h>
+
+#include <libm/arch/zen4.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 8
+#include <libm/alm_complex.h>
+
+void
+ALM_PROTO_ARCH_ZN4(vrz8_cpow)(__m512d xre, __m512d xim, __m512d yre, __m512d yim,
+                              __m512d *zre, __m512d *zim)
+{
+    act_vf_t re, im;
+
+    cpx_cpow(xre, xim, yre, yim, &re, &im);
+    *zre = re;
+    *zim = im;
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrc16_cpowf)(__m512 xre, __m512 xim, __m512 yre, __m512 yim,
+                                __m512 *zre, __m512 *zim)
+{
+    nrm_vf_t re, im;
+
+    cpx_cpowf(xre, xim, yre, yim, &re, &im);
+    *zre = re;
+    *zim = im;
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrza_cpow)(int len, const double *x, const double *y, double *z)
+{
+    cpx_cpow_array(len, x, y, z);
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrza_cpow_split)(int len, const double *xre, const double *xim,
+                                    const double *yre, const double *yim,
+                                    double *zre, double *zim)
+{
+    cpx_cpow_array_split(len, xre, xim, yre, yim, zre, zim);
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrca_cpowf)(int len, const float *x, const float *y, float *z)
+{
+    cpx_cpowf_array(len, x, y, z);
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrca_cpowf_split)(int len, const float *xre, const float *xim,
+                                     const float *yre, const float *yim,
+                                     float *zre, float *zim)
+{
+    cpx_cpowf_array_split(len, xre, xim, yre, yim, zre, zim);
+}
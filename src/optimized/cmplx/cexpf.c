@@ -61,11 +61,11 @@
 /* Underflow threshold: approximately log(FLT_MIN) */
 #define CEXPF_UNDERFLOW_THRESHOLD -103.0f
 
-/* Overflow threshold for scaled computation */
+/* Largest argument for which expf does not overflow */
 #define CEXPF_MAX_ARG 0x1.62e42ep6f
 
-/* Maximum representable value before expf overflows */
-#define CEXPF_EXP_MAX_ARG 0x1.fffffep127f
+/* Below log(FLT_MIN) expf is subnormal */
+#define CEXPF_MIN_NORMAL_ARG -0x1.5d589ep6f
 
 fc32_t
 ALM_PROTO_OPT(cexpf)(fc32_t z)
@@ -233,16 +233,18 @@ ALM_PROTO_OPT(cexpf)(fc32_t z)
         } else {
             /* General case: finite nonzero real and imaginary */
 
-            if (re > CEXPF_MAX_ARG) {
-                /* Potential overflow case - split computation to avoid premature overflow */
-                float t = re - CEXPF_MAX_ARG;
-                ALM_PROTO(sincosf)(im, &sin_im, &cos_im);
-                float r = ALM_PROTO(expf)(t);
+            if (re > CEXPF_MAX_ARG || re < CEXPF_MIN_NORMAL_ARG) {
+                /*
+                 * expf(re) overflows or is subnormal: take exp(re) in double
+                 * and round the products once, so results near the float
+                 * overflow and underflow thresholds stay within an ulp.
+                 */
+                double e = ALM_PROTO(exp)((double)re);
 
-                zy_re = r * cos_im * CEXPF_EXP_MAX_ARG;
-                zy_im = r * sin_im * CEXPF_EXP_MAX_ARG;
+                ALM_PROTO(sincosf)(im, &sin_im, &cos_im);
+                zy_re = (float)(e * cos_im);
+                zy_im = (float)(e * sin_im);
 
-                /* Check if result overflowed */
                 uint32_t a_zy_re = asuint32(zy_re);
                 uint32_t a_zy_im = asuint32(zy_im);
 
@@ -253,23 +255,12 @@ ALM_PROTO_OPT(cexpf)(fc32_t z)
                     #else
                         return alm_cexpf_special(CMPLXF(zy_re, zy_im), ALM_E_OVERFLOW);
                     #endif
-                }
-            } else if (re < CEXPF_UNDERFLOW_THRESHOLD) {
-                /* Potential underflow case */
-                float exp_re = ALM_PROTO(expf)(re);
-                if (exp_re == 0.0f) {
-                    ALM_PROTO(sincosf)(im, &sin_im, &cos_im);
-                    zy_re = exp_re * cos_im;
-                    zy_im = exp_re * sin_im;
+                } else if (zy_re == 0.0f && zy_im == 0.0f) {
                     #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
                         return alm_cexpf_special((fc32_t) { zy_re, zy_im }, ALM_E_UNDERFLOW);
                     #else
                         return alm_cexpf_special(CMPLXF(zy_re, zy_im), ALM_E_UNDERFLOW);
                     #endif
-                } else {
-                    ALM_PROTO(sincosf)(im, &sin_im, &cos_im);
-                    zy_re = exp_re * cos_im;
-                    zy_im = exp_re * sin_im;
                 }
             } else {
                 /* Normal computation */
@@ -30,8 +30,6 @@
  * Signature:
  *   double complex clog(double complex x)
  *
- *   High ULP errors for values where absolute value of the complex input is close to 1.
- *
  *   IEEE SPEC:
  *
  *   If z = -0 + 0i, the result is -INFINITY + πi and FE_DIVBYZERO is raised
@@ -59,6 +57,10 @@
  *
  *   log(x) = log(r) + (I * theta)
  *
+ *   r^2 = a*a + b*b is kept as a double-double s + t, log(r) is then
+ *   0.5 * (log(s) + t/s), which stays accurate for r close to 1. Operands
+ *   outside [2^-500, 2^500] are scaled by 2^600 or 2^-600 first so that
+ *   the squares neither overflow nor underflow.
  *
  */
 #include <libm_util_amd.h>
@@ -71,16 +73,33 @@
 #include <libm/poly.h>
 #include <math.h>
 
+#define CLOG_BIG      0x1p500
+#define CLOG_SMALL    0x1p-500
+#define CLOG_SCALE_LN 0x1.9fe3682cd3be4p+8    /* 600 * ln(2) */
+
 fc64_t
 ALM_PROTO_OPT(clog)(fc64_t x) {
 
-    double theta, p, a, b, ah, al, bh, bl;
+    double theta, p, a, b, ah, al, bh, bl, k = 0.0;
 
     double asquare, bsquare, abs_h, abs_t;
 
-    a = creal(x);
+    theta = atan2(cimag(x), creal(x));
+
+    a = fabs(creal(x));
+
+    b = fabs(cimag(x));
+
+    /* An infinite part gives +inf even with a NaN in the other */
+    if (isinf(a) || isinf(b))
+        return CMPLX(INFINITY, theta);
 
-    b = cimag(x);
+    if (isnan(a) || isnan(b))
+        return CMPLX(a + b, theta);
+
+    /* -inf and FE_DIVBYZERO from log */
+    if (a == 0.0 && b == 0.0)
+        return CMPLX(log(a), theta);
 
     if(a < b) {
 
@@ -90,6 +109,16 @@ ALM_PROTO_OPT(clog)(fc64_t x) {
 
     }
 
+    if (a > CLOG_BIG) {
+        a *= 0x1p-600;
+        b *= 0x1p-600;
+        k = CLOG_SCALE_LN;
+    } else if (a < CLOG_SMALL) {
+        a *= 0x1p600;
+        b *= 0x1p600;
+        k = -CLOG_SCALE_LN;
+    }
+
     /*FIRST split a and b */
 
     ah = asdouble(asuint64(a) & 0xfffffffff8000000UL);
@@ -100,7 +129,7 @@ ALM_PROTO_OPT(clog)(fc64_t x) {
 
     bl = b - bh;
 
-    /*compute a * a + b * b using high precision two double word numbers */
+    /*compute a * a + b * b using high precision two double word numbers, a >= b */
 
     asquare = a * a;
 
@@ -111,11 +140,8 @@ ALM_PROTO_OPT(clog)(fc64_t x) {
     abs_t = (((asquare - abs_h) + bsquare) + ((ah * ah - asquare) + 2 * ah * al) + al * al) +
             ((bh * bh - bsquare) + 2 * bh * bl) + bl * bl;
 
-    p= 0.5 * log(abs_h + abs_t);
-
-    theta = atan2(cimag(x), creal(x));
+    p = 0.5 * (log(abs_h) + abs_t / abs_h) + k;
 
     return CMPLX(p, theta);
 
 }
-
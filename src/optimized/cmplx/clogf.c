@@ -56,6 +56,9 @@
  *
  *   log(x) = log(r) + (I * theta)
  *
+ *   r^2 is formed in double, where the squares of floats neither round nor
+ *   overflow. For a in [0.5, 2], log(r) is 0.5 * log1p((a - 1)(a + 1) + b*b)
+ *   with the larger part a, so the cancellation near r = 1 is exact.
  *
  */
 #include <math.h>
@@ -71,15 +74,28 @@ ALM_PROTO_OPT(clogf)(fc32_t x) {
 
     float theta, p;
 
-    double abs_x;
+    double a, b;
 
-    abs_x = (double)cabsf(x);
+    theta = atan2f(cimagf(x), crealf(x));
 
-    p = (float)log(abs_x);
+    a = fabs((double)crealf(x));
 
-    theta = atan2f(cimagf(x), crealf(x));
+    b = fabs((double)cimagf(x));
+
+    if (a < b) {
+        double t = a;
+        a = b;
+        b = t;
+    }
+
+    /* An infinite part gives +inf even with a NaN in the other */
+    if (isinf(a) || isinf(b))
+        p = INFINITY;
+    else if (a > 0.5 && a < 2.0)
+        p = (float)(0.5 * log1p((a - 1.0) * (a + 1.0) + b * b));
+    else
+        p = (float)(0.5 * log(a * a + b * b));
 
     return CMPLXF(p, theta);
 
 }
-
@@ -30,41 +30,15 @@
  * Signature:
  *   double complex cpow(double complex x, double complex y)
  *
+ *   Let x = a + I*b, y = c + I*d and l + I*t = clog(x)
  *
-  Implementation Notes
- * --------------------
- * Signature:
- *   float complex cpowf(float complex x, float complex y)
- *
- *   Let x = a + I*b
- *
- *   Let y = c + I*d
- *
- *   x^y = (a+i*b) ^ (c+i*b)
- *   x^y = (a+i*b)^c + (a+i*b)^(i*b) (1)
- *
- *   Expressing a + i*b in polar form,
- *   a + i*b = r*e^(i*θ) (2) where θ is the argument of the complex number = tan^(-1)⁡(b/a)
- *   and r is the magnitude of the complex number = √(a^2+ b^2 )
- *   Argument of a complex number can be computed using the cargs() function
- *    Magnitude of a complex number can be completed using cabs() function
+ *   x^y = cexp(y * clog(x)) = cexp((c*l - d*t) + I*(d*l + c*t))
  *
- *   Substituting (2) in (1) we get,
- *   x^y = (r*e^(i*θ))^c * (r*e^(i*θ))^(i*b)
- *   x^y = r^c * e^(i*θ*c) * r^(i*b) * e^(-θ*b)  as i * i = -1 (3)
+ *   clog keeps log|x| accurate for |x| close to 1, where pow(|x|, c) would
+ *   lose c ulp to the rounding of |x|; an error of an ulp in the exponent
+ *   w = y * clog(x) remains an error of |w| ulp in the result. The vector
+ *   and array variants compute the same expression.
  *
- *   r^(i*b)= e^(i*b*ln(r)) (4)
- *   Substituting (4) in (3), we get,
- *   x^y = r^c*e^(i*θ*c) * e^(i*b*ln⁡(r))*e^(-θ *b)
- *   x^y = r^c*e^(-θ*b) * e^(i* θ*c*b*ln(r))   (5)
- *   Let theta =  θ*c*b*ln(r)
- *   Substituting for theta in (5),
- *   x^y = r^c*e^(-θ*b)* e^(i*theta) (6)
- *
- *   e^(i*theta) = cos(theta) + i * sin(theta) (7)
- *   Substituting for (7) in (6), we get
-     x^y = r^c*e^(-θ*b)*(cos⁡(theta)+i*sin⁡(theta
-*
  */
 
 #include <libm_macros.h>
@@ -77,51 +51,22 @@
 fc64_t
 ALM_PROTO_OPT(cpow)(fc64_t x, fc64_t y) {
 
-    fc64_t w;
-    double y_re, y_im, r, theta, abs_x, arg_x;
+    fc64_t l;
+    double y_re, y_im;
 
     y_re = creal(y);
 
     y_im = cimag(y);
 
-    abs_x = cabs(x);
-
-    /*check if absolute balue of complex number is zero */
-    if ((asuint64(abs_x) & (~ALM_F64_SIGN_MASK)) == 0) {
+    /*check if x is zero */
+    if (creal(x) == 0.0 && cimag(x) == 0.0) {
 
         return CMPLX(0.0, 0.0);
-        
-    }
-
-    arg_x = carg(x);
-
-    r = pow(abs_x, y_re);
 
-    theta = y_re * arg_x;
-
-    if (asuint64(y_im) != 0) {
-
-        r = r * exp(-y_im * arg_x);
-
-        theta = theta + y_im * log(abs_x);
-
-    }
-
-    /*check if r is infinity */
-    if(unlikely((asuint64(r) & (~ALM_F64_SIGN_MASK)) == ALM_F64_INF)) {
-
-        if(asuint64(theta) == 0) {
-
-            return CMPLX(r, 0);
-        
-	}
-
-        return CMPLX(r, r);
-    
     }
 
-    w = CMPLX(r * cos(theta), r * sin(theta));
+    l = ALM_PROTO(clog)(x);
 
-    return w;
+    return ALM_PROTO(cexp)(CMPLX(y_re * creal(l) - y_im * cimag(l),
+                                 y_im * creal(l) + y_re * cimag(l)));
 }
-
@@ -30,35 +30,17 @@
  * Signature:
  *   float complex cpowf(float complex x, float complex y)
  *
- *   Let x = a + I*b
+ *   Let x = a + I*b, y = c + I*d and l + I*t = clog(x)
  *
- *   Let y = c + I*d
+ *   x^y = cexp(y * clog(x)) = cexp((c*l - d*t) + I*(d*l + c*t))
  *
- *   x^y = (a+i*b) ^ (c+i*b)
- *   x^y = (a+i*b)^c + (a+i*b)^(i*b) (1)
+ *   clog keeps log|x| accurate for |x| close to 1, where pow(|x|, c) would
+ *   lose c ulp to the rounding of |x|; an error of an ulp in the exponent
+ *   w = y * clog(x) remains an error of |w| ulp in the result. The vector
+ *   and array variants compute the same expression.
  *
- *   Expressing a + i*b in polar form,
- *   a + i*b = r*e^(i*θ) (2) where θ is the argument of the complex number = tan^(-1)⁡(b/a)
- *   and r is the magnitude of the complex number = √(a^2+ b^2 )
- *   Argument of a complex number can be computed using the cargs() function
- *    Magnitude of a complex number can be completed using cabs() function
+ *   Single precision is evaluated in double and rounded once.
  *
- *   Substituting (2) in (1) we get,
- *   x^y = (r*e^(i*θ))^c * (r*e^(i*θ))^(i*b)
- *   x^y = r^c * e^(i*θ*c) * r^(i*b) * e^(-θ*b)  as i * i = -1 (3)
- *
- *   r^(i*b)= e^(i*b*ln(r)) (4)
- *   Substituting (4) in (3), we get,
- *   x^y = r^c*e^(i*θ*c) * e^(i*b*ln⁡(r))*e^(-θ*b)
- *   x^y = r^c*e^(-θ*b) * e^(i* θ*c*b*ln(r))   (5)
- *   Let theta =  θ*c*b*ln(r)
- *   Substituting for theta in (5),
- *   x^y = r^c*e^(-θ*b)* e^(i*theta) (6)
- *
- *   e^(i*theta) = cos(theta) + i * sin(theta) (7)
- *   Substituting for (7) in (6), we get
-     x^y = r^c*e^(-θ*b)*(cos⁡(theta)+i*sin⁡(theta
-
  */
 
 #include <libm_macros.h>
@@ -72,17 +54,15 @@
 fc32_t
 ALM_PROTO_OPT(cpowf)(fc32_t x, fc32_t y) {
 
-    fc32_t w;
-    float y_re, y_im, r, theta, abs_x, arg_x;
+    fc64_t l, w;
+    double y_re, y_im;
 
-    y_re = crealf(y);
+    y_re = (double)crealf(y);
 
-    y_im = cimagf(y);
+    y_im = (double)cimagf(y);
 
-    abs_x = cabsf(x);
-
-    /*check if absolute value of x is zero */
-    if (unlikely((asuint32(abs_x) & (~ALM_F32_SIGN_MASK)) == 0)) {
+    /*check if x is zero */
+    if (unlikely(crealf(x) == 0.0f && cimagf(x) == 0.0f)) {
 
         #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
             return (fc32_t) { 0.0f, 0.0f };
@@ -90,48 +70,16 @@ ALM_PROTO_OPT(cpowf)(fc32_t x, fc32_t y) {
             return CMPLXF(0.0f, 0.0f);
         #endif
 
-
-
     }
 
-    arg_x = cargf(x);
-
-    r = powf(abs_x, y_re);
-
-    theta = y_re * arg_x;
-
-    if (asuint32(y_im) != 0) {
-
-        /*compute only if imaginary part of y is not zero */
+    l = ALM_PROTO(clog)(CMPLX((double)crealf(x), (double)cimagf(x)));
 
-        r = r * expf(-y_im * arg_x);
+    w = ALM_PROTO(cexp)(CMPLX(y_re * creal(l) - y_im * cimag(l),
+                              y_im * creal(l) + y_re * cimag(l)));
 
-        theta = theta + y_im * logf(abs_x);
-
-    }
-
-    /*check if r is infinity */
-    if(unlikely((asuint32(r) & (~ALM_F32_SIGN_MASK)) == ALM_F32_INF_MASK)) {
-
-        if(asuint32(theta) == 0) {
-            #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
-                return (fc32_t) { r, 0 };
-            #else
-                 return CMPLXF(r, 0);
-            #endif
-        }
-        #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
-            return (fc32_t) { r,r };
-        #else
-            return CMPLXF(r, r);
-        #endif
-    }
     #if ((defined (_WIN64) || defined (_WIN32)) && defined(__clang__))
-        w = (fc32_t) {r * cosf(theta), r * sinf(theta)};
+        return (fc32_t) { (float)creal(w), (float)cimag(w) };
     #else
-        w = CMPLXF(r * cosf(theta), r * sinf(theta));
+        return CMPLXF((float)creal(w), (float)cimag(w));
     #endif
-
-    return w;
 }
-
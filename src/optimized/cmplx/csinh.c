@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ *
+ * Implementation Notes
+ * --------------------
+ * Signature:
+ *   double complex csinh(double complex z)
+ *
+ *   IEEE SPEC (ISO/IEC 9899:2011 G.6.2.5), csinh is odd and
+ *   csinh(conj(z)) = conj(csinh(z)):
+ *   If z is (+0,+0), the result is (+0,+0)
+ *   If z is (+0,+∞), the result is (±0,NaN) and FE_INVALID is raised
+ *   If z is (+0,NaN), the result is (±0,NaN)
+ *   If z is (x,+∞) (for any positive finite x), the result is (NaN,NaN) and FE_INVALID is raised
+ *   If z is (x,NaN) (for any positive finite x), the result is (NaN,NaN)
+ *   If z is (+∞,+0), the result is (+∞,+0)
+ *   If z is (+∞,y) (for any positive finite y), the result is +∞ * cis(y)
+ *   If z is (+∞,+∞), the result is (±∞,NaN) and FE_INVALID is raised
+ *   If z is (+∞,NaN), the result is (±∞,NaN)
+ *   If z is (NaN,+0), the result is (NaN,+0)
+ *   If z is (NaN,y) (for any nonzero y), the result is (NaN,NaN)
+ *   If z is (NaN,NaN), the result is (NaN,NaN)
+ *
+ *   Algorithm:
+ *
+ *   Let z = a + I*b
+ *
+ *   csinh(z) = sinh(a) * cos(b) + I * cosh(a) * sin(b)
+ *
+ *   For |a| > 709, where cosh(a) overflows before the product does,
+ *   e^|a|/2 is formed as e^(|a| - 709) * (e^709/2) with the cos(b) and
+ *   sin(b) factors applied to the constant first.
+ *
+ */
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+#include <libm/compiler.h>
+#include <math.h>
+
+/* Above this |a|, cosh(a) is formed by hand */
+#define CSINH_BIG       709.0
+
+/* e^709 / 2 */
+#define CSINH_BIG_EXP   0x1.d422d2be5dc9bp+1021
+
+fc64_t
+ALM_PROTO_OPT(csinh)(fc64_t z)
+{
+    double a = creal(z), b = cimag(z);
+    double s, c, h;
+
+    if (isfinite(a) && isfinite(b)) {
+        if (b == 0.0)
+            return CMPLX(ALM_PROTO(sinh)(a), b);
+
+        ALM_PROTO(sincos)(b, &s, &c);
+
+        if (fabs(a) <= CSINH_BIG)
+            return CMPLX(ALM_PROTO(sinh)(a) * c, ALM_PROTO(cosh)(a) * s);
+
+        h = ALM_PROTO(exp)(fabs(a) - CSINH_BIG);
+        return CMPLX(copysign(h, a) * (c * CSINH_BIG_EXP), h * (s * CSINH_BIG_EXP));
+    }
+
+    if (isfinite(a)) {
+        /* b is infinite or NaN */
+        if (a == 0.0)
+            return CMPLX(a, b - b);
+
+        return CMPLX(b - b, b - b);
+    }
+
+    if (isinf(a)) {
+        if (!isfinite(b))
+            return CMPLX(a, b - b);
+
+        if (b == 0.0)
+            return CMPLX(a, b);
+
+        ALM_PROTO(sincos)(b, &s, &c);
+        return CMPLX(a * c, fabs(a) * s);
+    }
+
+    /* a is NaN */
+    if (b == 0.0)
+        return CMPLX(a, b);
+
+    return CMPLX(a, a + b);
+}
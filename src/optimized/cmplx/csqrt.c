@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ *
+ * Implementation Notes
+ * --------------------
+ * Signature:
+ *   double complex csqrt(double complex z)
+ *
+ *   IEEE SPEC (ISO/IEC 9899:2011 G.6.4.2), csqrt(conj(z)) = conj(csqrt(z)):
+ *   If z is (±0,+0), the result is (+0,+0)
+ *   If z is (x,+∞) (for any x, including NaN), the result is (+∞,+∞)
+ *   If z is (x,NaN) (for any finite x), the result is (NaN,NaN)
+ *   If z is (-∞,y) (for any positive finite y), the result is (+0,+∞)
+ *   If z is (+∞,y) (for any positive finite y), the result is (+∞,+0)
+ *   If z is (-∞,NaN), the result is (NaN,±∞)
+ *   If z is (+∞,NaN), the result is (+∞,NaN)
+ *   If z is (NaN,y) (for any finite y), the result is (NaN,NaN)
+ *   If z is (NaN,NaN), the result is (NaN,NaN)
+ *
+ *   Algorithm:
+ *
+ *   Let z = a + I*b, t = sqrt((|z| + |a|) / 2)
+ *
+ *   csqrt(z) = t + I * b / 2t                   for a >= 0
+ *   csqrt(z) = |b| / 2t + I * copysign(t, b)    for a < 0
+ *
+ *   Operands above 2^1020 are scaled by 1/4 and subnormal-range ones by
+ *   2^108, so that |z| + |a| neither overflows nor loses precision, and
+ *   the result is scaled back by 2 or 2^-54.
+ *
+ */
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+#include <libm/compiler.h>
+#include <math.h>
+
+#define CSQRT_BIG       0x1p1020
+#define CSQRT_SMALL     0x1p-1020
+
+fc64_t
+ALM_PROTO_OPT(csqrt)(fc64_t z)
+{
+    double a = creal(z), b = cimag(z);
+    double m, sc = 1.0, r, t;
+
+    if (isinf(b))
+        return CMPLX(INFINITY, b);
+
+    if (isnan(a))
+        return CMPLX(a, a + b);
+
+    if (isinf(a)) {
+        if (isnan(b))
+            return a > 0.0 ? CMPLX(a, b) : CMPLX(b, a);
+
+        return a > 0.0 ? CMPLX(a, copysign(0.0, b))
+                       : CMPLX(0.0, copysign(a, b));
+    }
+
+    if (isnan(b))
+        return CMPLX(b, b);
+
+    if (a == 0.0 && b == 0.0)
+        return CMPLX(0.0, b);
+
+    m = fmax(fabs(a), fabs(b));
+    if (m > CSQRT_BIG) {
+        a *= 0x1p-2;
+        b *= 0x1p-2;
+        sc = 2.0;
+    } else if (m < CSQRT_SMALL) {
+        a *= 0x1p108;
+        b *= 0x1p108;
+        sc = 0x1p-54;
+    }
+
+    r = ALM_PROTO(hypot)(a, b);
+    t = ALM_PROTO(sqrt)(0.5 * (r + fabs(a)));
+
+    if (a >= 0.0)
+        return CMPLX(sc * t, sc * (b / (2.0 * t)));
+
+    return CMPLX(sc * (fabs(b) / (2.0 * t)), sc * copysign(t, b));
+}
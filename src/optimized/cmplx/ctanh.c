@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ *
+ *
+ * Implementation Notes
+ * --------------------
+ * Signature:
+ *   double complex ctanh(double complex z)
+ *
+ *   IEEE SPEC (ISO/IEC 9899:2011 G.6.2.6), ctanh is odd and
+ *   ctanh(conj(z)) = conj(ctanh(z)):
+ *   If z is (+0,+0), the result is (+0,+0)
+ *   If z is (x,+∞) (for any finite x), the result is (NaN,NaN) and FE_INVALID is raised
+ *   If z is (x,NaN) (for any finite x), the result is (NaN,NaN)
+ *   If z is (+∞,y) (for any positive finite y), the result is (1,+0 * sin(2y))
+ *   If z is (+∞,+∞), the result is (1,±0)
+ *   If z is (+∞,NaN), the result is (1,±0)
+ *   If z is (NaN,+0), the result is (NaN,+0)
+ *   If z is (NaN,y) (for any nonzero y), the result is (NaN,NaN)
+ *   If z is (NaN,NaN), the result is (NaN,NaN)
+ *
+ *   Algorithm:
+ *
+ *   Let z = a + I*b
+ *
+ *   ctanh(z) = (sinh(2a) + I * sin(2b)) / (cosh(2a) + cos(2b))
+ *            = (sinh(a) * cosh(a) + I * sin(b) * cos(b)) / (sinh(a)^2 + cos(b)^2)
+ *
+ *   The second form has no cancellation in the denominator. For |a| > 20,
+ *   tanh(a) rounds to ±1 and the imaginary part is 4 * sin(b) * cos(b) * e^(-2|a|).
+ *   For |a| > 354, where e^(-2|a|) is subnormal, it is applied as e^(-|a|) twice
+ *   so that the result is rounded once.
+ *
+ */
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm/types.h>
+#include <libm/compiler.h>
+#include <math.h>
+
+/* Above this |a|, tanh(a) rounds to ±1 */
+#define CTANH_BIG       20.0
+
+/* Above this |a|, e^(-2|a|) is subnormal */
+#define CTANH_TINY      354.0
+
+fc64_t
+ALM_PROTO_OPT(ctanh)(fc64_t z)
+{
+    double a = creal(z), b = cimag(z);
+    double s, c, sh, ch, d, e;
+
+    if (isfinite(a) && isfinite(b)) {
+        ALM_PROTO(sincos)(b, &s, &c);
+
+        if (fabs(a) > CTANH_TINY) {
+            e = ALM_PROTO(exp)(-fabs(a));
+            return CMPLX(copysign(1.0, a), 4.0 * s * c * e * e);
+        }
+
+        if (fabs(a) > CTANH_BIG)
+            return CMPLX(copysign(1.0, a),
+                         4.0 * s * c * ALM_PROTO(exp)(-2.0 * fabs(a)));
+
+        sh = ALM_PROTO(sinh)(a);
+        ch = ALM_PROTO(cosh)(a);
+        d = sh * sh + c * c;
+        return CMPLX(sh * ch / d, s * c / d);
+    }
+
+    if (isfinite(a)) {
+        /* b is infinite or NaN */
+        return CMPLX(b - b, b - b);
+    }
+
+    if (isinf(a)) {
+        if (!isfinite(b))
+            return CMPLX(copysign(1.0, a), copysign(0.0, b));
+
+        ALM_PROTO(sincos)(b, &s, &c);
+        return CMPLX(copysign(1.0, a), copysign(0.0, s * c));
+    }
+
+    /* a is NaN */
+    if (b == 0.0)
+        return CMPLX(a, b);
+
+    return CMPLX(a, a + b);
+}
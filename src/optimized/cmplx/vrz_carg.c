@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   __m256d vrz4_carg(__m256d xre, __m256d xim)
+ *   __m256 vrc8_cargf(__m256 xre, __m256 xim)
+ *   void vrza_carg(int len, const double *x, double *y)
+ *   void vrza_carg_split(int len, const double *xre, const double *xim,
+ *                        double *y)
+ *   void vrca_cargf(int len, const float *x, float *y)
+ *   void vrca_cargf_split(int len, const float *xre, const float *xim,
+ *                         float *y)
+ *
+ * Computes the argument (phase angle) of 4 complex
+ * doubles or 8 complex floats at a time.
+ * Vector variants take the real and imaginary parts in separate registers,
+ * array variants take interleaved (re, im) pairs or separate re[] and im[]
+ * arrays. The results are real.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * atan2(b, a), the vrd4 atan of the smaller over the larger magnitude
+ * moved to the right quadrant. Lanes with both operands zero, or an
+ * infinite or NaN operand, are recomputed with carg()/cargf().
+ *
+ * Single precision is evaluated in double and rounded once.
+ * See include/libm/alm_complex.h for the kernels.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/amd_funcs_internal.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 4
+#include <libm/alm_complex.h>
+
+__m256d
+ALM_PROTO_ARCH_AVX2(vrz4_carg)(__m256d xre, __m256d xim)
+{
+    return cpx_carg(xre, xim);
+}
+
+__m256
+ALM_PROTO_ARCH_AVX2(vrc8_cargf)(__m256 xre, __m256 xim)
+{
+    return cpx_cargf(xre, xim);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrza_carg)(int len, const double *x, double *y)
+{
+    cpx_carg_array(len, x, y);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrza_carg_split)(int len, const double *xre, const double *xim,
+                                     double *y)
+{
+    cpx_carg_array_split(len, xre, xim, y);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrca_cargf)(int len, const float *x, float *y)
+{
+    cpx_cargf_array(len, x, y);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrca_cargf_split)(int len, const float *xre, const float *xim,
+                                      float *y)
+{
+    cpx_cargf_array_split(len, xre, xim, y);
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   void vrz4_cpow(__m256d xre, __m256d xim, __m256d yre, __m256d yim,
+ *                  __m256d *zre, __m256d *zim)
+ *   void vrc8_cpowf(__m256 xre, __m256 xim, __m256 yre, __m256 yim,
+ *                   __m256 *zre, __m256 *zim)
+ *   void vrza_cpow(int len, const double *x, const double *y, double *z)
+ *   void vrza_cpow_split(int len, const double *xre, const double *xim,
+ *                        const double *yre, const double *yim,
+ *                        double *zre, double *zim)
+ *   void vrca_cpowf(int len, const float *x, const float *y, float *z)
+ *   void vrca_cpowf_split(int len, const float *xre, const float *xim,
+ *                         const float *yre, const float *yim,
+ *                         float *zre, float *zim)
+ *
+ * Computes the complex power x^y of 4 complex
+ * doubles or 8 complex floats at a time.
+ * Vector variants take the real and imaginary parts in separate registers,
+ * array variants take interleaved (re, im) pairs or separate re[] and im[]
+ * arrays.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * cexp(y * clog(x)) with the vector clog and cexp paths. Lanes with x
+ * zero or non-finite, y non-finite, or an exponent out of the exp()
+ * range are recomputed with cpow()/cpowf().
+ *
+ * Single precision is evaluated in double and rounded once.
+ * See include/libm/alm_complex.h for the kernels.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/amd_funcs_internal.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 4
+#include <libm/alm_complex.h>
+
+void
+ALM_PROTO_ARCH_AVX2(vrz4_cpow)(__m256d xre, __m256d xim, __m256d yre, __m256d yim,
+                               __m256d *zre, __m256d *zim)
+{
+    act_vf_t re, im;
+
+    cpx_cpow(xre, xim, yre, yim, &re, &im);
+    *zre = re;
+    *zim = im;
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrc8_cpowf)(__m256 xre, __m256 xim, __m256 yre, __m256 yim,
+                                __m256 *zre, __m256 *zim)
+{
+    nrm_vf_t re, im;
+
+    cpx_cpowf(xre, xim, yre, yim, &re, &im);
+    *zre = re;
+    *zim = im;
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrza_cpow)(int len, const double *x, const double *y, double *z)
+{
+    cpx_cpow_array(len, x, y, z);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrza_cpow_split)(int len, const double *xre, const double *xim,
+                                     const double *yre, const double *yim,
+                                     double *zre, double *zim)
+{
+    cpx_cpow_array_split(len, xre, xim, yre, yim, zre, zim);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrca_cpowf)(int len, const float *x, const float *y, float *z)
+{
+    cpx_cpowf_array(len, x, y, z);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrca_cpowf_split)(int len, const float *xre, const float *xim,
+                                      const float *yre, const float *yim,
+                                      float *zre, float *zim)
+{
+    cpx_cpowf_array_split(len, xre, xim, yre, yim, zre, zim);
+}
@@ -244,6 +244,7 @@ ALM_PROTO_OPT(cos)(double x)
         }
         else {
             // Reduce x into range [-pi/4,pi/4]
+            ALM_STATS_REDUCE();
             __amd_remainder_piby2(x, &r, &rr, &region);
         }
 
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ *   uint16_t tanhf16(uint16_t x)
+ *   __m128i  vrh8_tanhf16(__m128i x)
+ *   __m256i  vrh16_tanhf16(__m256i x)
+ *   void     vrha_tanhf16(int len, const uint16_t *src, uint16_t *dst)
+ *
+ * Computes the hyperbolic tangent of IEEE binary16 values, 8 lanes per F16C conversion.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * Odd Taylor polynomial below |x| = 0.55, 1 - 2/(exp(2|x|) + 1) above,
+ * with |x| clamped to 9 where tanh(x) rounds to +-1.
+ *
+ * See include/libm/alm_half.h for the kernel.
+ *
+ * Max ULP: 0.503 (FP16), measured over all 65536 inputs.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_HALF_VLEN 8
+#include <libm/alm_half.h>
+
+uint16_t
+ALM_PROTO_ARCH_AVX2(tanhf16)(uint16_t x)
+{
+    __m128i r = half_apply(half_tanh, _mm_cvtsi32_si128(x));
+    return (uint16_t)_mm_extract_epi16(r, 0);
+}
+
+__m128i
+ALM_PROTO_ARCH_AVX2(vrh8_tanhf16)(__m128i x)
+{
+    return half_apply(half_tanh, x);
+}
+
+__m256i
+ALM_PROTO_ARCH_AVX2(vrh16_tanhf16)(__m256i x)
+{
+    __m128i lo = half_apply(half_tanh, _mm256_castsi256_si128(x));
+    __m128i hi = half_apply(half_tanh, _mm256_extracti128_si256(x, 1));
+    return _mm256_set_m128i(hi, lo);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrha_tanhf16)(int len, const uint16_t *src, uint16_t *dst)
+{
+    half_apply_array(half_tanh, len, src, dst);
+}
@@ -263,6 +263,7 @@ ALM_PROTO_OPT(sincos)(double x, double *sin, double *cos)
         }
         else {
             // Reduce x into range [-pi/4,pi/4]
+            ALM_STATS_REDUCE();
             __amd_remainder_piby2(x, &r, &rr, &region);
         }
 
@@ -261,6 +261,7 @@ ALM_PROTO_OPT(sincosf)(float x, float *sin, float *cos)
         }
         else {
             /* Reduce x into range [-pi/4,pi/4] */
+            ALM_STATS_REDUCE();
             __amd_remainder_piby2d2f(asuint64(xd), &r, &region);
         }
 
@@ -242,6 +242,7 @@ ALM_PROTO_OPT(sinf)(float x)
         }
         else {
             /* Reduce x into range [-pi/4,pi/4] */
+            ALM_STATS_REDUCE();
             __amd_remainder_piby2d2f(asuint64(xd), &r, &region);
        
         }
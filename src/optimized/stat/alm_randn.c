@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ *    int alm_randn(alm_randn_method_t method, uint64_t seed, uint64_t offset,
+ *                  size_t len, double *dst)
+ *    int alm_randnf(alm_randn_method_t method, uint64_t seed, uint64_t offset,
+ *                   size_t len, float *dst)
+ *
+ * Implementation notes:
+ *
+ *    The elements of a stream are independent functions of their position,
+ *    see include/libm/alm_randn.h, so the range is split by
+ *    __alm_parallel_for() and every part is handed to the dispatched
+ *    amd_vrda_randn/amd_vrsa_randnf kernel with its own offset. The result
+ *    is the same for any thread count and grain size.
+ *
+ *    Parts longer than ALM_RANDN_MAX_CALL are cut again to fit the int
+ *    length of the kernels.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <libm_macros.h>
+#include <libm/alm_parallel.h>
+#include <external/amdlibm_vec.h>
+
+#define ALM_RANDN_MAX_CALL  ((size_t)1 << 30)
+
+#define ALM_RANDN(name, T, kern)                                            \
+                                                                            \
+typedef struct {                                                            \
+    int       method;                                                       \
+    uint64_t  seed;                                                         \
+    uint64_t  offset;                                                       \
+    T        *dst;                                                          \
+} name##_job_t;                                                             \
+                                                                            \
+static void                                                                 \
+name##_range(void *arg, size_t start, size_t end)                           \
+{                                                                           \
+    const name##_job_t *job = arg;                                          \
+    size_t i, n;                                                            \
+                                                                            \
+    for (i = start; i < end; i += n) {                                      \
+        n = end - i < ALM_RANDN_MAX_CALL ? end - i : ALM_RANDN_MAX_CALL;    \
+        kern(job->method, job->seed, job->offset + i, (int)n,               \
+             job->dst + i);                                                 \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+int name(alm_randn_method_t method, uint64_t seed, uint64_t offset,         \
+         size_t len, T *dst)                                                \
+{                                                                           \
+    name##_job_t job = { (int)method, seed, offset, dst };                  \
+                                                                            \
+    if ((method != ALM_RANDN_ICDF && method != ALM_RANDN_BOX_MULLER) ||     \
+        (dst == NULL && len))                                               \
+        return -1;                                                          \
+                                                                            \
+    __alm_parallel_for(len, name##_range, &job);                            \
+                                                                            \
+    return 0;                                                               \
+}
+
+ALM_RANDN(alm_randn, double, FN_PROTOTYPE(vrda_randn))
+
+ALM_RANDN(alm_randnf, float, FN_PROTOTYPE(vrsa_randnf))
@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   float erfcinvf(float x)
+ *   v_f32x4_t vrs4_erfcinvf(v_f32x4_t x)
+ *   v_f32x8_t vrs8_erfcinvf(v_f32x8_t x)
+ *   void vrsa_erfcinvf(int len, const float *src, float *dst)
+ *
+ * Computes the inverse complementary error function erfcinv(y).
+ *
+ * SPEC:
+ *    erfcinvf(1)          = 0
+ *    erfcinvf(0)          = +Inf
+ *    erfcinvf(2)          = -Inf
+ *    erfcinvf(y<0 or y>2) = NaN, also for +-Inf
+ *    erfcinvf(NaN)        = NaN
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * The inputs are widened to double, 4 lanes at a time, and the result
+ * rounded to float once.
+ *
+ * erfcinv(y) = erfinv(1 - y), evaluated by the common erfinv(x, t)
+ * kernel with t = y*(2 - y) rather than 1 - (1 - y)^2, so the result
+ * keeps its relative accuracy down to the smallest subnormal y.
+ *
+ * The scalar variant runs the 4-lane kernel on one lane, so all variants
+ * give identical results. See include/libm/alm_normal.h for the kernels.
+ *
+ * Max ULP: 0.51
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 4
+#include <libm/alm_normal.h>
+
+float
+ALM_PROTO_ARCH_AVX2(erfcinvf)(float x)
+{
+    return nrm_apply_scalar(nrm_erfcinv, x);
+}
+
+v_f32x4_t
+ALM_PROTO_ARCH_AVX2(vrs4_erfcinvf)(v_f32x4_t x)
+{
+    return nrm_apply_half(nrm_erfcinv, x);
+}
+
+v_f32x8_t
+ALM_PROTO_ARCH_AVX2(vrs8_erfcinvf)(v_f32x8_t x)
+{
+    return nrm_apply(nrm_erfcinv, x);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrsa_erfcinvf)(int len, const float *src, float *dst)
+{
+    nrm_apply_array(nrm_erfcinv, len, src, dst);
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   void vrda_randn(int method, uint64_t seed, uint64_t offset, int len,
+ *                   double *dst)
+ *   void vrsa_randnf(int method, uint64_t seed, uint64_t offset, int len,
+ *                    float *dst)
+ *
+ * Fills dst with elements offset .. offset + len - 1 of the standard
+ * normal random stream selected by seed.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * Philox4x32-10 uniforms, 4 counter blocks at a time, are turned into
+ * normal variates in registers, by the inverse CDF or by Box-Muller, and
+ * stored once. Every element only depends on seed, method and its
+ * position in the stream, so splitting a range across calls or threads
+ * gives the same values as one call. See include/libm/alm_randn.h.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+#include <libm/amd_funcs_internal.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 4
+#include <libm/alm_randn.h>
+
+void
+ALM_PROTO_ARCH_AVX2(vrda_randn)(int method, uint64_t seed, uint64_t offset,
+                                int len, double *dst)
+{
+    rnd_randn_array(method, seed, offset, len, dst);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrsa_randnf)(int method, uint64_t seed, uint64_t offset,
+                                 int len, float *dst)
+{
+    rnd_randnf_array(method, seed, offset, len, dst);
+}
@@ -390,6 +390,7 @@ double ALM_PROTO_OPT(tan)(double x)
     }
     else {
       /* Reduce x into range [-pi/4,pi/4] */
+        ALM_STATS_REDUCE();
         __amd_remainder_piby2(x, &r, &rr, &region);
 
     }
@@ -257,6 +257,7 @@ float ALM_PROTO_OPT(tanf)(float x)
 
     if (unlikely(ax >= FIVE_e5)) {
         /* Reduce x into range [-pi/4,pi/4] */
+        ALM_STATS_REDUCE();
         __amd_remainder_piby2d2f(ax, &r, &region);
     }
     else {
@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*
+ * Argument capture wrappers for the 512-bit vector variants, built
+ * with the matching instruction set. See src/alm_capture.c.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/alm_capture.h>
+
+ALM_CAPTURE_VECTOR1(vrs16_acosf, "acos", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrs16_asinf, "asin", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_asin, "asin", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_atanf, "atan", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_atan, "atan", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_cosf, "cos", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_cos, "cos", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_sinf, "sin", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_sin, "sin", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_tanf, "tan", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_tan, "tan", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_tanhf, "tanh", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrs16_expf, "exp", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_exp, "exp", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_exp2f, "exp2", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_exp2, "exp2", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_erff, "erf", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_erf, "erf", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_erfcf, "erfc", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_erfc, "erfc", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_logf, "log", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_log, "log", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_log2f, "log2", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_log2, "log2", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_log10f, "log10", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrs16_sqrtf, "sqrt", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_sqrt, "sqrt", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR1(vrs16_roundf, "round", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR1(vrd8_round, "round", "vrd8", __m512d, double);
+ALM_CAPTURE_VECTOR2(vrs16_powf, "pow", "vrs16", __m512, float);
+ALM_CAPTURE_VECTOR2(vrd8_pow, "pow", "vrd8", __m512d, double);
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   v_f64x8_t vrd8_exp_fast(v_f64x8_t x)
+ *   void vrda_exp_fast(int len, const double *src, double *dst)
+ *
+ * Computes exp(x), 8 lanes at a time, for the fast accuracy tier.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * x = (16n + j)*ln2/16 + r, |r| <= ln2/32. 2^(j/16) comes from a 16-entry
+ * table held in two registers, looked up with vpermt2pd, and e^r - 1
+ * from a degree 6 minimax polynomial, so there is no gather and no
+ * scalar fallback. 2^n is applied in two halves to round subnormal
+ * results once. Max 1.5 ULP.
+ *
+ * There is no AVX2 counterpart: without a 16-entry permute the table
+ * lookup costs more than it saves, and the AVX2 fast tier keeps
+ * vrd4_exp.
+ *
+ * SPEC:
+ *    exp_fast(+Inf) = +Inf, exp_fast(-Inf) = +0, exp_fast(NaN) = NaN
+ *    exp_fast(x > 709.78) = +Inf, exp_fast(x < -745.13) = +0
+ *
+ * See include/libm/alm_fast.h for the kernel.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+
+#include <libm/arch/zen4.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 8
+#include <libm/alm_fast.h>
+
+v_f64x8_t
+ALM_PROTO_ARCH_ZN4(vrd8_exp_fast)(v_f64x8_t x)
+{
+    return fst_exp(x);
+}
+
+void
+ALM_PROTO_ARCH_ZN4(vrda_exp_fast)(int len, const double *src, double *dst)
+{
+    act_apply_array(fst_exp, len, src, dst);
+}
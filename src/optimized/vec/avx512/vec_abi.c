@@ -0,0 +1,176 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   __m512d _ZGVeN8v_amd_<fn>(__m512d x)
+ *   __m512  _ZGVeN16v_amd_<fn>f(__m512 x)
+ *   and the vv/vu variants of amd_pow/amd_powf, vl8l8/vl4l4 of
+ *   amd_sincos/amd_sincosf
+ *
+ * x86-64 vector function ABI entry points for the AVX-512 variants
+ * declared by include/external/amdlibm_simd.h.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * Each variant calls the amd_vr* entry point of the same width. A variant
+ * without a native 512-bit kernel calls the AVX2 ("d") variant of
+ * src/optimized/vec/vec_abi.c on both halves.
+ */
+
+#include <immintrin.h>
+
+#define AMD_LIBM_VEC_EXPERIMENTAL 1
+#include <external/amdlibm_vec.h>
+
+#define VABI_DECL(name, vt, ...)                                        \
+    vt name(__VA_ARGS__);                                               \
+    vt name(__VA_ARGS__)
+
+#define VABI_D(fn)                                                      \
+    VABI_DECL(_ZGVeN8v_amd_##fn, __m512d, __m512d x)                    \
+    {                                                                   \
+        return amd_vrd8_##fn(x);                                        \
+    }
+
+#define VABI_S(fn)                                                      \
+    VABI_DECL(_ZGVeN16v_amd_##fn, __m512, __m512 x)                     \
+    {                                                                   \
+        return amd_vrs16_##fn(x);                                       \
+    }
+
+/* 512-bit from two calls of the 256-bit variant */
+#define VABI_D_HALF(fn)                                                 \
+    __m256d _ZGVdN4v_amd_##fn(__m256d x);                               \
+    VABI_DECL(_ZGVeN8v_amd_##fn, __m512d, __m512d x)                    \
+    {                                                                   \
+        __m256d lo = _ZGVdN4v_amd_##fn(_mm512_castpd512_pd256(x));      \
+        __m256d hi = _ZGVdN4v_amd_##fn(_mm512_extractf64x4_pd(x, 1));   \
+        return _mm512_insertf64x4(_mm512_castpd256_pd512(lo), hi, 1);   \
+    }
+
+#define VABI_S_HALF(fn)                                                 \
+    __m256 _ZGVdN8v_amd_##fn(__m256 x);                                 \
+    VABI_DECL(_ZGVeN16v_amd_##fn, __m512, __m512 x)                     \
+    {                                                                   \
+        __m256 lo = _ZGVdN8v_amd_##fn(_mm512_castps512_ps256(x));       \
+        __m256 hi = _ZGVdN8v_amd_##fn(_mm512_extractf32x8_ps(x, 1));    \
+        return _mm512_insertf32x8(_mm512_castps256_ps512(lo), hi, 1);   \
+    }
+
+VABI_D_HALF(acos)
+VABI_D(asin)
+VABI_D(atan)
+VABI_D_HALF(cbrt)
+VABI_D(cdfnorm)
+VABI_D(cdfnorminv)
+VABI_D(cos)
+VABI_D_HALF(cosh)
+VABI_D(erf)
+VABI_D(erfc)
+VABI_D(erfcinv)
+VABI_D(erfinv)
+VABI_D(exp)
+VABI_D_HALF(exp10)
+VABI_D(exp2)
+VABI_D_HALF(fabs)
+VABI_D(log)
+VABI_D_HALF(log10)
+VABI_D_HALF(log1p)
+VABI_D(log2)
+VABI_D(round)
+VABI_D(sin)
+VABI_D(sqrt)
+VABI_D(tan)
+
+VABI_S(acosf)
+VABI_S(asinf)
+VABI_S(atanf)
+VABI_S_HALF(cbrtf)
+VABI_S(cdfnormf)
+VABI_S(cdfnorminvf)
+VABI_S(cosf)
+VABI_S_HALF(coshf)
+VABI_S(erfcf)
+VABI_S(erfcinvf)
+VABI_S(erff)
+VABI_S(erfinvf)
+VABI_S_HALF(exp10f)
+VABI_S(exp2f)
+VABI_S(expf)
+VABI_S_HALF(expm1f)
+VABI_S_HALF(fabsf)
+VABI_S(log10f)
+VABI_S_HALF(log1pf)
+VABI_S(log2f)
+VABI_S(logf)
+VABI_S(roundf)
+VABI_S(sinf)
+VABI_S(sqrtf)
+VABI_S(tanf)
+VABI_S(tanhf)
+
+/* pow: vv both operands vary, vu uniform exponent */
+VABI_DECL(_ZGVeN8vv_amd_pow, __m512d, __m512d x, __m512d y)
+{
+    return amd_vrd8_pow(x, y);
+}
+
+VABI_DECL(_ZGVeN8vu_amd_pow, __m512d, __m512d x, double y)
+{
+    return amd_vrd8_powx(x, y);
+}
+
+VABI_DECL(_ZGVeN16vv_amd_powf, __m512, __m512 x, __m512 y)
+{
+    return amd_vrs16_powf(x, y);
+}
+
+VABI_DECL(_ZGVeN16vu_amd_powf, __m512, __m512 x, float y)
+{
+    return amd_vrs16_powxf(x, y);
+}
+
+/* sincos: s[0..vlen-1] and c[0..vlen-1] */
+VABI_DECL(_ZGVeN8vl8l8_amd_sincos, void, __m512d x, double *s, double *c)
+{
+    __m512d vs, vc;
+
+    amd_vrd8_sincos(x, &vs, &vc);
+    _mm512_storeu_pd(s, vs);
+    _mm512_storeu_pd(c, vc);
+}
+
+VABI_DECL(_ZGVeN16vl4l4_amd_sincosf, void, __m512 x, float *s, float *c)
+{
+    __m512 vs, vc;
+
+    amd_vrs16_sincosf(x, &vs, &vc);
+    _mm512_storeu_ps(s, vs);
+    _mm512_storeu_ps(c, vc);
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/*
+ * Argument capture wrappers for the 128- and 256-bit vector variants, built
+ * with the matching instruction set. See src/alm_capture.c.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/alm_capture.h>
+
+ALM_CAPTURE_VECTOR1(vrs4_acosf, "acos", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_acosf, "acos", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_acos, "acos", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_acos, "acos", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_asinf, "asin", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_asinf, "asin", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_asin, "asin", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_asin, "asin", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_atanf, "atan", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_atanf, "atan", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_atan, "atan", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_atan, "atan", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_cosf, "cos", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_cosf, "cos", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_cos, "cos", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_cos, "cos", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_sinf, "sin", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_sinf, "sin", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_sin, "sin", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_sin, "sin", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_tanf, "tan", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_tanf, "tan", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_tan, "tan", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_tan, "tan", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_coshf, "cosh", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_coshf, "cosh", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_cosh, "cosh", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrs4_tanhf, "tanh", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_tanhf, "tanh", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrs4_expf, "exp", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_expf, "exp", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_exp, "exp", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_exp, "exp", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_exp2f, "exp2", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_exp2f, "exp2", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_exp2, "exp2", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_exp2, "exp2", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_exp10f, "exp10", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrd2_exp10, "exp10", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrs4_expm1f, "expm1", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs4_erff, "erf", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_erff, "erf", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_erf, "erf", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_erf, "erf", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_erfcf, "erfc", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_erfcf, "erfc", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_erfc, "erfc", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_erfc, "erfc", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_logf, "log", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_logf, "log", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_log, "log", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_log, "log", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_log1pf, "log1p", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrd2_log1p, "log1p", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrs4_log2f, "log2", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_log2f, "log2", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_log2, "log2", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_log2, "log2", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_log10f, "log10", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_log10f, "log10", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_log10, "log10", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrs4_cbrtf, "cbrt", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrd2_cbrt, "cbrt", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrs4_sqrtf, "sqrt", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_sqrtf, "sqrt", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_sqrt, "sqrt", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_sqrt, "sqrt", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_fabsf, "fabs", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_fabsf, "fabs", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_fabs, "fabs", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_fabs, "fabs", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR1(vrs4_roundf, "round", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR1(vrs8_roundf, "round", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR1(vrd2_round, "round", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR1(vrd4_round, "round", "vrd4", __m256d, double);
+ALM_CAPTURE_VECTOR2(vrs4_powf, "pow", "vrs4", __m128, float);
+ALM_CAPTURE_VECTOR2(vrs8_powf, "pow", "vrs8", __m256, float);
+ALM_CAPTURE_VECTOR2(vrd2_pow, "pow", "vrd2", __m128d, double);
+ALM_CAPTURE_VECTOR2(vrd4_pow, "pow", "vrd4", __m256d, double);
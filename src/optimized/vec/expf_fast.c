@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   v_f32x8_t vrs8_exp_fastf(v_f32x8_t x)
+ *   void vrsa_exp_fastf(int len, const float *src, float *dst)
+ *
+ * Computes exp(x), 8 lanes at a time, for the fast accuracy tier.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * x = (8n + j)*ln2/8 + r, |r| <= ln2/16. 2^(j/8) comes from an 8-entry
+ * table in a register, looked up with vpermps (16 entries with vpermps
+ * on Zen4), and e^r - 1 from a degree 3 minimax polynomial, so there is
+ * no gather and no scalar fallback. 2^n is applied in two halves to
+ * round subnormal results once. Max 2 ULP (AVX2), 1.1 ULP (Zen4).
+ *
+ * SPEC:
+ *    exp_fastf(+Inf) = +Inf, exp_fastf(-Inf) = +0, exp_fastf(NaN) = NaN
+ *    exp_fastf(x > 88.73) = +Inf, exp_fastf(x < -103.98) = +0
+ *
+ * See include/libm/alm_fast.h for the kernel.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_VLEN 8
+#include <libm/alm_fast.h>
+
+v_f32x8_t
+ALM_PROTO_ARCH_AVX2(vrs8_exp_fastf)(v_f32x8_t x)
+{
+    return fst_exp(x);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrsa_exp_fastf)(int len, const float *src, float *dst)
+{
+    act_apply_array(fst_exp, len, src, dst);
+}
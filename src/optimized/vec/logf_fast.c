@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   v_f32x8_t vrs8_log_fastf(v_f32x8_t x)
+ *   void vrsa_log_fastf(int len, const float *src, float *dst)
+ *
+ * Computes log(x), 8 lanes at a time, for the fast accuracy tier.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * x = 2^k * m, sqrt(2)/2 <= m < sqrt(2), found by integer arithmetic on
+ * the bits of x, and log(m) by the fdlibm rational reduction
+ * s = (m - 1)/(m + 1), without the table gathers of logf. Zero,
+ * subnormal, negative, infinite and NaN lanes are fixed up on a branch
+ * that ordinary data does not take. Max 1 ULP.
+ *
+ * SPEC:
+ *    log_fastf(+-0) = -Inf, log_fastf(+Inf) = +Inf
+ *    log_fastf(x < 0) = NaN, log_fastf(NaN) = NaN
+ *
+ * See include/libm/alm_fast.h for the kernel.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_VLEN 8
+#include <libm/alm_fast.h>
+
+v_f32x8_t
+ALM_PROTO_ARCH_AVX2(vrs8_log_fastf)(v_f32x8_t x)
+{
+    return fst_log(x);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrsa_log_fastf)(int len, const float *src, float *dst)
+{
+    act_apply_array(fst_log, len, src, dst);
+}
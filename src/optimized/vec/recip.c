@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   v_f64x4_t vrd4_recip(v_f64x4_t x)
+ *   void vrda_recip(int len, const double *src, double *dst)
+ *   v_f64x4_t vrd4_recip_fast(v_f64x4_t x)
+ *   void vrda_recip_fast(int len, const double *src, double *dst)
+ *
+ * Computes 1/x, 4 lanes at a time, in two accuracy tiers.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * recip:      1/x with the IEEE divide, correctly rounded.
+ * recip_fast: the hardware estimate and Newton steps y += y*(1 - x*y),
+ *             two from vrcp14pd on Zen4, three from the binary32 vrcpps
+ *             estimate on AVX2, max 1 ULP. Operands with |x| outside
+ *             [2^-120, 2^120] (AVX2) or [2^-1020, 2^1020] take the recip
+ *             path.
+ *
+ * See include/libm/alm_recip.h for the kernels.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 4
+#include <libm/alm_recip.h>
+
+v_f64x4_t
+ALM_PROTO_ARCH_AVX2(vrd4_recip)(v_f64x4_t x)
+{
+    return rcp_recip(x);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrda_recip)(int len, const double *src, double *dst)
+{
+    act_apply_array(rcp_recip, len, src, dst);
+}
+
+v_f64x4_t
+ALM_PROTO_ARCH_AVX2(vrd4_recip_fast)(v_f64x4_t x)
+{
+    return rcp_recip_fast(x);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrda_recip_fast)(int len, const double *src, double *dst)
+{
+    act_apply_array(rcp_recip_fast, len, src, dst);
+}
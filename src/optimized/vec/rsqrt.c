@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   v_f64x4_t vrd4_rsqrt(v_f64x4_t x)
+ *   void vrda_rsqrt(int len, const double *src, double *dst)
+ *   v_f64x4_t vrd4_rsqrt_fast(v_f64x4_t x)
+ *   void vrda_rsqrt_fast(int len, const double *src, double *dst)
+ *   v_f64x4_t vrd4_rsqrt_cr(v_f64x4_t x)
+ *   void vrda_rsqrt_cr(int len, const double *src, double *dst)
+ *
+ * Computes 1/sqrt(x), 4 lanes at a time, in three accuracy tiers.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * rsqrt:      1/sqrt(x) with the IEEE square root and divide, max 1 ULP.
+ * rsqrt_fast: the hardware estimate and Newton steps y += y*(1 - x*y*y)/2,
+ *             two from vrsqrt14pd on Zen4, three from the binary32
+ *             vrsqrtps estimate on AVX2, max 1 ULP. Operands outside
+ *             [2^-120, 2^120] (AVX2) or [2^-1020, 2^1020] take the rsqrt
+ *             path.
+ * rsqrt_cr:   correctly rounded. The 1/sqrt(x) above is corrected with
+ *             the residual 1 - x*y*y, computed to about 2^-105 with FMA,
+ *             and lanes whose result is too close to a rounding boundary
+ *             to decide, about one in 2^45, are settled exactly in
+ *             integer arithmetic.
+ *
+ * SPEC (all tiers):
+ *    rsqrt(+0) = +Inf, rsqrt(-0) = -Inf, rsqrt(+Inf) = +0
+ *    rsqrt(x < 0) = NaN, rsqrt(NaN) = NaN
+ *
+ * See include/libm/alm_recip.h for the kernels.
+ */
+
+#include <stdint.h>
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/types.h>
+
+#include <libm/arch/avx2.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 4
+#include <libm/alm_recip.h>
+
+v_f64x4_t
+ALM_PROTO_ARCH_AVX2(vrd4_rsqrt)(v_f64x4_t x)
+{
+    return rcp_rsqrt(x);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrda_rsqrt)(int len, const double *src, double *dst)
+{
+    act_apply_array(rcp_rsqrt, len, src, dst);
+}
+
+v_f64x4_t
+ALM_PROTO_ARCH_AVX2(vrd4_rsqrt_fast)(v_f64x4_t x)
+{
+    return rcp_rsqrt_fast(x);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrda_rsqrt_fast)(int len, const double *src, double *dst)
+{
+    act_apply_array(rcp_rsqrt_fast, len, src, dst);
+}
+
+v_f64x4_t
+ALM_PROTO_ARCH_AVX2(vrd4_rsqrt_cr)(v_f64x4_t x)
+{
+    return rcp_rsqrt_cr(x);
+}
+
+void
+ALM_PROTO_ARCH_AVX2(vrda_rsqrt_cr)(int len, const double *src, double *dst)
+{
+    act_apply_array(rcp_rsqrt_cr, len, src, dst);
+}
@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signatures:
+ *   __m128d _ZGVbN2v_amd_<fn>(__m128d x)
+ *   __m256d _ZGV{c,d}N4v_amd_<fn>(__m256d x)
+ *   __m128  _ZGVbN4v_amd_<fn>f(__m128 x)
+ *   __m256  _ZGV{c,d}N8v_amd_<fn>f(__m256 x)
+ *   and the vv/vu variants of amd_pow/amd_powf, vl8l8/vl4l4 of
+ *   amd_sincos/amd_sincosf
+ *
+ * x86-64 vector function ABI entry points for the SSE, AVX and AVX2
+ * variants declared by include/external/amdlibm_simd.h.
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * Each variant calls the amd_vr* entry point of the same width. A 256-bit
+ * variant without a native kernel calls the 128-bit one on both halves.
+ * AVX ("c") and AVX2 ("d") pass the same argument types, so they share the
+ * wrappers. The sincos outputs are only element aligned.
+ *
+ * See src/optimized/vec/avx512/vec_abi.c for the AVX-512 ("e") variants.
+ */
+
+#include <immintrin.h>
+
+#define AMD_LIBM_VEC_EXPERIMENTAL 1
+#include <external/amdlibm_vec.h>
+
+#define VABI_DECL(name, vt, ...)                                        \
+    vt name(__VA_ARGS__);                                               \
+    vt name(__VA_ARGS__)
+
+/* 128-bit kernel */
+#define VABI_B(fn, vt, kern)                                            \
+    VABI_DECL(_ZGVbN##fn, vt, vt x) { return kern(x); }
+
+/* 256-bit kernel, AVX and AVX2 */
+#define VABI_CD(fn, vt, kern)                                           \
+    VABI_DECL(_ZGVcN##fn, vt, vt x) { return kern(x); }                 \
+    VABI_DECL(_ZGVdN##fn, vt, vt x) { return kern(x); }
+
+/* 256-bit from two 128-bit calls */
+#define VABI_CD_PD(fn, kern)                                            \
+    static inline __m256d vabi_##kern(__m256d x)                        \
+    {                                                                   \
+        return _mm256_set_m128d(kern(_mm256_extractf128_pd(x, 1)),      \
+                                kern(_mm256_castpd256_pd128(x)));       \
+    }                                                                   \
+    VABI_CD(fn, __m256d, vabi_##kern)
+
+#define VABI_CD_PS(fn, kern)                                            \
+    static inline __m256 vabi_##kern(__m256 x)                          \
+    {                                                                   \
+        return _mm256_set_m128(kern(_mm256_extractf128_ps(x, 1)),       \
+                               kern(_mm256_castps256_ps128(x)));        \
+    }                                                                   \
+    VABI_CD(fn, __m256, vabi_##kern)
+
+#define VABI_D(fn)                                                      \
+    VABI_B(2v_amd_##fn, __m128d, amd_vrd2_##fn)                         \
+    VABI_CD(4v_amd_##fn, __m256d, amd_vrd4_##fn)
+
+#define VABI_D_HALF(fn)                                                 \
+    VABI_B(2v_amd_##fn, __m128d, amd_vrd2_##fn)                         \
+    VABI_CD_PD(4v_amd_##fn, amd_vrd2_##fn)
+
+#define VABI_S(fn)                                                      \
+    VABI_B(4v_amd_##fn, __m128, amd_vrs4_##fn)                          \
+    VABI_CD(8v_amd_##fn, __m256, amd_vrs8_##fn)
+
+#define VABI_S_HALF(fn)                                                 \
+    VABI_B(4v_amd_##fn, __m128, amd_vrs4_##fn)                          \
+    VABI_CD_PS(8v_amd_##fn, amd_vrs4_##fn)
+
+VABI_D(acos)
+VABI_D(asin)
+VABI_D(atan)
+VABI_D_HALF(cbrt)
+VABI_D(cdfnorm)
+VABI_D(cdfnorminv)
+VABI_D(cos)
+VABI_D_HALF(cosh)
+VABI_D(erf)
+VABI_D(erfc)
+VABI_D(erfcinv)
+VABI_D(erfinv)
+VABI_D(exp)
+VABI_D_HALF(exp10)
+VABI_D(exp2)
+VABI_D(fabs)
+VABI_D(log)
+VABI_D_HALF(log10)
+VABI_D_HALF(log1p)
+VABI_D(log2)
+VABI_D(round)
+VABI_D(sin)
+VABI_D(sqrt)
+VABI_D(tan)
+
+VABI_S(acosf)
+VABI_S(asinf)
+VABI_S(atanf)
+VABI_S_HALF(cbrtf)
+VABI_S(cdfnormf)
+VABI_S(cdfnorminvf)
+VABI_S(cosf)
+VABI_S(coshf)
+VABI_S(erfcf)
+VABI_S(erfcinvf)
+VABI_S(erff)
+VABI_S(erfinvf)
+VABI_S_HALF(exp10f)
+VABI_S(exp2f)
+VABI_S(expf)
+VABI_S_HALF(expm1f)
+VABI_S(fabsf)
+VABI_S(log10f)
+VABI_S_HALF(log1pf)
+VABI_S(log2f)
+VABI_S(logf)
+VABI_S(roundf)
+VABI_S(sinf)
+VABI_S(sqrtf)
+VABI_S(tanf)
+VABI_S(tanhf)
+
+/* pow: vv both operands vary, vu uniform exponent */
+VABI_DECL(_ZGVbN2vv_amd_pow, __m128d, __m128d x, __m128d y)
+{
+    return amd_vrd2_pow(x, y);
+}
+
+VABI_DECL(_ZGVcN4vv_amd_pow, __m256d, __m256d x, __m256d y)
+{
+    return amd_vrd4_pow(x, y);
+}
+
+VABI_DECL(_ZGVdN4vv_amd_pow, __m256d, __m256d x, __m256d y)
+{
+    return amd_vrd4_pow(x, y);
+}
+
+VABI_DECL(_ZGVbN2vu_amd_pow, __m128d, __m128d x, double y)
+{
+    return amd_vrd2_powx(x, y);
+}
+
+VABI_DECL(_ZGVcN4vu_amd_pow, __m256d, __m256d x, double y)
+{
+    return amd_vrd4_powx(x, y);
+}
+
+VABI_DECL(_ZGVdN4vu_amd_pow, __m256d, __m256d x, double y)
+{
+    return amd_vrd4_powx(x, y);
+}
+
+VABI_DECL(_ZGVbN4vv_amd_powf, __m128, __m128 x, __m128 y)
+{
+    return amd_vrs4_powf(x, y);
+}
+
+VABI_DECL(_ZGVcN8vv_amd_powf, __m256, __m256 x, __m256 y)
+{
+    return amd_vrs8_powf(x, y);
+}
+
+VABI_DECL(_ZGVdN8vv_amd_powf, __m256, __m256 x, __m256 y)
+{
+    return amd_vrs8_powf(x, y);
+}
+
+VABI_DECL(_ZGVbN4vu_amd_powf, __m128, __m128 x, float y)
+{
+    return amd_vrs4_powxf(x, y);
+}
+
+VABI_DECL(_ZGVcN8vu_amd_powf, __m256, __m256 x, float y)
+{
+    return amd_vrs8_powxf(x, y);
+}
+
+VABI_DECL(_ZGVdN8vu_amd_powf, __m256, __m256 x, float y)
+{
+    return amd_vrs8_powxf(x, y);
+}
+
+/* sincos: s[0..vlen-1] and c[0..vlen-1] */
+VABI_DECL(_ZGVbN2vl8l8_amd_sincos, void, __m128d x, double *s, double *c)
+{
+    __m128d vs, vc;
+
+    amd_vrd2_sincos(x, &vs, &vc);
+    _mm_storeu_pd(s, vs);
+    _mm_storeu_pd(c, vc);
+}
+
+VABI_DECL(_ZGVcN4vl8l8_amd_sincos, void, __m256d x, double *s, double *c)
+{
+    __m256d vs, vc;
+
+    amd_vrd4_sincos(x, &vs, &vc);
+    _mm256_storeu_pd(s, vs);
+    _mm256_storeu_pd(c, vc);
+}
+
+VABI_DECL(_ZGVdN4vl8l8_amd_sincos, void, __m256d x, double *s, double *c)
+{
+    __m256d vs, vc;
+
+    amd_vrd4_sincos(x, &vs, &vc);
+    _mm256_storeu_pd(s, vs);
+    _mm256_storeu_pd(c, vc);
+}
+
+VABI_DECL(_ZGVbN4vl4l4_amd_sincosf, void, __m128 x, float *s, float *c)
+{
+    __m128 vs, vc;
+
+    amd_vrs4_sincosf(x, &vs, &vc);
+    _mm_storeu_ps(s, vs);
+    _mm_storeu_ps(c, vc);
+}
+
+VABI_DECL(_ZGVcN8vl4l4_amd_sincosf, void, __m256 x, float *s, float *c)
+{
+    __m256 vs, vc;
+
+    amd_vrs8_sincosf(x, &vs, &vc);
+    _mm256_storeu_ps(s, vs);
+    _mm256_storeu_ps(c, vc);
+}
+
+VABI_DECL(_ZGVdN8vl4l4_amd_sincosf, void, __m256 x, float *s, float *c)
+{
+    __m256 vs, vc;
+
+    amd_vrs8_sincosf(x, &vs, &vc);
+    _mm256_storeu_ps(s, vs);
+    _mm256_storeu_ps(c, vc);
+}
@@ -169,8 +169,10 @@ ALM_PROTO_OPT(vrd2_cos)(v_f64x2_t x)
     /* Otherwise, return the above computed result */
     for(int i = 0; i < 2; i++)
     {
-        if(unlikely(ixd[i] > COS_MAX))
+        if(unlikely(ixd[i] > COS_MAX)) {
+            ALM_STATS_LANE();
             result[i] = SCALAR_COS(x[i]);
+        }
     }
     return result;
 
@@ -187,8 +187,10 @@ ALM_PROTO_OPT(vrd2_exp)(v_f64x2_t x)
     // Else, return the above computed result
     for(int i = 0; i < 2; i++)
     {
-        if(unlikely(vx[i] > ARG_MAX))
+        if(unlikely(vx[i] > ARG_MAX)) {
+            ALM_STATS_LANE();
             ret[i] = SCALAR_EXP(x[i]);
+        }
     }
 
     return ret;
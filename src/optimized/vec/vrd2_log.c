@@ -175,8 +175,10 @@ ALM_PROTO_OPT(vrd2_log) (__m128d x)
     /* Otherwise, return the above computed result */
     for(int i = 0; i < 2; i++)
     {
-        if(unlikely(ux[i] > LOG_ARG_MAX))
+        if(unlikely(ux[i] > LOG_ARG_MAX)) {
+            ALM_STATS_LANE();
             r[i] = SCALAR_LOG(x[i]);
+        }
     }
     return r;
 }
@@ -292,6 +292,7 @@ ALM_PROTO_OPT(vrd2_pow)(__m128d _x,__m128d _y)
     /* Otherwise, return the above computed result */
     for(int i = 0; i < VECTOR_LENGTH; i++) {
         if(unlikely(v[i] >= EXP_MAX)){
+            ALM_STATS_LANE();
             result[i] = SCALAR_POW(_x[i], _y[i]);
          }
     }
@@ -151,8 +151,10 @@ ALM_PROTO_OPT(vrd2_sin)(v_f64x2_t x)
     /* Otherwise, return the above computed result */
     for(int i = 0; i < 2; i++)
     {
-        if(ux[i] > SIN_ARG_MAX)
+        if(ux[i] > SIN_ARG_MAX) {
+            ALM_STATS_LANE();
             result[i] = SCALAR_SIN(x[i]);
+        }
     }
     return result;
 }
@@ -178,8 +178,10 @@ ALM_PROTO_OPT(vrd4_exp)(v_f64x4_t x)
     // Else, return the above computed result
     for(int i =0; i<4; i++)
     {
-        if(unlikely(vx[i] > ARG_MAX))
+        if(unlikely(vx[i] > ARG_MAX)) {
+            ALM_STATS_LANE();
             ret[i] = SCALAR_EXP(x[i]);
+        }
     }
 
     return ret;
@@ -180,8 +180,10 @@ ALM_PROTO_OPT(vrd4_log) (__m256d x)
     /* Otherwise, return the above computed result */
     for(int i = 0; i < 4; i++)
     {
-        if(unlikely(ux[i] > LOG_ARG_MAX))
+        if(unlikely(ux[i] > LOG_ARG_MAX)) {
+            ALM_STATS_LANE();
             r[i] = SCALAR_LOG(x[i]);
+        }
     }
 
     return r;
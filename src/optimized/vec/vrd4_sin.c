@@ -154,8 +154,10 @@ ALM_PROTO_OPT(vrd4_sin)(v_f64x4_t x)
     /* Otherwise, return the above computed result */
     for(int i = 0; i < 4; i++)
     {
-        if(unlikely(ux[i] > SIN_ARG_MAX))
+        if(unlikely(ux[i] > SIN_ARG_MAX)) {
+            ALM_STATS_LANE();
             result[i] = SCALAR_SIN(x[i]);
+        }
     }
     return result;
 }
@@ -151,8 +151,10 @@ ALM_PROTO_OPT(vrs8_cosf)(v_f32x8_t x)
     /* Otherwise, return the above computed result */
     for(int i = 0; i < 8; i++)
     {
-        if(unlikely(ux[i] > COSF_ARG_MAX))
+        if(unlikely(ux[i] > COSF_ARG_MAX)) {
+            ALM_STATS_LANE();
             result[i] = SCALAR_COSF(x[i]);
+        }
     }
     return result;
 }
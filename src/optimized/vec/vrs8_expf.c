@@ -263,8 +263,10 @@ ALM_PROTO_OPT(vrs8_expf)(v_f32x8_t _x)
     // Else, return the above computed result
     for(int i = 0 ; i < 8 ; i++)
     {
-        if(unlikely(vx[i]) > ARG_MAX)
+        if(unlikely(vx[i]) > ARG_MAX) {
+            ALM_STATS_LANE();
             result[i] = SCALAR_EXPF(_x[i]);
+        }
     }
     return result;
 
@@ -198,8 +198,10 @@ ALM_PROTO_OPT(vrs8_logf)(v_f32x8_t _x)
     vx =  as_v8_u32_f32(_x);
     for(int i = 0; i < 8; i++)
     {
-        if(unlikely(vx[i] > LOGF_MAX))
+        if(unlikely(vx[i] > LOGF_MAX)) {
+            ALM_STATS_LANE();
             q[i] = SCALAR_LOGF(_x[i]);
+        }
     }
     return q;
 }
@@ -0,0 +1,391 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Fused expression pipeline over the array kernels
+ *
+ * Signature:
+ *    int alm_expr_execute(const alm_expr_t *expr, size_t len,
+ *                         const double *const *args, double *dst)
+ *    int alm_expr_executef(const alm_expr_t *expr, size_t len,
+ *                          const float *const *args, float *dst)
+ *
+ * Implementation notes:
+ *
+ *    An expression is a small postfix (stack) program built with
+ *    alm_expr_arg/const/affine/powx/op, e.g. exp(a*x + b) * c is
+ *
+ *        arg(0) affine(a, b) op(EXP) affine(c, 0)
+ *
+ *    and sin(x) * cos(y) is
+ *
+ *        arg(0) op(SIN) arg(1) op(COS) op(MUL)
+ *
+ *    alm_expr_compile() checks the program and folds it:
+ *      - a constant feeding ADD/SUB/MUL becomes an affine step,
+ *        a constant feeding POW becomes powx,
+ *      - back to back affine steps are merged into one.
+ *
+ *    Execution walks the array in blocks of ALM_EXPR_BLK elements. Every
+ *    stack slot owns one block sized buffer, so the whole working set of a
+ *    program (ALM_EXPR_MAX_DEPTH buffers) stays in L1 while each step of the
+ *    program runs over the block with the dispatched array kernels
+ *    (amd_vrda_exp, amd_vrda_mul, ...). Memory is touched once per input
+ *    and once for the result, however long the chain is.
+ *
+ *    Pushing an argument does not copy it, the slot just points into the
+ *    input array. The last step writes straight into dst.
+ *
+ *    Blocks are independent, so long arrays are split into contiguous
+ *    ranges by __alm_parallel_for() that run the program concurrently.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <libm_macros.h>
+#include <libm/alm_parallel.h>
+#include <external/amdlibm_vec.h>
+
+#define ALM_EXPR_BLK        512
+
+/* Program steps that are not part of the public op list */
+enum {
+    ALM_EXPR_ARG = ALM_EXPR_OP_MAX,
+    ALM_EXPR_CONST,
+    ALM_EXPR_AFFINE,
+    ALM_EXPR_POWX,
+};
+
+enum {
+    ALM_EXPR_STATE_BUILD = 0,
+    ALM_EXPR_STATE_READY,
+    ALM_EXPR_STATE_ERROR,
+};
+
+typedef void (*vrda_unary_t)(int, const double *, double *);
+typedef void (*vrda_binary_t)(int, const double *, const double *, double *);
+typedef void (*vrsa_unary_t)(int, const float *, float *);
+typedef void (*vrsa_binary_t)(int, const float *, const float *, float *);
+
+static const vrda_binary_t vrda_binary_ops[ALM_EXPR_OP_MAX] = {
+    [ALM_EXPR_ADD]   = FN_PROTOTYPE(vrda_add),
+    [ALM_EXPR_SUB]   = FN_PROTOTYPE(vrda_sub),
+    [ALM_EXPR_MUL]   = FN_PROTOTYPE(vrda_mul),
+    [ALM_EXPR_DIV]   = FN_PROTOTYPE(vrda_div),
+    [ALM_EXPR_POW]   = FN_PROTOTYPE(vrda_pow),
+    [ALM_EXPR_FMAX]  = FN_PROTOTYPE(vrda_fmax),
+    [ALM_EXPR_FMIN]  = FN_PROTOTYPE(vrda_fmin),
+};
+
+static const vrda_unary_t vrda_unary_ops[ALM_EXPR_OP_MAX] = {
+    [ALM_EXPR_EXP]   = FN_PROTOTYPE(vrda_exp),
+    [ALM_EXPR_EXP2]  = FN_PROTOTYPE(vrda_exp2),
+    [ALM_EXPR_EXPM1] = FN_PROTOTYPE(vrda_expm1),
+    [ALM_EXPR_LOG]   = FN_PROTOTYPE(vrda_log),
+    [ALM_EXPR_LOG2]  = FN_PROTOTYPE(vrda_log2),
+    [ALM_EXPR_LOG10] = FN_PROTOTYPE(vrda_log10),
+    [ALM_EXPR_LOG1P] = FN_PROTOTYPE(vrda_log1p),
+    [ALM_EXPR_SIN]   = FN_PROTOTYPE(vrda_sin),
+    [ALM_EXPR_COS]   = FN_PROTOTYPE(vrda_cos),
+    [ALM_EXPR_TAN]   = FN_PROTOTYPE(vrda_tan),
+    [ALM_EXPR_ATAN]  = FN_PROTOTYPE(vrda_atan),
+    [ALM_EXPR_COSH]  = FN_PROTOTYPE(vrda_cosh),
+    [ALM_EXPR_SQRT]  = FN_PROTOTYPE(vrda_sqrt),
+    [ALM_EXPR_CBRT]  = FN_PROTOTYPE(vrda_cbrt),
+    [ALM_EXPR_ERF]   = FN_PROTOTYPE(vrda_erf),
+    [ALM_EXPR_FABS]  = FN_PROTOTYPE(vrda_fabs),
+};
+
+static const vrsa_binary_t vrsa_binary_ops[ALM_EXPR_OP_MAX] = {
+    [ALM_EXPR_ADD]   = FN_PROTOTYPE(vrsa_addf),
+    [ALM_EXPR_SUB]   = FN_PROTOTYPE(vrsa_subf),
+    [ALM_EXPR_MUL]   = FN_PROTOTYPE(vrsa_mulf),
+    [ALM_EXPR_DIV]   = FN_PROTOTYPE(vrsa_divf),
+    [ALM_EXPR_POW]   = FN_PROTOTYPE(vrsa_powf),
+    [ALM_EXPR_FMAX]  = FN_PROTOTYPE(vrsa_fmaxf),
+    [ALM_EXPR_FMIN]  = FN_PROTOTYPE(vrsa_fminf),
+};
+
+static const vrsa_unary_t vrsa_unary_ops[ALM_EXPR_OP_MAX] = {
+    [ALM_EXPR_EXP]   = FN_PROTOTYPE(vrsa_expf),
+    [ALM_EXPR_EXP2]  = FN_PROTOTYPE(vrsa_exp2f),
+    [ALM_EXPR_EXPM1] = FN_PROTOTYPE(vrsa_expm1f),
+    [ALM_EXPR_LOG]   = FN_PROTOTYPE(vrsa_logf),
+    [ALM_EXPR_LOG2]  = FN_PROTOTYPE(vrsa_log2f),
+    [ALM_EXPR_LOG10] = FN_PROTOTYPE(vrsa_log10f),
+    [ALM_EXPR_LOG1P] = FN_PROTOTYPE(vrsa_log1pf),
+    [ALM_EXPR_SIN]   = FN_PROTOTYPE(vrsa_sinf),
+    [ALM_EXPR_COS]   = FN_PROTOTYPE(vrsa_cosf),
+    [ALM_EXPR_TAN]   = FN_PROTOTYPE(vrsa_tanf),
+    [ALM_EXPR_ATAN]  = FN_PROTOTYPE(vrsa_atanf),
+    [ALM_EXPR_COSH]  = FN_PROTOTYPE(vrsa_coshf),
+    [ALM_EXPR_SQRT]  = FN_PROTOTYPE(vrsa_sqrtf),
+    [ALM_EXPR_CBRT]  = FN_PROTOTYPE(vrsa_cbrtf),
+    [ALM_EXPR_ERF]   = FN_PROTOTYPE(vrsa_erff),
+    [ALM_EXPR_FABS]  = FN_PROTOTYPE(vrsa_fabsf),
+};
+
+static inline int
+expr_is_binary(int op)
+{
+    return op >= 0 && op < ALM_EXPR_OP_MAX && vrda_binary_ops[op] != NULL;
+}
+
+static inline int
+expr_is_unary(int op)
+{
+    return op >= 0 && op < ALM_EXPR_OP_MAX && vrda_unary_ops[op] != NULL;
+}
+
+/*
+ * Appends a step, tracking the stack depth it leaves behind. Any error
+ * poisons the expression so that compile reports it.
+ */
+static int
+expr_push(alm_expr_t *expr, int op, int arg, double a, double b, int pops)
+{
+    if (expr == NULL)
+        return -1;
+
+    if (expr->state != ALM_EXPR_STATE_BUILD ||
+        expr->nops == ALM_EXPR_MAX_OPS ||
+        expr->depth < pops ||
+        expr->depth - pops + 1 > ALM_EXPR_MAX_DEPTH) {
+        expr->state = ALM_EXPR_STATE_ERROR;
+        return -1;
+    }
+
+    expr->code[expr->nops].op  = op;
+    expr->code[expr->nops].arg = arg;
+    expr->code[expr->nops].a   = a;
+    expr->code[expr->nops].b   = b;
+    expr->nops++;
+    expr->depth += 1 - pops;
+
+    return 0;
+}
+
+void alm_expr_init(alm_expr_t *expr)
+{
+    memset(expr, 0, sizeof(*expr));
+}
+
+int alm_expr_arg(alm_expr_t *expr, int index)
+{
+    if (index < 0 || index >= ALM_EXPR_MAX_ARGS) {
+        if (expr)
+            expr->state = ALM_EXPR_STATE_ERROR;
+        return -1;
+    }
+
+    return expr_push(expr, ALM_EXPR_ARG, index, 0.0, 0.0, 0);
+}
+
+int alm_expr_const(alm_expr_t *expr, double value)
+{
+    return expr_push(expr, ALM_EXPR_CONST, 0, value, 0.0, 0);
+}
+
+int alm_expr_affine(alm_expr_t *expr, double scale, double shift)
+{
+    return expr_push(expr, ALM_EXPR_AFFINE, 0, scale, shift, 1);
+}
+
+int alm_expr_powx(alm_expr_t *expr, double y)
+{
+    return expr_push(expr, ALM_EXPR_POWX, 0, y, 0.0, 1);
+}
+
+int alm_expr_op(alm_expr_t *expr, alm_expr_op_t op)
+{
+    int o = (int)op;
+
+    if (expr_is_binary(o))
+        return expr_push(expr, o, 0, 0.0, 0.0, 2);
+
+    if (expr_is_unary(o))
+        return expr_push(expr, o, 0, 0.0, 0.0, 1);
+
+    if (expr)
+        expr->state = ALM_EXPR_STATE_ERROR;
+    return -1;
+}
+
+int alm_expr_compile(alm_expr_t *expr)
+{
+    int i, n = 0;
+
+    if (expr == NULL || expr->state == ALM_EXPR_STATE_ERROR ||
+        expr->nops == 0 || expr->depth != 1)
+        return -1;
+
+    if (expr->state == ALM_EXPR_STATE_READY)
+        return 0;
+
+    for (i = 0; i < expr->nops; i++) {
+        int    op = expr->code[i].op;
+        double c  = expr->code[i].a;
+
+        /* t <op> const  ->  affine / powx */
+        if (op == ALM_EXPR_CONST && i + 1 < expr->nops) {
+            int next = expr->code[i + 1].op;
+
+            if (next == ALM_EXPR_ADD || next == ALM_EXPR_SUB ||
+                next == ALM_EXPR_MUL || next == ALM_EXPR_POW) {
+                expr->code[n].op  = next == ALM_EXPR_POW ? ALM_EXPR_POWX
+                                                         : ALM_EXPR_AFFINE;
+                expr->code[n].arg = 0;
+                expr->code[n].a   = next == ALM_EXPR_MUL ? c :
+                                    next == ALM_EXPR_POW ? c : 1.0;
+                /* t * c + -0.0 keeps the sign of a zero product */
+                expr->code[n].b   = next == ALM_EXPR_ADD ? c :
+                                    next == ALM_EXPR_SUB ? -c : -0.0;
+                i++;
+                op = expr->code[n].op;
+            } else {
+                expr->code[n] = expr->code[i];
+            }
+        } else {
+            expr->code[n] = expr->code[i];
+        }
+
+        /* a2 * (a1 * t + b1) + b2  ->  (a2 * a1) * t + (a2 * b1 + b2) */
+        if (op == ALM_EXPR_AFFINE && n > 0 &&
+            expr->code[n - 1].op == ALM_EXPR_AFFINE) {
+            double a1 = expr->code[n - 1].a, b1 = expr->code[n - 1].b;
+            double a2 = expr->code[n].a,     b2 = expr->code[n].b;
+
+            expr->code[n - 1].a = a2 * a1;
+            expr->code[n - 1].b = a2 * b1 + b2;
+            continue;
+        }
+
+        n++;
+    }
+
+    expr->nops  = n;
+    expr->state = ALM_EXPR_STATE_READY;
+
+    return 0;
+}
+
+/*
+ * Both precisions share one interpreter, generated for element type T
+ * with the array kernel tables of the matching precision.
+ */
+#define ALM_EXPR_EXECUTE(name, T, unary_ops, binary_ops, powx)              \
+                                                                            \
+typedef struct {                                                            \
+    const alm_expr_t *expr;                                                 \
+    const T *const   *args;                                                 \
+    T                *dst;                                                  \
+} name##_job_t;                                                             \
+                                                                            \
+static void                                                                 \
+name##_range(void *arg, size_t start, size_t end)                           \
+{                                                                           \
+    const name##_job_t *job = arg;                                          \
+    const alm_expr_t *expr = job->expr;                                     \
+    const T *const *args = job->args;                                       \
+    T *dst = job->dst;                                                      \
+    T buf[ALM_EXPR_MAX_DEPTH][ALM_EXPR_BLK];                                \
+    const T *slot[ALM_EXPR_MAX_DEPTH];                                      \
+    size_t i, j, n;                                                         \
+    int k, sp;                                                              \
+                                                                            \
+    for (i = start; i < end; i += n) {                                      \
+        n = end - i < ALM_EXPR_BLK ? end - i : ALM_EXPR_BLK;                \
+        sp = 0;                                                             \
+                                                                            \
+        for (k = 0; k < expr->nops; k++) {                                  \
+            int op   = expr->code[k].op;                                    \
+            T   a    = (T)expr->code[k].a;                                  \
+            T   b    = (T)expr->code[k].b;                                  \
+            int last = k == expr->nops - 1;                                 \
+            T  *out;                                                        \
+                                                                            \
+            if (op == ALM_EXPR_ARG) {                                       \
+                slot[sp] = args[expr->code[k].arg] + i;                     \
+                if (last && slot[sp] != dst + i)                            \
+                    memcpy(dst + i, slot[sp], n * sizeof(T));               \
+                sp++;                                                       \
+                continue;                                                   \
+            }                                                               \
+                                                                            \
+            if (op == ALM_EXPR_CONST) {                                     \
+                out = last ? dst + i : buf[sp];                             \
+                for (j = 0; j < n; j++)                                     \
+                    out[j] = a;                                             \
+                slot[sp++] = out;                                           \
+                continue;                                                   \
+            }                                                               \
+                                                                            \
+            if (expr_is_binary(op))                                         \
+                sp--;                                                       \
+                                                                            \
+            out = last ? dst + i : buf[sp - 1];                             \
+                                                                            \
+            switch (op) {                                                   \
+            case ALM_EXPR_AFFINE:                                           \
+                for (j = 0; j < n; j++)                                     \
+                    out[j] = a * slot[sp - 1][j] + b;                       \
+                break;                                                      \
+            case ALM_EXPR_POWX:                                             \
+                powx((int)n, slot[sp - 1], a, out);                         \
+                break;                                                      \
+            default:                                                        \
+                if (expr_is_binary(op))                                     \
+                    binary_ops[op]((int)n, slot[sp - 1], slot[sp], out);    \
+                else                                                        \
+                    unary_ops[op]((int)n, slot[sp - 1], out);               \
+                break;                                                      \
+            }                                                               \
+                                                                            \
+            slot[sp - 1] = out;                                             \
+        }                                                                   \
+    }                                                                       \
+}                                                                           \
+                                                                            \
+int name(const alm_expr_t *expr, size_t len, const T *const *args, T *dst)  \
+{                                                                           \
+    name##_job_t job = { expr, args, dst };                                 \
+                                                                            \
+    if (expr == NULL || expr->state != ALM_EXPR_STATE_READY ||              \
+        dst == NULL || (args == NULL && len))                               \
+        return -1;                                                          \
+                                                                            \
+    __alm_parallel_for(len, name##_range, &job);                            \
+                                                                            \
+    return 0;                                                               \
+}
+
+ALM_EXPR_EXECUTE(alm_expr_execute, double, vrda_unary_ops, vrda_binary_ops,
+                 FN_PROTOTYPE(vrda_powx))
+
+ALM_EXPR_EXECUTE(alm_expr_executef, float, vrsa_unary_ops, vrsa_binary_ops,
+                 FN_PROTOTYPE(vrsa_powxf))
@@ -0,0 +1,406 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Reductions over the array kernels
+ *
+ * Signature:
+ *    double amd_vrda_sumexp(int len, const double *src)
+ *    double amd_vrda_logsumexp(int len, const double *src)
+ *    double amd_vrda_sumlog(int len, const double *src)
+ *    float  amd_vrsa_sumexpf(int len, const float *src)
+ *    float  amd_vrsa_logsumexpf(int len, const float *src)
+ *    float  amd_vrsa_sumlogf(int len, const float *src)
+ *
+ * Implementation notes:
+ *
+ *    sumexp(x)    = sum(exp(x[i]))
+ *    logsumexp(x) = m + log(sum(exp(x[i] - m))),  m = max(x[i])
+ *    sumlog(x)    = sum(log(x[i]))
+ *
+ *    The input is walked in blocks of ALM_RED_BLK elements. Each block is
+ *    run through the dispatched array kernel into a small stack buffer
+ *    that stays in L1 and is summed right away, so the intermediate array
+ *    is never written to memory.
+ *
+ *    A block is summed with ALM_RED_ACC independent accumulators (which
+ *    also breaks the add latency chain), combined pairwise. Block sums are
+ *    added with Neumaier compensation, so the rounding error does not grow
+ *    with the length of the array. Single precision sums in double.
+ *
+ *    logsumexp makes a first pass for the maximum. After the shift every
+ *    exp() is in (0, 1] and at least one is 1, so the sum can neither
+ *    overflow nor underflow to 0.
+ *
+ *    sumlogf needs no log per element: with x = 2^e * m, m in [1, 2),
+ *
+ *        sum(log(x[i])) = sum(e[i]) * ln2 + log(prod(m[i]))
+ *
+ *    The mantissas are multiplied in double (ALM_RED_ACC partial products,
+ *    renormalised after every block), leaving a single log at the end.
+ *    The relative error of the product is about len * 2^-53, well below
+ *    float precision. Blocks holding zeros, negatives, subnormals, Inf or
+ *    NaN go through amd_vrsa_logf instead. Double precision has no such
+ *    headroom and always sums logs.
+ *
+ *    The array log kernels do not handle zero, subnormal or +Inf inputs,
+ *    so the lanes holding one are redone with the scalar log.
+ *
+ *    Special cases:
+ *      len <= 0:  sumexp and sumlog return 0, logsumexp returns -Inf.
+ *      Any NaN input gives NaN.
+ *      sumlog returns -Inf for a zero input, +Inf for a +Inf input and
+ *      NaN for a negative input or for both a zero and a +Inf.
+ *      logsumexp returns +Inf if any input is +Inf, -Inf if all are -Inf.
+ */
+
+#include <stdint.h>
+
+#include <libm_macros.h>
+#include <libm/typehelper.h>
+#include <external/amdlibm.h>
+
+#define ALM_RED_BLK     256
+#define ALM_RED_ACC     8
+
+/* log(2) split so that e * LN2_HI is exact for any exponent sum < 2^32 */
+#define LN2_HI          0x1.62e42fefa0000p-1
+#define LN2_LO          0x1.cf79abc9e3b3ap-40
+
+typedef struct {
+    double s;   /* running sum */
+    double c;   /* compensation */
+} red_acc_t;
+
+static inline void
+red_add(red_acc_t *acc, double v)
+{
+    double t = acc->s + v;
+
+    if (fabs(acc->s) >= fabs(v))
+        acc->c += (acc->s - t) + v;
+    else
+        acc->c += (v - t) + acc->s;
+
+    acc->s = t;
+}
+
+static inline double
+red_result(const red_acc_t *acc)
+{
+    /* Once the sum is Inf or NaN the compensation means nothing */
+    if (!isfinite(acc->s))
+        return acc->s;
+
+    return acc->s + acc->c;
+}
+
+static inline double
+red_sum(const double *v, int n)
+{
+    double s[ALM_RED_ACC] = { 0.0 };
+    int i, j;
+
+    for (i = 0; i + ALM_RED_ACC <= n; i += ALM_RED_ACC)
+        for (j = 0; j < ALM_RED_ACC; j++)
+            s[j] += v[i + j];
+
+    for (j = 0; i < n; i++, j++)
+        s[j] += v[i];
+
+    return ((s[0] + s[1]) + (s[2] + s[3])) + ((s[4] + s[5]) + (s[6] + s[7]));
+}
+
+static inline double
+red_sumf(const float *v, int n)
+{
+    double s[ALM_RED_ACC] = { 0.0 };
+    int i, j;
+
+    for (i = 0; i + ALM_RED_ACC <= n; i += ALM_RED_ACC)
+        for (j = 0; j < ALM_RED_ACC; j++)
+            s[j] += (double)v[i + j];
+
+    for (j = 0; i < n; i++, j++)
+        s[j] += (double)v[i];
+
+    return ((s[0] + s[1]) + (s[2] + s[3])) + ((s[4] + s[5]) + (s[6] + s[7]));
+}
+
+/*
+ * Maximum of src[0, len), NaN if any element is NaN.
+ */
+static double
+red_max(int len, const double *src)
+{
+    double m[ALM_RED_ACC];
+    int nan = 0, i, j;
+
+    for (j = 0; j < ALM_RED_ACC; j++)
+        m[j] = -INFINITY;
+
+    for (i = 0; i + ALM_RED_ACC <= len; i += ALM_RED_ACC) {
+        for (j = 0; j < ALM_RED_ACC; j++) {
+            double x = src[i + j];
+            nan |= x != x;
+            m[j] = x > m[j] ? x : m[j];
+        }
+    }
+
+    for (j = 0; i < len; i++, j++) {
+        double x = src[i];
+        nan |= x != x;
+        m[j] = x > m[j] ? x : m[j];
+    }
+
+    if (nan)
+        return NAN;
+
+    for (j = 1; j < ALM_RED_ACC; j++)
+        m[0] = m[j] > m[0] ? m[j] : m[0];
+
+    return m[0];
+}
+
+static float
+red_maxf(int len, const float *src)
+{
+    float m[ALM_RED_ACC];
+    int nan = 0, i, j;
+
+    for (j = 0; j < ALM_RED_ACC; j++)
+        m[j] = -INFINITY;
+
+    for (i = 0; i + ALM_RED_ACC <= len; i += ALM_RED_ACC) {
+        for (j = 0; j < ALM_RED_ACC; j++) {
+            float x = src[i + j];
+            nan |= x != x;
+            m[j] = x > m[j] ? x : m[j];
+        }
+    }
+
+    for (j = 0; i < len; i++, j++) {
+        float x = src[i];
+        nan |= x != x;
+        m[j] = x > m[j] ? x : m[j];
+    }
+
+    if (nan)
+        return NAN;
+
+    for (j = 1; j < ALM_RED_ACC; j++)
+        m[0] = m[j] > m[0] ? m[j] : m[0];
+
+    return m[0];
+}
+
+double FN_PROTOTYPE(vrda_sumexp)(int len, const double *src)
+{
+    double buf[ALM_RED_BLK];
+    red_acc_t acc = { 0.0, 0.0 };
+    int i, n;
+
+    for (i = 0; i < len; i += n) {
+        n = len - i < ALM_RED_BLK ? len - i : ALM_RED_BLK;
+        FN_PROTOTYPE(vrda_exp)(n, src + i, buf);
+        red_add(&acc, red_sum(buf, n));
+    }
+
+    return red_result(&acc);
+}
+
+float FN_PROTOTYPE(vrsa_sumexpf)(int len, const float *src)
+{
+    float buf[ALM_RED_BLK];
+    red_acc_t acc = { 0.0, 0.0 };
+    int i, n;
+
+    for (i = 0; i < len; i += n) {
+        n = len - i < ALM_RED_BLK ? len - i : ALM_RED_BLK;
+        FN_PROTOTYPE(vrsa_expf)(n, src + i, buf);
+        red_add(&acc, red_sumf(buf, n));
+    }
+
+    return (float)red_result(&acc);
+}
+
+double FN_PROTOTYPE(vrda_logsumexp)(int len, const double *src)
+{
+    double buf[ALM_RED_BLK];
+    red_acc_t acc = { 0.0, 0.0 };
+    double m;
+    int i, j, n;
+
+    if (len <= 0)
+        return -INFINITY;
+
+    m = red_max(len, src);
+    if (!isfinite(m))
+        return m;
+
+    for (i = 0; i < len; i += n) {
+        n = len - i < ALM_RED_BLK ? len - i : ALM_RED_BLK;
+        for (j = 0; j < n; j++)
+            buf[j] = src[i + j] - m;
+        FN_PROTOTYPE(vrda_exp)(n, buf, buf);
+        red_add(&acc, red_sum(buf, n));
+    }
+
+    return m + FN_PROTOTYPE(log)(red_result(&acc));
+}
+
+float FN_PROTOTYPE(vrsa_logsumexpf)(int len, const float *src)
+{
+    float buf[ALM_RED_BLK];
+    red_acc_t acc = { 0.0, 0.0 };
+    float m;
+    int i, j, n;
+
+    if (len <= 0)
+        return -INFINITY;
+
+    m = red_maxf(len, src);
+    if (!isfinite(m))
+        return m;
+
+    for (i = 0; i < len; i += n) {
+        n = len - i < ALM_RED_BLK ? len - i : ALM_RED_BLK;
+        for (j = 0; j < n; j++)
+            buf[j] = src[i + j] - m;
+        FN_PROTOTYPE(vrsa_expf)(n, buf, buf);
+        red_add(&acc, red_sumf(buf, n));
+    }
+
+    return (float)((double)m + FN_PROTOTYPE(log)(red_result(&acc)));
+}
+
+/*
+ * The array log kernels leave zero, subnormal and +Inf inputs to the
+ * caller, so those lanes are redone with the scalar log.
+ */
+static inline void
+red_log_fixup(int n, const double *src, double *buf)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+        if (unlikely(asuint64(src[i]) - 0x0010000000000000ULL >=
+                     0x7ff0000000000000ULL - 0x0010000000000000ULL))
+            buf[i] = FN_PROTOTYPE(log)(src[i]);
+}
+
+static inline void
+red_log_fixupf(int n, const float *src, float *buf)
+{
+    int i;
+
+    for (i = 0; i < n; i++)
+        if (unlikely(asuint32(src[i]) - 0x00800000u >=
+                     0x7f800000u - 0x00800000u))
+            buf[i] = FN_PROTOTYPE(logf)(src[i]);
+}
+
+double FN_PROTOTYPE(vrda_sumlog)(int len, const double *src)
+{
+    double buf[ALM_RED_BLK];
+    red_acc_t acc = { 0.0, 0.0 };
+    int i, n;
+
+    for (i = 0; i < len; i += n) {
+        n = len - i < ALM_RED_BLK ? len - i : ALM_RED_BLK;
+        FN_PROTOTYPE(vrda_log)(n, src + i, buf);
+        red_log_fixup(n, src + i, buf);
+        red_add(&acc, red_sum(buf, n));
+    }
+
+    return red_result(&acc);
+}
+
+/*
+ * Whether every element of src[0, n) is a positive normal number.
+ */
+static inline int
+red_all_normalf(const float *src, int n)
+{
+    uint32_t bad = 0;
+    int i;
+
+    for (i = 0; i < n; i++)
+        bad |= asuint32(src[i]) - 0x00800000u >= 0x7f800000u - 0x00800000u;
+
+    return !bad;
+}
+
+float FN_PROTOTYPE(vrsa_sumlogf)(int len, const float *src)
+{
+    float buf[ALM_RED_BLK];
+    red_acc_t acc = { 0.0, 0.0 };
+    double p[ALM_RED_ACC];
+    int64_t e = 0;
+    int i, j, k, n;
+
+    for (j = 0; j < ALM_RED_ACC; j++)
+        p[j] = 1.0;
+
+    for (i = 0; i < len; i += n) {
+        n = len - i < ALM_RED_BLK ? len - i : ALM_RED_BLK;
+
+        if (!red_all_normalf(src + i, n)) {
+            FN_PROTOTYPE(vrsa_logf)(n, src + i, buf);
+            red_log_fixupf(n, src + i, buf);
+            red_add(&acc, red_sumf(buf, n));
+            continue;
+        }
+
+        /* ALM_RED_BLK / ALM_RED_ACC factors in [1, 2) per partial product */
+        for (k = 0; k < n; k += ALM_RED_ACC) {
+            for (j = 0; j < ALM_RED_ACC && k + j < n; j++) {
+                uint32_t u = asuint32(src[i + k + j]);
+
+                e += (int64_t)(u >> 23) - 127;
+                p[j] *= (double)asfloat((u & 0x007fffffu) | 0x3f800000u);
+            }
+        }
+
+        for (j = 0; j < ALM_RED_ACC; j++) {
+            uint64_t u = asuint64(p[j]);
+
+            e += (int64_t)(u >> 52) - 1023;
+            p[j] = asdouble((u & 0x000fffffffffffffULL) |
+                            0x3ff0000000000000ULL);
+        }
+    }
+
+    for (j = 1; j < ALM_RED_ACC; j++)
+        p[0] *= p[j];
+
+    red_add(&acc, FN_PROTOTYPE(log)(p[0]));
+    red_add(&acc, (double)e * LN2_LO);
+    red_add(&acc, (double)e * LN2_HI);
+
+    return (float)red_result(&acc);
+}
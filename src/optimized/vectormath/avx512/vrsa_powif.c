@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Signature:
+ *   void vrsa_powif(int len, const float *x, int n, float *y)
+ *
+ * Computes y[i] = x[i]^n for an integer n.
+ *
+ * SPEC:
+ *    Same as powf(x[i], (float)n)
+ *
+ ******************************************
+ * Implementation Notes
+ * ----------------------
+ * The inputs are widened to double, 8 lanes at a time, x^|n| is formed by
+ * binary exponentiation and a negative n takes the reciprocal at the end.
+ * The result is rounded to float once; the binary64 range absorbs the
+ * intermediate overflow and underflow, so there is no scalar fallback.
+ * Exponents beyond POWI_MAX in magnitude go to vrsa_powxf.
+ *
+ * See include/libm/alm_powi.h for the kernels.
+ *
+ * Max ULP: 0.51
+ */
+
+#include <immintrin.h>
+
+#include <libm_macros.h>
+#include <libm/amd_funcs_internal.h>
+#include <libm_util_amd.h>
+
+#include <libm/arch/zen4.h>
+
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 8
+#include <libm/alm_powi.h>
+
+void
+ALM_PROTO_ARCH_ZN4(vrsa_powif)(int len, const float *x, int n, float *y)
+{
+    unsigned k = n < 0 ? 0u - (unsigned)n : (unsigned)n;
+
+    if (unlikely(k > POWI_MAX)) {
+        ALM_PROTO(vrsa_powxf)(len, x, (float)n, y);
+        return;
+    }
+
+    powi_arrayf(len, x, k, 0, n < 0, y);
+}
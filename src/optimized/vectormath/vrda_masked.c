@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Indexed and masked array variants for double precision
+ *
+ * Signature:
+ *    void amd_vrda_<fn>_idx(size_t len, const size_t *idx,
+ *                           const double *src, double *dst)
+ *    void amd_vrda_<fn>_mask(size_t len, const unsigned char *mask,
+ *                            const double *src, double *dst)
+ *    void amd_vrda_<fn>_bmask(size_t len, const unsigned char *bits,
+ *                             const double *src, double *dst)
+ *
+ *    _idx   : dst[idx[i]] = f(src[idx[i]])    for 0 <= i < len
+ *    _mask  : dst[i] = f(src[i])              where mask[i] != 0
+ *    _bmask : dst[i] = f(src[i])              where bit (i % 8) of bits[i / 8] is set
+ *
+ *    Elements that are not selected are never written to dst and never
+ *    reach the kernel. _mask and _bmask still load every src[i], i < len,
+ *    so the whole of src must be readable.
+ *
+ * Implementation notes:
+ *
+ *    The selected elements are compacted into an L1 resident buffer of
+ *    ALM_MASKED_BLK elements, the dispatched array kernel (amd_vrda_<fn>)
+ *    runs on the dense block and the results are expanded back to their
+ *    original positions.
+ *
+ *    Because only selected elements reach the kernel, garbage, NaN or huge
+ *    values in inactive lanes can never drive the kernel into its special
+ *    case or large argument paths, and a sparse mask costs in proportion to
+ *    the number of active elements, not the array length.
+ *
+ *    The compaction loops are branch free (store unconditionally, advance
+ *    the write position by the mask bit) so that random masks do not cost
+ *    a branch misprediction per element.
+ */
+
+#include <stddef.h>
+
+#include <libm_macros.h>
+#include <libm_amd.h>
+
+#define ALM_MASKED_BLK      512
+
+typedef void (*vrda_unary_t)(int, const double *, double *);
+
+static void
+vrda_indexed_unary(vrda_unary_t kern, size_t len, const size_t *idx,
+                   const double *src, double *dst)
+{
+    double ibuf[ALM_MASKED_BLK], obuf[ALM_MASKED_BLK];
+    size_t i, j, n;
+
+    for (i = 0; i < len; i += n) {
+        n = len - i < ALM_MASKED_BLK ? len - i : ALM_MASKED_BLK;
+
+        for (j = 0; j < n; j++)
+            ibuf[j] = src[idx[i + j]];
+
+        kern((int)n, ibuf, obuf);
+
+        for (j = 0; j < n; j++)
+            dst[idx[i + j]] = obuf[j];
+    }
+}
+
+/*
+ * Compacts the selected elements of src[0..n) into buf and their positions
+ * into pos, returns the number of selected elements.
+ */
+static inline size_t
+masked_compress(size_t n, const unsigned char *mask, const double *src,
+                double *buf, unsigned short *pos)
+{
+    size_t j, k = 0;
+
+    for (j = 0; j < n; j++) {
+        buf[k] = src[j];
+        pos[k] = (unsigned short)j;
+        k += mask[j] != 0;
+    }
+
+    return k;
+}
+
+static inline void
+masked_expand(size_t k, const double *buf, const unsigned short *pos, double *dst)
+{
+    size_t j;
+
+    for (j = 0; j < k; j++)
+        dst[pos[j]] = buf[j];
+}
+
+static void
+vrda_masked_unary(vrda_unary_t kern, size_t len, const unsigned char *mask,
+                  const double *src, double *dst)
+{
+    double ibuf[ALM_MASKED_BLK], obuf[ALM_MASKED_BLK];
+    unsigned short pos[ALM_MASKED_BLK];
+    size_t i, k, n;
+
+    for (i = 0; i < len; i += n) {
+        n = len - i < ALM_MASKED_BLK ? len - i : ALM_MASKED_BLK;
+
+        k = masked_compress(n, mask + i, src + i, ibuf, pos);
+
+        /* all lanes of the block active: no need to go through the buffer */
+        if (k == n) {
+            kern((int)n, src + i, dst + i);
+            continue;
+        }
+
+        if (k) {
+            kern((int)k, ibuf, obuf);
+            masked_expand(k, obuf, pos, dst + i);
+        }
+    }
+}
+
+static void
+vrda_bmasked_unary(vrda_unary_t kern, size_t len, const unsigned char *bits,
+                   const double *src, double *dst)
+{
+    unsigned char mask[ALM_MASKED_BLK];
+    size_t i, j, n;
+
+    /* ALM_MASKED_BLK is a multiple of 8, each block starts on a byte */
+    for (i = 0; i < len; i += n) {
+        n = len - i < ALM_MASKED_BLK ? len - i : ALM_MASKED_BLK;
+
+        for (j = 0; j < n; j++)
+            mask[j] = (unsigned char)((bits[(i + j) >> 3] >> ((i + j) & 7)) & 1);
+
+        vrda_masked_unary(kern, n, mask, src + i, dst + i);
+    }
+}
+
+#define ALM_VRDA_MASKED_UNARY(fn)                                           \
+    void FN_PROTOTYPE(vrda_##fn##_idx)(size_t len, const size_t *idx,       \
+                                       const double *src, double *dst)      \
+    {                                                                       \
+        vrda_indexed_unary(FN_PROTOTYPE(vrda_##fn), len, idx, src, dst);    \
+    }                                                                       \
+                                                                            \
+    void FN_PROTOTYPE(vrda_##fn##_mask)(size_t len,                         \
+                                        const unsigned char *mask,          \
+                                        const double *src, double *dst)     \
+    {                                                                       \
+        vrda_masked_unary(FN_PROTOTYPE(vrda_##fn), len, mask, src, dst);    \
+    }                                                                       \
+                                                                            \
+    void FN_PROTOTYPE(vrda_##fn##_bmask)(size_t len,                        \
+                                         const unsigned char *bits,         \
+                                         const double *src, double *dst)    \
+    {                                                                       \
+        vrda_bmasked_unary(FN_PROTOTYPE(vrda_##fn), len, bits, src, dst);   \
+    }
+
+/* Trigonometric */
+ALM_VRDA_MASKED_UNARY(sin)
+ALM_VRDA_MASKED_UNARY(cos)
+ALM_VRDA_MASKED_UNARY(tan)
+ALM_VRDA_MASKED_UNARY(asin)
+ALM_VRDA_MASKED_UNARY(acos)
+ALM_VRDA_MASKED_UNARY(atan)
+
+/* Hyperbolic */
+ALM_VRDA_MASKED_UNARY(cosh)
+
+/* Exponential & Logarithmic */
+ALM_VRDA_MASKED_UNARY(exp)
+ALM_VRDA_MASKED_UNARY(exp2)
+ALM_VRDA_MASKED_UNARY(exp10)
+ALM_VRDA_MASKED_UNARY(expm1)
+ALM_VRDA_MASKED_UNARY(log)
+ALM_VRDA_MASKED_UNARY(log2)
+ALM_VRDA_MASKED_UNARY(log10)
+ALM_VRDA_MASKED_UNARY(log1p)
+
+/* Root */
+ALM_VRDA_MASKED_UNARY(sqrt)
+ALM_VRDA_MASKED_UNARY(cbrt)
+
+/* Error & Normal distribution */
+ALM_VRDA_MASKED_UNARY(erf)
+ALM_VRDA_MASKED_UNARY(erfc)
+ALM_VRDA_MASKED_UNARY(erfinv)
+ALM_VRDA_MASKED_UNARY(erfcinv)
+ALM_VRDA_MASKED_UNARY(cdfnorm)
+ALM_VRDA_MASKED_UNARY(cdfnorminv)
+
+/* Nearest integer, absolute value */
+ALM_VRDA_MASKED_UNARY(fabs)
+ALM_VRDA_MASKED_UNARY(round)
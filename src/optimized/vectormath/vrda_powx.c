@@ -36,6 +36,11 @@ Implementation notes:
     A variation of power function - Computes vector raised to a scalar power
     powx(x,y) = e^(y * log(x))
 
+    When y is an integer or half an integer of magnitude up to POWI_MAX,
+    which covers 0, 2, 3, -1 and 0.5, the log/exp is skipped and x^y is
+    formed by repeated squaring and sqrt() as vrda_powi does, see
+    include/libm/alm_powi.h.
+
 */
 
 #include <libm_macros.h>
@@ -44,10 +49,22 @@ Implementation notes:
 #include <libm_util_amd.h>
 #include <stdio.h>
 
+#define ALM_ACT_DOUBLE
+#define ALM_ACT_VLEN 4
+#include <libm/alm_powi.h>
+
 void ALM_PROTO_OPT(vrda_powx)(int length, const double *x, double y, double *result)
 {
     int j = 0;
     int remainder = length % DOUBLE_ELEMENTS_256_BIT;
+    unsigned k;
+    int half, neg;
+
+    if (powi_split(y, &k, &half, &neg))
+    {
+        powi_array(length, x, k, half, neg, y, result);
+        return;
+    }
 
     if(likely(length >= DOUBLE_ELEMENTS_256_BIT))
     {
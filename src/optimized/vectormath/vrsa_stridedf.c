@@ -0,0 +1,370 @@
+/*
+ * Copyright (C) 2026, Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ *    this list of conditions and the following disclaimer in the documentation
+ *    and/or other materials provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors
+ *    may be used to endorse or promote products derived from this software without
+ *    specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+ * OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/*
+ * Strided array variants with 64-bit lengths for single precision
+ *
+ * Signature:
+ *    void amd_vrsa_<fn>fi_64(size_t len, const float *src, size_t inc_src,
+ *                            float *dst, size_t inc_dst)
+ *
+ * Implementation notes:
+ *
+ *    These are thin drivers around the dispatched array kernels
+ *    (amd_vrsa_<fn>f), so every micro-architecture gets the same kernel it
+ *    would get for a unit stride call.
+ *
+ *    - When all strides are 1 the input is handed to the kernel directly, in
+ *      chunks that fit into the 'int' length of the kernel.
+ *    - Otherwise the input is processed in blocks of ALM_STRIDED_BLK elements.
+ *      Strided operands are packed into a stack buffer (kept in L1), the
+ *      kernel is run on the packed block and the result is unpacked into
+ *      the strided destination. Unit stride operands of a mixed call are
+ *      used in place without copying.
+ *    - Strides of 2 and 3 (interleaved complex / RGB style data) have their
+ *      own pack and unpack loops which the compiler turns into permutes,
+ *      a stride of 0 broadcasts a single input element.
+ *    - Long calls are split into contiguous element ranges by
+ *      __alm_parallel_for() when alm_set_num_threads() allows it, each
+ *      range running the blocked loop above on its own thread.
+ *
+ *    Since every block is fully packed before the kernel writes to the
+ *    destination, src and dst may be the same array with the same stride.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <libm_macros.h>
+#include <libm_amd.h>
+#include <libm/alm_parallel.h>
+
+#define ALM_STRIDED_BLK     512
+#define ALM_STRIDED_CHUNK   ((size_t)1 << 30)
+
+typedef void (*vrsa_unary_t)(int, const float *, float *);
+typedef void (*vrsa_binary_t)(int, const float *, const float *, float *);
+
+static inline void
+strided_pack(size_t n, const float *src, size_t inc, float *buf)
+{
+    size_t i;
+
+    switch (inc) {
+    case 0:
+        for (i = 0; i < n; i++)
+            buf[i] = src[0];
+        break;
+    case 1:
+        memcpy(buf, src, n * sizeof(float));
+        break;
+    case 2:
+        for (i = 0; i < n; i++)
+            buf[i] = src[2 * i];
+        break;
+    case 3:
+        for (i = 0; i < n; i++)
+            buf[i] = src[3 * i];
+        break;
+    default:
+        for (i = 0; i < n; i++)
+            buf[i] = src[i * inc];
+        break;
+    }
+}
+
+static inline void
+strided_unpack(size_t n, const float *buf, float *dst, size_t inc)
+{
+    size_t i;
+
+    switch (inc) {
+    case 2:
+        for (i = 0; i < n; i++)
+            dst[2 * i] = buf[i];
+        break;
+    case 3:
+        for (i = 0; i < n; i++)
+            dst[3 * i] = buf[i];
+        break;
+    default:
+        for (i = 0; i < n; i++)
+            dst[i * inc] = buf[i];
+        break;
+    }
+}
+
+/*
+ * Number of elements handled per kernel call: all unit strides go straight
+ * to the kernel, anything else is bounded by the pack buffers.
+ */
+static inline size_t
+strided_step(size_t left, int unit)
+{
+    size_t max = unit ? ALM_STRIDED_CHUNK : ALM_STRIDED_BLK;
+
+    return left < max ? left : max;
+}
+
+/*
+ * Returns a pointer to 'n' contiguous input elements starting at element
+ * 'i', packing into 'buf' only when the stride is not 1.
+ */
+static inline const float *
+strided_in(const float *src, size_t inc, size_t i, size_t n, float *buf)
+{
+    if (inc == 1)
+        return src + i;
+
+    strided_pack(n, src + i * inc, inc, buf);
+    return buf;
+}
+
+/*
+ * Operands of a strided call, shared by the tasks of a parallel run. Each
+ * task processes the elements [start, end) of the same operands.
+ */
+typedef struct {
+    const float    *x, *y;
+    float          *r, *r2;
+    size_t      inc_x, inc_y, inc_r, inc_r2;
+    vrsa_unary_t   unary;
+    vrsa_binary_t  binary;
+    float           c[4];
+} strided_job_t;
+
+static void
+vrsa_strided_unary(void *arg, size_t start, size_t end)
+{
+    const strided_job_t *job = arg;
+    float ibuf[ALM_STRIDED_BLK], obuf[ALM_STRIDED_BLK];
+    int unit = job->inc_x == 1 && job->inc_r == 1;
+    size_t i, n;
+
+    for (i = start; i < end; i += n) {
+        n = strided_step(end - i, unit);
+
+        const float *in = strided_in(job->x, job->inc_x, i, n, ibuf);
+
+        if (job->inc_r == 1) {
+            job->unary((int)n, in, job->r + i);
+        } else {
+            job->unary((int)n, in, obuf);
+            strided_unpack(n, obuf, job->r + i * job->inc_r, job->inc_r);
+        }
+    }
+}
+
+static void
+vrsa_strided_binary(void *arg, size_t start, size_t end)
+{
+    const strided_job_t *job = arg;
+    float abuf[ALM_STRIDED_BLK], bbuf[ALM_STRIDED_BLK], obuf[ALM_STRIDED_BLK];
+    int unit = job->inc_x == 1 && job->inc_y == 1 && job->inc_r == 1;
+    size_t i, n;
+
+    for (i = start; i < end; i += n) {
+        n = strided_step(end - i, unit);
+
+        const float *a = strided_in(job->x, job->inc_x, i, n, abuf);
+        const float *b = strided_in(job->y, job->inc_y, i, n, bbuf);
+
+        if (job->inc_r == 1) {
+            job->binary((int)n, a, b, job->r + i);
+        } else {
+            job->binary((int)n, a, b, obuf);
+            strided_unpack(n, obuf, job->r + i * job->inc_r, job->inc_r);
+        }
+    }
+}
+
+#define ALM_VRSA_STRIDED_UNARY(fn)                                          \
+    void FN_PROTOTYPE(vrsa_##fn##i_64)(size_t len, const float *src,        \
+                                       size_t inc_src, float *dst,          \
+                                       size_t inc_dst)                      \
+    {                                                                       \
+        strided_job_t job = { src, NULL, dst, NULL, inc_src, 0, inc_dst, 0, \
+                              FN_PROTOTYPE(vrsa_##fn), NULL, {0} };         \
+                                                                            \
+        __alm_parallel_for(len, vrsa_strided_unary, &job);                  \
+    }
+
+#define ALM_VRSA_STRIDED_BINARY(fn)                                         \
+    void FN_PROTOTYPE(vrsa_##fn##i_64)(size_t len, const float *lhs,        \
+                                       size_t inc_a, const float *rhs,      \
+                                       size_t inc_b, float *dst,            \
+                                       size_t inc_res)                      \
+    {                                                                       \
+        strided_job_t job = { lhs, rhs, dst, NULL, inc_a, inc_b, inc_res,   \
+                              0, NULL, FN_PROTOTYPE(vrsa_##fn), {0} };      \
+                                                                            \
+        __alm_parallel_for(len, vrsa_strided_binary, &job);                 \
+    }
+
+/* Trigonometric */
+ALM_VRSA_STRIDED_UNARY(sinf)
+ALM_VRSA_STRIDED_UNARY(cosf)
+ALM_VRSA_STRIDED_UNARY(tanf)
+ALM_VRSA_STRIDED_UNARY(asinf)
+ALM_VRSA_STRIDED_UNARY(acosf)
+ALM_VRSA_STRIDED_UNARY(atanf)
+
+/* Hyperbolic */
+ALM_VRSA_STRIDED_UNARY(coshf)
+ALM_VRSA_STRIDED_UNARY(tanhf)
+
+/* Exponential & Logarithmic */
+ALM_VRSA_STRIDED_UNARY(expf)
+ALM_VRSA_STRIDED_UNARY(exp2f)
+ALM_VRSA_STRIDED_UNARY(exp10f)
+ALM_VRSA_STRIDED_UNARY(expm1f)
+ALM_VRSA_STRIDED_UNARY(logf)
+ALM_VRSA_STRIDED_UNARY(log2f)
+ALM_VRSA_STRIDED_UNARY(log10f)
+ALM_VRSA_STRIDED_UNARY(log1pf)
+
+/* Power & Root */
+ALM_VRSA_STRIDED_BINARY(powf)
+ALM_VRSA_STRIDED_UNARY(sqrtf)
+ALM_VRSA_STRIDED_UNARY(cbrtf)
+
+/* Error function */
+ALM_VRSA_STRIDED_UNARY(erff)
+ALM_VRSA_STRIDED_UNARY(erfcf)
+
+/* Nearest integer, absolute value */
+ALM_VRSA_STRIDED_UNARY(fabsf)
+ALM_VRSA_STRIDED_UNARY(roundf)
+
+/* Arithmetic, maximum & minimum */
+ALM_VRSA_STRIDED_BINARY(addf)
+ALM_VRSA_STRIDED_BINARY(subf)
+ALM_VRSA_STRIDED_BINARY(mulf)
+ALM_VRSA_STRIDED_BINARY(divf)
+ALM_VRSA_STRIDED_BINARY(fmaxf)
+ALM_VRSA_STRIDED_BINARY(fminf)
+
+static void
+vrsa_strided_sincos(void *arg, size_t start, size_t end)
+{
+    const strided_job_t *job = arg;
+    float ibuf[ALM_STRIDED_BLK], sbuf[ALM_STRIDED_BLK], cbuf[ALM_STRIDED_BLK];
+    int unit = job->inc_x == 1 && job->inc_r == 1 && job->inc_r2 == 1;
+    size_t i, n;
+
+    for (i = start; i < end; i += n) {
+        n = strided_step(end - i, unit);
+
+        const float *in = strided_in(job->x, job->inc_x, i, n, ibuf);
+        float *s = job->inc_r == 1 ? job->r + i : sbuf;
+        float *c = job->inc_r2 == 1 ? job->r2 + i : cbuf;
+
+        FN_PROTOTYPE(vrsa_sincosf)((int)n, in, s, c);
+
+        if (job->inc_r != 1)
+            strided_unpack(n, sbuf, job->r + i * job->inc_r, job->inc_r);
+        if (job->inc_r2 != 1)
+            strided_unpack(n, cbuf, job->r2 + i * job->inc_r2, job->inc_r2);
+    }
+}
+
+void FN_PROTOTYPE(vrsa_sincosfi_64)(size_t len, const float *src, size_t inc_src,
+                                    float *sin, size_t inc_sin,
+                                    float *cos, size_t inc_cos)
+{
+    strided_job_t job = { src, NULL, sin, cos, inc_src, 0, inc_sin, inc_cos,
+                          NULL, NULL, {0} };
+
+    __alm_parallel_for(len, vrsa_strided_sincos, &job);
+}
+
+static void
+vrsa_strided_powx(void *arg, size_t start, size_t end)
+{
+    const strided_job_t *job = arg;
+    float ibuf[ALM_STRIDED_BLK], obuf[ALM_STRIDED_BLK];
+    int unit = job->inc_x == 1 && job->inc_r == 1;
+    size_t i, n;
+
+    for (i = start; i < end; i += n) {
+        n = strided_step(end - i, unit);
+
+        const float *in = strided_in(job->x, job->inc_x, i, n, ibuf);
+
+        if (job->inc_r == 1) {
+            FN_PROTOTYPE(vrsa_powxf)((int)n, in, job->c[0], job->r + i);
+        } else {
+            FN_PROTOTYPE(vrsa_powxf)((int)n, in, job->c[0], obuf);
+            strided_unpack(n, obuf, job->r + i * job->inc_r, job->inc_r);
+        }
+    }
+}
+
+void FN_PROTOTYPE(vrsa_powxfi_64)(size_t len, const float *src, size_t inc_src,
+                                  float y, float *dst, size_t inc_dst)
+{
+    strided_job_t job = { src, NULL, dst, NULL, inc_src, 0, inc_dst, 0,
+                          NULL, NULL, {y} };
+
+    __alm_parallel_for(len, vrsa_strided_powx, &job);
+}
+
+static void
+vrsa_strided_linearfrac(void *arg, size_t start, size_t end)
+{
+    const strided_job_t *job = arg;
+    float xbuf[ALM_STRIDED_BLK], ybuf[ALM_STRIDED_BLK], obuf[ALM_STRIDED_BLK];
+    int unit = job->inc_x == 1 && job->inc_y == 1 && job->inc_r == 1;
+    const float *c = job->c;
+    size_t i, n;
+
+    for (i = start; i < end; i += n) {
+        n = strided_step(end - i, unit);
+
+        const float *a = strided_in(job->x, job->inc_x, i, n, xbuf);
+        const float *b = strided_in(job->y, job->inc_y, i, n, ybuf);
+
+        if (job->inc_r == 1) {
+            FN_PROTOTYPE(vrsa_linearfracf)((int)n, a, b, c[0], c[1], c[2], c[3], job->r + i);
+        } else {
+            FN_PROTOTYPE(vrsa_linearfracf)((int)n, a, b, c[0], c[1], c[2], c[3], obuf);
+            strided_unpack(n, obuf, job->r + i * job->inc_r, job->inc_r);
+        }
+    }
+}
+
+void FN_PROTOTYPE(vrsa_linearfracfi_64)(size_t len, const float *x, size_t inc_x,
+                                        const float *y, size_t inc_y,
+                                        float scx, float shx,
+                                        float scy, float shy,
+                                        float *dst, size_t inc_dst)
+{
+    strided_job_t job = { x, y, dst, NULL, inc_x, inc_y, inc_dst, 0,
+                          NULL, NULL, {scx, shx, scy, shy} };
+
+    __alm_parallel_for(len, vrsa_strided_linearfrac, &job);
+}